@@ -56,7 +56,7 @@ int App::Run(int commandShow) const
 
    if (m_appOptions.UseConsole())
    {
-      CommandLineApp commandLineApp{ m_appOptions.FilenamesList() };
+      CommandLineApp commandLineApp{ m_appOptions };
       return commandLineApp.Run();
    }
 
@@ -69,7 +69,8 @@ int App::Run(int commandShow) const
    CMessageLoop theLoop;
    _Module.AddMessageLoop(&theLoop);
 
-   MainFrame wndMain{ m_appOptions.FilenamesList() };
+   MainFrame wndMain{ m_appOptions.FilenamesList(), m_appOptions.DiffFiles(),
+      m_appOptions.SymbolConflicts() };
 
    if (wndMain.CreateEx() == nullptr)
    {
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2023 Michael Fink
+// Copyright (c) 2023-2026 Michael Fink
 //
 /// \file AppOptions.cpp
 /// \brief application options
@@ -19,6 +19,40 @@ AppOptions::AppOptions()
       _T("Shows file infos on the console, not in the Windows application"),
       std::ref(m_useConsole));
 
+   RegisterOption(
+      _T("d"),
+      _T("debug-info"),
+      _T("Only shows the debug infos of executable files on the console, e.g. the PDB reference"),
+      std::ref(m_debugInfoOnly));
+
+   RegisterOption(
+      _T("b"),
+      _T("build-id"),
+      _T("Only shows the GNU build-ids of ELF files on the console, one line per file"),
+      std::ref(m_buildIdOnly));
+
+   RegisterOption(
+      _T("f"),
+      _T("diff"),
+      _T("Compares two files of the same format structurally, e.g. two COFF libraries or PE images; use together with --console to show the differences on the console"),
+      std::ref(m_diffFiles));
+
+   RegisterOption(
+      _T("x"),
+      _T("symbol-conflicts"),
+      _T("Analyzes all specified COFF libraries and object files together for symbols that would be multiply defined when linking them; use together with --console to show the conflicts on the console"),
+      std::ref(m_symbolConflicts));
+
+   RegisterOption(
+      _T("s"),
+      _T("lookup-symbol"),
+      _T("Looks up a symbol in the symbol tables of ELF files or the export tries of Mach-O files and shows it on the console; can be specified multiple times"),
+      [&](const CString& symbolName) -> bool
+      {
+         m_lookupSymbolNamesList.push_back(symbolName);
+         return true;
+      });
+
    RegisterParameterHandler(
       [&](const CString& filename) -> bool
       {
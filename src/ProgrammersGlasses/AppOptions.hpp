@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2023 Michael Fink
+// Copyright (c) 2023-2026 Michael Fink
 //
 /// \file AppOptions.hpp
 /// \brief application options
@@ -17,8 +17,29 @@ public:
    /// ctor
    AppOptions();
 
-   /// returns if if console output should be used
-   bool UseConsole() const { return m_useConsole; }
+   /// returns if if console output should be used; also set when only the
+   /// debug infos or build-ids should be shown or symbols should be looked up
+   bool UseConsole() const
+   {
+      return m_useConsole || m_debugInfoOnly || m_buildIdOnly ||
+         !m_lookupSymbolNamesList.empty();
+   }
+
+   /// returns if only the debug infos of the files should be shown
+   bool DebugInfoOnly() const { return m_debugInfoOnly; }
+
+   /// returns if only the build-ids of the files should be shown
+   bool BuildIdOnly() const { return m_buildIdOnly; }
+
+   /// returns if the two specified files should be compared
+   bool DiffFiles() const { return m_diffFiles; }
+
+   /// returns if all specified files should be analyzed together for
+   /// conflicting symbol definitions
+   bool SymbolConflicts() const { return m_symbolConflicts; }
+
+   /// returns the list of symbol names to look up in the files
+   const std::vector<CString>& LookupSymbolNamesList() const { return m_lookupSymbolNamesList; }
 
    /// returns the list of filenames to open
    const std::vector<CString> FilenamesList() const { return m_filenamesList; }
@@ -27,6 +48,21 @@ private:
    /// indicates if console output should be used
    bool m_useConsole = false;
 
+   /// indicates if only the debug infos of the files should be shown
+   bool m_debugInfoOnly = false;
+
+   /// indicates if only the build-ids of the files should be shown
+   bool m_buildIdOnly = false;
+
+   /// indicates if the two specified files should be compared
+   bool m_diffFiles = false;
+
+   /// indicates if the specified files should be analyzed for symbol conflicts
+   bool m_symbolConflicts = false;
+
+   /// list of symbol names to look up
+   std::vector<CString> m_lookupSymbolNamesList;
+
    /// list of filenames to open
    std::vector<CString> m_filenamesList;
 };
@@ -1,28 +1,72 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020-2023 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file CommandLineApp.cpp
 /// \brief command line application class
 //
 #include "stdafx.h"
 #include "CommandLineApp.hpp"
+#include "AppOptions.hpp"
 #include "IReader.hpp"
 #include "INode.hpp"
 #include "CodeTextViewNode.hpp"
+#include "File.hpp"
+#include "dev/pe/PortableExecutableImage.hpp"
+#include "dev/pe/DebugDirectoryTable.hpp"
+#include "dev/elf/ElfSymbolTable.hpp"
+#include "dev/elf/ElfNotes.hpp"
+#include "dev/macho/MachOReader.hpp"
+#include "dev/macho/MachOExportTrie.hpp"
 #include <ulib/Timer.hpp>
 
-CommandLineApp::CommandLineApp(const std::vector<CString>& filenamesList)
-   :m_filenamesList(filenamesList)
+CommandLineApp::CommandLineApp(const AppOptions& appOptions)
+   :m_filenamesList(appOptions.FilenamesList()),
+   m_debugInfoOnly(appOptions.DebugInfoOnly()),
+   m_buildIdOnly(appOptions.BuildIdOnly()),
+   m_diffFiles(appOptions.DiffFiles()),
+   m_symbolConflicts(appOptions.SymbolConflicts()),
+   m_lookupSymbolNamesList(appOptions.LookupSymbolNamesList())
 {
    _tprintf(_T("Programmer's Glasses - a developer's file content viewer\n\n"));
 }
 
 int CommandLineApp::Run() const
 {
+   if (m_diffFiles)
+   {
+      if (m_filenamesList.size() != 2)
+      {
+         _tprintf(_T("Error: Exactly two files must be specified to compare them\n"));
+         return 1;
+      }
+
+      OutputDiff(m_filenamesList[0], m_filenamesList[1]);
+      return 0;
+   }
+
+   if (m_symbolConflicts)
+   {
+      if (m_filenamesList.empty())
+      {
+         _tprintf(_T("Error: At least one file must be specified to analyze symbol conflicts\n"));
+         return 1;
+      }
+
+      OutputSymbolConflicts();
+      return 0;
+   }
+
    for (const CString& filename : m_filenamesList)
    {
-      OutputFile(filename);
+      if (!m_lookupSymbolNamesList.empty())
+         OutputSymbolLookup(filename);
+      else if (m_buildIdOnly)
+         OutputBuildId(filename);
+      else if (m_debugInfoOnly)
+         OutputDebugInfo(filename);
+      else
+         OutputFile(filename);
    }
 
    return 0;
@@ -71,6 +115,277 @@ void CommandLineApp::OutputFile(const CString& filename) const
    _tprintf(_T("\n"));
 }
 
+void CommandLineApp::OutputDiff(const CString& oldFilename, const CString& newFilename) const
+{
+   _tprintf(_T("Comparing files: %s and %s\n"),
+      oldFilename.GetString(),
+      newFilename.GetString());
+
+   for (const CString& filename : { oldFilename, newFilename })
+   {
+      if (!Path::FileExists(filename))
+      {
+         _tprintf(_T("Error: Couldn't open file: %s\n\n"), filename.GetString());
+         return;
+      }
+   }
+
+   CString errorText;
+   auto reader = m_moduleManager.LoadDiff(oldFilename, newFilename, errorText);
+
+   if (reader == nullptr)
+   {
+      _tprintf(_T("Error: %s\n\n"), errorText.GetString());
+      return;
+   }
+
+   Timer loadTimer;
+   loadTimer.Start();
+   reader->Load();
+   loadTimer.Stop();
+
+   _tprintf(_T("Comparing files took %u ms.\n"),
+      int(loadTimer.TotalElapsed() * 1000));
+
+   DumpNodeRecursively(reader->RootNode());
+
+   reader->Cleanup();
+
+   _tprintf(_T("\n"));
+}
+
+void CommandLineApp::OutputSymbolConflicts() const
+{
+   _tprintf(_T("Analyzing symbol conflicts of %zu files\n"), m_filenamesList.size());
+
+   for (const CString& filename : m_filenamesList)
+   {
+      if (!Path::FileExists(filename))
+      {
+         _tprintf(_T("Error: Couldn't open file: %s\n\n"), filename.GetString());
+         return;
+      }
+   }
+
+   CString errorText;
+   auto reader = m_moduleManager.LoadSymbolConflicts(m_filenamesList, errorText);
+
+   if (reader == nullptr)
+   {
+      _tprintf(_T("Error: %s\n\n"), errorText.GetString());
+      return;
+   }
+
+   Timer loadTimer;
+   loadTimer.Start();
+   reader->Load();
+   loadTimer.Stop();
+
+   _tprintf(_T("Analyzing symbol conflicts took %u ms.\n"),
+      int(loadTimer.TotalElapsed() * 1000));
+
+   DumpNodeRecursively(reader->RootNode());
+
+   reader->Cleanup();
+
+   _tprintf(_T("\n"));
+}
+
+void CommandLineApp::OutputDebugInfo(const CString& filename) const
+{
+   _tprintf(_T("Debug infos of file: %s\n"), filename.GetString());
+
+   if (!Path::FileExists(filename))
+   {
+      _tprintf(_T("Error: Couldn't open file: %s\n\n"), filename.GetString());
+      return;
+   }
+
+   // only the headers and the debug directory are accessed, so that the rest
+   // of the mapped file is never read from disk
+   File file{ filename };
+   PortableExecutableImage image{ file };
+
+   if (!image.IsValid())
+   {
+      _tprintf(_T("Error: Not a PE image file: %s\n\n"), filename.GetString());
+      return;
+   }
+
+   DebugDirectoryTable debugDirectory{ image };
+   if (!debugDirectory.IsAvailable())
+   {
+      _tprintf(_T("No debug directory found.\n\n"));
+      return;
+   }
+
+   for (size_t index = 0; index < debugDirectory.Count(); index++)
+   {
+      _tprintf(_T("%s: %s\n"),
+         debugDirectory.TypeName(index).GetString(),
+         debugDirectory.FormatRecord(index).GetString());
+
+      std::optional<CodeViewPdbInfo> pdbInfo = debugDirectory.GetCodeViewPdbInfo(index);
+      if (pdbInfo.has_value())
+         _tprintf(_T("Symbol server key: %s\n"),
+            pdbInfo->FormatSymbolServerKey().GetString());
+   }
+
+   _tprintf(_T("\n"));
+}
+
+void CommandLineApp::OutputBuildId(const CString& filename) const
+{
+   if (!Path::FileExists(filename))
+   {
+      _tprintf(_T("Error: Couldn't open file: %s\n"), filename.GetString());
+      return;
+   }
+
+   // only the ELF header, the program headers and the note segments are
+   // accessed, so that the rest of the mapped file is never read from disk
+   File file{ filename };
+   ElfImage image{ file, false };
+
+   if (!image.IsValid())
+   {
+      _tprintf(_T("Error: Not an ELF file: %s\n"), filename.GetString());
+      return;
+   }
+
+   std::optional<CString> buildId = ElfNotes{ image }.BuildId();
+
+   // object files have no program headers, so their note sections are used
+   if (!buildId.has_value() &&
+      image.Segments().empty())
+   {
+      ElfImage fullImage{ file };
+      buildId = ElfNotes{ fullImage }.BuildId();
+   }
+
+   // one line per file, in the same format as checksum tools
+   _tprintf(_T("%s  %s\n"),
+      buildId.has_value() ? buildId.value().GetString() : _T("-"),
+      filename.GetString());
+}
+
+void CommandLineApp::OutputSymbolLookup(const CString& filename) const
+{
+   _tprintf(_T("Symbol lookup in file: %s\n"), filename.GetString());
+
+   if (!Path::FileExists(filename))
+   {
+      _tprintf(_T("Error: Couldn't open file: %s\n\n"), filename.GetString());
+      return;
+   }
+
+   // the hash tables of the symbol tables and the export tries are used for
+   // the lookup, so only the accessed parts of the mapped file are read from disk
+   File file{ filename };
+
+   if (MachOReader::IsMachOFile(file))
+      OutputMachOSymbolLookup(file);
+   else
+      OutputElfSymbolLookup(file);
+
+   _tprintf(_T("\n"));
+}
+
+void CommandLineApp::OutputElfSymbolLookup(const File& file) const
+{
+   ElfImage image{ file };
+
+   if (!image.IsValid())
+   {
+      _tprintf(_T("Error: Not an ELF or Mach-O file: %s\n"), file.Filename().GetString());
+      return;
+   }
+
+   std::vector<std::unique_ptr<ElfSymbolTable>> symbolTablesList;
+   for (const ElfSection& section : image.Sections())
+   {
+      if (section.type == c_elfSectionTypeSymbolTable ||
+         section.type == c_elfSectionTypeDynamicSymbols)
+      {
+         auto symbolTable = std::make_unique<ElfSymbolTable>(image, section);
+         if (symbolTable->IsValid())
+            symbolTablesList.push_back(std::move(symbolTable));
+      }
+   }
+
+   for (const CString& symbolName : m_lookupSymbolNamesList)
+   {
+      bool found = false;
+
+      for (const auto& symbolTable : symbolTablesList)
+      {
+         std::optional<size_t> index = symbolTable->Lookup(CStringA(CT2A(symbolName, CP_UTF8)));
+         if (!index.has_value())
+            continue;
+
+         ElfSymbol symbol = symbolTable->GetSymbol(index.value());
+
+         _tprintf(_T("%s: %s [%zu], value 0x%08llx, size %llu, %s, %s, section %u\n"),
+            symbolName.GetString(),
+            symbolTable->Section().name.GetString(),
+            index.value(),
+            symbol.value,
+            symbol.size,
+            GetValueFromMapOrDefault<DWORD>(
+               g_mapElfSymbolTypeToDisplayText, symbol.type, _T("unknown")),
+            GetValueFromMapOrDefault<DWORD>(
+               g_mapElfSymbolBindingToDisplayText, symbol.binding, _T("unknown")),
+            symbol.sectionIndex);
+
+         found = true;
+      }
+
+      if (!found)
+         _tprintf(_T("%s: not found\n"), symbolName.GetString());
+   }
+}
+
+void CommandLineApp::OutputMachOSymbolLookup(const File& file) const
+{
+   std::vector<std::pair<size_t, size_t>> imageRangesList = MachOReader::FindImages(file);
+
+   std::vector<std::unique_ptr<MachOImage>> imagesList;
+   for (const auto& [imageOffset, imageSize] : imageRangesList)
+   {
+      auto image = std::make_unique<MachOImage>(file, imageOffset, imageSize);
+      if (image->IsValid())
+         imagesList.push_back(std::move(image));
+   }
+
+   for (const CString& symbolName : m_lookupSymbolNamesList)
+   {
+      bool found = false;
+
+      for (const auto& image : imagesList)
+      {
+         MachOExportTrie exportTrie{ *image };
+         if (!exportTrie.IsValid())
+            continue;
+
+         std::optional<MachOExport> symbol = exportTrie.Lookup(CStringA(CT2A(symbolName, CP_UTF8)));
+         if (!symbol.has_value())
+            continue;
+
+         _tprintf(_T("%s: %s export trie, address 0x%08llx, %s\n"),
+            symbolName.GetString(),
+            GetValueFromMapOrDefault<DWORD>(
+               g_mapMachOCpuTypeToDisplayText, image->CpuType(), _T("unknown")),
+            symbol.value().address,
+            MachOExportTrie::GetFlagsDisplayText(symbol.value().flags).GetString());
+
+         found = true;
+      }
+
+      if (!found)
+         _tprintf(_T("%s: not found\n"), symbolName.GetString());
+   }
+}
+
 void CommandLineApp::DumpNodeRecursively(std::shared_ptr<INode> node) const
 {
    _tprintf(_T("Node name: %s\n"), node->DisplayName().GetString());
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020-2023 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file CommandLineApp.hpp
 /// \brief command line application class
@@ -10,16 +10,22 @@
 #include "ModuleManager.hpp"
 
 class INode;
+class AppOptions;
+class File;
 
 /// \brief command line application
 /// The command line app loads all files specified on the command line and
 /// dumps the collected nodes on the command line.
-/// Mainly used to run tests and collect coverage.
+/// Mainly used to run tests and collect coverage. Alternatively only the debug
+/// infos of executable files or the build-ids of ELF files are shown, without
+/// loading the whole file, or symbols are looked up in the symbol tables of
+/// ELF files or the export tries of Mach-O files, or two files are compared,
+/// or COFF libraries and object files are analyzed for symbol conflicts.
 class CommandLineApp
 {
 public:
    /// ctor
-   CommandLineApp(const std::vector<CString>& filenamesList);
+   explicit CommandLineApp(const AppOptions& appOptions);
 
    /// runs command line app
    int Run() const;
@@ -28,6 +34,28 @@ private:
    /// loads a file and outputs its node tree
    void OutputFile(const CString& filename) const;
 
+   /// compares two files and outputs the differences
+   void OutputDiff(const CString& oldFilename, const CString& newFilename) const;
+
+   /// analyzes all files together and outputs the symbol conflicts
+   void OutputSymbolConflicts() const;
+
+   /// outputs the debug infos of a file
+   void OutputDebugInfo(const CString& filename) const;
+
+   /// outputs the build-id of an ELF file
+   void OutputBuildId(const CString& filename) const;
+
+   /// looks up symbols in the symbol tables of an ELF file or in the export
+   /// tries of a Mach-O file
+   void OutputSymbolLookup(const CString& filename) const;
+
+   /// looks up symbols in the symbol tables of an ELF file
+   void OutputElfSymbolLookup(const File& file) const;
+
+   /// looks up symbols in the export tries of all images of a Mach-O file
+   void OutputMachOSymbolLookup(const File& file) const;
+
    /// dumps a single node; called recursively
    void DumpNodeRecursively(std::shared_ptr<INode> node) const;
 
@@ -35,6 +63,21 @@ private:
    /// list of filenames to load and dump
    std::vector<CString> m_filenamesList;
 
+   /// indicates if only the debug infos of the files should be output
+   bool m_debugInfoOnly;
+
+   /// indicates if only the build-ids of the files should be output
+   bool m_buildIdOnly;
+
+   /// indicates if the two specified files should be compared
+   bool m_diffFiles;
+
+   /// indicates if the specified files should be analyzed for symbol conflicts
+   bool m_symbolConflicts;
+
+   /// list of symbol names to look up
+   std::vector<CString> m_lookupSymbolNamesList;
+
    /// module manager
    ModuleManager m_moduleManager;
 };
@@ -40,3 +40,94 @@ DWORD GetBufferValueWithEndianness(const BYTE* buffer, size_t valueSize, bool li
 
    return 0;
 }
+
+constexpr ULONGLONG c_xxh64Prime1 = 0x9E3779B185EBCA87ULL; ///< XXH64 prime 1
+constexpr ULONGLONG c_xxh64Prime2 = 0xC2B2AE3D27D4EB4FULL; ///< XXH64 prime 2
+constexpr ULONGLONG c_xxh64Prime3 = 0x165667B19E3779F9ULL; ///< XXH64 prime 3
+constexpr ULONGLONG c_xxh64Prime4 = 0x85EBCA77C2B2AE63ULL; ///< XXH64 prime 4
+constexpr ULONGLONG c_xxh64Prime5 = 0x27D4EB2F165667C5ULL; ///< XXH64 prime 5
+
+/// rotates 64-bit value left
+static inline ULONGLONG RotateLeft64(ULONGLONG value, int bits)
+{
+   return (value << bits) | (value >> (64 - bits));
+}
+
+/// XXH64 round of a single lane
+static inline ULONGLONG Xxh64Round(ULONGLONG accumulator, ULONGLONG input)
+{
+   accumulator += input * c_xxh64Prime2;
+   accumulator = RotateLeft64(accumulator, 31);
+   return accumulator * c_xxh64Prime1;
+}
+
+/// XXH64 merge of a lane into the hash value
+static inline ULONGLONG Xxh64MergeRound(ULONGLONG hash, ULONGLONG lane)
+{
+   hash ^= Xxh64Round(0, lane);
+   return hash * c_xxh64Prime1 + c_xxh64Prime4;
+}
+
+ULONGLONG CalculateHash64(const BYTE* data, size_t size)
+{
+   const BYTE* end = data + size;
+   ULONGLONG hash = 0;
+
+   if (size >= 32)
+   {
+      ULONGLONG lane1 = c_xxh64Prime1 + c_xxh64Prime2;
+      ULONGLONG lane2 = c_xxh64Prime2;
+      ULONGLONG lane3 = 0;
+      ULONGLONG lane4 = 0 - c_xxh64Prime1;
+
+      const BYTE* limit = end - 32;
+      do
+      {
+         lane1 = Xxh64Round(lane1, *reinterpret_cast<const ULONGLONG*>(data));
+         lane2 = Xxh64Round(lane2, *reinterpret_cast<const ULONGLONG*>(data + 8));
+         lane3 = Xxh64Round(lane3, *reinterpret_cast<const ULONGLONG*>(data + 16));
+         lane4 = Xxh64Round(lane4, *reinterpret_cast<const ULONGLONG*>(data + 24));
+         data += 32;
+      } while (data <= limit);
+
+      hash = RotateLeft64(lane1, 1) + RotateLeft64(lane2, 7) +
+         RotateLeft64(lane3, 12) + RotateLeft64(lane4, 18);
+
+      hash = Xxh64MergeRound(hash, lane1);
+      hash = Xxh64MergeRound(hash, lane2);
+      hash = Xxh64MergeRound(hash, lane3);
+      hash = Xxh64MergeRound(hash, lane4);
+   }
+   else
+      hash = c_xxh64Prime5;
+
+   hash += size;
+
+   for (; data + 8 <= end; data += 8)
+   {
+      hash ^= Xxh64Round(0, *reinterpret_cast<const ULONGLONG*>(data));
+      hash = RotateLeft64(hash, 27) * c_xxh64Prime1 + c_xxh64Prime4;
+   }
+
+   if (data + 4 <= end)
+   {
+      hash ^= *reinterpret_cast<const DWORD*>(data) * c_xxh64Prime1;
+      hash = RotateLeft64(hash, 23) * c_xxh64Prime2 + c_xxh64Prime3;
+      data += 4;
+   }
+
+   for (; data < end; data++)
+   {
+      hash ^= *data * c_xxh64Prime5;
+      hash = RotateLeft64(hash, 11) * c_xxh64Prime1;
+   }
+
+   // final avalanche
+   hash ^= hash >> 33;
+   hash *= c_xxh64Prime2;
+   hash ^= hash >> 29;
+   hash *= c_xxh64Prime3;
+   hash ^= hash >> 32;
+
+   return hash;
+}
@@ -42,6 +42,21 @@ inline DWORD SwapEndianness(DWORD value)
       ((value & 0x000000ff) << 24);
 }
 
+/// swaps 64-bit qwords from/to LE to BE
+template <>
+inline ULONGLONG SwapEndianness(ULONGLONG value)
+{
+   return
+      (static_cast<ULONGLONG>(SwapEndianness(static_cast<DWORD>(value & 0xffffffff))) << 32) |
+      SwapEndianness(static_cast<DWORD>(value >> 32));
+}
+
+/// \brief Calculates a fast, non-cryptographic 64-bit hash of the data
+/// \details Uses the XXH64 algorithm; the data is processed in four
+/// independent lanes of 8 bytes each, so that the compiler can keep all
+/// lanes in registers and interleave the multiplications.
+ULONGLONG CalculateHash64(const BYTE* data, size_t size);
+
 /// returns bitfield bits from given value
 template <typename T>
 inline T GetBits(T value, size_t start, size_t count)
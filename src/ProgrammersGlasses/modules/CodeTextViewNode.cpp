@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file CodeTextViewNode.cpp
 /// \brief node showing a code text view
@@ -11,5 +11,5 @@
 
 std::shared_ptr<IContentView> CodeTextViewNode::GetContentView()
 {
-   return std::make_shared<CodeTextView>(m_text);
+   return std::make_shared<CodeTextView>(GetText());
 }
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file CodeTextViewNode.hpp
 /// \brief node showing a code text view
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "StaticNode.hpp"
+#include <functional>
 
 class IContentView;
 
@@ -15,20 +16,50 @@ class IContentView;
 class CodeTextViewNode : public StaticNode
 {
 public:
+   /// function that produces the text to display
+   using TextProvider = std::function<CString()>;
+
    /// ctor
    CodeTextViewNode(const CString& displayName, NodeTreeIconID iconID)
       :StaticNode(displayName, iconID)
    {
    }
 
+   /// ctor; the text is produced when it is needed the first time, e.g.
+   /// when the node's content view is shown, for text that is expensive to
+   /// produce
+   CodeTextViewNode(const CString& displayName, NodeTreeIconID iconID,
+      TextProvider textProvider)
+      :StaticNode(displayName, iconID),
+      m_textProvider(textProvider)
+   {
+   }
+
    /// sets node text to display
    void SetText(const CString& text)
    {
       m_text = text;
    }
 
-   /// returns node text
-   CString GetText() const { return m_text; }
+   /// sets text provider; the text is produced when it is needed the first
+   /// time, and replaces any text set before
+   void SetTextProvider(TextProvider textProvider)
+   {
+      m_textProvider = textProvider;
+   }
+
+   /// returns node text; when a text provider was set, the text is produced
+   /// on the first call and kept
+   const CString& GetText()
+   {
+      if (m_textProvider != nullptr)
+      {
+         m_text = m_textProvider();
+         m_textProvider = nullptr;
+      }
+
+      return m_text;
+   }
 
    // Inherited via INode
    std::shared_ptr<IContentView> GetContentView() override;
@@ -36,4 +67,7 @@ public:
 private:
    /// node text to display
    CString m_text;
+
+   /// text provider; reset after the text was produced
+   TextProvider m_textProvider;
 };
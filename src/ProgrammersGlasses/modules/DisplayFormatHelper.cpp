@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020-2023 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file DisplayFormatHelper.cpp
 /// \brief display format helper
@@ -27,7 +27,7 @@ CString DisplayFormatHelper::FormatBitFlagsFromMap(const std::map<DWORD, LPCTSTR
 {
    CString text;
    DWORD unmappedFlags = 0U;
-   for (unsigned int bits = 1; bits < 32; bits++)
+   for (unsigned int bits = 0; bits < 32; bits++)
    {
       DWORD testFlag = 1U << bits;
       if ((flags & testFlag) == 0)
@@ -80,6 +80,16 @@ CString DisplayFormatHelper::FormatRawData(
       else if (offset != 0)
          text.AppendChar(_T(' '));
 
+      if (valueSize == 8)
+      {
+         ULONGLONG value64 = *reinterpret_cast<const ULONGLONG*>(rawData + offset);
+         if (!littleEndian)
+            value64 = SwapEndianness(value64);
+
+         text.AppendFormat(_T("%016llx"), value64);
+         continue;
+      }
+
       DWORD value = GetBufferValueWithEndianness(rawData + offset, valueSize, littleEndian);
 
       switch (valueSize)
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2023 Michael Fink
+// Copyright (c) 2023-2026 Michael Fink
 //
 /// \file FilterSortListViewNode.cpp
 /// \brief node with a list view that can be filtered and sorted
@@ -21,8 +21,48 @@ FilterSortListViewNode::FilterSortListViewNode(const CString& displayName, NodeT
 {
 }
 
+FilterSortListViewNode::FilterSortListViewNode(const CString& displayName, NodeTreeIconID iconID,
+   const std::vector<CString>& columnsList,
+   size_t rowCount,
+   RowFormatter rowFormatter,
+   bool allowFiltering)
+   :StaticNode(displayName, iconID),
+   m_columnsList(columnsList),
+   m_rowCount(rowCount),
+   m_rowFormatter(rowFormatter),
+   m_allowFiltering(allowFiltering)
+{
+}
+
+FilterSortListViewNode::FilterSortListViewNode(const CString& displayName, NodeTreeIconID iconID,
+   const std::vector<CString>& columnsList,
+   DataProvider dataProvider,
+   bool allowFiltering)
+   :StaticNode(displayName, iconID),
+   m_columnsList(columnsList),
+   m_dataProvider(dataProvider),
+   m_allowFiltering(allowFiltering)
+{
+}
+
 std::shared_ptr<IContentView> FilterSortListViewNode::GetContentView()
 {
+   if (m_dataProvider)
+   {
+      m_data = m_dataProvider();
+      m_dataProvider = nullptr;
+   }
+
+   if (m_rowFormatter)
+   {
+      m_data.reserve(m_rowCount);
+
+      for (size_t rowIndex = 0; rowIndex < m_rowCount; rowIndex++)
+         m_data.push_back(m_rowFormatter(rowIndex));
+
+      m_rowFormatter = nullptr;
+   }
+
    if (m_allowFiltering)
       return std::make_shared<FilterSortListViewForm>(m_columnsList, m_data);
    else
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file FilterSortListViewNode.hpp
 /// \brief node with a list view that can be filtered and sorted
@@ -8,21 +8,43 @@
 #pragma once
 
 #include "modules/StaticNode.hpp"
+#include <functional>
 
 class StructDefinition;
 
 /// \brief List view node showing a filterable and sortable list view
 /// \details The node uses a list view showing tabular data. The data can be
-/// sorted and filtered in order to find relevant entries.
+/// sorted and filtered in order to find relevant entries. For large tables
+/// the rows can be formatted lazily, when the content view is first shown.
 class FilterSortListViewNode : public StaticNode
 {
 public:
-   /// ctor
+   /// function type to format a single row of data, by row index
+   using RowFormatter = std::function<std::vector<CString>(size_t rowIndex)>;
+
+   /// function type to produce all rows of data, for tables where the number
+   /// of rows is only known after decoding
+   using DataProvider = std::function<std::vector<std::vector<CString>>()>;
+
+   /// ctor; takes already formatted data
    FilterSortListViewNode(const CString& displayName, NodeTreeIconID iconID,
       const std::vector<CString>& columnsList,
       const std::vector<std::vector<CString>>& data,
       bool allowFiltering);
 
+   /// ctor; formats the rows using the row formatter when first needed
+   FilterSortListViewNode(const CString& displayName, NodeTreeIconID iconID,
+      const std::vector<CString>& columnsList,
+      size_t rowCount,
+      RowFormatter rowFormatter,
+      bool allowFiltering);
+
+   /// ctor; produces the rows using the data provider when first needed
+   FilterSortListViewNode(const CString& displayName, NodeTreeIconID iconID,
+      const std::vector<CString>& columnsList,
+      DataProvider dataProvider,
+      bool allowFiltering);
+
    // Inherited via INode
    std::shared_ptr<IContentView> GetContentView() override;
 
@@ -33,6 +55,15 @@ private:
    /// all data to display, first by line, then by column
    std::vector<std::vector<CString>> m_data;
 
+   /// number of rows still to format using the row formatter
+   size_t m_rowCount = 0;
+
+   /// row formatter; empty when the data is already formatted
+   RowFormatter m_rowFormatter;
+
+   /// data provider; empty when the data is already produced
+   DataProvider m_dataProvider;
+
    /// indicates if the list view allows filtering entries
    bool m_allowFiltering;
 };
@@ -8,11 +8,23 @@
 #include "stdafx.h"
 #include "HexDataViewNode.hpp"
 #include "userinterface/HexDataView.hpp"
+#include "userinterface/CodeTextView.hpp"
 
 std::shared_ptr<IContentView> HexDataViewNode::GetContentView()
 {
-   return std::make_shared<HexDataView>(
-      m_file,
-      m_startOffset,
-      m_dataSize);
+   if (m_file != nullptr)
+   {
+      return std::make_shared<HexDataView>(
+         *m_file,
+         m_startOffset,
+         m_dataSize);
+   }
+
+   CString errorText;
+   std::shared_ptr<const std::vector<BYTE>> dataBuffer = m_dataProvider(errorText);
+
+   if (dataBuffer == nullptr)
+      return std::make_shared<CodeTextView>(_T("Error: ") + errorText + _T("\n"));
+
+   return std::make_shared<HexDataView>(dataBuffer);
 }
@@ -8,14 +8,24 @@
 #pragma once
 
 #include "StaticNode.hpp"
+#include <functional>
 
 class IContentView;
 class File;
 
 /// \brief node showing hex data
+/// \details Shows a block of data from a file, or data from a memory buffer
+/// that is provided each time the node's content view is shown, e.g. for data
+/// that is expensive to produce, like decompressed data. The node doesn't keep
+/// the buffer, so that the provider can hold it in a cache bounded in size.
 class HexDataViewNode : public StaticNode
 {
 public:
+   /// function that provides the data to display; returns nullptr and sets
+   /// an error text when the data isn't available
+   using DataProvider =
+      std::function<std::shared_ptr<const std::vector<BYTE>>(CString& errorText)>;
+
    /// ctor
    HexDataViewNode(
       const CString& displayName,
@@ -24,22 +34,36 @@ public:
       size_t startOffset,
       size_t dataSize)
       :StaticNode(displayName, iconID),
-      m_file(file),
+      m_file(&file),
       m_startOffset(startOffset),
       m_dataSize(dataSize)
    {
    }
 
+   /// ctor; displays data from a memory buffer, requested from the data
+   /// provider each time the content view is shown
+   HexDataViewNode(
+      const CString& displayName,
+      NodeTreeIconID iconID,
+      DataProvider dataProvider)
+      :StaticNode(displayName, iconID),
+      m_dataProvider(dataProvider)
+   {
+   }
+
    // Inherited via INode
    std::shared_ptr<IContentView> GetContentView() override;
 
 private:
-   /// file data to display
-   const File& m_file;
+   /// file data to display; nullptr when displaying a memory buffer
+   const File* m_file = nullptr;
 
    /// start offset in file
-   size_t m_startOffset;
+   size_t m_startOffset = 0;
 
    /// size of data to display
-   size_t m_dataSize;
+   size_t m_dataSize = 0;
+
+   /// data provider for memory buffer data
+   DataProvider m_dataProvider;
 };
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file IModule.hpp
 /// \brief module interface
@@ -46,4 +46,21 @@ public:
 
    /// Gets a reader for for the given file
    virtual std::shared_ptr<IReader> OpenReader(const File& file) const = 0;
+
+   /// Gets a reader that compares two files that are both applicable for this
+   /// module; returns nullptr when the module doesn't support comparing files
+   virtual std::shared_ptr<IReader> OpenDiffReader(
+      const File& /*oldFile*/, const File& /*newFile*/) const
+   {
+      return nullptr;
+   }
+
+   /// Gets a reader that analyzes multiple files, that are all applicable for
+   /// this module, together for conflicting symbol definitions; returns
+   /// nullptr when the module doesn't support analyzing symbol conflicts
+   virtual std::shared_ptr<IReader> OpenSymbolConflictsReader(
+      const std::vector<File>& /*files*/) const
+   {
+      return nullptr;
+   }
 };
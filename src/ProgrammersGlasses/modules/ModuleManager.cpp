@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020-2023 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file ModuleManager.cpp
 /// \brief module manager
@@ -11,15 +11,23 @@
 #include "dev/coff/CoffModule.hpp"
 #include "dev/pe/PortableExecutableModule.hpp"
 #include "dev/elf/ElfModule.hpp"
+#include "dev/macho/MachOModule.hpp"
+#include "dev/minidump/MinidumpModule.hpp"
+#include "dev/pdb/PdbModule.hpp"
 #include "images/png/PngImageModule.hpp"
 #include "audio/sid/SidAudioModule.hpp"
 #include "misc/c64/DiskImageModule.hpp"
 
 ModuleManager::ModuleManager()
 {
+   // ELF and Mach-O modules come first, since COFF has no magic bytes and all
+   // of them use .o files
+   m_moduleList.push_back(std::make_shared<ElfModule>());
+   m_moduleList.push_back(std::make_shared<MachOModule>());
    m_moduleList.push_back(std::make_shared<CoffModule>());
    m_moduleList.push_back(std::make_shared<PortableExecutableModule>());
-   m_moduleList.push_back(std::make_shared<ElfModule>());
+   m_moduleList.push_back(std::make_shared<MinidumpModule>());
+   m_moduleList.push_back(std::make_shared<PdbModule>());
    m_moduleList.push_back(std::make_shared<PngImageModule>());
    m_moduleList.push_back(std::make_shared<SidAudioModule>());
    m_moduleList.push_back(std::make_shared<DiskImageModule>());
@@ -47,16 +55,96 @@ bool ModuleManager::IsModuleAvailable(const CString& filename) const
 
 std::shared_ptr<IReader> ModuleManager::LoadFile(const CString& filename) const
 {
-   CString extension = Path::ExtensionOnly(filename);
+   File file{ filename };
 
-   for (auto theModule : m_moduleList)
-      if (IsMatchingModule(*theModule, extension))
+   std::shared_ptr<IModule> theModule = FindModuleForFile(file);
+
+   return theModule != nullptr ? theModule->OpenReader(file) : nullptr;
+}
+
+std::shared_ptr<IReader> ModuleManager::LoadDiff(const CString& oldFilename,
+   const CString& newFilename, CString& errorText) const
+{
+   File oldFile{ oldFilename };
+   File newFile{ newFilename };
+
+   std::shared_ptr<IModule> oldModule = FindModuleForFile(oldFile);
+   std::shared_ptr<IModule> newModule = FindModuleForFile(newFile);
+
+   if (oldModule == nullptr || newModule == nullptr)
+   {
+      errorText = _T("No suitable module found for file: ") +
+         (oldModule == nullptr ? oldFilename : newFilename);
+      return nullptr;
+   }
+
+   if (oldModule != newModule)
+   {
+      errorText.Format(_T("The files are read by different modules: %s and %s"),
+         oldModule->DisplayName().GetString(),
+         newModule->DisplayName().GetString());
+      return nullptr;
+   }
+
+   auto reader = oldModule->OpenDiffReader(oldFile, newFile);
+   if (reader == nullptr)
+      errorText = _T("The module doesn't support comparing files: ") + oldModule->DisplayName();
+
+   return reader;
+}
+
+std::shared_ptr<IReader> ModuleManager::LoadSymbolConflicts(
+   const std::vector<CString>& filenamesList, CString& errorText) const
+{
+   std::vector<File> files;
+   std::shared_ptr<IModule> firstModule;
+
+   for (const CString& filename : filenamesList)
+   {
+      File file{ filename };
+
+      std::shared_ptr<IModule> theModule = FindModuleForFile(file);
+      if (theModule == nullptr)
+      {
+         errorText = _T("No suitable module found for file: ") + filename;
+         return nullptr;
+      }
+
+      if (firstModule == nullptr)
+         firstModule = theModule;
+      else if (theModule != firstModule)
       {
-         File file{ filename };
-         if (theModule->IsModuleApplicableForFile(file))
-            return theModule->OpenReader(file);
+         errorText.Format(_T("The files are read by different modules: %s and %s"),
+            firstModule->DisplayName().GetString(),
+            theModule->DisplayName().GetString());
+         return nullptr;
       }
 
+      files.push_back(file);
+   }
+
+   if (firstModule == nullptr)
+   {
+      errorText = _T("No files were specified to analyze");
+      return nullptr;
+   }
+
+   auto reader = firstModule->OpenSymbolConflictsReader(files);
+   if (reader == nullptr)
+      errorText = _T("The module doesn't support analyzing symbol conflicts: ") + firstModule->DisplayName();
+
+   return reader;
+}
+
+std::shared_ptr<IModule> ModuleManager::FindModuleForFile(const File& file) const
+{
+   CString extension = Path::ExtensionOnly(file.Filename());
+
+   for (auto theModule : m_moduleList)
+      if (IsMatchingModule(*theModule, extension) &&
+         theModule->IsModuleApplicableForFile(file))
+         return theModule;
+
    return nullptr;
 }
 
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file ModuleManager.hpp
 /// \brief module manager
@@ -12,6 +12,7 @@
 
 class IModule;
 class IReader;
+class File;
 
 /// \brief module manager
 /// \details manages all modules that can be used to open files
@@ -36,7 +37,24 @@ public:
    /// loads file and returns a reader
    std::shared_ptr<IReader> LoadFile(const CString& filename) const;
 
+   /// loads two files to compare and returns a diff reader; both files must
+   /// be applicable for the same module, and the module must support
+   /// comparing files; returns nullptr and sets an error text otherwise
+   std::shared_ptr<IReader> LoadDiff(const CString& oldFilename,
+      const CString& newFilename, CString& errorText) const;
+
+   /// loads files to analyze together for conflicting symbol definitions and
+   /// returns a reader; all files must be applicable for the same module, and
+   /// the module must support analyzing symbol conflicts; returns nullptr and
+   /// sets an error text otherwise
+   std::shared_ptr<IReader> LoadSymbolConflicts(const std::vector<CString>& filenamesList,
+      CString& errorText) const;
+
 private:
+   /// finds the module that can read the file; returns nullptr when no
+   /// module was found
+   std::shared_ptr<IModule> FindModuleForFile(const File& file) const;
+
    /// checks if the given module matches the file extension
    static bool IsMatchingModule(const IModule& theModule, const CString& extension);
 
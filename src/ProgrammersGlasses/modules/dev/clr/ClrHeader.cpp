@@ -0,0 +1,287 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ClrHeader.cpp
+/// \brief CLI header and CLR metadata header definitions
+//
+#include "stdafx.h"
+#include "ClrHeader.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapCliHeaderFlagsToDisplayText =
+{
+   { 0x00000001, _T("COMIMAGE_FLAGS_ILONLY") },
+   { 0x00000002, _T("COMIMAGE_FLAGS_32BITREQUIRED") },
+   { 0x00000004, _T("COMIMAGE_FLAGS_IL_LIBRARY") },
+   { 0x00000008, _T("COMIMAGE_FLAGS_STRONGNAMESIGNED") },
+   { 0x00000010, _T("COMIMAGE_FLAGS_NATIVE_ENTRYPOINT") },
+   { 0x00010000, _T("COMIMAGE_FLAGS_TRACKDEBUGDATA") },
+   { 0x00020000, _T("COMIMAGE_FLAGS_32BITPREFERRED") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapMetadataHeapSizesToDisplayText =
+{
+   { 0x01, _T("Large #Strings heap") },
+   { 0x02, _T("Large #GUID heap") },
+   { 0x04, _T("Large #Blob heap") },
+   { 0x08, _T("Padding bit") },
+   { 0x20, _T("Delta only") },
+   { 0x40, _T("Extra data") },
+   { 0x80, _T("Has delete") },
+};
+
+const StructDefinition g_definitionCliHeader = StructDefinition({
+   StructField(
+      offsetof(CliHeader, CliHeader::size),
+      sizeof(CliHeader::size),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::majorRuntimeVersion),
+      sizeof(CliHeader::majorRuntimeVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Major runtime version")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::minorRuntimeVersion),
+      sizeof(CliHeader::minorRuntimeVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Minor runtime version")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::metadataRva),
+      sizeof(CliHeader::metadataRva),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Metadata (RVA)")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::metadataSize),
+      sizeof(CliHeader::metadataSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Metadata size")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::flags),
+      sizeof(CliHeader::flags),
+      4,
+      true, // little-endian
+      StructFieldType::flagsMapping,
+      g_mapCliHeaderFlagsToDisplayText,
+      _T("Flags")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::entryPointToken),
+      sizeof(CliHeader::entryPointToken),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Entry point token or RVA")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::resourcesRva),
+      sizeof(CliHeader::resourcesRva),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Resources (RVA)")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::resourcesSize),
+      sizeof(CliHeader::resourcesSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Resources size")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::strongNameSignatureRva),
+      sizeof(CliHeader::strongNameSignatureRva),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Strong name signature (RVA)")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::strongNameSignatureSize),
+      sizeof(CliHeader::strongNameSignatureSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Strong name signature size")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::codeManagerTableRva),
+      sizeof(CliHeader::codeManagerTableRva),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Code manager table (RVA)")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::codeManagerTableSize),
+      sizeof(CliHeader::codeManagerTableSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Code manager table size")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::vtableFixupsRva),
+      sizeof(CliHeader::vtableFixupsRva),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("VTable fixups (RVA)")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::vtableFixupsSize),
+      sizeof(CliHeader::vtableFixupsSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("VTable fixups size")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::exportAddressTableJumpsRva),
+      sizeof(CliHeader::exportAddressTableJumpsRva),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Export address table jumps (RVA)")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::exportAddressTableJumpsSize),
+      sizeof(CliHeader::exportAddressTableJumpsSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Export address table jumps size")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::managedNativeHeaderRva),
+      sizeof(CliHeader::managedNativeHeaderRva),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Managed native header (RVA)")),
+
+   StructField(
+      offsetof(CliHeader, CliHeader::managedNativeHeaderSize),
+      sizeof(CliHeader::managedNativeHeaderSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Managed native header size")),
+   });
+
+const StructDefinition g_definitionMetadataRootHeader = StructDefinition({
+   StructField(
+      offsetof(MetadataRootHeader, MetadataRootHeader::signature),
+      sizeof(MetadataRootHeader::signature),
+      1,
+      true, // little-endian
+      StructFieldType::text,
+      _T("Signature")),
+
+   StructField(
+      offsetof(MetadataRootHeader, MetadataRootHeader::majorVersion),
+      sizeof(MetadataRootHeader::majorVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Major version")),
+
+   StructField(
+      offsetof(MetadataRootHeader, MetadataRootHeader::minorVersion),
+      sizeof(MetadataRootHeader::minorVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Minor version")),
+
+   StructField(
+      offsetof(MetadataRootHeader, MetadataRootHeader::reserved),
+      sizeof(MetadataRootHeader::reserved),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Reserved")),
+
+   StructField(
+      offsetof(MetadataRootHeader, MetadataRootHeader::versionLength),
+      sizeof(MetadataRootHeader::versionLength),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Version string length")),
+   });
+
+const StructDefinition g_definitionMetadataTablesHeader = StructDefinition({
+   StructField(
+      offsetof(MetadataTablesHeader, MetadataTablesHeader::reserved),
+      sizeof(MetadataTablesHeader::reserved),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Reserved")),
+
+   StructField(
+      offsetof(MetadataTablesHeader, MetadataTablesHeader::majorVersion),
+      sizeof(MetadataTablesHeader::majorVersion),
+      1,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Major version")),
+
+   StructField(
+      offsetof(MetadataTablesHeader, MetadataTablesHeader::minorVersion),
+      sizeof(MetadataTablesHeader::minorVersion),
+      1,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Minor version")),
+
+   StructField(
+      offsetof(MetadataTablesHeader, MetadataTablesHeader::heapSizes),
+      sizeof(MetadataTablesHeader::heapSizes),
+      1,
+      true, // little-endian
+      StructFieldType::flagsMapping,
+      g_mapMetadataHeapSizesToDisplayText,
+      _T("Heap sizes")),
+
+   StructField(
+      offsetof(MetadataTablesHeader, MetadataTablesHeader::reserved2),
+      sizeof(MetadataTablesHeader::reserved2),
+      1,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Reserved")),
+
+   StructField(
+      offsetof(MetadataTablesHeader, MetadataTablesHeader::valid),
+      sizeof(MetadataTablesHeader::valid),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Valid tables bit vector")),
+
+   StructField(
+      offsetof(MetadataTablesHeader, MetadataTablesHeader::sorted),
+      sizeof(MetadataTablesHeader::sorted),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Sorted tables bit vector")),
+   });
@@ -0,0 +1,95 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ClrHeader.hpp
+/// \brief CLI header and CLR metadata header definitions
+//
+#pragma once
+
+#include "StructDefinition.hpp"
+
+#pragma pack(push, 1)
+
+/// \brief CLI header
+/// \see ECMA-335, II.25.3.3 CLI header
+/// The header corresponds with winnt.h's IMAGE_COR20_HEADER struct. It is
+/// referenced by the CLR runtime header data directory entry of PE images.
+struct CliHeader
+{
+   DWORD size;                            ///< size of header, in bytes
+   WORD majorRuntimeVersion;              ///< minimum runtime major version
+   WORD minorRuntimeVersion;              ///< minimum runtime minor version
+   DWORD metadataRva;                     ///< RVA of the metadata root
+   DWORD metadataSize;                    ///< size of the metadata
+   DWORD flags;                           ///< COMIMAGE_FLAGS_* flags
+   DWORD entryPointToken;                 ///< entry point method token, or native entry point RVA
+   DWORD resourcesRva;                    ///< RVA of the managed resources
+   DWORD resourcesSize;                   ///< size of the managed resources
+   DWORD strongNameSignatureRva;          ///< RVA of the strong name signature
+   DWORD strongNameSignatureSize;         ///< size of the strong name signature
+   DWORD codeManagerTableRva;             ///< reserved
+   DWORD codeManagerTableSize;            ///< reserved
+   DWORD vtableFixupsRva;                 ///< RVA of the VTable fixups
+   DWORD vtableFixupsSize;                ///< size of the VTable fixups
+   DWORD exportAddressTableJumpsRva;      ///< reserved
+   DWORD exportAddressTableJumpsSize;     ///< reserved
+   DWORD managedNativeHeaderRva;          ///< RVA of the ReadyToRun header
+   DWORD managedNativeHeaderSize;         ///< size of the ReadyToRun header
+};
+
+/// \brief Metadata root header
+/// \see ECMA-335, II.24.2.1 Metadata root
+/// The header is followed by the zero-terminated version string with
+/// versionLength bytes, the flags and number of streams as WORD values and
+/// then the stream headers.
+struct MetadataRootHeader
+{
+   DWORD signature;           ///< signature; must be 0x424A5342 ("BSJB")
+   WORD majorVersion;         ///< major version
+   WORD minorVersion;         ///< minor version
+   DWORD reserved;            ///< reserved
+   DWORD versionLength;       ///< length of the version string, padded to 4 bytes
+};
+
+/// \brief Metadata tables stream header
+/// \see ECMA-335, II.24.2.6 #~ stream
+/// The header is followed by the row counts of all present tables.
+struct MetadataTablesHeader
+{
+   DWORD reserved;            ///< reserved; always 0
+   BYTE majorVersion;         ///< major version of the table schema
+   BYTE minorVersion;         ///< minor version of the table schema
+   BYTE heapSizes;            ///< bit flags for heap index sizes
+   BYTE reserved2;            ///< reserved; always 1
+   ULONGLONG valid;           ///< bit vector of present tables
+   ULONGLONG sorted;          ///< bit vector of sorted tables
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(CliHeader) == 72, "CLI header must be 72 bytes long");
+
+static_assert(sizeof(CliHeader) == sizeof(IMAGE_COR20_HEADER),
+   "CLI header must have same size as IMAGE_COR20_HEADER");
+
+static_assert(sizeof(MetadataRootHeader) == 16, "metadata root header must be 16 bytes long");
+static_assert(sizeof(MetadataTablesHeader) == 24, "metadata tables header must be 24 bytes long");
+
+/// metadata root signature "BSJB"
+constexpr DWORD c_metadataRootSignature = 0x424A5342;
+
+/// mapping of CLI header flags to display text
+extern const std::map<DWORD, LPCTSTR> g_mapCliHeaderFlagsToDisplayText;
+
+/// mapping of metadata tables heap sizes flags to display text
+extern const std::map<DWORD, LPCTSTR> g_mapMetadataHeapSizesToDisplayText;
+
+/// struct definition for above CLI header
+extern const StructDefinition g_definitionCliHeader;
+
+/// struct definition for above metadata root header
+extern const StructDefinition g_definitionMetadataRootHeader;
+
+/// struct definition for above metadata tables header
+extern const StructDefinition g_definitionMetadataTablesHeader;
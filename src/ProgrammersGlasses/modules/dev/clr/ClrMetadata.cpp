@@ -0,0 +1,523 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ClrMetadata.cpp
+/// \brief CLR metadata reader
+//
+#include "stdafx.h"
+#include "ClrMetadata.hpp"
+#include "ClrHeader.hpp"
+#include "modules/DisplayFormatHelper.hpp"
+#include <algorithm>
+
+/// heap sizes flag: #Strings heap indices are 4 bytes
+constexpr BYTE c_heapSizesLargeStrings = 0x01;
+
+/// heap sizes flag: #GUID heap indices are 4 bytes
+constexpr BYTE c_heapSizesLargeGuids = 0x02;
+
+/// heap sizes flag: #Blob heap indices are 4 bytes
+constexpr BYTE c_heapSizesLargeBlobs = 0x04;
+
+/// heap sizes flag: an extra DWORD follows the row counts
+constexpr BYTE c_heapSizesExtraData = 0x40;
+
+/// maximum number of bytes of a blob that are displayed
+constexpr size_t c_maxDisplayedBlobBytes = 16;
+
+/// \brief Decodes a compressed unsigned integer, as used for blob lengths
+/// \see ECMA-335, II.23.2 Blobs and signatures
+/// \returns number of bytes used by the compressed value, or 0 on errors
+static size_t DecodeCompressedLength(const BYTE* data, size_t available, DWORD& value)
+{
+   if (available < 1)
+      return 0;
+
+   if ((data[0] & 0x80) == 0)
+   {
+      value = data[0];
+      return 1;
+   }
+
+   if ((data[0] & 0xC0) == 0x80)
+   {
+      if (available < 2)
+         return 0;
+
+      value = (DWORD(data[0] & 0x3F) << 8) | data[1];
+      return 2;
+   }
+
+   if ((data[0] & 0xE0) == 0xC0)
+   {
+      if (available < 4)
+         return 0;
+
+      value = (DWORD(data[0] & 0x1F) << 24) | (DWORD(data[1]) << 16) |
+         (DWORD(data[2]) << 8) | data[3];
+      return 4;
+   }
+
+   return 0;
+}
+
+ClrMetadata::ClrMetadata(const BYTE* data, size_t size)
+   :m_data(data),
+   m_size(size)
+{
+   m_isValid = ParseRoot() && ParseTablesHeader();
+}
+
+const MetadataRootHeader* ClrMetadata::RootHeader() const
+{
+   return reinterpret_cast<const MetadataRootHeader*>(m_data);
+}
+
+const MetadataTablesHeader* ClrMetadata::TablesHeader() const
+{
+   if (m_tablesStream == nullptr)
+      return nullptr;
+
+   return reinterpret_cast<const MetadataTablesHeader*>(m_data + m_tablesStream->offset);
+}
+
+bool ClrMetadata::ParseRoot()
+{
+   if (m_data == nullptr ||
+      m_size < sizeof(MetadataRootHeader))
+   {
+      m_errorText = _T("Metadata is too small");
+      return false;
+   }
+
+   const MetadataRootHeader& rootHeader = *RootHeader();
+   if (rootHeader.signature != c_metadataRootSignature)
+   {
+      m_errorText = _T("Invalid metadata root signature");
+      return false;
+   }
+
+   size_t offset = sizeof(MetadataRootHeader);
+   if (m_size < offset + 2 * sizeof(WORD) ||
+      rootHeader.versionLength > m_size - offset - 2 * sizeof(WORD))
+   {
+      m_errorText = _T("Invalid metadata version string length");
+      return false;
+   }
+
+   const char* version = reinterpret_cast<const char*>(m_data + offset);
+   m_versionString = CString(CStringA(version,
+      static_cast<int>(strnlen(version, rootHeader.versionLength))));
+
+   offset += rootHeader.versionLength;
+
+   // skip flags
+   offset += sizeof(WORD);
+
+   WORD numberOfStreams = *reinterpret_cast<const WORD*>(m_data + offset);
+   offset += sizeof(WORD);
+
+   for (WORD streamIndex = 0; streamIndex < numberOfStreams; streamIndex++)
+   {
+      if (offset + 2 * sizeof(DWORD) >= m_size)
+      {
+         m_errorText = _T("Stream headers exceed metadata size");
+         return false;
+      }
+
+      ClrMetadataStream stream;
+      stream.headerOffset = offset;
+      stream.offset = *reinterpret_cast<const DWORD*>(m_data + offset);
+      stream.size = *reinterpret_cast<const DWORD*>(m_data + offset + sizeof(DWORD));
+      offset += 2 * sizeof(DWORD);
+
+      // name is zero-terminated and padded to the next 4-byte boundary
+      const char* name = reinterpret_cast<const char*>(m_data + offset);
+      size_t nameLength = strnlen(name, m_size - offset);
+      stream.name = CString(CStringA(name, static_cast<int>(nameLength)));
+
+      offset += (nameLength + 1 + 3) & ~size_t(3);
+
+      if (stream.offset > m_size ||
+         stream.size > m_size - stream.offset)
+      {
+         m_errorText.AppendFormat(_T("Stream %s exceeds metadata size"), stream.name.GetString());
+         return false;
+      }
+
+      m_streams.push_back(stream);
+   }
+
+   m_tablesStream = FindStream(_T("#~"));
+   if (m_tablesStream == nullptr)
+      m_tablesStream = FindStream(_T("#-"));
+
+   m_stringsStream = FindStream(_T("#Strings"));
+   m_userStringsStream = FindStream(_T("#US"));
+   m_guidStream = FindStream(_T("#GUID"));
+   m_blobStream = FindStream(_T("#Blob"));
+
+   return true;
+}
+
+bool ClrMetadata::ParseTablesHeader()
+{
+   if (m_tablesStream == nullptr)
+      return true;
+
+   if (m_tablesStream->size < sizeof(MetadataTablesHeader))
+   {
+      m_errorText = _T("Tables stream is too small");
+      return false;
+   }
+
+   const MetadataTablesHeader& tablesHeader = *TablesHeader();
+
+   m_largeStrings = (tablesHeader.heapSizes & c_heapSizesLargeStrings) != 0;
+   m_largeGuids = (tablesHeader.heapSizes & c_heapSizesLargeGuids) != 0;
+   m_largeBlobs = (tablesHeader.heapSizes & c_heapSizesLargeBlobs) != 0;
+
+   size_t offset = m_tablesStream->offset + sizeof(MetadataTablesHeader);
+   size_t streamEnd = size_t(m_tablesStream->offset) + m_tablesStream->size;
+
+   // a row count is stored for every bit set in the valid vector
+   for (BYTE tableId = 0; tableId < 64; tableId++)
+   {
+      if ((tablesHeader.valid & (ULONGLONG(1) << tableId)) == 0)
+         continue;
+
+      if (offset + sizeof(DWORD) > streamEnd)
+      {
+         m_errorText = _T("Table row counts exceed tables stream size");
+         return false;
+      }
+
+      DWORD rowCount = *reinterpret_cast<const DWORD*>(m_data + offset);
+      offset += sizeof(DWORD);
+
+      if (tableId < clrTableCount)
+         m_tableLayouts[tableId].rowCount = rowCount;
+      else
+         m_errorText.AppendFormat(_T("Unknown table 0x%02x with %u rows"), tableId, rowCount);
+   }
+
+   if ((tablesHeader.heapSizes & c_heapSizesExtraData) != 0)
+      offset += sizeof(DWORD);
+
+   CalculateTableLayout();
+
+   // tables are stored in the order of their IDs; unknown tables have higher
+   // IDs than all known tables, so the known tables can still be accessed
+   for (TableLayout& layout : m_tableLayouts)
+   {
+      layout.offset = offset;
+      offset += static_cast<size_t>(layout.rowCount) * layout.rowSize;
+   }
+
+   if (offset > streamEnd)
+      m_errorText = _T("Table rows exceed tables stream size");
+
+   return true;
+}
+
+void ClrMetadata::CalculateTableLayout()
+{
+   for (size_t codedIndexId = 0; codedIndexId < clrCodedIndexCount; codedIndexId++)
+   {
+      const ClrCodedIndexDefinition& definition = g_listClrCodedIndexDefinitions[codedIndexId];
+
+      DWORD maxRowCount = 0;
+      for (BYTE tableId : definition.tables)
+      {
+         if (tableId != clrTableNotUsed)
+            maxRowCount = std::max(maxRowCount, m_tableLayouts[tableId].rowCount);
+      }
+
+      m_codedIndexSizes[codedIndexId] =
+         maxRowCount < (DWORD(1) << (16 - definition.tagBits)) ? 2 : 4;
+   }
+
+   for (size_t tableId = 0; tableId < clrTableCount; tableId++)
+   {
+      TableLayout& layout = m_tableLayouts[tableId];
+
+      size_t rowSize = 0;
+      for (const ClrColumnDefinition& column : g_listClrTableDefinitions[tableId].columns)
+      {
+         size_t columnSize = ColumnSize(column);
+
+         layout.columnOffsets.push_back(static_cast<BYTE>(rowSize));
+         layout.columnSizes.push_back(static_cast<BYTE>(columnSize));
+
+         rowSize += columnSize;
+      }
+
+      layout.rowSize = rowSize;
+   }
+}
+
+size_t ClrMetadata::ColumnSize(const ClrColumnDefinition& column) const
+{
+   switch (column.type)
+   {
+   case ClrColumnType::fixed:
+      return column.parameter;
+
+   case ClrColumnType::stringIndex:
+      return m_largeStrings ? 4 : 2;
+
+   case ClrColumnType::guidIndex:
+      return m_largeGuids ? 4 : 2;
+
+   case ClrColumnType::blobIndex:
+      return m_largeBlobs ? 4 : 2;
+
+   case ClrColumnType::tableIndex:
+      return m_tableLayouts[column.parameter].rowCount < 0x10000 ? 2 : 4;
+
+   case ClrColumnType::codedIndex:
+      return m_codedIndexSizes[column.parameter];
+
+   default:
+      ATLASSERT(false);
+      return 0;
+   }
+}
+
+const ClrMetadataStream* ClrMetadata::FindStream(LPCTSTR name) const
+{
+   for (const ClrMetadataStream& stream : m_streams)
+   {
+      if (stream.name == name)
+         return &stream;
+   }
+
+   return nullptr;
+}
+
+DWORD ClrMetadata::RowCount(BYTE tableId) const
+{
+   return tableId < clrTableCount ? m_tableLayouts[tableId].rowCount : 0;
+}
+
+size_t ClrMetadata::RowSize(BYTE tableId) const
+{
+   return tableId < clrTableCount ? m_tableLayouts[tableId].rowSize : 0;
+}
+
+size_t ClrMetadata::CodedIndexSize(BYTE codedIndexId) const
+{
+   return codedIndexId < clrCodedIndexCount ? m_codedIndexSizes[codedIndexId] : 0;
+}
+
+const BYTE* ClrMetadata::RowPointer(BYTE tableId, DWORD rowIndex) const
+{
+   if (m_tablesStream == nullptr ||
+      tableId >= clrTableCount)
+      return nullptr;
+
+   const TableLayout& layout = m_tableLayouts[tableId];
+   if (rowIndex >= layout.rowCount)
+      return nullptr;
+
+   size_t rowOffset = layout.offset + static_cast<size_t>(rowIndex) * layout.rowSize;
+   size_t streamEnd = size_t(m_tablesStream->offset) + m_tablesStream->size;
+
+   if (rowOffset + layout.rowSize > streamEnd)
+      return nullptr;
+
+   return m_data + rowOffset;
+}
+
+DWORD ClrMetadata::ColumnValue(BYTE tableId, DWORD rowIndex, size_t columnIndex) const
+{
+   const BYTE* row = RowPointer(tableId, rowIndex);
+   if (row == nullptr)
+      return 0;
+
+   const TableLayout& layout = m_tableLayouts[tableId];
+   if (columnIndex >= layout.columnSizes.size())
+      return 0;
+
+   const BYTE* value = row + layout.columnOffsets[columnIndex];
+
+   switch (layout.columnSizes[columnIndex])
+   {
+   case 1: return *value;
+   case 2: return *reinterpret_cast<const WORD*>(value);
+   case 4: return *reinterpret_cast<const DWORD*>(value);
+   default:
+      ATLASSERT(false);
+      return 0;
+   }
+}
+
+CString ClrMetadata::GetString(DWORD index) const
+{
+   if (m_stringsStream == nullptr ||
+      index >= m_stringsStream->size)
+      return CString();
+
+   const char* text = reinterpret_cast<const char*>(m_data + m_stringsStream->offset + index);
+   size_t length = strnlen(text, m_stringsStream->size - index);
+
+   return CString(CA2T(CStringA(text, static_cast<int>(length)), CP_UTF8));
+}
+
+CString ClrMetadata::GetUserString(DWORD index) const
+{
+   if (m_userStringsStream == nullptr ||
+      index >= m_userStringsStream->size)
+      return CString();
+
+   const BYTE* data = m_data + m_userStringsStream->offset + index;
+   size_t available = m_userStringsStream->size - index;
+
+   DWORD length = 0;
+   size_t lengthSize = DecodeCompressedLength(data, available, length);
+   if (lengthSize == 0 ||
+      length > available - lengthSize)
+      return CString();
+
+   // UTF-16 characters are followed by a single byte with a flag
+   CStringW text(reinterpret_cast<const wchar_t*>(data + lengthSize),
+      static_cast<int>(length / sizeof(wchar_t)));
+
+   return CString(text);
+}
+
+const BYTE* ClrMetadata::GetGuid(DWORD index) const
+{
+   if (m_guidStream == nullptr ||
+      index == 0 ||
+      index > m_guidStream->size / sizeof(GUID))
+      return nullptr;
+
+   return m_data + m_guidStream->offset + (index - 1) * sizeof(GUID);
+}
+
+const BYTE* ClrMetadata::GetBlob(DWORD index, size_t& blobSize) const
+{
+   blobSize = 0;
+
+   if (m_blobStream == nullptr ||
+      index >= m_blobStream->size)
+      return nullptr;
+
+   const BYTE* data = m_data + m_blobStream->offset + index;
+   size_t available = m_blobStream->size - index;
+
+   DWORD length = 0;
+   size_t lengthSize = DecodeCompressedLength(data, available, length);
+   if (lengthSize == 0 ||
+      length > available - lengthSize)
+      return nullptr;
+
+   blobSize = length;
+   return data + lengthSize;
+}
+
+CString ClrMetadata::FormatToken(BYTE tableId, DWORD rowIndex)
+{
+   CString text;
+   text.Format(_T("0x%08x"), (DWORD(tableId) << 24) | (rowIndex + 1));
+   return text;
+}
+
+CString ClrMetadata::FormatColumnValue(BYTE tableId, DWORD rowIndex, size_t columnIndex) const
+{
+   if (tableId >= clrTableCount)
+      return CString();
+
+   const ClrColumnDefinition& column = g_listClrTableDefinitions[tableId].columns[columnIndex];
+   DWORD value = ColumnValue(tableId, rowIndex, columnIndex);
+
+   CString text;
+   switch (column.type)
+   {
+   case ClrColumnType::fixed:
+      text.Format(_T("0x%0*x"), int(column.parameter * 2), value);
+      break;
+
+   case ClrColumnType::stringIndex:
+      text = GetString(value);
+      break;
+
+   case ClrColumnType::guidIndex:
+   {
+      const BYTE* guid = GetGuid(value);
+      if (guid != nullptr)
+         text = DisplayFormatHelper::FormatGUID(guid, sizeof(GUID));
+      else
+         text = _T("null");
+      break;
+   }
+
+   case ClrColumnType::blobIndex:
+      text = FormatBlob(value);
+      break;
+
+   case ClrColumnType::tableIndex:
+      // row indices are 1-based; 0 means null
+      text = value == 0 ? CString(_T("null")) : FormatToken(column.parameter, value - 1);
+      break;
+
+   case ClrColumnType::codedIndex:
+      text = FormatCodedIndex(column.parameter, value);
+      break;
+
+   default:
+      ATLASSERT(false);
+      break;
+   }
+
+   return text;
+}
+
+CString ClrMetadata::FormatCodedIndex(BYTE codedIndexId, DWORD value) const
+{
+   const ClrCodedIndexDefinition& definition = g_listClrCodedIndexDefinitions[codedIndexId];
+
+   DWORD tag = value & ((DWORD(1) << definition.tagBits) - 1);
+   DWORD rowNumber = value >> definition.tagBits;
+
+   if (tag >= definition.tables.size() ||
+      definition.tables[tag] == clrTableNotUsed)
+   {
+      CString text;
+      text.Format(_T("invalid tag %u (0x%08x)"), tag, value);
+      return text;
+   }
+
+   BYTE tableId = definition.tables[tag];
+   if (rowNumber == 0)
+      return CString(_T("null ")) + g_listClrTableDefinitions[tableId].name;
+
+   CString text;
+   text.Format(_T("%s %s"),
+      g_listClrTableDefinitions[tableId].name,
+      FormatToken(tableId, rowNumber - 1).GetString());
+
+   return text;
+}
+
+CString ClrMetadata::FormatBlob(DWORD index) const
+{
+   size_t blobSize = 0;
+   const BYTE* blob = GetBlob(index, blobSize);
+
+   if (blob == nullptr)
+      return _T("invalid");
+
+   CString text;
+   for (size_t byteIndex = 0; byteIndex < std::min(blobSize, c_maxDisplayedBlobBytes); byteIndex++)
+      text.AppendFormat(_T("%02x "), blob[byteIndex]);
+
+   if (blobSize > c_maxDisplayedBlobBytes)
+      text += _T("... ");
+
+   text.AppendFormat(_T("(%zu bytes)"), blobSize);
+
+   return text;
+}
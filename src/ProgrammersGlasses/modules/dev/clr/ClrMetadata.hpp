@@ -0,0 +1,196 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ClrMetadata.hpp
+/// \brief CLR metadata reader
+//
+#pragma once
+
+#include "ClrMetadataTables.hpp"
+#include <array>
+
+struct MetadataRootHeader;
+struct MetadataTablesHeader;
+
+/// \brief Stream of the CLR metadata
+struct ClrMetadataStream
+{
+   /// stream name, e.g. #Strings
+   CString name;
+
+   /// offset of the stream data, relative to the metadata root
+   DWORD offset = 0;
+
+   /// size of the stream data
+   DWORD size = 0;
+
+   /// offset of the stream header, relative to the metadata root
+   size_t headerOffset = 0;
+};
+
+/// \brief CLR metadata reader
+/// \details Parses the metadata root, the stream headers and the header of the
+/// tables stream. Row sizes and column offsets of all tables are computed
+/// once, so that any row can be accessed directly by computing its offset,
+/// without materializing all rows of a table.
+/// \see ECMA-335, II.24 Metadata physical layout
+class ClrMetadata
+{
+public:
+   /// ctor; parses the metadata at given data pointer and size
+   ClrMetadata(const BYTE* data, size_t size);
+
+   /// no copy ctor, since streams are referenced by pointer
+   ClrMetadata(const ClrMetadata&) = delete;
+
+   /// no assignment operator
+   ClrMetadata& operator=(const ClrMetadata&) = delete;
+
+   /// returns if the metadata could be parsed
+   bool IsValid() const { return m_isValid; }
+
+   /// returns an error text when the metadata couldn't be parsed completely
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the metadata root header
+   const MetadataRootHeader* RootHeader() const;
+
+   /// returns the runtime version string
+   const CString& VersionString() const { return m_versionString; }
+
+   /// returns the list of streams
+   const std::vector<ClrMetadataStream>& Streams() const { return m_streams; }
+
+   /// returns the tables stream header, or nullptr when not present
+   const MetadataTablesHeader* TablesHeader() const;
+
+   /// returns the tables stream, or nullptr when not present
+   const ClrMetadataStream* TablesStream() const { return m_tablesStream; }
+
+   /// returns the number of rows of a table
+   DWORD RowCount(BYTE tableId) const;
+
+   /// returns the size of a single row of a table, in bytes
+   size_t RowSize(BYTE tableId) const;
+
+   /// returns the size of a coded index column, in bytes; either 2 or 4
+   size_t CodedIndexSize(BYTE codedIndexId) const;
+
+   /// returns a pointer to the given row of a table; the row index is
+   /// 0-based; returns nullptr when the row is outside the tables stream
+   const BYTE* RowPointer(BYTE tableId, DWORD rowIndex) const;
+
+   /// returns the value of the column of a table row
+   DWORD ColumnValue(BYTE tableId, DWORD rowIndex, size_t columnIndex) const;
+
+   /// returns a string from the #Strings heap
+   CString GetString(DWORD index) const;
+
+   /// returns a string from the #US heap
+   CString GetUserString(DWORD index) const;
+
+   /// returns a GUID from the #GUID heap; the index is 1-based; returns
+   /// nullptr when the index is invalid
+   const BYTE* GetGuid(DWORD index) const;
+
+   /// returns a blob from the #Blob heap, as data pointer and size; returns
+   /// nullptr when the index is invalid
+   const BYTE* GetBlob(DWORD index, size_t& blobSize) const;
+
+   /// formats the value of the column of a table row for display
+   CString FormatColumnValue(BYTE tableId, DWORD rowIndex, size_t columnIndex) const;
+
+   /// formats a metadata token for display
+   static CString FormatToken(BYTE tableId, DWORD rowIndex);
+
+private:
+   /// parses the metadata root and stream headers
+   bool ParseRoot();
+
+   /// parses the tables stream header and computes table layout
+   bool ParseTablesHeader();
+
+   /// computes the row size and column offsets of all tables
+   void CalculateTableLayout();
+
+   /// returns the size of a column, in bytes
+   size_t ColumnSize(const ClrColumnDefinition& column) const;
+
+   /// finds a stream by name; returns nullptr when not found
+   const ClrMetadataStream* FindStream(LPCTSTR name) const;
+
+   /// formats a coded index value for display
+   CString FormatCodedIndex(BYTE codedIndexId, DWORD value) const;
+
+   /// formats a blob for display
+   CString FormatBlob(DWORD index) const;
+
+private:
+   /// layout of a single table
+   struct TableLayout
+   {
+      /// number of rows
+      DWORD rowCount = 0;
+
+      /// row size, in bytes
+      size_t rowSize = 0;
+
+      /// offset of first row, relative to the metadata root
+      size_t offset = 0;
+
+      /// column offsets within a row
+      std::vector<BYTE> columnOffsets;
+
+      /// column sizes, either 1, 2 or 4
+      std::vector<BYTE> columnSizes;
+   };
+
+   /// metadata data
+   const BYTE* m_data;
+
+   /// metadata size
+   size_t m_size;
+
+   /// indicates if metadata could be parsed
+   bool m_isValid = false;
+
+   /// error text
+   CString m_errorText;
+
+   /// runtime version string
+   CString m_versionString;
+
+   /// all streams
+   std::vector<ClrMetadataStream> m_streams;
+
+   /// tables stream; #~ or #- stream
+   const ClrMetadataStream* m_tablesStream = nullptr;
+
+   /// #Strings heap stream
+   const ClrMetadataStream* m_stringsStream = nullptr;
+
+   /// #US heap stream
+   const ClrMetadataStream* m_userStringsStream = nullptr;
+
+   /// #GUID heap stream
+   const ClrMetadataStream* m_guidStream = nullptr;
+
+   /// #Blob heap stream
+   const ClrMetadataStream* m_blobStream = nullptr;
+
+   /// indicates if #Strings heap indices are 4 bytes
+   bool m_largeStrings = false;
+
+   /// indicates if #GUID heap indices are 4 bytes
+   bool m_largeGuids = false;
+
+   /// indicates if #Blob heap indices are 4 bytes
+   bool m_largeBlobs = false;
+
+   /// layout of all known tables
+   std::array<TableLayout, clrTableCount> m_tableLayouts;
+
+   /// sizes of coded indices
+   std::array<BYTE, clrCodedIndexCount> m_codedIndexSizes = {};
+};
@@ -0,0 +1,237 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ClrMetadataNodeTreeBuilder.cpp
+/// \brief Node tree builder for CLR metadata
+//
+#include "stdafx.h"
+#include "ClrMetadataNodeTreeBuilder.hpp"
+#include "ClrMetadata.hpp"
+#include "ClrHeader.hpp"
+#include "CodeTextViewNode.hpp"
+#include "FilterSortListViewNode.hpp"
+#include "HexDataViewNode.hpp"
+#include "StructListViewNode.hpp"
+
+ClrMetadataNodeTreeBuilder::ClrMetadataNodeTreeBuilder(const File& file,
+   size_t fileOffset, size_t size)
+   :m_file(file),
+   m_fileOffset(fileOffset),
+   m_size(size)
+{
+}
+
+std::shared_ptr<INode> ClrMetadataNodeTreeBuilder::BuildMetadataNode()
+{
+   auto metadataNode = std::make_shared<CodeTextViewNode>(
+      _T("CLR Metadata"),
+      NodeTreeIconID::nodeTreeIconLibrary);
+
+   m_metadata = std::make_shared<ClrMetadata>(
+      m_file.Data<BYTE>(m_fileOffset),
+      m_size);
+
+   m_metadataSummary.Empty();
+
+   if (m_size >= sizeof(MetadataRootHeader))
+   {
+      metadataNode->ChildNodes().push_back(
+         std::make_shared<StructListViewNode>(
+            _T("Metadata root header"),
+            NodeTreeIconID::nodeTreeIconBinary,
+            g_definitionMetadataRootHeader,
+            m_metadata->RootHeader(),
+            m_file.Data()));
+   }
+
+   if (!m_metadata->IsValid())
+   {
+      m_metadataSummary.AppendFormat(_T("Error: %s\n"),
+         m_metadata->GetErrorText().GetString());
+
+      metadataNode->SetText(m_metadataSummary);
+      return metadataNode;
+   }
+
+   m_metadataSummary.AppendFormat(_T("CLR metadata, runtime version %s\n"),
+      m_metadata->VersionString().GetString());
+
+   AddStreamNodes(*metadataNode);
+   AddTableNodes(*metadataNode);
+
+   if (!m_metadata->GetErrorText().IsEmpty())
+      m_metadataSummary.AppendFormat(_T("Error: %s\n"),
+         m_metadata->GetErrorText().GetString());
+
+   metadataNode->SetText(m_metadataSummary);
+
+   return metadataNode;
+}
+
+void ClrMetadataNodeTreeBuilder::AddStreamNodes(CodeTextViewNode& metadataNode)
+{
+   static std::vector<CString> streamColumnNames
+   {
+      _T("Name"),
+      _T("Offset"),
+      _T("Size"),
+   };
+
+   std::vector<std::vector<CString>> streamData;
+
+   m_metadataSummary += _T("\nStreams:\n");
+
+   for (const ClrMetadataStream& stream : m_metadata->Streams())
+   {
+      CString offsetText;
+      offsetText.Format(_T("0x%08x"), stream.offset);
+
+      CString sizeText;
+      sizeText.Format(_T("0x%08x"), stream.size);
+
+      streamData.push_back(
+         std::vector<CString> {
+            stream.name,
+            offsetText,
+            sizeText,
+         });
+
+      m_metadataSummary.AppendFormat(_T("%s: %u bytes\n"),
+         stream.name.GetString(), stream.size);
+   }
+
+   metadataNode.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Streams"),
+         NodeTreeIconID::nodeTreeIconTable,
+         streamColumnNames,
+         streamData,
+         false));
+
+   for (const ClrMetadataStream& stream : m_metadata->Streams())
+   {
+      if (stream.size == 0)
+         continue;
+
+      metadataNode.ChildNodes().push_back(
+         std::make_shared<HexDataViewNode>(
+            _T("Stream ") + stream.name,
+            NodeTreeIconID::nodeTreeIconBinary,
+            m_file,
+            m_fileOffset + stream.offset,
+            stream.size));
+   }
+}
+
+void ClrMetadataNodeTreeBuilder::AddTableNodes(CodeTextViewNode& metadataNode)
+{
+   const MetadataTablesHeader* tablesHeader = m_metadata->TablesHeader();
+   if (tablesHeader == nullptr)
+      return;
+
+   metadataNode.ChildNodes().push_back(
+      std::make_shared<StructListViewNode>(
+         _T("Tables header"),
+         NodeTreeIconID::nodeTreeIconBinary,
+         g_definitionMetadataTablesHeader,
+         tablesHeader,
+         m_file.Data()));
+
+   m_metadataSummary += _T("\nHeap index sizes:\n");
+   m_metadataSummary.AppendFormat(_T("#Strings: %u bytes, #GUID: %u bytes, #Blob: %u bytes\n"),
+      (tablesHeader->heapSizes & 0x01) != 0 ? 4 : 2,
+      (tablesHeader->heapSizes & 0x02) != 0 ? 4 : 2,
+      (tablesHeader->heapSizes & 0x04) != 0 ? 4 : 2);
+
+   m_metadataSummary += _T("\nCoded index sizes:\n");
+   for (BYTE codedIndexId = 0; codedIndexId < clrCodedIndexCount; codedIndexId++)
+   {
+      m_metadataSummary.AppendFormat(_T("%s: %zu bytes\n"),
+         g_listClrCodedIndexDefinitions[codedIndexId].name,
+         m_metadata->CodedIndexSize(codedIndexId));
+   }
+
+   static std::vector<CString> rowCountColumnNames
+   {
+      _T("Table"),
+      _T("ID"),
+      _T("Rows"),
+      _T("Row size"),
+   };
+
+   std::vector<std::vector<CString>> rowCountData;
+
+   m_metadataSummary += _T("\nTables:\n");
+
+   for (BYTE tableId = 0; tableId < clrTableCount; tableId++)
+   {
+      DWORD rowCount = m_metadata->RowCount(tableId);
+      if (rowCount == 0)
+         continue;
+
+      LPCTSTR tableName = g_listClrTableDefinitions[tableId].name;
+
+      CString idText;
+      idText.Format(_T("0x%02x"), tableId);
+
+      CString rowCountText;
+      rowCountText.Format(_T("%u"), rowCount);
+
+      CString rowSizeText;
+      rowSizeText.Format(_T("%zu"), m_metadata->RowSize(tableId));
+
+      rowCountData.push_back(
+         std::vector<CString> {
+            tableName,
+            idText,
+            rowCountText,
+            rowSizeText,
+         });
+
+      m_metadataSummary.AppendFormat(_T("%s: %u rows\n"), tableName, rowCount);
+   }
+
+   metadataNode.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Table row counts"),
+         NodeTreeIconID::nodeTreeIconTable,
+         rowCountColumnNames,
+         rowCountData,
+         false));
+
+   for (BYTE tableId = 0; tableId < clrTableCount; tableId++)
+   {
+      if (m_metadata->RowCount(tableId) > 0)
+         metadataNode.ChildNodes().push_back(CreateTableNode(tableId));
+   }
+}
+
+std::shared_ptr<INode> ClrMetadataNodeTreeBuilder::CreateTableNode(BYTE tableId) const
+{
+   const ClrTableDefinition& tableDefinition = g_listClrTableDefinitions[tableId];
+
+   std::vector<CString> columnNames{ _T("Token") };
+   for (const ClrColumnDefinition& column : tableDefinition.columns)
+      columnNames.push_back(column.name);
+
+   std::shared_ptr<ClrMetadata> metadata = m_metadata;
+   size_t columnCount = tableDefinition.columns.size();
+
+   return std::make_shared<FilterSortListViewNode>(
+      CString{ _T("Table ") } + tableDefinition.name,
+      NodeTreeIconID::nodeTreeIconTable,
+      columnNames,
+      metadata->RowCount(tableId),
+      [metadata, tableId, columnCount](size_t rowIndex)
+      {
+         DWORD row = static_cast<DWORD>(rowIndex);
+
+         std::vector<CString> rowText{ ClrMetadata::FormatToken(tableId, row) };
+         for (size_t columnIndex = 0; columnIndex < columnCount; columnIndex++)
+            rowText.push_back(metadata->FormatColumnValue(tableId, row, columnIndex));
+
+         return rowText;
+      },
+      true);
+}
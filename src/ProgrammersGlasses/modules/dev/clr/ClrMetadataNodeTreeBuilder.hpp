@@ -0,0 +1,57 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ClrMetadataNodeTreeBuilder.hpp
+/// \brief Node tree builder for CLR metadata
+//
+#pragma once
+
+#include "INode.hpp"
+#include "File.hpp"
+
+class CodeTextViewNode;
+class ClrMetadata;
+
+/// \brief Node tree builder for CLR metadata
+/// \details Builds nodes for the metadata root, the streams and all metadata
+/// tables. The table nodes format their rows only when first shown, by
+/// directly accessing the rows in the mapped file.
+class ClrMetadataNodeTreeBuilder
+{
+public:
+   /// ctor
+   ClrMetadataNodeTreeBuilder(const File& file, size_t fileOffset, size_t size);
+
+   /// builds the CLR metadata node
+   std::shared_ptr<INode> BuildMetadataNode();
+
+   /// returns metadata summary text
+   const CString& GetMetadataSummary() const { return m_metadataSummary; }
+
+private:
+   /// adds the streams table and the stream data nodes
+   void AddStreamNodes(CodeTextViewNode& metadataNode);
+
+   /// adds the tables header node, the row counts table and all table nodes
+   void AddTableNodes(CodeTextViewNode& metadataNode);
+
+   /// creates a node for a single metadata table
+   std::shared_ptr<INode> CreateTableNode(BYTE tableId) const;
+
+private:
+   /// file to load metadata from
+   const File& m_file;
+
+   /// file offset where metadata starts
+   size_t m_fileOffset;
+
+   /// metadata size
+   size_t m_size;
+
+   /// metadata reader; shared with the table nodes
+   std::shared_ptr<ClrMetadata> m_metadata;
+
+   /// metadata summary text
+   CString m_metadataSummary;
+};
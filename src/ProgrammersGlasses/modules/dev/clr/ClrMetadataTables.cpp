@@ -0,0 +1,173 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ClrMetadataTables.cpp
+/// \brief CLR metadata table schema
+//
+#include "stdafx.h"
+#include "ClrMetadataTables.hpp"
+
+/// shortcut for a column with fixed size
+#define FIXED(name, size) { _T(name), ClrColumnType::fixed, size }
+
+/// shortcut for a #Strings heap index column
+#define STRING(name) { _T(name), ClrColumnType::stringIndex, 0 }
+
+/// shortcut for a #GUID heap index column
+#define GUID_INDEX(name) { _T(name), ClrColumnType::guidIndex, 0 }
+
+/// shortcut for a #Blob heap index column
+#define BLOB(name) { _T(name), ClrColumnType::blobIndex, 0 }
+
+/// shortcut for a table index column
+#define TABLE(name, tableId) { _T(name), ClrColumnType::tableIndex, tableId }
+
+/// shortcut for a coded index column
+#define CODED(name, codedIndexId) { _T(name), ClrColumnType::codedIndex, codedIndexId }
+
+const std::vector<ClrTableDefinition> g_listClrTableDefinitions =
+{
+   { _T("Module"), {
+      FIXED("Generation", 2), STRING("Name"), GUID_INDEX("Mvid"),
+      GUID_INDEX("EncId"), GUID_INDEX("EncBaseId") } },
+   { _T("TypeRef"), {
+      CODED("ResolutionScope", clrCodedIndexResolutionScope),
+      STRING("TypeName"), STRING("TypeNamespace") } },
+   { _T("TypeDef"), {
+      FIXED("Flags", 4), STRING("TypeName"), STRING("TypeNamespace"),
+      CODED("Extends", clrCodedIndexTypeDefOrRef),
+      TABLE("FieldList", clrTableField), TABLE("MethodList", clrTableMethodDef) } },
+   { _T("FieldPtr"), {
+      TABLE("Field", clrTableField) } },
+   { _T("Field"), {
+      FIXED("Flags", 2), STRING("Name"), BLOB("Signature") } },
+   { _T("MethodPtr"), {
+      TABLE("Method", clrTableMethodDef) } },
+   { _T("MethodDef"), {
+      FIXED("RVA", 4), FIXED("ImplFlags", 2), FIXED("Flags", 2), STRING("Name"),
+      BLOB("Signature"), TABLE("ParamList", clrTableParam) } },
+   { _T("ParamPtr"), {
+      TABLE("Param", clrTableParam) } },
+   { _T("Param"), {
+      FIXED("Flags", 2), FIXED("Sequence", 2), STRING("Name") } },
+   { _T("InterfaceImpl"), {
+      TABLE("Class", clrTableTypeDef), CODED("Interface", clrCodedIndexTypeDefOrRef) } },
+   { _T("MemberRef"), {
+      CODED("Class", clrCodedIndexMemberRefParent), STRING("Name"), BLOB("Signature") } },
+   { _T("Constant"), {
+      FIXED("Type", 1), FIXED("Padding", 1), CODED("Parent", clrCodedIndexHasConstant),
+      BLOB("Value") } },
+   { _T("CustomAttribute"), {
+      CODED("Parent", clrCodedIndexHasCustomAttribute),
+      CODED("Type", clrCodedIndexCustomAttributeType), BLOB("Value") } },
+   { _T("FieldMarshal"), {
+      CODED("Parent", clrCodedIndexHasFieldMarshal), BLOB("NativeType") } },
+   { _T("DeclSecurity"), {
+      FIXED("Action", 2), CODED("Parent", clrCodedIndexHasDeclSecurity),
+      BLOB("PermissionSet") } },
+   { _T("ClassLayout"), {
+      FIXED("PackingSize", 2), FIXED("ClassSize", 4), TABLE("Parent", clrTableTypeDef) } },
+   { _T("FieldLayout"), {
+      FIXED("Offset", 4), TABLE("Field", clrTableField) } },
+   { _T("StandAloneSig"), {
+      BLOB("Signature") } },
+   { _T("EventMap"), {
+      TABLE("Parent", clrTableTypeDef), TABLE("EventList", clrTableEvent) } },
+   { _T("EventPtr"), {
+      TABLE("Event", clrTableEvent) } },
+   { _T("Event"), {
+      FIXED("EventFlags", 2), STRING("Name"), CODED("EventType", clrCodedIndexTypeDefOrRef) } },
+   { _T("PropertyMap"), {
+      TABLE("Parent", clrTableTypeDef), TABLE("PropertyList", clrTableProperty) } },
+   { _T("PropertyPtr"), {
+      TABLE("Property", clrTableProperty) } },
+   { _T("Property"), {
+      FIXED("Flags", 2), STRING("Name"), BLOB("Type") } },
+   { _T("MethodSemantics"), {
+      FIXED("Semantics", 2), TABLE("Method", clrTableMethodDef),
+      CODED("Association", clrCodedIndexHasSemantics) } },
+   { _T("MethodImpl"), {
+      TABLE("Class", clrTableTypeDef), CODED("MethodBody", clrCodedIndexMethodDefOrRef),
+      CODED("MethodDeclaration", clrCodedIndexMethodDefOrRef) } },
+   { _T("ModuleRef"), {
+      STRING("Name") } },
+   { _T("TypeSpec"), {
+      BLOB("Signature") } },
+   { _T("ImplMap"), {
+      FIXED("MappingFlags", 2), CODED("MemberForwarded", clrCodedIndexMemberForwarded),
+      STRING("ImportName"), TABLE("ImportScope", clrTableModuleRef) } },
+   { _T("FieldRVA"), {
+      FIXED("RVA", 4), TABLE("Field", clrTableField) } },
+   { _T("EncLog"), {
+      FIXED("Token", 4), FIXED("FuncCode", 4) } },
+   { _T("EncMap"), {
+      FIXED("Token", 4) } },
+   { _T("Assembly"), {
+      FIXED("HashAlgId", 4), FIXED("MajorVersion", 2), FIXED("MinorVersion", 2),
+      FIXED("BuildNumber", 2), FIXED("RevisionNumber", 2), FIXED("Flags", 4),
+      BLOB("PublicKey"), STRING("Name"), STRING("Culture") } },
+   { _T("AssemblyProcessor"), {
+      FIXED("Processor", 4) } },
+   { _T("AssemblyOS"), {
+      FIXED("OSPlatformID", 4), FIXED("OSMajorVersion", 4), FIXED("OSMinorVersion", 4) } },
+   { _T("AssemblyRef"), {
+      FIXED("MajorVersion", 2), FIXED("MinorVersion", 2), FIXED("BuildNumber", 2),
+      FIXED("RevisionNumber", 2), FIXED("Flags", 4), BLOB("PublicKeyOrToken"),
+      STRING("Name"), STRING("Culture"), BLOB("HashValue") } },
+   { _T("AssemblyRefProcessor"), {
+      FIXED("Processor", 4), TABLE("AssemblyRef", clrTableAssemblyRef) } },
+   { _T("AssemblyRefOS"), {
+      FIXED("OSPlatformID", 4), FIXED("OSMajorVersion", 4), FIXED("OSMinorVersion", 4),
+      TABLE("AssemblyRef", clrTableAssemblyRef) } },
+   { _T("File"), {
+      FIXED("Flags", 4), STRING("Name"), BLOB("HashValue") } },
+   { _T("ExportedType"), {
+      FIXED("Flags", 4), FIXED("TypeDefId", 4), STRING("TypeName"), STRING("TypeNamespace"),
+      CODED("Implementation", clrCodedIndexImplementation) } },
+   { _T("ManifestResource"), {
+      FIXED("Offset", 4), FIXED("Flags", 4), STRING("Name"),
+      CODED("Implementation", clrCodedIndexImplementation) } },
+   { _T("NestedClass"), {
+      TABLE("NestedClass", clrTableTypeDef), TABLE("EnclosingClass", clrTableTypeDef) } },
+   { _T("GenericParam"), {
+      FIXED("Number", 2), FIXED("Flags", 2), CODED("Owner", clrCodedIndexTypeOrMethodDef),
+      STRING("Name") } },
+   { _T("MethodSpec"), {
+      CODED("Method", clrCodedIndexMethodDefOrRef), BLOB("Instantiation") } },
+   { _T("GenericParamConstraint"), {
+      TABLE("Owner", clrTableGenericParam), CODED("Constraint", clrCodedIndexTypeDefOrRef) } },
+};
+
+#undef FIXED
+#undef STRING
+#undef GUID_INDEX
+#undef BLOB
+#undef TABLE
+#undef CODED
+
+const std::vector<ClrCodedIndexDefinition> g_listClrCodedIndexDefinitions =
+{
+   { _T("TypeDefOrRef"), 2, { clrTableTypeDef, clrTableTypeRef, clrTableTypeSpec } },
+   { _T("HasConstant"), 2, { clrTableField, clrTableParam, clrTableProperty } },
+   { _T("HasCustomAttribute"), 5, {
+      clrTableMethodDef, clrTableField, clrTableTypeRef, clrTableTypeDef, clrTableParam,
+      clrTableInterfaceImpl, clrTableMemberRef, clrTableModule, clrTableDeclSecurity,
+      clrTableProperty, clrTableEvent, clrTableStandAloneSig, clrTableModuleRef,
+      clrTableTypeSpec, clrTableAssembly, clrTableAssemblyRef, clrTableFile,
+      clrTableExportedType, clrTableManifestResource, clrTableGenericParam,
+      clrTableGenericParamConstraint, clrTableMethodSpec } },
+   { _T("HasFieldMarshal"), 1, { clrTableField, clrTableParam } },
+   { _T("HasDeclSecurity"), 2, { clrTableTypeDef, clrTableMethodDef, clrTableAssembly } },
+   { _T("MemberRefParent"), 3, {
+      clrTableTypeDef, clrTableTypeRef, clrTableModuleRef, clrTableMethodDef, clrTableTypeSpec } },
+   { _T("HasSemantics"), 1, { clrTableEvent, clrTableProperty } },
+   { _T("MethodDefOrRef"), 1, { clrTableMethodDef, clrTableMemberRef } },
+   { _T("MemberForwarded"), 1, { clrTableField, clrTableMethodDef } },
+   { _T("Implementation"), 2, { clrTableFile, clrTableAssemblyRef, clrTableExportedType } },
+   { _T("CustomAttributeType"), 3, {
+      clrTableNotUsed, clrTableNotUsed, clrTableMethodDef, clrTableMemberRef, clrTableNotUsed } },
+   { _T("ResolutionScope"), 2, {
+      clrTableModule, clrTableModuleRef, clrTableAssemblyRef, clrTableTypeRef } },
+   { _T("TypeOrMethodDef"), 1, { clrTableTypeDef, clrTableMethodDef } },
+};
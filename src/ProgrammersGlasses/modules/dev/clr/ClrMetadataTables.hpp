@@ -0,0 +1,127 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ClrMetadataTables.hpp
+/// \brief CLR metadata table schema
+//
+#pragma once
+
+/// \brief Metadata table IDs
+/// \see ECMA-335, II.22 Metadata logical format: tables
+enum ClrTableId : BYTE
+{
+   clrTableModule = 0x00,
+   clrTableTypeRef = 0x01,
+   clrTableTypeDef = 0x02,
+   clrTableFieldPtr = 0x03,
+   clrTableField = 0x04,
+   clrTableMethodPtr = 0x05,
+   clrTableMethodDef = 0x06,
+   clrTableParamPtr = 0x07,
+   clrTableParam = 0x08,
+   clrTableInterfaceImpl = 0x09,
+   clrTableMemberRef = 0x0a,
+   clrTableConstant = 0x0b,
+   clrTableCustomAttribute = 0x0c,
+   clrTableFieldMarshal = 0x0d,
+   clrTableDeclSecurity = 0x0e,
+   clrTableClassLayout = 0x0f,
+   clrTableFieldLayout = 0x10,
+   clrTableStandAloneSig = 0x11,
+   clrTableEventMap = 0x12,
+   clrTableEventPtr = 0x13,
+   clrTableEvent = 0x14,
+   clrTablePropertyMap = 0x15,
+   clrTablePropertyPtr = 0x16,
+   clrTableProperty = 0x17,
+   clrTableMethodSemantics = 0x18,
+   clrTableMethodImpl = 0x19,
+   clrTableModuleRef = 0x1a,
+   clrTableTypeSpec = 0x1b,
+   clrTableImplMap = 0x1c,
+   clrTableFieldRva = 0x1d,
+   clrTableEncLog = 0x1e,
+   clrTableEncMap = 0x1f,
+   clrTableAssembly = 0x20,
+   clrTableAssemblyProcessor = 0x21,
+   clrTableAssemblyOS = 0x22,
+   clrTableAssemblyRef = 0x23,
+   clrTableAssemblyRefProcessor = 0x24,
+   clrTableAssemblyRefOS = 0x25,
+   clrTableFile = 0x26,
+   clrTableExportedType = 0x27,
+   clrTableManifestResource = 0x28,
+   clrTableNestedClass = 0x29,
+   clrTableGenericParam = 0x2a,
+   clrTableMethodSpec = 0x2b,
+   clrTableGenericParamConstraint = 0x2c,
+
+   /// number of tables with a known schema
+   clrTableCount = 0x2d,
+
+   /// marks unused tags in coded indices
+   clrTableNotUsed = 0xff,
+};
+
+/// \brief Coded index IDs
+/// \see ECMA-335, II.24.2.6 #~ stream
+enum ClrCodedIndexId : BYTE
+{
+   clrCodedIndexTypeDefOrRef,
+   clrCodedIndexHasConstant,
+   clrCodedIndexHasCustomAttribute,
+   clrCodedIndexHasFieldMarshal,
+   clrCodedIndexHasDeclSecurity,
+   clrCodedIndexMemberRefParent,
+   clrCodedIndexHasSemantics,
+   clrCodedIndexMethodDefOrRef,
+   clrCodedIndexMemberForwarded,
+   clrCodedIndexImplementation,
+   clrCodedIndexCustomAttributeType,
+   clrCodedIndexResolutionScope,
+   clrCodedIndexTypeOrMethodDef,
+
+   /// number of coded index kinds
+   clrCodedIndexCount,
+};
+
+/// type of a metadata table column
+enum class ClrColumnType : BYTE
+{
+   fixed,         ///< fixed size value; parameter is the size in bytes
+   stringIndex,   ///< index into the #Strings heap
+   guidIndex,     ///< index into the #GUID heap
+   blobIndex,     ///< index into the #Blob heap
+   tableIndex,    ///< index into a table; parameter is the ClrTableId
+   codedIndex,    ///< coded index; parameter is the ClrCodedIndexId
+};
+
+/// definition of a metadata table column
+struct ClrColumnDefinition
+{
+   LPCTSTR name;           ///< column name
+   ClrColumnType type;     ///< column type
+   BYTE parameter;         ///< size, table ID or coded index ID, depending on type
+};
+
+/// definition of a metadata table
+struct ClrTableDefinition
+{
+   LPCTSTR name;                                ///< table name
+   std::vector<ClrColumnDefinition> columns;    ///< list of columns
+};
+
+/// definition of a coded index
+struct ClrCodedIndexDefinition
+{
+   LPCTSTR name;                 ///< coded index name
+   BYTE tagBits;                 ///< number of bits used for the tag
+   std::vector<BYTE> tables;     ///< table IDs, indexed by tag; clrTableNotUsed for unused tags
+};
+
+/// all metadata table definitions, indexed by ClrTableId
+extern const std::vector<ClrTableDefinition> g_listClrTableDefinitions;
+
+/// all coded index definitions, indexed by ClrCodedIndexId
+extern const std::vector<ClrCodedIndexDefinition> g_listClrCodedIndexDefinitions;
@@ -0,0 +1,144 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CodeViewDefinitions.cpp
+/// \brief CodeView debug information constants
+//
+#include "stdafx.h"
+#include "CodeViewDefinitions.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapCodeViewSubsectionKindToDisplayText =
+{
+   { 0xf1, _T("DEBUG_S_SYMBOLS") },
+   { 0xf2, _T("DEBUG_S_LINES") },
+   { 0xf3, _T("DEBUG_S_STRINGTABLE") },
+   { 0xf4, _T("DEBUG_S_FILECHKSMS") },
+   { 0xf5, _T("DEBUG_S_FRAMEDATA") },
+   { 0xf6, _T("DEBUG_S_INLINEELINES") },
+   { 0xf7, _T("DEBUG_S_CROSSSCOPEIMPORTS") },
+   { 0xf8, _T("DEBUG_S_CROSSSCOPEEXPORTS") },
+   { 0xf9, _T("DEBUG_S_IL_LINES") },
+   { 0xfa, _T("DEBUG_S_FUNC_MDTOKEN_MAP") },
+   { 0xfb, _T("DEBUG_S_TYPE_MDTOKEN_MAP") },
+   { 0xfc, _T("DEBUG_S_MERGED_ASSEMBLYINPUT") },
+   { 0xfd, _T("DEBUG_S_COFF_SYMBOL_RVA") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapCodeViewSymbolKindToDisplayText =
+{
+   { 0x0006, _T("S_END") },
+   { 0x1012, _T("S_FRAMEPROC") },
+   { 0x1101, _T("S_OBJNAME") },
+   { 0x1102, _T("S_THUNK32") },
+   { 0x1103, _T("S_BLOCK32") },
+   { 0x1105, _T("S_LABEL32") },
+   { 0x1106, _T("S_REGISTER") },
+   { 0x1107, _T("S_CONSTANT") },
+   { 0x1108, _T("S_UDT") },
+   { 0x110b, _T("S_BPREL32") },
+   { 0x110c, _T("S_LDATA32") },
+   { 0x110d, _T("S_GDATA32") },
+   { 0x110e, _T("S_PUB32") },
+   { 0x110f, _T("S_LPROC32") },
+   { 0x1110, _T("S_GPROC32") },
+   { 0x1111, _T("S_REGREL32") },
+   { 0x1112, _T("S_LTHREAD32") },
+   { 0x1113, _T("S_GTHREAD32") },
+   { 0x1116, _T("S_COMPILE2") },
+   { 0x111c, _T("S_MANSLOT") },
+   { 0x1124, _T("S_UNAMESPACE") },
+   { 0x1125, _T("S_PROCREF") },
+   { 0x1126, _T("S_DATAREF") },
+   { 0x1127, _T("S_LPROCREF") },
+   { 0x1129, _T("S_TOKENREF") },
+   { 0x112c, _T("S_TRAMPOLINE") },
+   { 0x1136, _T("S_SECTION") },
+   { 0x1137, _T("S_COFFGROUP") },
+   { 0x1138, _T("S_EXPORT") },
+   { 0x1139, _T("S_CALLSITEINFO") },
+   { 0x113a, _T("S_FRAMECOOKIE") },
+   { 0x113c, _T("S_COMPILE3") },
+   { 0x113d, _T("S_ENVBLOCK") },
+   { 0x113e, _T("S_LOCAL") },
+   { 0x1141, _T("S_DEFRANGE_REGISTER") },
+   { 0x1142, _T("S_DEFRANGE_FRAMEPOINTER_REL") },
+   { 0x1143, _T("S_DEFRANGE_SUBFIELD_REGISTER") },
+   { 0x1144, _T("S_DEFRANGE_FRAMEPOINTER_REL_FULL_SCOPE") },
+   { 0x1145, _T("S_DEFRANGE_REGISTER_REL") },
+   { 0x1146, _T("S_LPROC32_ID") },
+   { 0x1147, _T("S_GPROC32_ID") },
+   { 0x114c, _T("S_BUILDINFO") },
+   { 0x114d, _T("S_INLINESITE") },
+   { 0x114e, _T("S_INLINESITE_END") },
+   { 0x114f, _T("S_PROC_ID_END") },
+   { 0x1153, _T("S_FILESTATIC") },
+   { 0x1159, _T("S_ARMSWITCHTABLE") },
+   { 0x115a, _T("S_CALLEES") },
+   { 0x115b, _T("S_CALLERS") },
+   { 0x115c, _T("S_POGODATA") },
+   { 0x115d, _T("S_INLINESITE2") },
+   { 0x115e, _T("S_HEAPALLOCSITE") },
+   { 0x1167, _T("S_INLINEES") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapCodeViewTypeLeafKindToDisplayText =
+{
+   { 0x000a, _T("LF_VTSHAPE") },
+   { 0x000e, _T("LF_LABEL") },
+   { 0x1001, _T("LF_MODIFIER") },
+   { 0x1002, _T("LF_POINTER") },
+   { 0x1008, _T("LF_PROCEDURE") },
+   { 0x1009, _T("LF_MFUNCTION") },
+   { 0x1201, _T("LF_ARGLIST") },
+   { 0x1203, _T("LF_FIELDLIST") },
+   { 0x1205, _T("LF_BITFIELD") },
+   { 0x1206, _T("LF_METHODLIST") },
+   { 0x1503, _T("LF_ARRAY") },
+   { 0x1504, _T("LF_CLASS") },
+   { 0x1505, _T("LF_STRUCTURE") },
+   { 0x1506, _T("LF_UNION") },
+   { 0x1507, _T("LF_ENUM") },
+   { 0x150a, _T("LF_ALIAS") },
+   { 0x1515, _T("LF_TYPESERVER2") },
+   { 0x1519, _T("LF_INTERFACE") },
+   { 0x1601, _T("LF_FUNC_ID") },
+   { 0x1602, _T("LF_MFUNC_ID") },
+   { 0x1603, _T("LF_BUILDINFO") },
+   { 0x1604, _T("LF_SUBSTR_LIST") },
+   { 0x1605, _T("LF_STRING_ID") },
+   { 0x1606, _T("LF_UDT_SRC_LINE") },
+   { 0x1607, _T("LF_UDT_MOD_SRC_LINE") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapCodeViewSimpleTypeToDisplayText =
+{
+   { 0x00, _T("T_NOTYPE") },
+   { 0x03, _T("void") },
+   { 0x08, _T("HRESULT") },
+   { 0x10, _T("signed char") },
+   { 0x11, _T("short") },
+   { 0x12, _T("long") },
+   { 0x13, _T("__int64") },
+   { 0x20, _T("unsigned char") },
+   { 0x21, _T("unsigned short") },
+   { 0x22, _T("unsigned long") },
+   { 0x23, _T("unsigned __int64") },
+   { 0x30, _T("bool") },
+   { 0x40, _T("float") },
+   { 0x41, _T("double") },
+   { 0x42, _T("long double") },
+   { 0x68, _T("__int8") },
+   { 0x69, _T("unsigned __int8") },
+   { 0x70, _T("char") },
+   { 0x71, _T("wchar_t") },
+   { 0x72, _T("__int16") },
+   { 0x73, _T("unsigned __int16") },
+   { 0x74, _T("int") },
+   { 0x75, _T("unsigned int") },
+   { 0x76, _T("__int64") },
+   { 0x77, _T("unsigned __int64") },
+   { 0x7a, _T("char16_t") },
+   { 0x7b, _T("char32_t") },
+   { 0x7c, _T("char8_t") },
+};
@@ -0,0 +1,52 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CodeViewDefinitions.hpp
+/// \brief CodeView debug information constants
+/// \see https://llvm.org/docs/PDB/CodeViewSymbols.html
+/// \see https://llvm.org/docs/PDB/CodeViewTypes.html
+//
+#pragma once
+
+/// CV_SIGNATURE_C13: signature at the start of .debug$S and .debug$T sections
+constexpr DWORD c_codeViewSignatureC13 = 4;
+
+/// flag in the subsection kind, indicating that the subsection should be ignored
+constexpr DWORD c_codeViewSubsectionIgnore = 0x80000000;
+
+/// DEBUG_S_SYMBOLS: subsection with symbol records
+constexpr DWORD c_codeViewSubsectionSymbols = 0xf1;
+
+/// DEBUG_S_LINES: subsection with line numbers of a function
+constexpr DWORD c_codeViewSubsectionLines = 0xf2;
+
+/// DEBUG_S_STRINGTABLE: subsection with file names
+constexpr DWORD c_codeViewSubsectionStringTable = 0xf3;
+
+/// DEBUG_S_FILECHKSMS: subsection with file checksums
+constexpr DWORD c_codeViewSubsectionFileChecksums = 0xf4;
+
+/// CV_LINES_HAVE_COLUMNS: flag of a line subsection, indicating column infos
+constexpr WORD c_codeViewLinesHaveColumns = 0x0001;
+
+/// first type index that refers to a type record; lower indices are simple types
+constexpr DWORD c_codeViewFirstNonSimpleTypeIndex = 0x1000;
+
+/// first numeric leaf value that isn't stored directly in the 16-bit leaf
+constexpr WORD c_codeViewNumericLeaf = 0x8000;
+
+/// LF_TYPESERVER2: type record referencing an external PDB file
+constexpr WORD c_codeViewLeafTypeServer2 = 0x1515;
+
+/// mapping of debug subsection kinds to display text
+extern const std::map<DWORD, LPCTSTR> g_mapCodeViewSubsectionKindToDisplayText;
+
+/// mapping of symbol record kinds to display text
+extern const std::map<DWORD, LPCTSTR> g_mapCodeViewSymbolKindToDisplayText;
+
+/// mapping of type record leaf kinds to display text
+extern const std::map<DWORD, LPCTSTR> g_mapCodeViewTypeLeafKindToDisplayText;
+
+/// mapping of simple types (the lower 8 bits of the type index) to display text
+extern const std::map<DWORD, LPCTSTR> g_mapCodeViewSimpleTypeToDisplayText;
@@ -0,0 +1,270 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CodeViewNodeTreeBuilder.cpp
+/// \brief Node tree builder for CodeView debug information
+//
+#include "stdafx.h"
+#include "CodeViewNodeTreeBuilder.hpp"
+#include "CodeViewReader.hpp"
+#include "CodeViewDefinitions.hpp"
+#include "modules/FilterSortListViewNode.hpp"
+#include "SymbolsHelper.hpp"
+
+CodeViewNodeTreeBuilder::CodeViewNodeTreeBuilder(std::shared_ptr<CodeViewReader> reader)
+   :m_reader(reader)
+{
+}
+
+void CodeViewNodeTreeBuilder::AddNodes(StaticNode& parentNode, CString& summaryText) const
+{
+   if (!m_reader->GetErrorText().IsEmpty())
+   {
+      int pos = 0;
+      CString line;
+      while (!(line = m_reader->GetErrorText().Tokenize(_T("\n"), pos)).IsEmpty())
+         summaryText.AppendFormat(_T("Error: CodeView: %s\n"), line.GetString());
+   }
+
+   if (!m_reader->IsAvailable())
+      return;
+
+   summaryText.AppendFormat(_T("CodeView debug information with %zu symbol records and %zu type records.\n"),
+      m_reader->NumberOfSymbolRecords(),
+      m_reader->NumberOfTypeRecords());
+
+   if (m_reader->IsTypeServerReference())
+      summaryText += _T("CodeView types are stored in a PDB file (LF_TYPESERVER2).\n");
+
+   AddSubsections(parentNode);
+   AddSymbols(parentNode);
+   AddLines(parentNode);
+   AddTypes(parentNode);
+}
+
+void CodeViewNodeTreeBuilder::AddSubsections(StaticNode& parentNode) const
+{
+   const std::vector<CodeViewSubsection>& subsections = m_reader->Subsections();
+   if (subsections.empty())
+      return;
+
+   std::vector<std::vector<CString>> subsectionTableData;
+   subsectionTableData.reserve(subsections.size());
+
+   for (size_t index = 0; index < subsections.size(); index++)
+   {
+      const CodeViewSubsection& subsection = subsections[index];
+
+      CString indexText;
+      indexText.Format(_T("%zu"), index);
+
+      CString sectionText;
+      sectionText.Format(_T("%zu"), m_reader->Sections().symbols[subsection.sectionIndex].sectionNumber);
+
+      CString offsetText;
+      offsetText.Format(_T("0x%08zx"), subsection.offset);
+
+      CString kindText;
+      kindText.Format(_T("0x%08x"), subsection.kind);
+
+      CString sizeText;
+      sizeText.Format(_T("0x%08zx"), subsection.size);
+
+      subsectionTableData.push_back(
+         std::vector<CString> {
+         indexText,
+            sectionText,
+            offsetText,
+            GetValueFromMapOrDefault<DWORD>(
+               g_mapCodeViewSubsectionKindToDisplayText,
+               subsection.kind & ~c_codeViewSubsectionIgnore,
+               kindText),
+            sizeText,
+      });
+   }
+
+   static std::vector<CString> subsectionColumnNames
+   {
+      _T("Index"),
+      _T("Section"),
+      _T("Offset"),
+      _T("Kind"),
+      _T("Size"),
+   };
+
+   parentNode.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("CodeView Subsections"),
+         NodeTreeIconID::nodeTreeIconTable,
+         subsectionColumnNames,
+         subsectionTableData,
+         true));
+}
+
+void CodeViewNodeTreeBuilder::AddSymbols(StaticNode& parentNode) const
+{
+   std::shared_ptr<CodeViewReader> reader = m_reader;
+
+   if (reader->NumberOfSymbolRecords() == 0)
+      return;
+
+   static std::vector<CString> symbolColumnNames
+   {
+      _T("Index"),
+      _T("Section"),
+      _T("Offset"),
+      _T("Kind"),
+      _T("Name"),
+      _T("Undecorated name"),
+      _T("Type"),
+   };
+
+   parentNode.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("CodeView Symbols"),
+         NodeTreeIconID::nodeTreeIconTable,
+         symbolColumnNames,
+         reader->NumberOfSymbolRecords(),
+         [reader](size_t index)
+         {
+            CodeViewRecord record = reader->SymbolRecord(index);
+
+            CString indexText;
+            indexText.Format(_T("%zu"), index);
+
+            CString sectionText;
+            sectionText.Format(_T("%zu"),
+               reader->Sections().symbols[reader->SymbolRecordSectionIndex(index)].sectionNumber);
+
+            CString offsetText;
+            offsetText.Format(_T("0x%08zx"), reader->SymbolRecordOffset(index));
+
+            CString kindText;
+            kindText.Format(_T("0x%04x"), record.kind);
+
+            CString name = CodeViewReader::GetSymbolName(record);
+
+            DWORD typeIndex = CodeViewReader::GetSymbolTypeIndex(record);
+
+            return std::vector<CString> {
+               indexText,
+               sectionText,
+               offsetText,
+               GetValueFromMapOrDefault<DWORD>(g_mapCodeViewSymbolKindToDisplayText, record.kind, kindText),
+               name,
+               SymbolsHelper::UndecorateSymbol(name),
+               typeIndex != 0 ? reader->FormatTypeIndex(typeIndex) : CString{},
+            };
+         },
+         true));
+}
+
+void CodeViewNodeTreeBuilder::AddLines(StaticNode& parentNode) const
+{
+   std::shared_ptr<CodeViewReader> reader = m_reader;
+
+   bool hasLines = std::any_of(reader->Subsections().begin(), reader->Subsections().end(),
+      [](const CodeViewSubsection& subsection) { return subsection.kind == c_codeViewSubsectionLines; });
+
+   if (!hasLines)
+      return;
+
+   static std::vector<CString> lineColumnNames
+   {
+      _T("Subsection"),
+      _T("File"),
+      _T("Offset"),
+      _T("Line"),
+      _T("Statement"),
+   };
+
+   // the number of lines is only known after decoding all line subsections
+   parentNode.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("CodeView Lines"),
+         NodeTreeIconID::nodeTreeIconTable,
+         lineColumnNames,
+         [reader]()
+         {
+            std::vector<CodeViewLine> lines = reader->DecodeLines();
+
+            std::vector<std::vector<CString>> data;
+            data.reserve(lines.size());
+
+            for (const CodeViewLine& line : lines)
+            {
+               CString subsectionText;
+               subsectionText.Format(_T("%zu"), line.subsectionIndex);
+
+               CString offsetText;
+               offsetText.Format(_T("0x%08x"), line.offset);
+
+               CString lineText;
+               lineText.Format(_T("%u"), line.line);
+
+               data.push_back(
+                  std::vector<CString> {
+                  subsectionText,
+                     line.fileName,
+                     offsetText,
+                     lineText,
+                     line.isStatement ? _T("yes") : _T("no"),
+               });
+            }
+
+            return data;
+         },
+         true));
+}
+
+void CodeViewNodeTreeBuilder::AddTypes(StaticNode& parentNode) const
+{
+   std::shared_ptr<CodeViewReader> reader = m_reader;
+
+   if (reader->NumberOfTypeRecords() == 0)
+      return;
+
+   static std::vector<CString> typeColumnNames
+   {
+      _T("Type index"),
+      _T("Offset"),
+      _T("Leaf kind"),
+      _T("Size"),
+      _T("Name"),
+   };
+
+   parentNode.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("CodeView Types"),
+         NodeTreeIconID::nodeTreeIconTable,
+         typeColumnNames,
+         reader->NumberOfTypeRecords(),
+         [reader](size_t index)
+         {
+            DWORD typeIndex = c_codeViewFirstNonSimpleTypeIndex + static_cast<DWORD>(index);
+
+            CodeViewRecord record = reader->TypeRecord(typeIndex).value();
+
+            CString typeIndexText;
+            typeIndexText.Format(_T("0x%04x"), typeIndex);
+
+            CString offsetText;
+            offsetText.Format(_T("0x%08zx"), reader->TypeRecordOffset(typeIndex));
+
+            CString kindText;
+            kindText.Format(_T("0x%04x"), record.kind);
+
+            CString sizeText;
+            sizeText.Format(_T("%zu"), record.size);
+
+            return std::vector<CString> {
+               typeIndexText,
+               offsetText,
+               GetValueFromMapOrDefault<DWORD>(g_mapCodeViewTypeLeafKindToDisplayText, record.kind, kindText),
+               sizeText,
+               CodeViewReader::GetTypeName(record),
+            };
+         },
+         true));
+}
@@ -0,0 +1,43 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CodeViewNodeTreeBuilder.hpp
+/// \brief Node tree builder for CodeView debug information
+//
+#pragma once
+
+#include <memory>
+
+class StaticNode;
+class CodeViewReader;
+
+/// \brief Node tree builder for CodeView debug information
+/// \details Adds the subsection, symbol, line and type tables. The rows of
+/// the tables are only formatted when the table is shown.
+class CodeViewNodeTreeBuilder
+{
+public:
+   /// ctor
+   explicit CodeViewNodeTreeBuilder(std::shared_ptr<CodeViewReader> reader);
+
+   /// adds CodeView nodes to the parent node, and summary text
+   void AddNodes(StaticNode& parentNode, CString& summaryText) const;
+
+private:
+   /// adds the subsections table node
+   void AddSubsections(StaticNode& parentNode) const;
+
+   /// adds the symbol records table node
+   void AddSymbols(StaticNode& parentNode) const;
+
+   /// adds the line table node
+   void AddLines(StaticNode& parentNode) const;
+
+   /// adds the type records table node
+   void AddTypes(StaticNode& parentNode) const;
+
+private:
+   /// CodeView reader; shared with nodes that format rows lazily
+   std::shared_ptr<CodeViewReader> m_reader;
+};
@@ -0,0 +1,441 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CodeViewReader.cpp
+/// \brief reader for CodeView debug information of COFF objects
+//
+#include "stdafx.h"
+#include "CodeViewReader.hpp"
+#include "CodeViewDefinitions.hpp"
+
+/// value for records without name or type index
+constexpr size_t c_noOffset = static_cast<size_t>(-1);
+
+/// \brief Layout of a symbol record
+struct CodeViewSymbolLayout
+{
+   /// offset of the name in the record data
+   size_t nameOffset;
+
+   /// offset of the type index in the record data
+   size_t typeIndexOffset;
+};
+
+/// symbol record layouts, by record kind; only records with names or type
+/// indices are listed
+static const std::map<WORD, CodeViewSymbolLayout> g_mapCodeViewSymbolLayouts =
+{
+   { 0x1101, { 4, c_noOffset } },   // S_OBJNAME: signature
+   { 0x1102, { 21, c_noOffset } },  // S_THUNK32: parent, end, next, offset, segment, length, ordinal
+   { 0x1103, { 18, c_noOffset } },  // S_BLOCK32: parent, end, length, offset, segment
+   { 0x1105, { 7, c_noOffset } },   // S_LABEL32: offset, segment, flags
+   { 0x1106, { 6, 0 } },            // S_REGISTER: type, register
+   { 0x1108, { 4, 0 } },            // S_UDT: type
+   { 0x110b, { 8, 4 } },            // S_BPREL32: offset, type
+   { 0x110c, { 10, 0 } },           // S_LDATA32: type, offset, segment
+   { 0x110d, { 10, 0 } },           // S_GDATA32
+   { 0x110e, { 10, c_noOffset } },  // S_PUB32: flags, offset, segment
+   { 0x110f, { 35, 24 } },          // S_LPROC32: parent, end, next, length, debug start, debug end, type, offset, segment, flags
+   { 0x1110, { 35, 24 } },          // S_GPROC32
+   { 0x1111, { 10, 4 } },           // S_REGREL32: offset, type, register
+   { 0x1112, { 10, 0 } },           // S_LTHREAD32: type, offset, segment
+   { 0x1113, { 10, 0 } },           // S_GTHREAD32
+   { 0x1116, { 18, c_noOffset } },  // S_COMPILE2: flags, machine, front end and back end versions
+   { 0x1124, { 0, c_noOffset } },   // S_UNAMESPACE
+   { 0x1125, { 10, c_noOffset } },  // S_PROCREF: checksum, symbol offset, module
+   { 0x1126, { 10, c_noOffset } },  // S_DATAREF
+   { 0x1127, { 10, c_noOffset } },  // S_LPROCREF
+   { 0x1136, { 16, c_noOffset } },  // S_SECTION: section, alignment, reserved, rva, length, characteristics
+   { 0x1137, { 14, c_noOffset } },  // S_COFFGROUP: length, characteristics, offset, segment
+   { 0x1138, { 4, c_noOffset } },   // S_EXPORT: ordinal, flags
+   { 0x113c, { 22, c_noOffset } },  // S_COMPILE3: flags, machine, versions
+   { 0x113e, { 6, 0 } },            // S_LOCAL: type, flags
+   { 0x1146, { 35, 24 } },          // S_LPROC32_ID
+   { 0x1147, { 35, 24 } },          // S_GPROC32_ID
+   { 0x1153, { 10, 0 } },           // S_FILESTATIC: type, module file name offset, flags
+};
+
+/// \brief Layout of a type record
+struct CodeViewTypeLayout
+{
+   /// offset of the name, or of the numeric leaf preceding the name
+   size_t nameOffset;
+
+   /// indicates that a numeric leaf precedes the name
+   bool hasNumericLeaf;
+};
+
+/// type record layouts, by leaf kind; only records with names are listed
+static const std::map<WORD, CodeViewTypeLayout> g_mapCodeViewTypeLayouts =
+{
+   { 0x1503, { 8, true } },   // LF_ARRAY: element type, index type, size
+   { 0x1504, { 16, true } },  // LF_CLASS: count, properties, field list, derived, vtable shape, size
+   { 0x1505, { 16, true } },  // LF_STRUCTURE
+   { 0x1519, { 16, true } },  // LF_INTERFACE
+   { 0x1506, { 8, true } },   // LF_UNION: count, properties, field list, size
+   { 0x1507, { 12, false } }, // LF_ENUM: count, properties, underlying type, field list
+   { 0x150a, { 4, false } },  // LF_ALIAS: underlying type
+   { 0x1515, { 20, false } }, // LF_TYPESERVER2: GUID, age
+   { 0x1601, { 8, false } },  // LF_FUNC_ID: scope, type
+   { 0x1602, { 8, false } },  // LF_MFUNC_ID: parent type, type
+   { 0x1605, { 4, false } },  // LF_STRING_ID: substring list
+};
+
+/// \brief Reads a zero-terminated name from record data
+static CString ReadName(const CodeViewRecord& record, size_t offset)
+{
+   if (offset >= record.size)
+      return CString{};
+
+   const char* name = reinterpret_cast<const char*>(record.data + offset);
+
+   return CString{ CA2T(CStringA{ name, static_cast<int>(strnlen(name, record.size - offset)) }, CP_UTF8) };
+}
+
+/// \brief Skips a numeric leaf; returns false when the leaf is invalid
+static bool SkipNumericLeaf(const CodeViewRecord& record, size_t& offset)
+{
+   if (offset + sizeof(WORD) > record.size)
+      return false;
+
+   WORD leaf = *reinterpret_cast<const WORD*>(record.data + offset);
+   offset += sizeof(WORD);
+
+   // values below 0x8000 are stored in the leaf itself
+   if (leaf < c_codeViewNumericLeaf)
+      return true;
+
+   static const std::map<WORD, size_t> s_numericLeafSizes =
+   {
+      { 0x8000, 1 }, // LF_CHAR
+      { 0x8001, 2 }, // LF_SHORT
+      { 0x8002, 2 }, // LF_USHORT
+      { 0x8003, 4 }, // LF_LONG
+      { 0x8004, 4 }, // LF_ULONG
+      { 0x8005, 4 }, // LF_REAL32
+      { 0x8006, 8 }, // LF_REAL64
+      { 0x8009, 8 }, // LF_QUADWORD
+      { 0x800a, 8 }, // LF_UQUADWORD
+      { 0x8017, 16 }, // LF_OCTWORD
+      { 0x8018, 16 }, // LF_UOCTWORD
+   };
+
+   auto iter = s_numericLeafSizes.find(leaf);
+   if (iter == s_numericLeafSizes.end())
+      return false;
+
+   offset += iter->second;
+   return offset <= record.size;
+}
+
+CodeViewReader::CodeViewReader(const CodeViewSections& sections)
+   :m_sections(sections)
+{
+   for (size_t sectionIndex = 0; sectionIndex < m_sections.symbols.size(); sectionIndex++)
+      IndexSymbolSection(sectionIndex);
+
+   if (m_sections.types.IsAvailable())
+      IndexTypeSection();
+}
+
+CodeViewRecord CodeViewReader::GetRecord(const BYTE* record)
+{
+   WORD recordLength = *reinterpret_cast<const WORD*>(record);
+
+   CodeViewRecord result;
+   result.kind = *reinterpret_cast<const WORD*>(record + sizeof(WORD));
+   result.data = record + 2 * sizeof(WORD);
+   result.size = recordLength - sizeof(WORD);
+
+   return result;
+}
+
+void CodeViewReader::IndexSymbolSection(size_t sectionIndex)
+{
+   const CodeViewSection& section = m_sections.symbols[sectionIndex];
+
+   if (section.size < sizeof(DWORD) ||
+      *reinterpret_cast<const DWORD*>(section.data) != c_codeViewSignatureC13)
+   {
+      m_errorText.AppendFormat(_T("Unsupported CodeView signature in section %zu\n"), section.sectionNumber);
+      return;
+   }
+
+   size_t offset = sizeof(DWORD);
+   while (offset + 2 * sizeof(DWORD) <= section.size)
+   {
+      DWORD kind = *reinterpret_cast<const DWORD*>(section.data + offset);
+      DWORD length = *reinterpret_cast<const DWORD*>(section.data + offset + sizeof(DWORD));
+      offset += 2 * sizeof(DWORD);
+
+      if (length > section.size - offset)
+      {
+         m_errorText.AppendFormat(_T("CodeView subsection at offset 0x%08zx in section %zu exceeds the section\n"),
+            offset - 2 * sizeof(DWORD), section.sectionNumber);
+         return;
+      }
+
+      CodeViewSubsection subsection;
+      subsection.sectionIndex = sectionIndex;
+      subsection.offset = offset;
+      subsection.kind = kind;
+      subsection.data = section.data + offset;
+      subsection.size = length;
+
+      if (kind == c_codeViewSubsectionFileChecksums && !m_fileChecksumsIndex.has_value())
+         m_fileChecksumsIndex = m_subsections.size();
+      else if (kind == c_codeViewSubsectionStringTable && !m_stringTableIndex.has_value())
+         m_stringTableIndex = m_subsections.size();
+
+      m_subsections.push_back(subsection);
+
+      if (kind == c_codeViewSubsectionSymbols)
+      {
+         // symbol records are not aligned inside the subsection
+         size_t recordOffset = 0;
+         while (recordOffset + 2 * sizeof(WORD) <= length)
+         {
+            const BYTE* record = subsection.data + recordOffset;
+            WORD recordLength = *reinterpret_cast<const WORD*>(record);
+
+            if (recordLength < sizeof(WORD) ||
+               recordLength > length - recordOffset - sizeof(WORD))
+            {
+               m_errorText.AppendFormat(_T("Invalid CodeView symbol record at offset 0x%08zx in section %zu\n"),
+                  offset + recordOffset, section.sectionNumber);
+               break;
+            }
+
+            m_symbolRecords.push_back(SymbolRecordLocation{ record, sectionIndex });
+
+            recordOffset += sizeof(WORD) + recordLength;
+         }
+      }
+
+      // subsections are aligned to 4 bytes
+      offset += (static_cast<size_t>(length) + 3) & ~size_t(3);
+   }
+}
+
+void CodeViewReader::IndexTypeSection()
+{
+   const CodeViewSection& section = m_sections.types;
+
+   if (section.size < sizeof(DWORD) ||
+      *reinterpret_cast<const DWORD*>(section.data) != c_codeViewSignatureC13)
+   {
+      m_errorText.AppendFormat(_T("Unsupported CodeView signature in section %zu\n"), section.sectionNumber);
+      return;
+   }
+
+   size_t offset = sizeof(DWORD);
+   while (offset + 2 * sizeof(WORD) <= section.size)
+   {
+      const BYTE* record = section.data + offset;
+      WORD recordLength = *reinterpret_cast<const WORD*>(record);
+
+      if (recordLength < sizeof(WORD) ||
+         recordLength > section.size - offset - sizeof(WORD))
+      {
+         m_errorText.AppendFormat(_T("Invalid CodeView type record at offset 0x%08zx\n"), offset);
+         break;
+      }
+
+      m_typeRecords.push_back(record);
+
+      offset += sizeof(WORD) + recordLength;
+   }
+}
+
+CodeViewRecord CodeViewReader::SymbolRecord(size_t index) const
+{
+   return GetRecord(m_symbolRecords[index].record);
+}
+
+size_t CodeViewReader::SymbolRecordOffset(size_t index) const
+{
+   const SymbolRecordLocation& location = m_symbolRecords[index];
+   return location.record - m_sections.symbols[location.sectionIndex].data;
+}
+
+std::optional<CodeViewRecord> CodeViewReader::TypeRecord(DWORD typeIndex) const
+{
+   if (typeIndex < c_codeViewFirstNonSimpleTypeIndex ||
+      typeIndex - c_codeViewFirstNonSimpleTypeIndex >= m_typeRecords.size())
+      return std::nullopt;
+
+   return GetRecord(m_typeRecords[typeIndex - c_codeViewFirstNonSimpleTypeIndex]);
+}
+
+size_t CodeViewReader::TypeRecordOffset(DWORD typeIndex) const
+{
+   return m_typeRecords[typeIndex - c_codeViewFirstNonSimpleTypeIndex] - m_sections.types.data;
+}
+
+bool CodeViewReader::IsTypeServerReference() const
+{
+   std::optional<CodeViewRecord> record = TypeRecord(c_codeViewFirstNonSimpleTypeIndex);
+   return record.has_value() && record->kind == c_codeViewLeafTypeServer2;
+}
+
+CString CodeViewReader::GetSymbolName(const CodeViewRecord& record)
+{
+   // S_CONSTANT: type, numeric value, name
+   if (record.kind == 0x1107)
+   {
+      size_t offset = sizeof(DWORD);
+      return SkipNumericLeaf(record, offset) ? ReadName(record, offset) : CString{};
+   }
+
+   auto iter = g_mapCodeViewSymbolLayouts.find(record.kind);
+   if (iter == g_mapCodeViewSymbolLayouts.end())
+      return CString{};
+
+   return ReadName(record, iter->second.nameOffset);
+}
+
+DWORD CodeViewReader::GetSymbolTypeIndex(const CodeViewRecord& record)
+{
+   size_t typeIndexOffset = record.kind == 0x1107 // S_CONSTANT
+      ? 0
+      : c_noOffset;
+
+   auto iter = g_mapCodeViewSymbolLayouts.find(record.kind);
+   if (iter != g_mapCodeViewSymbolLayouts.end())
+      typeIndexOffset = iter->second.typeIndexOffset;
+
+   if (typeIndexOffset == c_noOffset ||
+      typeIndexOffset + sizeof(DWORD) > record.size)
+      return 0;
+
+   return *reinterpret_cast<const DWORD*>(record.data + typeIndexOffset);
+}
+
+CString CodeViewReader::GetTypeName(const CodeViewRecord& record)
+{
+   auto iter = g_mapCodeViewTypeLayouts.find(record.kind);
+   if (iter == g_mapCodeViewTypeLayouts.end())
+      return CString{};
+
+   size_t offset = iter->second.nameOffset;
+   if (iter->second.hasNumericLeaf &&
+      !SkipNumericLeaf(record, offset))
+      return CString{};
+
+   return ReadName(record, offset);
+}
+
+CString CodeViewReader::FormatTypeIndex(DWORD typeIndex) const
+{
+   CString text;
+
+   if (typeIndex < c_codeViewFirstNonSimpleTypeIndex)
+   {
+      // simple types store the pointer mode in bits 8 to 10
+      CString simpleTypeText;
+      simpleTypeText.Format(_T("T_0x%02x"), typeIndex & 0xff);
+
+      text = GetValueFromMapOrDefault<DWORD>(g_mapCodeViewSimpleTypeToDisplayText,
+         typeIndex & 0xff, simpleTypeText);
+
+      if ((typeIndex & 0x700) != 0)
+         text += _T("*");
+
+      return text;
+   }
+
+   text.Format(_T("0x%04x"), typeIndex);
+
+   std::optional<CodeViewRecord> record = TypeRecord(typeIndex);
+   if (!record.has_value())
+      return text;
+
+   CString name = GetTypeName(record.value());
+   text.AppendFormat(_T(" %s"),
+      !name.IsEmpty()
+      ? name.GetString()
+      : GetValueFromMapOrDefault<DWORD>(g_mapCodeViewTypeLeafKindToDisplayText, record->kind, _T("")));
+
+   return text;
+}
+
+CString CodeViewReader::GetFileName(DWORD fileChecksumOffset) const
+{
+   if (!m_fileChecksumsIndex.has_value() ||
+      !m_stringTableIndex.has_value())
+      return CString{};
+
+   // file checksum entry: file name offset, checksum size, checksum kind, checksum
+   const CodeViewSubsection& fileChecksums = m_subsections[m_fileChecksumsIndex.value()];
+   if (static_cast<size_t>(fileChecksumOffset) + sizeof(DWORD) > fileChecksums.size)
+      return CString{};
+
+   DWORD fileNameOffset = *reinterpret_cast<const DWORD*>(fileChecksums.data + fileChecksumOffset);
+
+   const CodeViewSubsection& stringTable = m_subsections[m_stringTableIndex.value()];
+   if (fileNameOffset >= stringTable.size)
+      return CString{};
+
+   const char* fileName = reinterpret_cast<const char*>(stringTable.data + fileNameOffset);
+
+   return CString{ CA2T(CStringA{ fileName, static_cast<int>(strnlen(fileName, stringTable.size - fileNameOffset)) }, CP_UTF8) };
+}
+
+std::vector<CodeViewLine> CodeViewReader::DecodeLines() const
+{
+   std::vector<CodeViewLine> lines;
+
+   for (size_t subsectionIndex = 0; subsectionIndex < m_subsections.size(); subsectionIndex++)
+   {
+      if (m_subsections[subsectionIndex].kind == c_codeViewSubsectionLines)
+         DecodeLineSubsection(subsectionIndex, lines);
+   }
+
+   return lines;
+}
+
+void CodeViewReader::DecodeLineSubsection(size_t subsectionIndex, std::vector<CodeViewLine>& lines) const
+{
+   const CodeViewSubsection& subsection = m_subsections[subsectionIndex];
+
+   // header: code offset, segment, flags, code size
+   constexpr size_t c_lineHeaderSize = 12;
+   if (subsection.size < c_lineHeaderSize)
+      return;
+
+   WORD flags = *reinterpret_cast<const WORD*>(subsection.data + 6);
+   size_t columnEntrySize = (flags & c_codeViewLinesHaveColumns) != 0 ? 2 * sizeof(WORD) : 0;
+
+   // blocks: file checksum offset, number of lines, block size, lines, columns
+   size_t offset = c_lineHeaderSize;
+   while (offset + 3 * sizeof(DWORD) <= subsection.size)
+   {
+      const DWORD* blockHeader = reinterpret_cast<const DWORD*>(subsection.data + offset);
+      DWORD fileChecksumOffset = blockHeader[0];
+      size_t numberOfLines = blockHeader[1];
+      size_t blockSize = blockHeader[2];
+
+      if (blockSize < 3 * sizeof(DWORD) ||
+         blockSize > subsection.size - offset ||
+         numberOfLines > (blockSize - 3 * sizeof(DWORD)) / (2 * sizeof(DWORD) + columnEntrySize))
+         return;
+
+      CString fileName = GetFileName(fileChecksumOffset);
+
+      const DWORD* lineEntry = blockHeader + 3;
+      for (size_t lineIndex = 0; lineIndex < numberOfLines; lineIndex++, lineEntry += 2)
+      {
+         CodeViewLine line;
+         line.subsectionIndex = subsectionIndex;
+         line.fileName = fileName;
+         line.offset = lineEntry[0];
+         line.line = lineEntry[1] & 0x00ffffff;
+         line.isStatement = (lineEntry[1] & 0x80000000) != 0;
+
+         lines.push_back(line);
+      }
+
+      offset += blockSize;
+   }
+}
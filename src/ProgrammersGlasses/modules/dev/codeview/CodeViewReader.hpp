@@ -0,0 +1,209 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CodeViewReader.hpp
+/// \brief reader for CodeView debug information of COFF objects
+//
+#pragma once
+
+#include <optional>
+
+/// \brief Contents of a single .debug$S or .debug$T section
+struct CodeViewSection
+{
+   /// section data, in the mapped file
+   const BYTE* data = nullptr;
+
+   /// size of section data
+   size_t size = 0;
+
+   /// 1-based COFF section number
+   size_t sectionNumber = 0;
+
+   /// returns if the section is available
+   bool IsAvailable() const { return data != nullptr && size != 0; }
+};
+
+/// \brief CodeView debug sections of a COFF object
+/// \details Objects compiled with /Gy contain a separate .debug$S section
+/// for each COMDAT function, so there may be many symbol sections.
+struct CodeViewSections
+{
+   /// all .debug$S sections, with symbol records and line tables
+   std::vector<CodeViewSection> symbols;
+
+   /// .debug$T section, with type records
+   CodeViewSection types;
+};
+
+/// \brief Debug subsection of a .debug$S section
+struct CodeViewSubsection
+{
+   /// index of the symbol section in CodeViewSections::symbols
+   size_t sectionIndex = 0;
+
+   /// offset of the subsection data in the section
+   size_t offset = 0;
+
+   /// subsection kind; DEBUG_S_* value
+   DWORD kind = 0;
+
+   /// subsection data
+   const BYTE* data = nullptr;
+
+   /// size of subsection data
+   size_t size = 0;
+};
+
+/// \brief Symbol or type record
+struct CodeViewRecord
+{
+   /// record kind; S_* or LF_* value
+   WORD kind = 0;
+
+   /// record data, following the record kind
+   const BYTE* data = nullptr;
+
+   /// size of record data
+   size_t size = 0;
+};
+
+/// \brief Single line number entry of a line table
+struct CodeViewLine
+{
+   /// index of the DEBUG_S_LINES subsection
+   size_t subsectionIndex = 0;
+
+   /// file name
+   CString fileName;
+
+   /// code offset, relative to the start of the function
+   DWORD offset = 0;
+
+   /// line number
+   DWORD line = 0;
+
+   /// indicates a statement, vs. an expression
+   bool isStatement = false;
+};
+
+/// \brief CodeView debug information reader
+/// \details Symbol and type records are variable length records that are
+/// read in place from the mapped sections. When constructed, the reader
+/// walks over all records once and stores the location of every record, so
+/// that a record can be accessed by its index in constant time; this is
+/// needed for type indices, which are referenced from symbol records and
+/// from other type records.
+class CodeViewReader
+{
+public:
+   /// ctor; indexes subsections, symbol records and type records
+   explicit CodeViewReader(const CodeViewSections& sections);
+
+   /// returns if any CodeView debug information is available
+   bool IsAvailable() const
+   {
+      return !m_subsections.empty() || !m_typeRecords.empty();
+   }
+
+   /// returns an error text, when the index couldn't be completely built
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the CodeView sections
+   const CodeViewSections& Sections() const { return m_sections; }
+
+   /// returns all debug subsections
+   const std::vector<CodeViewSubsection>& Subsections() const { return m_subsections; }
+
+   /// returns the number of symbol records
+   size_t NumberOfSymbolRecords() const { return m_symbolRecords.size(); }
+
+   /// returns a symbol record
+   CodeViewRecord SymbolRecord(size_t index) const;
+
+   /// returns the index of the symbol section containing a symbol record
+   size_t SymbolRecordSectionIndex(size_t index) const { return m_symbolRecords[index].sectionIndex; }
+
+   /// returns the offset of a symbol record in its section
+   size_t SymbolRecordOffset(size_t index) const;
+
+   /// returns the number of type records
+   size_t NumberOfTypeRecords() const { return m_typeRecords.size(); }
+
+   /// returns the type record with given type index
+   std::optional<CodeViewRecord> TypeRecord(DWORD typeIndex) const;
+
+   /// returns the offset of a type record in the .debug$T section
+   size_t TypeRecordOffset(DWORD typeIndex) const;
+
+   /// returns if the types are stored in a PDB file, referenced by a
+   /// LF_TYPESERVER2 record
+   bool IsTypeServerReference() const;
+
+   /// returns the name of a symbol record, or an empty string when the
+   /// record has no name
+   static CString GetSymbolName(const CodeViewRecord& record);
+
+   /// returns the type index referenced by a symbol record, or 0 when the
+   /// record doesn't reference a type
+   static DWORD GetSymbolTypeIndex(const CodeViewRecord& record);
+
+   /// returns the name of a type record, or an empty string when the record
+   /// has no name
+   static CString GetTypeName(const CodeViewRecord& record);
+
+   /// formats a type index, with the name of the simple type or type record
+   CString FormatTypeIndex(DWORD typeIndex) const;
+
+   /// decodes the lines of all DEBUG_S_LINES subsections
+   std::vector<CodeViewLine> DecodeLines() const;
+
+   /// returns the file name for an offset into the file checksums subsection
+   CString GetFileName(DWORD fileChecksumOffset) const;
+
+private:
+   /// location of a symbol record
+   struct SymbolRecordLocation
+   {
+      /// pointer to the record length field
+      const BYTE* record;
+
+      /// index of the symbol section
+      size_t sectionIndex;
+   };
+
+   /// indexes the subsections and symbol records of a symbol section
+   void IndexSymbolSection(size_t sectionIndex);
+
+   /// indexes all type records
+   void IndexTypeSection();
+
+   /// decodes the lines of a single DEBUG_S_LINES subsection
+   void DecodeLineSubsection(size_t subsectionIndex, std::vector<CodeViewLine>& lines) const;
+
+   /// returns a record, given a pointer to the record length field
+   static CodeViewRecord GetRecord(const BYTE* record);
+
+private:
+   /// CodeView sections
+   CodeViewSections m_sections;
+
+   /// error text
+   CString m_errorText;
+
+   /// all debug subsections
+   std::vector<CodeViewSubsection> m_subsections;
+
+   /// locations of all symbol records
+   std::vector<SymbolRecordLocation> m_symbolRecords;
+
+   /// locations of all type records; indexed by type index minus 0x1000
+   std::vector<const BYTE*> m_typeRecords;
+
+   /// index of the file checksums subsection, if any
+   std::optional<size_t> m_fileChecksumsIndex;
+
+   /// index of the string table subsection, if any
+   std::optional<size_t> m_stringTableIndex;
+};
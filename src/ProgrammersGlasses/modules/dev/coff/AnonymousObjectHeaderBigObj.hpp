@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2023 Michael Fink
+// Copyright (c) 2023-2026 Michael Fink
 //
 /// \file AnonymousObjectHeaderBigObj.hpp
 /// \brief header definition of BigObj anonymous object files
@@ -32,5 +32,13 @@ static_assert(sizeof(AnonymousObjectHeaderBigObj) == 56,
 static_assert(sizeof(AnonymousObjectHeaderBigObj) == sizeof(ANON_OBJECT_HEADER_BIGOBJ),
    "BigObj Anonymous object header must have same size as ANON_OBJECT_HEADER");
 
+/// class ID of BigObj COFF objects, {D1BAA1C7-BAEE-4BA9-AF20-FAF66AA4DCB8}, as
+/// stored in the file; other anonymous objects with version 2 use other IDs
+constexpr BYTE c_bigObjClassID[16] =
+{
+   0xc7, 0xa1, 0xba, 0xd1, 0xee, 0xba, 0xa9, 0x4b,
+   0xaf, 0x20, 0xfa, 0xf6, 0x6a, 0xa4, 0xdc, 0xb8,
+};
+
 /// struct definition for BigObj Anonymous object header
 extern const StructDefinition g_definitionAnonymousObjectHeaderBigObj;
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020-2023 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file ArchiveFileNodeTreeBuilder.cpp
 /// \brief Node tree builder for archive files
@@ -13,14 +13,46 @@
 #include "FilterSortListViewNode.hpp"
 #include "StructListViewNode.hpp"
 #include "ArchiveHeader.hpp"
+#include "CoffHeader.hpp"
+#include "ImportObjectHeader.hpp"
+#include "CoffSymbolConflictAnalyzer.hpp"
+#include "CoffSectionSizeTree.hpp"
 #include "DisplayFormatHelper.hpp"
 #include "SymbolsHelper.hpp"
 #include "StringListIterator.hpp"
+#include "dev/elf/ElfHeader.hpp"
+#include "dev/macho/MachOImage.hpp"
+#include "dev/macho/MachONodeTreeBuilder.hpp"
+#include <execution>
+#include <mutex>
+#include <numeric>
+#include <unordered_map>
+
+/// \brief Reads a 32-bit or 64-bit word in given byte order
+static ULONGLONG ReadWord(const BYTE* data, size_t wordSize, bool littleEndian)
+{
+   if (wordSize == sizeof(DWORD))
+   {
+      DWORD value = *reinterpret_cast<const DWORD*>(data);
+      return littleEndian ? value : SwapEndianness(value);
+   }
+
+   ULONGLONG value = *reinterpret_cast<const ULONGLONG*>(data);
+   return littleEndian ? value : SwapEndianness(value);
+}
+
+/// \brief Returns if the data starts with an LLVM bitcode signature
+static bool IsLlvmBitcode(const BYTE* data, size_t size)
+{
+   return size >= 4 &&
+      data[0] == 'B' && data[1] == 'C' && data[2] == 0xC0 && data[3] == 0xDE;
+}
 
 ArchiveFileNodeTreeBuilder::ArchiveFileNodeTreeBuilder(
    const File& file, size_t fileOffset)
    :m_file(file),
-   m_fileOffset(fileOffset)
+   m_fileOffset(fileOffset),
+   m_memberIndex(file)
 {
 }
 
@@ -30,8 +62,6 @@ std::shared_ptr<INode> ArchiveFileNodeTreeBuilder::BuildArchiveFileNode()
       _T("Library Summary"),
       NodeTreeIconID::nodeTreeIconLibrary);
 
-   std::vector<std::vector<CString>> libraryArchiveMemberListData;
-
    const ArchiveHeader& archiveHeader =
       *m_file.Data<ArchiveHeader>();
 
@@ -45,183 +75,142 @@ std::shared_ptr<INode> ArchiveFileNodeTreeBuilder::BuildArchiveFileNode()
    archiveFileSummaryNode->ChildNodes().push_back(archiveHeaderNode);
 
    CString librarySummaryText;
-   librarySummaryText.Append(_T("COFF library file: ") + m_file.Filename());
+   librarySummaryText.Append(m_memberIndex.GetFormatDisplayText() + _T(": ") + m_file.Filename());
    librarySummaryText += _T("\n\n");
 
-   size_t archiveMemberOffset = sizeof(ArchiveHeader);
-
-   for (size_t archiveMemberIndex = 0; archiveMemberOffset < m_file.Size(); archiveMemberIndex++)
-   {
-      const ArchiveMemberHeader& archiveMemberHeader =
-         *m_file.Data<ArchiveMemberHeader>(archiveMemberOffset);
+   const std::vector<ArchiveMember>& archiveMembers = m_memberIndex.Members();
 
-      // add to list view data
-      CString archiveMemberName{ archiveMemberHeader.name, sizeof(archiveMemberHeader.name) };
-      CString dateText{ archiveMemberHeader.dateText, sizeof(archiveMemberHeader.dateText) };
-      CString userIDText{ archiveMemberHeader.userID, sizeof(archiveMemberHeader.userID) };
-      CString groupIDText{ archiveMemberHeader.groupID, sizeof(archiveMemberHeader.groupID) };
-      CString fileModeText{ archiveMemberHeader.mode, sizeof(archiveMemberHeader.mode) };
-      CString sizeText{ archiveMemberHeader.sizeText, sizeof(archiveMemberHeader.sizeText) };
+   // the member index is only read from here on, so that the archive members
+   // can be decoded in parallel; this speeds up archives with thousands of
+   // object files
+   std::vector<std::shared_ptr<CodeTextViewNode>> archiveMemberNodeList(archiveMembers.size());
+   std::vector<CString> archiveMemberSummaryList(archiveMembers.size());
+   std::vector<std::vector<CString>> libraryArchiveMemberListData(archiveMembers.size());
 
-      CString trimmedArchiveMemberName = archiveMemberName;
-      trimmedArchiveMemberName.Trim();
+   // import libraries contain thousands of short import objects; these get
+   // no node of their own, but are decoded in a single table instead
+   // note: std::vector<bool> can't be written from multiple threads
+   std::vector<char> importObjectMemberFlags(archiveMembers.size(), 0);
 
-      if (m_longnamesMapping.find(trimmedArchiveMemberName) != m_longnamesMapping.end())
+   std::for_each(std::execution::par, archiveMembers.begin(), archiveMembers.end(),
+      [&](const ArchiveMember& archiveMember)
       {
-         trimmedArchiveMemberName = m_longnamesMapping[trimmedArchiveMemberName];
-      }
-
-      userIDText.Trim();
-      groupIDText.Trim();
-      fileModeText.Trim();
-      sizeText.Trim();
-
-      time_t dateTime = _tcstoul(dateText, nullptr, 10);
-      CString formattedDateTime = DisplayFormatHelper::FormatDateTime(dateTime);
-
-      CString archiveMemberIndexText;
-      archiveMemberIndexText.Format(_T("%zu"), archiveMemberIndex);
-
-      libraryArchiveMemberListData.push_back(
-         std::vector<CString> {
-         archiveMemberIndexText,
-            trimmedArchiveMemberName,
-            formattedDateTime,
-            userIDText,
-            groupIDText,
-            fileModeText,
-            sizeText,
-      });
-
-      CString alternateArchiveMemberName;
-      if (trimmedArchiveMemberName != archiveMemberName)
-         alternateArchiveMemberName = _T("\nLong name: \"") + trimmedArchiveMemberName + _T("\"");
-
-      CString archiveMemberSummaryText;
-      archiveMemberSummaryText.AppendFormat(
-         _T("Archive member [%zu]: \"%s\"%s\n")
-         _T("Date: %s\n")
-         _T("User ID: %s\n")
-         _T("Group ID: %s\n")
-         _T("Mode: %s\n")
-         _T("Size: %s\n\n"),
-         archiveMemberIndex,
-         archiveMemberName.GetString(),
-         alternateArchiveMemberName.GetString(),
-         formattedDateTime.GetString(),
-         userIDText.GetString(),
-         groupIDText.GetString(),
-         fileModeText.GetString(),
-         sizeText.GetString());
-
-      // add a node for each archive member
-      auto archiveMemberNode = std::make_shared<CodeTextViewNode>(
-         _T("Archive member: ") + trimmedArchiveMemberName,
-         NodeTreeIconID::nodeTreeIconDocument);
-
-      archiveFileSummaryNode->ChildNodes().push_back(archiveMemberNode);
-
-      auto archiveMemberHeaderNode = std::make_shared<StructListViewNode>(
-         _T("Archive member header"),
-         NodeTreeIconID::nodeTreeIconBinary,
-         g_definitionArchiveMemberHeader,
-         &archiveMemberHeader,
-         m_file.Data());
-
-      archiveMemberNode->ChildNodes().push_back(archiveMemberHeaderNode);
-
-      if (archiveMemberHeader.endOfHeader[0] != 0x60 &&
-         archiveMemberHeader.endOfHeader[1] != 0x0a)
-         break;
-
-      librarySummaryText.AppendFormat(_T("%s: "),
-         trimmedArchiveMemberName.GetString());
-
-      // add archive member
-      size_t archiveMemberStart = archiveMemberOffset + sizeof(ArchiveMemberHeader);
-      size_t archiveMemberSize = _ttol(sizeText);
-
-      // note: the first two are the linker members
-      if (archiveMemberIndex < 2 && trimmedArchiveMemberName == _T("/"))
-      {
-         CString linkerMemberSummary;
-         AddArchiveLinkerMember(
-            *archiveMemberNode,
-            archiveMemberIndex,
-            archiveMemberStart,
-            archiveMemberSize,
-            linkerMemberSummary);
-
-         archiveMemberSummaryText += linkerMemberSummary;
-
-         IndentText(linkerMemberSummary, 3);
-         linkerMemberSummary.TrimLeft();
-         librarySummaryText += linkerMemberSummary + _T("\n");
-      }
-      else if (archiveMemberIndex >= 2)
-      {
-         // add COFF object / anonymous object
-         if (NonCoffObjectNodeTreeBuilder::IsNonCoffOrAnonymousObjectFile(
-            m_file, archiveMemberStart))
+         const ArchiveMemberHeader& archiveMemberHeader =
+            *m_file.Data<ArchiveMemberHeader>(archiveMember.headerOffset);
+
+         // add to list view data
+         CString archiveMemberName{ archiveMemberHeader.name, sizeof(archiveMemberHeader.name) };
+         CString dateText{ archiveMemberHeader.dateText, sizeof(archiveMemberHeader.dateText) };
+         CString userIDText{ archiveMemberHeader.userID, sizeof(archiveMemberHeader.userID) };
+         CString groupIDText{ archiveMemberHeader.groupID, sizeof(archiveMemberHeader.groupID) };
+         CString fileModeText{ archiveMemberHeader.mode, sizeof(archiveMemberHeader.mode) };
+         CString sizeText{ archiveMemberHeader.sizeText, sizeof(archiveMemberHeader.sizeText) };
+
+         const CString& trimmedArchiveMemberName = archiveMember.name;
+
+         userIDText.Trim();
+         groupIDText.Trim();
+         fileModeText.Trim();
+         sizeText.Trim();
+
+         time_t dateTime = _tcstoul(dateText, nullptr, 10);
+         CString formattedDateTime = DisplayFormatHelper::FormatDateTime(dateTime);
+
+         CString archiveMemberIndexText;
+         archiveMemberIndexText.Format(_T("%zu"), archiveMember.index);
+
+         libraryArchiveMemberListData[archiveMember.index] =
+            std::vector<CString> {
+            archiveMemberIndexText,
+               trimmedArchiveMemberName,
+               formattedDateTime,
+               userIDText,
+               groupIDText,
+               fileModeText,
+               sizeText,
+         };
+
+         if (IsImportObjectMember(archiveMember))
          {
-            NonCoffObjectNodeTreeBuilder nodeTreeBuilder{ m_file, archiveMemberStart };
-            auto nonCoffSummaryNode = nodeTreeBuilder.BuildNonCoffObjectNode();
-            CString objectFileSummary = nodeTreeBuilder.GetObjectFileSummary();
-
-            archiveMemberSummaryText += objectFileSummary;
-
-            IndentText(objectFileSummary, 3);
-            objectFileSummary.TrimLeft();
-            librarySummaryText += objectFileSummary + _T("\n");
-
-            archiveMemberNode->ChildNodes().push_back(nonCoffSummaryNode);
-         }
-         else if (archiveMemberIndex == 2 && trimmedArchiveMemberName == _T("//"))
-         {
-            CString linkerMemberSummary;
-            AddArchiveLongnamesMember(
-               *archiveMemberNode,
-               archiveMemberStart,
-               archiveMemberSize,
-               linkerMemberSummary,
-               m_longnamesMapping);
-
-            archiveMemberSummaryText += linkerMemberSummary;
-
-            IndentText(linkerMemberSummary, 3);
-            linkerMemberSummary.TrimLeft();
-            librarySummaryText += linkerMemberSummary + _T("\n");
+            importObjectMemberFlags[archiveMember.index] = true;
+            return;
          }
+
+         CString alternateArchiveMemberName;
+         if (trimmedArchiveMemberName != archiveMember.rawName)
+            alternateArchiveMemberName = _T("\nLong name: \"") + trimmedArchiveMemberName + _T("\"");
+
+         CString archiveMemberSummaryText;
+         archiveMemberSummaryText.AppendFormat(
+            _T("Archive member [%zu]: \"%s\"%s\n")
+            _T("Date: %s\n")
+            _T("User ID: %s\n")
+            _T("Group ID: %s\n")
+            _T("Mode: %s\n")
+            _T("Size: %s\n\n"),
+            archiveMember.index,
+            archiveMemberName.GetString(),
+            alternateArchiveMemberName.GetString(),
+            formattedDateTime.GetString(),
+            userIDText.GetString(),
+            groupIDText.GetString(),
+            fileModeText.GetString(),
+            sizeText.GetString());
+
+         // add a node for each archive member
+         auto archiveMemberNode = std::make_shared<CodeTextViewNode>(
+            _T("Archive member: ") + trimmedArchiveMemberName,
+            NodeTreeIconID::nodeTreeIconDocument);
+
+         auto archiveMemberHeaderNode = std::make_shared<StructListViewNode>(
+            _T("Archive member header"),
+            NodeTreeIconID::nodeTreeIconBinary,
+            g_definitionArchiveMemberHeader,
+            &archiveMemberHeader,
+            m_file.Data());
+
+         archiveMemberNode->ChildNodes().push_back(archiveMemberHeaderNode);
+
+         CString memberSummary;
+         if (archiveMember.kind == ArchiveMemberKind::object)
+            AddObjectMember(*archiveMemberNode, archiveMember, memberSummary);
          else
-         {
-            CoffObjectNodeTreeBuilder nodeTreeBuilder{
-               m_file, archiveMemberStart, false };
+            AddArchiveLinkerMember(*archiveMemberNode, archiveMember, memberSummary);
 
-            auto coffSummaryNode = nodeTreeBuilder.BuildCoffObjectNode();
-            CString objectFileSummary = nodeTreeBuilder.GetObjectFileSummary();
+         archiveMemberSummaryText += memberSummary;
 
-            archiveMemberSummaryText += objectFileSummary;
+         IndentText(memberSummary, 3);
+         memberSummary.TrimLeft();
 
-            IndentText(objectFileSummary, 3);
-            objectFileSummary.TrimLeft();
-            librarySummaryText += objectFileSummary + _T("\n");
+         archiveMemberNode->SetText(archiveMemberSummaryText);
 
-            archiveMemberNode->ChildNodes().push_back(coffSummaryNode);
-         }
-      }
+         archiveMemberNodeList[archiveMember.index] = archiveMemberNode;
+         archiveMemberSummaryList[archiveMember.index] =
+            trimmedArchiveMemberName + _T(": ") + memberSummary + _T("\n");
+      });
 
-      archiveMemberNode->SetText(archiveMemberSummaryText);
+   std::vector<const ArchiveMember*> importObjectMembers;
 
-      // advance to next header
-      archiveMemberOffset += sizeof(ArchiveMemberHeader) + archiveMemberSize;
+   for (size_t archiveMemberIndex = 0; archiveMemberIndex < archiveMembers.size(); archiveMemberIndex++)
+   {
+      if (importObjectMemberFlags[archiveMemberIndex])
+      {
+         importObjectMembers.push_back(&archiveMembers[archiveMemberIndex]);
+         continue;
+      }
 
-      // ensure 2-byte alignment
-      if ((archiveMemberOffset & 1) != 0)
-         archiveMemberOffset++;
+      archiveFileSummaryNode->ChildNodes().push_back(archiveMemberNodeList[archiveMemberIndex]);
 
+      librarySummaryText += archiveMemberSummaryList[archiveMemberIndex];
       librarySummaryText += _T("\n");
    }
 
+   if (!m_memberIndex.GetErrorText().IsEmpty())
+   {
+      librarySummaryText.AppendFormat(_T("Error: %s\n"),
+         m_memberIndex.GetErrorText().GetString());
+   }
+
    static std::vector<CString> libraryArchiveMemberListColumnNames
    {
       _T("Index"),
@@ -244,33 +233,84 @@ std::shared_ptr<INode> ArchiveFileNodeTreeBuilder::BuildArchiveFileNode()
       archiveFileSummaryNode->ChildNodes().begin() + 1,
       libraryArchiveMemberListNode);
 
-   archiveFileSummaryNode->SetText(librarySummaryText);
+   CodeTextViewNode::TextProvider duplicateMembersSummaryProvider =
+      AddDuplicateMembersNode(*archiveFileSummaryNode);
+
+   AddSymbolConflictsNode(*archiveFileSummaryNode);
+
+   AddSectionSizesNode(*archiveFileSummaryNode, librarySummaryText);
+
+   if (!importObjectMembers.empty())
+   {
+      librarySummaryText.AppendFormat(_T("Import objects: %zu\n"),
+         importObjectMembers.size());
+
+      archiveFileSummaryNode->ChildNodes().insert(
+         archiveFileSummaryNode->ChildNodes().begin() + 2,
+         CreateImportObjectTableNode(importObjectMembers));
+   }
+
+   // the duplicate members summary line needs all members to be hashed, so
+   // the summary text is completed when it is shown
+   if (duplicateMembersSummaryProvider != nullptr)
+   {
+      archiveFileSummaryNode->SetTextProvider(
+         [librarySummaryText, duplicateMembersSummaryProvider]()
+         {
+            return librarySummaryText + duplicateMembersSummaryProvider();
+         });
+   }
+   else
+      archiveFileSummaryNode->SetText(librarySummaryText);
 
    return archiveFileSummaryNode;
 }
 
 void ArchiveFileNodeTreeBuilder::AddArchiveLinkerMember(StaticNode& archiveMemberNode,
-   size_t archiveMemberIndex, size_t fileOffset, size_t linkerMemberSize,
+   const ArchiveMember& archiveMember,
    CString& linkerMemberSummary) const
 {
-   if (archiveMemberIndex == 0)
+   switch (archiveMember.kind)
    {
-      AddFirstLinkerMemberNode(archiveMemberNode, fileOffset, linkerMemberSize,
+   case ArchiveMemberKind::firstLinkerMember:
+      AddFirstLinkerMemberNode(archiveMemberNode, archiveMember.dataOffset, archiveMember.dataSize,
+         sizeof(DWORD), linkerMemberSummary);
+      break;
+
+   case ArchiveMemberKind::secondLinkerMember:
+      AddSecondLinkerMemberNode(archiveMemberNode, archiveMember.dataOffset, archiveMember.dataSize,
          linkerMemberSummary);
-   }
-   else if (archiveMemberIndex == 1)
-   {
-      AddSecondLinkerMemberNode(archiveMemberNode, fileOffset, linkerMemberSize,
+      break;
+
+   case ArchiveMemberKind::symbolTable64:
+      AddFirstLinkerMemberNode(archiveMemberNode, archiveMember.dataOffset, archiveMember.dataSize,
+         sizeof(ULONGLONG), linkerMemberSummary);
+      break;
+
+   case ArchiveMemberKind::bsdSymbolTable:
+   case ArchiveMemberKind::bsdSymbolTable64:
+      AddBsdSymbolTableNode(archiveMemberNode, archiveMember.dataOffset, archiveMember.dataSize,
+         archiveMember.kind == ArchiveMemberKind::bsdSymbolTable64 ? sizeof(ULONGLONG) : sizeof(DWORD),
+         linkerMemberSummary);
+      break;
+
+   case ArchiveMemberKind::longnames:
+      AddArchiveLongnamesMember(archiveMemberNode, archiveMember.dataOffset, archiveMember.dataSize,
          linkerMemberSummary);
+      break;
+
+   default:
+      ATLASSERT(false);
+      break;
    }
 }
 
 void ArchiveFileNodeTreeBuilder::AddFirstLinkerMemberNode(StaticNode& archiveMemberNode,
-   size_t fileOffset, size_t linkerMemberSize,
+   size_t fileOffset, size_t linkerMemberSize, size_t offsetSize,
    CString& linkerMemberSummary) const
 {
-   const DWORD* firstLinkerMember =
-      m_file.Data<DWORD>(fileOffset);
+   const BYTE* firstLinkerMember =
+      m_file.Data<BYTE>(fileOffset);
 
    if (!m_file.IsValidRange(firstLinkerMember, linkerMemberSize))
    {
@@ -280,21 +320,36 @@ void ArchiveFileNodeTreeBuilder::AddFirstLinkerMemberNode(StaticNode& archiveMem
       return;
    }
 
+   // all values are stored in big-endian byte order
+   ULONGLONG numSymbols = linkerMemberSize < offsetSize ? 0 :
+      ReadWord(firstLinkerMember, offsetSize, false);
+
+   if (linkerMemberSize < offsetSize ||
+      numSymbols > (linkerMemberSize - offsetSize) / offsetSize)
+   {
+      linkerMemberSummary += _T("Error: Number of symbols exceeds the linker member size!");
+      return;
+   }
+
    std::vector<std::vector<CString>> firstArchiveMemberListData;
 
-   DWORD numSymbolsBigEndian = *(firstLinkerMember++);
-   DWORD numSymbols = SwapEndianness(numSymbolsBigEndian);
+   bool isMicrosoftFormat = m_memberIndex.Format() == ArchiveFormat::microsoft;
 
    linkerMemberSummary.AppendFormat(
-      _T("First linker member, containing %u symbols"), numSymbols);
+      isMicrosoftFormat
+      ? _T("First linker member, containing %llu symbols")
+      : _T("Symbol table, containing %llu symbols"),
+      numSymbols);
+
+   size_t symbolTableSize = offsetSize + static_cast<size_t>(numSymbols) * offsetSize;
 
    StringListIterator iter{
       m_file,
-      fileOffset + numSymbols * 4 + 4,
-      linkerMemberSize - numSymbols * 4 - 4,
+      fileOffset + symbolTableSize,
+      linkerMemberSize - symbolTableSize,
       false };
 
-   for (DWORD symbolIndex = 0; symbolIndex < numSymbols; symbolIndex++)
+   for (size_t symbolIndex = 0; symbolIndex < numSymbols; symbolIndex++)
    {
       if (iter.IsAtEnd())
       {
@@ -303,14 +358,16 @@ void ArchiveFileNodeTreeBuilder::AddFirstLinkerMemberNode(StaticNode& archiveMem
          break;
       }
 
-      DWORD offsetBigEndian = firstLinkerMember[symbolIndex];
-      DWORD offset = SwapEndianness(offsetBigEndian);
+      ULONGLONG offset = ReadWord(
+         firstLinkerMember + offsetSize + symbolIndex * offsetSize,
+         offsetSize,
+         false);
 
       CString symbolIndexText;
-      symbolIndexText.Format(_T("%u"), symbolIndex);
+      symbolIndexText.Format(_T("%zu"), symbolIndex);
 
       CString symbolOffsetText;
-      symbolOffsetText.Format(_T("0x%08x"), offset);
+      symbolOffsetText.Format(_T("0x%08llx"), offset);
 
       CString symbolTableText = iter.Current();
 
@@ -318,6 +375,7 @@ void ArchiveFileNodeTreeBuilder::AddFirstLinkerMemberNode(StaticNode& archiveMem
          std::vector<CString> {
          symbolIndexText,
             symbolOffsetText,
+            GetMemberNameByHeaderOffset(offset),
             symbolTableText,
             SymbolsHelper::UndecorateSymbol(symbolTableText),
       });
@@ -329,12 +387,13 @@ void ArchiveFileNodeTreeBuilder::AddFirstLinkerMemberNode(StaticNode& archiveMem
    {
       _T("Index"),
       _T("Offset"),
+      _T("Archive member"),
       _T("Symbol name"),
       _T("Undecorated symbol name"),
    };
 
    auto firstLinkerMemberSymbolsNode = std::make_shared<FilterSortListViewNode>(
-      _T("First Linker Member Symbols"),
+      isMicrosoftFormat ? _T("First Linker Member Symbols") : _T("Symbol Table"),
       NodeTreeIconID::nodeTreeIconTable,
       firstArchiveMemberListColumnNames,
       firstArchiveMemberListData,
@@ -364,7 +423,17 @@ void ArchiveFileNodeTreeBuilder::AddSecondLinkerMemberNode(StaticNode& archiveMe
    // member table
    std::vector<std::vector<CString>> secondLinkerMemberTableListData;
 
-   DWORD numMembers = *(secondLinkerMember++);
+   // the member offsets are followed by the number of symbols
+   DWORD numMembers = linkerMemberSize < 2 * sizeof(DWORD) ? 0 : *secondLinkerMember;
+
+   if (linkerMemberSize < 2 * sizeof(DWORD) ||
+      numMembers > (linkerMemberSize - 2 * sizeof(DWORD)) / sizeof(DWORD))
+   {
+      linkerMemberSummary += _T("Error: Number of members exceeds the linker member size!");
+      return;
+   }
+
+   secondLinkerMember++;
    const DWORD* memberIndexStart = secondLinkerMember;
 
    for (DWORD memberIndex = 0; memberIndex < numMembers; memberIndex++)
@@ -379,6 +448,7 @@ void ArchiveFileNodeTreeBuilder::AddSecondLinkerMemberNode(StaticNode& archiveMe
          std::vector<CString> {
          memberIndexText,
             memberOffsetText,
+            GetMemberNameByHeaderOffset(memberIndexStart[memberIndex]),
       });
    }
 
@@ -386,6 +456,7 @@ void ArchiveFileNodeTreeBuilder::AddSecondLinkerMemberNode(StaticNode& archiveMe
    {
       _T("Index"),
       _T("Member offset"),
+      _T("Archive member"),
    };
 
    auto secondLinkerMemberTableNode = std::make_shared<FilterSortListViewNode>(
@@ -404,6 +475,15 @@ void ArchiveFileNodeTreeBuilder::AddSecondLinkerMemberNode(StaticNode& archiveMe
 
    DWORD numSymbols = *(secondLinkerMember++);
 
+   size_t remainingMemberSize =
+      endOfSymbolTableText - reinterpret_cast<const CHAR*>(secondLinkerMember);
+
+   if (numSymbols > remainingMemberSize / sizeof(WORD))
+   {
+      linkerMemberSummary += _T("Error: Number of symbols exceeds the linker member size!");
+      return;
+   }
+
    const WORD* mapIndexStart =
       reinterpret_cast<const WORD*>(secondLinkerMember);
 
@@ -413,6 +493,16 @@ void ArchiveFileNodeTreeBuilder::AddSecondLinkerMemberNode(StaticNode& archiveMe
 
    for (DWORD symbolIndex = 0; symbolIndex < numSymbols; symbolIndex++)
    {
+      size_t remainingSize =
+         endOfSymbolTableText - symbolTableText;
+
+      if (remainingSize == 0)
+      {
+         linkerMemberSummary +=
+            _T("Error: Symbol table ended before iterating all symbols!\n");
+         break;
+      }
+
       WORD mapIndex = mapIndexStart[symbolIndex];
 
       CString symbolIndexText;
@@ -421,18 +511,19 @@ void ArchiveFileNodeTreeBuilder::AddSecondLinkerMemberNode(StaticNode& archiveMe
       CString mapIndexText;
       mapIndexText.Format(_T("0x%04x"), mapIndex);
 
+      size_t symbolLength = strnlen(symbolTableText, remainingSize);
+
+      CString symbolText{ symbolTableText, static_cast<int>(symbolLength) };
+
       secondLinkerMemberSymbolsListData.push_back(
          std::vector<CString> {
          symbolIndexText,
             mapIndexText,
-            symbolTableText,
-            SymbolsHelper::UndecorateSymbol(symbolTableText),
+            symbolText,
+            SymbolsHelper::UndecorateSymbol(symbolText),
       });
 
-      size_t remainingSize =
-         endOfSymbolTableText - symbolTableText;
-
-      symbolTableText += strnlen(symbolTableText, remainingSize) + 1;
+      symbolTableText += std::min(symbolLength + 1, remainingSize);
    }
 
    static std::vector<CString> secondLinkerMemberSymbolsListColumnNames
@@ -458,33 +549,148 @@ void ArchiveFileNodeTreeBuilder::AddSecondLinkerMemberNode(StaticNode& archiveMe
       numSymbols);
 }
 
+void ArchiveFileNodeTreeBuilder::AddBsdSymbolTableNode(StaticNode& archiveMemberNode,
+   size_t fileOffset, size_t linkerMemberSize, size_t wordSize,
+   CString& linkerMemberSummary) const
+{
+   const BYTE* symbolTable = m_file.Data<BYTE>(fileOffset);
+
+   if (!m_file.IsValidRange(symbolTable, linkerMemberSize) ||
+      linkerMemberSize < 2 * wordSize)
+   {
+      linkerMemberSummary.AppendFormat(
+         _T("Error: Symbol table size #%zu is invalid!"),
+         linkerMemberSize);
+      return;
+   }
+
+   // the symbol table is stored in the byte order of the archived object
+   // files; usually little-endian
+   bool littleEndian = true;
+   ULONGLONG ranlibSize = ReadWord(symbolTable, wordSize, littleEndian);
+   if (ranlibSize > linkerMemberSize - 2 * wordSize)
+   {
+      littleEndian = false;
+      ranlibSize = ReadWord(symbolTable, wordSize, littleEndian);
+   }
+
+   if (ranlibSize > linkerMemberSize - 2 * wordSize)
+   {
+      linkerMemberSummary += _T("Error: Symbol table entries exceed the symbol table size!");
+      return;
+   }
+
+   // each ranlib entry consists of the string table offset of the symbol
+   // name, and the archive member header offset
+   size_t ranlibEntrySize = 2 * wordSize;
+   size_t numSymbols = static_cast<size_t>(ranlibSize) / ranlibEntrySize;
+
+   const BYTE* ranlibEntries = symbolTable + wordSize;
+   const BYTE* stringTable = ranlibEntries + ranlibSize + wordSize;
+
+   size_t maxStringTableSize = linkerMemberSize - 2 * wordSize - static_cast<size_t>(ranlibSize);
+   size_t stringTableSize = static_cast<size_t>(std::min<ULONGLONG>(
+      ReadWord(ranlibEntries + ranlibSize, wordSize, littleEndian),
+      maxStringTableSize));
+
+   std::vector<std::vector<CString>> symbolTableListData;
+
+   for (size_t symbolIndex = 0; symbolIndex < numSymbols; symbolIndex++)
+   {
+      const BYTE* ranlibEntry = ranlibEntries + symbolIndex * ranlibEntrySize;
+
+      ULONGLONG stringOffset = ReadWord(ranlibEntry, wordSize, littleEndian);
+      ULONGLONG memberOffset = ReadWord(ranlibEntry + wordSize, wordSize, littleEndian);
+
+      CString symbolText;
+      if (stringOffset < stringTableSize)
+      {
+         const CHAR* symbolName = reinterpret_cast<const CHAR*>(stringTable + stringOffset);
+         symbolText = CString{ symbolName,
+            static_cast<int>(strnlen(symbolName, stringTableSize - static_cast<size_t>(stringOffset))) };
+      }
+
+      CString symbolIndexText;
+      symbolIndexText.Format(_T("%zu"), symbolIndex);
+
+      CString symbolOffsetText;
+      symbolOffsetText.Format(_T("0x%08llx"), memberOffset);
+
+      symbolTableListData.push_back(
+         std::vector<CString> {
+         symbolIndexText,
+            symbolOffsetText,
+            GetMemberNameByHeaderOffset(memberOffset),
+            symbolText,
+            SymbolsHelper::UndecorateSymbol(symbolText),
+      });
+   }
+
+   static std::vector<CString> symbolTableListColumnNames
+   {
+      _T("Index"),
+      _T("Offset"),
+      _T("Archive member"),
+      _T("Symbol name"),
+      _T("Undecorated symbol name"),
+   };
+
+   auto symbolTableNode = std::make_shared<FilterSortListViewNode>(
+      _T("Symbol Table"),
+      NodeTreeIconID::nodeTreeIconTable,
+      symbolTableListColumnNames,
+      symbolTableListData,
+      true);
+
+   archiveMemberNode.ChildNodes().push_back(symbolTableNode);
+
+   linkerMemberSummary.AppendFormat(
+      _T("BSD symbol table, %s, containing %zu symbols"),
+      wordSize == sizeof(ULONGLONG) ? _T("64-bit") : _T("32-bit"),
+      numSymbols);
+}
+
 void ArchiveFileNodeTreeBuilder::AddArchiveLongnamesMember(StaticNode& archiveMemberNode,
    size_t fileOffset,
    size_t linkerMemberSize,
-   CString& linkerMemberSummary,
-   std::map<CString, CString>& longnamesMapping) const
+   CString& linkerMemberSummary) const
 {
    std::vector<std::vector<CString>> longnamesMemberSymbolsListData;
 
-   StringListIterator iter{
-      m_file,
-      fileOffset,
-      linkerMemberSize,
-      false };
+   // Microsoft longnames are zero-terminated, System V / GNU longnames are
+   // terminated by "/\n"
+   const CHAR* longnames = m_file.Data<CHAR>(fileOffset);
 
    DWORD numSymbols = 0;
 
-   for (; !iter.IsAtEnd(); iter.Next(), numSymbols++)
+   for (size_t offset = 0; offset < linkerMemberSize; )
    {
+      size_t length = 0;
+      while (offset + length < linkerMemberSize &&
+         longnames[offset + length] != 0 &&
+         longnames[offset + length] != '\n')
+         length++;
+
+      // skip padding and empty entries
+      if (length == 0)
+      {
+         offset++;
+         continue;
+      }
+
+      size_t nameLength = length;
+      if (offset + length < linkerMemberSize &&
+         longnames[offset + length] == '\n' &&
+         longnames[offset + length - 1] == '/')
+         nameLength--;
+
       CString stringIndexText;
       stringIndexText.Format(_T("%u"), numSymbols);
 
-      size_t offset = iter.Offset() - fileOffset;
-
       CString stringOffsetText;
       stringOffsetText.Format(_T("/%zu"), offset);
 
-      CString stringTableText = iter.Current();
+      CString stringTableText{ longnames + offset, static_cast<int>(nameLength) };
 
       longnamesMemberSymbolsListData.push_back(
          std::vector<CString> {
@@ -493,7 +699,8 @@ void ArchiveFileNodeTreeBuilder::AddArchiveLongnamesMember(StaticNode& archiveMe
             stringTableText,
       });
 
-      longnamesMapping.insert(std::make_pair(stringOffsetText, stringTableText));
+      offset += length + 1;
+      numSymbols++;
    }
 
    static std::vector<CString> longnamesMemberSymbolsListColumnNames
@@ -516,3 +723,568 @@ void ArchiveFileNodeTreeBuilder::AddArchiveLongnamesMember(StaticNode& archiveMe
       _T("Longnames member, containing %u strings"),
       numSymbols);
 }
+
+void ArchiveFileNodeTreeBuilder::AddObjectMember(StaticNode& archiveMemberNode,
+   const ArchiveMember& archiveMember,
+   CString& objectFileSummary) const
+{
+   if (archiveMember.isExternal)
+   {
+      objectFileSummary.AppendFormat(
+         _T("Thin archive member, stored in external file \"%s\" with %zu bytes\n"),
+         archiveMember.name.GetString(),
+         archiveMember.dataSize);
+      return;
+   }
+
+   const BYTE* data = m_file.Data<BYTE>(archiveMember.dataOffset);
+
+   if (NonCoffObjectNodeTreeBuilder::IsNonCoffOrAnonymousObjectFile(
+      m_file, archiveMember.dataOffset))
+   {
+      // add anonymous object
+      NonCoffObjectNodeTreeBuilder nodeTreeBuilder{ m_file, archiveMember.dataOffset };
+      archiveMemberNode.ChildNodes().push_back(nodeTreeBuilder.BuildNonCoffObjectNode());
+      objectFileSummary += nodeTreeBuilder.GetObjectFileSummary();
+   }
+   else if (archiveMember.dataSize >= 4 &&
+      data[0] == 0x7F && data[1] == 'E' && data[2] == 'L' && data[3] == 'F')
+   {
+      AddElfObjectMember(archiveMemberNode, archiveMember, objectFileSummary);
+   }
+   else if (MachOImage::IsMachOImage(data, archiveMember.dataSize))
+   {
+      auto image = std::make_shared<MachOImage>(m_file, archiveMember.dataOffset, archiveMember.dataSize);
+
+      objectFileSummary += _T("Mach-O object file\n");
+
+      MachONodeTreeBuilder nodeTreeBuilder{ image };
+      nodeTreeBuilder.AddImageNodes(archiveMemberNode, objectFileSummary);
+   }
+   else if (IsLlvmBitcode(data, archiveMember.dataSize))
+   {
+      objectFileSummary += _T("LLVM bitcode file\n");
+   }
+   else if (m_memberIndex.Format() == ArchiveFormat::microsoft ||
+      IsCoffObjectMember(archiveMember))
+   {
+      // add COFF object
+      CoffObjectNodeTreeBuilder nodeTreeBuilder{
+         m_file, archiveMember.dataOffset, false };
+
+      archiveMemberNode.ChildNodes().push_back(nodeTreeBuilder.BuildCoffObjectNode());
+      objectFileSummary += nodeTreeBuilder.GetObjectFileSummary();
+   }
+   else
+   {
+      objectFileSummary.AppendFormat(_T("Unknown archive member content, %zu bytes\n"),
+         archiveMember.dataSize);
+   }
+}
+
+void ArchiveFileNodeTreeBuilder::AddElfObjectMember(StaticNode& archiveMemberNode,
+   const ArchiveMember& archiveMember,
+   CString& objectFileSummary) const
+{
+   const BYTE* data = m_file.Data<BYTE>(archiveMember.dataOffset);
+
+   if (archiveMember.dataSize < sizeof(Elf32Header))
+   {
+      objectFileSummary += _T("Error: ELF header is outside of the archive member\n");
+      return;
+   }
+
+   // the ELF class and data encoding are stored in the identification bytes
+   bool is64Bit = data[4] == 2;
+   bool isLittleEndian = data[5] == 1;
+
+   if (is64Bit && archiveMember.dataSize < sizeof(Elf64Header))
+   {
+      objectFileSummary += _T("Error: ELF header is outside of the archive member\n");
+      return;
+   }
+
+   archiveMemberNode.ChildNodes().push_back(
+      std::make_shared<StructListViewNode>(
+         is64Bit ? _T("ELF header (ELF64)") : _T("ELF header (ELF32)"),
+         NodeTreeIconID::nodeTreeIconBinary,
+         GetElfHeaderDefinition(is64Bit, isLittleEndian),
+         data,
+         m_file.Data()));
+
+   // type and machine are at the same offsets for both classes
+   const Elf32Header& header = *reinterpret_cast<const Elf32Header*>(data);
+
+   WORD type = isLittleEndian ? header.type : SwapEndianness(header.type);
+   WORD machine = isLittleEndian ? header.machine : SwapEndianness(header.machine);
+
+   objectFileSummary.AppendFormat(
+      _T("ELF object file, %s, %s\n")
+      _T("Type: %s\n")
+      _T("Machine: %s\n"),
+      is64Bit ? _T("ELF64") : _T("ELF32"),
+      isLittleEndian ? _T("little-endian") : _T("big-endian"),
+      GetValueFromMapOrDefault<DWORD>(g_mapElfTypeToDisplayText, type, _T("unknown")),
+      GetValueFromMapOrDefault<DWORD>(g_mapElfMachineToDisplayText, machine, _T("unknown")));
+}
+
+bool ArchiveFileNodeTreeBuilder::IsCoffObjectMember(const ArchiveMember& archiveMember) const
+{
+   // COFF has no magic number; check for a known target machine, e.g. for
+   // GNU archives created by MinGW
+   if (archiveMember.dataSize < sizeof(CoffHeader))
+      return false;
+
+   const CoffHeader& header = *m_file.Data<CoffHeader>(archiveMember.dataOffset);
+
+   return header.targetMachine != IMAGE_FILE_MACHINE_UNKNOWN &&
+      g_mapCoffTargetMachineToDisplayText.find(header.targetMachine) != g_mapCoffTargetMachineToDisplayText.end() &&
+      header.offsetSymbolTable <= archiveMember.dataSize;
+}
+
+CodeTextViewNode::TextProvider ArchiveFileNodeTreeBuilder::AddDuplicateMembersNode(
+   StaticNode& archiveFileNode) const
+{
+   std::vector<DuplicateMemberCandidate> candidates;
+
+   for (const ArchiveMember& archiveMember : m_memberIndex.Members())
+   {
+      if (archiveMember.kind == ArchiveMemberKind::object &&
+         !archiveMember.isExternal &&
+         archiveMember.dataSize > 0)
+      {
+         candidates.push_back(DuplicateMemberCandidate{
+            archiveMember.index,
+            archiveMember.name,
+            archiveMember.dataOffset,
+            archiveMember.dataSize });
+      }
+   }
+
+   if (candidates.size() < 2)
+      return nullptr;
+
+   /// duplicate members, found when one of the nodes is shown the first time
+   struct LazyDuplicateMembers
+   {
+      std::once_flag onceFlag;
+      const File* file = nullptr;
+      std::vector<DuplicateMemberCandidate> candidates;
+      DuplicateMembers duplicateMembers;
+
+      /// finds the duplicate members on first call
+      const DuplicateMembers& Get()
+      {
+         std::call_once(onceFlag,
+            [this]()
+            {
+               duplicateMembers = FindDuplicateMembers(*file, candidates);
+               candidates.clear();
+            });
+
+         return duplicateMembers;
+      }
+   };
+
+   auto lazyDuplicateMembers = std::make_shared<LazyDuplicateMembers>();
+   lazyDuplicateMembers->file = &m_file;
+   lazyDuplicateMembers->candidates = std::move(candidates);
+
+   // hashing reads all members, so it is only done when the nodes are shown
+   auto duplicateMembersNode = std::make_shared<CodeTextViewNode>(
+      _T("Duplicate Archive Members"),
+      NodeTreeIconID::nodeTreeIconDocument,
+      [lazyDuplicateMembers]()
+      {
+         const DuplicateMembers& duplicateMembers = lazyDuplicateMembers->Get();
+
+         CString text;
+         text.Format(
+            _T("Duplicate archive members: %zu, in %zu groups of identical members\n")
+            _T("Wasted bytes: %llu\n"),
+            duplicateMembers.numberOfDuplicates,
+            duplicateMembers.numberOfGroups,
+            duplicateMembers.wastedBytes);
+
+         return text;
+      });
+
+   static std::vector<CString> duplicateMembersListColumnNames
+   {
+      _T("Group"),
+      _T("Index"),
+      _T("Archive member"),
+      _T("Size"),
+      _T("Hash"),
+   };
+
+   duplicateMembersNode->ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Duplicate Members List"),
+         NodeTreeIconID::nodeTreeIconTable,
+         duplicateMembersListColumnNames,
+         [lazyDuplicateMembers]()
+         {
+            return lazyDuplicateMembers->Get().listData;
+         },
+         true));
+
+   archiveFileNode.ChildNodes().insert(
+      archiveFileNode.ChildNodes().begin() + 2,
+      duplicateMembersNode);
+
+   return [lazyDuplicateMembers]()
+   {
+      const DuplicateMembers& duplicateMembers = lazyDuplicateMembers->Get();
+
+      CString text;
+      text.Format(_T("Duplicate archive members: %zu, wasting %llu bytes\n"),
+         duplicateMembers.numberOfDuplicates,
+         duplicateMembers.wastedBytes);
+
+      return text;
+   };
+}
+
+ArchiveFileNodeTreeBuilder::DuplicateMembers ArchiveFileNodeTreeBuilder::FindDuplicateMembers(
+   const File& file, const std::vector<DuplicateMemberCandidate>& candidates)
+{
+   // only members with the same size can be identical, so members with a
+   // unique size don't need to be hashed at all
+   std::unordered_map<size_t, size_t> numberOfMembersBySize;
+   for (const DuplicateMemberCandidate& candidate : candidates)
+      numberOfMembersBySize[candidate.dataSize]++;
+
+   std::vector<const DuplicateMemberCandidate*> sameSizeCandidates;
+   for (const DuplicateMemberCandidate& candidate : candidates)
+   {
+      if (numberOfMembersBySize[candidate.dataSize] > 1)
+         sameSizeCandidates.push_back(&candidate);
+   }
+
+   std::vector<ULONGLONG> memberHashes(sameSizeCandidates.size(), 0);
+
+   std::vector<size_t> indices(sameSizeCandidates.size());
+   std::iota(indices.begin(), indices.end(), 0);
+
+   std::for_each(std::execution::par, indices.begin(), indices.end(),
+      [&](size_t index)
+      {
+         memberHashes[index] = CalculateHash64(
+            file.Data<BYTE>(sameSizeCandidates[index]->dataOffset),
+            sameSizeCandidates[index]->dataSize);
+      });
+
+   // group the members by size and hash; the member contents are compared
+   // as well, so that hash collisions don't report false duplicates
+   std::map<std::pair<size_t, ULONGLONG>,
+      std::vector<std::vector<const DuplicateMemberCandidate*>>> membersBySizeAndHash;
+
+   for (size_t index = 0; index < sameSizeCandidates.size(); index++)
+   {
+      const DuplicateMemberCandidate* candidate = sameSizeCandidates[index];
+
+      std::vector<std::vector<const DuplicateMemberCandidate*>>& groups =
+         membersBySizeAndHash[std::make_pair(candidate->dataSize, memberHashes[index])];
+
+      auto iter = std::find_if(groups.begin(), groups.end(),
+         [&](const std::vector<const DuplicateMemberCandidate*>& group)
+         {
+            return memcmp(
+               file.Data<BYTE>(group.front()->dataOffset),
+               file.Data<BYTE>(candidate->dataOffset),
+               candidate->dataSize) == 0;
+         });
+
+      if (iter != groups.end())
+         iter->push_back(candidate);
+      else
+         groups.push_back(std::vector<const DuplicateMemberCandidate*>{ candidate });
+   }
+
+   DuplicateMembers duplicateMembers;
+
+   for (const auto& [sizeAndHash, groups] : membersBySizeAndHash)
+   {
+      for (const std::vector<const DuplicateMemberCandidate*>& group : groups)
+      {
+         if (group.size() < 2)
+            continue;
+
+         duplicateMembers.numberOfGroups++;
+         duplicateMembers.numberOfDuplicates += group.size() - 1;
+         duplicateMembers.wastedBytes += static_cast<ULONGLONG>(group.size() - 1) * sizeAndHash.first;
+
+         CString groupText;
+         groupText.Format(_T("%zu"), duplicateMembers.numberOfGroups);
+
+         CString sizeText;
+         sizeText.Format(_T("%zu"), sizeAndHash.first);
+
+         CString hashText;
+         hashText.Format(_T("%016llx"), sizeAndHash.second);
+
+         for (const DuplicateMemberCandidate* candidate : group)
+         {
+            CString indexText;
+            indexText.Format(_T("%zu"), candidate->archiveMemberIndex);
+
+            duplicateMembers.listData.push_back(
+               std::vector<CString> {
+               groupText,
+                  indexText,
+                  candidate->name,
+                  sizeText,
+                  hashText,
+            });
+         }
+      }
+   }
+
+   return duplicateMembers;
+}
+
+void ArchiveFileNodeTreeBuilder::AddSymbolConflictsNode(StaticNode& archiveFileNode) const
+{
+   std::vector<size_t> objectOffsets;
+   std::vector<CString> objectNames;
+   CollectCoffObjectMembers(objectOffsets, objectNames);
+
+   if (objectOffsets.size() < 2)
+      return;
+
+   /// symbol conflicts, analyzed when one of the nodes is shown the first time
+   struct LazySymbolConflicts
+   {
+      std::once_flag onceFlag;
+      const File* file = nullptr;
+      std::vector<size_t> objectOffsets;
+      std::vector<CString> objectNames;
+
+      size_t numberOfDefinitions = 0;
+      std::vector<CoffSymbolConflict> conflicts;
+
+      /// analyzes the symbol conflicts on first call
+      const std::vector<CoffSymbolConflict>& Get()
+      {
+         std::call_once(onceFlag,
+            [this]()
+            {
+               CoffSymbolConflictAnalyzer analyzer;
+               analyzer.AddObjects(*file, objectOffsets, objectNames);
+               analyzer.Analyze();
+
+               // only keep the conflicts, not all collected definitions
+               numberOfDefinitions = analyzer.NumberOfDefinitions();
+               conflicts = analyzer.Conflicts();
+               objectOffsets.clear();
+            });
+
+         return conflicts;
+      }
+   };
+
+   auto lazySymbolConflicts = std::make_shared<LazySymbolConflicts>();
+   lazySymbolConflicts->file = &m_file;
+   lazySymbolConflicts->objectOffsets = std::move(objectOffsets);
+   lazySymbolConflicts->objectNames = std::move(objectNames);
+
+   auto symbolConflictsNode = std::make_shared<CodeTextViewNode>(
+      _T("Symbol Conflicts"),
+      NodeTreeIconID::nodeTreeIconDocument,
+      [lazySymbolConflicts]()
+      {
+         const std::vector<CoffSymbolConflict>& conflicts = lazySymbolConflicts->Get();
+
+         CString text;
+         text.Format(
+            _T("External symbol definitions: %zu, in %zu COFF objects\n")
+            _T("Symbol conflicts: %zu\n"),
+            lazySymbolConflicts->numberOfDefinitions,
+            lazySymbolConflicts->objectNames.size(),
+            conflicts.size());
+
+         return text;
+      });
+
+   symbolConflictsNode->ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Symbol Conflicts List"),
+         NodeTreeIconID::nodeTreeIconTable,
+         CoffSymbolConflictAnalyzer::GetConflictListColumnNames(),
+         [lazySymbolConflicts]()
+         {
+            const std::vector<CoffSymbolConflict>& conflicts = lazySymbolConflicts->Get();
+
+            std::vector<std::vector<CString>> listData;
+            listData.reserve(conflicts.size());
+
+            for (size_t conflictIndex = 0; conflictIndex < conflicts.size(); conflictIndex++)
+            {
+               listData.push_back(
+                  CoffSymbolConflictAnalyzer::FormatConflictListRow(conflictIndex,
+                     conflicts[conflictIndex],
+                     lazySymbolConflicts->objectNames));
+            }
+
+            return listData;
+         },
+         true));
+
+   archiveFileNode.ChildNodes().insert(
+      archiveFileNode.ChildNodes().begin() + 2,
+      symbolConflictsNode);
+}
+
+void ArchiveFileNodeTreeBuilder::AddSectionSizesNode(StaticNode& archiveFileNode,
+   CString& librarySummaryText) const
+{
+   std::vector<size_t> objectOffsets;
+   std::vector<CString> objectNames;
+   CollectCoffObjectMembers(objectOffsets, objectNames);
+
+   if (objectOffsets.empty())
+      return;
+
+   // the total size only needs the section headers; the size breakdown
+   // also reads the symbol tables, so it's only done when it is shown
+   ULONGLONG totalSize = 0;
+   for (size_t objectOffset : objectOffsets)
+   {
+      CoffObjectNodeTreeBuilder nodeTreeBuilder{ m_file, objectOffset, false };
+      totalSize += nodeTreeBuilder.GetTotalSectionSize();
+   }
+
+   librarySummaryText.AppendFormat(_T("Total size of all sections: %llu bytes\n"),
+      totalSize);
+
+   const File* file = &m_file;
+
+   CoffObjectNodeTreeBuilder::AddSectionSizeNodes(archiveFileNode,
+      [file, objectOffsets = std::move(objectOffsets), objectNames = std::move(objectNames)]()
+      {
+         auto sectionSizeTree = std::make_shared<CoffSectionSizeTree>();
+         sectionSizeTree->AddObjects(*file, objectOffsets, objectNames);
+
+         return sectionSizeTree;
+      });
+}
+
+void ArchiveFileNodeTreeBuilder::CollectCoffObjectMembers(std::vector<size_t>& objectOffsets,
+   std::vector<CString>& objectNames) const
+{
+   for (const ArchiveMember& archiveMember : m_memberIndex.Members())
+   {
+      if (archiveMember.kind == ArchiveMemberKind::object &&
+         !archiveMember.isExternal &&
+         (CoffObjectNodeTreeBuilder::IsBigObjCoffObject(m_file, archiveMember.dataOffset) ||
+            IsCoffObjectMember(archiveMember)))
+      {
+         objectOffsets.push_back(archiveMember.dataOffset);
+         objectNames.push_back(archiveMember.name);
+      }
+   }
+}
+
+bool ArchiveFileNodeTreeBuilder::IsImportObjectMember(const ArchiveMember& archiveMember) const
+{
+   if (archiveMember.kind != ArchiveMemberKind::object ||
+      archiveMember.isExternal ||
+      archiveMember.dataSize < sizeof(ImportObjectHeader) ||
+      !NonCoffObjectNodeTreeBuilder::IsNonCoffOrAnonymousObjectFile(m_file, archiveMember.dataOffset))
+      return false;
+
+   const ImportObjectHeader& header = *m_file.Data<ImportObjectHeader>(archiveMember.dataOffset);
+
+   return header.version == 0;
+}
+
+std::shared_ptr<INode> ArchiveFileNodeTreeBuilder::CreateImportObjectTableNode(
+   const std::vector<const ArchiveMember*>& importObjectMembers) const
+{
+   /// location of a single import object in the archive
+   struct ImportObjectLocation
+   {
+      size_t archiveMemberIndex;
+      size_t dataOffset;
+      size_t dataSize;
+   };
+
+   std::vector<ImportObjectLocation> importObjectLocations;
+   importObjectLocations.reserve(importObjectMembers.size());
+
+   for (const ArchiveMember* archiveMember : importObjectMembers)
+   {
+      importObjectLocations.push_back(ImportObjectLocation{
+         archiveMember->index,
+         archiveMember->dataOffset,
+         archiveMember->dataSize });
+   }
+
+   static std::vector<CString> importObjectColumnNames
+   {
+      _T("Index"),
+      _T("Archive member"),
+      _T("Symbol"),
+      _T("DLL"),
+      _T("Ordinal / hint"),
+      _T("Type"),
+      _T("Name type"),
+      _T("Import name"),
+      _T("Architecture"),
+   };
+
+   size_t rowCount = importObjectLocations.size();
+   const File* file = &m_file;
+
+   // the rows are only formatted when displayed, so that opening import
+   // libraries with many thousand imports stays fast
+   return std::make_shared<FilterSortListViewNode>(
+      _T("Import Objects"),
+      NodeTreeIconID::nodeTreeIconTable,
+      importObjectColumnNames,
+      rowCount,
+      [file, importObjectLocations = std::move(importObjectLocations)](size_t rowIndex)
+      {
+         const ImportObjectLocation& location = importObjectLocations[rowIndex];
+
+         const ImportObjectHeader& header =
+            *file->Data<ImportObjectHeader>(location.dataOffset);
+
+         CString indexText;
+         indexText.Format(_T("%zu"), rowIndex);
+
+         CString archiveMemberIndexText;
+         archiveMemberIndexText.Format(_T("%zu"), location.archiveMemberIndex);
+
+         CString ordinalOrHintText;
+         ordinalOrHintText.Format(_T("%u"), header.ordinalOrHint);
+
+         ImportObjectNames names;
+         if (!DecodeImportObjectNames(header, location.dataSize - sizeof(ImportObjectHeader), names))
+            names.symbolName = _T("Error: import object names are outside of the archive member");
+
+         return std::vector<CString> {
+            indexText,
+               archiveMemberIndexText,
+               names.symbolName,
+               names.dllName,
+               ordinalOrHintText,
+               GetValueFromMapOrDefault<DWORD>(g_mapImportObjectTypeToDisplayText,
+                  GetImportObjectType(header), _T("unknown")),
+               GetValueFromMapOrDefault<DWORD>(g_mapImportObjectNameTypeToDisplayText,
+                  GetImportObjectNameType(header), _T("unknown")),
+               names.importName,
+               GetValueFromMapOrDefault<DWORD>(g_mapCoffTargetMachineToDisplayText,
+                  header.targetMachine, _T("unknown")),
+         };
+      },
+      true);
+}
+
+CString ArchiveFileNodeTreeBuilder::GetMemberNameByHeaderOffset(ULONGLONG headerOffset) const
+{
+   const ArchiveMember* archiveMember = m_memberIndex.FindMemberByHeaderOffset(headerOffset);
+
+   return archiveMember != nullptr ? archiveMember->name : CString{};
+}
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020-2023 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file ArchiveFileNodeTreeBuilder.hpp
 /// \brief Node tree builder for archive files
@@ -9,8 +9,8 @@
 
 #include "INode.hpp"
 #include "File.hpp"
-
-class StaticNode;
+#include "ArchiveMemberIndex.hpp"
+#include "CodeTextViewNode.hpp"
 
 /// Node tree builder for archive files
 class ArchiveFileNodeTreeBuilder
@@ -25,15 +25,23 @@ public:
    /// returns object file summary text
    const CString& GetObjectFileSummary() const { return m_objectFileSummary; }
 
+   /// returns the index of all archive members
+   const ArchiveMemberIndex& MemberIndex() const { return m_memberIndex; }
+
+   /// collects file offsets and names of all COFF object members
+   void CollectCoffObjectMembers(std::vector<size_t>& objectOffsets,
+      std::vector<CString>& objectNames) const;
+
 private:
-   /// adds archive linker member to node
+   /// adds archive linker member, symbol table or longnames member to node
    void AddArchiveLinkerMember(StaticNode& archiveMemberNode,
-      size_t archiveMemberIndex, size_t fileOffset, size_t linkerMemberSize,
+      const ArchiveMember& archiveMember,
       CString& linkerMemberSummary) const;
 
-   /// adds first linker member node
+   /// adds first linker member node; also used for the System V / GNU symbol
+   /// tables, with 32-bit or 64-bit offsets
    void AddFirstLinkerMemberNode(StaticNode& archiveMemberNode,
-      size_t fileOffset, size_t linkerMemberSize,
+      size_t fileOffset, size_t linkerMemberSize, size_t offsetSize,
       CString& linkerMemberSummary) const;
 
    /// adds second linker member node
@@ -41,12 +49,79 @@ private:
       size_t fileOffset, size_t linkerMemberSize,
       CString& linkerMemberSummary) const;
 
+   /// adds BSD "__.SYMDEF" symbol table node
+   void AddBsdSymbolTableNode(StaticNode& archiveMemberNode,
+      size_t fileOffset, size_t linkerMemberSize, size_t wordSize,
+      CString& linkerMemberSummary) const;
+
    /// adds longnames linker member node
    void AddArchiveLongnamesMember(StaticNode& archiveMemberNode,
       size_t fileOffset,
       size_t linkerMemberSize,
-      CString& linkerMemberSummary,
-      std::map<CString, CString>& longnamesMapping) const;
+      CString& linkerMemberSummary) const;
+
+   /// adds nodes for an archived object file
+   void AddObjectMember(StaticNode& archiveMemberNode,
+      const ArchiveMember& archiveMember,
+      CString& objectFileSummary) const;
+
+   /// adds nodes for an archived ELF object file
+   void AddElfObjectMember(StaticNode& archiveMemberNode,
+      const ArchiveMember& archiveMember,
+      CString& objectFileSummary) const;
+
+   /// returns if the archive member looks like a COFF object file
+   bool IsCoffObjectMember(const ArchiveMember& archiveMember) const;
+
+   /// returns if the archive member is a short import object
+   bool IsImportObjectMember(const ArchiveMember& archiveMember) const;
+
+   /// adds a node listing archive members with identical content; the
+   /// members are only hashed and compared when the node or the library
+   /// summary is shown, using the returned summary line provider
+   CodeTextViewNode::TextProvider AddDuplicateMembersNode(StaticNode& archiveFileNode) const;
+
+   /// archive member that may be a duplicate of another member
+   struct DuplicateMemberCandidate
+   {
+      size_t archiveMemberIndex;    ///< archive member index
+      CString name;                 ///< archive member name
+      size_t dataOffset;            ///< file offset of the member data
+      size_t dataSize;              ///< size of the member data
+   };
+
+   /// duplicate archive members
+   struct DuplicateMembers
+   {
+      /// list data, with one row per member of each group of duplicates
+      std::vector<std::vector<CString>> listData;
+
+      size_t numberOfGroups = 0;       ///< number of groups of identical members
+      size_t numberOfDuplicates = 0;   ///< number of members that are duplicates
+      ULONGLONG wastedBytes = 0;       ///< bytes used by the duplicates
+   };
+
+   /// finds members with identical content; only members of the same size
+   /// are hashed, and members with the same hash are compared byte by byte
+   static DuplicateMembers FindDuplicateMembers(const File& file,
+      const std::vector<DuplicateMemberCandidate>& candidates);
+
+   /// adds a symbol conflicts node for all COFF object members; the
+   /// external symbol definitions are only analyzed when the node is shown
+   void AddSymbolConflictsNode(StaticNode& archiveFileNode) const;
+
+   /// adds section size breakdown nodes for all COFF object members, by
+   /// section name, archive member and COMDAT symbol; only the total size
+   /// is added to the summary text, the breakdown is done when it is shown
+   void AddSectionSizesNode(StaticNode& archiveFileNode,
+      CString& librarySummaryText) const;
+
+   /// creates a table node with all short import objects of the archive
+   std::shared_ptr<INode> CreateImportObjectTableNode(
+      const std::vector<const ArchiveMember*>& importObjectMembers) const;
+
+   /// returns the archive member name for a symbol table member offset
+   CString GetMemberNameByHeaderOffset(ULONGLONG headerOffset) const;
 
 private:
    /// file to load archive file from
@@ -58,6 +133,6 @@ private:
    /// object file summary text
    CString m_objectFileSummary;
 
-   /// mapping from long name offset, .e.g /0, to long names texts, e.g. file.obj
-   std::map<CString, CString> m_longnamesMapping;
+   /// index of all archive members
+   ArchiveMemberIndex m_memberIndex;
 };
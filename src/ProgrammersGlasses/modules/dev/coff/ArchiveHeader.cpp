@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file ArchiveHeader.cpp
 /// \brief header definition of archive files
@@ -10,6 +10,8 @@
 
 const LPCSTR c_archiveHeaderSignatureText = "!<arch>\n";
 
+const LPCSTR c_thinArchiveHeaderSignatureText = "!<thin>\n";
+
 const StructDefinition g_definitionArchiveHeader = StructDefinition({
    StructField(
       offsetof(ArchiveHeader, ArchiveHeader::signature),
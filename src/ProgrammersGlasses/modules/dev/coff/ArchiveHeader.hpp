@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file ArchiveHeader.hpp
 /// \brief header definition of archive files
@@ -56,6 +56,10 @@ static_assert(sizeof(ArchiveMemberHeader) == 60, "Archive member header must be
 /// signature text for archive header
 extern const LPCSTR c_archiveHeaderSignatureText;
 
+/// signature text for thin archive header; thin archives only store the paths
+/// of the archived files
+extern const LPCSTR c_thinArchiveHeaderSignatureText;
+
 /// struct definition for above archive header
 extern const StructDefinition g_definitionArchiveHeader;
 
@@ -0,0 +1,262 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ArchiveMemberIndex.cpp
+/// \brief Index of all members of an "ar" archive file
+//
+#include "stdafx.h"
+#include "ArchiveMemberIndex.hpp"
+#include "ArchiveHeader.hpp"
+#include <optional>
+
+/// prefix of BSD member names that are stored in front of the member data
+static const CStringA c_bsdInlineNamePrefix = "#1/";
+
+/// name prefix of BSD symbol tables with 64-bit offsets
+static const CStringA c_bsdSymbolTable64NamePrefix = "__.SYMDEF_64";
+
+/// name prefix of BSD symbol tables
+static const CStringA c_bsdSymbolTableNamePrefix = "__.SYMDEF";
+
+/// \brief Parses a decimal number from a space padded header field
+static std::optional<ULONGLONG> ParseDecimalField(const CHAR* text, size_t maxLength)
+{
+   ULONGLONG value = 0;
+   size_t index = 0;
+   for (; index < maxLength && text[index] >= '0' && text[index] <= '9'; index++)
+      value = value * 10 + (text[index] - '0');
+
+   if (index == 0)
+      return std::nullopt;
+
+   for (; index < maxLength; index++)
+   {
+      if (text[index] != ' ')
+         return std::nullopt;
+   }
+
+   return value;
+}
+
+/// \brief Returns the text of a space padded header field, without the padding
+static CStringA GetTrimmedField(const CHAR* text, size_t maxLength)
+{
+   CStringA fieldText{ text, static_cast<int>(strnlen(text, maxLength)) };
+   fieldText.TrimRight(' ');
+
+   return fieldText;
+}
+
+bool ArchiveMemberIndex::IsArchiveFile(const File& file)
+{
+   if (file.Size() < sizeof(ArchiveHeader))
+      return false;
+
+   const CHAR* signature = file.Data<ArchiveHeader>()->signature;
+
+   return
+      memcmp(signature, c_archiveHeaderSignatureText, sizeof(ArchiveHeader::signature)) == 0 ||
+      memcmp(signature, c_thinArchiveHeaderSignatureText, sizeof(ArchiveHeader::signature)) == 0;
+}
+
+ArchiveMemberIndex::ArchiveMemberIndex(const File& file)
+   :m_file(file)
+{
+   if (!IsArchiveFile(m_file))
+   {
+      m_errorText = _T("Invalid archive signature");
+      return;
+   }
+
+   m_isThin = memcmp(m_file.Data<ArchiveHeader>()->signature,
+      c_thinArchiveHeaderSignatureText, sizeof(ArchiveHeader::signature)) == 0;
+
+   size_t headerOffset = sizeof(ArchiveHeader);
+   while (headerOffset < m_file.Size())
+   {
+      ArchiveMember member;
+      member.index = m_members.size();
+
+      if (!ReadMember(headerOffset, member))
+         break;
+
+      m_members.push_back(member);
+
+      // advance to next header; the data of thin archive members is stored
+      // in external files, except for symbol tables and longnames
+      size_t storedSize = member.dataOffset - headerOffset;
+      if (!member.isExternal)
+         storedSize += member.dataSize;
+
+      headerOffset += storedSize;
+
+      // ensure 2-byte alignment
+      if ((headerOffset & 1) != 0)
+         headerOffset++;
+   }
+}
+
+CString ArchiveMemberIndex::GetFormatDisplayText() const
+{
+   switch (m_format)
+   {
+   case ArchiveFormat::microsoft: return _T("COFF library file");
+   case ArchiveFormat::gnu: return m_isThin ? _T("GNU thin archive file") : _T("GNU archive file");
+   case ArchiveFormat::bsd: return _T("BSD archive file");
+   default:
+      ATLASSERT(false);
+      return _T("Archive file");
+   }
+}
+
+const ArchiveMember* ArchiveMemberIndex::FindMemberByHeaderOffset(ULONGLONG headerOffset) const
+{
+   auto iter = std::lower_bound(m_members.begin(), m_members.end(), headerOffset,
+      [](const ArchiveMember& member, ULONGLONG offset) { return member.headerOffset < offset; });
+
+   if (iter == m_members.end() ||
+      iter->headerOffset != headerOffset)
+      return nullptr;
+
+   return &*iter;
+}
+
+bool ArchiveMemberIndex::ReadMember(size_t headerOffset, ArchiveMember& member)
+{
+   if (m_file.Size() - headerOffset < sizeof(ArchiveMemberHeader))
+   {
+      m_errorText.Format(_T("Archive member header %zu is outside of the file"), member.index);
+      return false;
+   }
+
+   const ArchiveMemberHeader& header = *m_file.Data<ArchiveMemberHeader>(headerOffset);
+
+   if (header.endOfHeader[0] != 0x60 ||
+      header.endOfHeader[1] != 0x0a)
+   {
+      m_errorText.Format(_T("Archive member header %zu has an invalid end of header"), member.index);
+      return false;
+   }
+
+   std::optional<ULONGLONG> size = ParseDecimalField(header.sizeText, sizeof(header.sizeText));
+   if (!size.has_value())
+   {
+      m_errorText.Format(_T("Archive member header %zu has an invalid size"), member.index);
+      return false;
+   }
+
+   member.headerOffset = headerOffset;
+   member.dataOffset = headerOffset + sizeof(ArchiveMemberHeader);
+   member.dataSize = static_cast<size_t>(size.value());
+
+   CStringA name = GetTrimmedField(header.name, sizeof(header.name));
+   member.rawName = CString(name);
+
+   if (name == "/")
+   {
+      // Microsoft libraries have two linker members with the same name
+      if (member.index == 1 &&
+         m_members[0].kind == ArchiveMemberKind::firstLinkerMember)
+      {
+         member.kind = ArchiveMemberKind::secondLinkerMember;
+         m_format = ArchiveFormat::microsoft;
+      }
+      else
+         member.kind = ArchiveMemberKind::firstLinkerMember;
+   }
+   else if (name == "/SYM64/")
+   {
+      member.kind = ArchiveMemberKind::symbolTable64;
+   }
+   else if (name == "//")
+   {
+      member.kind = ArchiveMemberKind::longnames;
+      m_longnamesOffset = member.dataOffset;
+      m_longnamesSize = member.dataSize;
+   }
+   else if (name.GetLength() > 1 && name[0] == '/')
+   {
+      std::optional<ULONGLONG> longnameOffset =
+         ParseDecimalField(name.GetString() + 1, name.GetLength() - 1);
+
+      if (longnameOffset.has_value() &&
+         longnameOffset.value() < m_longnamesSize)
+         name = GetLongname(static_cast<size_t>(longnameOffset.value()));
+   }
+   else if (name.Left(c_bsdInlineNamePrefix.GetLength()) == c_bsdInlineNamePrefix)
+   {
+      std::optional<ULONGLONG> nameLength = ParseDecimalField(
+         name.GetString() + c_bsdInlineNamePrefix.GetLength(),
+         name.GetLength() - c_bsdInlineNamePrefix.GetLength());
+
+      if (!nameLength.has_value() ||
+         nameLength.value() > member.dataSize)
+      {
+         m_errorText.Format(_T("Archive member header %zu has an invalid BSD name length"), member.index);
+         return false;
+      }
+
+      member.dataOffset += static_cast<size_t>(nameLength.value());
+      member.dataSize -= static_cast<size_t>(nameLength.value());
+
+      if (m_file.Size() - headerOffset - sizeof(ArchiveMemberHeader) < nameLength.value())
+      {
+         m_errorText.Format(_T("Name of archive member %zu is outside of the file"), member.index);
+         return false;
+      }
+
+      name = GetTrimmedField(
+         m_file.Data<CHAR>(headerOffset + sizeof(ArchiveMemberHeader)),
+         static_cast<size_t>(nameLength.value()));
+
+      m_format = ArchiveFormat::bsd;
+   }
+   else if (name.Right(1) == "/")
+   {
+      // System V and Microsoft short names are terminated with a slash
+      name.Delete(name.GetLength() - 1);
+   }
+
+   if (name.Left(c_bsdSymbolTable64NamePrefix.GetLength()) == c_bsdSymbolTable64NamePrefix)
+   {
+      member.kind = ArchiveMemberKind::bsdSymbolTable64;
+      m_format = ArchiveFormat::bsd;
+   }
+   else if (name.Left(c_bsdSymbolTableNamePrefix.GetLength()) == c_bsdSymbolTableNamePrefix)
+   {
+      member.kind = ArchiveMemberKind::bsdSymbolTable;
+      m_format = ArchiveFormat::bsd;
+   }
+
+   member.name = CA2T(name, CP_UTF8);
+
+   member.isExternal = m_isThin && member.kind == ArchiveMemberKind::object;
+
+   if (!member.isExternal &&
+      member.dataSize > m_file.Size() - member.dataOffset)
+   {
+      m_errorText.Format(_T("Data of archive member %zu is outside of the file"), member.index);
+      return false;
+   }
+
+   return true;
+}
+
+CStringA ArchiveMemberIndex::GetLongname(size_t offset) const
+{
+   // Microsoft longnames are zero-terminated, System V / GNU longnames are
+   // terminated by "/\n"
+   const CHAR* start = m_file.Data<CHAR>(m_longnamesOffset + offset);
+   size_t maxLength = m_longnamesSize - offset;
+
+   size_t length = 0;
+   while (length < maxLength && start[length] != 0 && start[length] != '\n')
+      length++;
+
+   if (length > 0 && length < maxLength &&
+      start[length] == '\n' && start[length - 1] == '/')
+      length--;
+
+   return CStringA(start, static_cast<int>(length));
+}
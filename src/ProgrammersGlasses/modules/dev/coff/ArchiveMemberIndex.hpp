@@ -0,0 +1,147 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ArchiveMemberIndex.hpp
+/// \brief Index of all members of an "ar" archive file
+//
+#pragma once
+
+#include "File.hpp"
+
+/// \brief Variant of the "ar" archive file format
+enum class ArchiveFormat
+{
+   /// Microsoft COFF library; first and second linker member, "//" longnames
+   /// member with zero-terminated names
+   microsoft,
+
+   /// System V / GNU archive; "/" or "/SYM64/" symbol table, "//" longnames
+   /// member with names terminated by "/\n"
+   gnu,
+
+   /// BSD archive; "__.SYMDEF" symbol table, "#1/" names stored in front of
+   /// the member data
+   bsd,
+};
+
+/// \brief Kind of archive member
+enum class ArchiveMemberKind
+{
+   /// "/" first linker member (Microsoft), or symbol table (System V / GNU)
+   firstLinkerMember,
+
+   /// "/" second linker member (Microsoft only)
+   secondLinkerMember,
+
+   /// "/SYM64/" symbol table with 64-bit offsets (GNU)
+   symbolTable64,
+
+   /// "__.SYMDEF" or "__.SYMDEF SORTED" ranlib symbol table (BSD)
+   bsdSymbolTable,
+
+   /// "__.SYMDEF_64" or "__.SYMDEF_64 SORTED" ranlib symbol table (BSD)
+   bsdSymbolTable64,
+
+   /// "//" longnames member
+   longnames,
+
+   /// object file, or any other archived file
+   object,
+};
+
+/// \brief Single archive member, with resolved name and data location
+struct ArchiveMember
+{
+   /// archive member index
+   size_t index = 0;
+
+   /// file offset of the archive member header
+   size_t headerOffset = 0;
+
+   /// file offset of the member data; for BSD archives, this excludes the
+   /// name stored in front of the data
+   size_t dataOffset = 0;
+
+   /// size of the member data; for thin archives, this is the size of the
+   /// external file
+   size_t dataSize = 0;
+
+   /// member name, as stored in the member header
+   CString rawName;
+
+   /// resolved member name, e.g. from the longnames member or from the name
+   /// stored in front of the data
+   CString name;
+
+   /// archive member kind
+   ArchiveMemberKind kind = ArchiveMemberKind::object;
+
+   /// indicates that the member data is stored in an external file, for thin
+   /// archives
+   bool isExternal = false;
+};
+
+/// \brief Index of all members of an "ar" archive file
+/// \details Walks all archive member headers once, determines the archive
+/// format variant, resolves long member names and locates the member data.
+/// No member data is decoded here, and the index isn't modified after
+/// construction, so all members can be decoded independently of each other.
+class ArchiveMemberIndex
+{
+public:
+   /// returns if the file starts with an archive or thin archive signature
+   static bool IsArchiveFile(const File& file);
+
+   /// ctor; indexes all archive members
+   explicit ArchiveMemberIndex(const File& file);
+
+   /// returns the archive format variant
+   ArchiveFormat Format() const { return m_format; }
+
+   /// returns if the archive is a thin archive, storing only file paths
+   bool IsThin() const { return m_isThin; }
+
+   /// returns a display text for the archive format variant
+   CString GetFormatDisplayText() const;
+
+   /// returns all archive members
+   const std::vector<ArchiveMember>& Members() const { return m_members; }
+
+   /// finds an archive member by the file offset of its header, as used in
+   /// the symbol tables; returns nullptr when not found
+   const ArchiveMember* FindMemberByHeaderOffset(ULONGLONG headerOffset) const;
+
+   /// returns an error text, when indexing stopped at an invalid member header
+   const CString& GetErrorText() const { return m_errorText; }
+
+private:
+   /// reads the archive member header at given offset; returns false when
+   /// the header is invalid
+   bool ReadMember(size_t headerOffset, ArchiveMember& member);
+
+   /// returns a name from the longnames member
+   CStringA GetLongname(size_t offset) const;
+
+private:
+   /// file to index
+   const File& m_file;
+
+   /// archive format variant
+   ArchiveFormat m_format = ArchiveFormat::gnu;
+
+   /// indicates a thin archive
+   bool m_isThin = false;
+
+   /// all archive members, ordered by header offset
+   std::vector<ArchiveMember> m_members;
+
+   /// file offset of the longnames member data
+   size_t m_longnamesOffset = 0;
+
+   /// size of the longnames member data
+   size_t m_longnamesSize = 0;
+
+   /// error text
+   CString m_errorText;
+};
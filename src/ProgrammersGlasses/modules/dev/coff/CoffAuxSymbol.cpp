@@ -0,0 +1,140 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffAuxSymbol.cpp
+/// \brief COFF auxiliary symbol record definitions
+//
+#include "stdafx.h"
+#include "CoffAuxSymbol.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapCoffComdatSelectionToDisplayText =
+{
+   { 1, _T("IMAGE_COMDAT_SELECT_NODUPLICATES") },
+   { 2, _T("IMAGE_COMDAT_SELECT_ANY") },
+   { 3, _T("IMAGE_COMDAT_SELECT_SAME_SIZE") },
+   { 4, _T("IMAGE_COMDAT_SELECT_EXACT_MATCH") },
+   { 5, _T("IMAGE_COMDAT_SELECT_ASSOCIATIVE") },
+   { 6, _T("IMAGE_COMDAT_SELECT_LARGEST") },
+   { 7, _T("IMAGE_COMDAT_SELECT_NEWEST") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapCoffWeakExternalCharacteristicsToDisplayText =
+{
+   { 1, _T("IMAGE_WEAK_EXTERN_SEARCH_NOLIBRARY") },
+   { 2, _T("IMAGE_WEAK_EXTERN_SEARCH_LIBRARY") },
+   { 3, _T("IMAGE_WEAK_EXTERN_SEARCH_ALIAS") },
+   { 4, _T("IMAGE_WEAK_EXTERN_ANTI_DEPENDENCY") },
+};
+
+const StructDefinition g_definitionCoffAuxSectionDefinition = StructDefinition({
+   StructField(
+      offsetof(CoffAuxSectionDefinition, CoffAuxSectionDefinition::length),
+      sizeof(CoffAuxSectionDefinition::length),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Section length")),
+
+   StructField(
+      offsetof(CoffAuxSectionDefinition, CoffAuxSectionDefinition::numberOfRelocations),
+      sizeof(CoffAuxSectionDefinition::numberOfRelocations),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Number of relocations")),
+
+   StructField(
+      offsetof(CoffAuxSectionDefinition, CoffAuxSectionDefinition::numberOfLinenumbers),
+      sizeof(CoffAuxSectionDefinition::numberOfLinenumbers),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Number of line numbers")),
+
+   StructField(
+      offsetof(CoffAuxSectionDefinition, CoffAuxSectionDefinition::checkSum),
+      sizeof(CoffAuxSectionDefinition::checkSum),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("COMDAT checksum")),
+
+   StructField(
+      offsetof(CoffAuxSectionDefinition, CoffAuxSectionDefinition::number),
+      sizeof(CoffAuxSectionDefinition::number),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Associated section number")),
+
+   StructField(
+      offsetof(CoffAuxSectionDefinition, CoffAuxSectionDefinition::selection),
+      sizeof(CoffAuxSectionDefinition::selection),
+      1,
+      true, // little-endian
+      StructFieldType::valueMapping,
+      g_mapCoffComdatSelectionToDisplayText,
+      _T("COMDAT selection")),
+
+   StructField(
+      offsetof(CoffAuxSectionDefinition, CoffAuxSectionDefinition::highNumber),
+      sizeof(CoffAuxSectionDefinition::highNumber),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Associated section number, high part")),
+   });
+
+const StructDefinition g_definitionCoffAuxFunctionDefinition = StructDefinition({
+   StructField(
+      offsetof(CoffAuxFunctionDefinition, CoffAuxFunctionDefinition::tagIndex),
+      sizeof(CoffAuxFunctionDefinition::tagIndex),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Tag index")),
+
+   StructField(
+      offsetof(CoffAuxFunctionDefinition, CoffAuxFunctionDefinition::totalSize),
+      sizeof(CoffAuxFunctionDefinition::totalSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Function size")),
+
+   StructField(
+      offsetof(CoffAuxFunctionDefinition, CoffAuxFunctionDefinition::pointerToLinenumber),
+      sizeof(CoffAuxFunctionDefinition::pointerToLinenumber),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Line numbers offset")),
+
+   StructField(
+      offsetof(CoffAuxFunctionDefinition, CoffAuxFunctionDefinition::pointerToNextFunction),
+      sizeof(CoffAuxFunctionDefinition::pointerToNextFunction),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Next function symbol index")),
+   });
+
+const StructDefinition g_definitionCoffAuxWeakExternal = StructDefinition({
+   StructField(
+      offsetof(CoffAuxWeakExternal, CoffAuxWeakExternal::tagIndex),
+      sizeof(CoffAuxWeakExternal::tagIndex),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Default symbol index")),
+
+   StructField(
+      offsetof(CoffAuxWeakExternal, CoffAuxWeakExternal::characteristics),
+      sizeof(CoffAuxWeakExternal::characteristics),
+      4,
+      true, // little-endian
+      StructFieldType::valueMapping,
+      g_mapCoffWeakExternalCharacteristicsToDisplayText,
+      _T("Characteristics")),
+   });
@@ -0,0 +1,93 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffAuxSymbol.hpp
+/// \brief COFF auxiliary symbol record definitions
+//
+#pragma once
+
+#include "StructDefinition.hpp"
+
+/// storage class of external symbols
+constexpr BYTE c_coffStorageClassExternal = 2;
+
+/// storage class of static symbols, e.g. section definitions
+constexpr BYTE c_coffStorageClassStatic = 3;
+
+/// storage class of source file name symbols
+constexpr BYTE c_coffStorageClassFile = 103;
+
+/// storage class of weak external symbols
+constexpr BYTE c_coffStorageClassWeakExternal = 105;
+
+/// COMDAT selection value for sections that must only be defined once
+constexpr BYTE c_coffComdatSelectNoDuplicates = 1;
+
+/// COMDAT selection value for sections that must all have the same size
+constexpr BYTE c_coffComdatSelectSameSize = 3;
+
+/// COMDAT selection value for sections that must all have the same contents
+constexpr BYTE c_coffComdatSelectExactMatch = 4;
+
+/// COMDAT selection value for sections associated with another section
+constexpr BYTE c_coffComdatSelectAssociative = 5;
+
+#pragma pack(push, 1)
+
+/// \brief Aux symbol record format 5: section definition
+/// \see https://learn.microsoft.com/en-us/windows/win32/debug/pe-format#auxiliary-format-5-section-definitions
+/// The struct corresponds with the Section member of winnt.h's IMAGE_AUX_SYMBOL
+/// struct; BigObj aux records have 2 more unused bytes at the end.
+struct CoffAuxSectionDefinition
+{
+   DWORD length;              ///< size of section data
+   WORD numberOfRelocations;  ///< number of relocation entries
+   WORD numberOfLinenumbers;  ///< number of line number entries
+   DWORD checkSum;            ///< checksum of COMDAT section data
+   WORD number;               ///< 1-based index of associated section, for associative COMDAT sections
+   BYTE selection;            ///< COMDAT selection number
+   BYTE reserved;             ///< reserved
+   WORD highNumber;           ///< high 16 bits of the associated section index; BigObj only
+};
+
+/// \brief Aux symbol record format 1: function definition
+/// \see https://learn.microsoft.com/en-us/windows/win32/debug/pe-format#auxiliary-format-1-function-definitions
+struct CoffAuxFunctionDefinition
+{
+   DWORD tagIndex;               ///< symbol table index of the .bf symbol record
+   DWORD totalSize;              ///< size of the function code
+   DWORD pointerToLinenumber;    ///< file offset of the line number entries
+   DWORD pointerToNextFunction;  ///< symbol table index of the next function
+   WORD unused;                  ///< unused
+};
+
+/// \brief Aux symbol record format 3: weak external
+/// \see https://learn.microsoft.com/en-us/windows/win32/debug/pe-format#auxiliary-format-3-weak-externals
+struct CoffAuxWeakExternal
+{
+   DWORD tagIndex;         ///< symbol table index of the default symbol
+   DWORD characteristics;  ///< library search characteristics
+   BYTE unused[10];        ///< unused
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(CoffAuxSectionDefinition) == 18, "COFF aux section definition must be 18 bytes long");
+static_assert(sizeof(CoffAuxFunctionDefinition) == 18, "COFF aux function definition must be 18 bytes long");
+static_assert(sizeof(CoffAuxWeakExternal) == 18, "COFF aux weak external must be 18 bytes long");
+
+/// mapping of COMDAT selection numbers to display text
+extern const std::map<DWORD, LPCTSTR> g_mapCoffComdatSelectionToDisplayText;
+
+/// mapping of weak external characteristics to display text
+extern const std::map<DWORD, LPCTSTR> g_mapCoffWeakExternalCharacteristicsToDisplayText;
+
+/// struct definition for above aux section definition
+extern const StructDefinition g_definitionCoffAuxSectionDefinition;
+
+/// struct definition for above aux function definition
+extern const StructDefinition g_definitionCoffAuxFunctionDefinition;
+
+/// struct definition for above aux weak external
+extern const StructDefinition g_definitionCoffAuxWeakExternal;
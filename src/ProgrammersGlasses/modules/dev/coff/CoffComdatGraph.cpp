@@ -0,0 +1,104 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffComdatGraph.cpp
+/// \brief COMDAT section association graph of a COFF object
+//
+#include "stdafx.h"
+#include "CoffComdatGraph.hpp"
+#include "CoffAuxSymbol.hpp"
+
+CoffComdatGraph::CoffComdatGraph(size_t numberOfSections)
+   :m_selection(numberOfSections + 1, 0),
+   m_sectionSymbolIndex(numberOfSections + 1, c_none),
+   m_comdatSymbolIndex(numberOfSections + 1, c_none),
+   m_associatedSection(numberOfSections + 1, c_none),
+   m_numberOfAssociatedSections(numberOfSections + 1, 0)
+{
+}
+
+void CoffComdatGraph::AddSectionDefinition(size_t sectionNumber, size_t symbolIndex,
+   BYTE selection, size_t associatedSectionNumber)
+{
+   if (sectionNumber == 0 ||
+      sectionNumber > NumberOfSections() ||
+      m_sectionSymbolIndex[sectionNumber] != c_none)
+      return;
+
+   m_sectionSymbolIndex[sectionNumber] = symbolIndex;
+
+   if (selection == 0)
+      return;
+
+   m_selection[sectionNumber] = selection;
+   m_numberOfComdatSections++;
+
+   if (selection == c_coffComdatSelectAssociative)
+   {
+      m_numberOfAssociativeSections++;
+
+      if (associatedSectionNumber != 0 &&
+         associatedSectionNumber <= NumberOfSections())
+      {
+         m_associatedSection[sectionNumber] = associatedSectionNumber;
+         m_numberOfAssociatedSections[associatedSectionNumber]++;
+      }
+   }
+}
+
+void CoffComdatGraph::AddSectionSymbol(size_t sectionNumber, size_t symbolIndex)
+{
+   if (sectionNumber == 0 ||
+      sectionNumber > NumberOfSections() ||
+      m_selection[sectionNumber] == 0 ||
+      m_comdatSymbolIndex[sectionNumber] != c_none)
+      return;
+
+   m_comdatSymbolIndex[sectionNumber] = symbolIndex;
+}
+
+BYTE CoffComdatGraph::Selection(size_t sectionNumber) const
+{
+   return sectionNumber < m_selection.size() ? m_selection[sectionNumber] : 0;
+}
+
+size_t CoffComdatGraph::SectionSymbolIndex(size_t sectionNumber) const
+{
+   return sectionNumber < m_sectionSymbolIndex.size() ? m_sectionSymbolIndex[sectionNumber] : c_none;
+}
+
+size_t CoffComdatGraph::ComdatSymbolIndex(size_t sectionNumber) const
+{
+   return sectionNumber < m_comdatSymbolIndex.size() ? m_comdatSymbolIndex[sectionNumber] : c_none;
+}
+
+size_t CoffComdatGraph::AssociatedSection(size_t sectionNumber) const
+{
+   return sectionNumber < m_associatedSection.size() ? m_associatedSection[sectionNumber] : c_none;
+}
+
+size_t CoffComdatGraph::NumberOfAssociatedSections(size_t sectionNumber) const
+{
+   return sectionNumber < m_numberOfAssociatedSections.size() ? m_numberOfAssociatedSections[sectionNumber] : 0;
+}
+
+size_t CoffComdatGraph::LeaderSection(size_t sectionNumber) const
+{
+   if (sectionNumber == 0 ||
+      sectionNumber > NumberOfSections())
+      return c_none;
+
+   // a chain without cycles can't be longer than the number of sections
+   for (size_t step = 0; step <= NumberOfSections(); step++)
+   {
+      if (m_selection[sectionNumber] != c_coffComdatSelectAssociative)
+         return sectionNumber;
+
+      sectionNumber = m_associatedSection[sectionNumber];
+      if (sectionNumber == c_none)
+         return c_none;
+   }
+
+   return c_none;
+}
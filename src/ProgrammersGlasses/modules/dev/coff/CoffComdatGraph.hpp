@@ -0,0 +1,86 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffComdatGraph.hpp
+/// \brief COMDAT section association graph of a COFF object
+//
+#pragma once
+
+/// \brief COMDAT section association graph of a COFF object
+/// \details Collects the COMDAT selection and the associated section of all
+/// sections, while the symbol table is scanned once. All infos are stored in
+/// flat arrays, indexed by the 1-based section number. Associative COMDAT
+/// sections are kept or dropped by the linker together with the section they
+/// are associated with; following the associations leads to the leader
+/// section whose COMDAT selection decides.
+class CoffComdatGraph
+{
+public:
+   /// value for unset section numbers and symbol indices
+   static constexpr size_t c_none = static_cast<size_t>(-1);
+
+   /// ctor
+   explicit CoffComdatGraph(size_t numberOfSections);
+
+   /// returns the number of sections
+   size_t NumberOfSections() const { return m_selection.size() - 1; }
+
+   /// returns the number of COMDAT sections
+   size_t NumberOfComdatSections() const { return m_numberOfComdatSections; }
+
+   /// returns the number of associative COMDAT sections
+   size_t NumberOfAssociativeSections() const { return m_numberOfAssociativeSections; }
+
+   /// adds a section definition symbol; called for each section symbol
+   /// with aux record, in symbol table order
+   void AddSectionDefinition(size_t sectionNumber, size_t symbolIndex,
+      BYTE selection, size_t associatedSectionNumber);
+
+   /// adds a symbol defined in a section; the first symbol following the
+   /// section definition is the COMDAT symbol of the section
+   void AddSectionSymbol(size_t sectionNumber, size_t symbolIndex);
+
+   /// returns the COMDAT selection of a section, or 0 when not a COMDAT section
+   BYTE Selection(size_t sectionNumber) const;
+
+   /// returns the symbol index of the section definition symbol, or c_none
+   size_t SectionSymbolIndex(size_t sectionNumber) const;
+
+   /// returns the symbol index of the COMDAT symbol, or c_none
+   size_t ComdatSymbolIndex(size_t sectionNumber) const;
+
+   /// returns the section that an associative section is associated with,
+   /// or c_none
+   size_t AssociatedSection(size_t sectionNumber) const;
+
+   /// returns the number of sections directly associated with a section
+   size_t NumberOfAssociatedSections(size_t sectionNumber) const;
+
+   /// returns the leader section that decides if the section is kept; this
+   /// is the section itself for non-associative sections, and c_none when
+   /// the associations form a cycle or reference an invalid section
+   size_t LeaderSection(size_t sectionNumber) const;
+
+private:
+   /// COMDAT selection, by section number
+   std::vector<BYTE> m_selection;
+
+   /// symbol index of the section definition symbol, by section number
+   std::vector<size_t> m_sectionSymbolIndex;
+
+   /// symbol index of the COMDAT symbol, by section number
+   std::vector<size_t> m_comdatSymbolIndex;
+
+   /// associated section number, by section number
+   std::vector<size_t> m_associatedSection;
+
+   /// number of directly associated sections, by section number
+   std::vector<size_t> m_numberOfAssociatedSections;
+
+   /// number of COMDAT sections
+   size_t m_numberOfComdatSections = 0;
+
+   /// number of associative COMDAT sections
+   size_t m_numberOfAssociativeSections = 0;
+};
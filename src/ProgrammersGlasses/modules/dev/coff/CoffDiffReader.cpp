@@ -0,0 +1,97 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffDiffReader.cpp
+/// \brief reader that compares two COFF objects, libraries or PE images
+//
+#include "stdafx.h"
+#include "CoffDiffReader.hpp"
+#include "CoffFileDiff.hpp"
+#include "CodeTextViewNode.hpp"
+#include "FilterSortListViewNode.hpp"
+
+CoffDiffReader::CoffDiffReader(const File& oldFile, const File& newFile)
+   :m_oldFile(oldFile),
+   m_newFile(newFile)
+{
+}
+
+void CoffDiffReader::Load()
+{
+   auto diff = std::make_shared<CoffFileDiff>(m_oldFile, m_newFile);
+   diff->Compare();
+
+   auto rootNode = std::make_shared<CodeTextViewNode>(
+      _T("Diff Summary"),
+      NodeTreeIconID::nodeTreeIconDocument);
+
+   rootNode->SetText(diff->FormatSummary());
+
+   m_rootNode = rootNode;
+
+   if (!diff->GetErrorText().IsEmpty())
+      return;
+
+   rootNode->ChildNodes().push_back(
+      std::make_shared<CodeTextViewNode>(
+         _T("All Differences"),
+         NodeTreeIconID::nodeTreeIconDocument,
+         [diff]()
+         {
+            return diff->FormatDifferences();
+         }));
+
+   AddDifferencesNode(*rootNode, _T("Header Differences"), diff, diff->HeaderDifferences());
+   AddDifferencesNode(*rootNode, _T("Section Differences"), diff, diff->SectionDifferences());
+   AddDifferencesNode(*rootNode, _T("Symbol Differences"), diff, diff->SymbolDifferences());
+   AddDifferencesNode(*rootNode, _T("Archive Member Differences"), diff, diff->MemberDifferences());
+}
+
+void CoffDiffReader::Cleanup()
+{
+   // nothing expensive to cleanup here
+}
+
+void CoffDiffReader::AddDifferencesNode(StaticNode& rootNode, LPCTSTR displayName,
+   std::shared_ptr<const CoffFileDiff> diff,
+   const std::vector<CoffDiffEntry>& differences)
+{
+   if (differences.empty())
+      return;
+
+   static std::vector<CString> differencesColumnNames
+   {
+      _T("Name"),
+      _T("Change"),
+      _T("Old value"),
+      _T("New value"),
+      _T("Size delta"),
+   };
+
+   rootNode.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         displayName,
+         NodeTreeIconID::nodeTreeIconTable,
+         differencesColumnNames,
+         differences.size(),
+         [diff, &differences](size_t rowIndex)
+         {
+            // the differences are owned by the diff, which is kept alive by
+            // the captured pointer
+            const CoffDiffEntry& entry = differences[rowIndex];
+
+            CString sizeDeltaText;
+            if (entry.sizeDelta != 0)
+               sizeDeltaText.Format(_T("%+lld"), entry.sizeDelta);
+
+            return std::vector<CString> {
+               entry.name,
+                  CoffFileDiff::GetChangeDisplayText(entry.change),
+                  entry.oldValue,
+                  entry.newValue,
+                  sizeDeltaText,
+            };
+         },
+         true));
+}
@@ -0,0 +1,56 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffDiffReader.hpp
+/// \brief reader that compares two COFF objects, libraries or PE images
+//
+#pragma once
+
+#include "IReader.hpp"
+
+class StaticNode;
+class CoffFileDiff;
+struct CoffDiffEntry;
+
+/// \brief COFF diff reader
+/// \details Compares two COFF object files, archive library files or PE
+/// images structurally, and shows the differences as node tree.
+class CoffDiffReader : public IReader
+{
+public:
+   /// ctor
+   CoffDiffReader(const File& oldFile, const File& newFile);
+
+   // Inherited via IReader
+
+   /// returns the filename of the new file
+   const CString& Filename() const override
+   {
+      return m_newFile.Filename();
+   }
+
+   std::shared_ptr<INode> RootNode() const override
+   {
+      return m_rootNode;
+   }
+
+   void Load() override;
+   void Cleanup() override;
+
+private:
+   /// adds a table node with differences of the diff, when there are any
+   static void AddDifferencesNode(StaticNode& rootNode, LPCTSTR displayName,
+      std::shared_ptr<const CoffFileDiff> diff,
+      const std::vector<CoffDiffEntry>& differences);
+
+private:
+   /// old file to compare
+   File m_oldFile;
+
+   /// new file to compare
+   File m_newFile;
+
+   /// root node
+   std::shared_ptr<INode> m_rootNode;
+};
@@ -0,0 +1,659 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffFileDiff.cpp
+/// \brief Structural comparison of two COFF objects, libraries or PE images
+//
+#include "stdafx.h"
+#include "CoffFileDiff.hpp"
+#include "CoffReader.hpp"
+#include "CoffHeader.hpp"
+#include "AnonymousObjectHeaderBigObj.hpp"
+#include "CoffObjectNodeTreeBuilder.hpp"
+#include "NonCoffObjectNodeTreeBuilder.hpp"
+#include "ArchiveFileNodeTreeBuilder.hpp"
+#include "CoffSymbolConflictAnalyzer.hpp"
+#include "CoffSectionSizeTree.hpp"
+#include "DataHelper.hpp"
+#include "DisplayFormatHelper.hpp"
+#include "dev/pe/DosMzHeader.hpp"
+#include "dev/pe/OptionalHeader.hpp"
+#include "dev/pe/PortableExecutableImage.hpp"
+#include <execution>
+#include <numeric>
+#include <thread>
+
+/// maximum number of differences per category listed in the summary
+constexpr size_t c_maxSummaryDifferences = 10;
+
+/// formats the value of aggregated external definitions
+static CString FormatSymbolValue(size_t numberOfDefinitions,
+   size_t numberOfComdats, ULONGLONG size)
+{
+   CString valueText;
+   if (numberOfComdats > 0)
+      valueText.Format(_T("%llu bytes"), size);
+   else
+      valueText = _T("defined");
+
+   if (numberOfDefinitions > 1)
+      valueText.AppendFormat(_T(", %zu definitions"), numberOfDefinitions);
+
+   return valueText;
+}
+
+/// formats the value of aggregated archive members
+static CString FormatMemberValue(size_t numberOfMembers, ULONGLONG size, ULONGLONG hash)
+{
+   CString valueText;
+   valueText.Format(_T("%llu bytes, hash 0x%016llx"), size, hash);
+
+   if (numberOfMembers > 1)
+      valueText.AppendFormat(_T(", %zu members"), numberOfMembers);
+
+   return valueText;
+}
+
+/// formats a size difference, with sign
+static CString FormatSizeDelta(LONGLONG sizeDelta)
+{
+   CString sizeDeltaText;
+   sizeDeltaText.Format(_T("%+lld"), sizeDelta);
+   return sizeDeltaText;
+}
+
+/// formats a single difference as text line
+static CString FormatDifference(const CoffDiffEntry& entry)
+{
+   CString lineText;
+   lineText.Format(_T("%s: %s"),
+      CoffFileDiff::GetChangeDisplayText(entry.change),
+      entry.name.GetString());
+
+   if (entry.change == CoffDiffChange::changed)
+      lineText.AppendFormat(_T(", %s -> %s"), entry.oldValue.GetString(), entry.newValue.GetString());
+   else
+      lineText.AppendFormat(_T(", %s"),
+         (entry.change == CoffDiffChange::added ? entry.newValue : entry.oldValue).GetString());
+
+   if (entry.sizeDelta != 0)
+      lineText.AppendFormat(_T(" (%s bytes)"), FormatSizeDelta(entry.sizeDelta).GetString());
+
+   return lineText + _T("\n");
+}
+
+CoffFileKind CoffFileDiff::GetFileKind(const File& file)
+{
+   // archive files are checked first, since they have a signature, and
+   // big object files before other anonymous objects
+   if (CoffReader::IsArLibraryFile(file))
+      return CoffFileKind::archive;
+
+   if (PortableExecutableImage{ file }.IsValid())
+      return CoffFileKind::image;
+
+   if (CoffObjectNodeTreeBuilder::IsBigObjCoffObject(file, 0))
+      return CoffFileKind::bigObj;
+
+   if (NonCoffObjectNodeTreeBuilder::IsNonCoffOrAnonymousObjectFile(file, 0))
+      return CoffFileKind::unknown;
+
+   if (CoffReader::IsCoffObjectFile(file))
+      return CoffFileKind::object;
+
+   return CoffFileKind::unknown;
+}
+
+LPCTSTR CoffFileDiff::GetFileKindDisplayText(CoffFileKind fileKind)
+{
+   switch (fileKind)
+   {
+   case CoffFileKind::unknown: return _T("unsupported file");
+   case CoffFileKind::object: return _T("COFF object file");
+   case CoffFileKind::bigObj: return _T("COFF object file (/bigobj)");
+   case CoffFileKind::archive: return _T("archive library file");
+   case CoffFileKind::image: return _T("Portable Executable image");
+   default:
+      ATLASSERT(false);
+      return _T("unknown");
+   }
+}
+
+LPCTSTR CoffFileDiff::GetChangeDisplayText(CoffDiffChange change)
+{
+   switch (change)
+   {
+   case CoffDiffChange::added: return _T("Added");
+   case CoffDiffChange::removed: return _T("Removed");
+   case CoffDiffChange::changed: return _T("Changed");
+   default:
+      ATLASSERT(false);
+      return _T("unknown");
+   }
+}
+
+CoffFileDiff::CoffFileDiff(const File& oldFile, const File& newFile)
+   :m_oldFile(oldFile),
+   m_newFile(newFile)
+{
+}
+
+void CoffFileDiff::Compare()
+{
+   // both files are independent of each other, so collect them in parallel
+   std::array<std::pair<const File*, FileTables*>, 2> sides
+   {
+      std::make_pair(&m_oldFile, &m_oldTables),
+      std::make_pair(&m_newFile, &m_newTables),
+   };
+
+   std::for_each(std::execution::par, sides.begin(), sides.end(),
+      [](const std::pair<const File*, FileTables*>& side)
+      {
+         CollectTables(*side.first, *side.second);
+      });
+
+   if (m_oldTables.fileKind == CoffFileKind::unknown ||
+      m_newTables.fileKind == CoffFileKind::unknown)
+   {
+      m_errorText = _T("Only COFF object files, archive library files and PE images can be compared.");
+      return;
+   }
+
+   if (m_oldTables.fileKind != m_newTables.fileKind)
+   {
+      m_errorText.Format(_T("The files have different kinds: %s and %s."),
+         GetFileKindDisplayText(m_oldTables.fileKind),
+         GetFileKindDisplayText(m_newTables.fileKind));
+      return;
+   }
+
+   CompareHeaders();
+   CompareSections();
+   CompareSymbols();
+   CompareMembers();
+}
+
+CString CoffFileDiff::FormatSummary() const
+{
+   CString summaryText;
+   summaryText.Format(_T("Old file: %s\nNew file: %s\n\n"),
+      m_oldFile.Filename().GetString(),
+      m_newFile.Filename().GetString());
+
+   if (!m_errorText.IsEmpty())
+   {
+      summaryText += _T("Error: ") + m_errorText + _T("\n");
+      return summaryText;
+   }
+
+   summaryText.AppendFormat(_T("File kind: %s\n"), GetFileKindDisplayText(FileKind()));
+
+   if (FileKind() == CoffFileKind::archive)
+      summaryText.AppendFormat(_T("Archive members: %zu -> %zu\n"),
+         m_oldTables.members.size(), m_newTables.members.size());
+
+   summaryText.AppendFormat(
+      _T("COFF objects: %zu -> %zu\n")
+      _T("Sections: %zu -> %zu\n")
+      _T("External symbols: %zu -> %zu\n")
+      _T("Total size of all sections: %llu -> %llu bytes (%s bytes)\n\n"),
+      m_oldTables.numberOfObjects, m_newTables.numberOfObjects,
+      m_oldTables.sections.size(), m_newTables.sections.size(),
+      m_oldTables.symbols.size(), m_newTables.symbols.size(),
+      m_oldTables.totalSectionSize, m_newTables.totalSectionSize,
+      FormatSizeDelta(static_cast<LONGLONG>(m_newTables.totalSectionSize - m_oldTables.totalSectionSize)).GetString());
+
+   summaryText.AppendFormat(
+      _T("Header differences: %zu\n")
+      _T("Section differences: %zu\n")
+      _T("Symbol differences: %zu\n")
+      _T("Archive member differences: %zu\n"),
+      m_headerDifferences.size(),
+      m_sectionDifferences.size(),
+      m_symbolDifferences.size(),
+      m_memberDifferences.size());
+
+   // list the largest size changes, since these are most interesting
+   for (const auto& [categoryName, differences] : {
+      std::make_pair(_T("sections"), &m_sectionDifferences),
+      std::make_pair(_T("symbols"), &m_symbolDifferences),
+      std::make_pair(_T("archive members"), &m_memberDifferences) })
+   {
+      if (differences->empty() ||
+         differences->front().sizeDelta == 0)
+         continue;
+
+      summaryText.AppendFormat(_T("\nLargest size changes of %s:\n"), categoryName);
+
+      for (size_t index = 0; index < std::min(differences->size(), c_maxSummaryDifferences); index++)
+      {
+         const CoffDiffEntry& entry = (*differences)[index];
+         if (entry.sizeDelta == 0)
+            break;
+
+         summaryText += FormatDifference(entry);
+      }
+   }
+
+   return summaryText;
+}
+
+CString CoffFileDiff::FormatDifferences() const
+{
+   CString differencesText;
+
+   for (const auto& [categoryName, differences] : {
+      std::make_pair(_T("Header"), &m_headerDifferences),
+      std::make_pair(_T("Section"), &m_sectionDifferences),
+      std::make_pair(_T("Symbol"), &m_symbolDifferences),
+      std::make_pair(_T("Archive member"), &m_memberDifferences) })
+   {
+      if (differences->empty())
+         continue;
+
+      differencesText.AppendFormat(_T("%s differences:\n"), categoryName);
+
+      for (const CoffDiffEntry& entry : *differences)
+         differencesText += FormatDifference(entry);
+
+      differencesText += _T("\n");
+   }
+
+   if (differencesText.IsEmpty())
+      differencesText = m_errorText.IsEmpty()
+      ? _T("No differences found.\n")
+      : _T("Error: ") + m_errorText + _T("\n");
+
+   return differencesText;
+}
+
+void CoffFileDiff::CollectTables(const File& file, FileTables& tables)
+{
+   tables.fileKind = GetFileKind(file);
+
+   switch (tables.fileKind)
+   {
+   case CoffFileKind::object:
+   case CoffFileKind::bigObj:
+      CollectObjectTables(file, { 0 }, false, tables);
+      break;
+
+   case CoffFileKind::image:
+      CollectObjectTables(file, { PortableExecutableImage{ file }.CoffHeaderOffset() }, true, tables);
+      break;
+
+   case CoffFileKind::archive:
+   {
+      ArchiveFileNodeTreeBuilder nodeTreeBuilder{ file, 0 };
+
+      std::vector<size_t> objectOffsets;
+      std::vector<CString> objectNames;
+      nodeTreeBuilder.CollectCoffObjectMembers(objectOffsets, objectNames);
+
+      CollectObjectTables(file, objectOffsets, false, tables);
+      CollectArchiveMemberTable(file, nodeTreeBuilder.MemberIndex(), tables);
+
+      tables.archiveFormatText = nodeTreeBuilder.MemberIndex().GetFormatDisplayText();
+      break;
+   }
+
+   default:
+      break;
+   }
+}
+
+void CoffFileDiff::CollectObjectTables(const File& file,
+   const std::vector<size_t>& objectOffsets, bool isImage, FileTables& tables)
+{
+   tables.numberOfObjects = objectOffsets.size();
+
+   if (objectOffsets.empty())
+      return;
+
+   /// sections and external definitions of a chunk of objects
+   struct ChunkTables
+   {
+      std::unordered_map<CString, ULONGLONG, CStringHash> sections;
+      std::vector<CoffExternalDefinition> definitions;
+      ULONGLONG totalSectionSize = 0;
+   };
+
+   // each chunk of objects is collected into its own tables, so that no
+   // locking is needed while the objects are processed
+   size_t numberOfChunks = std::min<size_t>(objectOffsets.size(),
+      std::max(1U, std::thread::hardware_concurrency()));
+
+   std::vector<ChunkTables> chunkTables(numberOfChunks);
+
+   std::vector<size_t> chunks(numberOfChunks);
+   std::iota(chunks.begin(), chunks.end(), 0);
+
+   std::for_each(std::execution::par, chunks.begin(), chunks.end(),
+      [&](size_t chunk)
+      {
+         ChunkTables& currentTables = chunkTables[chunk];
+         std::vector<CoffSectionSize> sectionSizes;
+
+         for (size_t index = chunk; index < objectOffsets.size(); index += numberOfChunks)
+         {
+            CoffObjectNodeTreeBuilder nodeTreeBuilder{ file, objectOffsets[index], isImage };
+
+            sectionSizes.clear();
+            nodeTreeBuilder.CollectSectionSizes(sectionSizes);
+
+            for (const CoffSectionSize& sectionSize : sectionSizes)
+            {
+               currentTables.sections[sectionSize.sectionName] += sectionSize.size;
+               currentTables.totalSectionSize += sectionSize.size;
+            }
+
+            nodeTreeBuilder.CollectExternalDefinitions(currentTables.definitions);
+         }
+      });
+
+   size_t numberOfDefinitions = 0;
+   for (const ChunkTables& currentTables : chunkTables)
+      numberOfDefinitions += currentTables.definitions.size();
+
+   tables.symbols.reserve(numberOfDefinitions);
+
+   for (const ChunkTables& currentTables : chunkTables)
+   {
+      for (const auto& [sectionName, size] : currentTables.sections)
+         tables.sections[sectionName] += size;
+
+      tables.totalSectionSize += currentTables.totalSectionSize;
+
+      for (const CoffExternalDefinition& definition : currentTables.definitions)
+      {
+         SymbolInfo& symbolInfo = tables.symbols[definition.name];
+         symbolInfo.numberOfDefinitions++;
+
+         // only COMDAT sections belong to a single symbol, so only their
+         // lengths and checksums are attributed to the symbol
+         if (definition.selection != 0)
+         {
+            symbolInfo.numberOfComdats++;
+            symbolInfo.size += definition.sectionLength;
+            symbolInfo.checkSum += definition.checkSum;
+         }
+      }
+   }
+}
+
+void CoffFileDiff::CollectArchiveMemberTable(const File& file,
+   const ArchiveMemberIndex& memberIndex, FileTables& tables)
+{
+   std::vector<const ArchiveMember*> members;
+   for (const ArchiveMember& archiveMember : memberIndex.Members())
+   {
+      if (archiveMember.kind == ArchiveMemberKind::object)
+         members.push_back(&archiveMember);
+   }
+
+   // hashing the member contents is the most expensive part, so do it in
+   // parallel
+   std::vector<ULONGLONG> memberHashes(members.size(), 0);
+
+   std::vector<size_t> indices(members.size());
+   std::iota(indices.begin(), indices.end(), 0);
+
+   std::for_each(std::execution::par, indices.begin(), indices.end(),
+      [&](size_t index)
+      {
+         const ArchiveMember& archiveMember = *members[index];
+         if (!archiveMember.isExternal &&
+            archiveMember.dataOffset <= file.Size() &&
+            archiveMember.dataSize <= file.Size() - archiveMember.dataOffset)
+         {
+            memberHashes[index] = CalculateHash64(
+               file.Data<BYTE>(archiveMember.dataOffset),
+               archiveMember.dataSize);
+         }
+      });
+
+   tables.members.reserve(members.size());
+
+   for (size_t index = 0; index < members.size(); index++)
+   {
+      MemberInfo& memberInfo = tables.members[members[index]->name];
+      memberInfo.numberOfMembers++;
+      memberInfo.size += members[index]->dataSize;
+      memberInfo.hash += memberHashes[index];
+   }
+}
+
+void CoffFileDiff::CompareHeaders()
+{
+   switch (FileKind())
+   {
+   case CoffFileKind::object:
+      CompareStruct(_T("COFF header"), g_definitionCoffHeader,
+         m_oldFile.Data<BYTE>(), m_newFile.Data<BYTE>());
+      break;
+
+   case CoffFileKind::bigObj:
+      CompareStruct(_T("COFF header"), g_definitionAnonymousObjectHeaderBigObj,
+         m_oldFile.Data<BYTE>(), m_newFile.Data<BYTE>());
+      break;
+
+   case CoffFileKind::image:
+   {
+      PortableExecutableImage oldImage{ m_oldFile };
+      PortableExecutableImage newImage{ m_newFile };
+
+      CompareStruct(_T("DOS MZ header"), g_definitionDosMzHeader,
+         m_oldFile.Data<BYTE>(), m_newFile.Data<BYTE>());
+
+      CompareStruct(_T("COFF header"), g_definitionCoffHeader,
+         m_oldFile.Data<BYTE>(oldImage.CoffHeaderOffset()),
+         m_newFile.Data<BYTE>(newImage.CoffHeaderOffset()));
+
+      if (oldImage.Is64BitImage() != newImage.Is64BitImage())
+      {
+         CoffDiffEntry entry;
+         entry.name = _T("Optional header");
+         entry.oldValue = oldImage.Is64BitImage() ? _T("PE32+") : _T("PE32");
+         entry.newValue = newImage.Is64BitImage() ? _T("PE32+") : _T("PE32");
+         m_headerDifferences.push_back(entry);
+      }
+      else
+      {
+         CompareStruct(_T("Optional header"),
+            oldImage.Is64BitImage() ? g_definitionOptionalHeader64 : g_definitionOptionalHeader32,
+            oldImage.OptionalHeader(),
+            newImage.OptionalHeader());
+      }
+
+      break;
+   }
+
+   case CoffFileKind::archive:
+      if (m_oldTables.archiveFormatText != m_newTables.archiveFormatText)
+      {
+         CoffDiffEntry entry;
+         entry.name = _T("Archive format");
+         entry.oldValue = m_oldTables.archiveFormatText;
+         entry.newValue = m_newTables.archiveFormatText;
+         m_headerDifferences.push_back(entry);
+      }
+
+      break;
+
+   default:
+      ATLASSERT(false);
+      break;
+   }
+}
+
+void CoffFileDiff::CompareStruct(const CString& structName,
+   const StructDefinition& definition,
+   const BYTE* oldStruct, const BYTE* newStruct)
+{
+   for (const StructField& field : definition.FieldList())
+   {
+      const BYTE* oldField = oldStruct + field.m_offset;
+      const BYTE* newField = newStruct + field.m_offset;
+
+      if (memcmp(oldField, newField, field.m_length) == 0)
+         continue;
+
+      CoffDiffEntry entry;
+      entry.name = structName + _T(": ") + field.m_description;
+
+      entry.oldValue = DisplayFormatHelper::FormatValue(field, oldField);
+      entry.oldValue.Replace(_T("\n"), _T(" "));
+      entry.oldValue.Trim();
+
+      entry.newValue = DisplayFormatHelper::FormatValue(field, newField);
+      entry.newValue.Replace(_T("\n"), _T(" "));
+      entry.newValue.Trim();
+
+      m_headerDifferences.push_back(entry);
+   }
+}
+
+void CoffFileDiff::CompareSections()
+{
+   auto formatSize = [](ULONGLONG size)
+   {
+      CString sizeText;
+      sizeText.Format(_T("%llu"), size);
+      return sizeText;
+   };
+
+   JoinTables(m_oldTables.sections, m_newTables.sections,
+      [&](const CString& sectionName, ULONGLONG oldSize, ULONGLONG newSize)
+      {
+         if (oldSize != newSize)
+            m_sectionDifferences.push_back(CoffDiffEntry{ sectionName, CoffDiffChange::changed,
+               formatSize(oldSize), formatSize(newSize),
+               static_cast<LONGLONG>(newSize - oldSize) });
+      },
+      [&](const CString& sectionName, ULONGLONG newSize)
+      {
+         m_sectionDifferences.push_back(CoffDiffEntry{ sectionName, CoffDiffChange::added,
+            CString{}, formatSize(newSize), static_cast<LONGLONG>(newSize) });
+      },
+      [&](const CString& sectionName, ULONGLONG oldSize)
+      {
+         m_sectionDifferences.push_back(CoffDiffEntry{ sectionName, CoffDiffChange::removed,
+            formatSize(oldSize), CString{}, -static_cast<LONGLONG>(oldSize) });
+      });
+
+   SortBySizeDelta(m_sectionDifferences);
+}
+
+void CoffFileDiff::CompareSymbols()
+{
+   auto formatName = [](std::string_view name)
+   {
+      return CString{ name.data(), static_cast<int>(name.size()) };
+   };
+
+   auto formatValue = [](const SymbolInfo& symbolInfo)
+   {
+      return FormatSymbolValue(symbolInfo.numberOfDefinitions,
+         symbolInfo.numberOfComdats, symbolInfo.size);
+   };
+
+   JoinTables(m_oldTables.symbols, m_newTables.symbols,
+      [&](std::string_view name, const SymbolInfo& oldInfo, const SymbolInfo& newInfo)
+      {
+         if (oldInfo.numberOfDefinitions != newInfo.numberOfDefinitions ||
+            oldInfo.numberOfComdats != newInfo.numberOfComdats ||
+            oldInfo.size != newInfo.size ||
+            oldInfo.checkSum != newInfo.checkSum)
+         {
+            m_symbolDifferences.push_back(CoffDiffEntry{ formatName(name), CoffDiffChange::changed,
+               formatValue(oldInfo), formatValue(newInfo),
+               static_cast<LONGLONG>(newInfo.size - oldInfo.size) });
+         }
+      },
+      [&](std::string_view name, const SymbolInfo& newInfo)
+      {
+         m_symbolDifferences.push_back(CoffDiffEntry{ formatName(name), CoffDiffChange::added,
+            CString{}, formatValue(newInfo), static_cast<LONGLONG>(newInfo.size) });
+      },
+      [&](std::string_view name, const SymbolInfo& oldInfo)
+      {
+         m_symbolDifferences.push_back(CoffDiffEntry{ formatName(name), CoffDiffChange::removed,
+            formatValue(oldInfo), CString{}, -static_cast<LONGLONG>(oldInfo.size) });
+      });
+
+   SortBySizeDelta(m_symbolDifferences);
+}
+
+void CoffFileDiff::CompareMembers()
+{
+   auto formatValue = [](const MemberInfo& memberInfo)
+   {
+      return FormatMemberValue(memberInfo.numberOfMembers, memberInfo.size, memberInfo.hash);
+   };
+
+   JoinTables(m_oldTables.members, m_newTables.members,
+      [&](const CString& name, const MemberInfo& oldInfo, const MemberInfo& newInfo)
+      {
+         if (oldInfo.numberOfMembers != newInfo.numberOfMembers ||
+            oldInfo.size != newInfo.size ||
+            oldInfo.hash != newInfo.hash)
+         {
+            m_memberDifferences.push_back(CoffDiffEntry{ name, CoffDiffChange::changed,
+               formatValue(oldInfo), formatValue(newInfo),
+               static_cast<LONGLONG>(newInfo.size - oldInfo.size) });
+         }
+      },
+      [&](const CString& name, const MemberInfo& newInfo)
+      {
+         m_memberDifferences.push_back(CoffDiffEntry{ name, CoffDiffChange::added,
+            CString{}, formatValue(newInfo), static_cast<LONGLONG>(newInfo.size) });
+      },
+      [&](const CString& name, const MemberInfo& oldInfo)
+      {
+         m_memberDifferences.push_back(CoffDiffEntry{ name, CoffDiffChange::removed,
+            formatValue(oldInfo), CString{}, -static_cast<LONGLONG>(oldInfo.size) });
+      });
+
+   SortBySizeDelta(m_memberDifferences);
+}
+
+template <typename TTable, typename TCompareFunc, typename TAddedFunc, typename TRemovedFunc>
+void CoffFileDiff::JoinTables(const TTable& oldTable, const TTable& newTable,
+   TCompareFunc compareFunc, TAddedFunc addedFunc, TRemovedFunc removedFunc)
+{
+   // probe the old table with all keys of the new table; keys not found are
+   // added, and keys found are compared
+   for (const auto& [key, newValue] : newTable)
+   {
+      auto iter = oldTable.find(key);
+      if (iter == oldTable.end())
+         addedFunc(key, newValue);
+      else
+         compareFunc(key, iter->second, newValue);
+   }
+
+   // probe the new table with all keys of the old table, to find the keys
+   // that were removed
+   for (const auto& [key, oldValue] : oldTable)
+   {
+      if (newTable.find(key) == newTable.end())
+         removedFunc(key, oldValue);
+   }
+}
+
+void CoffFileDiff::SortBySizeDelta(std::vector<CoffDiffEntry>& differences)
+{
+   std::sort(differences.begin(), differences.end(),
+      [](const CoffDiffEntry& lhs, const CoffDiffEntry& rhs)
+      {
+         ULONGLONG lhsSizeDelta = static_cast<ULONGLONG>(std::abs(lhs.sizeDelta));
+         ULONGLONG rhsSizeDelta = static_cast<ULONGLONG>(std::abs(rhs.sizeDelta));
+
+         if (lhsSizeDelta != rhsSizeDelta)
+            return lhsSizeDelta > rhsSizeDelta;
+
+         return lhs.name < rhs.name;
+      });
+}
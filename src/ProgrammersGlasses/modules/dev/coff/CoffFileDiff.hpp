@@ -0,0 +1,233 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffFileDiff.hpp
+/// \brief Structural comparison of two COFF objects, libraries or PE images
+//
+#pragma once
+
+#include "File.hpp"
+#include <string_view>
+#include <unordered_map>
+
+class StructDefinition;
+class ArchiveMemberIndex;
+
+/// \brief Kind of file that is compared
+enum class CoffFileKind
+{
+   unknown,    ///< unsupported file, e.g. a short import object
+   object,     ///< COFF object file
+   bigObj,     ///< COFF object file using the /bigobj format
+   archive,    ///< "ar" archive library file
+   image,      ///< Portable Executable image
+};
+
+/// \brief Kind of change of a single compared item
+enum class CoffDiffChange
+{
+   added,      ///< item only exists in the new file
+   removed,    ///< item only exists in the old file
+   changed,    ///< item exists in both files, but differs
+};
+
+/// \brief Single difference between the two compared files
+struct CoffDiffEntry
+{
+   /// name of the header field, section, symbol or archive member
+   CString name;
+
+   /// kind of change
+   CoffDiffChange change = CoffDiffChange::changed;
+
+   /// value in the old file; empty for added items
+   CString oldValue;
+
+   /// value in the new file; empty for removed items
+   CString newValue;
+
+   /// difference of the size in bytes, from the old to the new file
+   LONGLONG sizeDelta = 0;
+};
+
+/// \brief Structural comparison of two COFF objects, libraries or PE images
+/// \details Compares the headers field by field, using the struct
+/// definitions, and the sections, external symbols and archive members by
+/// name. The sections and symbols of all objects are collected in parallel,
+/// and each file's items are aggregated in hash tables by name; the tables of
+/// both files are then joined by probing one table with the other table's
+/// names, so that the comparison time grows linearly with the number of
+/// items. The differences are ordered by the size difference, so that the
+/// items that grew or shrank the most come first.
+class CoffFileDiff
+{
+public:
+   /// determines the kind of a file
+   static CoffFileKind GetFileKind(const File& file);
+
+   /// returns a display text for a file kind
+   static LPCTSTR GetFileKindDisplayText(CoffFileKind fileKind);
+
+   /// returns a display text for a change kind
+   static LPCTSTR GetChangeDisplayText(CoffDiffChange change);
+
+   /// ctor
+   CoffFileDiff(const File& oldFile, const File& newFile);
+
+   /// compares both files; when the files can't be compared, the error
+   /// text is set
+   void Compare();
+
+   /// returns the old file
+   const File& OldFile() const { return m_oldFile; }
+
+   /// returns the new file
+   const File& NewFile() const { return m_newFile; }
+
+   /// returns the kind of the compared files
+   CoffFileKind FileKind() const { return m_oldTables.fileKind; }
+
+   /// returns an error text, when the files couldn't be compared
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the header field differences, in field order
+   const std::vector<CoffDiffEntry>& HeaderDifferences() const { return m_headerDifferences; }
+
+   /// returns the section differences, ordered by size difference
+   const std::vector<CoffDiffEntry>& SectionDifferences() const { return m_sectionDifferences; }
+
+   /// returns the external symbol differences, ordered by size difference
+   const std::vector<CoffDiffEntry>& SymbolDifferences() const { return m_symbolDifferences; }
+
+   /// returns the archive member differences, ordered by size difference
+   const std::vector<CoffDiffEntry>& MemberDifferences() const { return m_memberDifferences; }
+
+   /// formats a summary of the comparison
+   CString FormatSummary() const;
+
+   /// formats all differences as text, e.g. for console output
+   CString FormatDifferences() const;
+
+private:
+   /// hash function for CString keys
+   struct CStringHash
+   {
+      /// calculates hash of the string
+      size_t operator()(const CString& text) const
+      {
+         return std::hash<std::basic_string_view<TCHAR>>{}(
+            std::basic_string_view<TCHAR>{ text.GetString(), static_cast<size_t>(text.GetLength()) });
+      }
+   };
+
+   /// aggregated external definitions of a symbol name
+   struct SymbolInfo
+   {
+      size_t numberOfDefinitions = 0;  ///< number of definitions
+      size_t numberOfComdats = 0;      ///< number of COMDAT definitions
+      ULONGLONG size = 0;              ///< summed up COMDAT section lengths
+      ULONGLONG checkSum = 0;          ///< summed up COMDAT section checksums
+   };
+
+   /// aggregated archive members with the same name
+   struct MemberInfo
+   {
+      size_t numberOfMembers = 0;      ///< number of members
+      ULONGLONG size = 0;              ///< summed up member sizes
+      ULONGLONG hash = 0;              ///< summed up member content hashes
+   };
+
+   /// hash tables with all items of a single file
+   struct FileTables
+   {
+      /// file kind
+      CoffFileKind fileKind = CoffFileKind::unknown;
+
+      /// number of COFF objects
+      size_t numberOfObjects = 0;
+
+      /// total size of all sections
+      ULONGLONG totalSectionSize = 0;
+
+      /// archive format display text; empty for other file kinds
+      CString archiveFormatText;
+
+      /// section sizes, by section name
+      std::unordered_map<CString, ULONGLONG, CStringHash> sections;
+
+      /// external definitions, by symbol name; the names reference the
+      /// mapped file
+      std::unordered_map<std::string_view, SymbolInfo> symbols;
+
+      /// archive members, by member name
+      std::unordered_map<CString, MemberInfo, CStringHash> members;
+   };
+
+   /// collects all items of a file into hash tables
+   static void CollectTables(const File& file, FileTables& tables);
+
+   /// collects sections and external definitions of COFF objects, in parallel
+   static void CollectObjectTables(const File& file,
+      const std::vector<size_t>& objectOffsets, bool isImage, FileTables& tables);
+
+   /// collects all "ar" archive members, including their content hashes
+   static void CollectArchiveMemberTable(const File& file,
+      const ArchiveMemberIndex& memberIndex, FileTables& tables);
+
+   /// compares the headers of both files
+   void CompareHeaders();
+
+   /// compares two structs field by field
+   void CompareStruct(const CString& structName,
+      const StructDefinition& definition,
+      const BYTE* oldStruct, const BYTE* newStruct);
+
+   /// compares the sections of both files
+   void CompareSections();
+
+   /// compares the external symbols of both files
+   void CompareSymbols();
+
+   /// compares the archive members of both files
+   void CompareMembers();
+
+   /// joins two hash tables by key; calls the compare function for each key
+   /// that is in both tables, and the added and removed functions for keys
+   /// only in one of the tables
+   template <typename TTable, typename TCompareFunc, typename TAddedFunc, typename TRemovedFunc>
+   static void JoinTables(const TTable& oldTable, const TTable& newTable,
+      TCompareFunc compareFunc, TAddedFunc addedFunc, TRemovedFunc removedFunc);
+
+   /// sorts differences by the absolute size difference, descending, then
+   /// by name
+   static void SortBySizeDelta(std::vector<CoffDiffEntry>& differences);
+
+private:
+   /// old file
+   File m_oldFile;
+
+   /// new file
+   File m_newFile;
+
+   /// tables of the old file
+   FileTables m_oldTables;
+
+   /// tables of the new file
+   FileTables m_newTables;
+
+   /// error text
+   CString m_errorText;
+
+   /// header field differences
+   std::vector<CoffDiffEntry> m_headerDifferences;
+
+   /// section differences
+   std::vector<CoffDiffEntry> m_sectionDifferences;
+
+   /// external symbol differences
+   std::vector<CoffDiffEntry> m_symbolDifferences;
+
+   /// archive member differences
+   std::vector<CoffDiffEntry> m_memberDifferences;
+};
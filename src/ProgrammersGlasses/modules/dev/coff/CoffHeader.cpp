@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file CoffHeader.cpp
 /// \brief header definition of COFF files
@@ -14,6 +14,8 @@ const std::map<DWORD, LPCTSTR> g_mapCoffTargetMachineToDisplayText =
    { 0x0, _T("IMAGE_FILE_MACHINE_UNKNOWN")},
    { 0x1d3, _T("IMAGE_FILE_MACHINE_AM33 (Matsushita AM33)") },
    { 0x8664, _T("IMAGE_FILE_MACHINE_AMD64 (x64)") },
+   { 0xaa64, _T("IMAGE_FILE_MACHINE_ARM64 (ARM64 little endian)") },
+   { 0xa641, _T("IMAGE_FILE_MACHINE_ARM64EC (ARM64EC)") },
    { 0x1c0, _T("IMAGE_FILE_MACHINE_ARM (ARM little endian)") },
    { 0x1c4, _T("IMAGE_FILE_MACHINE_ARMV7 (ARMv7(or higher) Thumb mode only)") },
    { 0xebc, _T("IMAGE_FILE_MACHINE_EBC (EFI byte code)") },
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file CoffModule.cpp
 /// \brief module to load COFF files
@@ -8,6 +8,8 @@
 #include "stdafx.h"
 #include "CoffModule.hpp"
 #include "CoffReader.hpp"
+#include "CoffDiffReader.hpp"
+#include "CoffSymbolConflictsReader.hpp"
 #include "NonCoffObjectNodeTreeBuilder.hpp"
 
 CString CoffModule::DisplayName() const
@@ -36,3 +38,13 @@ std::shared_ptr<IReader> CoffModule::OpenReader(const File& file) const
 {
    return std::make_shared<CoffReader>(file);
 }
+
+std::shared_ptr<IReader> CoffModule::OpenDiffReader(const File& oldFile, const File& newFile) const
+{
+   return std::make_shared<CoffDiffReader>(oldFile, newFile);
+}
+
+std::shared_ptr<IReader> CoffModule::OpenSymbolConflictsReader(const std::vector<File>& files) const
+{
+   return std::make_shared<CoffSymbolConflictsReader>(files);
+}
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file CoffModule.hpp
 /// \brief module to load COFF files
@@ -23,4 +23,6 @@ public:
    CString FilterStrings() const override;
    bool IsModuleApplicableForFile(const File& file) const override;
    std::shared_ptr<IReader> OpenReader(const File& file) const override;
+   std::shared_ptr<IReader> OpenDiffReader(const File& oldFile, const File& newFile) const override;
+   std::shared_ptr<IReader> OpenSymbolConflictsReader(const std::vector<File>& files) const override;
 };
@@ -1,29 +1,383 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020-2023 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file CoffObjectNodeTreeBuilder.cpp
-/// \brief Node tree builder for for COFF object files
+/// \brief Node tree builder for COFF object files
 //
 #include "stdafx.h"
 #include "CoffObjectNodeTreeBuilder.hpp"
 #include "CodeTextViewNode.hpp"
 #include "FilterSortListViewNode.hpp"
 #include "CoffHeader.hpp"
+#include "AnonymousObjectHeaderBigObj.hpp"
 #include "SectionHeader.hpp"
 #include "CoffSymbolTable.hpp"
+#include "CoffRelocation.hpp"
+#include "CoffSymbolNameLookup.hpp"
+#include "CoffAuxSymbol.hpp"
+#include "CoffComdatGraph.hpp"
+#include "CoffSymbolConflictAnalyzer.hpp"
+#include "CoffSectionSizeTree.hpp"
 #include "DisplayFormatHelper.hpp"
 #include "SymbolsHelper.hpp"
 #include "StringListIterator.hpp"
 #include "StructListViewNode.hpp"
+#include "HexDataViewNode.hpp"
+#include "dev/dwarf/DwarfDataReader.hpp"
+#include "dev/dwarf/DwarfReader.hpp"
+#include "dev/dwarf/DwarfNodeTreeBuilder.hpp"
+#include "dev/codeview/CodeViewReader.hpp"
+#include "dev/codeview/CodeViewNodeTreeBuilder.hpp"
+#include <mutex>
+
+bool CoffObjectNodeTreeBuilder::IsBigObjCoffObject(const File& file, size_t fileOffset)
+{
+   if (file.Size() < fileOffset + sizeof(AnonymousObjectHeaderBigObj))
+      return false;
+
+   const AnonymousObjectHeaderBigObj& header =
+      *file.Data<AnonymousObjectHeaderBigObj>(fileOffset);
+
+   return
+      header.signature1 == IMAGE_FILE_MACHINE_UNKNOWN &&
+      header.signature2 == IMPORT_OBJECT_HDR_SIG2 &&
+      header.version == 2 &&
+      memcmp(&header.classID, c_bigObjClassID, sizeof(c_bigObjClassID)) == 0;
+}
 
 CoffObjectNodeTreeBuilder::CoffObjectNodeTreeBuilder(
    const File& file, size_t fileOffset, bool isImage)
    :m_file(file),
    m_fileOffset(fileOffset),
-   m_coffObjectHeader(*m_file.Data<CoffHeader>(fileOffset)),
-   m_isImage(isImage)
+   m_isImage(isImage),
+   m_isBigObj(!isImage && IsBigObjCoffObject(file, fileOffset)),
+   m_coffObjectHeader(m_file.Data<BYTE>(fileOffset))
+{
+   // BigObj COFF objects only differ in the header and the symbol record
+   // layout; sections, relocations and the string table are the same
+   if (m_isBigObj)
+   {
+      const auto& header = *static_cast<const AnonymousObjectHeaderBigObj*>(m_coffObjectHeader);
+
+      m_targetMachine = header.targetMachine;
+      m_numberOfSections = header.numberOfSections;
+      m_sectionTableOffset = sizeof(AnonymousObjectHeaderBigObj);
+      m_offsetSymbolTable = header.pointerToSymbolTable;
+      m_numberOfSymbols = header.numberOfSymbols;
+      m_symbolSize = sizeof(CoffSymbolTableBigObj);
+   }
+   else
+   {
+      const auto& header = *static_cast<const CoffHeader*>(m_coffObjectHeader);
+
+      m_targetMachine = header.targetMachine;
+      m_numberOfSections = header.numberOfSections;
+      m_sectionTableOffset = sizeof(CoffHeader) + header.optionalHeaderSize;
+      m_offsetSymbolTable = header.offsetSymbolTable;
+      m_numberOfSymbols = header.numberOfSymbols;
+      m_symbolSize = sizeof(CoffSymbolTable);
+   }
+
+   // the relocation and COMDAT nodes look up symbol names only when shown
+   m_symbolNameLookup = std::make_shared<CoffSymbolNameLookup>(
+      m_file,
+      m_fileOffset + m_offsetSymbolTable,
+      m_offsetSymbolTable != 0 ? m_numberOfSymbols : 0,
+      m_symbolSize);
+}
+
+void CoffObjectNodeTreeBuilder::CollectExternalDefinitions(
+   std::vector<CoffExternalDefinition>& definitions) const
+{
+   if (m_isBigObj)
+      CollectExternalDefinitionsFromSymbolTable<CoffSymbolTableBigObj>(definitions);
+   else
+      CollectExternalDefinitionsFromSymbolTable<CoffSymbolTable>(definitions);
+}
+
+template <typename TSymbol>
+void CoffObjectNodeTreeBuilder::CollectExternalDefinitionsFromSymbolTable(
+   std::vector<CoffExternalDefinition>& definitions) const
+{
+   size_t symbolTableOffset = m_fileOffset + m_offsetSymbolTable;
+   if (m_offsetSymbolTable == 0 ||
+      symbolTableOffset >= m_file.Size())
+      return;
+
+   size_t numberOfSymbols = std::min(m_numberOfSymbols,
+      (m_file.Size() - symbolTableOffset) / sizeof(TSymbol));
+
+   const TSymbol* symbols = m_file.Data<TSymbol>(symbolTableOffset);
+
+   // the string table directly follows the symbol table
+   size_t stringTableOffset = symbolTableOffset + numberOfSymbols * sizeof(TSymbol);
+   size_t stringTableSize = 0;
+   if (numberOfSymbols == m_numberOfSymbols &&
+      stringTableOffset + sizeof(DWORD) <= m_file.Size())
+   {
+      stringTableSize = std::min<size_t>(
+         *m_file.Data<DWORD>(stringTableOffset),
+         m_file.Size() - stringTableOffset);
+   }
+
+   const CHAR* stringTable = m_file.Data<CHAR>(stringTableOffset);
+
+   // section definitions by section number; the external symbols of a
+   // section may precede the section definition, so resolve them afterwards
+   std::vector<const CoffAuxSectionDefinition*> sectionDefinitions(GetNumberOfSectionsInFile() + 1, nullptr);
+   std::vector<size_t> definitionSectionNumbers;
+
+   size_t firstDefinitionIndex = definitions.size();
+
+   for (size_t symbolIndex = 0; symbolIndex < numberOfSymbols;
+      symbolIndex += 1 + symbols[symbolIndex].numberOfAuxSymbols)
+   {
+      const TSymbol& symbol = symbols[symbolIndex];
+
+      using SectionNumberType = std::make_signed_t<decltype(TSymbol::sectionNumber)>;
+      auto sectionNumber = static_cast<SectionNumberType>(symbol.sectionNumber);
+
+      // undefined, absolute and debug symbols don't define anything
+      if (sectionNumber <= 0 ||
+         static_cast<size_t>(sectionNumber) >= sectionDefinitions.size())
+         continue;
+
+      if (symbol.storageClass == c_coffStorageClassStatic &&
+         symbol.value == 0 &&
+         symbol.type == 0 &&
+         symbol.numberOfAuxSymbols > 0 &&
+         symbolIndex + 1 < numberOfSymbols)
+      {
+         if (sectionDefinitions[sectionNumber] == nullptr)
+            sectionDefinitions[sectionNumber] =
+               reinterpret_cast<const CoffAuxSectionDefinition*>(&symbols[symbolIndex + 1]);
+      }
+      else if (symbol.storageClass == c_coffStorageClassExternal)
+      {
+         CoffExternalDefinition definition;
+
+         // long names start with 4 zero bytes, followed by the string table offset
+         if (*reinterpret_cast<const DWORD*>(symbol.name) == 0)
+         {
+            size_t nameOffset = *reinterpret_cast<const DWORD*>(symbol.name + 4);
+            if (nameOffset < sizeof(DWORD) || nameOffset >= stringTableSize)
+               continue;
+
+            definition.name = std::string_view{ stringTable + nameOffset,
+               strnlen(stringTable + nameOffset, stringTableSize - nameOffset) };
+         }
+         else
+            definition.name = std::string_view{ symbol.name, strnlen(symbol.name, sizeof(symbol.name)) };
+
+         definitions.push_back(definition);
+         definitionSectionNumbers.push_back(static_cast<size_t>(sectionNumber));
+      }
+   }
+
+   for (size_t index = 0; index < definitionSectionNumbers.size(); index++)
+   {
+      const CoffAuxSectionDefinition* sectionDefinition = sectionDefinitions[definitionSectionNumbers[index]];
+      if (sectionDefinition == nullptr)
+         continue;
+
+      CoffExternalDefinition& definition = definitions[firstDefinitionIndex + index];
+      definition.selection = sectionDefinition->selection;
+      definition.sectionLength = sectionDefinition->length;
+      definition.checkSum = sectionDefinition->checkSum;
+   }
+}
+
+void CoffObjectNodeTreeBuilder::CollectSectionSizes(
+   std::vector<CoffSectionSize>& sectionSizes) const
+{
+   size_t numberOfSections = GetNumberOfSectionsInFile();
+
+   CoffComdatGraph comdatGraph{ numberOfSections };
+
+   if (!m_isImage &&
+      m_offsetSymbolTable != 0)
+   {
+      if (m_isBigObj)
+         CollectComdatSections<CoffSymbolTableBigObj>(comdatGraph);
+      else
+         CollectComdatSections<CoffSymbolTable>(comdatGraph);
+   }
+
+   const SectionHeader* sectionHeaders =
+      m_file.Data<SectionHeader>(m_fileOffset + m_sectionTableOffset);
+
+   for (size_t sectionIndex = 0; sectionIndex < numberOfSections; sectionIndex++)
+   {
+      const SectionHeader& sectionHeader = sectionHeaders[sectionIndex];
+
+      CoffSectionSize sectionSize;
+      sectionSize.sectionName = GetSectionName(sectionHeader);
+      sectionSize.size = sectionHeader.sizeOfRawData;
+
+      // associative sections, e.g. unwind infos, belong to the COMDAT
+      // symbol of their leader section
+      size_t leaderSection = comdatGraph.LeaderSection(sectionIndex + 1);
+      size_t comdatSymbolIndex = leaderSection != CoffComdatGraph::c_none
+         ? comdatGraph.ComdatSymbolIndex(leaderSection)
+         : CoffComdatGraph::c_none;
+
+      if (comdatSymbolIndex != CoffComdatGraph::c_none)
+         sectionSize.comdatSymbolName = m_symbolNameLookup->GetSymbolName(comdatSymbolIndex);
+
+      sectionSizes.push_back(sectionSize);
+   }
+}
+
+template <typename TSymbol>
+void CoffObjectNodeTreeBuilder::CollectComdatSections(CoffComdatGraph& comdatGraph) const
+{
+   size_t symbolTableOffset = m_fileOffset + m_offsetSymbolTable;
+   if (symbolTableOffset >= m_file.Size())
+      return;
+
+   size_t numberOfSymbols = std::min(m_numberOfSymbols,
+      (m_file.Size() - symbolTableOffset) / sizeof(TSymbol));
+
+   const TSymbol* symbols = m_file.Data<TSymbol>(symbolTableOffset);
+
+   for (size_t symbolIndex = 0; symbolIndex < numberOfSymbols;
+      symbolIndex += 1 + symbols[symbolIndex].numberOfAuxSymbols)
+   {
+      const TSymbol& symbol = symbols[symbolIndex];
+
+      using SectionNumberType = std::make_signed_t<decltype(TSymbol::sectionNumber)>;
+      auto sectionNumber = static_cast<SectionNumberType>(symbol.sectionNumber);
+
+      if (sectionNumber <= 0)
+         continue;
+
+      if (symbol.storageClass == c_coffStorageClassStatic &&
+         symbol.value == 0 &&
+         symbol.type == 0 &&
+         symbol.numberOfAuxSymbols > 0 &&
+         symbolIndex + 1 < numberOfSymbols)
+      {
+         const auto& sectionDefinition =
+            *reinterpret_cast<const CoffAuxSectionDefinition*>(&symbols[symbolIndex + 1]);
+
+         size_t associatedSectionNumber = sectionDefinition.number;
+         if (m_isBigObj)
+            associatedSectionNumber |= static_cast<size_t>(sectionDefinition.highNumber) << 16;
+
+         comdatGraph.AddSectionDefinition(static_cast<size_t>(sectionNumber), symbolIndex,
+            sectionDefinition.selection, associatedSectionNumber);
+      }
+      else
+         comdatGraph.AddSectionSymbol(static_cast<size_t>(sectionNumber), symbolIndex);
+   }
+}
+
+ULONGLONG CoffObjectNodeTreeBuilder::GetTotalSectionSize() const
+{
+   size_t numberOfSections = GetNumberOfSectionsInFile();
+
+   const SectionHeader* sectionHeaders =
+      m_file.Data<SectionHeader>(m_fileOffset + m_sectionTableOffset);
+
+   ULONGLONG totalSize = 0;
+   for (size_t sectionIndex = 0; sectionIndex < numberOfSections; sectionIndex++)
+      totalSize += sectionHeaders[sectionIndex].sizeOfRawData;
+
+   return totalSize;
+}
+
+void CoffObjectNodeTreeBuilder::AddSectionSizeNodes(StaticNode& node,
+   SectionSizeTreeProvider sectionSizeTreeProvider)
 {
+   /// section size tree, created when one of the nodes is shown the first time
+   struct LazySectionSizeTree
+   {
+      std::once_flag onceFlag;
+      SectionSizeTreeProvider provider;
+      std::shared_ptr<const CoffSectionSizeTree> sectionSizeTree;
+
+      /// creates the section size tree on first call
+      const CoffSectionSizeTree& Get()
+      {
+         std::call_once(onceFlag,
+            [this]()
+            {
+               sectionSizeTree = provider();
+               provider = nullptr;
+            });
+
+         return *sectionSizeTree;
+      }
+   };
+
+   auto lazySectionSizeTree = std::make_shared<LazySectionSizeTree>();
+   lazySectionSizeTree->provider = std::move(sectionSizeTreeProvider);
+
+   static std::vector<CString> sectionSizesColumnNames
+   {
+      _T("Section"),
+      _T("Object"),
+      _T("COMDAT symbol"),
+      _T("Size"),
+      _T("Share"),
+   };
+
+   // the rows are formatted from the ordered entries; parent entries have
+   // empty object or symbol names
+   node.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Section Sizes"),
+         NodeTreeIconID::nodeTreeIconTable,
+         sectionSizesColumnNames,
+         [lazySectionSizeTree]()
+         {
+            const CoffSectionSizeTree& sectionSizeTree = lazySectionSizeTree->Get();
+
+            std::vector<std::vector<CString>> listData;
+            listData.reserve(sectionSizeTree.Entries().size());
+
+            for (const auto& [path, size] : sectionSizeTree.Entries())
+            {
+               CString sizeText;
+               sizeText.Format(_T("%llu"), size);
+
+               CString shareText;
+               if (sectionSizeTree.TotalSize() > 0)
+                  shareText.Format(_T("%.2f %%"), 100.0 * size / sectionSizeTree.TotalSize());
+
+               listData.push_back(
+                  std::vector<CString> {
+                  path.sectionName,
+                     path.objectName,
+                     path.symbolName,
+                     sizeText,
+                     shareText,
+               });
+            }
+
+            return listData;
+         },
+         true));
+
+   node.ChildNodes().push_back(
+      std::make_shared<CodeTextViewNode>(
+         _T("Section Sizes JSON"),
+         NodeTreeIconID::nodeTreeIconDocument,
+         [lazySectionSizeTree]()
+         {
+            return lazySectionSizeTree->Get().FormatJson(_T("sections"));
+         }));
+}
+
+size_t CoffObjectNodeTreeBuilder::GetNumberOfSectionsInFile() const
+{
+   size_t sectionTableOffset = m_fileOffset + m_sectionTableOffset;
+   if (sectionTableOffset >= m_file.Size())
+      return 0;
+
+   return std::min(m_numberOfSections,
+      (m_file.Size() - sectionTableOffset) / sizeof(SectionHeader));
 }
 
 std::shared_ptr<INode> CoffObjectNodeTreeBuilder::BuildCoffObjectNode()
@@ -42,35 +396,44 @@ std::shared_ptr<INode> CoffObjectNodeTreeBuilder::BuildCoffObjectNode()
 void CoffObjectNodeTreeBuilder::AddCoffObjectFile(
    CodeTextViewNode& coffSummaryNode)
 {
-   m_objectFileSummary = _T("COFF object file\n");
+   m_objectFileSummary = m_isBigObj
+      ? _T("BigObj COFF object file\n")
+      : _T("COFF object file\n");
 
    m_objectFileSummary += CString{ _T("Architecture: ") } +
       GetValueFromMapOrDefault<DWORD>(
          g_mapCoffTargetMachineToDisplayText,
-         (DWORD)m_coffObjectHeader.targetMachine,
+         (DWORD)m_targetMachine,
          _T("unknown"));
    m_objectFileSummary += _T("\n");
 
    auto coffHeaderNode = std::make_shared<StructListViewNode>(
-      _T("COFF header"),
+      m_isBigObj ? _T("BigObj COFF header") : _T("COFF header"),
       NodeTreeIconID::nodeTreeIconBinary,
-      g_definitionCoffHeader,
-      &m_coffObjectHeader,
+      m_isBigObj ? g_definitionAnonymousObjectHeaderBigObj : g_definitionCoffHeader,
+      m_coffObjectHeader,
       m_file.Data());
 
    coffSummaryNode.ChildNodes().push_back(coffHeaderNode);
 
    AddSectionTable(coffSummaryNode);
 
-   if (m_coffObjectHeader.offsetSymbolTable != 0 &&
-      m_coffObjectHeader.numberOfSymbols != 0)
+   if (m_offsetSymbolTable != 0 &&
+      m_numberOfSymbols != 0)
    {
       LoadStringTable();
 
-      AddSymbolTable(coffSummaryNode);
+      if (m_isBigObj)
+         AddSymbolTable<CoffSymbolTableBigObj>(coffSummaryNode, g_definitionCoffSymbolTableBigObj);
+      else
+         AddSymbolTable<CoffSymbolTable>(coffSummaryNode, g_definitionCoffSymbolTable);
+
       AddStringTable(coffSummaryNode);
    }
 
+   AddDwarfDebugInfo(coffSummaryNode);
+   AddCodeViewDebugInfo(coffSummaryNode);
+
    AddCoffHeaderSummaryText(coffSummaryNode);
 }
 
@@ -79,44 +442,51 @@ void CoffObjectNodeTreeBuilder::AddCoffHeaderSummaryText(
 {
    CString text;
 
-   const CoffHeader& header = m_coffObjectHeader;
-
    text.Append(_T("COFF file: ") + m_file.Filename());
 
    if (m_fileOffset > 0)
       text.AppendFormat(_T(" at offset 0x%08zx"), m_fileOffset);
 
    text.Append(_T("\n\n"));
-   text.Append(_T("COFF Header\n"));
+   text.Append(m_isBigObj ? _T("BigObj COFF Header\n") : _T("COFF Header\n"));
 
    text.AppendFormat(_T("Target machine: %s (0x%04x)\n"),
       GetValueFromMapOrDefault<DWORD>(
          g_mapCoffTargetMachineToDisplayText,
-         (DWORD)m_coffObjectHeader.targetMachine,
+         (DWORD)m_targetMachine,
          _T("unknown")),
-      m_coffObjectHeader.targetMachine);
+      m_targetMachine);
 
-   text.AppendFormat(_T("Number of sections: %u\n"), header.numberOfSections);
+   text.AppendFormat(_T("Number of sections: %zu\n"), m_numberOfSections);
 
-   CString time = DisplayFormatHelper::FormatDateTime(header.timeStamp);
+   DWORD timeStamp = m_isBigObj
+      ? static_cast<const AnonymousObjectHeaderBigObj*>(m_coffObjectHeader)->timeStamp
+      : static_cast<const CoffHeader*>(m_coffObjectHeader)->timeStamp;
+
+   CString time = DisplayFormatHelper::FormatDateTime(timeStamp);
    text += time.IsEmpty()
       ? _T("Warning: Error while formatting date/time")
       : _T("Creation date/time: ") + time + _T("\n");
 
-   text.AppendFormat(_T("Symbol table offset: 0x%08x\n"), header.offsetSymbolTable);
-   text.AppendFormat(_T("Symbol table length: %u\n"), header.numberOfSymbols);
+   text.AppendFormat(_T("Symbol table offset: 0x%08zx\n"), m_offsetSymbolTable);
+   text.AppendFormat(_T("Symbol table length: %zu\n"), m_numberOfSymbols);
    if (m_isImage &&
-      (header.offsetSymbolTable != 0 ||
-         header.numberOfSymbols != 0))
+      (m_offsetSymbolTable != 0 ||
+         m_numberOfSymbols != 0))
       text.Append(_T("Warning: COFF symbol table for images is deprecated\n"));
 
-   text.AppendFormat(_T("Optional header size: %u\n"), header.optionalHeaderSize);
+   if (!m_isBigObj)
+   {
+      const CoffHeader& header = *static_cast<const CoffHeader*>(m_coffObjectHeader);
 
-   text.AppendFormat(_T("Characteristics flags: 0x%08x (%s)\n"),
-      header.characteristicsFlags,
-      DisplayFormatHelper::FormatBitFlagsFromMap(
-         g_mapCoffCharacteristicsBitsToDisplayText,
-         header.characteristicsFlags).GetString());
+      text.AppendFormat(_T("Optional header size: %u\n"), header.optionalHeaderSize);
+
+      text.AppendFormat(_T("Characteristics flags: 0x%08x (%s)\n"),
+         header.characteristicsFlags,
+         DisplayFormatHelper::FormatBitFlagsFromMap(
+            g_mapCoffCharacteristicsBitsToDisplayText,
+            header.characteristicsFlags).GetString());
+   }
 
    text += _T("\n") + m_objectFileSummary;
 
@@ -125,24 +495,25 @@ void CoffObjectNodeTreeBuilder::AddCoffHeaderSummaryText(
 
 void CoffObjectNodeTreeBuilder::AddSectionTable(StaticNode& coffSummaryNode)
 {
-   if (sizeof(m_coffObjectHeader) + m_coffObjectHeader.optionalHeaderSize + sizeof(SectionHeader) >= m_file.Size())
+   if (m_fileOffset + m_sectionTableOffset + sizeof(SectionHeader) >= m_file.Size())
    {
       m_objectFileSummary += _T("Error: section header offset is outside of the file size!");
       return;
    }
 
-   size_t maxSectionCount = static_cast<size_t>(m_coffObjectHeader.numberOfSections);
+   size_t maxSectionCount = m_numberOfSections;
 
    std::vector<std::vector<CString>> sectionTableData;
    std::vector<std::shared_ptr<INode>> sectionChildNodes;
 
+   size_t totalNumberOfRelocations = 0;
+
    const BYTE* data = m_file.Data<BYTE>(m_fileOffset);
    for (size_t sectionIndex = 0; sectionIndex < maxSectionCount; sectionIndex++)
    {
       const BYTE* sectionStart =
          data +
-         sizeof(m_coffObjectHeader) +
-         m_coffObjectHeader.optionalHeaderSize +
+         m_sectionTableOffset +
          sizeof(SectionHeader) * sectionIndex;
 
       if (!m_file.IsValidRange(sectionStart, sizeof(SectionHeader)))
@@ -155,7 +526,7 @@ void CoffObjectNodeTreeBuilder::AddSectionTable(StaticNode& coffSummaryNode)
 
       const SectionHeader& sectionHeader = *reinterpret_cast<const SectionHeader*>(sectionStart);
 
-      CString sectionName{ sectionHeader.name, sizeof(sectionHeader.name) };
+      CString sectionName = GetSectionName(sectionHeader);
 
       CString sectionIndexText;
       sectionIndexText.Format(_T("%zu"), sectionIndex + 1);
@@ -166,12 +537,22 @@ void CoffObjectNodeTreeBuilder::AddSectionTable(StaticNode& coffSummaryNode)
       CString sectionSizeText;
       sectionSizeText.Format(_T("0x%08x"), sectionHeader.sizeOfRawData);
 
+      size_t numberOfRelocations = 0;
+      std::shared_ptr<INode> relocationTableNode =
+         CreateRelocationTableNode(sectionHeader, sectionName, numberOfRelocations);
+
+      totalNumberOfRelocations += numberOfRelocations;
+
+      CString relocationCountText;
+      relocationCountText.Format(_T("%zu"), numberOfRelocations);
+
       sectionTableData.push_back(
          std::vector<CString> {
          sectionIndexText,
             sectionName,
             sectionOffsetText,
             sectionSizeText,
+            relocationCountText,
       });
 
       auto sectionHeaderNode = std::make_shared<StructListViewNode>(
@@ -182,10 +563,18 @@ void CoffObjectNodeTreeBuilder::AddSectionTable(StaticNode& coffSummaryNode)
          m_file.Data());
 
       sectionChildNodes.push_back(sectionHeaderNode);
+
+      AddSectionContentNodes(sectionHeader, sectionName, sectionChildNodes);
+
+      if (relocationTableNode != nullptr)
+         sectionChildNodes.push_back(relocationTableNode);
    }
 
-   m_objectFileSummary.AppendFormat(_T("Section table with %u entries.\n"),
-      m_coffObjectHeader.numberOfSections);
+   m_objectFileSummary.AppendFormat(_T("Section table with %zu entries.\n"),
+      m_numberOfSections);
+
+   if (totalNumberOfRelocations > 0)
+      m_objectFileSummary.AppendFormat(_T("Relocations: %zu\n"), totalNumberOfRelocations);
 
    static std::vector<CString> sectionTableColumnNames
    {
@@ -193,6 +582,7 @@ void CoffObjectNodeTreeBuilder::AddSectionTable(StaticNode& coffSummaryNode)
       _T("Section name"),
       _T("Offset"),
       _T("Size"),
+      _T("Relocations"),
    };
 
    auto sectionTableNode = std::make_shared<FilterSortListViewNode>(
@@ -207,12 +597,293 @@ void CoffObjectNodeTreeBuilder::AddSectionTable(StaticNode& coffSummaryNode)
    coffSummaryNode.ChildNodes().push_back(sectionTableNode);
 }
 
+CString CoffObjectNodeTreeBuilder::GetSectionName(const SectionHeader& sectionHeader) const
+{
+   CString sectionName{ sectionHeader.name, static_cast<int>(strnlen(sectionHeader.name, sizeof(sectionHeader.name))) };
+
+   if (sectionName.Find(_T('/')) != 0 ||
+      sectionName.GetLength() < 2)
+      return sectionName;
+
+   size_t stringTableOffset = 0;
+   if (sectionName[1] == _T('/'))
+   {
+      // string table offsets above 9999999 are stored as base64 with "//" prefix
+      static const CString s_base64Chars{ _T("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/") };
+
+      for (int pos = 2; pos < sectionName.GetLength(); pos++)
+      {
+         int value = s_base64Chars.Find(sectionName[pos]);
+         if (value < 0)
+            return sectionName;
+
+         stringTableOffset = stringTableOffset * 64 + static_cast<size_t>(value);
+      }
+   }
+   else
+      stringTableOffset = _tcstoul(sectionName.Mid(1), nullptr, 10);
+
+   CString longName = m_symbolNameLookup->GetString(stringTableOffset);
+
+   return longName.IsEmpty() ? sectionName : longName;
+}
+
+/// \brief Formats linker directives, one directive per line
+/// \details Directives are separated by spaces; arguments containing spaces
+/// are enclosed in double quotes.
+static CString FormatLinkerDirectives(const BYTE* data, size_t size)
+{
+   // skip UTF-8 byte order mark
+   if (size >= 3 && data[0] == 0xef && data[1] == 0xbb && data[2] == 0xbf)
+   {
+      data += 3;
+      size -= 3;
+   }
+
+   CStringA directives{ reinterpret_cast<const CHAR*>(data),
+      static_cast<int>(strnlen(reinterpret_cast<const CHAR*>(data), size)) };
+
+   CStringA text;
+   bool isInQuotes = false;
+   for (int pos = 0; pos < directives.GetLength(); pos++)
+   {
+      CHAR ch = directives[pos];
+      if (ch == '"')
+         isInQuotes = !isInQuotes;
+
+      if (ch == ' ' && !isInQuotes)
+      {
+         if (!text.IsEmpty() && text[text.GetLength() - 1] != '\n')
+            text.AppendChar('\n');
+      }
+      else
+         text.AppendChar(ch);
+   }
+
+   return CString{ CA2T(text, CP_UTF8) };
+}
+
+void CoffObjectNodeTreeBuilder::AddSectionContentNodes(const SectionHeader& sectionHeader,
+   const CString& sectionName,
+   std::vector<std::shared_ptr<INode>>& sectionChildNodes)
+{
+   // IMAGE_SCN_CNT_UNINITIALIZED_DATA sections have no data in the file
+   if (sectionHeader.pointerToRawData == 0 ||
+      sectionHeader.sizeOfRawData == 0 ||
+      (sectionHeader.sectionFlags & 0x00000080) != 0)
+      return;
+
+   // the raw data offset of image sections is relative to the file start
+   size_t sectionDataOffset =
+      (m_isImage ? 0 : m_fileOffset) +
+      sectionHeader.pointerToRawData;
+
+   size_t sectionSize = sectionHeader.sizeOfRawData;
+
+   if (sectionDataOffset > m_file.Size() ||
+      sectionSize > m_file.Size() - sectionDataOffset)
+   {
+      m_objectFileSummary.AppendFormat(_T("Error: Data of section %s is outside of the file size!\n"),
+         sectionName.GetString());
+      return;
+   }
+
+   // the hex view shows the mapped file data directly
+   sectionChildNodes.push_back(
+      std::make_shared<HexDataViewNode>(
+         _T("Section data ") + sectionName,
+         NodeTreeIconID::nodeTreeIconBinary,
+         m_file,
+         sectionDataOffset,
+         sectionSize));
+
+   const BYTE* sectionData = m_file.Data<BYTE>(sectionDataOffset);
+
+   if (sectionName == _T(".drectve"))
+   {
+      sectionChildNodes.push_back(
+         std::make_shared<CodeTextViewNode>(
+            _T("Linker directives"),
+            NodeTreeIconID::nodeTreeIconDocument,
+            [sectionData, sectionSize]()
+            {
+               return FormatLinkerDirectives(sectionData, sectionSize);
+            }));
+   }
+   else if (sectionName == _T(".llvm_addrsig"))
+   {
+      static std::vector<CString> addrsigColumnNames
+      {
+         _T("Index"),
+         _T("Symbol index"),
+         _T("Symbol"),
+         _T("Undecorated symbol"),
+      };
+
+      std::shared_ptr<CoffSymbolNameLookup> symbolNameLookup = m_symbolNameLookup;
+
+      // the section contains a list of ULEB128 encoded symbol indices of
+      // address-significant symbols; the number of entries is only known
+      // after decoding
+      sectionChildNodes.push_back(
+         std::make_shared<FilterSortListViewNode>(
+            _T("Address-significant symbols"),
+            NodeTreeIconID::nodeTreeIconTable,
+            addrsigColumnNames,
+            [sectionData, sectionSize, symbolNameLookup]()
+            {
+               std::vector<ULONGLONG> symbolIndices;
+
+               DwarfDataReader reader{ sectionData, sectionSize, true };
+               while (!reader.IsAtEnd() && !reader.HasError())
+                  symbolIndices.push_back(reader.ReadUleb128());
+
+               if (reader.HasError())
+                  symbolIndices.pop_back();
+
+               std::vector<std::vector<CString>> data;
+               data.reserve(symbolIndices.size());
+
+               for (size_t index = 0; index < symbolIndices.size(); index++)
+               {
+                  CString indexText;
+                  indexText.Format(_T("%zu"), index);
+
+                  CString symbolIndexText;
+                  symbolIndexText.Format(_T("%llu"), symbolIndices[index]);
+
+                  CString symbolName = symbolNameLookup->GetSymbolName(static_cast<size_t>(symbolIndices[index]));
+
+                  data.push_back(
+                     std::vector<CString> {
+                     indexText,
+                        symbolIndexText,
+                        symbolName,
+                        SymbolsHelper::UndecorateSymbol(symbolName),
+                  });
+               }
+
+               return data;
+            },
+            true));
+   }
+}
+
+std::shared_ptr<INode> CoffObjectNodeTreeBuilder::CreateRelocationTableNode(
+   const SectionHeader& sectionHeader,
+   const CString& sectionName,
+   size_t& numberOfRelocations)
+{
+   numberOfRelocations = 0;
+
+   if (sectionHeader.pointerToRelocations == 0 ||
+      sectionHeader.numberOfRelocations == 0)
+      return nullptr;
+
+   // the relocations offset of image sections is relative to the file start
+   size_t relocationsOffset =
+      (m_isImage ? 0 : m_fileOffset) +
+      sectionHeader.pointerToRelocations;
+
+   if (relocationsOffset + sizeof(CoffRelocation) > m_file.Size())
+   {
+      m_objectFileSummary.AppendFormat(_T("Error: Relocations of section %s are outside of the file size!\n"),
+         sectionName.GetString());
+      return nullptr;
+   }
+
+   const CoffRelocation* relocations = m_file.Data<CoffRelocation>(relocationsOffset);
+
+   size_t relocationCount = sectionHeader.numberOfRelocations;
+
+   // with more than 0xffff relocations, the first entry stores the real
+   // number of relocations, including the first entry itself
+   size_t firstRelocationIndex = 0;
+   if ((sectionHeader.sectionFlags & c_sectionFlagLinkNumRelocOverflow) != 0 &&
+      sectionHeader.numberOfRelocations == 0xffff)
+   {
+      relocationCount = relocations[0].virtualAddress;
+      firstRelocationIndex = 1;
+   }
+
+   size_t maxRelocationCount = (m_file.Size() - relocationsOffset) / sizeof(CoffRelocation);
+   if (relocationCount > maxRelocationCount)
+   {
+      m_objectFileSummary.AppendFormat(_T("Error: Relocations of section %s are outside of the file size!\n"),
+         sectionName.GetString());
+      relocationCount = maxRelocationCount;
+   }
+
+   if (relocationCount <= firstRelocationIndex)
+      return nullptr;
+
+   numberOfRelocations = relocationCount - firstRelocationIndex;
+
+   static std::vector<CString> relocationTableColumnNames
+   {
+      _T("Index"),
+      _T("Offset"),
+      _T("Type"),
+      _T("Symbol index"),
+      _T("Symbol"),
+      _T("Undecorated symbol"),
+   };
+
+   const std::map<DWORD, LPCTSTR>* relocationTypeMap =
+      GetCoffRelocationTypeMap(m_targetMachine);
+
+   // the relocations are decoded directly from the mapped file, only when
+   // the rows are shown
+   std::shared_ptr<CoffSymbolNameLookup> symbolNameLookup = m_symbolNameLookup;
+
+   auto formatRelocation =
+      [relocations, firstRelocationIndex, relocationTypeMap, symbolNameLookup](size_t rowIndex)
+   {
+      const CoffRelocation& relocation = relocations[firstRelocationIndex + rowIndex];
+
+      CString indexText;
+      indexText.Format(_T("%zu"), rowIndex);
+
+      CString offsetText;
+      offsetText.Format(_T("0x%08x"), relocation.virtualAddress);
+
+      CString typeText;
+      typeText.Format(_T("%s (0x%04x)"),
+         relocationTypeMap != nullptr
+         ? GetValueFromMapOrDefault<DWORD>(*relocationTypeMap, relocation.type, _T("unknown"))
+         : _T("unknown"),
+         relocation.type);
+
+      CString symbolIndexText;
+      symbolIndexText.Format(_T("%u"), relocation.symbolTableIndex);
+
+      CString symbolName = symbolNameLookup->GetSymbolName(relocation.symbolTableIndex);
+
+      return std::vector<CString> {
+         indexText,
+            offsetText,
+            typeText,
+            symbolIndexText,
+            symbolName,
+            SymbolsHelper::UndecorateSymbol(symbolName),
+      };
+   };
+
+   return std::make_shared<FilterSortListViewNode>(
+      _T("Relocations ") + sectionName,
+      NodeTreeIconID::nodeTreeIconTable,
+      relocationTableColumnNames,
+      numberOfRelocations,
+      formatRelocation,
+      true);
+}
+
 void CoffObjectNodeTreeBuilder::LoadStringTable()
 {
    size_t stringTableOffset =
       m_fileOffset +
-      m_coffObjectHeader.offsetSymbolTable +
-      m_coffObjectHeader.numberOfSymbols * sizeof(CoffSymbolTable);
+      m_offsetSymbolTable +
+      m_numberOfSymbols * m_symbolSize;
 
    if (stringTableOffset >= m_file.Size())
    {
@@ -243,10 +914,12 @@ void CoffObjectNodeTreeBuilder::LoadStringTable()
    }
 }
 
+template <typename TSymbol>
 void CoffObjectNodeTreeBuilder::AddSymbolTable(
-   StaticNode& coffSummaryNode)
+   StaticNode& coffSummaryNode,
+   const StructDefinition& symbolTableDefinition)
 {
-   if (sizeof(m_coffObjectHeader) + m_coffObjectHeader.offsetSymbolTable + sizeof(CoffSymbolTable) >= m_file.Size())
+   if (m_fileOffset + m_offsetSymbolTable + sizeof(TSymbol) >= m_file.Size())
    {
       m_objectFileSummary += _T("Error: COFF symbol table offset is outside of the file size!\n");
       return;
@@ -258,20 +931,25 @@ void CoffObjectNodeTreeBuilder::AddSymbolTable(
    const BYTE* data = m_file.Data<BYTE>(m_fileOffset);
    const BYTE* symbolTableStart =
       data +
-      m_coffObjectHeader.offsetSymbolTable;
+      m_offsetSymbolTable;
 
-   size_t maxSymbolTableEntries = m_coffObjectHeader.numberOfSymbols;
+   size_t maxSymbolTableEntries = m_numberOfSymbols;
+
+   // the section numbers are 16-bit in regular and 32-bit in BigObj objects
+   using SectionNumberType = std::make_signed_t<decltype(TSymbol::sectionNumber)>;
+
+   auto comdatGraph = std::make_shared<CoffComdatGraph>(GetNumberOfSectionsInFile());
 
    const BYTE* symbolTableCurrent = symbolTableStart;
    for (size_t symbolTableEntry = 0; symbolTableEntry < maxSymbolTableEntries; symbolTableEntry++)
    {
-      if (!m_file.IsValidRange(symbolTableCurrent, sizeof(CoffSymbolTable)))
+      if (!m_file.IsValidRange(symbolTableCurrent, sizeof(TSymbol)))
       {
          m_objectFileSummary.AppendFormat(_T("Warning: File ended while scanning the symbol table\n"));
          break;
       }
 
-      const CoffSymbolTable& symbolTable = *reinterpret_cast<const CoffSymbolTable*>(symbolTableCurrent);
+      const TSymbol& symbolTable = *reinterpret_cast<const TSymbol*>(symbolTableCurrent);
 
       CString symbolName;
       if (symbolTable.name[0] == 0 &&
@@ -293,24 +971,49 @@ void CoffObjectNodeTreeBuilder::AddSymbolTable(
       CString symbolIndexText;
       symbolIndexText.Format(_T("%zu"), symbolTableEntry);
 
-      symbolTableData.push_back(
-         std::vector<CString> {
-         symbolIndexText,
-            symbolName,
-            SymbolsHelper::UndecorateSymbol(symbolName),
-      });
+      auto sectionNumber = static_cast<SectionNumberType>(symbolTable.sectionNumber);
+
+      CString sectionNumberText;
+      if (sectionNumber == -1)
+         sectionNumberText = _T("absolute");
+      else if (sectionNumber == -2)
+         sectionNumberText = _T("debug");
+      else if (sectionNumber == 0)
+         sectionNumberText = _T("undefined");
+      else
+         sectionNumberText.Format(_T("%d"), static_cast<int>(sectionNumber));
 
       auto symbolTableEntryNode = std::make_shared<StructListViewNode>(
          _T("Symbol table entry ") + symbolName,
          NodeTreeIconID::nodeTreeIconBinary,
-         g_definitionCoffSymbolTable,
+         symbolTableDefinition,
          symbolTableCurrent,
          m_file.Data());
 
       symbolChildNodes.push_back(symbolTableEntryNode);
 
+      CString auxSymbolText;
+      if (symbolTable.numberOfAuxSymbols > 0 &&
+         m_file.IsValidRange(symbolTableCurrent, sizeof(TSymbol) * (1 + symbolTable.numberOfAuxSymbols)))
+      {
+         auxSymbolText = DecodeAuxSymbols(symbolTable, symbolTableEntry, symbolName,
+            symbolChildNodes, *comdatGraph);
+      }
+      else if (sectionNumber > 0)
+         comdatGraph->AddSectionSymbol(static_cast<size_t>(sectionNumber), symbolTableEntry);
+
+      symbolTableData.push_back(
+         std::vector<CString> {
+         symbolIndexText,
+            symbolName,
+            SymbolsHelper::UndecorateSymbol(symbolName),
+            sectionNumberText,
+            auxSymbolText,
+      });
+
       // advance pointer
-      symbolTableCurrent += sizeof(CoffSymbolTable) + (symbolTable.numberOfAuxSymbols * sizeof(CoffSymbolTable));
+      // aux symbols have the same size as the symbol record
+      symbolTableCurrent += sizeof(TSymbol) + (symbolTable.numberOfAuxSymbols * sizeof(TSymbol));
 
       // the number of symbols also includes the aux symbols, so also add these to the index
       symbolTableEntry += symbolTable.numberOfAuxSymbols;
@@ -319,14 +1022,16 @@ void CoffObjectNodeTreeBuilder::AddSymbolTable(
    size_t symbolTableLength = symbolTableCurrent - symbolTableStart;
 
    m_objectFileSummary.AppendFormat(
-      _T("Symbol table with %u entries, length 0x%08zx bytes.\n"),
-      m_coffObjectHeader.numberOfSymbols, symbolTableLength);
+      _T("Symbol table with %zu entries, length 0x%08zx bytes.\n"),
+      m_numberOfSymbols, symbolTableLength);
 
    static std::vector<CString> symbolTableColumnNames
    {
       _T("Index"),
       _T("Symbol"),
       _T("Undecorated symbol"),
+      _T("Section"),
+      _T("Aux symbol"),
    };
 
    auto symbolTableNode = std::make_shared<FilterSortListViewNode>(
@@ -339,14 +1044,217 @@ void CoffObjectNodeTreeBuilder::AddSymbolTable(
    symbolTableNode->ChildNodes().swap(symbolChildNodes);
 
    coffSummaryNode.ChildNodes().push_back(symbolTableNode);
+
+   if (comdatGraph->NumberOfComdatSections() > 0)
+      AddComdatSectionTable(coffSummaryNode, comdatGraph);
+}
+
+template <typename TSymbol>
+CString CoffObjectNodeTreeBuilder::DecodeAuxSymbols(
+   const TSymbol& symbol,
+   size_t symbolIndex,
+   const CString& symbolName,
+   std::vector<std::shared_ptr<INode>>& symbolChildNodes,
+   CoffComdatGraph& comdatGraph)
+{
+   using SectionNumberType = std::make_signed_t<decltype(TSymbol::sectionNumber)>;
+   auto sectionNumber = static_cast<SectionNumberType>(symbol.sectionNumber);
+
+   // aux records directly follow the symbol and have the same size
+   const BYTE* auxStart = reinterpret_cast<const BYTE*>(&symbol) + sizeof(TSymbol);
+
+   CString text;
+
+   if (symbol.storageClass == c_coffStorageClassFile)
+   {
+      // the file name spans all aux records
+      size_t maxLength = symbol.numberOfAuxSymbols * sizeof(TSymbol);
+      const CHAR* fileName = reinterpret_cast<const CHAR*>(auxStart);
+
+      text = _T("File: ") + CString{ fileName, static_cast<int>(strnlen(fileName, maxLength)) };
+   }
+   else if (symbol.storageClass == c_coffStorageClassStatic &&
+      symbol.value == 0 &&
+      symbol.type == 0 &&
+      sectionNumber > 0)
+   {
+      const auto& sectionDefinition = *reinterpret_cast<const CoffAuxSectionDefinition*>(auxStart);
+
+      // only BigObj objects use the high part of the section number
+      size_t associatedSectionNumber = sectionDefinition.number;
+      if (m_isBigObj)
+         associatedSectionNumber |= static_cast<size_t>(sectionDefinition.highNumber) << 16;
+
+      comdatGraph.AddSectionDefinition(static_cast<size_t>(sectionNumber), symbolIndex,
+         sectionDefinition.selection, associatedSectionNumber);
+
+      text.Format(_T("Section definition: length 0x%08x, %u relocations"),
+         sectionDefinition.length,
+         sectionDefinition.numberOfRelocations);
+
+      if (sectionDefinition.selection != 0)
+      {
+         text.AppendFormat(_T(", checksum 0x%08x, %s"),
+            sectionDefinition.checkSum,
+            GetValueFromMapOrDefault<DWORD>(
+               g_mapCoffComdatSelectionToDisplayText,
+               sectionDefinition.selection,
+               _T("unknown COMDAT selection")));
+
+         if (sectionDefinition.selection == c_coffComdatSelectAssociative)
+            text.AppendFormat(_T(" with section %zu"), associatedSectionNumber);
+      }
+
+      symbolChildNodes.push_back(
+         std::make_shared<StructListViewNode>(
+            _T("Aux section definition ") + symbolName,
+            NodeTreeIconID::nodeTreeIconBinary,
+            g_definitionCoffAuxSectionDefinition,
+            auxStart,
+            m_file.Data()));
+   }
+   else if (symbol.storageClass == c_coffStorageClassExternal &&
+      (symbol.type & 0xf0) == 0x20 && // IMAGE_SYM_DTYPE_FUNCTION
+      sectionNumber > 0)
+   {
+      comdatGraph.AddSectionSymbol(static_cast<size_t>(sectionNumber), symbolIndex);
+
+      const auto& functionDefinition = *reinterpret_cast<const CoffAuxFunctionDefinition*>(auxStart);
+
+      text.Format(_T("Function definition: size 0x%08x"), functionDefinition.totalSize);
+
+      symbolChildNodes.push_back(
+         std::make_shared<StructListViewNode>(
+            _T("Aux function definition ") + symbolName,
+            NodeTreeIconID::nodeTreeIconBinary,
+            g_definitionCoffAuxFunctionDefinition,
+            auxStart,
+            m_file.Data()));
+   }
+   else if (symbol.storageClass == c_coffStorageClassWeakExternal)
+   {
+      const auto& weakExternal = *reinterpret_cast<const CoffAuxWeakExternal*>(auxStart);
+
+      text.Format(_T("Weak external: default symbol %u %s, %s"),
+         weakExternal.tagIndex,
+         m_symbolNameLookup->GetSymbolName(weakExternal.tagIndex).GetString(),
+         GetValueFromMapOrDefault<DWORD>(
+            g_mapCoffWeakExternalCharacteristicsToDisplayText,
+            weakExternal.characteristics,
+            _T("unknown")));
+
+      symbolChildNodes.push_back(
+         std::make_shared<StructListViewNode>(
+            _T("Aux weak external ") + symbolName,
+            NodeTreeIconID::nodeTreeIconBinary,
+            g_definitionCoffAuxWeakExternal,
+            auxStart,
+            m_file.Data()));
+   }
+   else
+   {
+      if (sectionNumber > 0)
+         comdatGraph.AddSectionSymbol(static_cast<size_t>(sectionNumber), symbolIndex);
+
+      text.Format(_T("%u aux records"), symbol.numberOfAuxSymbols);
+   }
+
+   return text;
+}
+
+void CoffObjectNodeTreeBuilder::AddComdatSectionTable(StaticNode& coffSummaryNode,
+   const std::shared_ptr<CoffComdatGraph>& comdatGraph)
+{
+   std::vector<size_t> comdatSectionNumbers;
+   comdatSectionNumbers.reserve(comdatGraph->NumberOfComdatSections());
+
+   for (size_t sectionNumber = 1; sectionNumber <= comdatGraph->NumberOfSections(); sectionNumber++)
+   {
+      if (comdatGraph->Selection(sectionNumber) != 0)
+         comdatSectionNumbers.push_back(sectionNumber);
+   }
+
+   m_objectFileSummary.AppendFormat(_T("COMDAT sections: %zu, associative: %zu\n"),
+      comdatGraph->NumberOfComdatSections(),
+      comdatGraph->NumberOfAssociativeSections());
+
+   static std::vector<CString> comdatTableColumnNames
+   {
+      _T("Section"),
+      _T("Section name"),
+      _T("Selection"),
+      _T("COMDAT symbol"),
+      _T("Associated with"),
+      _T("Leader section"),
+      _T("Associated sections"),
+   };
+
+   std::shared_ptr<CoffSymbolNameLookup> symbolNameLookup = m_symbolNameLookup;
+
+   // formats a section reference as number and name, using the name of the
+   // section definition symbol
+   auto formatSection = [comdatGraph, symbolNameLookup](size_t sectionNumber)
+   {
+      if (sectionNumber == CoffComdatGraph::c_none)
+         return CString{ _T("-") };
+
+      CString text;
+      text.Format(_T("%zu %s"),
+         sectionNumber,
+         symbolNameLookup->GetSymbolName(comdatGraph->SectionSymbolIndex(sectionNumber)).GetString());
+
+      return text;
+   };
+
+   auto formatComdatSection =
+      [comdatSectionNumbers = std::move(comdatSectionNumbers), comdatGraph, symbolNameLookup, formatSection](size_t rowIndex)
+   {
+      size_t sectionNumber = comdatSectionNumbers[rowIndex];
+
+      CString sectionNumberText;
+      sectionNumberText.Format(_T("%zu"), sectionNumber);
+
+      size_t comdatSymbolIndex = comdatGraph->ComdatSymbolIndex(sectionNumber);
+      CString comdatSymbolName = comdatSymbolIndex != CoffComdatGraph::c_none
+         ? symbolNameLookup->GetSymbolName(comdatSymbolIndex)
+         : CString{ _T("-") };
+
+      CString associatedSectionsText;
+      associatedSectionsText.Format(_T("%zu"), comdatGraph->NumberOfAssociatedSections(sectionNumber));
+
+      return std::vector<CString> {
+         sectionNumberText,
+            symbolNameLookup->GetSymbolName(comdatGraph->SectionSymbolIndex(sectionNumber)),
+            GetValueFromMapOrDefault<DWORD>(
+               g_mapCoffComdatSelectionToDisplayText,
+               comdatGraph->Selection(sectionNumber),
+               _T("unknown")),
+            comdatSymbolName,
+            formatSection(comdatGraph->AssociatedSection(sectionNumber)),
+            formatSection(comdatGraph->LeaderSection(sectionNumber)),
+            associatedSectionsText,
+      };
+   };
+
+   size_t rowCount = comdatGraph->NumberOfComdatSections();
+
+   auto comdatTableNode = std::make_shared<FilterSortListViewNode>(
+      _T("COMDAT Sections"),
+      NodeTreeIconID::nodeTreeIconTable,
+      comdatTableColumnNames,
+      rowCount,
+      formatComdatSection,
+      true);
+
+   coffSummaryNode.ChildNodes().push_back(comdatTableNode);
 }
 
 void CoffObjectNodeTreeBuilder::AddStringTable(StaticNode& coffSummaryNode)
 {
    size_t stringTableOffset =
       m_fileOffset +
-      m_coffObjectHeader.offsetSymbolTable +
-      m_coffObjectHeader.numberOfSymbols * sizeof(CoffSymbolTable);
+      m_offsetSymbolTable +
+      m_numberOfSymbols * m_symbolSize;
 
    if (stringTableOffset >= m_file.Size())
    {
@@ -399,3 +1307,116 @@ void CoffObjectNodeTreeBuilder::AddStringTable(StaticNode& coffSummaryNode)
 
    coffSummaryNode.ChildNodes().push_back(stringTableNode);
 }
+
+void CoffObjectNodeTreeBuilder::AddDwarfDebugInfo(StaticNode& coffSummaryNode)
+{
+   DwarfSections sections;
+
+   const BYTE* data = m_file.Data<BYTE>(m_fileOffset);
+   for (size_t sectionIndex = 0; sectionIndex < m_numberOfSections; sectionIndex++)
+   {
+      const BYTE* sectionStart =
+         data +
+         m_sectionTableOffset +
+         sizeof(SectionHeader) * sectionIndex;
+
+      if (!m_file.IsValidRange(sectionStart, sizeof(SectionHeader)))
+         break;
+
+      const SectionHeader& sectionHeader = *reinterpret_cast<const SectionHeader*>(sectionStart);
+
+      // the DWARF section names are longer than 8 chars and are stored in
+      // the string table, e.g. "/4"
+      CString sectionName = GetSectionName(sectionHeader);
+
+      DwarfSection* dwarfSection = sections.FindBySectionName(sectionName);
+      if (dwarfSection == nullptr)
+         continue;
+
+      size_t sectionSize = sectionHeader.sizeOfRawData;
+      if (m_isImage &&
+         sectionHeader.virtualSize != 0 &&
+         sectionHeader.virtualSize < sectionSize)
+         sectionSize = sectionHeader.virtualSize;
+
+      // the raw data offset of image sections is relative to the file start
+      const BYTE* sectionData =
+         m_file.Data<BYTE>(m_isImage ? 0 : m_fileOffset) +
+         sectionHeader.pointerToRawData;
+
+      if (sectionSize == 0 ||
+         !m_file.IsValidRange(sectionData, sectionSize))
+      {
+         m_objectFileSummary.AppendFormat(_T("Error: DWARF section %s is outside of the file size!\n"),
+            sectionName.GetString());
+         continue;
+      }
+
+      // object files store the section offsets and addresses in debug
+      // sections with implicit addends, relative to the referenced section;
+      // these values can be used without applying the relocations
+      dwarfSection->data = sectionData;
+      dwarfSection->size = sectionSize;
+   }
+
+   if (!sections.info.IsAvailable())
+      return;
+
+   DwarfNodeTreeBuilder nodeTreeBuilder{ std::make_shared<DwarfReader>(sections) };
+   nodeTreeBuilder.AddNodes(coffSummaryNode, m_objectFileSummary);
+}
+
+void CoffObjectNodeTreeBuilder::AddCodeViewDebugInfo(StaticNode& coffSummaryNode)
+{
+   CodeViewSections sections;
+
+   const BYTE* data = m_file.Data<BYTE>(m_fileOffset);
+   for (size_t sectionIndex = 0; sectionIndex < m_numberOfSections; sectionIndex++)
+   {
+      const BYTE* sectionStart =
+         data +
+         m_sectionTableOffset +
+         sizeof(SectionHeader) * sectionIndex;
+
+      if (!m_file.IsValidRange(sectionStart, sizeof(SectionHeader)))
+         break;
+
+      const SectionHeader& sectionHeader = *reinterpret_cast<const SectionHeader*>(sectionStart);
+
+      CStringA sectionName{ sectionHeader.name, static_cast<int>(strnlen(sectionHeader.name, sizeof(sectionHeader.name))) };
+
+      bool isSymbolsSection = sectionName == ".debug$S";
+      if (!isSymbolsSection && sectionName != ".debug$T")
+         continue;
+
+      // the raw data offset of image sections is relative to the file start
+      const BYTE* sectionData =
+         m_file.Data<BYTE>(m_isImage ? 0 : m_fileOffset) +
+         sectionHeader.pointerToRawData;
+
+      if (sectionHeader.sizeOfRawData == 0 ||
+         !m_file.IsValidRange(sectionData, sectionHeader.sizeOfRawData))
+      {
+         m_objectFileSummary.AppendFormat(_T("Error: CodeView section %zu is outside of the file size!\n"),
+            sectionIndex + 1);
+         continue;
+      }
+
+      CodeViewSection section;
+      section.data = sectionData;
+      section.size = sectionHeader.sizeOfRawData;
+      section.sectionNumber = sectionIndex + 1;
+
+      if (isSymbolsSection)
+         sections.symbols.push_back(section);
+      else if (!sections.types.IsAvailable())
+         sections.types = section;
+   }
+
+   if (sections.symbols.empty() &&
+      !sections.types.IsAvailable())
+      return;
+
+   CodeViewNodeTreeBuilder nodeTreeBuilder{ std::make_shared<CodeViewReader>(sections) };
+   nodeTreeBuilder.AddNodes(coffSummaryNode, m_objectFileSummary);
+}
@@ -1,25 +1,37 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020-2023 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file CoffObjectNodeTreeBuilder.hpp
-/// \brief Node tree builder for for COFF object files
+/// \brief Node tree builder for COFF object files
 //
 #pragma once
 
 #include "INode.hpp"
 #include "File.hpp"
 #include <map>
+#include <functional>
 
 class CodeTextViewNode;
 class StaticNode;
-struct CoffHeader;
-
-/// Node tree builder for COFF objects
+class CoffSymbolNameLookup;
+class CoffComdatGraph;
+class StructDefinition;
+struct SectionHeader;
+struct CoffExternalDefinition;
+struct CoffSectionSize;
+class CoffSectionSizeTree;
+
+/// \brief Node tree builder for COFF objects
+/// \details Supports regular COFF objects and images, as well as BigObj COFF
+/// objects, which use 32-bit section numbers and 20 byte symbol records.
 class CoffObjectNodeTreeBuilder
 {
 public:
-   /// ctor
+   /// checks if the file contains a BigObj COFF object at the given offset
+   static bool IsBigObjCoffObject(const File& file, size_t fileOffset);
+
+   /// ctor; detects BigObj COFF objects automatically
    CoffObjectNodeTreeBuilder(const File& file, size_t fileOffset, bool isImage);
 
    /// adds COFF header, section and symbol tables
@@ -28,6 +40,27 @@ public:
    /// returns object file summary text
    const CString& GetObjectFileSummary() const { return m_objectFileSummary; }
 
+   /// collects all external symbol definitions of the object, including the
+   /// COMDAT selection of the defining sections; no nodes are created
+   void CollectExternalDefinitions(std::vector<CoffExternalDefinition>& definitions) const;
+
+   /// collects the sizes of all sections, with the COMDAT symbol that each
+   /// section belongs to; no nodes are created
+   void CollectSectionSizes(std::vector<CoffSectionSize>& sectionSizes) const;
+
+   /// returns the summed up section data sizes of all sections; unlike
+   /// collecting the section sizes, no symbols are read
+   ULONGLONG GetTotalSectionSize() const;
+
+   /// function that creates the section size tree
+   using SectionSizeTreeProvider = std::function<std::shared_ptr<const CoffSectionSizeTree>()>;
+
+   /// adds a section sizes table node and a JSON export node for the size
+   /// breakdown to node; the provider is called once, when one of the nodes
+   /// is shown the first time
+   static void AddSectionSizeNodes(StaticNode& node,
+      SectionSizeTreeProvider sectionSizeTreeProvider);
+
 private:
    /// adds COFF header, section and symbol tables
    void AddCoffObjectFile(CodeTextViewNode& coffSummaryNode);
@@ -38,15 +71,67 @@ private:
    /// adds section table to node
    void AddSectionTable(StaticNode& coffSummaryNode);
 
+   /// returns the section name; long names are read from the string table
+   CString GetSectionName(const SectionHeader& sectionHeader) const;
+
+   /// adds nodes showing the section contents: a hex data node for all
+   /// sections with data, and decoded contents of known sections
+   void AddSectionContentNodes(const SectionHeader& sectionHeader,
+      const CString& sectionName,
+      std::vector<std::shared_ptr<INode>>& sectionChildNodes);
+
+   /// creates relocation table node for a section, or returns nullptr when
+   /// the section has no relocations; returns the number of relocations
+   std::shared_ptr<INode> CreateRelocationTableNode(
+      const SectionHeader& sectionHeader,
+      const CString& sectionName,
+      size_t& numberOfRelocations);
+
    /// loads string table into map
    void LoadStringTable();
 
-   /// adds symbol table to node
-   void AddSymbolTable(StaticNode& coffSummaryNode);
+   /// adds symbol table to node; generic over the symbol record layout
+   template <typename TSymbol>
+   void AddSymbolTable(StaticNode& coffSummaryNode,
+      const StructDefinition& symbolTableDefinition);
+
+   /// collects external symbol definitions; generic over the symbol record
+   /// layout
+   template <typename TSymbol>
+   void CollectExternalDefinitionsFromSymbolTable(
+      std::vector<CoffExternalDefinition>& definitions) const;
+
+   /// collects the COMDAT sections and their COMDAT symbols, without
+   /// decoding anything else; generic over the symbol record layout
+   template <typename TSymbol>
+   void CollectComdatSections(CoffComdatGraph& comdatGraph) const;
+
+   /// decodes the aux symbol records of a symbol, adds nodes for them and
+   /// collects section definitions in the COMDAT graph; returns a text
+   /// describing the aux records
+   template <typename TSymbol>
+   CString DecodeAuxSymbols(const TSymbol& symbol, size_t symbolIndex,
+      const CString& symbolName,
+      std::vector<std::shared_ptr<INode>>& symbolChildNodes,
+      CoffComdatGraph& comdatGraph);
+
+   /// adds COMDAT sections table to node
+   void AddComdatSectionTable(StaticNode& coffSummaryNode,
+      const std::shared_ptr<CoffComdatGraph>& comdatGraph);
+
+   /// returns the number of section headers that are inside the file
+   size_t GetNumberOfSectionsInFile() const;
 
    /// adds string table to node
    void AddStringTable(StaticNode& stringTableSummaryNode);
 
+   /// adds DWARF debug information to node, e.g. from MinGW object files
+   void AddDwarfDebugInfo(StaticNode& coffSummaryNode);
+
+   /// adds CodeView debug information to node, from .debug$S and .debug$T
+   /// sections of MSVC object files
+   void AddCodeViewDebugInfo(StaticNode& coffSummaryNode);
+
 private:
    /// file to load COFF object from
    const File& m_file;
@@ -57,8 +142,32 @@ private:
    /// indicates if the COFF object is inside an image (vs. in an object file)
    bool m_isImage;
 
-   /// COFF object header
-   const CoffHeader& m_coffObjectHeader;
+   /// indicates if the COFF object uses the BigObj layout
+   bool m_isBigObj;
+
+   /// COFF object header; either CoffHeader or AnonymousObjectHeaderBigObj
+   const void* m_coffObjectHeader;
+
+   /// type of target machine
+   WORD m_targetMachine = 0;
+
+   /// number of sections; 32-bit for BigObj COFF objects
+   size_t m_numberOfSections = 0;
+
+   /// offset of the section table, relative to the COFF object start
+   size_t m_sectionTableOffset = 0;
+
+   /// offset of the symbol table, relative to the COFF object start
+   size_t m_offsetSymbolTable = 0;
+
+   /// number of symbols in the symbol table, including aux symbols
+   size_t m_numberOfSymbols = 0;
+
+   /// size of a single symbol record
+   size_t m_symbolSize = 0;
+
+   /// symbol name lookup; shared with nodes that resolve symbol names lazily
+   std::shared_ptr<CoffSymbolNameLookup> m_symbolNameLookup;
 
    /// string table mapping from string offset to text
    std::map<size_t, CString> m_offsetToStringMapping;
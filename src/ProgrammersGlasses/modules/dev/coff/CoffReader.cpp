@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020-2023 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file CoffReader.cpp
 /// \brief reader for COFF format files
@@ -11,7 +11,7 @@
 #include "CoffObjectNodeTreeBuilder.hpp"
 #include "NonCoffObjectNodeTreeBuilder.hpp"
 #include "ArchiveFileNodeTreeBuilder.hpp"
-#include "ArchiveHeader.hpp"
+#include "ArchiveMemberIndex.hpp"
 #include "File.hpp"
 
 bool CoffReader::IsCoffObjectFile(const File& file)
@@ -32,15 +32,7 @@ bool CoffReader::IsCoffObjectFile(const File& file)
 
 bool CoffReader::IsArLibraryFile(const File& file)
 {
-   if (file.Size() < sizeof(ArchiveHeader))
-      return false;
-
-   const ArchiveHeader& archiveHeader =
-      *file.Data<ArchiveHeader>();
-
-   CString signatureText{ archiveHeader.signature, sizeof(archiveHeader.signature) };
-
-   return signatureText == c_archiveHeaderSignatureText;
+   return ArchiveMemberIndex::IsArchiveFile(file);
 }
 
 CoffReader::CoffReader(const File& file)
@@ -50,12 +42,14 @@ CoffReader::CoffReader(const File& file)
 
 void CoffReader::Load()
 {
-   if (IsCoffObjectFile(m_file))
+   // archive files are checked first, since they have a signature, while the
+   // COFF header check could also match the archive signature
+   if (IsArLibraryFile(m_file))
+      LoadArchiveLibraryFile();
+   else if (IsCoffObjectFile(m_file))
       LoadCoffObjectFile();
    else if (NonCoffObjectNodeTreeBuilder::IsNonCoffOrAnonymousObjectFile(m_file, 0))
       LoadNonCoffObjectFile();
-   else if (IsArLibraryFile(m_file))
-      LoadArchiveLibraryFile();
    else
       ATLASSERT(false);
 }
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020-2023 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file CoffReader.hpp
 /// \brief reader for COFF format files
@@ -19,7 +19,8 @@ public:
    /// checks file if it a COFF object file
    static bool IsCoffObjectFile(const File& file);
 
-   /// checks file if it an "ar" archive library file
+   /// checks file if it an "ar" archive library file; Microsoft, GNU, BSD
+   /// and thin archives are supported
    static bool IsArLibraryFile(const File& file);
 
    /// ctor
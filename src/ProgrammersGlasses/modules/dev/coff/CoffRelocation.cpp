@@ -0,0 +1,112 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffRelocation.cpp
+/// \brief COFF relocation definition
+//
+#include "stdafx.h"
+#include "CoffRelocation.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapCoffRelocationTypeAmd64ToDisplayText =
+{
+   { 0x0000, _T("IMAGE_REL_AMD64_ABSOLUTE") },
+   { 0x0001, _T("IMAGE_REL_AMD64_ADDR64") },
+   { 0x0002, _T("IMAGE_REL_AMD64_ADDR32") },
+   { 0x0003, _T("IMAGE_REL_AMD64_ADDR32NB") },
+   { 0x0004, _T("IMAGE_REL_AMD64_REL32") },
+   { 0x0005, _T("IMAGE_REL_AMD64_REL32_1") },
+   { 0x0006, _T("IMAGE_REL_AMD64_REL32_2") },
+   { 0x0007, _T("IMAGE_REL_AMD64_REL32_3") },
+   { 0x0008, _T("IMAGE_REL_AMD64_REL32_4") },
+   { 0x0009, _T("IMAGE_REL_AMD64_REL32_5") },
+   { 0x000a, _T("IMAGE_REL_AMD64_SECTION") },
+   { 0x000b, _T("IMAGE_REL_AMD64_SECREL") },
+   { 0x000c, _T("IMAGE_REL_AMD64_SECREL7") },
+   { 0x000d, _T("IMAGE_REL_AMD64_TOKEN") },
+   { 0x000e, _T("IMAGE_REL_AMD64_SREL32") },
+   { 0x000f, _T("IMAGE_REL_AMD64_PAIR") },
+   { 0x0010, _T("IMAGE_REL_AMD64_SSPAN32") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapCoffRelocationTypeI386ToDisplayText =
+{
+   { 0x0000, _T("IMAGE_REL_I386_ABSOLUTE") },
+   { 0x0001, _T("IMAGE_REL_I386_DIR16") },
+   { 0x0002, _T("IMAGE_REL_I386_REL16") },
+   { 0x0006, _T("IMAGE_REL_I386_DIR32") },
+   { 0x0007, _T("IMAGE_REL_I386_DIR32NB") },
+   { 0x0009, _T("IMAGE_REL_I386_SEG12") },
+   { 0x000a, _T("IMAGE_REL_I386_SECTION") },
+   { 0x000b, _T("IMAGE_REL_I386_SECREL") },
+   { 0x000c, _T("IMAGE_REL_I386_TOKEN") },
+   { 0x000d, _T("IMAGE_REL_I386_SECREL7") },
+   { 0x0014, _T("IMAGE_REL_I386_REL32") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapCoffRelocationTypeArm64ToDisplayText =
+{
+   { 0x0000, _T("IMAGE_REL_ARM64_ABSOLUTE") },
+   { 0x0001, _T("IMAGE_REL_ARM64_ADDR32") },
+   { 0x0002, _T("IMAGE_REL_ARM64_ADDR32NB") },
+   { 0x0003, _T("IMAGE_REL_ARM64_BRANCH26") },
+   { 0x0004, _T("IMAGE_REL_ARM64_PAGEBASE_REL21") },
+   { 0x0005, _T("IMAGE_REL_ARM64_REL21") },
+   { 0x0006, _T("IMAGE_REL_ARM64_PAGEOFFSET_12A") },
+   { 0x0007, _T("IMAGE_REL_ARM64_PAGEOFFSET_12L") },
+   { 0x0008, _T("IMAGE_REL_ARM64_SECREL") },
+   { 0x0009, _T("IMAGE_REL_ARM64_SECREL_LOW12A") },
+   { 0x000a, _T("IMAGE_REL_ARM64_SECREL_HIGH12A") },
+   { 0x000b, _T("IMAGE_REL_ARM64_SECREL_LOW12L") },
+   { 0x000c, _T("IMAGE_REL_ARM64_TOKEN") },
+   { 0x000d, _T("IMAGE_REL_ARM64_SECTION") },
+   { 0x000e, _T("IMAGE_REL_ARM64_ADDR64") },
+   { 0x000f, _T("IMAGE_REL_ARM64_BRANCH19") },
+   { 0x0010, _T("IMAGE_REL_ARM64_BRANCH14") },
+   { 0x0011, _T("IMAGE_REL_ARM64_REL32") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapCoffRelocationTypeArmToDisplayText =
+{
+   { 0x0000, _T("IMAGE_REL_ARM_ABSOLUTE") },
+   { 0x0001, _T("IMAGE_REL_ARM_ADDR32") },
+   { 0x0002, _T("IMAGE_REL_ARM_ADDR32NB") },
+   { 0x0003, _T("IMAGE_REL_ARM_BRANCH24") },
+   { 0x0004, _T("IMAGE_REL_ARM_BRANCH11") },
+   { 0x0005, _T("IMAGE_REL_ARM_TOKEN") },
+   { 0x0008, _T("IMAGE_REL_ARM_BLX24") },
+   { 0x0009, _T("IMAGE_REL_ARM_BLX11") },
+   { 0x000a, _T("IMAGE_REL_ARM_REL32") },
+   { 0x000e, _T("IMAGE_REL_ARM_SECTION") },
+   { 0x000f, _T("IMAGE_REL_ARM_SECREL") },
+   { 0x0010, _T("IMAGE_REL_ARM_MOV32") },
+   { 0x0011, _T("IMAGE_REL_THUMB_MOV32") },
+   { 0x0012, _T("IMAGE_REL_THUMB_BRANCH20") },
+   { 0x0014, _T("IMAGE_REL_THUMB_BRANCH24") },
+   { 0x0015, _T("IMAGE_REL_THUMB_BLX23") },
+   { 0x0016, _T("IMAGE_REL_ARM_PAIR") },
+};
+
+const std::map<DWORD, LPCTSTR>* GetCoffRelocationTypeMap(WORD targetMachine)
+{
+   switch (targetMachine)
+   {
+   case 0x8664: // IMAGE_FILE_MACHINE_AMD64
+      return &g_mapCoffRelocationTypeAmd64ToDisplayText;
+
+   case 0x014c: // IMAGE_FILE_MACHINE_I386
+      return &g_mapCoffRelocationTypeI386ToDisplayText;
+
+   case 0xaa64: // IMAGE_FILE_MACHINE_ARM64
+   case 0xa641: // IMAGE_FILE_MACHINE_ARM64EC
+      return &g_mapCoffRelocationTypeArm64ToDisplayText;
+
+   case 0x01c0: // IMAGE_FILE_MACHINE_ARM
+   case 0x01c2: // IMAGE_FILE_MACHINE_THUMB
+   case 0x01c4: // IMAGE_FILE_MACHINE_ARMNT
+      return &g_mapCoffRelocationTypeArmToDisplayText;
+
+   default:
+      return nullptr;
+   }
+}
@@ -0,0 +1,44 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffRelocation.hpp
+/// \brief COFF relocation definition
+//
+#pragma once
+
+#pragma pack(push, 1)
+
+/// \brief COFF relocation entry
+/// \see https://learn.microsoft.com/en-us/windows/win32/debug/pe-format#coff-relocations-object-only
+/// The struct corresponds with winnt.h's IMAGE_RELOCATION struct.
+struct CoffRelocation
+{
+   DWORD virtualAddress;   ///< offset of the relocated item, relative to the section start
+   DWORD symbolTableIndex; ///< index of the symbol in the symbol table
+   WORD type;              ///< relocation type; depends on the target machine
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(CoffRelocation) == 10, "COFF relocation must be 10 bytes long");
+
+/// section flag indicating that the section has more than 0xffff relocations;
+/// the real number of relocations is stored in the first relocation entry
+constexpr DWORD c_sectionFlagLinkNumRelocOverflow = 0x01000000;
+
+/// mapping of x64 relocation types to display text
+extern const std::map<DWORD, LPCTSTR> g_mapCoffRelocationTypeAmd64ToDisplayText;
+
+/// mapping of x86 relocation types to display text
+extern const std::map<DWORD, LPCTSTR> g_mapCoffRelocationTypeI386ToDisplayText;
+
+/// mapping of ARM64 relocation types to display text
+extern const std::map<DWORD, LPCTSTR> g_mapCoffRelocationTypeArm64ToDisplayText;
+
+/// mapping of ARM relocation types to display text
+extern const std::map<DWORD, LPCTSTR> g_mapCoffRelocationTypeArmToDisplayText;
+
+/// returns the relocation type mapping for the target machine, or nullptr
+/// when the target machine isn't supported
+const std::map<DWORD, LPCTSTR>* GetCoffRelocationTypeMap(WORD targetMachine);
@@ -0,0 +1,201 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffSectionSizeTree.cpp
+/// \brief Hierarchical size breakdown of COFF sections
+//
+#include "stdafx.h"
+#include "CoffSectionSizeTree.hpp"
+#include "CoffObjectNodeTreeBuilder.hpp"
+#include <execution>
+#include <numeric>
+#include <thread>
+
+/// \brief Formats a text as JSON string, including the quotes
+static CString FormatJsonString(const CString& text)
+{
+   CString jsonText{ _T("\"") };
+
+   for (int pos = 0; pos < text.GetLength(); pos++)
+   {
+      TCHAR ch = text[pos];
+      if (ch == _T('"') || ch == _T('\\'))
+      {
+         jsonText.AppendChar(_T('\\'));
+         jsonText.AppendChar(ch);
+      }
+      else if (ch < 0x20)
+         jsonText.AppendFormat(_T("\\u%04x"), static_cast<unsigned int>(ch));
+      else
+         jsonText.AppendChar(ch);
+   }
+
+   jsonText.AppendChar(_T('"'));
+
+   return jsonText;
+}
+
+void CoffSectionSizeTree::AddObjects(const File& file,
+   const std::vector<size_t>& objectOffsets,
+   const std::vector<CString>& objectNames)
+{
+   ATLASSERT(objectOffsets.size() == objectNames.size());
+
+   if (objectOffsets.empty())
+      return;
+
+   // each chunk of objects is summed up in its own accumulator, so that no
+   // locking is needed while the objects are processed
+   size_t numberOfChunks = std::min<size_t>(objectOffsets.size(),
+      std::max(1U, std::thread::hardware_concurrency()));
+
+   std::vector<std::map<Path, ULONGLONG>> accumulators(numberOfChunks);
+   std::vector<ULONGLONG> accumulatorTotals(numberOfChunks, 0);
+
+   std::vector<size_t> chunks(numberOfChunks);
+   std::iota(chunks.begin(), chunks.end(), 0);
+
+   std::for_each(std::execution::par, chunks.begin(), chunks.end(),
+      [&](size_t chunk)
+      {
+         std::vector<CoffSectionSize> sectionSizes;
+
+         for (size_t index = chunk; index < objectOffsets.size(); index += numberOfChunks)
+         {
+            sectionSizes.clear();
+
+            CoffObjectNodeTreeBuilder nodeTreeBuilder{ file, objectOffsets[index], false };
+            nodeTreeBuilder.CollectSectionSizes(sectionSizes);
+
+            accumulatorTotals[chunk] +=
+               AddSectionsToMap(accumulators[chunk], objectNames[index], sectionSizes);
+         }
+      });
+
+   for (size_t chunk = 0; chunk < numberOfChunks; chunk++)
+   {
+      for (const auto& [path, size] : accumulators[chunk])
+         m_sizes[path] += size;
+
+      m_totalSize += accumulatorTotals[chunk];
+   }
+}
+
+void CoffSectionSizeTree::AddSections(const CString& objectName,
+   const std::vector<CoffSectionSize>& sectionSizes)
+{
+   m_totalSize += AddSectionsToMap(m_sizes, objectName, sectionSizes);
+}
+
+ULONGLONG CoffSectionSizeTree::AddSectionsToMap(std::map<Path, ULONGLONG>& sizes,
+   const CString& objectName,
+   const std::vector<CoffSectionSize>& sectionSizes)
+{
+   ULONGLONG totalSize = 0;
+
+   for (const CoffSectionSize& sectionSize : sectionSizes)
+   {
+      sizes[Path{ sectionSize.sectionName, CString{}, CString{} }] += sectionSize.size;
+
+      if (!objectName.IsEmpty())
+         sizes[Path{ sectionSize.sectionName, objectName, CString{} }] += sectionSize.size;
+
+      if (!sectionSize.comdatSymbolName.IsEmpty())
+         sizes[Path{ sectionSize.sectionName, objectName, sectionSize.comdatSymbolName }] += sectionSize.size;
+
+      totalSize += sectionSize.size;
+   }
+
+   return totalSize;
+}
+
+CString CoffSectionSizeTree::FormatJson(const CString& rootName) const
+{
+   CString jsonText;
+   jsonText.Format(_T("{ \"name\": %s, \"size\": %llu"),
+      FormatJsonString(rootName).GetString(),
+      m_totalSize);
+
+   /// JSON object that isn't closed yet
+   struct OpenObject
+   {
+      bool hasChildren = false;     ///< indicates if "children" array was started
+      ULONGLONG size = 0;           ///< size of the object
+      ULONGLONG childrenSize = 0;   ///< summed up sizes of all children
+   };
+
+   // the open JSON objects, starting with the root object
+   std::vector<OpenObject> openObjects{ OpenObject{ false, m_totalSize, 0 } };
+
+   // closes the innermost open object; when its children don't add up to
+   // its size, e.g. for an object's sections that aren't COMDAT sections, an
+   // "(other)" child with the remaining size is added
+   auto closeObject = [&]()
+   {
+      const OpenObject& openObject = openObjects.back();
+
+      if (openObject.hasChildren)
+      {
+         if (openObject.childrenSize < openObject.size)
+         {
+            jsonText += _T(",\n");
+            jsonText += CString{ _T(' '), static_cast<int>(openObjects.size() * 2) };
+            jsonText.AppendFormat(_T("{ \"name\": \"(other)\", \"size\": %llu }"),
+               openObject.size - openObject.childrenSize);
+         }
+
+         jsonText += _T(" ]");
+      }
+
+      jsonText += _T(" }");
+      openObjects.pop_back();
+   };
+
+   for (const auto& [path, size] : m_sizes)
+   {
+      const CString& sectionName = path.sectionName;
+      const CString& objectName = path.objectName;
+      const CString& symbolName = path.symbolName;
+
+      const CString& name = !symbolName.IsEmpty() ? symbolName
+         : !objectName.IsEmpty() ? objectName
+         : sectionName;
+
+      // the depth below the root object; the object level may be left out
+      size_t depth = 1 +
+         (objectName.IsEmpty() ? 0 : 1) +
+         (symbolName.IsEmpty() ? 0 : 1);
+
+      // close all objects on the same or a deeper level
+      while (openObjects.size() > depth)
+         closeObject();
+
+      OpenObject& parentObject = openObjects.back();
+      parentObject.childrenSize += size;
+
+      if (!parentObject.hasChildren)
+      {
+         jsonText += _T(", \"children\": [");
+         parentObject.hasChildren = true;
+      }
+      else
+         jsonText += _T(",");
+
+      jsonText += _T("\n");
+      jsonText += CString{ _T(' '), static_cast<int>(depth * 2) };
+
+      jsonText.AppendFormat(_T("{ \"name\": %s, \"size\": %llu"),
+         FormatJsonString(name).GetString(),
+         size);
+
+      openObjects.push_back(OpenObject{ false, size, 0 });
+   }
+
+   while (!openObjects.empty())
+      closeObject();
+
+   jsonText += _T("\n");
+
+   return jsonText;
+}
@@ -0,0 +1,96 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffSectionSizeTree.hpp
+/// \brief Hierarchical size breakdown of COFF sections
+//
+#pragma once
+
+#include "File.hpp"
+
+/// \brief Size of a single section of a COFF object or image
+struct CoffSectionSize
+{
+   /// section name
+   CString sectionName;
+
+   /// name of the COMDAT symbol the section belongs to; empty for sections
+   /// that aren't COMDAT sections
+   CString comdatSymbolName;
+
+   /// number of bytes of section data in the file
+   ULONGLONG size = 0;
+};
+
+/// \brief Hierarchical size breakdown of COFF sections
+/// \details Sums up the section sizes per section name, then per object
+/// (e.g. archive member), then per COMDAT symbol. The sizes are stored in a
+/// flat map whose keys are the paths in the hierarchy; parent entries use
+/// empty names for the lower levels, so that iterating the map visits each
+/// parent before its children.
+class CoffSectionSizeTree
+{
+public:
+   /// \brief Path of an entry in the hierarchy
+   /// \details Doesn't use std::tuple, since its C++20 comparison would
+   /// compare the CString pointers instead of the texts.
+   struct Path
+   {
+      CString sectionName;    ///< section name
+      CString objectName;     ///< object name; empty for section totals
+      CString symbolName;     ///< COMDAT symbol name; empty for totals
+
+      /// compares paths; parents are ordered before their children
+      bool operator<(const Path& other) const
+      {
+         if (sectionName != other.sectionName)
+            return sectionName < other.sectionName;
+
+         if (objectName != other.objectName)
+            return objectName < other.objectName;
+
+         return symbolName < other.symbolName;
+      }
+   };
+
+   /// ctor
+   CoffSectionSizeTree() = default;
+
+   /// adds the sections of all COFF objects at the given file offsets; the
+   /// objects are processed in parallel, with one accumulator per thread,
+   /// and the accumulators are merged at the end
+   void AddObjects(const File& file,
+      const std::vector<size_t>& objectOffsets,
+      const std::vector<CString>& objectNames);
+
+   /// adds the sections of a single object; when the object name is empty,
+   /// e.g. for images, the object level is left out
+   void AddSections(const CString& objectName,
+      const std::vector<CoffSectionSize>& sectionSizes);
+
+   /// returns the total size of all sections
+   ULONGLONG TotalSize() const { return m_totalSize; }
+
+   /// returns all entries, ordered by path
+   const std::map<Path, ULONGLONG>& Entries() const { return m_sizes; }
+
+   /// formats the size breakdown as JSON, with nested "children" arrays;
+   /// since only COMDAT sections have symbol entries, an object's COMDAT
+   /// children may not add up to the object's size, so the remaining size
+   /// is added as an "(other)" child
+   CString FormatJson(const CString& rootName) const;
+
+private:
+   /// adds sections to the given size map
+   static ULONGLONG AddSectionsToMap(std::map<Path, ULONGLONG>& sizes,
+      const CString& objectName,
+      const std::vector<CoffSectionSize>& sectionSizes);
+
+private:
+   /// sizes, by path
+   std::map<Path, ULONGLONG> m_sizes;
+
+   /// total size of all sections
+   ULONGLONG m_totalSize = 0;
+};
@@ -0,0 +1,245 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffSymbolConflictAnalyzer.cpp
+/// \brief Analyzer for conflicting external symbol definitions of COFF objects
+//
+#include "stdafx.h"
+#include "CoffSymbolConflictAnalyzer.hpp"
+#include "CoffObjectNodeTreeBuilder.hpp"
+#include "CoffAuxSymbol.hpp"
+#include "SymbolsHelper.hpp"
+#include <execution>
+#include <numeric>
+#include <unordered_map>
+
+void CoffSymbolConflictAnalyzer::AddObjects(const File& file,
+   const std::vector<size_t>& objectOffsets,
+   const std::vector<CString>& objectNames)
+{
+   ATLASSERT(objectOffsets.size() == objectNames.size());
+
+   size_t firstObjectIndex = m_objectNames.size();
+
+   m_objectNames.insert(m_objectNames.end(), objectNames.begin(), objectNames.end());
+   m_objectDefinitions.resize(m_objectNames.size());
+
+   std::vector<size_t> indices(objectOffsets.size());
+   std::iota(indices.begin(), indices.end(), 0);
+
+   std::for_each(std::execution::par, indices.begin(), indices.end(),
+      [&](size_t index)
+      {
+         size_t objectIndex = firstObjectIndex + index;
+
+         std::vector<CoffExternalDefinition> definitions;
+
+         CoffObjectNodeTreeBuilder nodeTreeBuilder{ file, objectOffsets[index], false };
+         nodeTreeBuilder.CollectExternalDefinitions(definitions);
+
+         // bucket the definitions by partition, using a counting sort
+         std::vector<size_t> partitions(definitions.size());
+
+         ObjectDefinitions& objectDefinitions = m_objectDefinitions[objectIndex];
+         std::array<size_t, c_numberOfPartitions + 1>& partitionStart = objectDefinitions.partitionStart;
+
+         for (size_t definitionIndex = 0; definitionIndex < definitions.size(); definitionIndex++)
+         {
+            partitions[definitionIndex] =
+               std::hash<std::string_view>{}(definitions[definitionIndex].name) % c_numberOfPartitions;
+
+            partitionStart[partitions[definitionIndex] + 1]++;
+         }
+
+         std::partial_sum(partitionStart.begin(), partitionStart.end(), partitionStart.begin());
+
+         std::array<size_t, c_numberOfPartitions + 1> insertPosition = partitionStart;
+
+         objectDefinitions.definitions.resize(definitions.size());
+
+         for (size_t definitionIndex = 0; definitionIndex < definitions.size(); definitionIndex++)
+         {
+            CoffExternalDefinition& definition =
+               objectDefinitions.definitions[insertPosition[partitions[definitionIndex]]++];
+
+            definition = definitions[definitionIndex];
+            definition.objectIndex = objectIndex;
+         }
+      });
+}
+
+void CoffSymbolConflictAnalyzer::Analyze()
+{
+   m_numberOfDefinitions = 0;
+   for (const ObjectDefinitions& objectDefinitions : m_objectDefinitions)
+      m_numberOfDefinitions += objectDefinitions.definitions.size();
+
+   // each partition only contains symbols with the same name hash bucket, so
+   // all partitions can be aggregated independently
+   std::vector<std::vector<CoffSymbolConflict>> partitionConflicts(c_numberOfPartitions);
+
+   std::vector<size_t> partitions(c_numberOfPartitions);
+   std::iota(partitions.begin(), partitions.end(), 0);
+
+   std::for_each(std::execution::par, partitions.begin(), partitions.end(),
+      [&](size_t partition)
+      {
+         std::unordered_map<std::string_view, std::vector<const CoffExternalDefinition*>> definitionsByName;
+
+         for (const ObjectDefinitions& objectDefinitions : m_objectDefinitions)
+         {
+            for (size_t definitionIndex = objectDefinitions.partitionStart[partition];
+               definitionIndex < objectDefinitions.partitionStart[partition + 1];
+               definitionIndex++)
+            {
+               const CoffExternalDefinition& definition = objectDefinitions.definitions[definitionIndex];
+               definitionsByName[definition.name].push_back(&definition);
+            }
+         }
+
+         for (const auto& [name, definitions] : definitionsByName)
+         {
+            CoffSymbolConflictKind kind = CoffSymbolConflictKind::multiplyDefined;
+            if (definitions.size() < 2 ||
+               !CheckConflict(definitions, kind))
+               continue;
+
+            CoffSymbolConflict conflict;
+            conflict.name = CString{ name.data(), static_cast<int>(name.size()) };
+            conflict.kind = kind;
+
+            for (const CoffExternalDefinition* definition : definitions)
+               conflict.objectIndices.push_back(definition->objectIndex);
+
+            partitionConflicts[partition].push_back(std::move(conflict));
+         }
+      });
+
+   m_conflicts.clear();
+   for (std::vector<CoffSymbolConflict>& conflicts : partitionConflicts)
+   {
+      std::move(conflicts.begin(), conflicts.end(),
+         std::back_inserter(m_conflicts));
+   }
+
+   std::sort(m_conflicts.begin(), m_conflicts.end(),
+      [](const CoffSymbolConflict& lhs, const CoffSymbolConflict& rhs)
+      {
+         return lhs.name < rhs.name;
+      });
+}
+
+LPCTSTR CoffSymbolConflictAnalyzer::GetConflictKindDisplayText(CoffSymbolConflictKind kind)
+{
+   switch (kind)
+   {
+   case CoffSymbolConflictKind::multiplyDefined:
+      return _T("Multiply defined");
+
+   case CoffSymbolConflictKind::comdatAndNonComdat:
+      return _T("Defined in COMDAT and non-COMDAT sections");
+
+   case CoffSymbolConflictKind::comdatSelectionMismatch:
+      return _T("COMDAT selection mismatch");
+
+   case CoffSymbolConflictKind::comdatNoDuplicates:
+      return _T("Duplicate COMDAT, selection doesn't allow duplicates");
+
+   case CoffSymbolConflictKind::comdatSizeMismatch:
+      return _T("COMDAT size mismatch");
+
+   case CoffSymbolConflictKind::comdatContentMismatch:
+      return _T("COMDAT contents mismatch");
+
+   default:
+      ATLASSERT(false);
+      return _T("unknown");
+   }
+}
+
+const std::vector<CString>& CoffSymbolConflictAnalyzer::GetConflictListColumnNames()
+{
+   static std::vector<CString> conflictListColumnNames
+   {
+      _T("Index"),
+      _T("Symbol"),
+      _T("Undecorated symbol"),
+      _T("Conflict"),
+      _T("Definitions"),
+      _T("Defined in"),
+   };
+
+   return conflictListColumnNames;
+}
+
+std::vector<CString> CoffSymbolConflictAnalyzer::FormatConflictListRow(size_t conflictIndex,
+   const CoffSymbolConflict& conflict,
+   const std::vector<CString>& objectNames)
+{
+   CString indexText;
+   indexText.Format(_T("%zu"), conflictIndex);
+
+   CString definitionsText;
+   definitionsText.Format(_T("%zu"), conflict.objectIndices.size());
+
+   CString definedInText;
+   for (size_t objectIndex : conflict.objectIndices)
+   {
+      if (!definedInText.IsEmpty())
+         definedInText += _T(", ");
+
+      definedInText += objectNames[objectIndex];
+   }
+
+   return std::vector<CString> {
+      indexText,
+      conflict.name,
+      SymbolsHelper::UndecorateSymbol(conflict.name),
+      GetConflictKindDisplayText(conflict.kind),
+      definitionsText,
+      definedInText,
+   };
+}
+
+bool CoffSymbolConflictAnalyzer::CheckConflict(
+   const std::vector<const CoffExternalDefinition*>& definitions,
+   CoffSymbolConflictKind& kind)
+{
+   const CoffExternalDefinition& first = *definitions.front();
+
+   bool anyComdat = false;
+   bool anyNonComdat = false;
+   bool isSameSelection = true;
+   bool isSameSize = true;
+   bool isSameCheckSum = true;
+
+   for (const CoffExternalDefinition* definition : definitions)
+   {
+      if (definition->selection != 0)
+         anyComdat = true;
+      else
+         anyNonComdat = true;
+
+      isSameSelection = isSameSelection && definition->selection == first.selection;
+      isSameSize = isSameSize && definition->sectionLength == first.sectionLength;
+      isSameCheckSum = isSameCheckSum && definition->checkSum == first.checkSum;
+   }
+
+   if (!anyComdat)
+      kind = CoffSymbolConflictKind::multiplyDefined;
+   else if (anyNonComdat)
+      kind = CoffSymbolConflictKind::comdatAndNonComdat;
+   else if (!isSameSelection)
+      kind = CoffSymbolConflictKind::comdatSelectionMismatch;
+   else if (first.selection == c_coffComdatSelectNoDuplicates)
+      kind = CoffSymbolConflictKind::comdatNoDuplicates;
+   else if (first.selection == c_coffComdatSelectSameSize && !isSameSize)
+      kind = CoffSymbolConflictKind::comdatSizeMismatch;
+   else if (first.selection == c_coffComdatSelectExactMatch && (!isSameSize || !isSameCheckSum))
+      kind = CoffSymbolConflictKind::comdatContentMismatch;
+   else
+      return false; // e.g. IMAGE_COMDAT_SELECT_ANY or IMAGE_COMDAT_SELECT_LARGEST
+
+   return true;
+}
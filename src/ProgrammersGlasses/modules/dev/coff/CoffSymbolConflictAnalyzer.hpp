@@ -0,0 +1,148 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffSymbolConflictAnalyzer.hpp
+/// \brief Analyzer for conflicting external symbol definitions of COFF objects
+//
+#pragma once
+
+#include "File.hpp"
+#include <string_view>
+
+/// \brief External symbol definition in a COFF object
+struct CoffExternalDefinition
+{
+   /// symbol name; references the mapped symbol or string table
+   std::string_view name;
+
+   /// index of the object defining the symbol, as added to the analyzer
+   size_t objectIndex = 0;
+
+   /// COMDAT selection of the defining section, or 0 for non-COMDAT sections
+   BYTE selection = 0;
+
+   /// length of the defining section
+   DWORD sectionLength = 0;
+
+   /// checksum of the defining section's data
+   DWORD checkSum = 0;
+};
+
+/// \brief Kind of symbol conflict
+enum class CoffSymbolConflictKind
+{
+   /// symbol is defined in more than one non-COMDAT section
+   multiplyDefined,
+
+   /// symbol is defined in COMDAT and in non-COMDAT sections
+   comdatAndNonComdat,
+
+   /// COMDAT sections use different selection values
+   comdatSelectionMismatch,
+
+   /// COMDAT sections don't allow duplicates
+   comdatNoDuplicates,
+
+   /// COMDAT sections must have the same size, but differ
+   comdatSizeMismatch,
+
+   /// COMDAT sections must have the same contents, but differ
+   comdatContentMismatch,
+};
+
+/// \brief Conflicting definitions of a single external symbol
+struct CoffSymbolConflict
+{
+   /// symbol name
+   CString name;
+
+   /// conflict kind
+   CoffSymbolConflictKind kind = CoffSymbolConflictKind::multiplyDefined;
+
+   /// indices of the objects defining the symbol
+   std::vector<size_t> objectIndices;
+};
+
+/// \brief Analyzer for conflicting external symbol definitions
+/// \details Collects the external symbol definitions of many COFF objects,
+/// e.g. all members of one or more libraries, and reports symbols that the
+/// linker would report as multiply defined, as well as conflicting COMDAT
+/// selections. The definitions of each object are collected in parallel and
+/// are bucketed by the hash of the symbol name; the buckets are then
+/// aggregated in parallel, independent of each other.
+class CoffSymbolConflictAnalyzer
+{
+public:
+   /// ctor
+   CoffSymbolConflictAnalyzer() = default;
+
+   /// adds COFF objects at the given offsets of a file; may be called for
+   /// multiple files, which must stay open until Analyze() has been called
+   void AddObjects(const File& file,
+      const std::vector<size_t>& objectOffsets,
+      const std::vector<CString>& objectNames);
+
+   /// analyzes all added objects for conflicting definitions
+   void Analyze();
+
+   /// returns the number of added objects
+   size_t NumberOfObjects() const { return m_objectNames.size(); }
+
+   /// returns the name of an added object
+   const CString& ObjectName(size_t objectIndex) const { return m_objectNames[objectIndex]; }
+
+   /// returns the names of all added objects
+   const std::vector<CString>& ObjectNames() const { return m_objectNames; }
+
+   /// returns the number of external definitions of all objects
+   size_t NumberOfDefinitions() const { return m_numberOfDefinitions; }
+
+   /// returns all conflicts, sorted by symbol name
+   const std::vector<CoffSymbolConflict>& Conflicts() const { return m_conflicts; }
+
+   /// returns a display text for a conflict kind
+   static LPCTSTR GetConflictKindDisplayText(CoffSymbolConflictKind kind);
+
+   /// returns the column names of a list of conflicts
+   static const std::vector<CString>& GetConflictListColumnNames();
+
+   /// formats a conflict as row of a list of conflicts; the object names are
+   /// the names of all objects added to the analyzer
+   static std::vector<CString> FormatConflictListRow(size_t conflictIndex,
+      const CoffSymbolConflict& conflict,
+      const std::vector<CString>& objectNames);
+
+private:
+   /// number of partitions that the definitions are bucketed into
+   static constexpr size_t c_numberOfPartitions = 64;
+
+   /// external definitions of a single object, ordered by partition
+   struct ObjectDefinitions
+   {
+      /// definitions, ordered by partition
+      std::vector<CoffExternalDefinition> definitions;
+
+      /// start index of each partition's definitions; the last entry is the
+      /// number of definitions
+      std::array<size_t, c_numberOfPartitions + 1> partitionStart{};
+   };
+
+   /// checks the definitions of a single symbol for conflicts
+   static bool CheckConflict(
+      const std::vector<const CoffExternalDefinition*>& definitions,
+      CoffSymbolConflictKind& kind);
+
+private:
+   /// names of all added objects
+   std::vector<CString> m_objectNames;
+
+   /// definitions of all added objects
+   std::vector<ObjectDefinitions> m_objectDefinitions;
+
+   /// number of external definitions of all objects
+   size_t m_numberOfDefinitions = 0;
+
+   /// all conflicts found
+   std::vector<CoffSymbolConflict> m_conflicts;
+};
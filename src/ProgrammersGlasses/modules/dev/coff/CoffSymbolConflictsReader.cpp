@@ -0,0 +1,101 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffSymbolConflictsReader.cpp
+/// \brief reader that analyzes COFF libraries and objects for symbol conflicts
+//
+#include "stdafx.h"
+#include "CoffSymbolConflictsReader.hpp"
+#include "CoffSymbolConflictAnalyzer.hpp"
+#include "CoffReader.hpp"
+#include "ArchiveFileNodeTreeBuilder.hpp"
+#include "CodeTextViewNode.hpp"
+#include "FilterSortListViewNode.hpp"
+
+CoffSymbolConflictsReader::CoffSymbolConflictsReader(const std::vector<File>& files)
+   :m_files(files)
+{
+   ATLASSERT(!m_files.empty());
+}
+
+void CoffSymbolConflictsReader::Load()
+{
+   auto analyzer = std::make_shared<CoffSymbolConflictAnalyzer>();
+
+   CString summaryText;
+   for (const File& file : m_files)
+   {
+      std::vector<size_t> objectOffsets;
+      std::vector<CString> objectNames;
+
+      CString filename = Path::FilenameAndExt(file.Filename());
+
+      if (CoffReader::IsArLibraryFile(file))
+      {
+         ArchiveFileNodeTreeBuilder{ file, 0 }.CollectCoffObjectMembers(
+            objectOffsets, objectNames);
+
+         // name the members like the linker does, e.g. "library.lib(object.obj)"
+         for (CString& objectName : objectNames)
+            objectName = filename + _T("(") + objectName + _T(")");
+      }
+      else if (CoffReader::IsCoffObjectFile(file))
+      {
+         objectOffsets.push_back(0);
+         objectNames.push_back(filename);
+      }
+      else
+      {
+         summaryText.AppendFormat(_T("Error: Not a COFF library or object file: %s\n"),
+            file.Filename().GetString());
+         continue;
+      }
+
+      summaryText.AppendFormat(_T("%s: %zu COFF objects\n"),
+         file.Filename().GetString(),
+         objectOffsets.size());
+
+      analyzer->AddObjects(file, objectOffsets, objectNames);
+   }
+
+   analyzer->Analyze();
+
+   summaryText.AppendFormat(
+      _T("\nExternal symbol definitions: %zu, in %zu COFF objects of %zu files\n")
+      _T("Symbol conflicts: %zu\n"),
+      analyzer->NumberOfDefinitions(),
+      analyzer->NumberOfObjects(),
+      m_files.size(),
+      analyzer->Conflicts().size());
+
+   auto rootNode = std::make_shared<CodeTextViewNode>(
+      _T("Symbol Conflicts"),
+      NodeTreeIconID::nodeTreeIconDocument);
+
+   rootNode->SetText(summaryText);
+
+   m_rootNode = rootNode;
+
+   if (analyzer->Conflicts().empty())
+      return;
+
+   rootNode->ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Symbol Conflicts List"),
+         NodeTreeIconID::nodeTreeIconTable,
+         CoffSymbolConflictAnalyzer::GetConflictListColumnNames(),
+         analyzer->Conflicts().size(),
+         [analyzer](size_t rowIndex)
+         {
+            return CoffSymbolConflictAnalyzer::FormatConflictListRow(rowIndex,
+               analyzer->Conflicts()[rowIndex],
+               analyzer->ObjectNames());
+         },
+         true));
+}
+
+void CoffSymbolConflictsReader::Cleanup()
+{
+   // nothing expensive to cleanup here
+}
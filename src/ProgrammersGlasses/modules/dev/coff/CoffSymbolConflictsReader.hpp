@@ -0,0 +1,46 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffSymbolConflictsReader.hpp
+/// \brief reader that analyzes COFF libraries and objects for symbol conflicts
+//
+#pragma once
+
+#include "IReader.hpp"
+
+/// \brief COFF symbol conflicts reader
+/// \details Analyzes the external symbol definitions of all COFF objects in
+/// one or more libraries and object files together, and shows the symbols
+/// that the linker would report as multiply defined when linking all files
+/// into the same image.
+class CoffSymbolConflictsReader : public IReader
+{
+public:
+   /// ctor
+   explicit CoffSymbolConflictsReader(const std::vector<File>& files);
+
+   // Inherited via IReader
+
+   /// returns the filename of the first file
+   const CString& Filename() const override
+   {
+      return m_files.front().Filename();
+   }
+
+   std::shared_ptr<INode> RootNode() const override
+   {
+      return m_rootNode;
+   }
+
+   void Load() override;
+   void Cleanup() override;
+
+private:
+   /// files to analyze; kept open, since the analyzer refers to the symbol
+   /// names in the mapped files
+   std::vector<File> m_files;
+
+   /// root node
+   std::shared_ptr<INode> m_rootNode;
+};
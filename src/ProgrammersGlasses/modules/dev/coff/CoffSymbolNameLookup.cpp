@@ -0,0 +1,62 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffSymbolNameLookup.cpp
+/// \brief Lookup of COFF symbol names by symbol table index
+//
+#include "stdafx.h"
+#include "CoffSymbolNameLookup.hpp"
+
+/// size of the short name field, at the start of each symbol record
+constexpr size_t c_coffShortNameSize = 8;
+
+CoffSymbolNameLookup::CoffSymbolNameLookup(const File& file, size_t symbolTableOffset,
+   size_t numberOfSymbols, size_t symbolSize)
+   :m_file(file),
+   m_symbolTableOffset(symbolTableOffset),
+   m_numberOfSymbols(0),
+   m_symbolSize(symbolSize)
+{
+   if (symbolTableOffset > m_file.Size())
+      return;
+
+   m_numberOfSymbols = std::min(numberOfSymbols,
+      (m_file.Size() - symbolTableOffset) / symbolSize);
+
+   m_stringTableOffset = symbolTableOffset + m_numberOfSymbols * symbolSize;
+
+   if (m_numberOfSymbols == numberOfSymbols &&
+      m_stringTableOffset + sizeof(DWORD) <= m_file.Size())
+   {
+      m_stringTableSize = std::min<size_t>(
+         *m_file.Data<DWORD>(m_stringTableOffset),
+         m_file.Size() - m_stringTableOffset);
+   }
+}
+
+CString CoffSymbolNameLookup::GetSymbolName(size_t symbolIndex) const
+{
+   if (symbolIndex >= m_numberOfSymbols)
+      return CString{};
+
+   const CHAR* name = m_file.Data<CHAR>(m_symbolTableOffset + symbolIndex * m_symbolSize);
+
+   // long names start with 4 zero bytes, followed by the string table offset
+   if (name[0] == 0 && name[1] == 0 && name[2] == 0 && name[3] == 0)
+      return GetString(*reinterpret_cast<const DWORD*>(name + 4));
+
+   return CString{ name, static_cast<int>(strnlen(name, c_coffShortNameSize)) };
+}
+
+CString CoffSymbolNameLookup::GetString(size_t stringTableOffset) const
+{
+   // the first 4 bytes of the string table contain its size
+   if (stringTableOffset < sizeof(DWORD) ||
+      stringTableOffset >= m_stringTableSize)
+      return CString{};
+
+   const CHAR* text = m_file.Data<CHAR>(m_stringTableOffset + stringTableOffset);
+
+   return CString{ text, static_cast<int>(strnlen(text, m_stringTableSize - stringTableOffset)) };
+}
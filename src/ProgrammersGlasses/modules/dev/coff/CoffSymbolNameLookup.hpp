@@ -0,0 +1,53 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file CoffSymbolNameLookup.hpp
+/// \brief Lookup of COFF symbol names by symbol table index
+//
+#pragma once
+
+#include "File.hpp"
+
+/// \brief Lookup of COFF symbol names by symbol table index
+/// \details Reads the symbol name directly from the mapped symbol table, and
+/// long names from the mapped string table, so that no names have to be
+/// collected in advance. Supports any symbol record size, as long as the
+/// record starts with the 8 byte short name or string table offset.
+class CoffSymbolNameLookup
+{
+public:
+   /// ctor
+   CoffSymbolNameLookup(const File& file, size_t symbolTableOffset,
+      size_t numberOfSymbols, size_t symbolSize);
+
+   /// returns the number of symbol table entries, including aux symbols
+   size_t NumberOfSymbols() const { return m_numberOfSymbols; }
+
+   /// returns the name of the symbol with given symbol table index; returns
+   /// an empty string when the index is outside of the symbol table
+   CString GetSymbolName(size_t symbolIndex) const;
+
+   /// returns the string at the given string table offset, or an empty
+   /// string when the offset is outside of the string table
+   CString GetString(size_t stringTableOffset) const;
+
+private:
+   /// file containing the symbol table
+   const File& m_file;
+
+   /// file offset of the symbol table
+   size_t m_symbolTableOffset;
+
+   /// number of symbols that are inside the file
+   size_t m_numberOfSymbols;
+
+   /// size of a single symbol table record
+   size_t m_symbolSize;
+
+   /// file offset of the string table, following the symbol table
+   size_t m_stringTableOffset = 0;
+
+   /// size of the string table, including the size field
+   size_t m_stringTableSize = 0;
+};
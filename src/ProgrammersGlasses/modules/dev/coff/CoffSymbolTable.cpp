@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020-2023 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file CoffSymbolTable.cpp
 /// \brief COFF symbol table definition
@@ -59,7 +59,9 @@ const std::map<DWORD, LPCTSTR> g_mapCoffSymbolTableStorageClassToDisplayText =
    { 2, _T("IMAGE_SYM_CLASS_EXTERNAL") },
    { 3, _T("IMAGE_SYM_CLASS_STATIC") },
    { 102, _T("IMAGE_SYM_CLASS_END_OF_STRUCT") },
+   { 101, _T("IMAGE_SYM_CLASS_FUNCTION") },
    { 103, _T("IMAGE_SYM_CLASS_FILE") },
+   { 105, _T("IMAGE_SYM_CLASS_WEAK_EXTERNAL") },
 };
 
 const StructDefinition g_definitionCoffSymbolTable = StructDefinition({
@@ -113,3 +115,55 @@ const StructDefinition g_definitionCoffSymbolTable = StructDefinition({
       StructFieldType::unsignedInteger,
       _T("Number of aux. symbols")),
    });
+
+const StructDefinition g_definitionCoffSymbolTableBigObj = StructDefinition({
+   StructField(
+      offsetof(CoffSymbolTableBigObj, CoffSymbolTableBigObj::name),
+      sizeof(CoffSymbolTableBigObj::name),
+      1,
+      true, // little-endian
+      StructFieldType::text,
+      _T("Symbol table name")),
+
+   StructField(
+      offsetof(CoffSymbolTableBigObj, CoffSymbolTableBigObj::value),
+      sizeof(CoffSymbolTableBigObj::value),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Symbol value")),
+
+   StructField(
+      offsetof(CoffSymbolTableBigObj, CoffSymbolTableBigObj::sectionNumber),
+      sizeof(CoffSymbolTableBigObj::sectionNumber),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger, // originally a signed value
+      _T("Section number")),
+
+   StructField(
+      offsetof(CoffSymbolTableBigObj, CoffSymbolTableBigObj::type),
+      sizeof(CoffSymbolTableBigObj::type),
+      1,
+      true, // little-endian
+      StructFieldType::bitfieldMapping,
+      g_listCoffSymbolTableTypeBits,
+      _T("Symbol type")),
+
+   StructField(
+      offsetof(CoffSymbolTableBigObj, CoffSymbolTableBigObj::storageClass),
+      sizeof(CoffSymbolTableBigObj::storageClass),
+      1,
+      true, // little-endian
+      StructFieldType::valueMapping,
+      g_mapCoffSymbolTableStorageClassToDisplayText,
+      _T("Storage class")),
+
+   StructField(
+      offsetof(CoffSymbolTableBigObj, CoffSymbolTableBigObj::numberOfAuxSymbols),
+      sizeof(CoffSymbolTableBigObj::numberOfAuxSymbols),
+      1,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Number of aux. symbols")),
+   });
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file CoffSymbolTable.hpp
 /// \brief COFF symbol table definition
@@ -33,9 +33,39 @@ struct CoffSymbolTable
    BYTE numberOfAuxSymbols;
 };
 
+/// \brief COFF symbol table entry of BigObj COFF objects
+/// \see https://peter0x44.github.io/posts/bigobj_format_explained/
+/// The struct corresponds with winnt.h's IMAGE_SYMBOL_EX struct. Aux symbols
+/// have the same size as the symbol table entry.
+struct CoffSymbolTableBigObj
+{
+   /// symbol name
+   CHAR name[8];
+
+   /// value of the symbol, e.g. relocatable address
+   DWORD value;
+
+   /// (signed) 1-based index into the section table; 32-bit field
+   DWORD sectionNumber;
+
+   /// symbol type
+   WORD type;
+
+   /// storage class enumeration
+   BYTE storageClass;
+
+   /// the number of auxiliary symbol table entries following this struct
+   BYTE numberOfAuxSymbols;
+};
+
 #pragma pack(pop)
 
 static_assert(sizeof(CoffSymbolTable) == 18, "COFF symbol table must be 18 bytes long");
 
+static_assert(sizeof(CoffSymbolTableBigObj) == 20, "BigObj COFF symbol table must be 20 bytes long");
+
 /// struct definition for above COFF symbol table
 extern const StructDefinition g_definitionCoffSymbolTable;
+
+/// struct definition for above BigObj COFF symbol table
+extern const StructDefinition g_definitionCoffSymbolTableBigObj;
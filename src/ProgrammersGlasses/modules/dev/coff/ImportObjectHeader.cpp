@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2023 Michael Fink
+// Copyright (c) 2023-2026 Michael Fink
 //
 /// \file ImportObjectHeader.cpp
 /// \brief header definition of import object files
@@ -127,3 +127,72 @@ const StructDefinition g_definitionImportObjectHeader = StructDefinition({
       g_listImportObjectHeaderFlagBits,
       _T("Flags bitfield")),
    });
+
+/// \brief Reads a zero-terminated string from the import object data
+/// \return false when the string isn't terminated inside the data
+static bool ReadImportObjectString(const CHAR*& data, size_t& remainingSize, CString& text)
+{
+   size_t length = strnlen(data, remainingSize);
+   if (length == remainingSize)
+      return false;
+
+   text = CString{ data, static_cast<int>(length) };
+
+   data += length + 1;
+   remainingSize -= length + 1;
+
+   return true;
+}
+
+bool DecodeImportObjectNames(const ImportObjectHeader& header,
+   size_t availableSize, ImportObjectNames& names)
+{
+   const CHAR* data = reinterpret_cast<const CHAR*>(&header + 1);
+   size_t remainingSize = std::min<size_t>(header.sizeOfData, availableSize);
+
+   if (!ReadImportObjectString(data, remainingSize, names.symbolName) ||
+      !ReadImportObjectString(data, remainingSize, names.dllName))
+      return false;
+
+   // the import name is derived from the symbol name, as the linker does
+   names.importName.Empty();
+
+   WORD nameType = GetImportObjectNameType(header);
+   switch (nameType)
+   {
+   case c_importObjectNameTypeOrdinal:
+      break;
+
+   case c_importObjectNameTypeName:
+      names.importName = names.symbolName;
+      break;
+
+   case c_importObjectNameTypeNameNoPrefix:
+   case c_importObjectNameTypeNameUndecorate:
+      names.importName = names.symbolName;
+
+      // the underscore prefix is only added to C symbols on x86
+      if (!names.importName.IsEmpty() &&
+         (names.importName[0] == _T('?') || names.importName[0] == _T('@') ||
+            (names.importName[0] == _T('_') && header.targetMachine == IMAGE_FILE_MACHINE_I386)))
+         names.importName = names.importName.Mid(1);
+
+      if (nameType == c_importObjectNameTypeNameUndecorate)
+      {
+         int pos = names.importName.Find(_T('@'));
+         if (pos != -1)
+            names.importName = names.importName.Left(pos);
+      }
+      break;
+
+   case c_importObjectNameTypeExportAs:
+      if (!ReadImportObjectString(data, remainingSize, names.importName))
+         return false;
+      break;
+
+   default:
+      break;
+   }
+
+   return true;
+}
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2023 Michael Fink
+// Copyright (c) 2023-2026 Michael Fink
 //
 /// \file ImportObjectHeader.hpp
 /// \brief header definition of import object files
@@ -47,5 +47,61 @@ extern const std::map<DWORD, LPCTSTR> g_mapNonCoffHeaderSignature2ToDisplayText;
 /// version values to display text mapping
 extern const std::map<DWORD, LPCTSTR> g_mapNonCoffHeaderVersionToDisplayText;
 
+/// import object type values to display text mapping
+extern const std::map<DWORD, LPCTSTR> g_mapImportObjectTypeToDisplayText;
+
+/// import object name type values to display text mapping
+extern const std::map<DWORD, LPCTSTR> g_mapImportObjectNameTypeToDisplayText;
+
 /// struct definition for above Import object header
 extern const StructDefinition g_definitionImportObjectHeader;
+
+/// import object name type for imports by ordinal
+constexpr WORD c_importObjectNameTypeOrdinal = 0;
+
+/// import object name type where the import name is the symbol name
+constexpr WORD c_importObjectNameTypeName = 1;
+
+/// import object name type where the leading ? or @, or the leading _ for x86,
+/// is stripped
+constexpr WORD c_importObjectNameTypeNameNoPrefix = 2;
+
+/// import object name type where the prefix and everything after @ is stripped
+constexpr WORD c_importObjectNameTypeNameUndecorate = 3;
+
+/// import object name type where the import name is stored after the DLL name
+constexpr WORD c_importObjectNameTypeExportAs = 4;
+
+/// returns the import object type, stored in the flags bitfield
+inline WORD GetImportObjectType(const ImportObjectHeader& header)
+{
+   return header.flags & 0x3;
+}
+
+/// returns the import object name type, stored in the flags bitfield
+inline WORD GetImportObjectNameType(const ImportObjectHeader& header)
+{
+   return (header.flags >> 2) & 0x7;
+}
+
+/// \brief Names stored in the data following the import object header
+struct ImportObjectNames
+{
+   /// public symbol name, e.g. "CreateFileW", or "_CreateFileW@28" for x86
+   CString symbolName;
+
+   /// name of the DLL to import from
+   CString dllName;
+
+   /// name of the import in the DLL export table, derived from the symbol
+   /// name and the name type; empty for imports by ordinal
+   CString importName;
+};
+
+/// \brief Decodes the names following the import object header
+/// \param header import object header, followed by the import object data
+/// \param availableSize number of bytes available after the header
+/// \param names decoded names
+/// \return false when the names are outside of the available data
+bool DecodeImportObjectNames(const ImportObjectHeader& header,
+   size_t availableSize, ImportObjectNames& names);
@@ -14,6 +14,8 @@
 #include "ImportObjectHeader.hpp"
 #include "AnonymousObjectHeader.hpp"
 #include "AnonymousObjectHeaderBigObj.hpp"
+#include "CoffObjectNodeTreeBuilder.hpp"
+#include "../clr/ClrMetadataNodeTreeBuilder.hpp"
 
 bool NonCoffObjectNodeTreeBuilder::IsNonCoffOrAnonymousObjectFile(
    const File& file, size_t fileOffset)
@@ -171,6 +173,19 @@ void NonCoffObjectNodeTreeBuilder::AddBigObjAnonymousObjectNode(
    CodeTextViewNode& nonCoffSummaryNode,
    const AnonymousObjectHeaderBigObj& bigObjAnonymousObjectHeader)
 {
+   // BigObj COFF objects contain sections and symbols, just like regular COFF
+   // objects; other version 2 anonymous objects only contain raw data
+   if (CoffObjectNodeTreeBuilder::IsBigObjCoffObject(m_file, m_fileOffset))
+   {
+      CoffObjectNodeTreeBuilder nodeTreeBuilder{ m_file, m_fileOffset, false };
+
+      nonCoffSummaryNode.ChildNodes().push_back(
+         nodeTreeBuilder.BuildCoffObjectNode());
+
+      m_objectFileSummary = nodeTreeBuilder.GetObjectFileSummary();
+      return;
+   }
+
    m_objectFileSummary = _T("BigObj anonymous object\n");
    m_objectFileSummary += CString{ _T("Architecture: ") } +
       GetValueFromMapOrDefault<DWORD>(
@@ -199,6 +214,20 @@ void NonCoffObjectNodeTreeBuilder::AddBigObjAnonymousObjectNode(
          bigObjAnonymousObjectHeader.metadataSize);
 
       nonCoffSummaryNode.ChildNodes().push_back(hexDataNode);
+
+      if (size_t(bigObjAnonymousObjectHeader.metadataOffset) +
+         bigObjAnonymousObjectHeader.metadataSize <= m_file.Size())
+      {
+         ClrMetadataNodeTreeBuilder builder{ m_file,
+            bigObjAnonymousObjectHeader.metadataOffset,
+            bigObjAnonymousObjectHeader.metadataSize };
+
+         nonCoffSummaryNode.ChildNodes().push_back(builder.BuildMetadataNode());
+
+         m_objectFileSummary += builder.GetMetadataSummary();
+      }
+      else
+         m_objectFileSummary += _T("Error: CLR metadata is outside of the file.\n");
    }
 
    if (bigObjAnonymousObjectHeader.sizeOfData > 0)
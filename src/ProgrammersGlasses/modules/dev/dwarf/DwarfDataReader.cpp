@@ -0,0 +1,147 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file DwarfDataReader.cpp
+/// \brief reader for DWARF section data
+//
+#include "stdafx.h"
+#include "DwarfDataReader.hpp"
+
+DwarfDataReader::DwarfDataReader(const BYTE* data, size_t size, bool littleEndian, size_t offset)
+   :m_data(data),
+   m_size(data != nullptr ? size : 0),
+   m_littleEndian(littleEndian),
+   m_offset(0)
+{
+   Seek(offset);
+}
+
+void DwarfDataReader::Seek(size_t offset)
+{
+   if (offset > m_size)
+      SetError();
+   else
+      m_offset = offset;
+}
+
+void DwarfDataReader::Skip(size_t count)
+{
+   if (count > Remaining())
+      SetError();
+   else
+      m_offset += count;
+}
+
+ULONGLONG DwarfDataReader::ReadUnsigned(size_t size)
+{
+   ATLASSERT(size >= 1 && size <= 8);
+
+   if (size > Remaining())
+   {
+      SetError();
+      return 0;
+   }
+
+   const BYTE* data = m_data + m_offset;
+   m_offset += size;
+
+   ULONGLONG value = 0;
+   for (size_t index = 0; index < size; index++)
+   {
+      BYTE byte = m_littleEndian ? data[size - 1 - index] : data[index];
+      value = (value << 8) | byte;
+   }
+
+   return value;
+}
+
+ULONGLONG DwarfDataReader::ReadUleb128()
+{
+   ULONGLONG value = 0;
+   unsigned int shift = 0;
+
+   while (m_offset < m_size)
+   {
+      BYTE byte = m_data[m_offset++];
+
+      if (shift < 64)
+         value |= static_cast<ULONGLONG>(byte & 0x7f) << shift;
+
+      shift += 7;
+
+      if ((byte & 0x80) == 0)
+         return value;
+   }
+
+   SetError();
+   return 0;
+}
+
+LONGLONG DwarfDataReader::ReadSleb128()
+{
+   ULONGLONG value = 0;
+   unsigned int shift = 0;
+
+   while (m_offset < m_size)
+   {
+      BYTE byte = m_data[m_offset++];
+
+      if (shift < 64)
+         value |= static_cast<ULONGLONG>(byte & 0x7f) << shift;
+
+      shift += 7;
+
+      if ((byte & 0x80) == 0)
+      {
+         // sign extend
+         if (shift < 64 && (byte & 0x40) != 0)
+            value |= ~0ULL << shift;
+
+         return static_cast<LONGLONG>(value);
+      }
+   }
+
+   SetError();
+   return 0;
+}
+
+const char* DwarfDataReader::ReadString()
+{
+   if (IsAtEnd())
+   {
+      SetError();
+      return "";
+   }
+
+   const char* text = reinterpret_cast<const char*>(m_data + m_offset);
+   size_t length = strnlen(text, Remaining());
+
+   if (length == Remaining())
+   {
+      SetError();
+      return "";
+   }
+
+   m_offset += length + 1;
+   return text;
+}
+
+ULONGLONG DwarfDataReader::ReadInitialLength(bool& is64BitFormat)
+{
+   ULONGLONG length = ReadDword();
+
+   // 0xffffffff escapes to the 64-bit DWARF format; the other values from
+   // 0xfffffff0 on are reserved
+   is64BitFormat = length == 0xffffffff;
+   if (is64BitFormat)
+      length = ReadQword();
+
+   return length;
+}
+
+void DwarfDataReader::SetError()
+{
+   m_hasError = true;
+   m_offset = m_size;
+}
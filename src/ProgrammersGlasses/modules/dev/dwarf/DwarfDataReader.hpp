@@ -0,0 +1,92 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file DwarfDataReader.hpp
+/// \brief reader for DWARF section data
+//
+#pragma once
+
+/// \brief Reader for DWARF section data
+/// \details Reads fixed size values in the byte order of the file, as well as
+/// LEB128 encoded values and strings. All reads are bounds checked; reading
+/// past the end of the data sets the error flag, moves to the end and returns
+/// zero values, so that decoding loops only need to check for errors once.
+class DwarfDataReader
+{
+public:
+   /// ctor
+   DwarfDataReader(const BYTE* data, size_t size, bool littleEndian, size_t offset = 0);
+
+   /// returns if a read went past the end of the data
+   bool HasError() const { return m_hasError; }
+
+   /// returns if the end of the data was reached
+   bool IsAtEnd() const { return m_offset >= m_size; }
+
+   /// returns the current offset
+   size_t Offset() const { return m_offset; }
+
+   /// returns the number of remaining bytes
+   size_t Remaining() const { return m_size - m_offset; }
+
+   /// returns pointer to the data at the current offset
+   const BYTE* Current() const { return m_data + m_offset; }
+
+   /// sets a new offset
+   void Seek(size_t offset);
+
+   /// skips bytes
+   void Skip(size_t count);
+
+   /// reads an unsigned value with 1, 2, 3, 4 or 8 bytes
+   ULONGLONG ReadUnsigned(size_t size);
+
+   /// reads a single byte
+   BYTE ReadByte() { return static_cast<BYTE>(ReadUnsigned(1)); }
+
+   /// reads a 16-bit value
+   WORD ReadWord() { return static_cast<WORD>(ReadUnsigned(2)); }
+
+   /// reads a 32-bit value
+   DWORD ReadDword() { return static_cast<DWORD>(ReadUnsigned(4)); }
+
+   /// reads a 64-bit value
+   ULONGLONG ReadQword() { return ReadUnsigned(8); }
+
+   /// reads an unsigned LEB128 value
+   ULONGLONG ReadUleb128();
+
+   /// reads a signed LEB128 value
+   LONGLONG ReadSleb128();
+
+   /// reads a zero-terminated string; returns an empty string on errors
+   const char* ReadString();
+
+   /// reads the initial length of a unit and determines the 32-bit or 64-bit
+   /// DWARF format; returns the unit length
+   ULONGLONG ReadInitialLength(bool& is64BitFormat);
+
+   /// reads a section offset, with the size of the DWARF format
+   ULONGLONG ReadOffset(bool is64BitFormat) { return ReadUnsigned(is64BitFormat ? 8 : 4); }
+
+private:
+   /// marks an error and moves to the end
+   void SetError();
+
+private:
+   /// data to read
+   const BYTE* m_data;
+
+   /// size of data
+   size_t m_size;
+
+   /// indicates little-endian byte order
+   bool m_littleEndian;
+
+   /// current offset
+   size_t m_offset;
+
+   /// indicates that a read went past the end of the data
+   bool m_hasError = false;
+};
@@ -0,0 +1,285 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file DwarfDefinitions.cpp
+/// \brief DWARF debug information constants
+//
+#include "stdafx.h"
+#include "DwarfDefinitions.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapDwarfUnitTypeToDisplayText =
+{
+   { c_dwarfUnitTypeCompile, _T("DW_UT_compile") },
+   { c_dwarfUnitTypeType, _T("DW_UT_type") },
+   { c_dwarfUnitTypePartial, _T("DW_UT_partial") },
+   { c_dwarfUnitTypeSkeleton, _T("DW_UT_skeleton") },
+   { c_dwarfUnitTypeSplitCompile, _T("DW_UT_split_compile") },
+   { c_dwarfUnitTypeSplitType, _T("DW_UT_split_type") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapDwarfTagToDisplayText =
+{
+   { 0x01, _T("DW_TAG_array_type") },
+   { 0x02, _T("DW_TAG_class_type") },
+   { 0x03, _T("DW_TAG_entry_point") },
+   { 0x04, _T("DW_TAG_enumeration_type") },
+   { 0x05, _T("DW_TAG_formal_parameter") },
+   { 0x08, _T("DW_TAG_imported_declaration") },
+   { 0x0a, _T("DW_TAG_label") },
+   { 0x0b, _T("DW_TAG_lexical_block") },
+   { 0x0d, _T("DW_TAG_member") },
+   { 0x0f, _T("DW_TAG_pointer_type") },
+   { 0x10, _T("DW_TAG_reference_type") },
+   { 0x11, _T("DW_TAG_compile_unit") },
+   { 0x12, _T("DW_TAG_string_type") },
+   { 0x13, _T("DW_TAG_structure_type") },
+   { 0x15, _T("DW_TAG_subroutine_type") },
+   { 0x16, _T("DW_TAG_typedef") },
+   { 0x17, _T("DW_TAG_union_type") },
+   { 0x18, _T("DW_TAG_unspecified_parameters") },
+   { 0x19, _T("DW_TAG_variant") },
+   { 0x1a, _T("DW_TAG_common_block") },
+   { 0x1b, _T("DW_TAG_common_inclusion") },
+   { 0x1c, _T("DW_TAG_inheritance") },
+   { 0x1d, _T("DW_TAG_inlined_subroutine") },
+   { 0x1e, _T("DW_TAG_module") },
+   { 0x1f, _T("DW_TAG_ptr_to_member_type") },
+   { 0x20, _T("DW_TAG_set_type") },
+   { 0x21, _T("DW_TAG_subrange_type") },
+   { 0x22, _T("DW_TAG_with_stmt") },
+   { 0x23, _T("DW_TAG_access_declaration") },
+   { 0x24, _T("DW_TAG_base_type") },
+   { 0x25, _T("DW_TAG_catch_block") },
+   { 0x26, _T("DW_TAG_const_type") },
+   { 0x27, _T("DW_TAG_constant") },
+   { 0x28, _T("DW_TAG_enumerator") },
+   { 0x29, _T("DW_TAG_file_type") },
+   { 0x2a, _T("DW_TAG_friend") },
+   { 0x2b, _T("DW_TAG_namelist") },
+   { 0x2c, _T("DW_TAG_namelist_item") },
+   { 0x2d, _T("DW_TAG_packed_type") },
+   { 0x2e, _T("DW_TAG_subprogram") },
+   { 0x2f, _T("DW_TAG_template_type_parameter") },
+   { 0x30, _T("DW_TAG_template_value_parameter") },
+   { 0x31, _T("DW_TAG_thrown_type") },
+   { 0x32, _T("DW_TAG_try_block") },
+   { 0x33, _T("DW_TAG_variant_part") },
+   { 0x34, _T("DW_TAG_variable") },
+   { 0x35, _T("DW_TAG_volatile_type") },
+   { 0x36, _T("DW_TAG_dwarf_procedure") },
+   { 0x37, _T("DW_TAG_restrict_type") },
+   { 0x38, _T("DW_TAG_interface_type") },
+   { 0x39, _T("DW_TAG_namespace") },
+   { 0x3a, _T("DW_TAG_imported_module") },
+   { 0x3b, _T("DW_TAG_unspecified_type") },
+   { 0x3c, _T("DW_TAG_partial_unit") },
+   { 0x3d, _T("DW_TAG_imported_unit") },
+   { 0x3f, _T("DW_TAG_condition") },
+   { 0x40, _T("DW_TAG_shared_type") },
+   { 0x41, _T("DW_TAG_type_unit") },
+   { 0x42, _T("DW_TAG_rvalue_reference_type") },
+   { 0x43, _T("DW_TAG_template_alias") },
+   { 0x44, _T("DW_TAG_coarray_type") },
+   { 0x45, _T("DW_TAG_generic_subrange") },
+   { 0x46, _T("DW_TAG_dynamic_type") },
+   { 0x47, _T("DW_TAG_atomic_type") },
+   { 0x48, _T("DW_TAG_call_site") },
+   { 0x49, _T("DW_TAG_call_site_parameter") },
+   { 0x4a, _T("DW_TAG_skeleton_unit") },
+   { 0x4b, _T("DW_TAG_immutable_type") },
+   { 0x4106, _T("DW_TAG_GNU_template_template_param") },
+   { 0x4107, _T("DW_TAG_GNU_template_parameter_pack") },
+   { 0x4108, _T("DW_TAG_GNU_formal_parameter_pack") },
+   { 0x4109, _T("DW_TAG_GNU_call_site") },
+   { 0x410a, _T("DW_TAG_GNU_call_site_parameter") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapDwarfAttributeToDisplayText =
+{
+   { 0x01, _T("DW_AT_sibling") },
+   { 0x02, _T("DW_AT_location") },
+   { 0x03, _T("DW_AT_name") },
+   { 0x09, _T("DW_AT_ordering") },
+   { 0x0b, _T("DW_AT_byte_size") },
+   { 0x0c, _T("DW_AT_bit_offset") },
+   { 0x0d, _T("DW_AT_bit_size") },
+   { 0x10, _T("DW_AT_stmt_list") },
+   { 0x11, _T("DW_AT_low_pc") },
+   { 0x12, _T("DW_AT_high_pc") },
+   { 0x13, _T("DW_AT_language") },
+   { 0x15, _T("DW_AT_discr") },
+   { 0x16, _T("DW_AT_discr_value") },
+   { 0x17, _T("DW_AT_visibility") },
+   { 0x18, _T("DW_AT_import") },
+   { 0x19, _T("DW_AT_string_length") },
+   { 0x1a, _T("DW_AT_common_reference") },
+   { 0x1b, _T("DW_AT_comp_dir") },
+   { 0x1c, _T("DW_AT_const_value") },
+   { 0x1d, _T("DW_AT_containing_type") },
+   { 0x1e, _T("DW_AT_default_value") },
+   { 0x20, _T("DW_AT_inline") },
+   { 0x21, _T("DW_AT_is_optional") },
+   { 0x22, _T("DW_AT_lower_bound") },
+   { 0x25, _T("DW_AT_producer") },
+   { 0x27, _T("DW_AT_prototyped") },
+   { 0x2a, _T("DW_AT_return_addr") },
+   { 0x2c, _T("DW_AT_start_scope") },
+   { 0x2e, _T("DW_AT_bit_stride") },
+   { 0x2f, _T("DW_AT_upper_bound") },
+   { 0x31, _T("DW_AT_abstract_origin") },
+   { 0x32, _T("DW_AT_accessibility") },
+   { 0x33, _T("DW_AT_address_class") },
+   { 0x34, _T("DW_AT_artificial") },
+   { 0x35, _T("DW_AT_base_types") },
+   { 0x36, _T("DW_AT_calling_convention") },
+   { 0x37, _T("DW_AT_count") },
+   { 0x38, _T("DW_AT_data_member_location") },
+   { 0x39, _T("DW_AT_decl_column") },
+   { 0x3a, _T("DW_AT_decl_file") },
+   { 0x3b, _T("DW_AT_decl_line") },
+   { 0x3c, _T("DW_AT_declaration") },
+   { 0x3d, _T("DW_AT_discr_list") },
+   { 0x3e, _T("DW_AT_encoding") },
+   { 0x3f, _T("DW_AT_external") },
+   { 0x40, _T("DW_AT_frame_base") },
+   { 0x41, _T("DW_AT_friend") },
+   { 0x42, _T("DW_AT_identifier_case") },
+   { 0x43, _T("DW_AT_macro_info") },
+   { 0x44, _T("DW_AT_namelist_item") },
+   { 0x45, _T("DW_AT_priority") },
+   { 0x46, _T("DW_AT_segment") },
+   { 0x47, _T("DW_AT_specification") },
+   { 0x48, _T("DW_AT_static_link") },
+   { 0x49, _T("DW_AT_type") },
+   { 0x4a, _T("DW_AT_use_location") },
+   { 0x4b, _T("DW_AT_variable_parameter") },
+   { 0x4c, _T("DW_AT_virtuality") },
+   { 0x4d, _T("DW_AT_vtable_elem_location") },
+   { 0x4e, _T("DW_AT_allocated") },
+   { 0x4f, _T("DW_AT_associated") },
+   { 0x50, _T("DW_AT_data_location") },
+   { 0x51, _T("DW_AT_byte_stride") },
+   { 0x52, _T("DW_AT_entry_pc") },
+   { 0x53, _T("DW_AT_use_UTF8") },
+   { 0x54, _T("DW_AT_extension") },
+   { 0x55, _T("DW_AT_ranges") },
+   { 0x56, _T("DW_AT_trampoline") },
+   { 0x57, _T("DW_AT_call_column") },
+   { 0x58, _T("DW_AT_call_file") },
+   { 0x59, _T("DW_AT_call_line") },
+   { 0x5a, _T("DW_AT_description") },
+   { 0x5b, _T("DW_AT_binary_scale") },
+   { 0x5c, _T("DW_AT_decimal_scale") },
+   { 0x5d, _T("DW_AT_small") },
+   { 0x5e, _T("DW_AT_decimal_sign") },
+   { 0x5f, _T("DW_AT_digit_count") },
+   { 0x60, _T("DW_AT_picture_string") },
+   { 0x61, _T("DW_AT_mutable") },
+   { 0x62, _T("DW_AT_threads_scaled") },
+   { 0x63, _T("DW_AT_explicit") },
+   { 0x64, _T("DW_AT_object_pointer") },
+   { 0x65, _T("DW_AT_endianity") },
+   { 0x66, _T("DW_AT_elemental") },
+   { 0x67, _T("DW_AT_pure") },
+   { 0x68, _T("DW_AT_recursive") },
+   { 0x69, _T("DW_AT_signature") },
+   { 0x6a, _T("DW_AT_main_subprogram") },
+   { 0x6b, _T("DW_AT_data_bit_offset") },
+   { 0x6c, _T("DW_AT_const_expr") },
+   { 0x6d, _T("DW_AT_enum_class") },
+   { 0x6e, _T("DW_AT_linkage_name") },
+   { 0x6f, _T("DW_AT_string_length_bit_size") },
+   { 0x70, _T("DW_AT_string_length_byte_size") },
+   { 0x71, _T("DW_AT_rank") },
+   { 0x72, _T("DW_AT_str_offsets_base") },
+   { 0x73, _T("DW_AT_addr_base") },
+   { 0x74, _T("DW_AT_rnglists_base") },
+   { 0x76, _T("DW_AT_dwo_name") },
+   { 0x77, _T("DW_AT_reference") },
+   { 0x78, _T("DW_AT_rvalue_reference") },
+   { 0x79, _T("DW_AT_macros") },
+   { 0x7a, _T("DW_AT_call_all_calls") },
+   { 0x7b, _T("DW_AT_call_all_source_calls") },
+   { 0x7c, _T("DW_AT_call_all_tail_calls") },
+   { 0x7d, _T("DW_AT_call_return_pc") },
+   { 0x7e, _T("DW_AT_call_value") },
+   { 0x7f, _T("DW_AT_call_origin") },
+   { 0x80, _T("DW_AT_call_parameter") },
+   { 0x81, _T("DW_AT_call_pc") },
+   { 0x82, _T("DW_AT_call_tail_call") },
+   { 0x83, _T("DW_AT_call_target") },
+   { 0x84, _T("DW_AT_call_target_clobbered") },
+   { 0x85, _T("DW_AT_call_data_location") },
+   { 0x86, _T("DW_AT_call_data_value") },
+   { 0x87, _T("DW_AT_noreturn") },
+   { 0x88, _T("DW_AT_alignment") },
+   { 0x89, _T("DW_AT_export_symbols") },
+   { 0x8a, _T("DW_AT_deleted") },
+   { 0x8b, _T("DW_AT_defaulted") },
+   { 0x8c, _T("DW_AT_loclists_base") },
+   { 0x2007, _T("DW_AT_MIPS_linkage_name") },
+   { 0x2107, _T("DW_AT_GNU_template_name") },
+   { 0x2111, _T("DW_AT_GNU_call_site_value") },
+   { 0x2113, _T("DW_AT_GNU_call_site_target") },
+   { 0x2115, _T("DW_AT_GNU_tail_call") },
+   { 0x2117, _T("DW_AT_GNU_all_tail_call_sites") },
+   { 0x2119, _T("DW_AT_GNU_all_call_sites") },
+   { 0x2131, _T("DW_AT_GNU_dwo_name") },
+   { 0x2133, _T("DW_AT_GNU_addr_base") },
+   { 0x2134, _T("DW_AT_GNU_pubnames") },
+   { 0x2136, _T("DW_AT_GNU_discriminator") },
+   { 0x2137, _T("DW_AT_GNU_locviews") },
+   { 0x2138, _T("DW_AT_GNU_entry_view") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapDwarfFormToDisplayText =
+{
+   { 0x01, _T("DW_FORM_addr") },
+   { 0x03, _T("DW_FORM_block2") },
+   { 0x04, _T("DW_FORM_block4") },
+   { 0x05, _T("DW_FORM_data2") },
+   { 0x06, _T("DW_FORM_data4") },
+   { 0x07, _T("DW_FORM_data8") },
+   { 0x08, _T("DW_FORM_string") },
+   { 0x09, _T("DW_FORM_block") },
+   { 0x0a, _T("DW_FORM_block1") },
+   { 0x0b, _T("DW_FORM_data1") },
+   { 0x0c, _T("DW_FORM_flag") },
+   { 0x0d, _T("DW_FORM_sdata") },
+   { 0x0e, _T("DW_FORM_strp") },
+   { 0x0f, _T("DW_FORM_udata") },
+   { 0x10, _T("DW_FORM_ref_addr") },
+   { 0x11, _T("DW_FORM_ref1") },
+   { 0x12, _T("DW_FORM_ref2") },
+   { 0x13, _T("DW_FORM_ref4") },
+   { 0x14, _T("DW_FORM_ref8") },
+   { 0x15, _T("DW_FORM_ref_udata") },
+   { 0x16, _T("DW_FORM_indirect") },
+   { 0x17, _T("DW_FORM_sec_offset") },
+   { 0x18, _T("DW_FORM_exprloc") },
+   { 0x19, _T("DW_FORM_flag_present") },
+   { 0x1a, _T("DW_FORM_strx") },
+   { 0x1b, _T("DW_FORM_addrx") },
+   { 0x1c, _T("DW_FORM_ref_sup4") },
+   { 0x1d, _T("DW_FORM_strp_sup") },
+   { 0x1e, _T("DW_FORM_data16") },
+   { 0x1f, _T("DW_FORM_line_strp") },
+   { 0x20, _T("DW_FORM_ref_sig8") },
+   { 0x21, _T("DW_FORM_implicit_const") },
+   { 0x22, _T("DW_FORM_loclistx") },
+   { 0x23, _T("DW_FORM_rnglistx") },
+   { 0x24, _T("DW_FORM_ref_sup8") },
+   { 0x25, _T("DW_FORM_strx1") },
+   { 0x26, _T("DW_FORM_strx2") },
+   { 0x27, _T("DW_FORM_strx3") },
+   { 0x28, _T("DW_FORM_strx4") },
+   { 0x29, _T("DW_FORM_addrx1") },
+   { 0x2a, _T("DW_FORM_addrx2") },
+   { 0x2b, _T("DW_FORM_addrx3") },
+   { 0x2c, _T("DW_FORM_addrx4") },
+   { 0x1f01, _T("DW_FORM_GNU_addr_index") },
+   { 0x1f02, _T("DW_FORM_GNU_str_index") },
+   { 0x1f20, _T("DW_FORM_GNU_ref_alt") },
+   { 0x1f21, _T("DW_FORM_GNU_strp_alt") },
+};
@@ -0,0 +1,143 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file DwarfDefinitions.hpp
+/// \brief DWARF debug information constants
+/// \see https://dwarfstd.org/dwarf5std.html
+//
+#pragma once
+
+/// DW_UT_compile: full compilation unit
+constexpr BYTE c_dwarfUnitTypeCompile = 0x01;
+
+/// DW_UT_type: type unit
+constexpr BYTE c_dwarfUnitTypeType = 0x02;
+
+/// DW_UT_partial: partial unit
+constexpr BYTE c_dwarfUnitTypePartial = 0x03;
+
+/// DW_UT_skeleton: skeleton unit of a split compilation unit
+constexpr BYTE c_dwarfUnitTypeSkeleton = 0x04;
+
+/// DW_UT_split_compile: split compilation unit
+constexpr BYTE c_dwarfUnitTypeSplitCompile = 0x05;
+
+/// DW_UT_split_type: split type unit
+constexpr BYTE c_dwarfUnitTypeSplitType = 0x06;
+
+/// DW_AT_name: name attribute
+constexpr DWORD c_dwarfAttributeName = 0x03;
+
+/// DW_AT_stmt_list: offset of the line program in .debug_line
+constexpr DWORD c_dwarfAttributeStmtList = 0x10;
+
+/// DW_AT_low_pc: start address
+constexpr DWORD c_dwarfAttributeLowPc = 0x11;
+
+/// DW_AT_high_pc: end address, or size when encoded as constant
+constexpr DWORD c_dwarfAttributeHighPc = 0x12;
+
+/// DW_AT_comp_dir: compilation directory
+constexpr DWORD c_dwarfAttributeCompDir = 0x1b;
+
+/// DW_AT_producer: producer, e.g. compiler name and version
+constexpr DWORD c_dwarfAttributeProducer = 0x25;
+
+/// DW_AT_ranges: offset of the non-contiguous address ranges
+constexpr DWORD c_dwarfAttributeRanges = 0x55;
+
+/// DW_AT_str_offsets_base: base of the unit's .debug_str_offsets contribution
+constexpr DWORD c_dwarfAttributeStrOffsetsBase = 0x72;
+
+/// DW_AT_addr_base: base of the unit's .debug_addr contribution
+constexpr DWORD c_dwarfAttributeAddrBase = 0x73;
+
+/// DW_AT_rnglists_base: base of the unit's .debug_rnglists contribution
+constexpr DWORD c_dwarfAttributeRnglistsBase = 0x74;
+
+/// DW_AT_GNU_addr_base: pre-DWARF 5 extension for DW_AT_addr_base
+constexpr DWORD c_dwarfAttributeGnuAddrBase = 0x2133;
+
+/// DW_FORM_* values
+enum class DwarfForm : DWORD
+{
+   addr = 0x01,
+   block2 = 0x03,
+   block4 = 0x04,
+   data2 = 0x05,
+   data4 = 0x06,
+   data8 = 0x07,
+   string = 0x08,
+   block = 0x09,
+   block1 = 0x0a,
+   data1 = 0x0b,
+   flag = 0x0c,
+   sdata = 0x0d,
+   strp = 0x0e,
+   udata = 0x0f,
+   refAddr = 0x10,
+   ref1 = 0x11,
+   ref2 = 0x12,
+   ref4 = 0x13,
+   ref8 = 0x14,
+   refUdata = 0x15,
+   indirect = 0x16,
+   secOffset = 0x17,
+   exprloc = 0x18,
+   flagPresent = 0x19,
+   strx = 0x1a,
+   addrx = 0x1b,
+   refSup4 = 0x1c,
+   strpSup = 0x1d,
+   data16 = 0x1e,
+   lineStrp = 0x1f,
+   refSig8 = 0x20,
+   implicitConst = 0x21,
+   loclistx = 0x22,
+   rnglistx = 0x23,
+   refSup8 = 0x24,
+   strx1 = 0x25,
+   strx2 = 0x26,
+   strx3 = 0x27,
+   strx4 = 0x28,
+   addrx1 = 0x29,
+   addrx2 = 0x2a,
+   addrx3 = 0x2b,
+   addrx4 = 0x2c,
+   gnuAddrIndex = 0x1f01,
+   gnuStrIndex = 0x1f02,
+   gnuRefAlt = 0x1f20,
+   gnuStrpAlt = 0x1f21,
+};
+
+/// DW_LNCT_path: line table file entry content: path name
+constexpr ULONGLONG c_dwarfLineContentPath = 0x1;
+
+/// DW_LNCT_directory_index: line table file entry content: directory index
+constexpr ULONGLONG c_dwarfLineContentDirectoryIndex = 0x2;
+
+/// DW_RLE_* range list entry kinds, in .debug_rnglists
+enum class DwarfRangeListEntry : BYTE
+{
+   endOfList = 0x00,
+   baseAddressx = 0x01,
+   startxEndx = 0x02,
+   startxLength = 0x03,
+   offsetPair = 0x04,
+   baseAddress = 0x05,
+   startEnd = 0x06,
+   startLength = 0x07,
+};
+
+/// mapping of DWARF unit types to display text
+extern const std::map<DWORD, LPCTSTR> g_mapDwarfUnitTypeToDisplayText;
+
+/// mapping of DWARF tags to display text
+extern const std::map<DWORD, LPCTSTR> g_mapDwarfTagToDisplayText;
+
+/// mapping of DWARF attributes to display text
+extern const std::map<DWORD, LPCTSTR> g_mapDwarfAttributeToDisplayText;
+
+/// mapping of DWARF forms to display text
+extern const std::map<DWORD, LPCTSTR> g_mapDwarfFormToDisplayText;
@@ -0,0 +1,411 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file DwarfLineTable.cpp
+/// \brief DWARF line table of a single unit, from .debug_line
+//
+#include "stdafx.h"
+#include "DwarfLineTable.hpp"
+
+/// DW_LNS_* standard opcodes
+enum class DwarfLineStandardOpcode : BYTE
+{
+   copy = 1,
+   advancePc = 2,
+   advanceLine = 3,
+   setFile = 4,
+   setColumn = 5,
+   negateStatement = 6,
+   setBasicBlock = 7,
+   constAddPc = 8,
+   fixedAdvancePc = 9,
+   setPrologueEnd = 10,
+   setEpilogueBegin = 11,
+   setIsa = 12,
+};
+
+/// DW_LNE_* extended opcodes
+enum class DwarfLineExtendedOpcode : BYTE
+{
+   endSequence = 1,
+   setAddress = 2,
+   defineFile = 3,
+   setDiscriminator = 4,
+};
+
+/// \brief Joins a directory and a file name, unless the file name is absolute
+static CString JoinPath(const CString& directory, const CString& fileName)
+{
+   bool isAbsolute =
+      fileName.Find(_T('/')) == 0 ||
+      fileName.Find(_T('\\')) == 0 ||
+      fileName.Find(_T(':')) == 1;
+
+   if (isAbsolute || directory.IsEmpty())
+      return fileName;
+
+   return directory + _T("/") + fileName;
+}
+
+DwarfLineTable::DwarfLineTable(const DwarfReader& reader, const DwarfSections& sections,
+   size_t unitIndex)
+{
+   std::optional<DwarfDie> unitDie = reader.DecodeUnitDie(sections, unitIndex);
+   if (!unitDie.has_value())
+   {
+      m_errorText = _T("Unit entry couldn't be decoded");
+      return;
+   }
+
+   const DwarfAttribute* statementList = unitDie->FindAttribute(c_dwarfAttributeStmtList);
+   if (statementList == nullptr)
+   {
+      m_errorText = _T("Unit has no line table");
+      return;
+   }
+
+   const DwarfAttribute* compilationDirectory = unitDie->FindAttribute(c_dwarfAttributeCompDir);
+
+   m_isValid = Decode(reader, sections,
+      reader.Units()[unitIndex],
+      static_cast<size_t>(statementList->value),
+      compilationDirectory != nullptr && compilationDirectory->text != nullptr
+      ? CString(CA2T(compilationDirectory->text, CP_UTF8))
+      : CString());
+}
+
+CString DwarfLineTable::FileName(DWORD fileNumber) const
+{
+   if (fileNumber < m_firstFileNumber ||
+      fileNumber - m_firstFileNumber >= m_fileNames.size())
+   {
+      CString text;
+      text.Format(_T("file %u"), fileNumber);
+      return text;
+   }
+
+   return m_fileNames[fileNumber - m_firstFileNumber];
+}
+
+std::optional<DwarfLineRow> DwarfLineTable::FindRow(ULONGLONG address) const
+{
+   // each sequence has ascending addresses; the row before the first row
+   // with a larger address describes the instruction
+   for (size_t index = 0; index + 1 < m_rows.size(); index++)
+   {
+      const DwarfLineRow& row = m_rows[index];
+      const DwarfLineRow& nextRow = m_rows[index + 1];
+
+      if (!row.endSequence &&
+         row.address <= address &&
+         address < nextRow.address)
+         return row;
+   }
+
+   return std::nullopt;
+}
+
+bool DwarfLineTable::Decode(const DwarfReader& reader, const DwarfSections& sections,
+   const DwarfCompilationUnit& unit,
+   size_t programOffset, const CString& compilationDirectory)
+{
+   const DwarfSection& lineSection = sections.line;
+   if (programOffset >= lineSection.size)
+   {
+      m_errorText = _T("Line program is outside of the .debug_line section");
+      return false;
+   }
+
+   DwarfDataReader dataReader = reader.CreateReader(lineSection, programOffset);
+
+   // the line program header uses its own DWARF format, version and address
+   // size; this pseudo unit is used to read attribute forms of DWARF 5 entries
+   DwarfCompilationUnit lineUnit;
+   ULONGLONG length = dataReader.ReadInitialLength(lineUnit.is64BitFormat);
+
+   if (dataReader.HasError() ||
+      length > dataReader.Remaining())
+   {
+      m_errorText = _T("Line program exceeds the .debug_line section");
+      return false;
+   }
+
+   size_t programEndOffset = dataReader.Offset() + static_cast<size_t>(length);
+
+   m_version = dataReader.ReadWord();
+   if (m_version < 2 || m_version > 5)
+   {
+      m_errorText.Format(_T("Unsupported line table version %u"), m_version);
+      return false;
+   }
+
+   lineUnit.version = m_version;
+   lineUnit.addressSize = unit.addressSize;
+
+   if (m_version >= 5)
+   {
+      lineUnit.addressSize = dataReader.ReadByte();
+      dataReader.ReadByte(); // segment selector size
+   }
+
+   ULONGLONG headerLength = dataReader.ReadOffset(lineUnit.is64BitFormat);
+   size_t headerEndOffset = dataReader.Offset() + static_cast<size_t>(headerLength);
+
+   m_minimumInstructionLength = dataReader.ReadByte();
+
+   if (m_version >= 4)
+      dataReader.ReadByte(); // maximum operations per instruction; only used for VLIW
+
+   m_defaultIsStatement = dataReader.ReadByte() != 0;
+   m_lineBase = static_cast<signed char>(dataReader.ReadByte());
+   m_lineRange = dataReader.ReadByte();
+   m_opcodeBase = dataReader.ReadByte();
+
+   if (dataReader.HasError() ||
+      headerLength > programEndOffset ||
+      headerEndOffset > programEndOffset ||
+      m_lineRange == 0 ||
+      m_opcodeBase == 0 ||
+      (lineUnit.addressSize != 4 && lineUnit.addressSize != 8 && lineUnit.addressSize != 2))
+   {
+      m_errorText = _T("Line program header is invalid");
+      return false;
+   }
+
+   for (BYTE opcode = 1; opcode < m_opcodeBase; opcode++)
+      m_standardOpcodeLengths.push_back(dataReader.ReadByte());
+
+   if (m_version >= 5)
+   {
+      m_firstFileNumber = 0;
+
+      if (!ReadEntryList(reader, sections, dataReader, lineUnit, false) ||
+         !ReadEntryList(reader, sections, dataReader, lineUnit, true))
+      {
+         m_errorText = _T("Line program directory or file entries are invalid");
+         return false;
+      }
+   }
+   else
+   {
+      // directory 0 is the compilation directory
+      m_directoryNames.push_back(compilationDirectory);
+
+      for (;;)
+      {
+         const char* directory = dataReader.ReadString();
+         if (dataReader.HasError() || *directory == 0)
+            break;
+
+         m_directoryNames.push_back(CString(CA2T(directory, CP_UTF8)));
+      }
+
+      for (;;)
+      {
+         const char* fileName = dataReader.ReadString();
+         if (dataReader.HasError() || *fileName == 0)
+            break;
+
+         ULONGLONG directoryIndex = dataReader.ReadUleb128();
+         dataReader.ReadUleb128(); // modification time
+         dataReader.ReadUleb128(); // file length
+
+         m_fileNames.push_back(JoinPath(
+            directoryIndex < m_directoryNames.size() ? m_directoryNames[static_cast<size_t>(directoryIndex)] : CString(),
+            CString(CA2T(fileName, CP_UTF8))));
+      }
+
+      if (dataReader.HasError())
+      {
+         m_errorText = _T("Line program directory or file entries are invalid");
+         return false;
+      }
+   }
+
+   // the program starts after the header, even if it contains unknown fields
+   dataReader.Seek(headerEndOffset);
+
+   RunLineProgram(dataReader, programEndOffset, lineUnit.addressSize);
+
+   if (dataReader.HasError())
+      m_errorText = _T("Line program ended unexpectedly");
+
+   return true;
+}
+
+bool DwarfLineTable::ReadEntryList(const DwarfReader& reader, const DwarfSections& sections,
+   DwarfDataReader& dataReader,
+   const DwarfCompilationUnit& lineUnit, bool isFileList)
+{
+   std::vector<std::pair<ULONGLONG, DwarfForm>> entryFormats;
+
+   BYTE formatCount = dataReader.ReadByte();
+   for (BYTE formatIndex = 0; formatIndex < formatCount; formatIndex++)
+   {
+      ULONGLONG contentType = dataReader.ReadUleb128();
+      DwarfForm form = static_cast<DwarfForm>(dataReader.ReadUleb128());
+      entryFormats.emplace_back(contentType, form);
+   }
+
+   ULONGLONG entryCount = dataReader.ReadUleb128();
+
+   for (ULONGLONG entryIndex = 0; entryIndex < entryCount && !dataReader.HasError(); entryIndex++)
+   {
+      CString path;
+      ULONGLONG directoryIndex = 0;
+
+      for (const auto& [contentType, form] : entryFormats)
+      {
+         DwarfAttribute attribute;
+         if (!reader.ReadFormValue(sections, dataReader, form, lineUnit, attribute))
+            return false;
+
+         if (contentType == c_dwarfLineContentPath &&
+            attribute.text != nullptr)
+            path = CString(CA2T(attribute.text, CP_UTF8));
+         else if (contentType == c_dwarfLineContentDirectoryIndex)
+            directoryIndex = attribute.value;
+      }
+
+      if (!isFileList)
+         m_directoryNames.push_back(path);
+      else
+      {
+         m_fileNames.push_back(JoinPath(
+            directoryIndex < m_directoryNames.size() ? m_directoryNames[static_cast<size_t>(directoryIndex)] : CString(),
+            path));
+      }
+   }
+
+   return !dataReader.HasError();
+}
+
+void DwarfLineTable::RunLineProgram(DwarfDataReader& dataReader, size_t programEndOffset,
+   BYTE addressSize)
+{
+   DwarfLineRow state;
+   state.file = 1;
+   state.line = 1;
+   state.isStatement = m_defaultIsStatement;
+
+   auto resetState = [&]()
+   {
+      state = DwarfLineRow{};
+      state.file = 1;
+      state.line = 1;
+      state.isStatement = m_defaultIsStatement;
+   };
+
+   auto advanceAddress = [&](ULONGLONG operationAdvance)
+   {
+      state.address += operationAdvance * m_minimumInstructionLength;
+   };
+
+   while (!dataReader.HasError() &&
+      dataReader.Offset() < programEndOffset)
+   {
+      BYTE opcode = dataReader.ReadByte();
+
+      if (opcode >= m_opcodeBase)
+      {
+         // special opcode: advances address and line and appends a row
+         BYTE adjustedOpcode = opcode - m_opcodeBase;
+         advanceAddress(adjustedOpcode / m_lineRange);
+         state.line += m_lineBase + adjustedOpcode % m_lineRange;
+
+         m_rows.push_back(state);
+         continue;
+      }
+
+      if (opcode == 0)
+      {
+         ULONGLONG length = dataReader.ReadUleb128();
+         size_t instructionEndOffset = dataReader.Offset() + static_cast<size_t>(length);
+
+         if (length == 0 ||
+            length > programEndOffset - dataReader.Offset())
+            break;
+
+         switch (static_cast<DwarfLineExtendedOpcode>(dataReader.ReadByte()))
+         {
+         case DwarfLineExtendedOpcode::endSequence:
+            state.endSequence = true;
+            m_rows.push_back(state);
+            resetState();
+            break;
+
+         case DwarfLineExtendedOpcode::setAddress:
+         {
+            size_t operandSize = static_cast<size_t>(length - 1);
+            state.address = dataReader.ReadUnsigned(
+               operandSize >= 1 && operandSize <= 8 ? operandSize : addressSize);
+            break;
+         }
+
+         case DwarfLineExtendedOpcode::defineFile:
+         {
+            const char* fileName = dataReader.ReadString();
+            ULONGLONG directoryIndex = dataReader.ReadUleb128();
+
+            m_fileNames.push_back(JoinPath(
+               directoryIndex < m_directoryNames.size() ? m_directoryNames[static_cast<size_t>(directoryIndex)] : CString(),
+               CString(CA2T(fileName, CP_UTF8))));
+            break;
+         }
+
+         default:
+            break; // includes DW_LNE_set_discriminator, which isn't stored
+         }
+
+         dataReader.Seek(instructionEndOffset);
+         continue;
+      }
+
+      switch (static_cast<DwarfLineStandardOpcode>(opcode))
+      {
+      case DwarfLineStandardOpcode::copy:
+         m_rows.push_back(state);
+         break;
+
+      case DwarfLineStandardOpcode::advancePc:
+         advanceAddress(dataReader.ReadUleb128());
+         break;
+
+      case DwarfLineStandardOpcode::advanceLine:
+         state.line += static_cast<DWORD>(dataReader.ReadSleb128());
+         break;
+
+      case DwarfLineStandardOpcode::setFile:
+         state.file = static_cast<DWORD>(dataReader.ReadUleb128());
+         break;
+
+      case DwarfLineStandardOpcode::setColumn:
+         state.column = static_cast<DWORD>(dataReader.ReadUleb128());
+         break;
+
+      case DwarfLineStandardOpcode::negateStatement:
+         state.isStatement = !state.isStatement;
+         break;
+
+      case DwarfLineStandardOpcode::constAddPc:
+         advanceAddress((255 - m_opcodeBase) / m_lineRange);
+         break;
+
+      case DwarfLineStandardOpcode::fixedAdvancePc:
+         state.address += dataReader.ReadWord();
+         break;
+
+      case DwarfLineStandardOpcode::setBasicBlock:
+      case DwarfLineStandardOpcode::setPrologueEnd:
+      case DwarfLineStandardOpcode::setEpilogueBegin:
+         break;
+
+      default:
+         // unknown standard opcodes and DW_LNS_set_isa: skip the operands
+         for (BYTE operand = 0; operand < m_standardOpcodeLengths[opcode - 1]; operand++)
+            dataReader.ReadUleb128();
+         break;
+      }
+   }
+}
@@ -0,0 +1,120 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file DwarfLineTable.hpp
+/// \brief DWARF line table of a single unit, from .debug_line
+//
+#pragma once
+
+#include "DwarfReader.hpp"
+
+/// \brief Row of the line table
+struct DwarfLineRow
+{
+   /// address of the instruction
+   ULONGLONG address = 0;
+
+   /// file number; see DwarfLineTable::FileName()
+   DWORD file = 0;
+
+   /// source line number, 1-based; 0 when not attributable to a line
+   DWORD line = 0;
+
+   /// source column, 1-based; 0 for the whole line
+   DWORD column = 0;
+
+   /// indicates a recommended breakpoint location
+   bool isStatement = false;
+
+   /// indicates the first address after a sequence of instructions
+   bool endSequence = false;
+};
+
+/// \brief DWARF line table
+/// \details Decodes the line program header and runs the line program of a
+/// single unit, for DWARF versions 2 to 5.
+class DwarfLineTable
+{
+public:
+   /// ctor; decodes the line program of given unit, using the sections
+   /// loaded by the reader
+   DwarfLineTable(const DwarfReader& reader, const DwarfSections& sections,
+      size_t unitIndex);
+
+   /// returns if the line table could be decoded
+   bool IsValid() const { return m_isValid; }
+
+   /// returns an error text, when the line table couldn't be decoded
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the line table version
+   WORD Version() const { return m_version; }
+
+   /// returns all rows, in the order of the line program
+   const std::vector<DwarfLineRow>& Rows() const { return m_rows; }
+
+   /// returns the file name of a file number, including the directory
+   CString FileName(DWORD fileNumber) const;
+
+   /// returns the number of file entries
+   size_t FileCount() const { return m_fileNames.size(); }
+
+   /// finds the row describing the instruction at given address
+   std::optional<DwarfLineRow> FindRow(ULONGLONG address) const;
+
+private:
+   /// decodes the line program header and the line program
+   bool Decode(const DwarfReader& reader, const DwarfSections& sections,
+      const DwarfCompilationUnit& unit,
+      size_t programOffset, const CString& compilationDirectory);
+
+   /// reads directory and file name entries in DWARF 5 format
+   bool ReadEntryList(const DwarfReader& reader, const DwarfSections& sections,
+      DwarfDataReader& dataReader,
+      const DwarfCompilationUnit& lineUnit, bool isFileList);
+
+   /// runs the line program
+   void RunLineProgram(DwarfDataReader& dataReader, size_t programEndOffset,
+      BYTE addressSize);
+
+private:
+   /// indicates if the line table could be decoded
+   bool m_isValid = false;
+
+   /// error text
+   CString m_errorText;
+
+   /// line table version
+   WORD m_version = 0;
+
+   /// minimum instruction length
+   BYTE m_minimumInstructionLength = 1;
+
+   /// initial value of the statement flag
+   bool m_defaultIsStatement = false;
+
+   /// base of the line number advance of special opcodes
+   signed char m_lineBase = 0;
+
+   /// range of the line number advance of special opcodes
+   BYTE m_lineRange = 0;
+
+   /// number of the first special opcode
+   BYTE m_opcodeBase = 0;
+
+   /// number of operands of the standard opcodes
+   std::vector<BYTE> m_standardOpcodeLengths;
+
+   /// directory names
+   std::vector<CString> m_directoryNames;
+
+   /// file names, including their directory
+   std::vector<CString> m_fileNames;
+
+   /// file number of the first file entry; 1 before DWARF 5, 0 since
+   DWORD m_firstFileNumber = 1;
+
+   /// all rows
+   std::vector<DwarfLineRow> m_rows;
+};
@@ -0,0 +1,293 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file DwarfNodeTreeBuilder.cpp
+/// \brief Node tree builder for DWARF debug information
+//
+#include "stdafx.h"
+#include "DwarfNodeTreeBuilder.hpp"
+#include "DwarfReader.hpp"
+#include "DwarfLineTable.hpp"
+#include "modules/CodeTextViewNode.hpp"
+#include "modules/FilterSortListViewNode.hpp"
+
+/// maximum number of debug information entries shown for a single unit
+constexpr size_t c_maxDisplayedDieCount = 20000;
+
+DwarfNodeTreeBuilder::DwarfNodeTreeBuilder(std::shared_ptr<DwarfReader> reader)
+   :m_reader(reader)
+{
+}
+
+void DwarfNodeTreeBuilder::AddNodes(StaticNode& parentNode, CString& summaryText) const
+{
+   std::shared_ptr<DwarfReader> reader = m_reader;
+
+   if (!reader->GetErrorText().IsEmpty())
+      summaryText.AppendFormat(_T("Error: DWARF: %s\n"), reader->GetErrorText().GetString());
+
+   if (!reader->IsAvailable())
+      return;
+
+   const std::vector<DwarfCompilationUnit>& units = reader->Units();
+
+   summaryText.AppendFormat(_T("DWARF debug information with %zu units.\n"),
+      units.size());
+
+   static std::vector<CString> unitColumnNames
+   {
+      _T("Index"),
+      _T("Offset"),
+      _T("Version"),
+      _T("Unit type"),
+      _T("Address size"),
+      _T("Name"),
+   };
+
+   // the unit names are read from the unit DIEs, so the sections are loaded
+   // once for all rows
+   auto unitTableNode = std::make_shared<FilterSortListViewNode>(
+      _T("DWARF Units"),
+      NodeTreeIconID::nodeTreeIconTable,
+      unitColumnNames,
+      [reader]()
+      {
+         CString errorText;
+         DwarfSections sections = reader->LoadSections(errorText);
+
+         std::vector<std::vector<CString>> listData;
+         listData.reserve(reader->Units().size());
+
+         for (size_t index = 0; index < reader->Units().size(); index++)
+         {
+            const DwarfCompilationUnit& unit = reader->Units()[index];
+
+            CString indexText;
+            indexText.Format(_T("%zu"), index);
+
+            CString offsetText;
+            offsetText.Format(_T("0x%08zx"), unit.offset);
+
+            CString versionText;
+            versionText.Format(_T("%u"), unit.version);
+
+            CString addressSizeText;
+            addressSizeText.Format(_T("%u"), unit.addressSize);
+
+            listData.push_back(
+               std::vector<CString> {
+               indexText,
+                  offsetText,
+                  versionText,
+                  GetValueFromMapOrDefault<DWORD>(
+                     g_mapDwarfUnitTypeToDisplayText, unit.unitType, _T("unknown")),
+                  addressSizeText,
+                  reader->UnitName(sections, index),
+            });
+         }
+
+         return listData;
+      },
+      true);
+
+   for (size_t unitIndex = 0; unitIndex < units.size(); unitIndex++)
+   {
+      CString name;
+      name.Format(_T("Unit [%zu] at offset 0x%08zx"), unitIndex, units[unitIndex].offset);
+
+      auto unitNode = std::make_shared<CodeTextViewNode>(
+         name,
+         NodeTreeIconID::nodeTreeIconDocument,
+         [reader, unitIndex]()
+         {
+            return FormatUnitText(*reader, unitIndex);
+         });
+
+      unitNode->ChildNodes().push_back(
+         std::make_shared<CodeTextViewNode>(
+            _T("Line table"),
+            NodeTreeIconID::nodeTreeIconDocument,
+            [reader, unitIndex]()
+            {
+               return FormatLineTableText(*reader, unitIndex);
+            }));
+
+      unitTableNode->ChildNodes().push_back(unitNode);
+   }
+
+   parentNode.ChildNodes().push_back(unitTableNode);
+
+   AddAddressRanges(parentNode);
+}
+
+void DwarfNodeTreeBuilder::AddAddressRanges(StaticNode& debugInfoNode) const
+{
+   std::shared_ptr<DwarfReader> reader = m_reader;
+
+   // the address ranges are indexed when one of the nodes is shown
+   auto addressRangesNode = std::make_shared<CodeTextViewNode>(
+      _T("DWARF Address Ranges"),
+      NodeTreeIconID::nodeTreeIconDocument,
+      [reader]()
+      {
+         CString text;
+         text.Format(_T("Address ranges: %zu\n"), reader->AddressRanges().size());
+
+         text += reader->GetAddressRangesErrorText();
+
+         return text;
+      });
+
+   static std::vector<CString> addressRangeColumnNames
+   {
+      _T("Start"),
+      _T("End"),
+      _T("Unit index"),
+      _T("Source"),
+   };
+
+   addressRangesNode->ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("DWARF Address Range List"),
+         NodeTreeIconID::nodeTreeIconTable,
+         addressRangeColumnNames,
+         [reader]()
+         {
+            const std::vector<DwarfAddressRange>& addressRanges = reader->AddressRanges();
+
+            std::vector<std::vector<CString>> listData;
+            listData.reserve(addressRanges.size());
+
+            for (const DwarfAddressRange& range : addressRanges)
+            {
+               CString startText;
+               startText.Format(_T("0x%08llx"), range.start);
+
+               CString endText;
+               endText.Format(_T("0x%08llx"), range.end);
+
+               CString unitIndexText;
+               unitIndexText.Format(_T("%zu"), range.unitIndex);
+
+               listData.push_back(
+                  std::vector<CString> {
+                  startText,
+                     endText,
+                     unitIndexText,
+                     range.fromAranges ? _T(".debug_aranges") : _T("Unit entry"),
+               });
+            }
+
+            return listData;
+         },
+         true));
+
+   debugInfoNode.ChildNodes().push_back(addressRangesNode);
+}
+
+CString DwarfNodeTreeBuilder::FormatUnitText(const DwarfReader& reader, size_t unitIndex)
+{
+   const DwarfCompilationUnit& unit = reader.Units()[unitIndex];
+
+   CString text;
+   text.AppendFormat(_T("Unit at offset 0x%08zx, length 0x%08zx\n"),
+      unit.offset, unit.endOffset - unit.offset);
+   text.AppendFormat(_T("Version: %u, %s DWARF format\n"),
+      unit.version, unit.is64BitFormat ? _T("64-bit") : _T("32-bit"));
+   text.AppendFormat(_T("Unit type: %s\n"),
+      GetValueFromMapOrDefault<DWORD>(g_mapDwarfUnitTypeToDisplayText, unit.unitType, _T("unknown")));
+   text.AppendFormat(_T("Address size: %u\n"), unit.addressSize);
+   text.AppendFormat(_T("Abbreviation offset: 0x%08llx\n\n"), unit.abbrevOffset);
+
+   // the loaded sections are kept until the text is formatted, since the
+   // entries reference the section data
+   CString loadErrorText;
+   DwarfSections sections = reader.LoadSections(loadErrorText);
+
+   CString errorText;
+   std::vector<DwarfDie> dies = reader.DecodeDies(sections, unitIndex, errorText, c_maxDisplayedDieCount);
+
+   for (const DwarfDie& die : dies)
+   {
+      CString indent(_T(' '), static_cast<int>(die.depth * 3));
+
+      CString tagText;
+      tagText.Format(_T("DW_TAG_0x%04x"), die.tag);
+
+      text.AppendFormat(_T("<%zu><0x%08zx> %s%s\n"),
+         die.depth,
+         die.offset,
+         indent.GetString(),
+         GetValueFromMapOrDefault<DWORD>(g_mapDwarfTagToDisplayText, die.tag, tagText));
+
+      for (const DwarfAttribute& attribute : die.attributes)
+      {
+         CString attributeText;
+         attributeText.Format(_T("DW_AT_0x%04x"), attribute.name);
+
+         CString formText;
+         formText.Format(_T("DW_FORM_0x%02x"), static_cast<DWORD>(attribute.form));
+
+         text.AppendFormat(_T("                %s   %-24s %-20s %s\n"),
+            indent.GetString(),
+            GetValueFromMapOrDefault<DWORD>(g_mapDwarfAttributeToDisplayText, attribute.name, attributeText),
+            GetValueFromMapOrDefault<DWORD>(g_mapDwarfFormToDisplayText,
+               static_cast<DWORD>(attribute.form), formText),
+            DwarfReader::FormatAttributeValue(attribute).GetString());
+      }
+   }
+
+   if (dies.size() >= c_maxDisplayedDieCount)
+      text.AppendFormat(_T("\nOnly the first %zu entries are shown.\n"), c_maxDisplayedDieCount);
+
+   if (!errorText.IsEmpty())
+      text.AppendFormat(_T("\nError: %s\n"), errorText.GetString());
+
+   if (!loadErrorText.IsEmpty())
+      text += _T("\n") + loadErrorText;
+
+   return text;
+}
+
+CString DwarfNodeTreeBuilder::FormatLineTableText(const DwarfReader& reader, size_t unitIndex)
+{
+   CString loadErrorText;
+   DwarfSections sections = reader.LoadSections(loadErrorText);
+
+   DwarfLineTable lineTable{ reader, sections, unitIndex };
+   if (!lineTable.IsValid())
+      return _T("Error: ") + lineTable.GetErrorText() + _T("\n") + loadErrorText;
+
+   CString text;
+   text.AppendFormat(_T("Line table version %u with %zu files and %zu rows\n\n"),
+      lineTable.Version(),
+      lineTable.FileCount(),
+      lineTable.Rows().size());
+
+   text += _T("Address              Line   Column Stmt File\n");
+
+   for (const DwarfLineRow& row : lineTable.Rows())
+   {
+      if (row.endSequence)
+      {
+         text.AppendFormat(_T("0x%016llx end of sequence\n"), row.address);
+         continue;
+      }
+
+      text.AppendFormat(_T("0x%016llx %6u %6u %-4s %s\n"),
+         row.address,
+         row.line,
+         row.column,
+         row.isStatement ? _T("x") : _T(""),
+         lineTable.FileName(row.file).GetString());
+   }
+
+   if (!lineTable.GetErrorText().IsEmpty())
+      text.AppendFormat(_T("\nError: %s\n"), lineTable.GetErrorText().GetString());
+
+   if (!loadErrorText.IsEmpty())
+      text += _T("\n") + loadErrorText;
+
+   return text;
+}
@@ -0,0 +1,42 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file DwarfNodeTreeBuilder.hpp
+/// \brief Node tree builder for DWARF debug information
+//
+#pragma once
+
+#include <memory>
+
+class StaticNode;
+class DwarfReader;
+
+/// \brief Node tree builder for DWARF debug information
+/// \details Adds the unit and address range tables. The debug information
+/// entries and the line table of a unit are only decoded when the unit's
+/// node is shown; the address ranges are only indexed when their node is
+/// shown.
+class DwarfNodeTreeBuilder
+{
+public:
+   /// ctor
+   explicit DwarfNodeTreeBuilder(std::shared_ptr<DwarfReader> reader);
+
+   /// adds DWARF nodes to the parent node, and summary text
+   void AddNodes(StaticNode& parentNode, CString& summaryText) const;
+
+private:
+   /// adds the address ranges node, with the address ranges table
+   void AddAddressRanges(StaticNode& debugInfoNode) const;
+
+   /// formats the debug information entries of a unit
+   static CString FormatUnitText(const DwarfReader& reader, size_t unitIndex);
+
+   /// formats the line table of a unit
+   static CString FormatLineTableText(const DwarfReader& reader, size_t unitIndex);
+
+private:
+   /// DWARF reader; shared with nodes that decode units lazily
+   std::shared_ptr<DwarfReader> m_reader;
+};
@@ -0,0 +1,942 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file DwarfReader.cpp
+/// \brief reader for DWARF debug information
+//
+#include "stdafx.h"
+#include "DwarfReader.hpp"
+#include <algorithm>
+
+/// maximum number of block bytes shown when formatting attribute values
+constexpr size_t c_maxFormattedBlockBytes = 16;
+
+/// returns if an address size can be read
+static bool IsValidAddressSize(size_t addressSize)
+{
+   return addressSize == 2 || addressSize == 4 || addressSize == 8;
+}
+
+/// returns if the form encodes an address, or an index into the address table
+static bool IsAddressForm(DwarfForm form)
+{
+   switch (form)
+   {
+   case DwarfForm::addr:
+   case DwarfForm::addrx:
+   case DwarfForm::addrx1:
+   case DwarfForm::addrx2:
+   case DwarfForm::addrx3:
+   case DwarfForm::addrx4:
+   case DwarfForm::gnuAddrIndex:
+      return true;
+   default:
+      return false;
+   }
+}
+
+const DwarfAttribute* DwarfDie::FindAttribute(DWORD name) const
+{
+   auto iter = std::find_if(attributes.begin(), attributes.end(),
+      [name](const DwarfAttribute& attribute) { return attribute.name == name; });
+
+   return iter != attributes.end() ? &*iter : nullptr;
+}
+
+DwarfReader::DwarfReader(const DwarfSections& sections)
+   :m_sections(sections)
+{
+   if (!m_sections.info.IsAvailable() ||
+      !m_sections.abbrev.IsAvailable())
+      return;
+
+   IndexUnits();
+}
+
+const std::vector<DwarfAddressRange>& DwarfReader::AddressRanges() const
+{
+   std::call_once(m_addressRangesOnceFlag, [this]() { IndexAddressRanges(); });
+
+   return m_addressRanges;
+}
+
+const CString& DwarfReader::GetAddressRangesErrorText() const
+{
+   std::call_once(m_addressRangesOnceFlag, [this]() { IndexAddressRanges(); });
+
+   return m_addressRangesErrorText;
+}
+
+void DwarfReader::IndexAddressRanges() const
+{
+   // the loaded sections are only kept while indexing
+   DwarfSections sections = LoadSections(m_addressRangesErrorText);
+
+   std::vector<bool> unitsWithRanges(m_units.size(), false);
+   IndexArangesRanges(sections, unitsWithRanges);
+
+   // only units not covered by .debug_aranges need their unit DIE decoded
+   for (size_t unitIndex = 0; unitIndex < m_units.size(); unitIndex++)
+   {
+      if (!unitsWithRanges[unitIndex])
+         IndexUnitDieRanges(sections, unitIndex);
+   }
+
+   std::sort(m_addressRanges.begin(), m_addressRanges.end(),
+      [](const DwarfAddressRange& lhs, const DwarfAddressRange& rhs)
+      {
+         return lhs.start < rhs.start;
+      });
+}
+
+void DwarfReader::IndexUnits()
+{
+   DwarfDataReader reader = CreateReader(m_sections.info);
+
+   while (!reader.IsAtEnd())
+   {
+      DwarfCompilationUnit unit;
+      unit.offset = reader.Offset();
+
+      ULONGLONG length = reader.ReadInitialLength(unit.is64BitFormat);
+
+      // zero padding at the end, e.g. in sections of PE images
+      if (length == 0 && !reader.HasError())
+         break;
+
+      if (reader.HasError() ||
+         length > reader.Remaining())
+      {
+         m_errorText.Format(_T("Unit at offset 0x%zx exceeds the .debug_info section"), unit.offset);
+         break;
+      }
+
+      unit.endOffset = reader.Offset() + static_cast<size_t>(length);
+      unit.version = reader.ReadWord();
+
+      if (unit.version >= 5)
+      {
+         unit.unitType = reader.ReadByte();
+         unit.addressSize = reader.ReadByte();
+         unit.abbrevOffset = reader.ReadOffset(unit.is64BitFormat);
+
+         switch (unit.unitType)
+         {
+         case c_dwarfUnitTypeSkeleton:
+         case c_dwarfUnitTypeSplitCompile:
+            reader.Skip(8); // unit ID
+            break;
+
+         case c_dwarfUnitTypeType:
+         case c_dwarfUnitTypeSplitType:
+            reader.Skip(8); // type signature
+            reader.ReadOffset(unit.is64BitFormat); // type offset
+            break;
+
+         default:
+            break;
+         }
+      }
+      else
+      {
+         unit.unitType = c_dwarfUnitTypeCompile;
+         unit.abbrevOffset = reader.ReadOffset(unit.is64BitFormat);
+         unit.addressSize = reader.ReadByte();
+      }
+
+      unit.dieOffset = reader.Offset();
+
+      if (reader.HasError() ||
+         unit.dieOffset > unit.endOffset)
+      {
+         m_errorText.Format(_T("Unit header at offset 0x%zx is invalid"), unit.offset);
+         break;
+      }
+
+      if (unit.version < 2 || unit.version > 5 ||
+         !IsValidAddressSize(unit.addressSize))
+      {
+         m_errorText.Format(_T("Unit at offset 0x%zx has unsupported DWARF version %u or address size %u"),
+            unit.offset, unit.version, unit.addressSize);
+      }
+      else
+         m_units.push_back(unit);
+
+      reader.Seek(unit.endOffset);
+   }
+}
+
+void DwarfReader::IndexArangesRanges(const DwarfSections& sections,
+   std::vector<bool>& unitsWithRanges) const
+{
+   DwarfDataReader reader = CreateReader(sections.aranges);
+
+   while (!reader.IsAtEnd())
+   {
+      size_t setOffset = reader.Offset();
+
+      bool is64BitFormat = false;
+      ULONGLONG length = reader.ReadInitialLength(is64BitFormat);
+
+      if (reader.HasError() ||
+         length > reader.Remaining())
+      {
+         m_addressRangesErrorText.AppendFormat(
+            _T("Error: Address range set at offset 0x%zx exceeds the .debug_aranges section\n"), setOffset);
+         break;
+      }
+
+      size_t setEndOffset = reader.Offset() + static_cast<size_t>(length);
+
+      WORD version = reader.ReadWord();
+      ULONGLONG infoOffset = reader.ReadOffset(is64BitFormat);
+      BYTE addressSize = reader.ReadByte();
+      BYTE segmentSelectorSize = reader.ReadByte();
+
+      std::optional<size_t> unitIndex = FindUnitByOffset(static_cast<size_t>(infoOffset));
+
+      if (reader.HasError() ||
+         version != 2 ||
+         !IsValidAddressSize(addressSize) ||
+         !unitIndex.has_value() ||
+         m_units[unitIndex.value()].offset != infoOffset)
+      {
+         reader.Seek(setEndOffset);
+         continue;
+      }
+
+      // the tuples are aligned to twice the address size, from the set start
+      size_t tupleAlign = 2 * addressSize;
+      size_t headerSize = reader.Offset() - setOffset;
+      reader.Skip((tupleAlign - headerSize % tupleAlign) % tupleAlign);
+
+      size_t tupleSize = segmentSelectorSize + 2 * addressSize;
+      while (!reader.HasError() &&
+         reader.Offset() + tupleSize <= setEndOffset)
+      {
+         reader.Skip(segmentSelectorSize);
+         ULONGLONG start = reader.ReadUnsigned(addressSize);
+         ULONGLONG rangeLength = reader.ReadUnsigned(addressSize);
+
+         if (start == 0 && rangeLength == 0)
+            break;
+
+         if (rangeLength == 0)
+            continue;
+
+         m_addressRanges.push_back(
+            DwarfAddressRange{ start, start + rangeLength, unitIndex.value(), true });
+
+         unitsWithRanges[unitIndex.value()] = true;
+      }
+
+      reader.Seek(setEndOffset);
+   }
+}
+
+void DwarfReader::IndexUnitDieRanges(const DwarfSections& sections, size_t unitIndex) const
+{
+   std::optional<DwarfDie> unitDie = DecodeUnitDie(sections, unitIndex);
+   if (!unitDie.has_value())
+      return;
+
+   const DwarfCompilationUnit& unit = m_units[unitIndex];
+
+   const DwarfAttribute* lowPc = unitDie->FindAttribute(c_dwarfAttributeLowPc);
+   const DwarfAttribute* highPc = unitDie->FindAttribute(c_dwarfAttributeHighPc);
+   const DwarfAttribute* ranges = unitDie->FindAttribute(c_dwarfAttributeRanges);
+
+   std::vector<std::pair<ULONGLONG, ULONGLONG>> unitRanges;
+
+   if (ranges != nullptr)
+   {
+      // the unit's low PC is the base address of the range list entries
+      ReadRangeList(sections, unit, GetUnitBases(unitDie.value()), *ranges,
+         lowPc != nullptr ? lowPc->value : 0,
+         unitRanges);
+   }
+   else if (lowPc != nullptr && highPc != nullptr)
+   {
+      // a high PC encoded as constant is the size of the range
+      ULONGLONG end = IsAddressForm(highPc->form)
+         ? highPc->value
+         : lowPc->value + highPc->value;
+
+      unitRanges.emplace_back(lowPc->value, end);
+   }
+
+   for (const auto& [start, end] : unitRanges)
+   {
+      if (start < end)
+         m_addressRanges.push_back(DwarfAddressRange{ start, end, unitIndex, false });
+   }
+}
+
+std::optional<size_t> DwarfReader::FindUnitByAddress(ULONGLONG address) const
+{
+   const std::vector<DwarfAddressRange>& addressRanges = AddressRanges();
+
+   // find the last range starting at or before the address
+   auto iter = std::upper_bound(addressRanges.begin(), addressRanges.end(), address,
+      [](ULONGLONG value, const DwarfAddressRange& range) { return value < range.start; });
+
+   if (iter == addressRanges.begin())
+      return std::nullopt;
+
+   --iter;
+   if (address >= iter->end)
+      return std::nullopt;
+
+   return iter->unitIndex;
+}
+
+std::optional<size_t> DwarfReader::FindUnitByOffset(size_t infoOffset) const
+{
+   auto iter = std::upper_bound(m_units.begin(), m_units.end(), infoOffset,
+      [](size_t value, const DwarfCompilationUnit& unit) { return value < unit.offset; });
+
+   if (iter == m_units.begin())
+      return std::nullopt;
+
+   --iter;
+   if (infoOffset >= iter->endOffset)
+      return std::nullopt;
+
+   return static_cast<size_t>(iter - m_units.begin());
+}
+
+std::shared_ptr<const DwarfReader::AbbreviationTable> DwarfReader::GetAbbreviationTable(ULONGLONG offset) const
+{
+   std::scoped_lock lock{ m_abbreviationLock };
+
+   auto iter = m_abbreviationTables.find(offset);
+   if (iter != m_abbreviationTables.end())
+      return iter->second;
+
+   auto table = std::make_shared<AbbreviationTable>();
+
+   if (offset < m_sections.abbrev.size)
+   {
+      DwarfDataReader reader = CreateReader(m_sections.abbrev, static_cast<size_t>(offset));
+      while (!reader.IsAtEnd())
+      {
+         ULONGLONG code = reader.ReadUleb128();
+         if (code == 0)
+            break;
+
+         Abbreviation abbreviation;
+         abbreviation.tag = static_cast<DWORD>(reader.ReadUleb128());
+         abbreviation.hasChildren = reader.ReadByte() != 0;
+
+         while (!reader.HasError())
+         {
+            AbbreviationAttribute attribute;
+            attribute.name = static_cast<DWORD>(reader.ReadUleb128());
+            attribute.form = static_cast<DwarfForm>(reader.ReadUleb128());
+
+            if (attribute.name == 0 && attribute.form == DwarfForm{})
+               break;
+
+            if (attribute.form == DwarfForm::implicitConst)
+               attribute.implicitConst = reader.ReadSleb128();
+
+            abbreviation.attributes.push_back(attribute);
+         }
+
+         if (reader.HasError())
+            break;
+
+         table->emplace(code, std::move(abbreviation));
+      }
+   }
+
+   m_abbreviationTables[offset] = table;
+
+   return table;
+}
+
+std::vector<DwarfDie> DwarfReader::DecodeDies(const DwarfSections& sections,
+   size_t unitIndex, CString& errorText,
+   size_t maxDieCount) const
+{
+   if (unitIndex >= m_units.size())
+      return std::vector<DwarfDie>();
+
+   const DwarfCompilationUnit& unit = m_units[unitIndex];
+
+   std::vector<DwarfDie> dies = DecodeRawDies(sections, unit, errorText, maxDieCount);
+   if (dies.empty())
+      return dies;
+
+   // indexed strings and addresses use the bases specified in the unit DIE
+   UnitBases bases = GetUnitBases(dies.front());
+
+   for (DwarfDie& die : dies)
+   {
+      for (DwarfAttribute& attribute : die.attributes)
+         ResolveAttribute(sections, attribute, unit, bases);
+   }
+
+   return dies;
+}
+
+std::optional<DwarfDie> DwarfReader::DecodeUnitDie(const DwarfSections& sections,
+   size_t unitIndex) const
+{
+   CString errorText;
+   std::vector<DwarfDie> dies = DecodeDies(sections, unitIndex, errorText, 1);
+
+   if (dies.empty())
+      return std::nullopt;
+
+   return dies.front();
+}
+
+CString DwarfReader::UnitName(const DwarfSections& sections, size_t unitIndex) const
+{
+   std::optional<DwarfDie> unitDie = DecodeUnitDie(sections, unitIndex);
+   if (!unitDie.has_value())
+      return CString();
+
+   const DwarfAttribute* name = unitDie->FindAttribute(c_dwarfAttributeName);
+
+   return name != nullptr && name->text != nullptr
+      ? CString(CA2T(name->text, CP_UTF8))
+      : CString();
+}
+
+std::vector<DwarfDie> DwarfReader::DecodeRawDies(const DwarfSections& sections,
+   const DwarfCompilationUnit& unit,
+   CString& errorText, size_t maxDieCount) const
+{
+   std::shared_ptr<const AbbreviationTable> abbreviations = GetAbbreviationTable(unit.abbrevOffset);
+
+   // the reader ends at the unit end, so that no entry is read past the unit
+   DwarfDataReader reader(m_sections.info.data, unit.endOffset,
+      m_sections.littleEndian, unit.dieOffset);
+
+   std::vector<DwarfDie> dies;
+   size_t depth = 0;
+
+   while (!reader.IsAtEnd() &&
+      dies.size() < maxDieCount)
+   {
+      size_t dieOffset = reader.Offset();
+
+      ULONGLONG code = reader.ReadUleb128();
+      if (code == 0)
+      {
+         // null entry, ending a list of siblings
+         if (depth > 0)
+            depth--;
+
+         continue;
+      }
+
+      auto iter = abbreviations->find(code);
+      if (iter == abbreviations->end())
+      {
+         errorText.Format(_T("Unknown abbreviation code %llu at offset 0x%zx"), code, dieOffset);
+         break;
+      }
+
+      const Abbreviation& abbreviation = iter->second;
+
+      DwarfDie die;
+      die.offset = dieOffset;
+      die.depth = depth;
+      die.tag = abbreviation.tag;
+      die.hasChildren = abbreviation.hasChildren;
+      die.attributes.reserve(abbreviation.attributes.size());
+
+      for (const AbbreviationAttribute& specification : abbreviation.attributes)
+      {
+         DwarfAttribute attribute;
+         attribute.name = specification.name;
+         attribute.value = static_cast<ULONGLONG>(specification.implicitConst);
+
+         if (!ReadFormValue(sections, reader, specification.form, unit, attribute))
+         {
+            errorText.Format(_T("Unsupported form 0x%x in entry at offset 0x%zx"),
+               static_cast<DWORD>(specification.form), dieOffset);
+            return dies;
+         }
+
+         die.attributes.push_back(attribute);
+      }
+
+      if (reader.HasError())
+      {
+         errorText.Format(_T("Entry at offset 0x%zx exceeds the unit"), dieOffset);
+         break;
+      }
+
+      if (die.hasChildren)
+         depth++;
+
+      dies.push_back(std::move(die));
+   }
+
+   return dies;
+}
+
+bool DwarfReader::ReadFormValue(const DwarfSections& sections,
+   DwarfDataReader& reader, DwarfForm form,
+   const DwarfCompilationUnit& unit, DwarfAttribute& attribute) const
+{
+   attribute.form = form;
+
+   auto readBlock = [&](ULONGLONG size)
+   {
+      attribute.block = reader.Current();
+      attribute.blockSize = static_cast<size_t>(std::min<ULONGLONG>(size, reader.Remaining()));
+      reader.Skip(static_cast<size_t>(size));
+   };
+
+   switch (form)
+   {
+   case DwarfForm::addr:
+      attribute.value = reader.ReadUnsigned(unit.addressSize);
+      break;
+
+   case DwarfForm::block1: readBlock(reader.ReadByte()); break;
+   case DwarfForm::block2: readBlock(reader.ReadWord()); break;
+   case DwarfForm::block4: readBlock(reader.ReadDword()); break;
+   case DwarfForm::block:
+   case DwarfForm::exprloc:
+      readBlock(reader.ReadUleb128());
+      break;
+
+   case DwarfForm::data16:
+      readBlock(16);
+      break;
+
+   case DwarfForm::data1:
+   case DwarfForm::flag:
+   case DwarfForm::ref1:
+   case DwarfForm::strx1:
+   case DwarfForm::addrx1:
+      attribute.value = reader.ReadUnsigned(1);
+      break;
+
+   case DwarfForm::data2:
+   case DwarfForm::ref2:
+   case DwarfForm::strx2:
+   case DwarfForm::addrx2:
+      attribute.value = reader.ReadUnsigned(2);
+      break;
+
+   case DwarfForm::strx3:
+   case DwarfForm::addrx3:
+      attribute.value = reader.ReadUnsigned(3);
+      break;
+
+   case DwarfForm::data4:
+   case DwarfForm::ref4:
+   case DwarfForm::refSup4:
+   case DwarfForm::strx4:
+   case DwarfForm::addrx4:
+      attribute.value = reader.ReadUnsigned(4);
+      break;
+
+   case DwarfForm::data8:
+   case DwarfForm::ref8:
+   case DwarfForm::refSig8:
+   case DwarfForm::refSup8:
+      attribute.value = reader.ReadUnsigned(8);
+      break;
+
+   case DwarfForm::sdata:
+      attribute.value = static_cast<ULONGLONG>(reader.ReadSleb128());
+      break;
+
+   case DwarfForm::udata:
+   case DwarfForm::refUdata:
+   case DwarfForm::strx:
+   case DwarfForm::addrx:
+   case DwarfForm::loclistx:
+   case DwarfForm::rnglistx:
+   case DwarfForm::gnuAddrIndex:
+   case DwarfForm::gnuStrIndex:
+      attribute.value = reader.ReadUleb128();
+      break;
+
+   case DwarfForm::string:
+      attribute.text = reader.ReadString();
+      break;
+
+   case DwarfForm::strp:
+   case DwarfForm::lineStrp:
+   case DwarfForm::secOffset:
+   case DwarfForm::strpSup:
+   case DwarfForm::gnuRefAlt:
+   case DwarfForm::gnuStrpAlt:
+      attribute.value = reader.ReadOffset(unit.is64BitFormat);
+      break;
+
+   case DwarfForm::refAddr:
+      // DWARF 2 used the address size for references to other units
+      attribute.value = reader.ReadUnsigned(
+         unit.version <= 2 ? unit.addressSize : (unit.is64BitFormat ? 8 : 4));
+      break;
+
+   case DwarfForm::flagPresent:
+      attribute.value = 1;
+      break;
+
+   case DwarfForm::implicitConst:
+      // value is stored in the abbreviation declaration
+      break;
+
+   case DwarfForm::indirect:
+   {
+      DwarfForm actualForm = static_cast<DwarfForm>(reader.ReadUleb128());
+      if (actualForm == DwarfForm::indirect ||
+         actualForm == DwarfForm::implicitConst)
+         return false;
+
+      return ReadFormValue(sections, reader, actualForm, unit, attribute);
+   }
+
+   default:
+      return false;
+   }
+
+   switch (form)
+   {
+   case DwarfForm::ref1:
+   case DwarfForm::ref2:
+   case DwarfForm::ref4:
+   case DwarfForm::ref8:
+   case DwarfForm::refUdata:
+      // unit relative references are converted to .debug_info offsets
+      attribute.value += unit.offset;
+      break;
+
+   case DwarfForm::strp:
+      attribute.text = GetString(sections.str, attribute.value);
+      break;
+
+   case DwarfForm::lineStrp:
+      attribute.text = GetString(sections.lineStr, attribute.value);
+      break;
+
+   default:
+      break;
+   }
+
+   return true;
+}
+
+const char* DwarfReader::GetString(const DwarfSection& section, ULONGLONG offset) const
+{
+   if (!section.IsAvailable() ||
+      offset >= section.size)
+      return nullptr;
+
+   const char* text = reinterpret_cast<const char*>(section.data + offset);
+   size_t maxLength = section.size - static_cast<size_t>(offset);
+
+   // the string must be terminated inside the section
+   return strnlen(text, maxLength) < maxLength ? text : nullptr;
+}
+
+DwarfReader::UnitBases DwarfReader::GetUnitBases(const DwarfDie& unitDie)
+{
+   UnitBases bases;
+
+   for (const DwarfAttribute& attribute : unitDie.attributes)
+   {
+      switch (attribute.name)
+      {
+      case c_dwarfAttributeStrOffsetsBase:
+         bases.strOffsetsBase = attribute.value;
+         break;
+
+      case c_dwarfAttributeAddrBase:
+      case c_dwarfAttributeGnuAddrBase:
+         bases.addrBase = attribute.value;
+         break;
+
+      case c_dwarfAttributeRnglistsBase:
+         bases.rnglistsBase = attribute.value;
+         break;
+
+      default:
+         break;
+      }
+   }
+
+   return bases;
+}
+
+void DwarfReader::ResolveAttribute(const DwarfSections& sections,
+   DwarfAttribute& attribute, const DwarfCompilationUnit& unit,
+   const UnitBases& bases) const
+{
+   switch (attribute.form)
+   {
+   case DwarfForm::strx:
+   case DwarfForm::strx1:
+   case DwarfForm::strx2:
+   case DwarfForm::strx3:
+   case DwarfForm::strx4:
+   {
+      size_t offsetSize = unit.is64BitFormat ? 8 : 4;
+      ULONGLONG entryOffset = bases.strOffsetsBase + attribute.value * offsetSize;
+      if (entryOffset >= sections.strOffsets.size)
+         break;
+
+      DwarfDataReader reader = CreateReader(sections.strOffsets, static_cast<size_t>(entryOffset));
+      ULONGLONG stringOffset = reader.ReadOffset(unit.is64BitFormat);
+
+      if (!reader.HasError())
+         attribute.text = GetString(sections.str, stringOffset);
+      break;
+   }
+
+   case DwarfForm::addrx:
+   case DwarfForm::addrx1:
+   case DwarfForm::addrx2:
+   case DwarfForm::addrx3:
+   case DwarfForm::addrx4:
+   case DwarfForm::gnuAddrIndex:
+   {
+      std::optional<ULONGLONG> address = ReadIndexedAddress(sections, unit, bases, attribute.value);
+      if (address.has_value())
+         attribute.value = address.value();
+      break;
+   }
+
+   default:
+      break;
+   }
+}
+
+std::optional<ULONGLONG> DwarfReader::ReadIndexedAddress(const DwarfSections& sections,
+   const DwarfCompilationUnit& unit,
+   const UnitBases& bases, ULONGLONG index) const
+{
+   ULONGLONG entryOffset = bases.addrBase + index * unit.addressSize;
+   if (entryOffset >= sections.addr.size)
+      return std::nullopt;
+
+   DwarfDataReader reader = CreateReader(sections.addr, static_cast<size_t>(entryOffset));
+   ULONGLONG address = reader.ReadUnsigned(unit.addressSize);
+
+   if (reader.HasError())
+      return std::nullopt;
+
+   return address;
+}
+
+void DwarfReader::ReadRangeList(const DwarfSections& sections,
+   const DwarfCompilationUnit& unit, const UnitBases& bases,
+   const DwarfAttribute& rangesAttribute, ULONGLONG baseAddress,
+   std::vector<std::pair<ULONGLONG, ULONGLONG>>& ranges) const
+{
+   if (unit.version < 5)
+   {
+      // .debug_ranges: pairs of addresses relative to the base address; a
+      // pair starting with the largest address selects a new base address
+      if (rangesAttribute.value >= sections.ranges.size)
+         return;
+
+      ULONGLONG maxAddress = unit.addressSize == 8
+         ? ~0ULL
+         : (1ULL << (unit.addressSize * 8)) - 1;
+
+      DwarfDataReader reader = CreateReader(sections.ranges, static_cast<size_t>(rangesAttribute.value));
+      while (!reader.IsAtEnd())
+      {
+         ULONGLONG start = reader.ReadUnsigned(unit.addressSize);
+         ULONGLONG end = reader.ReadUnsigned(unit.addressSize);
+
+         if (reader.HasError() ||
+            (start == 0 && end == 0))
+            break;
+
+         if (start == maxAddress)
+            baseAddress = end;
+         else
+            ranges.emplace_back(baseAddress + start, baseAddress + end);
+      }
+
+      return;
+   }
+
+   ULONGLONG listOffset = rangesAttribute.value;
+
+   if (rangesAttribute.form == DwarfForm::rnglistx)
+   {
+      // the offsets table follows the header; offsets are relative to the base
+      size_t offsetSize = unit.is64BitFormat ? 8 : 4;
+      ULONGLONG entryOffset = bases.rnglistsBase + rangesAttribute.value * offsetSize;
+      if (entryOffset >= sections.rnglists.size)
+         return;
+
+      DwarfDataReader offsetReader = CreateReader(sections.rnglists, static_cast<size_t>(entryOffset));
+      listOffset = bases.rnglistsBase + offsetReader.ReadOffset(unit.is64BitFormat);
+
+      if (offsetReader.HasError())
+         return;
+   }
+
+   if (listOffset >= sections.rnglists.size)
+      return;
+
+   auto readIndexedAddress = [&](ULONGLONG index)
+   {
+      return ReadIndexedAddress(sections, unit, bases, index).value_or(0);
+   };
+
+   DwarfDataReader reader = CreateReader(sections.rnglists, static_cast<size_t>(listOffset));
+   while (!reader.IsAtEnd())
+   {
+      size_t rangeCount = ranges.size();
+
+      switch (static_cast<DwarfRangeListEntry>(reader.ReadByte()))
+      {
+      case DwarfRangeListEntry::endOfList:
+         return;
+
+      case DwarfRangeListEntry::baseAddressx:
+         baseAddress = readIndexedAddress(reader.ReadUleb128());
+         break;
+
+      case DwarfRangeListEntry::startxEndx:
+      {
+         ULONGLONG start = readIndexedAddress(reader.ReadUleb128());
+         ULONGLONG end = readIndexedAddress(reader.ReadUleb128());
+         ranges.emplace_back(start, end);
+         break;
+      }
+
+      case DwarfRangeListEntry::startxLength:
+      {
+         ULONGLONG start = readIndexedAddress(reader.ReadUleb128());
+         ranges.emplace_back(start, start + reader.ReadUleb128());
+         break;
+      }
+
+      case DwarfRangeListEntry::offsetPair:
+      {
+         ULONGLONG startOffset = reader.ReadUleb128();
+         ULONGLONG endOffset = reader.ReadUleb128();
+         ranges.emplace_back(baseAddress + startOffset, baseAddress + endOffset);
+         break;
+      }
+
+      case DwarfRangeListEntry::baseAddress:
+         baseAddress = reader.ReadUnsigned(unit.addressSize);
+         break;
+
+      case DwarfRangeListEntry::startEnd:
+      {
+         ULONGLONG start = reader.ReadUnsigned(unit.addressSize);
+         ranges.emplace_back(start, reader.ReadUnsigned(unit.addressSize));
+         break;
+      }
+
+      case DwarfRangeListEntry::startLength:
+      {
+         ULONGLONG start = reader.ReadUnsigned(unit.addressSize);
+         ranges.emplace_back(start, start + reader.ReadUleb128());
+         break;
+      }
+
+      default:
+         return; // unknown entry kind; the list can't be decoded further
+      }
+
+      // drops a range that was only partially read
+      if (reader.HasError())
+      {
+         ranges.resize(rangeCount);
+         return;
+      }
+   }
+}
+
+CString DwarfReader::FormatAttributeValue(const DwarfAttribute& attribute)
+{
+   CString text;
+
+   if (attribute.text != nullptr)
+   {
+      text.Format(_T("\"%s\""), CString(CA2T(attribute.text, CP_UTF8)).GetString());
+      return text;
+   }
+
+   switch (attribute.form)
+   {
+   case DwarfForm::block1:
+   case DwarfForm::block2:
+   case DwarfForm::block4:
+   case DwarfForm::block:
+   case DwarfForm::exprloc:
+   case DwarfForm::data16:
+   {
+      text.Format(_T("%zu byte block:"), attribute.blockSize);
+
+      size_t count = std::min(attribute.blockSize, c_maxFormattedBlockBytes);
+      for (size_t index = 0; index < count; index++)
+         text.AppendFormat(_T(" %02x"), attribute.block[index]);
+
+      if (attribute.blockSize > count)
+         text += _T(" ...");
+
+      break;
+   }
+
+   case DwarfForm::flag:
+   case DwarfForm::flagPresent:
+      text = attribute.value != 0 ? _T("true") : _T("false");
+      break;
+
+   case DwarfForm::sdata:
+   case DwarfForm::implicitConst:
+      text.Format(_T("%lld"), static_cast<LONGLONG>(attribute.value));
+      break;
+
+   case DwarfForm::data1:
+   case DwarfForm::data2:
+   case DwarfForm::data4:
+   case DwarfForm::data8:
+   case DwarfForm::udata:
+      text.Format(_T("%llu"), attribute.value);
+      break;
+
+   case DwarfForm::ref1:
+   case DwarfForm::ref2:
+   case DwarfForm::ref4:
+   case DwarfForm::ref8:
+   case DwarfForm::refUdata:
+   case DwarfForm::refAddr:
+      text.Format(_T("<0x%llx>"), attribute.value);
+      break;
+
+   case DwarfForm::strp:
+   case DwarfForm::lineStrp:
+   case DwarfForm::strpSup:
+   case DwarfForm::gnuStrpAlt:
+      text.Format(_T("string at offset 0x%llx, not available"), attribute.value);
+      break;
+
+   case DwarfForm::strx:
+   case DwarfForm::strx1:
+   case DwarfForm::strx2:
+   case DwarfForm::strx3:
+   case DwarfForm::strx4:
+   case DwarfForm::gnuStrIndex:
+      text.Format(_T("string index %llu, not available"), attribute.value);
+      break;
+
+   default:
+      text.Format(_T("0x%llx"), attribute.value);
+      break;
+   }
+
+   return text;
+}
@@ -0,0 +1,278 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file DwarfReader.hpp
+/// \brief reader for DWARF debug information
+//
+#pragma once
+
+#include "DwarfSections.hpp"
+#include "DwarfDefinitions.hpp"
+#include "DwarfDataReader.hpp"
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+/// \brief DWARF unit header, from .debug_info
+struct DwarfCompilationUnit
+{
+   /// offset of the unit header in .debug_info
+   size_t offset = 0;
+
+   /// offset of the first debug information entry of the unit
+   size_t dieOffset = 0;
+
+   /// offset after the end of the unit
+   size_t endOffset = 0;
+
+   /// DWARF version
+   WORD version = 0;
+
+   /// unit type; DW_UT_* value; set to DW_UT_compile for DWARF 2 to 4
+   BYTE unitType = 0;
+
+   /// size of addresses, in bytes
+   BYTE addressSize = 0;
+
+   /// indicates the 64-bit DWARF format, with 64-bit section offsets
+   bool is64BitFormat = false;
+
+   /// offset of the abbreviation table in .debug_abbrev
+   ULONGLONG abbrevOffset = 0;
+};
+
+/// \brief Address range covered by a compilation unit
+struct DwarfAddressRange
+{
+   /// start address
+   ULONGLONG start = 0;
+
+   /// end address, exclusive
+   ULONGLONG end = 0;
+
+   /// index of the compilation unit
+   size_t unitIndex = 0;
+
+   /// indicates that the range was taken from .debug_aranges, instead of the
+   /// unit's debug information entry
+   bool fromAranges = false;
+};
+
+/// \brief Attribute of a debug information entry
+struct DwarfAttribute
+{
+   /// attribute name; DW_AT_* value
+   DWORD name = 0;
+
+   /// attribute form
+   DwarfForm form = DwarfForm::udata;
+
+   /// attribute value: address, constant (sign extended for signed forms),
+   /// section offset, index, or .debug_info offset for references
+   ULONGLONG value = 0;
+
+   /// block data, for block, exprloc and data16 forms
+   const BYTE* block = nullptr;
+
+   /// size of block data
+   size_t blockSize = 0;
+
+   /// string value, for string forms; nullptr when it can't be resolved
+   const char* text = nullptr;
+};
+
+/// \brief Debug information entry
+struct DwarfDie
+{
+   /// offset in .debug_info
+   size_t offset = 0;
+
+   /// nesting depth; the unit DIE has depth 0
+   size_t depth = 0;
+
+   /// tag; DW_TAG_* value
+   DWORD tag = 0;
+
+   /// indicates that the entry has child entries
+   bool hasChildren = false;
+
+   /// all attributes
+   std::vector<DwarfAttribute> attributes;
+
+   /// finds an attribute by name; returns nullptr when not found
+   const DwarfAttribute* FindAttribute(DWORD name) const;
+};
+
+/// \brief DWARF debug information reader
+/// \details Fully decoding DWARF debug information of large binaries takes a
+/// lot of time and memory, so the reader only indexes the unit headers when
+/// constructed, which only needs the .debug_info and .debug_abbrev sections.
+/// The address ranges of all units are indexed when first needed; they are
+/// read from .debug_aranges, and only for units not covered there the unit
+/// DIE is decoded. All other debug information entries and the line programs
+/// are decoded on request for a single unit only. The other sections may only
+/// be loaded on demand; the decoding functions take the sections returned by
+/// LoadSections(), which keep the loaded data alive while decoded entries are
+/// used.
+class DwarfReader
+{
+public:
+   /// ctor; indexes units
+   explicit DwarfReader(const DwarfSections& sections);
+
+   /// returns if any DWARF debug information is available
+   bool IsAvailable() const { return !m_units.empty(); }
+
+   /// returns an error text, when the unit index couldn't be completely built
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the DWARF sections, with all sections loaded that are only
+   /// loaded on demand; errors are appended to the error text
+   DwarfSections LoadSections(CString& errorText) const
+   {
+      return m_sections.Load(errorText);
+   }
+
+   /// returns all units
+   const std::vector<DwarfCompilationUnit>& Units() const { return m_units; }
+
+   /// returns all address ranges, sorted by start address; the address ranges
+   /// are indexed on first call
+   const std::vector<DwarfAddressRange>& AddressRanges() const;
+
+   /// returns an error text, when the address ranges couldn't be completely
+   /// indexed
+   const CString& GetAddressRangesErrorText() const;
+
+   /// finds the unit containing the given address
+   std::optional<size_t> FindUnitByAddress(ULONGLONG address) const;
+
+   /// finds the unit containing the given .debug_info offset
+   std::optional<size_t> FindUnitByOffset(size_t infoOffset) const;
+
+   /// decodes the debug information entries of a unit, up to a maximum count;
+   /// sets an error text when not all entries could be decoded
+   std::vector<DwarfDie> DecodeDies(const DwarfSections& sections,
+      size_t unitIndex, CString& errorText,
+      size_t maxDieCount = std::numeric_limits<size_t>::max()) const;
+
+   /// decodes the unit DIE only
+   std::optional<DwarfDie> DecodeUnitDie(const DwarfSections& sections,
+      size_t unitIndex) const;
+
+   /// returns the name of a unit, from the unit DIE
+   CString UnitName(const DwarfSections& sections, size_t unitIndex) const;
+
+   /// reads the value of an attribute in given form; the unit is used for
+   /// the address size, the DWARF format and unit relative references
+   bool ReadFormValue(const DwarfSections& sections,
+      DwarfDataReader& reader, DwarfForm form,
+      const DwarfCompilationUnit& unit, DwarfAttribute& attribute) const;
+
+   /// returns a zero-terminated string from a string section, or nullptr
+   const char* GetString(const DwarfSection& section, ULONGLONG offset) const;
+
+   /// formats an attribute value for display
+   static CString FormatAttributeValue(const DwarfAttribute& attribute);
+
+   /// creates a data reader for a section
+   DwarfDataReader CreateReader(const DwarfSection& section, size_t offset = 0) const
+   {
+      return DwarfDataReader(section.data, section.size, m_sections.littleEndian, offset);
+   }
+
+private:
+   /// abbreviation attribute specification
+   struct AbbreviationAttribute
+   {
+      DWORD name = 0;               ///< attribute name
+      DwarfForm form = DwarfForm::udata; ///< attribute form
+      LONGLONG implicitConst = 0;   ///< value for DW_FORM_implicit_const
+   };
+
+   /// abbreviation declaration
+   struct Abbreviation
+   {
+      DWORD tag = 0;                ///< tag of entries using the abbreviation
+      bool hasChildren = false;     ///< indicates entries with children
+      std::vector<AbbreviationAttribute> attributes; ///< attribute specifications
+   };
+
+   /// abbreviation table; maps abbreviation codes to declarations
+   using AbbreviationTable = std::unordered_map<ULONGLONG, Abbreviation>;
+
+   /// unit specific base offsets, from the unit DIE
+   struct UnitBases
+   {
+      ULONGLONG strOffsetsBase = 0; ///< base of the .debug_str_offsets contribution
+      ULONGLONG addrBase = 0;       ///< base of the .debug_addr contribution
+      ULONGLONG rnglistsBase = 0;   ///< base of the .debug_rnglists contribution
+   };
+
+   /// reads all unit headers
+   void IndexUnits();
+
+   /// indexes the address ranges of all units
+   void IndexAddressRanges() const;
+
+   /// reads all address ranges from .debug_aranges
+   void IndexArangesRanges(const DwarfSections& sections,
+      std::vector<bool>& unitsWithRanges) const;
+
+   /// reads the address ranges of a unit from its unit DIE
+   void IndexUnitDieRanges(const DwarfSections& sections, size_t unitIndex) const;
+
+   /// returns the abbreviation table at given offset; tables are cached
+   std::shared_ptr<const AbbreviationTable> GetAbbreviationTable(ULONGLONG offset) const;
+
+   /// decodes debug information entries, without resolving indexed values
+   std::vector<DwarfDie> DecodeRawDies(const DwarfSections& sections,
+      const DwarfCompilationUnit& unit,
+      CString& errorText, size_t maxDieCount) const;
+
+   /// determines the unit bases from the unit DIE
+   static UnitBases GetUnitBases(const DwarfDie& unitDie);
+
+   /// resolves indexed strings and addresses of an attribute
+   void ResolveAttribute(const DwarfSections& sections,
+      DwarfAttribute& attribute, const DwarfCompilationUnit& unit,
+      const UnitBases& bases) const;
+
+   /// reads an address from the .debug_addr table
+   std::optional<ULONGLONG> ReadIndexedAddress(const DwarfSections& sections,
+      const DwarfCompilationUnit& unit,
+      const UnitBases& bases, ULONGLONG index) const;
+
+   /// reads the address ranges of a DW_AT_ranges attribute
+   void ReadRangeList(const DwarfSections& sections,
+      const DwarfCompilationUnit& unit, const UnitBases& bases,
+      const DwarfAttribute& rangesAttribute, ULONGLONG baseAddress,
+      std::vector<std::pair<ULONGLONG, ULONGLONG>>& ranges) const;
+
+private:
+   /// DWARF sections; only .debug_info and .debug_abbrev are always loaded
+   DwarfSections m_sections;
+
+   /// error text
+   CString m_errorText;
+
+   /// all units
+   std::vector<DwarfCompilationUnit> m_units;
+
+   /// flag to index the address ranges only once
+   mutable std::once_flag m_addressRangesOnceFlag;
+
+   /// all address ranges, sorted by start address
+   mutable std::vector<DwarfAddressRange> m_addressRanges;
+
+   /// error text of indexing the address ranges
+   mutable CString m_addressRangesErrorText;
+
+   /// lock for the abbreviation table cache
+   mutable std::mutex m_abbreviationLock;
+
+   /// abbreviation tables, by offset in .debug_abbrev
+   mutable std::unordered_map<ULONGLONG, std::shared_ptr<const AbbreviationTable>> m_abbreviationTables;
+};
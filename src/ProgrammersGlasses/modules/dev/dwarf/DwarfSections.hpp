@@ -0,0 +1,123 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file DwarfSections.hpp
+/// \brief DWARF debug sections of an ELF or COFF file
+//
+#pragma once
+
+#include <functional>
+
+/// \brief Contents of a single DWARF section
+struct DwarfSection
+{
+   /// section data; nullptr when the section isn't available
+   const BYTE* data = nullptr;
+
+   /// size of section data
+   size_t size = 0;
+
+   /// buffer that keeps decompressed or relocated data alive; empty when the
+   /// data is in the mapped file
+   std::shared_ptr<const std::vector<BYTE>> buffer;
+
+   /// loads the section data on demand, e.g. for compressed sections that
+   /// are decompressed using a bounded section cache; empty when the data is
+   /// always available. On errors, the loaded section isn't available and
+   /// an error text is set.
+   std::function<DwarfSection(CString& errorText)> loader;
+
+   /// returns if the section is available
+   bool IsAvailable() const { return data != nullptr && size != 0; }
+};
+
+/// \brief DWARF debug sections
+/// \details The sections are collected by the reader of the containing file
+/// format, e.g. from an ELF image, where they may be compressed, or from a
+/// COFF object file produced by MinGW. Sections that are expensive to keep in
+/// memory may only have a loader; these are loaded by calling Load().
+struct DwarfSections
+{
+   /// indicates little-endian byte order of the containing file
+   bool littleEndian = true;
+
+   DwarfSection info;            ///< .debug_info: debug information entries
+   DwarfSection abbrev;          ///< .debug_abbrev: abbreviation tables
+   DwarfSection line;            ///< .debug_line: line number programs
+   DwarfSection str;             ///< .debug_str: strings
+   DwarfSection lineStr;         ///< .debug_line_str: strings of line tables
+   DwarfSection aranges;         ///< .debug_aranges: address ranges of units
+   DwarfSection ranges;          ///< .debug_ranges: non-contiguous address ranges, DWARF 2 to 4
+   DwarfSection rnglists;        ///< .debug_rnglists: non-contiguous address ranges, DWARF 5
+   DwarfSection addr;            ///< .debug_addr: address table, DWARF 5
+   DwarfSection strOffsets;      ///< .debug_str_offsets: string offsets table, DWARF 5
+
+   /// returns a copy of the sections, with all sections loaded that have a
+   /// loader; the copy keeps the loaded data alive, so data read from the
+   /// sections must not be used after the copy is destroyed. Errors are
+   /// appended to the error text.
+   DwarfSections Load(CString& errorText) const
+   {
+      DwarfSections sections = *this;
+
+      for (const auto& [name, member] : SectionNames())
+      {
+         DwarfSection& section = sections.*member;
+         if (section.IsAvailable() ||
+            section.loader == nullptr)
+            continue;
+
+         CString sectionErrorText;
+         section = section.loader(sectionErrorText);
+
+         if (!sectionErrorText.IsEmpty())
+         {
+            errorText.AppendFormat(_T("Error: DWARF section .debug_%s: %s\n"),
+               name.GetString(),
+               sectionErrorText.GetString());
+         }
+      }
+
+      return sections;
+   }
+
+   /// returns the section for a section name, e.g. ".debug_info" or
+   /// ".zdebug_info"; returns nullptr for other section names
+   DwarfSection* FindBySectionName(const CString& sectionName)
+   {
+      CString name;
+      if (sectionName.Find(_T(".debug_")) == 0)
+         name = sectionName.Mid(7);
+      else if (sectionName.Find(_T(".zdebug_")) == 0)
+         name = sectionName.Mid(8);
+      else
+         return nullptr;
+
+      const auto& sectionNames = SectionNames();
+
+      auto iter = sectionNames.find(name);
+      return iter != sectionNames.end() ? &(this->*(iter->second)) : nullptr;
+   }
+
+private:
+   /// returns the mapping of section names, without prefix, to sections
+   static const std::map<CString, DwarfSection DwarfSections::*>& SectionNames()
+   {
+      static const std::map<CString, DwarfSection DwarfSections::*> s_sectionNames =
+      {
+         { _T("info"), &DwarfSections::info },
+         { _T("abbrev"), &DwarfSections::abbrev },
+         { _T("line"), &DwarfSections::line },
+         { _T("str"), &DwarfSections::str },
+         { _T("line_str"), &DwarfSections::lineStr },
+         { _T("aranges"), &DwarfSections::aranges },
+         { _T("ranges"), &DwarfSections::ranges },
+         { _T("rnglists"), &DwarfSections::rnglists },
+         { _T("addr"), &DwarfSections::addr },
+         { _T("str_offsets"), &DwarfSections::strOffsets },
+      };
+
+      return s_sectionNames;
+   }
+};
@@ -0,0 +1,64 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfCompression.cpp
+/// \brief ELF compressed section definitions
+//
+#include "stdafx.h"
+#include "ElfCompression.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapElfCompressionTypeToDisplayText =
+{
+   { c_elfCompressionTypeZlib, _T("ELFCOMPRESS_ZLIB") },
+   { c_elfCompressionTypeZstd, _T("ELFCOMPRESS_ZSTD") },
+};
+
+/// creates the struct definition for ELF32 or ELF64 compression headers
+template <typename THeader>
+static StructDefinition CreateElfCompressionHeaderDefinition(bool littleEndian)
+{
+   return StructDefinition({
+      StructField(
+         offsetof(THeader, type),
+         sizeof(THeader::type),
+         4,
+         littleEndian,
+         StructFieldType::valueMapping,
+         g_mapElfCompressionTypeToDisplayText,
+         _T("Compression type")),
+
+      StructField(
+         offsetof(THeader, size),
+         sizeof(THeader::size),
+         sizeof(THeader::size),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Uncompressed size")),
+
+      StructField(
+         offsetof(THeader, addressAlign),
+         sizeof(THeader::addressAlign),
+         sizeof(THeader::addressAlign),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Uncompressed alignment")),
+   });
+}
+
+const StructDefinition& GetElfCompressionHeaderDefinition(bool is64Bit, bool littleEndian)
+{
+   static const StructDefinition definitions[2][2] =
+   {
+      {
+         CreateElfCompressionHeaderDefinition<Elf32CompressionHeader>(false),
+         CreateElfCompressionHeaderDefinition<Elf32CompressionHeader>(true),
+      },
+      {
+         CreateElfCompressionHeaderDefinition<Elf64CompressionHeader>(false),
+         CreateElfCompressionHeaderDefinition<Elf64CompressionHeader>(true),
+      },
+   };
+
+   return definitions[is64Bit ? 1 : 0][littleEndian ? 1 : 0];
+}
@@ -0,0 +1,58 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfCompression.hpp
+/// \brief ELF compressed section definitions
+//
+#pragma once
+
+#include "StructDefinition.hpp"
+
+#pragma pack(push, 1)
+
+/// \brief ELF compression header, for 32-bit files; precedes the compressed
+/// data of sections with the SHF_COMPRESSED flag
+/// \see https://refspecs.linuxfoundation.org/elf/gabi4+/ch4.sheader.html#section_compression
+struct Elf32CompressionHeader
+{
+   DWORD type;                   ///< compression algorithm; ELFCOMPRESS_* value
+   DWORD size;                   ///< size of the uncompressed data
+   DWORD addressAlign;           ///< alignment of the uncompressed data
+};
+
+/// \brief ELF compression header, for 64-bit files
+struct Elf64CompressionHeader
+{
+   DWORD type;                   ///< compression algorithm; ELFCOMPRESS_* value
+   DWORD reserved;               ///< reserved
+   ULONGLONG size;               ///< size of the uncompressed data
+   ULONGLONG addressAlign;       ///< alignment of the uncompressed data
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(Elf32CompressionHeader) == 12, "ELF32 compression header must be 12 bytes long");
+static_assert(sizeof(Elf64CompressionHeader) == 24, "ELF64 compression header must be 24 bytes long");
+
+/// SHF_COMPRESSED: section data is compressed and starts with a compression header
+constexpr ULONGLONG c_elfSectionFlagCompressed = 0x800;
+
+/// ELFCOMPRESS_ZLIB: zlib (deflate) compression
+constexpr DWORD c_elfCompressionTypeZlib = 1;
+
+/// ELFCOMPRESS_ZSTD: Zstandard compression
+constexpr DWORD c_elfCompressionTypeZstd = 2;
+
+/// magic bytes of the legacy .zdebug_* sections, followed by the uncompressed
+/// size as 64-bit big-endian value and the zlib stream
+constexpr char c_elfZdebugMagic[4] = { 'Z', 'L', 'I', 'B' };
+
+/// size of the legacy .zdebug_* section header
+constexpr size_t c_elfZdebugHeaderSize = sizeof(c_elfZdebugMagic) + sizeof(ULONGLONG);
+
+/// mapping of ELF compression types to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfCompressionTypeToDisplayText;
+
+/// returns struct definition for an ELF compression header with given class and data encoding
+const StructDefinition& GetElfCompressionHeaderDefinition(bool is64Bit, bool littleEndian);
@@ -0,0 +1,249 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfDwarfSections.cpp
+/// \brief DWARF debug sections of an ELF image
+//
+#include "stdafx.h"
+#include "ElfDwarfSections.hpp"
+#include "ElfSectionDataCache.hpp"
+#include "ElfSymbolTable.hpp"
+#include "ElfRelocationTable.hpp"
+#include "ElfRelocation.hpp"
+
+/// ET_REL: relocatable object file
+constexpr WORD c_elfTypeRelocatable = 1;
+
+/// EM_386: Intel 80386
+constexpr WORD c_elfMachine386 = 3;
+
+/// EM_X86_64: AMD x86-64
+constexpr WORD c_elfMachineX86_64 = 62;
+
+/// EM_AARCH64: ARM 64-bit
+constexpr WORD c_elfMachineAArch64 = 183;
+
+/// \brief Returns the size of the value that an absolute relocation type
+/// writes, or 0 for relocation types not used in debug sections
+static size_t GetAbsoluteRelocationSize(WORD machine, DWORD type)
+{
+   switch (machine)
+   {
+   case c_elfMachine386:
+      return type == 1 // R_386_32
+         ? 4 : 0;
+
+   case c_elfMachineX86_64:
+      switch (type)
+      {
+      case 1: return 8;    // R_X86_64_64
+      case 10: return 4;   // R_X86_64_32
+      case 11: return 4;   // R_X86_64_32S
+      case 21: return 4;   // R_X86_64_DTPOFF32
+      default: return 0;
+      }
+
+   case c_elfMachineAArch64:
+      switch (type)
+      {
+      case 257: return 8;  // R_AARCH64_ABS64
+      case 258: return 4;  // R_AARCH64_ABS32
+      default: return 0;
+      }
+
+   default:
+      return 0;
+   }
+}
+
+/// \brief Reads an unsigned value in the byte order of the image
+static ULONGLONG ReadValue(const BYTE* data, size_t size, bool littleEndian)
+{
+   ULONGLONG value = 0;
+   for (size_t index = 0; index < size; index++)
+   {
+      BYTE byte = data[littleEndian ? size - 1 - index : index];
+      value = (value << 8) | byte;
+   }
+
+   return value;
+}
+
+/// \brief Writes an unsigned value in the byte order of the image
+static void WriteValue(BYTE* data, size_t size, bool littleEndian, ULONGLONG value)
+{
+   for (size_t index = 0; index < size; index++)
+   {
+      data[littleEndian ? index : size - 1 - index] = static_cast<BYTE>(value & 0xff);
+      value >>= 8;
+   }
+}
+
+/// \brief Applies all relocations of a relocation section to a copy of the
+/// section data
+static bool ApplyRelocations(const ElfImage& image, const ElfSection& relocationSection,
+   std::vector<BYTE>& sectionData, CString& errorText)
+{
+   ElfRelocationTable relocationTable{ image, relocationSection };
+   if (!relocationTable.IsValid())
+   {
+      errorText = relocationTable.GetErrorText();
+      return false;
+   }
+
+   if (relocationSection.link >= image.Sections().size())
+   {
+      errorText = _T("Relocation section has an invalid symbol table link");
+      return false;
+   }
+
+   ElfSymbolTable symbolTable{ image, image.Sections()[relocationSection.link] };
+   if (!symbolTable.IsValid())
+   {
+      errorText = symbolTable.GetErrorText();
+      return false;
+   }
+
+   size_t unsupportedCount = 0;
+   for (size_t index = 0; index < relocationTable.Count(); index++)
+   {
+      ElfRelocation relocation = relocationTable.GetRelocation(index);
+
+      size_t valueSize = GetAbsoluteRelocationSize(image.Machine(), relocation.type);
+      if (valueSize == 0 ||
+         relocation.symbolIndex >= symbolTable.Count() ||
+         relocation.offset > sectionData.size() ||
+         valueSize > sectionData.size() - relocation.offset)
+      {
+         unsupportedCount++;
+         continue;
+      }
+
+      BYTE* location = sectionData.data() + relocation.offset;
+
+      // REL relocations store the addend at the location itself
+      LONGLONG addend = relocationTable.Format() == ElfRelocationFormat::rela
+         ? relocation.addend
+         : static_cast<LONGLONG>(ReadValue(location, valueSize, image.IsLittleEndian()));
+
+      ElfSymbol symbol = symbolTable.GetSymbol(relocation.symbolIndex);
+
+      WriteValue(location, valueSize, image.IsLittleEndian(),
+         symbol.value + static_cast<ULONGLONG>(addend));
+   }
+
+   if (unsupportedCount > 0)
+   {
+      errorText.Format(_T("%zu relocations couldn't be applied"), unsupportedCount);
+      return false;
+   }
+
+   return true;
+}
+
+/// \brief Loads a DWARF section; decompresses the section using the cache,
+/// and applies relocations in relocatable object files
+static DwarfSection LoadElfDwarfSection(const ElfImage& image,
+   ElfSectionDataCache& sectionDataCache, const ElfSection& section,
+   CString& errorText)
+{
+   CString sectionErrorText;
+   ElfSectionContents contents = sectionDataCache.SectionContents(section, sectionErrorText);
+   if (contents.data == nullptr)
+   {
+      errorText = sectionErrorText;
+      return DwarfSection{};
+   }
+
+   DwarfSection dwarfSection;
+   dwarfSection.data = contents.data;
+   dwarfSection.size = contents.size;
+   dwarfSection.buffer = contents.buffer;
+
+   if (image.Type() != c_elfTypeRelocatable)
+      return dwarfSection;
+
+   // relocatable object files store section offsets and addresses as
+   // relocations; apply them to a copy of the section data
+   std::shared_ptr<std::vector<BYTE>> relocatedData;
+
+   for (const ElfSection& relocationSection : image.Sections())
+   {
+      if ((relocationSection.type != c_elfSectionTypeRela &&
+         relocationSection.type != c_elfSectionTypeRel) ||
+         relocationSection.info != section.index)
+         continue;
+
+      if (relocatedData == nullptr)
+      {
+         relocatedData = std::make_shared<std::vector<BYTE>>(
+            contents.data, contents.data + contents.size);
+      }
+
+      if (!ApplyRelocations(image, relocationSection, *relocatedData, sectionErrorText))
+      {
+         if (!errorText.IsEmpty())
+            errorText += _T("; ");
+
+         errorText.AppendFormat(_T("relocation section %s: %s"),
+            relocationSection.name.GetString(),
+            sectionErrorText.GetString());
+      }
+   }
+
+   if (relocatedData != nullptr)
+   {
+      dwarfSection.data = relocatedData->data();
+      dwarfSection.size = relocatedData->size();
+      dwarfSection.buffer = relocatedData;
+   }
+
+   return dwarfSection;
+}
+
+DwarfSections GetElfDwarfSections(std::shared_ptr<const ElfImage> image,
+   std::shared_ptr<ElfSectionDataCache> sectionDataCache, CString& errorText)
+{
+   DwarfSections sections;
+   sections.littleEndian = image->IsLittleEndian();
+
+   for (const ElfSection& section : image->Sections())
+   {
+      DwarfSection* dwarfSection = sections.FindBySectionName(section.name);
+      if (dwarfSection == nullptr ||
+         dwarfSection->IsAvailable() ||
+         dwarfSection->loader != nullptr ||
+         section.size == 0)
+         continue;
+
+      // only the sections needed to index the units are loaded now; all
+      // other sections are loaded through the cache when a unit is decoded
+      if (dwarfSection != &sections.info &&
+         dwarfSection != &sections.abbrev)
+      {
+         size_t sectionIndex = section.index;
+
+         dwarfSection->loader =
+            [image, sectionDataCache, sectionIndex](CString& sectionErrorText)
+            {
+               return LoadElfDwarfSection(*image, *sectionDataCache,
+                  image->Sections()[sectionIndex], sectionErrorText);
+            };
+
+         continue;
+      }
+
+      CString sectionErrorText;
+      *dwarfSection = LoadElfDwarfSection(*image, *sectionDataCache, section, sectionErrorText);
+
+      if (!sectionErrorText.IsEmpty())
+      {
+         errorText.AppendFormat(_T("Error: DWARF section %s: %s\n"),
+            section.name.GetString(),
+            sectionErrorText.GetString());
+      }
+   }
+
+   return sections;
+}
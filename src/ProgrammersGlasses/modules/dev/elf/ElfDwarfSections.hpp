@@ -0,0 +1,27 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfDwarfSections.hpp
+/// \brief DWARF debug sections of an ELF image
+//
+#pragma once
+
+#include "ElfImage.hpp"
+#include "dev/dwarf/DwarfSections.hpp"
+
+class ElfSectionDataCache;
+
+/// \brief Collects the DWARF debug sections of an ELF image
+/// \details Compressed sections are decompressed using the section data
+/// cache. In relocatable object files, the references between the DWARF
+/// sections and the addresses are only stored as relocations; these are
+/// applied to a copy of the section, for the x86, x86-64 and AArch64
+/// relocation types used in debug sections. Only .debug_info and
+/// .debug_abbrev are loaded here, since they are needed to index the units;
+/// all other sections get a loader that loads them when a unit is decoded,
+/// so that they are only kept in memory as long as the cache keeps them.
+/// Errors are appended to the error text; the affected sections stay
+/// unavailable or unrelocated.
+DwarfSections GetElfDwarfSections(std::shared_ptr<const ElfImage> image,
+   std::shared_ptr<ElfSectionDataCache> sectionDataCache, CString& errorText);
@@ -0,0 +1,66 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfDynamic.cpp
+/// \brief ELF dynamic section and symbol versioning definitions
+//
+#include "stdafx.h"
+#include "ElfDynamic.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapElfDynamicTagToDisplayText =
+{
+   { 0, _T("DT_NULL") },
+   { 1, _T("DT_NEEDED") },
+   { 2, _T("DT_PLTRELSZ") },
+   { 3, _T("DT_PLTGOT") },
+   { 4, _T("DT_HASH") },
+   { 5, _T("DT_STRTAB") },
+   { 6, _T("DT_SYMTAB") },
+   { 7, _T("DT_RELA") },
+   { 8, _T("DT_RELASZ") },
+   { 9, _T("DT_RELAENT") },
+   { 10, _T("DT_STRSZ") },
+   { 11, _T("DT_SYMENT") },
+   { 12, _T("DT_INIT") },
+   { 13, _T("DT_FINI") },
+   { 14, _T("DT_SONAME") },
+   { 15, _T("DT_RPATH") },
+   { 16, _T("DT_SYMBOLIC") },
+   { 17, _T("DT_REL") },
+   { 18, _T("DT_RELSZ") },
+   { 19, _T("DT_RELENT") },
+   { 20, _T("DT_PLTREL") },
+   { 21, _T("DT_DEBUG") },
+   { 22, _T("DT_TEXTREL") },
+   { 23, _T("DT_JMPREL") },
+   { 24, _T("DT_BIND_NOW") },
+   { 25, _T("DT_INIT_ARRAY") },
+   { 26, _T("DT_FINI_ARRAY") },
+   { 27, _T("DT_INIT_ARRAYSZ") },
+   { 28, _T("DT_FINI_ARRAYSZ") },
+   { 29, _T("DT_RUNPATH") },
+   { 30, _T("DT_FLAGS") },
+   { 32, _T("DT_PREINIT_ARRAY") },
+   { 33, _T("DT_PREINIT_ARRAYSZ") },
+   { 34, _T("DT_SYMTAB_SHNDX") },
+   { 35, _T("DT_RELRSZ") },
+   { 36, _T("DT_RELR") },
+   { 37, _T("DT_RELRENT") },
+   { 0x6ffffef5, _T("DT_GNU_HASH") },
+   { 0x6ffffff0, _T("DT_VERSYM") },
+   { 0x6ffffff9, _T("DT_RELACOUNT") },
+   { 0x6ffffffa, _T("DT_RELCOUNT") },
+   { 0x6ffffffb, _T("DT_FLAGS_1") },
+   { 0x6ffffffc, _T("DT_VERDEF") },
+   { 0x6ffffffd, _T("DT_VERDEFNUM") },
+   { 0x6ffffffe, _T("DT_VERNEED") },
+   { 0x6fffffff, _T("DT_VERNEEDNUM") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfVersionFlagsToDisplayText =
+{
+   { 0x1, _T("VER_FLG_BASE") },
+   { 0x2, _T("VER_FLG_WEAK") },
+   { 0x4, _T("VER_FLG_INFO") },
+};
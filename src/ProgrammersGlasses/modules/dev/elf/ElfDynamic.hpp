@@ -0,0 +1,119 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfDynamic.hpp
+/// \brief ELF dynamic section and symbol versioning definitions
+//
+#pragma once
+
+#include "StructDefinition.hpp"
+
+#pragma pack(push, 1)
+
+/// \brief ELF dynamic section entry, for 32-bit files
+/// \see https://refspecs.linuxfoundation.org/elf/gabi4+/ch5.dynamic.html
+struct Elf32Dynamic
+{
+   LONG tag;                     ///< entry tag; DT_* value
+   DWORD value;                  ///< integer value or address, depending on the tag
+};
+
+/// \brief ELF dynamic section entry, for 64-bit files
+struct Elf64Dynamic
+{
+   LONGLONG tag;                 ///< entry tag; DT_* value
+   ULONGLONG value;              ///< integer value or address, depending on the tag
+};
+
+/// \brief Version definition entry in .gnu.version_d; same for both classes
+/// \see https://refspecs.linuxfoundation.org/LSB_5.0.0/LSB-Core-generic/LSB-Core-generic/symversion.html
+struct ElfVersionDefinitionEntry
+{
+   WORD version;                 ///< structure version; always 1
+   WORD flags;                   ///< version flags; VER_FLG_* values
+   WORD index;                   ///< version index, as used in .gnu.version
+   WORD auxCount;                ///< number of auxiliary entries
+   DWORD hash;                   ///< hash value of the version name
+   DWORD auxOffset;              ///< offset of first auxiliary entry, relative to this entry
+   DWORD nextOffset;             ///< offset of next entry, relative to this entry; 0 for the last entry
+};
+
+/// \brief Version definition auxiliary entry; the first one contains the
+/// version name, all others the parent versions
+struct ElfVersionDefinitionAux
+{
+   DWORD name;                   ///< offset of the name in the linked string table
+   DWORD nextOffset;             ///< offset of next entry, relative to this entry; 0 for the last entry
+};
+
+/// \brief Version requirement entry in .gnu.version_r; same for both classes
+struct ElfVersionRequirementEntry
+{
+   WORD version;                 ///< structure version; always 1
+   WORD auxCount;                ///< number of auxiliary entries
+   DWORD file;                   ///< offset of the file name in the linked string table
+   DWORD auxOffset;              ///< offset of first auxiliary entry, relative to this entry
+   DWORD nextOffset;             ///< offset of next entry, relative to this entry; 0 for the last entry
+};
+
+/// \brief Version requirement auxiliary entry, one for each required version
+struct ElfVersionRequirementAux
+{
+   DWORD hash;                   ///< hash value of the version name
+   WORD flags;                   ///< version flags; VER_FLG_* values
+   WORD other;                   ///< version index, as used in .gnu.version
+   DWORD name;                   ///< offset of the version name in the linked string table
+   DWORD nextOffset;             ///< offset of next entry, relative to this entry; 0 for the last entry
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(Elf32Dynamic) == 8, "ELF32 dynamic entry must be 8 bytes long");
+static_assert(sizeof(Elf64Dynamic) == 16, "ELF64 dynamic entry must be 16 bytes long");
+static_assert(sizeof(ElfVersionDefinitionEntry) == 20, "Version definition entry must be 20 bytes long");
+static_assert(sizeof(ElfVersionDefinitionAux) == 8, "Version definition aux entry must be 8 bytes long");
+static_assert(sizeof(ElfVersionRequirementEntry) == 16, "Version requirement entry must be 16 bytes long");
+static_assert(sizeof(ElfVersionRequirementAux) == 16, "Version requirement aux entry must be 16 bytes long");
+
+/// SHT_DYNAMIC: dynamic linking information
+constexpr DWORD c_elfSectionTypeDynamic = 6;
+
+/// SHT_GNU_verdef: version definitions
+constexpr DWORD c_elfSectionTypeVersionDefinitions = 0x6ffffffd;
+
+/// SHT_GNU_verneed: version requirements
+constexpr DWORD c_elfSectionTypeVersionRequirements = 0x6ffffffe;
+
+/// SHT_GNU_versym: version index for each dynamic symbol
+constexpr DWORD c_elfSectionTypeVersionSymbols = 0x6fffffff;
+
+/// DT_NULL: marks the end of the dynamic section
+constexpr LONGLONG c_elfDynamicTagNull = 0;
+
+/// DT_NEEDED: name of a needed library
+constexpr LONGLONG c_elfDynamicTagNeeded = 1;
+
+/// DT_SONAME: shared object name
+constexpr LONGLONG c_elfDynamicTagSharedObjectName = 14;
+
+/// DT_RPATH: library search path; deprecated
+constexpr LONGLONG c_elfDynamicTagRPath = 15;
+
+/// DT_RUNPATH: library search path
+constexpr LONGLONG c_elfDynamicTagRunPath = 29;
+
+/// VER_NDX_LOCAL: symbol is local
+constexpr WORD c_elfVersionIndexLocal = 0;
+
+/// VER_NDX_GLOBAL: symbol is global, without a version
+constexpr WORD c_elfVersionIndexGlobal = 1;
+
+/// bit in a .gnu.version entry that marks a hidden symbol version
+constexpr WORD c_elfVersionHidden = 0x8000;
+
+/// mapping of ELF dynamic section tag to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfDynamicTagToDisplayText;
+
+/// mapping of ELF version flags to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfVersionFlagsToDisplayText;
@@ -0,0 +1,559 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfHeader.cpp
+/// \brief ELF header, section header and program header definitions
+//
+#include "stdafx.h"
+#include "ElfHeader.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapElfClassToDisplayText =
+{
+   { 0, _T("ELFCLASSNONE") },
+   { 1, _T("ELFCLASS32") },
+   { 2, _T("ELFCLASS64") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfDataEncodingToDisplayText =
+{
+   { 0, _T("ELFDATANONE") },
+   { 1, _T("ELFDATA2LSB (little-endian)") },
+   { 2, _T("ELFDATA2MSB (big-endian)") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfOsAbiToDisplayText =
+{
+   { 0, _T("ELFOSABI_NONE (System V)") },
+   { 1, _T("ELFOSABI_HPUX") },
+   { 2, _T("ELFOSABI_NETBSD") },
+   { 3, _T("ELFOSABI_GNU") },
+   { 6, _T("ELFOSABI_SOLARIS") },
+   { 7, _T("ELFOSABI_AIX") },
+   { 8, _T("ELFOSABI_IRIX") },
+   { 9, _T("ELFOSABI_FREEBSD") },
+   { 10, _T("ELFOSABI_TRU64") },
+   { 11, _T("ELFOSABI_MODESTO") },
+   { 12, _T("ELFOSABI_OPENBSD") },
+   { 13, _T("ELFOSABI_OPENVMS") },
+   { 14, _T("ELFOSABI_NSK") },
+   { 64, _T("ELFOSABI_ARM_AEABI") },
+   { 97, _T("ELFOSABI_ARM") },
+   { 255, _T("ELFOSABI_STANDALONE") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfTypeToDisplayText =
+{
+   { 0, _T("ET_NONE (No file type)") },
+   { 1, _T("ET_REL (Relocatable file)") },
+   { 2, _T("ET_EXEC (Executable file)") },
+   { 3, _T("ET_DYN (Shared object file)") },
+   { 4, _T("ET_CORE (Core file)") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfMachineToDisplayText =
+{
+   { 0, _T("EM_NONE") },
+   { 2, _T("EM_SPARC") },
+   { 3, _T("EM_386 (Intel 80386)") },
+   { 4, _T("EM_68K (Motorola 68000)") },
+   { 8, _T("EM_MIPS") },
+   { 10, _T("EM_MIPS_RS3_LE") },
+   { 15, _T("EM_PARISC") },
+   { 18, _T("EM_SPARC32PLUS") },
+   { 20, _T("EM_PPC (PowerPC)") },
+   { 21, _T("EM_PPC64 (PowerPC 64-bit)") },
+   { 22, _T("EM_S390 (IBM S/390)") },
+   { 40, _T("EM_ARM") },
+   { 42, _T("EM_SH (Hitachi SuperH)") },
+   { 43, _T("EM_SPARCV9") },
+   { 50, _T("EM_IA_64 (Intel Itanium)") },
+   { 62, _T("EM_X86_64 (AMD x86-64)") },
+   { 83, _T("EM_AVR") },
+   { 94, _T("EM_XTENSA") },
+   { 164, _T("EM_QDSP6 (Qualcomm Hexagon)") },
+   { 183, _T("EM_AARCH64 (ARM 64-bit)") },
+   { 190, _T("EM_CUDA (NVIDIA CUDA)") },
+   { 224, _T("EM_AMDGPU") },
+   { 243, _T("EM_RISCV") },
+   { 247, _T("EM_BPF (Linux BPF)") },
+   { 258, _T("EM_LOONGARCH") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfSectionTypeToDisplayText =
+{
+   { 0, _T("SHT_NULL") },
+   { 1, _T("SHT_PROGBITS") },
+   { 2, _T("SHT_SYMTAB") },
+   { 3, _T("SHT_STRTAB") },
+   { 4, _T("SHT_RELA") },
+   { 5, _T("SHT_HASH") },
+   { 6, _T("SHT_DYNAMIC") },
+   { 7, _T("SHT_NOTE") },
+   { 8, _T("SHT_NOBITS") },
+   { 9, _T("SHT_REL") },
+   { 10, _T("SHT_SHLIB") },
+   { 11, _T("SHT_DYNSYM") },
+   { 14, _T("SHT_INIT_ARRAY") },
+   { 15, _T("SHT_FINI_ARRAY") },
+   { 16, _T("SHT_PREINIT_ARRAY") },
+   { 17, _T("SHT_GROUP") },
+   { 18, _T("SHT_SYMTAB_SHNDX") },
+   { 19, _T("SHT_RELR") },
+   { 0x60000001, _T("SHT_ANDROID_REL") },
+   { 0x60000002, _T("SHT_ANDROID_RELA") },
+   { 0x6fff4c00, _T("SHT_LLVM_ODRTAB") },
+   { 0x6fff4c01, _T("SHT_LLVM_LINKER_OPTIONS") },
+   { 0x6fff4c03, _T("SHT_LLVM_ADDRSIG") },
+   { 0x6fff4c04, _T("SHT_LLVM_DEPENDENT_LIBRARIES") },
+   { 0x6fff4c05, _T("SHT_LLVM_SYMPART") },
+   { 0x6fff4c0c, _T("SHT_LLVM_BB_ADDR_MAP") },
+   { 0x6ffffff5, _T("SHT_GNU_ATTRIBUTES") },
+   { 0x6ffffff6, _T("SHT_GNU_HASH") },
+   { 0x6ffffff7, _T("SHT_GNU_LIBLIST") },
+   { 0x6ffffffd, _T("SHT_GNU_verdef") },
+   { 0x6ffffffe, _T("SHT_GNU_verneed") },
+   { 0x6fffffff, _T("SHT_GNU_versym") },
+   { 0x70000001, _T("SHT_X86_64_UNWIND / SHT_ARM_EXIDX") },
+   { 0x70000003, _T("SHT_ARM_ATTRIBUTES / SHT_RISCV_ATTRIBUTES") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfSectionFlagsToDisplayText =
+{
+   { 0x00000001, _T("SHF_WRITE") },
+   { 0x00000002, _T("SHF_ALLOC") },
+   { 0x00000004, _T("SHF_EXECINSTR") },
+   { 0x00000010, _T("SHF_MERGE") },
+   { 0x00000020, _T("SHF_STRINGS") },
+   { 0x00000040, _T("SHF_INFO_LINK") },
+   { 0x00000080, _T("SHF_LINK_ORDER") },
+   { 0x00000100, _T("SHF_OS_NONCONFORMING") },
+   { 0x00000200, _T("SHF_GROUP") },
+   { 0x00000400, _T("SHF_TLS") },
+   { 0x00000800, _T("SHF_COMPRESSED") },
+   { 0x00200000, _T("SHF_GNU_RETAIN") },
+   { 0x40000000, _T("SHF_ORDERED") },
+   { 0x80000000, _T("SHF_EXCLUDE") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfSegmentTypeToDisplayText =
+{
+   { 0, _T("PT_NULL") },
+   { 1, _T("PT_LOAD") },
+   { 2, _T("PT_DYNAMIC") },
+   { 3, _T("PT_INTERP") },
+   { 4, _T("PT_NOTE") },
+   { 5, _T("PT_SHLIB") },
+   { 6, _T("PT_PHDR") },
+   { 7, _T("PT_TLS") },
+   { 0x6474e550, _T("PT_GNU_EH_FRAME") },
+   { 0x6474e551, _T("PT_GNU_STACK") },
+   { 0x6474e552, _T("PT_GNU_RELRO") },
+   { 0x6474e553, _T("PT_GNU_PROPERTY") },
+   { 0x6474e554, _T("PT_GNU_SFRAME") },
+   { 0x65a3dbe6, _T("PT_OPENBSD_RANDOMIZE") },
+   { 0x65a3dbe7, _T("PT_OPENBSD_WXNEEDED") },
+   { 0x70000000, _T("PT_MIPS_REGINFO") },
+   { 0x70000001, _T("PT_ARM_EXIDX / PT_MIPS_RTPROC") },
+   { 0x70000003, _T("PT_MIPS_ABIFLAGS / PT_RISCV_ATTRIBUTES") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfSegmentFlagsToDisplayText =
+{
+   { 0x00000001, _T("PF_X") },
+   { 0x00000002, _T("PF_W") },
+   { 0x00000004, _T("PF_R") },
+};
+
+/// \brief Creates a struct field that maps the low 32 bits of a value
+/// \details Flags fields of 64-bit structs are 8 bytes long, but only the low
+/// 32 bits are defined and can be formatted with a flags mapping.
+static StructField CreateLowDwordFlagsField(size_t offset, size_t length,
+   bool littleEndian, const std::map<DWORD, LPCTSTR>& flagsMapping, LPCTSTR description)
+{
+   size_t lowDwordOffset = offset + (littleEndian ? 0 : length - sizeof(DWORD));
+
+   return StructField(
+      lowDwordOffset,
+      sizeof(DWORD),
+      4,
+      littleEndian,
+      StructFieldType::flagsMapping,
+      flagsMapping,
+      description);
+}
+
+/// creates the struct definition for ELF32 or ELF64 headers
+template <typename TElfHeader>
+static StructDefinition CreateElfHeaderDefinition(bool littleEndian)
+{
+   return StructDefinition({
+      StructField(
+         offsetof(TElfHeader, ident),
+         4,
+         1,
+         true, // little-endian
+         StructFieldType::byteArray,
+         _T("Magic")),
+
+      StructField(
+         offsetof(TElfHeader, ident) + c_elfIdentClass,
+         1,
+         1,
+         true, // little-endian
+         StructFieldType::valueMapping,
+         g_mapElfClassToDisplayText,
+         _T("Class")),
+
+      StructField(
+         offsetof(TElfHeader, ident) + c_elfIdentData,
+         1,
+         1,
+         true, // little-endian
+         StructFieldType::valueMapping,
+         g_mapElfDataEncodingToDisplayText,
+         _T("Data encoding")),
+
+      StructField(
+         offsetof(TElfHeader, ident) + 6,
+         1,
+         1,
+         true, // little-endian
+         StructFieldType::unsignedInteger,
+         _T("Ident version")),
+
+      StructField(
+         offsetof(TElfHeader, ident) + 7,
+         1,
+         1,
+         true, // little-endian
+         StructFieldType::valueMapping,
+         g_mapElfOsAbiToDisplayText,
+         _T("OS ABI")),
+
+      StructField(
+         offsetof(TElfHeader, ident) + 8,
+         1,
+         1,
+         true, // little-endian
+         StructFieldType::unsignedInteger,
+         _T("ABI version")),
+
+      StructField(
+         offsetof(TElfHeader, type),
+         sizeof(TElfHeader::type),
+         2,
+         littleEndian,
+         StructFieldType::valueMapping,
+         g_mapElfTypeToDisplayText,
+         _T("Type")),
+
+      StructField(
+         offsetof(TElfHeader, machine),
+         sizeof(TElfHeader::machine),
+         2,
+         littleEndian,
+         StructFieldType::valueMapping,
+         g_mapElfMachineToDisplayText,
+         _T("Machine")),
+
+      StructField(
+         offsetof(TElfHeader, version),
+         sizeof(TElfHeader::version),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Version")),
+
+      StructField(
+         offsetof(TElfHeader, entry),
+         sizeof(TElfHeader::entry),
+         sizeof(TElfHeader::entry),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Entry point address")),
+
+      StructField(
+         offsetof(TElfHeader, programHeaderOffset),
+         sizeof(TElfHeader::programHeaderOffset),
+         sizeof(TElfHeader::programHeaderOffset),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Program header table offset")),
+
+      StructField(
+         offsetof(TElfHeader, sectionHeaderOffset),
+         sizeof(TElfHeader::sectionHeaderOffset),
+         sizeof(TElfHeader::sectionHeaderOffset),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Section header table offset")),
+
+      StructField(
+         offsetof(TElfHeader, flags),
+         sizeof(TElfHeader::flags),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Processor specific flags")),
+
+      StructField(
+         offsetof(TElfHeader, headerSize),
+         sizeof(TElfHeader::headerSize),
+         2,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("ELF header size")),
+
+      StructField(
+         offsetof(TElfHeader, programHeaderEntrySize),
+         sizeof(TElfHeader::programHeaderEntrySize),
+         2,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Program header entry size")),
+
+      StructField(
+         offsetof(TElfHeader, programHeaderCount),
+         sizeof(TElfHeader::programHeaderCount),
+         2,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Number of program headers")),
+
+      StructField(
+         offsetof(TElfHeader, sectionHeaderEntrySize),
+         sizeof(TElfHeader::sectionHeaderEntrySize),
+         2,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Section header entry size")),
+
+      StructField(
+         offsetof(TElfHeader, sectionHeaderCount),
+         sizeof(TElfHeader::sectionHeaderCount),
+         2,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Number of section headers")),
+
+      StructField(
+         offsetof(TElfHeader, sectionNameIndex),
+         sizeof(TElfHeader::sectionNameIndex),
+         2,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Section name string table index")),
+   });
+}
+
+/// creates the struct definition for ELF32 or ELF64 section headers
+template <typename TSectionHeader>
+static StructDefinition CreateElfSectionHeaderDefinition(bool littleEndian)
+{
+   return StructDefinition({
+      StructField(
+         offsetof(TSectionHeader, name),
+         sizeof(TSectionHeader::name),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Name offset")),
+
+      StructField(
+         offsetof(TSectionHeader, type),
+         sizeof(TSectionHeader::type),
+         4,
+         littleEndian,
+         StructFieldType::valueMapping,
+         g_mapElfSectionTypeToDisplayText,
+         _T("Type")),
+
+      CreateLowDwordFlagsField(
+         offsetof(TSectionHeader, flags),
+         sizeof(TSectionHeader::flags),
+         littleEndian,
+         g_mapElfSectionFlagsToDisplayText,
+         _T("Flags")),
+
+      StructField(
+         offsetof(TSectionHeader, address),
+         sizeof(TSectionHeader::address),
+         sizeof(TSectionHeader::address),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Virtual address")),
+
+      StructField(
+         offsetof(TSectionHeader, offset),
+         sizeof(TSectionHeader::offset),
+         sizeof(TSectionHeader::offset),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("File offset")),
+
+      StructField(
+         offsetof(TSectionHeader, size),
+         sizeof(TSectionHeader::size),
+         sizeof(TSectionHeader::size),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Size")),
+
+      StructField(
+         offsetof(TSectionHeader, link),
+         sizeof(TSectionHeader::link),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Link")),
+
+      StructField(
+         offsetof(TSectionHeader, info),
+         sizeof(TSectionHeader::info),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Info")),
+
+      StructField(
+         offsetof(TSectionHeader, addressAlign),
+         sizeof(TSectionHeader::addressAlign),
+         sizeof(TSectionHeader::addressAlign),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Address alignment")),
+
+      StructField(
+         offsetof(TSectionHeader, entrySize),
+         sizeof(TSectionHeader::entrySize),
+         sizeof(TSectionHeader::entrySize),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Entry size")),
+   });
+}
+
+/// creates the struct definition for ELF32 or ELF64 program headers
+template <typename TProgramHeader>
+static StructDefinition CreateElfProgramHeaderDefinition(bool littleEndian)
+{
+   return StructDefinition({
+      StructField(
+         offsetof(TProgramHeader, type),
+         sizeof(TProgramHeader::type),
+         4,
+         littleEndian,
+         StructFieldType::valueMapping,
+         g_mapElfSegmentTypeToDisplayText,
+         _T("Type")),
+
+      StructField(
+         offsetof(TProgramHeader, flags),
+         sizeof(TProgramHeader::flags),
+         4,
+         littleEndian,
+         StructFieldType::flagsMapping,
+         g_mapElfSegmentFlagsToDisplayText,
+         _T("Flags")),
+
+      StructField(
+         offsetof(TProgramHeader, offset),
+         sizeof(TProgramHeader::offset),
+         sizeof(TProgramHeader::offset),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("File offset")),
+
+      StructField(
+         offsetof(TProgramHeader, virtualAddress),
+         sizeof(TProgramHeader::virtualAddress),
+         sizeof(TProgramHeader::virtualAddress),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Virtual address")),
+
+      StructField(
+         offsetof(TProgramHeader, physicalAddress),
+         sizeof(TProgramHeader::physicalAddress),
+         sizeof(TProgramHeader::physicalAddress),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Physical address")),
+
+      StructField(
+         offsetof(TProgramHeader, fileSize),
+         sizeof(TProgramHeader::fileSize),
+         sizeof(TProgramHeader::fileSize),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("File size")),
+
+      StructField(
+         offsetof(TProgramHeader, memorySize),
+         sizeof(TProgramHeader::memorySize),
+         sizeof(TProgramHeader::memorySize),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Memory size")),
+
+      StructField(
+         offsetof(TProgramHeader, align),
+         sizeof(TProgramHeader::align),
+         sizeof(TProgramHeader::align),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Alignment")),
+   });
+}
+
+const StructDefinition& GetElfHeaderDefinition(bool is64Bit, bool littleEndian)
+{
+   static const StructDefinition definitions[2][2] =
+   {
+      {
+         CreateElfHeaderDefinition<Elf32Header>(false),
+         CreateElfHeaderDefinition<Elf32Header>(true),
+      },
+      {
+         CreateElfHeaderDefinition<Elf64Header>(false),
+         CreateElfHeaderDefinition<Elf64Header>(true),
+      },
+   };
+
+   return definitions[is64Bit ? 1 : 0][littleEndian ? 1 : 0];
+}
+
+const StructDefinition& GetElfSectionHeaderDefinition(bool is64Bit, bool littleEndian)
+{
+   static const StructDefinition definitions[2][2] =
+   {
+      {
+         CreateElfSectionHeaderDefinition<Elf32SectionHeader>(false),
+         CreateElfSectionHeaderDefinition<Elf32SectionHeader>(true),
+      },
+      {
+         CreateElfSectionHeaderDefinition<Elf64SectionHeader>(false),
+         CreateElfSectionHeaderDefinition<Elf64SectionHeader>(true),
+      },
+   };
+
+   return definitions[is64Bit ? 1 : 0][littleEndian ? 1 : 0];
+}
+
+const StructDefinition& GetElfProgramHeaderDefinition(bool is64Bit, bool littleEndian)
+{
+   static const StructDefinition definitions[2][2] =
+   {
+      {
+         CreateElfProgramHeaderDefinition<Elf32ProgramHeader>(false),
+         CreateElfProgramHeaderDefinition<Elf32ProgramHeader>(true),
+      },
+      {
+         CreateElfProgramHeaderDefinition<Elf64ProgramHeader>(false),
+         CreateElfProgramHeaderDefinition<Elf64ProgramHeader>(true),
+      },
+   };
+
+   return definitions[is64Bit ? 1 : 0][littleEndian ? 1 : 0];
+}
@@ -0,0 +1,184 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfHeader.hpp
+/// \brief ELF header, section header and program header definitions
+//
+#pragma once
+
+#include "StructDefinition.hpp"
+
+#pragma pack(push, 1)
+
+/// \brief ELF header, for 32-bit files
+/// \see https://refspecs.linuxfoundation.org/elf/gabi4+/ch4.eheader.html
+struct Elf32Header
+{
+   BYTE ident[16];               ///< identification bytes; magic, class, data encoding, etc.
+   WORD type;                    ///< object file type; ET_* value
+   WORD machine;                 ///< target machine; EM_* value
+   DWORD version;                ///< object file version
+   DWORD entry;                  ///< entry point virtual address
+   DWORD programHeaderOffset;    ///< file offset of program header table
+   DWORD sectionHeaderOffset;    ///< file offset of section header table
+   DWORD flags;                  ///< processor specific flags
+   WORD headerSize;              ///< ELF header size, in bytes
+   WORD programHeaderEntrySize;  ///< size of a program header table entry
+   WORD programHeaderCount;      ///< number of program header table entries
+   WORD sectionHeaderEntrySize;  ///< size of a section header table entry
+   WORD sectionHeaderCount;      ///< number of section header table entries
+   WORD sectionNameIndex;        ///< section header index of the section name string table
+};
+
+/// \brief ELF header, for 64-bit files
+struct Elf64Header
+{
+   BYTE ident[16];               ///< identification bytes; magic, class, data encoding, etc.
+   WORD type;                    ///< object file type; ET_* value
+   WORD machine;                 ///< target machine; EM_* value
+   DWORD version;                ///< object file version
+   ULONGLONG entry;              ///< entry point virtual address
+   ULONGLONG programHeaderOffset;   ///< file offset of program header table
+   ULONGLONG sectionHeaderOffset;   ///< file offset of section header table
+   DWORD flags;                  ///< processor specific flags
+   WORD headerSize;              ///< ELF header size, in bytes
+   WORD programHeaderEntrySize;  ///< size of a program header table entry
+   WORD programHeaderCount;      ///< number of program header table entries
+   WORD sectionHeaderEntrySize;  ///< size of a section header table entry
+   WORD sectionHeaderCount;      ///< number of section header table entries
+   WORD sectionNameIndex;        ///< section header index of the section name string table
+};
+
+/// \brief ELF section header, for 32-bit files
+/// \see https://refspecs.linuxfoundation.org/elf/gabi4+/ch4.sheader.html
+struct Elf32SectionHeader
+{
+   DWORD name;                   ///< offset of the name in the section name string table
+   DWORD type;                   ///< section type; SHT_* value
+   DWORD flags;                  ///< section flags; SHF_* values
+   DWORD address;                ///< virtual address of section in memory
+   DWORD offset;                 ///< file offset of section data
+   DWORD size;                   ///< section size, in bytes
+   DWORD link;                   ///< section header index link; meaning depends on type
+   DWORD info;                   ///< extra info; meaning depends on type
+   DWORD addressAlign;           ///< address alignment
+   DWORD entrySize;              ///< size of table entries, for sections containing tables
+};
+
+/// \brief ELF section header, for 64-bit files
+struct Elf64SectionHeader
+{
+   DWORD name;                   ///< offset of the name in the section name string table
+   DWORD type;                   ///< section type; SHT_* value
+   ULONGLONG flags;              ///< section flags; SHF_* values
+   ULONGLONG address;            ///< virtual address of section in memory
+   ULONGLONG offset;             ///< file offset of section data
+   ULONGLONG size;               ///< section size, in bytes
+   DWORD link;                   ///< section header index link; meaning depends on type
+   DWORD info;                   ///< extra info; meaning depends on type
+   ULONGLONG addressAlign;       ///< address alignment
+   ULONGLONG entrySize;          ///< size of table entries, for sections containing tables
+};
+
+/// \brief ELF program header, for 32-bit files
+/// \see https://refspecs.linuxfoundation.org/elf/gabi4+/ch5.pheader.html
+struct Elf32ProgramHeader
+{
+   DWORD type;                   ///< segment type; PT_* value
+   DWORD offset;                 ///< file offset of segment data
+   DWORD virtualAddress;         ///< virtual address of segment in memory
+   DWORD physicalAddress;        ///< physical address, on systems where relevant
+   DWORD fileSize;               ///< size of segment data in the file
+   DWORD memorySize;             ///< size of segment in memory
+   DWORD flags;                  ///< segment flags; PF_* values
+   DWORD align;                  ///< segment alignment
+};
+
+/// \brief ELF program header, for 64-bit files
+struct Elf64ProgramHeader
+{
+   DWORD type;                   ///< segment type; PT_* value
+   DWORD flags;                  ///< segment flags; PF_* values
+   ULONGLONG offset;             ///< file offset of segment data
+   ULONGLONG virtualAddress;     ///< virtual address of segment in memory
+   ULONGLONG physicalAddress;    ///< physical address, on systems where relevant
+   ULONGLONG fileSize;           ///< size of segment data in the file
+   ULONGLONG memorySize;         ///< size of segment in memory
+   ULONGLONG align;              ///< segment alignment
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(Elf32Header) == 52, "ELF32 header must be 52 bytes long");
+static_assert(sizeof(Elf64Header) == 64, "ELF64 header must be 64 bytes long");
+static_assert(sizeof(Elf32SectionHeader) == 40, "ELF32 section header must be 40 bytes long");
+static_assert(sizeof(Elf64SectionHeader) == 64, "ELF64 section header must be 64 bytes long");
+static_assert(sizeof(Elf32ProgramHeader) == 32, "ELF32 program header must be 32 bytes long");
+static_assert(sizeof(Elf64ProgramHeader) == 56, "ELF64 program header must be 56 bytes long");
+
+/// index of the class byte in the ident bytes
+constexpr size_t c_elfIdentClass = 4;
+
+/// index of the data encoding byte in the ident bytes
+constexpr size_t c_elfIdentData = 5;
+
+/// ELFCLASS32: 32-bit objects
+constexpr BYTE c_elfClass32 = 1;
+
+/// ELFCLASS64: 64-bit objects
+constexpr BYTE c_elfClass64 = 2;
+
+/// ELFDATA2LSB: little-endian data encoding
+constexpr BYTE c_elfDataLsb = 1;
+
+/// ELFDATA2MSB: big-endian data encoding
+constexpr BYTE c_elfDataMsb = 2;
+
+/// SHN_UNDEF: undefined section index
+constexpr WORD c_elfSectionIndexUndefined = 0;
+
+/// SHN_LORESERVE: start of reserved section indices
+constexpr WORD c_elfSectionIndexLoReserve = 0xff00;
+
+/// SHN_XINDEX: the real section index is stored elsewhere
+constexpr WORD c_elfSectionIndexExtended = 0xffff;
+
+/// PN_XNUM: the real program header count is stored in section header 0
+constexpr WORD c_elfProgramHeaderCountExtended = 0xffff;
+
+/// mapping of ELF class to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfClassToDisplayText;
+
+/// mapping of ELF data encoding to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfDataEncodingToDisplayText;
+
+/// mapping of ELF OS ABI to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfOsAbiToDisplayText;
+
+/// mapping of ELF object file type to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfTypeToDisplayText;
+
+/// mapping of ELF machine to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfMachineToDisplayText;
+
+/// mapping of ELF section type to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfSectionTypeToDisplayText;
+
+/// mapping of ELF section flags to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfSectionFlagsToDisplayText;
+
+/// mapping of ELF segment type to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfSegmentTypeToDisplayText;
+
+/// mapping of ELF segment flags to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfSegmentFlagsToDisplayText;
+
+/// returns struct definition for the ELF header with given class and data encoding
+const StructDefinition& GetElfHeaderDefinition(bool is64Bit, bool littleEndian);
+
+/// returns struct definition for an ELF section header with given class and data encoding
+const StructDefinition& GetElfSectionHeaderDefinition(bool is64Bit, bool littleEndian);
+
+/// returns struct definition for an ELF program header with given class and data encoding
+const StructDefinition& GetElfProgramHeaderDefinition(bool is64Bit, bool littleEndian);
@@ -0,0 +1,281 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfImage.cpp
+/// \brief ELF image, with section and program header access
+//
+#include "stdafx.h"
+#include "ElfImage.hpp"
+
+/// SHT_NOBITS: section occupies no space in the file
+constexpr DWORD c_elfSectionTypeNoBits = 8;
+
+/// PT_LOAD: loadable segment
+constexpr DWORD c_elfSegmentTypeLoad = 1;
+
+ElfImage::ElfImage(const File& file, bool decodeSectionHeaders)
+   :m_file(file),
+   m_decodeSectionHeaders(decodeSectionHeaders)
+{
+   if (m_file.Size() < sizeof(Elf32Header))
+   {
+      m_errorText = _T("File is too small for an ELF header");
+      return;
+   }
+
+   const BYTE* ident = m_file.Data<BYTE>();
+   if (ident[0] != 0x7F || ident[1] != 'E' || ident[2] != 'L' || ident[3] != 'F')
+   {
+      m_errorText = _T("Invalid ELF magic bytes");
+      return;
+   }
+
+   BYTE elfClass = ident[c_elfIdentClass];
+   BYTE elfData = ident[c_elfIdentData];
+
+   if ((elfClass != c_elfClass32 && elfClass != c_elfClass64) ||
+      (elfData != c_elfDataLsb && elfData != c_elfDataMsb))
+   {
+      m_errorText = _T("Unknown ELF class or data encoding");
+      return;
+   }
+
+   m_is64Bit = elfClass == c_elfClass64;
+   m_isLittleEndian = elfData == c_elfDataLsb;
+
+   if (m_is64Bit && m_file.Size() < sizeof(Elf64Header))
+   {
+      m_errorText = _T("File is too small for an ELF64 header");
+      return;
+   }
+
+   m_isValid = Dispatch([&](auto layout) { return DecodeHeaders(layout); });
+}
+
+template <typename TLayout>
+bool ElfImage::DecodeHeaders(TLayout layout)
+{
+   const typename TLayout::Header& header = *m_file.Data<typename TLayout::Header>();
+
+   m_type = layout.Get(header.type);
+   m_machine = layout.Get(header.machine);
+   m_entryPoint = layout.Get(header.entry);
+
+   ULONGLONG sectionHeaderOffset = layout.Get(header.sectionHeaderOffset);
+   size_t sectionHeaderCount = layout.Get(header.sectionHeaderCount);
+   size_t sectionNameIndex = layout.Get(header.sectionNameIndex);
+   size_t programHeaderCount = layout.Get(header.programHeaderCount);
+
+   // section header 0 is still needed when the program header count is
+   // stored there; a count of 0 only decodes section header 0
+   bool decodeSectionHeaders = m_decodeSectionHeaders ||
+      programHeaderCount == c_elfProgramHeaderCountExtended;
+
+   if (sectionHeaderOffset != 0 &&
+      decodeSectionHeaders &&
+      !DecodeSectionHeaders(layout, sectionHeaderOffset,
+         layout.Get(header.sectionHeaderEntrySize),
+         m_decodeSectionHeaders ? sectionHeaderCount : 0))
+      return false;
+
+   // extended numbering: the real values are stored in section header 0
+   if (!m_sections.empty())
+   {
+      if (sectionHeaderCount == 0 && m_decodeSectionHeaders)
+      {
+         size_t extendedCount = static_cast<size_t>(m_sections[0].size);
+
+         if (extendedCount == 0)
+            m_sections.clear();
+         else if (!DecodeSectionHeaders(layout, sectionHeaderOffset,
+            layout.Get(header.sectionHeaderEntrySize), extendedCount))
+            return false;
+      }
+   }
+
+   if (!m_sections.empty())
+   {
+      if (sectionNameIndex == c_elfSectionIndexExtended)
+         sectionNameIndex = m_sections[0].link;
+
+      if (programHeaderCount == c_elfProgramHeaderCountExtended)
+         programHeaderCount = m_sections[0].info;
+
+      if (!m_decodeSectionHeaders)
+         m_sections.clear();
+   }
+
+   ULONGLONG programHeaderOffset = layout.Get(header.programHeaderOffset);
+   if (programHeaderOffset != 0 &&
+      !DecodeProgramHeaders(layout, programHeaderOffset,
+         layout.Get(header.programHeaderEntrySize), programHeaderCount))
+      return false;
+
+   if (sectionNameIndex != c_elfSectionIndexUndefined &&
+      sectionNameIndex < m_sections.size())
+   {
+      const ElfSection& sectionNames = m_sections[sectionNameIndex];
+
+      for (ElfSection& section : m_sections)
+      {
+         const typename TLayout::SectionHeader& sectionHeader =
+            *reinterpret_cast<const typename TLayout::SectionHeader*>(section.header);
+
+         section.name = GetString(sectionNames, layout.Get(sectionHeader.name));
+      }
+   }
+
+   return true;
+}
+
+template <typename TLayout>
+bool ElfImage::DecodeSectionHeaders(TLayout layout, ULONGLONG tableOffset,
+   size_t entrySize, size_t count)
+{
+   m_sections.clear();
+
+   // when the count is 0, the section header 0 is still read, since it may
+   // contain the real section count
+   size_t readCount = count == 0 ? 1 : count;
+
+   if (entrySize < sizeof(typename TLayout::SectionHeader) ||
+      tableOffset > m_file.Size() ||
+      readCount > (m_file.Size() - tableOffset) / entrySize)
+   {
+      m_errorText = _T("Section header table is outside of the file");
+      return false;
+   }
+
+   m_sections.reserve(readCount);
+
+   const BYTE* entry = m_file.Data<BYTE>(static_cast<size_t>(tableOffset));
+   for (size_t index = 0; index < readCount; index++, entry += entrySize)
+   {
+      const typename TLayout::SectionHeader& sectionHeader =
+         *reinterpret_cast<const typename TLayout::SectionHeader*>(entry);
+
+      ElfSection section;
+      section.index = index;
+      section.type = layout.Get(sectionHeader.type);
+      section.flags = layout.Get(sectionHeader.flags);
+      section.address = layout.Get(sectionHeader.address);
+      section.offset = layout.Get(sectionHeader.offset);
+      section.size = layout.Get(sectionHeader.size);
+      section.link = layout.Get(sectionHeader.link);
+      section.info = layout.Get(sectionHeader.info);
+      section.addressAlign = layout.Get(sectionHeader.addressAlign);
+      section.entrySize = layout.Get(sectionHeader.entrySize);
+      section.header = entry;
+
+      m_sections.push_back(section);
+   }
+
+   return true;
+}
+
+template <typename TLayout>
+bool ElfImage::DecodeProgramHeaders(TLayout layout, ULONGLONG tableOffset,
+   size_t entrySize, size_t count)
+{
+   if (count == 0)
+      return true;
+
+   if (entrySize < sizeof(typename TLayout::ProgramHeader) ||
+      tableOffset > m_file.Size() ||
+      count > (m_file.Size() - tableOffset) / entrySize)
+   {
+      m_errorText = _T("Program header table is outside of the file");
+      return false;
+   }
+
+   m_segments.reserve(count);
+
+   const BYTE* entry = m_file.Data<BYTE>(static_cast<size_t>(tableOffset));
+   for (size_t index = 0; index < count; index++, entry += entrySize)
+   {
+      const typename TLayout::ProgramHeader& programHeader =
+         *reinterpret_cast<const typename TLayout::ProgramHeader*>(entry);
+
+      ElfSegment segment;
+      segment.type = layout.Get(programHeader.type);
+      segment.flags = layout.Get(programHeader.flags);
+      segment.offset = layout.Get(programHeader.offset);
+      segment.virtualAddress = layout.Get(programHeader.virtualAddress);
+      segment.physicalAddress = layout.Get(programHeader.physicalAddress);
+      segment.fileSize = layout.Get(programHeader.fileSize);
+      segment.memorySize = layout.Get(programHeader.memorySize);
+      segment.align = layout.Get(programHeader.align);
+      segment.header = entry;
+
+      m_segments.push_back(segment);
+   }
+
+   return true;
+}
+
+const ElfSection* ElfImage::FindSection(LPCTSTR name) const
+{
+   for (const ElfSection& section : m_sections)
+   {
+      if (section.name == name)
+         return &section;
+   }
+
+   return nullptr;
+}
+
+const ElfSection* ElfImage::FindSectionByType(DWORD type) const
+{
+   for (const ElfSection& section : m_sections)
+   {
+      if (section.type == type)
+         return &section;
+   }
+
+   return nullptr;
+}
+
+const BYTE* ElfImage::SectionData(const ElfSection& section) const
+{
+   if (section.type == c_elfSectionTypeNoBits ||
+      section.offset > m_file.Size() ||
+      section.size > m_file.Size() - section.offset)
+      return nullptr;
+
+   return m_file.Data<BYTE>(static_cast<size_t>(section.offset));
+}
+
+CString ElfImage::GetString(const ElfSection& stringTable, size_t offset) const
+{
+   const BYTE* data = SectionData(stringTable);
+   if (data == nullptr ||
+      offset >= stringTable.size)
+      return CString();
+
+   const char* text = reinterpret_cast<const char*>(data + offset);
+   size_t length = strnlen(text, static_cast<size_t>(stringTable.size) - offset);
+
+   return CString(CA2T(CStringA(text, static_cast<int>(length)), CP_UTF8));
+}
+
+std::optional<size_t> ElfImage::AddressToFileOffset(ULONGLONG address, size_t size) const
+{
+   for (const ElfSegment& segment : m_segments)
+   {
+      if (segment.type != c_elfSegmentTypeLoad ||
+         address < segment.virtualAddress ||
+         address - segment.virtualAddress > segment.fileSize ||
+         size > segment.fileSize - (address - segment.virtualAddress))
+         continue;
+
+      ULONGLONG fileOffset = segment.offset + (address - segment.virtualAddress);
+      if (fileOffset > m_file.Size() ||
+         size > m_file.Size() - fileOffset)
+         return std::nullopt;
+
+      return static_cast<size_t>(fileOffset);
+   }
+
+   return std::nullopt;
+}
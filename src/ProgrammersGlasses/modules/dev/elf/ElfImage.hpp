@@ -0,0 +1,285 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfImage.hpp
+/// \brief ELF image, with section and program header access
+//
+#pragma once
+
+#include "ElfHeader.hpp"
+#include "ElfSymbol.hpp"
+#include "ElfDynamic.hpp"
+#include "ElfRelocation.hpp"
+#include "ElfCompression.hpp"
+#include "DataHelper.hpp"
+#include "File.hpp"
+#include <optional>
+
+/// \brief Types of 32-bit ELF files
+struct Elf32Class
+{
+   using Header = Elf32Header;                  ///< ELF header type
+   using SectionHeader = Elf32SectionHeader;    ///< section header type
+   using ProgramHeader = Elf32ProgramHeader;    ///< program header type
+   using Symbol = Elf32Symbol;                  ///< symbol table entry type
+   using Dynamic = Elf32Dynamic;                ///< dynamic section entry type
+   using Rel = Elf32Rel;                        ///< relocation entry type
+   using Rela = Elf32Rela;                      ///< relocation entry type, with addend
+   using CompressionHeader = Elf32CompressionHeader; ///< compression header type
+   using Address = DWORD;                       ///< address and offset type
+
+   /// indicates a 64-bit class
+   static constexpr bool is64Bit = false;
+
+   /// returns the symbol index of relocation info
+   static DWORD RelocationSymbol(Address info) { return info >> 8; }
+
+   /// returns the type of relocation info
+   static DWORD RelocationType(Address info) { return info & 0xff; }
+};
+
+/// \brief Types of 64-bit ELF files
+struct Elf64Class
+{
+   using Header = Elf64Header;                  ///< ELF header type
+   using SectionHeader = Elf64SectionHeader;    ///< section header type
+   using ProgramHeader = Elf64ProgramHeader;    ///< program header type
+   using Symbol = Elf64Symbol;                  ///< symbol table entry type
+   using Dynamic = Elf64Dynamic;                ///< dynamic section entry type
+   using Rel = Elf64Rel;                        ///< relocation entry type
+   using Rela = Elf64Rela;                      ///< relocation entry type, with addend
+   using CompressionHeader = Elf64CompressionHeader; ///< compression header type
+   using Address = ULONGLONG;                   ///< address and offset type
+
+   /// indicates a 64-bit class
+   static constexpr bool is64Bit = true;
+
+   /// returns the symbol index of relocation info
+   static DWORD RelocationSymbol(Address info) { return static_cast<DWORD>(info >> 32); }
+
+   /// returns the type of relocation info
+   static DWORD RelocationType(Address info) { return static_cast<DWORD>(info & 0xffffffff); }
+};
+
+/// \brief ELF file layout, for a class and data encoding
+/// \details All ELF structures are stored in the data encoding of the file.
+/// The layout selects the struct types and the byte order conversion at
+/// compile time, so that decoding loops instantiated for a layout don't
+/// contain any runtime checks for class or data encoding.
+template <typename TClass, bool littleEndian>
+struct ElfLayout : public TClass
+{
+   /// indicates a little-endian data encoding
+   static constexpr bool isLittleEndian = littleEndian;
+
+   /// converts a value from file to host byte order
+   template <typename T>
+   static T Get(T value)
+   {
+      if constexpr (littleEndian || sizeof(T) == 1)
+         return value;
+      else if constexpr (sizeof(T) == 2)
+         return static_cast<T>(SwapEndianness(static_cast<WORD>(value)));
+      else if constexpr (sizeof(T) == 4)
+         return static_cast<T>(SwapEndianness(static_cast<DWORD>(value)));
+      else
+         return static_cast<T>(SwapEndianness(static_cast<ULONGLONG>(value)));
+   }
+};
+
+/// \brief ELF section, with values converted to host byte order
+struct ElfSection
+{
+   /// section index
+   size_t index = 0;
+
+   /// section name
+   CString name;
+
+   /// section type; SHT_* value
+   DWORD type = 0;
+
+   /// section flags; SHF_* values
+   ULONGLONG flags = 0;
+
+   /// virtual address
+   ULONGLONG address = 0;
+
+   /// file offset of section data
+   ULONGLONG offset = 0;
+
+   /// section size
+   ULONGLONG size = 0;
+
+   /// link to another section
+   DWORD link = 0;
+
+   /// extra info
+   DWORD info = 0;
+
+   /// address alignment
+   ULONGLONG addressAlign = 0;
+
+   /// size of table entries
+   ULONGLONG entrySize = 0;
+
+   /// pointer to the section header in the file
+   const BYTE* header = nullptr;
+};
+
+/// \brief ELF segment, with values converted to host byte order
+struct ElfSegment
+{
+   /// segment type; PT_* value
+   DWORD type = 0;
+
+   /// segment flags; PF_* values
+   DWORD flags = 0;
+
+   /// file offset of segment data
+   ULONGLONG offset = 0;
+
+   /// virtual address
+   ULONGLONG virtualAddress = 0;
+
+   /// physical address
+   ULONGLONG physicalAddress = 0;
+
+   /// size of data in the file
+   ULONGLONG fileSize = 0;
+
+   /// size in memory
+   ULONGLONG memorySize = 0;
+
+   /// alignment
+   ULONGLONG align = 0;
+
+   /// pointer to the program header in the file
+   const BYTE* header = nullptr;
+};
+
+/// \brief ELF image
+/// \details Checks the ELF header and decodes the section and program header
+/// tables of ELF32 and ELF64 files in both data encodings. Decoding the
+/// section headers can be skipped when only the program headers are needed,
+/// e.g. for reading note segments; the section header table and the section
+/// names are usually stored at the end of the file, so this avoids touching
+/// additional pages of the mapped file.
+class ElfImage
+{
+public:
+   /// ctor
+   explicit ElfImage(const File& file, bool decodeSectionHeaders = true);
+
+   /// returns if the image is valid
+   bool IsValid() const { return m_isValid; }
+
+   /// returns an error text, when the image is invalid or has errors
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the file
+   const File& GetFile() const { return m_file; }
+
+   /// returns if this is an ELF64 image
+   bool Is64Bit() const { return m_is64Bit; }
+
+   /// returns if the image uses the little-endian data encoding
+   bool IsLittleEndian() const { return m_isLittleEndian; }
+
+   /// returns the object file type; ET_* value
+   WORD Type() const { return m_type; }
+
+   /// returns the target machine; EM_* value
+   WORD Machine() const { return m_machine; }
+
+   /// returns the entry point address
+   ULONGLONG EntryPoint() const { return m_entryPoint; }
+
+   /// returns all sections
+   const std::vector<ElfSection>& Sections() const { return m_sections; }
+
+   /// returns all segments
+   const std::vector<ElfSegment>& Segments() const { return m_segments; }
+
+   /// finds a section by name; returns nullptr when not found
+   const ElfSection* FindSection(LPCTSTR name) const;
+
+   /// finds the first section with given type; returns nullptr when not found
+   const ElfSection* FindSectionByType(DWORD type) const;
+
+   /// returns the data of a section, or nullptr when the section has no data
+   /// in the file or is outside of the file
+   const BYTE* SectionData(const ElfSection& section) const;
+
+   /// returns a zero-terminated string from a string table section
+   CString GetString(const ElfSection& stringTable, size_t offset) const;
+
+   /// converts a virtual address to a file offset, using the PT_LOAD segments
+   std::optional<size_t> AddressToFileOffset(ULONGLONG address, size_t size) const;
+
+   /// \brief Calls the given function with the ElfLayout matching the image
+   /// \details The function is usually a generic lambda taking the layout as
+   /// auto parameter; it is instantiated once for every layout.
+   template <typename TFunc>
+   auto Dispatch(TFunc&& func) const
+   {
+      if (m_is64Bit)
+         return m_isLittleEndian
+            ? func(ElfLayout<Elf64Class, true>{})
+            : func(ElfLayout<Elf64Class, false>{});
+
+      return m_isLittleEndian
+         ? func(ElfLayout<Elf32Class, true>{})
+         : func(ElfLayout<Elf32Class, false>{});
+   }
+
+private:
+   /// decodes header, section headers and program headers
+   template <typename TLayout>
+   bool DecodeHeaders(TLayout layout);
+
+   /// decodes section header table
+   template <typename TLayout>
+   bool DecodeSectionHeaders(TLayout layout, ULONGLONG tableOffset,
+      size_t entrySize, size_t count);
+
+   /// decodes program header table
+   template <typename TLayout>
+   bool DecodeProgramHeaders(TLayout layout, ULONGLONG tableOffset,
+      size_t entrySize, size_t count);
+
+private:
+   /// file
+   const File& m_file;
+
+   /// indicates if the section headers should be decoded
+   bool m_decodeSectionHeaders;
+
+   /// indicates if image is valid
+   bool m_isValid = false;
+
+   /// error text
+   CString m_errorText;
+
+   /// indicates an ELF64 image
+   bool m_is64Bit = false;
+
+   /// indicates little-endian data encoding
+   bool m_isLittleEndian = true;
+
+   /// object file type
+   WORD m_type = 0;
+
+   /// target machine
+   WORD m_machine = 0;
+
+   /// entry point address
+   ULONGLONG m_entryPoint = 0;
+
+   /// all sections
+   std::vector<ElfSection> m_sections;
+
+   /// all segments
+   std::vector<ElfSegment> m_segments;
+};
@@ -1,12 +1,13 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file ElfModule.cpp
 /// \brief module to load ELF binary files
 //
 #include "stdafx.h"
 #include "ElfModule.hpp"
+#include "ElfReader.hpp"
 
 CString ElfModule::DisplayName() const
 {
@@ -20,24 +21,15 @@ ModuleIconID ElfModule::IconID() const
 
 CString ElfModule::FilterStrings() const
 {
-   return CString{ "ELF shared library files (*.so)|*.so|" };
+   return CString{ "ELF shared library files (*.so)|*.so|ELF object files (*.o)|*.o|ELF executable files (*.elf)|*.elf|" };
 }
 
 bool ElfModule::IsModuleApplicableForFile(const File& file) const
 {
-   if (file.Size() < 4)
-      return false;
-
-   const BYTE* data = file.Data<BYTE>();
-   return
-      data[0] == 0x7F &&
-      data[1] == 'E' &&
-      data[2] == 'L' &&
-      data[3] == 'F';
+   return ElfReader::IsElfFile(file);
 }
 
 std::shared_ptr<IReader> ElfModule::OpenReader(const File& file) const
 {
-   (void)file;
-   return nullptr;
+   return std::make_shared<ElfReader>(file);
 }
@@ -0,0 +1,49 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfNote.cpp
+/// \brief ELF note definitions
+//
+#include "stdafx.h"
+#include "ElfNote.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapElfGnuNoteTypeToDisplayText =
+{
+   { 1, _T("NT_GNU_ABI_TAG") },
+   { 2, _T("NT_GNU_HWCAP") },
+   { 3, _T("NT_GNU_BUILD_ID") },
+   { 4, _T("NT_GNU_GOLD_VERSION") },
+   { 5, _T("NT_GNU_PROPERTY_TYPE_0") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfAbiTagOsToDisplayText =
+{
+   { 0, _T("Linux") },
+   { 1, _T("Hurd") },
+   { 2, _T("Solaris") },
+   { 3, _T("FreeBSD") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfGnuPropertyTypeToDisplayText =
+{
+   { 1, _T("GNU_PROPERTY_STACK_SIZE") },
+   { 2, _T("GNU_PROPERTY_NO_COPY_ON_PROTECTED") },
+   { 0xc0000000, _T("GNU_PROPERTY_AARCH64_FEATURE_1_AND") },
+   { 0xc0000002, _T("GNU_PROPERTY_X86_FEATURE_1_AND") },
+   { 0xc0008002, _T("GNU_PROPERTY_X86_ISA_1_NEEDED") },
+   { 0xc0010001, _T("GNU_PROPERTY_X86_FEATURE_2_USED") },
+   { 0xc0010002, _T("GNU_PROPERTY_X86_ISA_1_USED") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfGnuPropertyX86FeatureToDisplayText =
+{
+   { 0x1, _T("IBT") },
+   { 0x2, _T("SHSTK") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfGnuPropertyAArch64FeatureToDisplayText =
+{
+   { 0x1, _T("BTI") },
+   { 0x2, _T("PAC") },
+};
@@ -0,0 +1,60 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfNote.hpp
+/// \brief ELF note definitions
+//
+#pragma once
+
+#pragma pack(push, 1)
+
+/// \brief ELF note header; same for both classes; followed by the owner name
+/// and the descriptor, each padded to the note alignment
+/// \see https://refspecs.linuxfoundation.org/elf/gabi4+/ch5.pheader.html#note_section
+struct ElfNoteHeader
+{
+   DWORD nameSize;               ///< size of the owner name, including the terminating zero
+   DWORD descriptorSize;         ///< size of the descriptor
+   DWORD type;                   ///< note type; meaning depends on the owner
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(ElfNoteHeader) == 12, "ELF note header must be 12 bytes long");
+
+/// SHT_NOTE: note section
+constexpr DWORD c_elfSectionTypeNote = 7;
+
+/// PT_NOTE: note segment
+constexpr DWORD c_elfSegmentTypeNote = 4;
+
+/// NT_GNU_ABI_TAG: ABI tag note of owner "GNU"
+constexpr DWORD c_elfNoteTypeGnuAbiTag = 1;
+
+/// NT_GNU_BUILD_ID: build-id note of owner "GNU"
+constexpr DWORD c_elfNoteTypeGnuBuildId = 3;
+
+/// NT_GNU_GOLD_VERSION: gold linker version note of owner "GNU"
+constexpr DWORD c_elfNoteTypeGnuGoldVersion = 4;
+
+/// NT_GNU_PROPERTY_TYPE_0: program property note of owner "GNU"
+constexpr DWORD c_elfNoteTypeGnuProperty = 5;
+
+/// NT_STAPSDT: SystemTap static probe note of owner "stapsdt"
+constexpr DWORD c_elfNoteTypeStapSdt = 3;
+
+/// mapping of GNU note types to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfGnuNoteTypeToDisplayText;
+
+/// mapping of ABI tag operating systems to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfAbiTagOsToDisplayText;
+
+/// mapping of GNU program property types to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfGnuPropertyTypeToDisplayText;
+
+/// mapping of x86 feature flags of GNU program properties to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfGnuPropertyX86FeatureToDisplayText;
+
+/// mapping of AArch64 feature flags of GNU program properties to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfGnuPropertyAArch64FeatureToDisplayText;
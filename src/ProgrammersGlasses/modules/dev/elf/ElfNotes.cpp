@@ -0,0 +1,339 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfNotes.cpp
+/// \brief ELF notes, from note sections or note segments
+//
+#include "stdafx.h"
+#include "ElfNotes.hpp"
+
+/// maximum number of descriptor bytes shown for unknown notes
+constexpr size_t c_maxUnknownDescriptorBytes = 32;
+
+/// GNU_PROPERTY_STACK_SIZE: stack size property
+constexpr DWORD c_elfGnuPropertyStackSize = 1;
+
+/// GNU_PROPERTY_AARCH64_FEATURE_1_AND: AArch64 feature flags property
+constexpr DWORD c_elfGnuPropertyAArch64Feature = 0xc0000000;
+
+/// GNU_PROPERTY_X86_FEATURE_1_AND: x86 feature flags property
+constexpr DWORD c_elfGnuPropertyX86Feature = 0xc0000002;
+
+/// \brief Formats a byte range as lowercase hex digits
+static CString FormatHexBytes(const BYTE* data, size_t size)
+{
+   CString text;
+   for (size_t index = 0; index < size; index++)
+      text.AppendFormat(_T("%02x"), data[index]);
+
+   return text;
+}
+
+/// \brief Formats feature flags as comma separated names
+static CString FormatFeatureFlags(const std::map<DWORD, LPCTSTR>& flagsMap, DWORD flags)
+{
+   if (flags == 0)
+      return _T("none");
+
+   CString text;
+   for (const auto& [flag, name] : flagsMap)
+   {
+      if ((flags & flag) == 0)
+         continue;
+
+      text += (text.IsEmpty() ? _T("") : _T(", ")) + CString(name);
+      flags &= ~flag;
+   }
+
+   if (flags != 0)
+      text.AppendFormat(_T("%s0x%08x"), text.IsEmpty() ? _T("") : _T(", "), flags);
+
+   return text;
+}
+
+ElfNotes::ElfNotes(const ElfImage& image)
+   :m_image(image)
+{
+   m_image.Dispatch([&](auto layout)
+      {
+         // note sections are preferred, since they are more fine grained
+         bool foundNoteSection = false;
+         for (const ElfSection& section : m_image.Sections())
+         {
+            if (section.type != c_elfSectionTypeNote)
+               continue;
+
+            foundNoteSection = true;
+
+            const BYTE* data = m_image.SectionData(section);
+            if (data == nullptr)
+            {
+               m_errorText = _T("Note section is outside of the file");
+               continue;
+            }
+
+            ReadNotes(layout, section.name, data,
+               static_cast<size_t>(section.size),
+               section.addressAlign == 8 ? 8 : 4);
+         }
+
+         if (foundNoteSection)
+            return;
+
+         const File& file = m_image.GetFile();
+         const std::vector<ElfSegment>& segments = m_image.Segments();
+         for (size_t index = 0; index < segments.size(); index++)
+         {
+            const ElfSegment& segment = segments[index];
+            if (segment.type != c_elfSegmentTypeNote)
+               continue;
+
+            if (segment.offset > file.Size() ||
+               segment.fileSize > file.Size() - segment.offset)
+            {
+               m_errorText = _T("Note segment is outside of the file");
+               continue;
+            }
+
+            CString sourceName;
+            sourceName.Format(_T("Program header %zu"), index);
+
+            ReadNotes(layout, sourceName,
+               file.Data<BYTE>(static_cast<size_t>(segment.offset)),
+               static_cast<size_t>(segment.fileSize),
+               segment.align == 8 ? 8 : 4);
+         }
+      });
+}
+
+template <typename TLayout>
+void ElfNotes::ReadNotes(TLayout layout, const CString& sourceName,
+   const BYTE* data, size_t size, size_t alignment)
+{
+   // name and descriptor both start at an offset aligned to the note alignment
+   auto alignOffset = [alignment, size](size_t value)
+   {
+      size_t aligned = (value + alignment - 1) & ~(alignment - 1);
+      return std::min(aligned, size);
+   };
+
+   size_t offset = 0;
+   while (offset <= size &&
+      size - offset >= sizeof(ElfNoteHeader))
+   {
+      const ElfNoteHeader& header = *reinterpret_cast<const ElfNoteHeader*>(data + offset);
+
+      size_t nameSize = layout.Get(header.nameSize);
+      size_t descriptorSize = layout.Get(header.descriptorSize);
+
+      size_t nameOffset = offset + sizeof(ElfNoteHeader);
+      if (nameSize > size - nameOffset)
+      {
+         m_errorText = _T("Note name is outside of the note data");
+         return;
+      }
+
+      size_t descriptorOffset = alignOffset(nameOffset + nameSize);
+      if (descriptorSize > size - descriptorOffset)
+      {
+         m_errorText = _T("Note descriptor is outside of the note data");
+         return;
+      }
+
+      const char* name = reinterpret_cast<const char*>(data + nameOffset);
+
+      ElfNote note;
+      note.sourceName = sourceName;
+      note.owner = CStringA(name, static_cast<int>(strnlen(name, nameSize)));
+      note.type = layout.Get(header.type);
+      note.descriptor = data + descriptorOffset;
+      note.descriptorSize = descriptorSize;
+      note.entry = data + offset;
+
+      m_notes.push_back(note);
+
+      // the padding after the last descriptor may be missing
+      offset = alignOffset(descriptorOffset + descriptorSize);
+   }
+}
+
+std::optional<CString> ElfNotes::BuildId() const
+{
+   for (const ElfNote& note : m_notes)
+   {
+      if (note.owner == "GNU" &&
+         note.type == c_elfNoteTypeGnuBuildId)
+         return FormatHexBytes(note.descriptor, note.descriptorSize);
+   }
+
+   return std::nullopt;
+}
+
+CString ElfNotes::TypeName(const ElfNote& note) const
+{
+   if (note.owner == "GNU")
+   {
+      auto iter = g_mapElfGnuNoteTypeToDisplayText.find(note.type);
+      if (iter != g_mapElfGnuNoteTypeToDisplayText.end())
+         return iter->second;
+   }
+
+   if (note.owner == "stapsdt" &&
+      note.type == c_elfNoteTypeStapSdt)
+      return _T("NT_STAPSDT");
+
+   CString text;
+   text.Format(_T("0x%08x"), note.type);
+   return text;
+}
+
+CString ElfNotes::FormatDescriptor(const ElfNote& note) const
+{
+   if (note.owner == "GNU")
+   {
+      switch (note.type)
+      {
+      case c_elfNoteTypeGnuBuildId:
+         return FormatHexBytes(note.descriptor, note.descriptorSize);
+
+      case c_elfNoteTypeGnuAbiTag:
+         return m_image.Dispatch([&](auto layout) { return FormatAbiTag(layout, note); });
+
+      case c_elfNoteTypeGnuGoldVersion:
+      {
+         const char* text = reinterpret_cast<const char*>(note.descriptor);
+         return CString(CStringA(text, static_cast<int>(strnlen(text, note.descriptorSize))));
+      }
+
+      case c_elfNoteTypeGnuProperty:
+         return m_image.Dispatch([&](auto layout) { return FormatProperties(layout, note); });
+
+      default:
+         break;
+      }
+   }
+
+   if (note.owner == "stapsdt" &&
+      note.type == c_elfNoteTypeStapSdt)
+      return m_image.Dispatch([&](auto layout) { return FormatStapSdtProbe(layout, note); });
+
+   CString text = FormatHexBytes(note.descriptor,
+      std::min(note.descriptorSize, c_maxUnknownDescriptorBytes));
+
+   if (note.descriptorSize > c_maxUnknownDescriptorBytes)
+      text += _T("...");
+
+   return text;
+}
+
+template <typename TLayout>
+CString ElfNotes::FormatAbiTag(TLayout layout, const ElfNote& note) const
+{
+   if (note.descriptorSize < 4 * sizeof(DWORD))
+      return _T("invalid ABI tag");
+
+   const DWORD* values = reinterpret_cast<const DWORD*>(note.descriptor);
+
+   CString text;
+   text.Format(_T("%s %u.%u.%u"),
+      GetValueFromMapOrDefault<DWORD>(g_mapElfAbiTagOsToDisplayText, layout.Get(values[0]), _T("unknown OS")),
+      layout.Get(values[1]),
+      layout.Get(values[2]),
+      layout.Get(values[3]));
+
+   return text;
+}
+
+template <typename TLayout>
+CString ElfNotes::FormatProperties(TLayout layout, const ElfNote& note) const
+{
+   // property data is padded to the address size
+   constexpr size_t propertyAlign = sizeof(typename TLayout::Address);
+
+   CString text;
+   size_t offset = 0;
+   while (note.descriptorSize - offset >= 2 * sizeof(DWORD))
+   {
+      const DWORD* header = reinterpret_cast<const DWORD*>(note.descriptor + offset);
+      DWORD type = layout.Get(header[0]);
+      size_t dataSize = layout.Get(header[1]);
+
+      offset += 2 * sizeof(DWORD);
+      if (dataSize > note.descriptorSize - offset)
+         break;
+
+      const BYTE* data = note.descriptor + offset;
+
+      CString valueText;
+      if ((type == c_elfGnuPropertyX86Feature || type == c_elfGnuPropertyAArch64Feature) &&
+         dataSize >= sizeof(DWORD))
+      {
+         valueText = FormatFeatureFlags(
+            type == c_elfGnuPropertyX86Feature
+            ? g_mapElfGnuPropertyX86FeatureToDisplayText
+            : g_mapElfGnuPropertyAArch64FeatureToDisplayText,
+            layout.Get(*reinterpret_cast<const DWORD*>(data)));
+      }
+      else if (type == c_elfGnuPropertyStackSize &&
+         dataSize >= sizeof(typename TLayout::Address))
+      {
+         valueText.Format(_T("0x%llx"),
+            static_cast<ULONGLONG>(layout.Get(*reinterpret_cast<const typename TLayout::Address*>(data))));
+      }
+      else
+         valueText = FormatHexBytes(data, dataSize);
+
+      CString typeText;
+      typeText.Format(_T("0x%08x"), type);
+
+      text.AppendFormat(_T("%s%s: %s"),
+         text.IsEmpty() ? _T("") : _T("; "),
+         GetValueFromMapOrDefault<DWORD>(g_mapElfGnuPropertyTypeToDisplayText, type, typeText),
+         valueText.GetString());
+
+      size_t paddedSize = (dataSize + propertyAlign - 1) & ~(propertyAlign - 1);
+      offset += std::min(paddedSize, note.descriptorSize - offset);
+   }
+
+   return text;
+}
+
+template <typename TLayout>
+CString ElfNotes::FormatStapSdtProbe(TLayout layout, const ElfNote& note) const
+{
+   using Address = typename TLayout::Address;
+
+   if (note.descriptorSize < 3 * sizeof(Address))
+      return _T("invalid probe");
+
+   // the probe, base and semaphore addresses are followed by the provider
+   // name, the probe name and the argument description, all zero terminated
+   const Address* addresses = reinterpret_cast<const Address*>(note.descriptor);
+
+   const char* strings = reinterpret_cast<const char*>(note.descriptor + 3 * sizeof(Address));
+   size_t stringsSize = note.descriptorSize - 3 * sizeof(Address);
+
+   CStringA parts[3];
+   size_t offset = 0;
+   for (CStringA& part : parts)
+   {
+      if (offset >= stringsSize)
+         break;
+
+      size_t length = strnlen(strings + offset, stringsSize - offset);
+      part = CStringA(strings + offset, static_cast<int>(length));
+      offset += length + 1;
+   }
+
+   CString text;
+   text.Format(_T("%s:%s, pc 0x%llx, base 0x%llx, semaphore 0x%llx, args: %s"),
+      CString(parts[0]).GetString(),
+      CString(parts[1]).GetString(),
+      static_cast<ULONGLONG>(layout.Get(addresses[0])),
+      static_cast<ULONGLONG>(layout.Get(addresses[1])),
+      static_cast<ULONGLONG>(layout.Get(addresses[2])),
+      CString(parts[2]).GetString());
+
+   return text;
+}
@@ -0,0 +1,89 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfNotes.hpp
+/// \brief ELF notes, from note sections or note segments
+//
+#pragma once
+
+#include "ElfImage.hpp"
+#include "ElfNote.hpp"
+
+/// \brief ELF note
+struct ElfNote
+{
+   /// name of the section or segment containing the note
+   CString sourceName;
+
+   /// owner name, e.g. "GNU"
+   CStringA owner;
+
+   /// note type; meaning depends on the owner
+   DWORD type = 0;
+
+   /// pointer to the descriptor in the file
+   const BYTE* descriptor = nullptr;
+
+   /// size of the descriptor
+   size_t descriptorSize = 0;
+
+   /// pointer to the note header in the file
+   const BYTE* entry = nullptr;
+};
+
+/// \brief ELF notes
+/// \details Reads all notes from the SHT_NOTE sections, or from the PT_NOTE
+/// segments when the image has no section headers. The build-id is usually
+/// stored in the first note segment, so an image that only decoded the
+/// program headers is enough to find it, touching only a few pages of the
+/// mapped file.
+class ElfNotes
+{
+public:
+   /// ctor; the image must outlive the notes
+   explicit ElfNotes(const ElfImage& image);
+
+   /// returns an error text, when notes couldn't be read
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns all notes
+   const std::vector<ElfNote>& Notes() const { return m_notes; }
+
+   /// returns the GNU build-id as hex string, if available
+   std::optional<CString> BuildId() const;
+
+   /// returns the display name of the note type
+   CString TypeName(const ElfNote& note) const;
+
+   /// formats the note descriptor, depending on owner and type
+   CString FormatDescriptor(const ElfNote& note) const;
+
+private:
+   /// reads all notes from a section or segment
+   template <typename TLayout>
+   void ReadNotes(TLayout layout, const CString& sourceName,
+      const BYTE* data, size_t size, size_t alignment);
+
+   /// formats an ABI tag descriptor
+   template <typename TLayout>
+   CString FormatAbiTag(TLayout layout, const ElfNote& note) const;
+
+   /// formats a program property descriptor
+   template <typename TLayout>
+   CString FormatProperties(TLayout layout, const ElfNote& note) const;
+
+   /// formats a SystemTap probe descriptor
+   template <typename TLayout>
+   CString FormatStapSdtProbe(TLayout layout, const ElfNote& note) const;
+
+private:
+   /// ELF image
+   const ElfImage& m_image;
+
+   /// error text
+   CString m_errorText;
+
+   /// all notes
+   std::vector<ElfNote> m_notes;
+};
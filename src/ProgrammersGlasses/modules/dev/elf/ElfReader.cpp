@@ -0,0 +1,961 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfReader.cpp
+/// \brief reader for ELF files
+//
+#include "stdafx.h"
+#include "ElfReader.hpp"
+#include "ElfImage.hpp"
+#include "ElfSymbolTable.hpp"
+#include "ElfSymbolVersions.hpp"
+#include "ElfRelocationTable.hpp"
+#include "ElfNotes.hpp"
+#include "ElfSectionDataCache.hpp"
+#include "ElfDwarfSections.hpp"
+#include "dev/dwarf/DwarfReader.hpp"
+#include "dev/dwarf/DwarfNodeTreeBuilder.hpp"
+#include "modules/CodeTextViewNode.hpp"
+#include "modules/FilterSortListViewNode.hpp"
+#include "modules/StructListViewNode.hpp"
+#include "modules/HexDataViewNode.hpp"
+#include "modules/DisplayFormatHelper.hpp"
+
+/// PT_INTERP: program interpreter path segment
+constexpr DWORD c_elfSegmentTypeInterpreter = 3;
+
+/// \brief Formats section flags, using the letters that readelf uses
+static CString FormatSectionFlags(ULONGLONG flags)
+{
+   static const std::vector<std::pair<ULONGLONG, TCHAR>> flagLetters =
+   {
+      { 0x001, _T('W') },
+      { 0x002, _T('A') },
+      { 0x004, _T('X') },
+      { 0x010, _T('M') },
+      { 0x020, _T('S') },
+      { 0x040, _T('I') },
+      { 0x080, _T('L') },
+      { 0x100, _T('O') },
+      { 0x200, _T('G') },
+      { 0x400, _T('T') },
+      { 0x800, _T('C') },
+      { 0x80000000, _T('E') },
+   };
+
+   CString text;
+   for (const auto& [flag, letter] : flagLetters)
+   {
+      if ((flags & flag) != 0)
+         text.AppendChar(letter);
+   }
+
+   return text;
+}
+
+/// \brief Formats segment flags as read, write and execute letters
+static CString FormatSegmentFlags(DWORD flags)
+{
+   CString text;
+   text.AppendChar((flags & 4) != 0 ? _T('R') : _T(' '));
+   text.AppendChar((flags & 2) != 0 ? _T('W') : _T(' '));
+   text.AppendChar((flags & 1) != 0 ? _T('E') : _T(' '));
+
+   return text;
+}
+
+bool ElfReader::IsElfFile(const File& file)
+{
+   if (file.Size() < 4)
+      return false;
+
+   const BYTE* data = file.Data<BYTE>();
+   return
+      data[0] == 0x7F &&
+      data[1] == 'E' &&
+      data[2] == 'L' &&
+      data[3] == 'F';
+}
+
+ElfReader::ElfReader(const File& file)
+   :m_file(file)
+{
+}
+
+void ElfReader::Load()
+{
+   auto rootNode = std::make_shared<CodeTextViewNode>(
+      _T("Summary"),
+      NodeTreeIconID::nodeTreeIconDocument);
+
+   m_rootNode = rootNode;
+
+   CString summaryText;
+   summaryText.Append(_T("ELF file: ") + m_file.Filename() + _T("\n\n"));
+   summaryText.Append(_T("Summary:\n"));
+
+   m_image = std::make_shared<ElfImage>(m_file);
+
+   if (m_file.Size() >= (m_image->Is64Bit() ? sizeof(Elf64Header) : sizeof(Elf32Header)))
+   {
+      AddElfHeader(*rootNode, summaryText);
+   }
+
+   if (!m_image->IsValid())
+   {
+      summaryText.AppendFormat(_T("Error: %s\n"), m_image->GetErrorText().GetString());
+      rootNode->SetText(summaryText);
+
+      return;
+   }
+
+   m_sectionDataCache = std::make_shared<ElfSectionDataCache>(*m_image);
+
+   AddSectionHeaders(*rootNode, summaryText);
+   AddProgramHeaders(*rootNode, summaryText);
+   AddNotes(*rootNode, summaryText);
+   AddSymbolTables(*rootNode, summaryText);
+   AddDynamicSection(*rootNode, summaryText);
+   AddSymbolVersions(*rootNode, summaryText);
+   AddRelocationTables(*rootNode, summaryText);
+   AddCompressedSections(*rootNode, summaryText);
+   AddDwarfDebugInfo(*rootNode, summaryText);
+
+   rootNode->SetText(summaryText);
+}
+
+void ElfReader::Cleanup()
+{
+   // nothing expensive to cleanup here
+}
+
+void ElfReader::AddElfHeader(StaticNode& rootNode, CString& summaryText) const
+{
+   const ElfImage& image = *m_image;
+
+   auto elfHeaderNode = std::make_shared<StructListViewNode>(
+      image.Is64Bit() ? _T("ELF header (ELF64)") : _T("ELF header (ELF32)"),
+      NodeTreeIconID::nodeTreeIconBinary,
+      GetElfHeaderDefinition(image.Is64Bit(), image.IsLittleEndian()),
+      m_file.Data(),
+      m_file.Data());
+
+   rootNode.ChildNodes().push_back(elfHeaderNode);
+
+   if (!image.IsValid())
+      return;
+
+   summaryText.AppendFormat(_T("Class: %s, %s\n"),
+      image.Is64Bit() ? _T("ELF64") : _T("ELF32"),
+      image.IsLittleEndian() ? _T("little-endian") : _T("big-endian"));
+
+   summaryText.AppendFormat(_T("Type: %s\n"),
+      GetValueFromMapOrDefault<DWORD>(g_mapElfTypeToDisplayText, image.Type(), _T("unknown")));
+
+   summaryText.AppendFormat(_T("Machine: %s\n"),
+      GetValueFromMapOrDefault<DWORD>(g_mapElfMachineToDisplayText, image.Machine(), _T("unknown")));
+
+   summaryText.AppendFormat(_T("Entry point: 0x%llx\n"), image.EntryPoint());
+}
+
+void ElfReader::AddSectionHeaders(StaticNode& rootNode, CString& summaryText) const
+{
+   std::shared_ptr<ElfImage> image = m_image;
+
+   const std::vector<ElfSection>& sections = image->Sections();
+
+   summaryText.AppendFormat(_T("Section header table with %zu sections.\n"), sections.size());
+
+   if (sections.empty())
+      return;
+
+   static std::vector<CString> sectionColumnNames
+   {
+      _T("Index"),
+      _T("Name"),
+      _T("Type"),
+      _T("Flags"),
+      _T("Address"),
+      _T("Offset"),
+      _T("Size"),
+      _T("Entry size"),
+      _T("Link"),
+      _T("Info"),
+      _T("Align"),
+   };
+
+   auto sectionTableNode = std::make_shared<FilterSortListViewNode>(
+      _T("Section Headers"),
+      NodeTreeIconID::nodeTreeIconTable,
+      sectionColumnNames,
+      sections.size(),
+      [image](size_t index)
+      {
+         const ElfSection& section = image->Sections()[index];
+
+         CString indexText;
+         indexText.Format(_T("%zu"), index);
+
+         CString addressText;
+         addressText.Format(_T("0x%08llx"), section.address);
+
+         CString offsetText;
+         offsetText.Format(_T("0x%08llx"), section.offset);
+
+         CString sizeText;
+         sizeText.Format(_T("0x%08llx"), section.size);
+
+         CString entrySizeText;
+         entrySizeText.Format(_T("0x%llx"), section.entrySize);
+
+         CString linkText;
+         linkText.Format(_T("%u"), section.link);
+
+         CString infoText;
+         infoText.Format(_T("%u"), section.info);
+
+         CString alignText;
+         alignText.Format(_T("%llu"), section.addressAlign);
+
+         return std::vector<CString> {
+            indexText,
+            section.name,
+            GetValueFromMapOrDefault<DWORD>(
+               g_mapElfSectionTypeToDisplayText, section.type, _T("unknown")),
+            FormatSectionFlags(section.flags),
+            addressText,
+            offsetText,
+            sizeText,
+            entrySizeText,
+            linkText,
+            infoText,
+            alignText,
+         };
+      },
+      true);
+
+   const StructDefinition& sectionHeaderDefinition =
+      GetElfSectionHeaderDefinition(image->Is64Bit(), image->IsLittleEndian());
+
+   for (const ElfSection& section : sections)
+   {
+      CString name;
+      name.Format(_T("Section [%zu] %s"), section.index, section.name.GetString());
+
+      sectionTableNode->ChildNodes().push_back(
+         std::make_shared<StructListViewNode>(
+            name,
+            NodeTreeIconID::nodeTreeIconBinary,
+            sectionHeaderDefinition,
+            section.header,
+            m_file.Data()));
+   }
+
+   rootNode.ChildNodes().push_back(sectionTableNode);
+}
+
+void ElfReader::AddProgramHeaders(StaticNode& rootNode, CString& summaryText) const
+{
+   const ElfImage& image = *m_image;
+
+   const std::vector<ElfSegment>& segments = image.Segments();
+
+   summaryText.AppendFormat(_T("Program header table with %zu segments.\n"), segments.size());
+
+   if (segments.empty())
+      return;
+
+   std::vector<std::vector<CString>> segmentData;
+   std::vector<std::shared_ptr<INode>> segmentChildNodes;
+
+   const StructDefinition& programHeaderDefinition =
+      GetElfProgramHeaderDefinition(image.Is64Bit(), image.IsLittleEndian());
+
+   for (size_t index = 0; index < segments.size(); index++)
+   {
+      const ElfSegment& segment = segments[index];
+
+      CString indexText;
+      indexText.Format(_T("%zu"), index);
+
+      CString typeText = GetValueFromMapOrDefault<DWORD>(
+         g_mapElfSegmentTypeToDisplayText, segment.type, _T("unknown"));
+
+      CString offsetText;
+      offsetText.Format(_T("0x%08llx"), segment.offset);
+
+      CString virtualAddressText;
+      virtualAddressText.Format(_T("0x%08llx"), segment.virtualAddress);
+
+      CString physicalAddressText;
+      physicalAddressText.Format(_T("0x%08llx"), segment.physicalAddress);
+
+      CString fileSizeText;
+      fileSizeText.Format(_T("0x%08llx"), segment.fileSize);
+
+      CString memorySizeText;
+      memorySizeText.Format(_T("0x%08llx"), segment.memorySize);
+
+      CString alignText;
+      alignText.Format(_T("0x%llx"), segment.align);
+
+      segmentData.push_back(
+         std::vector<CString> {
+            indexText,
+            typeText,
+            FormatSegmentFlags(segment.flags),
+            offsetText,
+            virtualAddressText,
+            physicalAddressText,
+            fileSizeText,
+            memorySizeText,
+            alignText,
+         });
+
+      segmentChildNodes.push_back(
+         std::make_shared<StructListViewNode>(
+            _T("Program header ") + indexText + _T(" ") + typeText,
+            NodeTreeIconID::nodeTreeIconBinary,
+            programHeaderDefinition,
+            segment.header,
+            m_file.Data()));
+
+      if (segment.type == c_elfSegmentTypeInterpreter &&
+         segment.offset < m_file.Size() &&
+         segment.fileSize <= m_file.Size() - segment.offset)
+      {
+         const char* interpreter = m_file.Data<char>(static_cast<size_t>(segment.offset));
+         size_t length = strnlen(interpreter, static_cast<size_t>(segment.fileSize));
+
+         summaryText += _T("Interpreter: ") +
+            CString(CStringA(interpreter, static_cast<int>(length))) + _T("\n");
+      }
+   }
+
+   static std::vector<CString> segmentColumnNames
+   {
+      _T("Index"),
+      _T("Type"),
+      _T("Flags"),
+      _T("Offset"),
+      _T("Virtual address"),
+      _T("Physical address"),
+      _T("File size"),
+      _T("Memory size"),
+      _T("Align"),
+   };
+
+   auto segmentTableNode = std::make_shared<FilterSortListViewNode>(
+      _T("Program Headers"),
+      NodeTreeIconID::nodeTreeIconTable,
+      segmentColumnNames,
+      segmentData,
+      false);
+
+   segmentTableNode->ChildNodes().swap(segmentChildNodes);
+
+   rootNode.ChildNodes().push_back(segmentTableNode);
+}
+
+void ElfReader::AddNotes(StaticNode& rootNode, CString& summaryText) const
+{
+   ElfNotes notes{ *m_image };
+
+   if (!notes.GetErrorText().IsEmpty())
+      summaryText.AppendFormat(_T("Error: %s\n"), notes.GetErrorText().GetString());
+
+   if (notes.Notes().empty())
+      return;
+
+   std::optional<CString> buildId = notes.BuildId();
+   if (buildId.has_value())
+      summaryText.AppendFormat(_T("GNU build-id: %s\n"), buildId.value().GetString());
+
+   std::vector<std::vector<CString>> noteData;
+   for (const ElfNote& note : notes.Notes())
+   {
+      CString descriptorSizeText;
+      descriptorSizeText.Format(_T("%zu"), note.descriptorSize);
+
+      noteData.push_back(
+         std::vector<CString> {
+            note.sourceName,
+            CString(note.owner),
+            notes.TypeName(note),
+            descriptorSizeText,
+            notes.FormatDescriptor(note),
+         });
+   }
+
+   static std::vector<CString> noteColumnNames
+   {
+      _T("Source"),
+      _T("Owner"),
+      _T("Type"),
+      _T("Size"),
+      _T("Description"),
+   };
+
+   rootNode.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Notes"),
+         NodeTreeIconID::nodeTreeIconTable,
+         noteColumnNames,
+         noteData,
+         true));
+}
+
+void ElfReader::AddSymbolTables(StaticNode& rootNode, CString& summaryText) const
+{
+   std::shared_ptr<ElfImage> image = m_image;
+
+   static std::vector<CString> symbolColumnNames
+   {
+      _T("Index"),
+      _T("Value"),
+      _T("Size"),
+      _T("Type"),
+      _T("Binding"),
+      _T("Visibility"),
+      _T("Section"),
+      _T("Name"),
+   };
+
+   for (const ElfSection& section : image->Sections())
+   {
+      if (section.type != c_elfSectionTypeSymbolTable &&
+         section.type != c_elfSectionTypeDynamicSymbols)
+         continue;
+
+      auto symbolTable = std::make_shared<ElfSymbolTable>(*image, section);
+
+      if (!symbolTable->IsValid())
+      {
+         summaryText.AppendFormat(_T("Error: Symbol table %s: %s\n"),
+            section.name.GetString(),
+            symbolTable->GetErrorText().GetString());
+         continue;
+      }
+
+      summaryText.AppendFormat(_T("Symbol table %s with %zu symbols, lookup using %s.\n"),
+         section.name.GetString(),
+         symbolTable->Count(),
+         symbolTable->HashTableName());
+
+      // the image is captured as well, since the symbol table refers to it
+      auto symbolTableNode = std::make_shared<FilterSortListViewNode>(
+         _T("Symbol table ") + section.name,
+         NodeTreeIconID::nodeTreeIconTable,
+         symbolColumnNames,
+         symbolTable->Count(),
+         [image, symbolTable](size_t index)
+         {
+            ElfSymbol symbol = symbolTable->GetSymbol(index);
+
+            CString indexText;
+            indexText.Format(_T("%zu"), index);
+
+            CString valueText;
+            valueText.Format(_T("0x%08llx"), symbol.value);
+
+            CString sizeText;
+            sizeText.Format(_T("%llu"), symbol.size);
+
+            CString sectionText;
+            if (symbol.sectionIndex < c_elfSectionIndexLoReserve &&
+               symbol.sectionIndex != c_elfSectionIndexUndefined &&
+               symbol.sectionIndex < image->Sections().size())
+               sectionText = image->Sections()[symbol.sectionIndex].name;
+            else
+               sectionText = GetValueFromMapOrDefault<DWORD>(
+                  g_mapElfSpecialSectionIndexToDisplayText, symbol.sectionIndex, _T("reserved"));
+
+            return std::vector<CString> {
+               indexText,
+               valueText,
+               sizeText,
+               GetValueFromMapOrDefault<DWORD>(
+                  g_mapElfSymbolTypeToDisplayText, symbol.type, _T("unknown")),
+               GetValueFromMapOrDefault<DWORD>(
+                  g_mapElfSymbolBindingToDisplayText, symbol.binding, _T("unknown")),
+               GetValueFromMapOrDefault<DWORD>(
+                  g_mapElfSymbolVisibilityToDisplayText, symbol.visibility, _T("unknown")),
+               sectionText,
+               symbol.name,
+            };
+         },
+         true);
+
+      rootNode.ChildNodes().push_back(symbolTableNode);
+   }
+}
+
+void ElfReader::AddDynamicSection(StaticNode& rootNode, CString& summaryText) const
+{
+   const ElfImage& image = *m_image;
+
+   const ElfSection* dynamicSection = image.FindSectionByType(c_elfSectionTypeDynamic);
+   if (dynamicSection == nullptr)
+      return;
+
+   const BYTE* data = image.SectionData(*dynamicSection);
+   if (data == nullptr)
+   {
+      summaryText.Append(_T("Error: Dynamic section is outside of the file\n"));
+      return;
+   }
+
+   const ElfSection* stringTable = dynamicSection->link < image.Sections().size()
+      ? &image.Sections()[dynamicSection->link]
+      : nullptr;
+
+   std::vector<std::vector<CString>> dynamicData;
+
+   image.Dispatch([&](auto layout)
+      {
+         using TDynamic = typename decltype(layout)::Dynamic;
+
+         const TDynamic* entries = reinterpret_cast<const TDynamic*>(data);
+         size_t count = static_cast<size_t>(dynamicSection->size / sizeof(TDynamic));
+
+         for (size_t index = 0; index < count; index++)
+         {
+            LONGLONG tag = layout.Get(entries[index].tag);
+            ULONGLONG value = layout.Get(entries[index].value);
+
+            CString valueText;
+            valueText.Format(_T("0x%llx"), value);
+
+            LPCTSTR summaryLabel = nullptr;
+            switch (tag)
+            {
+            case c_elfDynamicTagNeeded: summaryLabel = _T("Needed library"); break;
+            case c_elfDynamicTagSharedObjectName: summaryLabel = _T("Shared object name"); break;
+            case c_elfDynamicTagRPath: summaryLabel = _T("Library search path (RPATH)"); break;
+            case c_elfDynamicTagRunPath: summaryLabel = _T("Library search path (RUNPATH)"); break;
+            default: break;
+            }
+
+            if (summaryLabel != nullptr && stringTable != nullptr)
+            {
+               valueText = image.GetString(*stringTable, static_cast<size_t>(value));
+               summaryText.AppendFormat(_T("%s: %s\n"), summaryLabel, valueText.GetString());
+            }
+
+            CString indexText;
+            indexText.Format(_T("%zu"), index);
+
+            CString tagText;
+            tagText.Format(_T("0x%llx %s"), tag,
+               GetValueFromMapOrDefault<DWORD>(
+                  g_mapElfDynamicTagToDisplayText, static_cast<DWORD>(tag), _T("")));
+
+            dynamicData.push_back(
+               std::vector<CString> {
+                  indexText,
+                  tagText,
+                  valueText,
+               });
+
+            if (tag == c_elfDynamicTagNull)
+               break;
+         }
+      });
+
+   static std::vector<CString> dynamicColumnNames
+   {
+      _T("Index"),
+      _T("Tag"),
+      _T("Value"),
+   };
+
+   rootNode.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Dynamic Section"),
+         NodeTreeIconID::nodeTreeIconTable,
+         dynamicColumnNames,
+         dynamicData,
+         false));
+}
+
+void ElfReader::AddSymbolVersions(StaticNode& rootNode, CString& summaryText) const
+{
+   std::shared_ptr<ElfImage> image = m_image;
+   auto symbolVersions = std::make_shared<ElfSymbolVersions>(*image);
+
+   if (!symbolVersions->IsAvailable())
+      return;
+
+   summaryText.AppendFormat(_T("Symbol versioning with %zu version definitions and %zu version requirements.\n"),
+      symbolVersions->Definitions().size(),
+      symbolVersions->Requirements().size());
+
+   if (!symbolVersions->GetErrorText().IsEmpty())
+      summaryText.AppendFormat(_T("Error: %s\n"), symbolVersions->GetErrorText().GetString());
+
+   if (!symbolVersions->Definitions().empty())
+   {
+      std::vector<std::vector<CString>> definitionData;
+      for (const ElfVersionDefinition& definition : symbolVersions->Definitions())
+      {
+         CString indexText;
+         indexText.Format(_T("%u"), definition.index);
+
+         CString hashText;
+         hashText.Format(_T("0x%08x"), definition.hash);
+
+         CString parentsText;
+         for (const CString& parentName : definition.parentNames)
+            parentsText += (parentsText.IsEmpty() ? _T("") : _T(", ")) + parentName;
+
+         definitionData.push_back(
+            std::vector<CString> {
+               indexText,
+               definition.name,
+               DisplayFormatHelper::FormatBitFlagsFromMap(
+                  g_mapElfVersionFlagsToDisplayText, definition.flags),
+               hashText,
+               parentsText,
+            });
+      }
+
+      static std::vector<CString> definitionColumnNames
+      {
+         _T("Index"),
+         _T("Name"),
+         _T("Flags"),
+         _T("Hash"),
+         _T("Parents"),
+      };
+
+      rootNode.ChildNodes().push_back(
+         std::make_shared<FilterSortListViewNode>(
+            _T("Version Definitions"),
+            NodeTreeIconID::nodeTreeIconTable,
+            definitionColumnNames,
+            definitionData,
+            false));
+   }
+
+   if (!symbolVersions->Requirements().empty())
+   {
+      std::vector<std::vector<CString>> requirementData;
+      for (const ElfVersionRequirement& requirement : symbolVersions->Requirements())
+      {
+         CString indexText;
+         indexText.Format(_T("%u"), requirement.index);
+
+         CString hashText;
+         hashText.Format(_T("0x%08x"), requirement.hash);
+
+         requirementData.push_back(
+            std::vector<CString> {
+               indexText,
+               requirement.fileName,
+               requirement.name,
+               DisplayFormatHelper::FormatBitFlagsFromMap(
+                  g_mapElfVersionFlagsToDisplayText, requirement.flags),
+               hashText,
+            });
+      }
+
+      static std::vector<CString> requirementColumnNames
+      {
+         _T("Index"),
+         _T("File"),
+         _T("Version"),
+         _T("Flags"),
+         _T("Hash"),
+      };
+
+      rootNode.ChildNodes().push_back(
+         std::make_shared<FilterSortListViewNode>(
+            _T("Version Requirements"),
+            NodeTreeIconID::nodeTreeIconTable,
+            requirementColumnNames,
+            requirementData,
+            true));
+   }
+
+   const ElfSection* versionSymbolSection = symbolVersions->VersionSymbolSection();
+   if (versionSymbolSection == nullptr)
+      return;
+
+   // the .gnu.version section links to the symbol table it describes
+   std::shared_ptr<ElfSymbolTable> symbolTable;
+   if (versionSymbolSection->link < image->Sections().size())
+   {
+      symbolTable = std::make_shared<ElfSymbolTable>(
+         *image, image->Sections()[versionSymbolSection->link]);
+
+      if (!symbolTable->IsValid())
+         symbolTable.reset();
+   }
+
+   static std::vector<CString> versionSymbolColumnNames
+   {
+      _T("Index"),
+      _T("Symbol"),
+      _T("Version index"),
+      _T("Version"),
+      _T("Hidden"),
+   };
+
+   rootNode.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Symbol Versions"),
+         NodeTreeIconID::nodeTreeIconTable,
+         versionSymbolColumnNames,
+         symbolVersions->VersionSymbolCount(),
+         [image, symbolVersions, symbolTable](size_t index)
+         {
+            WORD versionIndex = symbolVersions->VersionIndex(index);
+
+            CString indexText;
+            indexText.Format(_T("%zu"), index);
+
+            CString versionIndexText;
+            versionIndexText.Format(_T("%u"), versionIndex & ~c_elfVersionHidden);
+
+            return std::vector<CString> {
+               indexText,
+               symbolTable != nullptr ? symbolTable->GetSymbol(index).name : CString(),
+               versionIndexText,
+               symbolVersions->VersionName(versionIndex),
+               (versionIndex & c_elfVersionHidden) != 0 ? _T("yes") : _T("no"),
+            };
+         },
+         true));
+}
+
+void ElfReader::AddRelocationTables(StaticNode& rootNode, CString& summaryText) const
+{
+   std::shared_ptr<ElfImage> image = m_image;
+
+   static std::vector<CString> relocationColumnNames
+   {
+      _T("Index"),
+      _T("Offset"),
+      _T("Type"),
+      _T("Symbol index"),
+      _T("Symbol"),
+      _T("Addend"),
+   };
+
+   for (const ElfSection& section : image->Sections())
+   {
+      if (section.type != c_elfSectionTypeRel &&
+         section.type != c_elfSectionTypeRela &&
+         section.type != c_elfSectionTypeRelr)
+         continue;
+
+      auto relocationTable = std::make_shared<ElfRelocationTable>(*image, section);
+
+      if (!relocationTable->IsValid())
+      {
+         summaryText.AppendFormat(_T("Error: Relocation section %s: %s\n"),
+            section.name.GetString(),
+            relocationTable->GetErrorText().GetString());
+         continue;
+      }
+
+      LPCTSTR formatName =
+         relocationTable->Format() == ElfRelocationFormat::rel ? _T("REL") :
+         relocationTable->Format() == ElfRelocationFormat::rela ? _T("RELA") : _T("RELR");
+
+      summaryText.AppendFormat(_T("Relocation section %s (%s) with %zu relocations.\n"),
+         section.name.GetString(),
+         formatName,
+         relocationTable->Count());
+
+      // REL and RELA sections link to the symbol table used by the relocations
+      std::shared_ptr<ElfSymbolTable> symbolTable;
+      if (relocationTable->Format() != ElfRelocationFormat::relr &&
+         section.link != 0 &&
+         section.link < image->Sections().size())
+      {
+         symbolTable = std::make_shared<ElfSymbolTable>(*image, image->Sections()[section.link]);
+         if (!symbolTable->IsValid())
+            symbolTable.reset();
+      }
+
+      const std::map<DWORD, LPCTSTR>& relocationTypeMap =
+         GetElfRelocationTypeMap(image->Machine());
+
+      rootNode.ChildNodes().push_back(
+         std::make_shared<FilterSortListViewNode>(
+            _T("Relocations ") + section.name,
+            NodeTreeIconID::nodeTreeIconTable,
+            relocationColumnNames,
+            relocationTable->Count(),
+            [image, relocationTable, symbolTable, &relocationTypeMap](size_t index)
+            {
+               ElfRelocation relocation = relocationTable->GetRelocation(index);
+               bool isRelr = relocationTable->Format() == ElfRelocationFormat::relr;
+
+               CString indexText;
+               indexText.Format(_T("%zu"), index);
+
+               CString offsetText;
+               offsetText.Format(_T("0x%08llx"), relocation.offset);
+
+               CString typeText;
+               if (isRelr)
+                  typeText = _T("relative");
+               else
+                  typeText.Format(_T("%u %s"), relocation.type,
+                     GetValueFromMapOrDefault<DWORD>(relocationTypeMap, relocation.type, _T("")));
+
+               CString symbolIndexText;
+               CString symbolName;
+               if (!isRelr)
+               {
+                  symbolIndexText.Format(_T("%u"), relocation.symbolIndex);
+
+                  if (symbolTable != nullptr && relocation.symbolIndex != 0)
+                     symbolName = symbolTable->GetSymbol(relocation.symbolIndex).name;
+               }
+
+               CString addendText;
+               if (relocationTable->Format() == ElfRelocationFormat::rela)
+                  addendText.Format(_T("%lld"), relocation.addend);
+
+               return std::vector<CString> {
+                  indexText,
+                  offsetText,
+                  typeText,
+                  symbolIndexText,
+                  symbolName,
+                  addendText,
+               };
+            },
+            true));
+   }
+}
+
+void ElfReader::AddCompressedSections(StaticNode& rootNode, CString& summaryText) const
+{
+   std::shared_ptr<ElfImage> image = m_image;
+   std::shared_ptr<ElfSectionDataCache> sectionDataCache = m_sectionDataCache;
+
+   const StructDefinition& compressionHeaderDefinition =
+      GetElfCompressionHeaderDefinition(image->Is64Bit(), image->IsLittleEndian());
+
+   std::vector<std::vector<CString>> compressedSectionData;
+   std::vector<std::shared_ptr<INode>> sectionDataNodes;
+   ULONGLONG totalCompressedSize = 0;
+   ULONGLONG totalUncompressedSize = 0;
+
+   for (const ElfSection& section : image->Sections())
+   {
+      // only the compression header is read here; the section data is
+      // decompressed when the section data node is shown
+      std::optional<ElfSectionCompression> compression = sectionDataCache->Compression(section);
+      if (!compression.has_value())
+         continue;
+
+      totalCompressedSize += section.size;
+      totalUncompressedSize += compression->uncompressedSize;
+
+      CString indexText;
+      indexText.Format(_T("%zu"), section.index);
+
+      CString compressionText = GetValueFromMapOrDefault<DWORD>(
+         g_mapElfCompressionTypeToDisplayText, compression->type, _T("unknown"));
+
+      if (compression->isZdebug)
+         compressionText += _T(" (.zdebug)");
+
+      CString compressedSizeText;
+      compressedSizeText.Format(_T("0x%08llx"), section.size);
+
+      CString uncompressedSizeText;
+      uncompressedSizeText.Format(_T("0x%08llx"), compression->uncompressedSize);
+
+      CString alignText;
+      alignText.Format(_T("%llu"), compression->uncompressedAlign);
+
+      compressedSectionData.push_back(
+         std::vector<CString> {
+            indexText,
+            section.name,
+            compressionText,
+            compressedSizeText,
+            uncompressedSizeText,
+            alignText,
+         });
+
+      CString name;
+      name.Format(_T("Section [%zu] %s, decompressed"), section.index, section.name.GetString());
+
+      size_t sectionIndex = section.index;
+      auto sectionDataNode = std::make_shared<HexDataViewNode>(
+         name,
+         NodeTreeIconID::nodeTreeIconBinary,
+         [image, sectionDataCache, sectionIndex](CString& errorText)
+         {
+            ElfSectionContents contents = sectionDataCache->SectionContents(
+               image->Sections()[sectionIndex], errorText);
+
+            return contents.buffer;
+         });
+
+      if (!compression->isZdebug &&
+         section.size >= compression->headerSize)
+      {
+         sectionDataNode->ChildNodes().push_back(
+            std::make_shared<StructListViewNode>(
+               _T("Compression header"),
+               NodeTreeIconID::nodeTreeIconBinary,
+               compressionHeaderDefinition,
+               image->SectionData(section),
+               m_file.Data()));
+      }
+
+      sectionDataNodes.push_back(sectionDataNode);
+   }
+
+   if (compressedSectionData.empty())
+      return;
+
+   summaryText.AppendFormat(
+      _T("%zu compressed sections, with %llu bytes compressed and %llu bytes uncompressed.\n"),
+      compressedSectionData.size(),
+      totalCompressedSize,
+      totalUncompressedSize);
+
+   static std::vector<CString> compressedSectionColumnNames
+   {
+      _T("Index"),
+      _T("Name"),
+      _T("Compression"),
+      _T("Compressed size"),
+      _T("Uncompressed size"),
+      _T("Align"),
+   };
+
+   auto compressedSectionsNode = std::make_shared<FilterSortListViewNode>(
+      _T("Compressed Sections"),
+      NodeTreeIconID::nodeTreeIconTable,
+      compressedSectionColumnNames,
+      compressedSectionData,
+      true);
+
+   compressedSectionsNode->ChildNodes() = sectionDataNodes;
+
+   rootNode.ChildNodes().push_back(compressedSectionsNode);
+}
+
+void ElfReader::AddDwarfDebugInfo(StaticNode& rootNode, CString& summaryText) const
+{
+   // .debug_info and .debug_abbrev are decompressed here, since the unit
+   // headers have to be scanned to build the unit index
+   DwarfSections sections = GetElfDwarfSections(m_image, m_sectionDataCache, summaryText);
+
+   if (!sections.info.IsAvailable())
+      return;
+
+   DwarfNodeTreeBuilder nodeTreeBuilder{ std::make_shared<DwarfReader>(sections) };
+   nodeTreeBuilder.AddNodes(rootNode, summaryText);
+}
@@ -0,0 +1,83 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfReader.hpp
+/// \brief reader for ELF files
+//
+#pragma once
+
+#include "modules/IReader.hpp"
+
+class StaticNode;
+class ElfImage;
+class ElfSectionDataCache;
+
+/// ELF file reader
+class ElfReader : public IReader
+{
+public:
+   /// determines if the given file is an ELF file
+   static bool IsElfFile(const File& file);
+
+   /// ctor
+   explicit ElfReader(const File& file);
+
+   // Inherited via IReader
+   const CString& Filename() const override
+   {
+      return m_file.Filename();
+   }
+
+   std::shared_ptr<INode> RootNode() const override
+   {
+      return m_rootNode;
+   }
+
+   void Load() override;
+   void Cleanup() override;
+
+private:
+   /// adds ELF header node
+   void AddElfHeader(StaticNode& rootNode, CString& summaryText) const;
+
+   /// adds section header table node
+   void AddSectionHeaders(StaticNode& rootNode, CString& summaryText) const;
+
+   /// adds program header table node
+   void AddProgramHeaders(StaticNode& rootNode, CString& summaryText) const;
+
+   /// adds notes node, from note sections or note segments
+   void AddNotes(StaticNode& rootNode, CString& summaryText) const;
+
+   /// adds symbol table nodes for all .symtab and .dynsym sections
+   void AddSymbolTables(StaticNode& rootNode, CString& summaryText) const;
+
+   /// adds dynamic section node
+   void AddDynamicSection(StaticNode& rootNode, CString& summaryText) const;
+
+   /// adds symbol version nodes, from the .gnu.version* sections
+   void AddSymbolVersions(StaticNode& rootNode, CString& summaryText) const;
+
+   /// adds relocation table nodes for all REL, RELA and RELR sections
+   void AddRelocationTables(StaticNode& rootNode, CString& summaryText) const;
+
+   /// adds compressed sections node, with lazily decompressed section data
+   void AddCompressedSections(StaticNode& rootNode, CString& summaryText) const;
+
+   /// adds DWARF debug information nodes, from the .debug_* sections
+   void AddDwarfDebugInfo(StaticNode& rootNode, CString& summaryText) const;
+
+private:
+   /// file to read from
+   File m_file;
+
+   /// ELF image; shared with nodes that format their rows lazily
+   std::shared_ptr<ElfImage> m_image;
+
+   /// section data cache, decompressing compressed sections on first access
+   std::shared_ptr<ElfSectionDataCache> m_sectionDataCache;
+
+   /// root node
+   std::shared_ptr<INode> m_rootNode;
+};
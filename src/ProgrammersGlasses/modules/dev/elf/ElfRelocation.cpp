@@ -0,0 +1,135 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfRelocation.cpp
+/// \brief ELF relocation entry definitions
+//
+#include "stdafx.h"
+#include "ElfRelocation.hpp"
+
+/// EM_386: Intel 80386
+constexpr WORD c_elfMachineI386 = 3;
+
+/// EM_ARM: ARM 32-bit
+constexpr WORD c_elfMachineArm = 40;
+
+/// EM_X86_64: AMD x86-64
+constexpr WORD c_elfMachineX86_64 = 62;
+
+/// EM_AARCH64: ARM 64-bit
+constexpr WORD c_elfMachineAArch64 = 183;
+
+/// mapping of i386 relocation types to display text
+static const std::map<DWORD, LPCTSTR> g_mapElfRelocationTypeI386ToDisplayText =
+{
+   { 0, _T("R_386_NONE") },
+   { 1, _T("R_386_32") },
+   { 2, _T("R_386_PC32") },
+   { 3, _T("R_386_GOT32") },
+   { 4, _T("R_386_PLT32") },
+   { 5, _T("R_386_COPY") },
+   { 6, _T("R_386_GLOB_DAT") },
+   { 7, _T("R_386_JMP_SLOT") },
+   { 8, _T("R_386_RELATIVE") },
+   { 9, _T("R_386_GOTOFF") },
+   { 10, _T("R_386_GOTPC") },
+   { 14, _T("R_386_TLS_TPOFF") },
+   { 35, _T("R_386_TLS_DTPMOD32") },
+   { 36, _T("R_386_TLS_DTPOFF32") },
+   { 37, _T("R_386_TLS_TPOFF32") },
+   { 42, _T("R_386_IRELATIVE") },
+   { 43, _T("R_386_GOT32X") },
+};
+
+/// mapping of ARM relocation types to display text
+static const std::map<DWORD, LPCTSTR> g_mapElfRelocationTypeArmToDisplayText =
+{
+   { 0, _T("R_ARM_NONE") },
+   { 2, _T("R_ARM_ABS32") },
+   { 3, _T("R_ARM_REL32") },
+   { 17, _T("R_ARM_TLS_DTPMOD32") },
+   { 18, _T("R_ARM_TLS_DTPOFF32") },
+   { 19, _T("R_ARM_TLS_TPOFF32") },
+   { 20, _T("R_ARM_COPY") },
+   { 21, _T("R_ARM_GLOB_DAT") },
+   { 22, _T("R_ARM_JUMP_SLOT") },
+   { 23, _T("R_ARM_RELATIVE") },
+   { 28, _T("R_ARM_CALL") },
+   { 29, _T("R_ARM_JUMP24") },
+   { 160, _T("R_ARM_IRELATIVE") },
+};
+
+/// mapping of x86-64 relocation types to display text
+static const std::map<DWORD, LPCTSTR> g_mapElfRelocationTypeX86_64ToDisplayText =
+{
+   { 0, _T("R_X86_64_NONE") },
+   { 1, _T("R_X86_64_64") },
+   { 2, _T("R_X86_64_PC32") },
+   { 3, _T("R_X86_64_GOT32") },
+   { 4, _T("R_X86_64_PLT32") },
+   { 5, _T("R_X86_64_COPY") },
+   { 6, _T("R_X86_64_GLOB_DAT") },
+   { 7, _T("R_X86_64_JUMP_SLOT") },
+   { 8, _T("R_X86_64_RELATIVE") },
+   { 9, _T("R_X86_64_GOTPCREL") },
+   { 10, _T("R_X86_64_32") },
+   { 11, _T("R_X86_64_32S") },
+   { 12, _T("R_X86_64_16") },
+   { 13, _T("R_X86_64_PC16") },
+   { 14, _T("R_X86_64_8") },
+   { 15, _T("R_X86_64_PC8") },
+   { 16, _T("R_X86_64_DTPMOD64") },
+   { 17, _T("R_X86_64_DTPOFF64") },
+   { 18, _T("R_X86_64_TPOFF64") },
+   { 19, _T("R_X86_64_TLSGD") },
+   { 20, _T("R_X86_64_TLSLD") },
+   { 21, _T("R_X86_64_DTPOFF32") },
+   { 22, _T("R_X86_64_GOTTPOFF") },
+   { 23, _T("R_X86_64_TPOFF32") },
+   { 24, _T("R_X86_64_PC64") },
+   { 25, _T("R_X86_64_GOTOFF64") },
+   { 26, _T("R_X86_64_GOTPC32") },
+   { 37, _T("R_X86_64_IRELATIVE") },
+   { 41, _T("R_X86_64_GOTPCRELX") },
+   { 42, _T("R_X86_64_REX_GOTPCRELX") },
+};
+
+/// mapping of AArch64 relocation types to display text
+static const std::map<DWORD, LPCTSTR> g_mapElfRelocationTypeAArch64ToDisplayText =
+{
+   { 0, _T("R_AARCH64_NONE") },
+   { 257, _T("R_AARCH64_ABS64") },
+   { 258, _T("R_AARCH64_ABS32") },
+   { 260, _T("R_AARCH64_PREL64") },
+   { 261, _T("R_AARCH64_PREL32") },
+   { 275, _T("R_AARCH64_ADR_PREL_PG_HI21") },
+   { 277, _T("R_AARCH64_ADD_ABS_LO12_NC") },
+   { 282, _T("R_AARCH64_JUMP26") },
+   { 283, _T("R_AARCH64_CALL26") },
+   { 311, _T("R_AARCH64_ADR_GOT_PAGE") },
+   { 312, _T("R_AARCH64_LD64_GOT_LO12_NC") },
+   { 1024, _T("R_AARCH64_COPY") },
+   { 1025, _T("R_AARCH64_GLOB_DAT") },
+   { 1026, _T("R_AARCH64_JUMP_SLOT") },
+   { 1027, _T("R_AARCH64_RELATIVE") },
+   { 1028, _T("R_AARCH64_TLS_DTPMOD") },
+   { 1029, _T("R_AARCH64_TLS_DTPREL") },
+   { 1030, _T("R_AARCH64_TLS_TPREL") },
+   { 1031, _T("R_AARCH64_TLSDESC") },
+   { 1032, _T("R_AARCH64_IRELATIVE") },
+};
+
+const std::map<DWORD, LPCTSTR>& GetElfRelocationTypeMap(WORD machine)
+{
+   static const std::map<DWORD, LPCTSTR> emptyMap;
+
+   switch (machine)
+   {
+   case c_elfMachineI386: return g_mapElfRelocationTypeI386ToDisplayText;
+   case c_elfMachineArm: return g_mapElfRelocationTypeArmToDisplayText;
+   case c_elfMachineX86_64: return g_mapElfRelocationTypeX86_64ToDisplayText;
+   case c_elfMachineAArch64: return g_mapElfRelocationTypeAArch64ToDisplayText;
+   default: return emptyMap;
+   }
+}
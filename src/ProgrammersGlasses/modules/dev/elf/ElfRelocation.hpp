@@ -0,0 +1,61 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfRelocation.hpp
+/// \brief ELF relocation entry definitions
+//
+#pragma once
+
+#pragma pack(push, 1)
+
+/// \brief ELF relocation entry without addend, for 32-bit files
+/// \see https://refspecs.linuxfoundation.org/elf/gabi4+/ch4.reloc.html
+struct Elf32Rel
+{
+   DWORD offset;                 ///< location to apply the relocation to
+   DWORD info;                   ///< symbol index (upper 24 bits) and type (lower 8 bits)
+};
+
+/// \brief ELF relocation entry with addend, for 32-bit files
+struct Elf32Rela
+{
+   DWORD offset;                 ///< location to apply the relocation to
+   DWORD info;                   ///< symbol index (upper 24 bits) and type (lower 8 bits)
+   LONG addend;                  ///< constant addend
+};
+
+/// \brief ELF relocation entry without addend, for 64-bit files
+struct Elf64Rel
+{
+   ULONGLONG offset;             ///< location to apply the relocation to
+   ULONGLONG info;               ///< symbol index (upper 32 bits) and type (lower 32 bits)
+};
+
+/// \brief ELF relocation entry with addend, for 64-bit files
+struct Elf64Rela
+{
+   ULONGLONG offset;             ///< location to apply the relocation to
+   ULONGLONG info;               ///< symbol index (upper 32 bits) and type (lower 32 bits)
+   LONGLONG addend;              ///< constant addend
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(Elf32Rel) == 8, "ELF32 relocation must be 8 bytes long");
+static_assert(sizeof(Elf32Rela) == 12, "ELF32 relocation with addend must be 12 bytes long");
+static_assert(sizeof(Elf64Rel) == 16, "ELF64 relocation must be 16 bytes long");
+static_assert(sizeof(Elf64Rela) == 24, "ELF64 relocation with addend must be 24 bytes long");
+
+/// SHT_RELA: relocation entries with addends
+constexpr DWORD c_elfSectionTypeRela = 4;
+
+/// SHT_REL: relocation entries without addends
+constexpr DWORD c_elfSectionTypeRel = 9;
+
+/// SHT_RELR: relative relocations, in packed format
+constexpr DWORD c_elfSectionTypeRelr = 19;
+
+/// returns the mapping of relocation types to display text for a machine;
+/// the mapping is empty for unknown machines
+const std::map<DWORD, LPCTSTR>& GetElfRelocationTypeMap(WORD machine);
@@ -0,0 +1,193 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfRelocationTable.cpp
+/// \brief ELF relocation table, for REL, RELA and RELR sections
+//
+#include "stdafx.h"
+#include "ElfRelocationTable.hpp"
+#include <algorithm>
+
+ElfRelocationTable::ElfRelocationTable(const ElfImage& image, const ElfSection& relocationSection)
+   :m_image(image),
+   m_section(relocationSection)
+{
+   size_t minEntrySize = 0;
+   switch (m_section.type)
+   {
+   case c_elfSectionTypeRel:
+      m_format = ElfRelocationFormat::rel;
+      minEntrySize = m_image.Is64Bit() ? sizeof(Elf64Rel) : sizeof(Elf32Rel);
+      break;
+
+   case c_elfSectionTypeRela:
+      m_format = ElfRelocationFormat::rela;
+      minEntrySize = m_image.Is64Bit() ? sizeof(Elf64Rela) : sizeof(Elf32Rela);
+      break;
+
+   case c_elfSectionTypeRelr:
+      m_format = ElfRelocationFormat::relr;
+      minEntrySize = m_image.Is64Bit() ? sizeof(ULONGLONG) : sizeof(DWORD);
+      break;
+
+   default:
+      m_errorText = _T("Section is not a relocation section");
+      return;
+   }
+
+   m_entries = m_image.SectionData(m_section);
+   if (m_entries == nullptr)
+   {
+      m_errorText = _T("Relocation section is outside of the file");
+      return;
+   }
+
+   m_entrySize = m_section.entrySize != 0
+      ? static_cast<size_t>(m_section.entrySize)
+      : minEntrySize;
+
+   if (m_entrySize < minEntrySize ||
+      (m_format == ElfRelocationFormat::relr && m_entrySize != minEntrySize))
+   {
+      m_errorText = _T("Relocation section has an invalid entry size");
+      return;
+   }
+
+   size_t entryCount = static_cast<size_t>(m_section.size / m_entrySize);
+
+   if (m_format == ElfRelocationFormat::relr)
+   {
+      m_relrWords.reserve(entryCount);
+      m_image.Dispatch([&](auto layout) { IndexRelrWords(layout); });
+   }
+   else
+      m_count = entryCount;
+
+   m_isValid = true;
+}
+
+template <typename TLayout>
+void ElfRelocationTable::IndexRelrWords(TLayout layout)
+{
+   using Word = typename TLayout::Address;
+   constexpr size_t bitmapBits = sizeof(Word) * 8 - 1;
+
+   const Word* words = reinterpret_cast<const Word*>(m_entries);
+   size_t wordCount = static_cast<size_t>(m_section.size / sizeof(Word));
+
+   ULONGLONG nextAddress = 0;
+   size_t relocationCount = 0;
+
+   for (size_t index = 0; index < wordCount; index++)
+   {
+      Word word = layout.Get(words[index]);
+
+      m_relrWords.push_back(RelrWordInfo{ relocationCount, nextAddress });
+
+      if ((word & 1) == 0)
+      {
+         // address word: one relocation, following bitmaps start after it
+         relocationCount++;
+         nextAddress = static_cast<ULONGLONG>(word) + sizeof(Word);
+      }
+      else
+      {
+         // bitmap word: bit n+1 relocates the n-th word after the base address
+         Word bitmap = word >> 1;
+         while (bitmap != 0)
+         {
+            relocationCount += bitmap & 1;
+            bitmap >>= 1;
+         }
+
+         nextAddress += bitmapBits * sizeof(Word);
+      }
+   }
+
+   m_count = relocationCount;
+}
+
+ElfRelocation ElfRelocationTable::GetRelocation(size_t index) const
+{
+   if (index >= m_count)
+      return ElfRelocation{};
+
+   return m_image.Dispatch([&](auto layout)
+      {
+         using TLayout = decltype(layout);
+
+         switch (m_format)
+         {
+         case ElfRelocationFormat::rel:
+            return DecodeRelocation<TLayout, typename TLayout::Rel>(layout, index);
+         case ElfRelocationFormat::rela:
+            return DecodeRelocation<TLayout, typename TLayout::Rela>(layout, index);
+         default:
+            return DecodeRelrRelocation(layout, index);
+         }
+      });
+}
+
+template <typename TLayout, typename TEntry>
+ElfRelocation ElfRelocationTable::DecodeRelocation(TLayout layout, size_t index) const
+{
+   const BYTE* entry = m_entries + index * m_entrySize;
+   const TEntry& rawRelocation = *reinterpret_cast<const TEntry*>(entry);
+
+   auto info = layout.Get(rawRelocation.info);
+
+   ElfRelocation relocation;
+   relocation.offset = layout.Get(rawRelocation.offset);
+   relocation.type = TLayout::RelocationType(info);
+   relocation.symbolIndex = TLayout::RelocationSymbol(info);
+   relocation.entry = entry;
+
+   if constexpr (std::is_same_v<TEntry, typename TLayout::Rela>)
+      relocation.addend = layout.Get(rawRelocation.addend);
+
+   return relocation;
+}
+
+template <typename TLayout>
+ElfRelocation ElfRelocationTable::DecodeRelrRelocation(TLayout layout, size_t index) const
+{
+   using Word = typename TLayout::Address;
+
+   // find the last word whose first relocation is at or before the index;
+   // words encoding no relocations share their first index with the next
+   // word and so are skipped
+   auto iter = std::upper_bound(m_relrWords.begin(), m_relrWords.end(), index,
+      [](size_t value, const RelrWordInfo& info) { return value < info.firstRelocation; });
+
+   ATLASSERT(iter != m_relrWords.begin());
+
+   size_t wordIndex = static_cast<size_t>(iter - m_relrWords.begin()) - 1;
+   const RelrWordInfo& wordInfo = m_relrWords[wordIndex];
+
+   const Word* wordPtr = reinterpret_cast<const Word*>(m_entries) + wordIndex;
+   Word word = layout.Get(*wordPtr);
+
+   ElfRelocation relocation;
+   relocation.entry = reinterpret_cast<const BYTE*>(wordPtr);
+
+   if ((word & 1) == 0)
+   {
+      relocation.offset = word;
+      return relocation;
+   }
+
+   size_t bitNumber = index - wordInfo.firstRelocation;
+   Word bitmap = word >> 1;
+
+   for (size_t bit = 0; bitmap != 0; bit++, bitmap >>= 1)
+   {
+      if ((bitmap & 1) != 0 && bitNumber-- == 0)
+      {
+         relocation.offset = wordInfo.baseAddress + bit * sizeof(Word);
+         break;
+      }
+   }
+
+   return relocation;
+}
@@ -0,0 +1,122 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfRelocationTable.hpp
+/// \brief ELF relocation table, for REL, RELA and RELR sections
+//
+#pragma once
+
+#include "ElfImage.hpp"
+
+/// relocation section format
+enum class ElfRelocationFormat
+{
+   rel,     ///< SHT_REL entries, without addend
+   rela,    ///< SHT_RELA entries, with addend
+   relr,    ///< SHT_RELR packed relative relocations
+};
+
+/// \brief ELF relocation, with values converted to host byte order
+struct ElfRelocation
+{
+   /// location to apply the relocation to
+   ULONGLONG offset = 0;
+
+   /// relocation type; machine specific; 0 for RELR relocations
+   DWORD type = 0;
+
+   /// symbol index in the linked symbol table
+   DWORD symbolIndex = 0;
+
+   /// addend, for SHT_RELA entries
+   LONGLONG addend = 0;
+
+   /// pointer to the relocation entry in the file; for RELR relocations this
+   /// is the address or bitmap word the relocation was decoded from
+   const BYTE* entry = nullptr;
+};
+
+/// \brief ELF relocation table
+/// \details Decodes relocations directly from the mapped section, only when
+/// requested. REL and RELA entries are accessed by index. RELR sections
+/// encode relative relocations as address words, each followed by bitmap
+/// words for the next 31 or 63 words; on construction, a single pass over
+/// the words records the first relocation index and the base address of
+/// each word, so that every relocation can be decoded in logarithmic time
+/// without storing the relocations themselves.
+class ElfRelocationTable
+{
+public:
+   /// ctor; the image must outlive the relocation table
+   ElfRelocationTable(const ElfImage& image, const ElfSection& relocationSection);
+
+   /// returns if the relocation table is valid
+   bool IsValid() const { return m_isValid; }
+
+   /// returns an error text, when the relocation table is invalid
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the relocation section
+   const ElfSection& Section() const { return m_section; }
+
+   /// returns the relocation section format
+   ElfRelocationFormat Format() const { return m_format; }
+
+   /// returns the number of relocations
+   size_t Count() const { return m_count; }
+
+   /// decodes the relocation with given index
+   ElfRelocation GetRelocation(size_t index) const;
+
+private:
+   /// info about a single RELR word
+   struct RelrWordInfo
+   {
+      /// index of the first relocation encoded in the word
+      size_t firstRelocation;
+
+      /// address of the first bit of a bitmap word
+      ULONGLONG baseAddress;
+   };
+
+   /// indexes all RELR words and counts the relocations
+   template <typename TLayout>
+   void IndexRelrWords(TLayout layout);
+
+   /// decodes a REL or RELA relocation
+   template <typename TLayout, typename TEntry>
+   ElfRelocation DecodeRelocation(TLayout layout, size_t index) const;
+
+   /// decodes a RELR relocation
+   template <typename TLayout>
+   ElfRelocation DecodeRelrRelocation(TLayout layout, size_t index) const;
+
+private:
+   /// ELF image
+   const ElfImage& m_image;
+
+   /// relocation section
+   const ElfSection& m_section;
+
+   /// indicates if relocation table is valid
+   bool m_isValid = false;
+
+   /// error text
+   CString m_errorText;
+
+   /// relocation section format
+   ElfRelocationFormat m_format = ElfRelocationFormat::rel;
+
+   /// pointer to the first entry or word
+   const BYTE* m_entries = nullptr;
+
+   /// size of an entry or word
+   size_t m_entrySize = 0;
+
+   /// number of relocations
+   size_t m_count = 0;
+
+   /// infos for all RELR words
+   std::vector<RelrWordInfo> m_relrWords;
+};
@@ -0,0 +1,263 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfSectionDataCache.cpp
+/// \brief ELF section data access, with decompression of compressed sections
+//
+#include "stdafx.h"
+#include "ElfSectionDataCache.hpp"
+#include <zlib.h>
+#include <zstd.h>
+#include <limits>
+
+/// maximum uncompressed size of a section; guards against bogus sizes in
+/// compression headers
+constexpr ULONGLONG c_maxUncompressedSectionSize = 1024 * 1024 * 1024;
+
+ElfSectionDataCache::ElfSectionDataCache(const ElfImage& image, size_t maxCacheSize)
+   :m_image(image),
+   m_maxCacheSize(maxCacheSize)
+{
+}
+
+bool ElfSectionDataCache::IsCompressed(const ElfSection& section) const
+{
+   return Compression(section).has_value();
+}
+
+std::optional<ElfSectionCompression> ElfSectionDataCache::Compression(const ElfSection& section) const
+{
+   const BYTE* data = m_image.SectionData(section);
+   if (data == nullptr)
+      return std::nullopt;
+
+   if ((section.flags & c_elfSectionFlagCompressed) != 0)
+   {
+      return m_image.Dispatch([&](auto layout)
+         {
+            using CompressionHeader = typename decltype(layout)::CompressionHeader;
+
+            ElfSectionCompression compression;
+            compression.headerSize = sizeof(CompressionHeader);
+
+            // a truncated header is reported when decompressing
+            if (section.size < sizeof(CompressionHeader))
+               return compression;
+
+            const CompressionHeader& header = *reinterpret_cast<const CompressionHeader*>(data);
+
+            compression.type = layout.Get(header.type);
+            compression.uncompressedSize = layout.Get(header.size);
+            compression.uncompressedAlign = layout.Get(header.addressAlign);
+
+            return compression;
+         });
+   }
+
+   if (section.name.Find(_T(".zdebug")) != 0 ||
+      section.size < c_elfZdebugHeaderSize ||
+      memcmp(data, c_elfZdebugMagic, sizeof(c_elfZdebugMagic)) != 0)
+      return std::nullopt;
+
+   ElfSectionCompression compression;
+   compression.type = c_elfCompressionTypeZlib;
+   compression.isZdebug = true;
+   compression.headerSize = c_elfZdebugHeaderSize;
+   compression.uncompressedAlign = section.addressAlign;
+
+   // the size is stored big-endian, regardless of the data encoding
+   for (size_t index = 0; index < sizeof(ULONGLONG); index++)
+      compression.uncompressedSize = (compression.uncompressedSize << 8) |
+         data[sizeof(c_elfZdebugMagic) + index];
+
+   return compression;
+}
+
+ElfSectionContents ElfSectionDataCache::SectionContents(const ElfSection& section, CString& errorText)
+{
+   std::optional<ElfSectionCompression> compression = Compression(section);
+   if (!compression.has_value())
+   {
+      const BYTE* data = m_image.SectionData(section);
+      if (data == nullptr)
+      {
+         errorText = _T("Section has no data in the file");
+         return ElfSectionContents{};
+      }
+
+      return ElfSectionContents{ data, static_cast<size_t>(section.size), nullptr };
+   }
+
+   {
+      std::scoped_lock lock{ m_cacheLock };
+
+      auto iter = m_cacheMap.find(section.index);
+      if (iter != m_cacheMap.end())
+      {
+         // move to the front, as most recently used
+         m_cacheList.splice(m_cacheList.begin(), m_cacheList, iter->second);
+
+         const std::shared_ptr<const std::vector<BYTE>>& buffer = iter->second->buffer;
+         return ElfSectionContents{ buffer->data(), buffer->size(), buffer };
+      }
+   }
+
+   // decompress outside of the lock, so that other sections can be accessed
+   std::shared_ptr<const std::vector<BYTE>> buffer =
+      Decompress(section, compression.value(), errorText);
+
+   if (buffer == nullptr)
+      return ElfSectionContents{};
+
+   AddToCache(section.index, buffer);
+
+   return ElfSectionContents{ buffer->data(), buffer->size(), buffer };
+}
+
+size_t ElfSectionDataCache::CachedSize() const
+{
+   std::scoped_lock lock{ m_cacheLock };
+   return m_cachedSize;
+}
+
+std::shared_ptr<std::vector<BYTE>> ElfSectionDataCache::Decompress(const ElfSection& section,
+   const ElfSectionCompression& compression, CString& errorText) const
+{
+   if (compression.headerSize > section.size)
+   {
+      errorText = _T("Compression header is outside of the section");
+      return nullptr;
+   }
+
+   if (compression.type != c_elfCompressionTypeZlib &&
+      compression.type != c_elfCompressionTypeZstd)
+   {
+      errorText.Format(_T("Unsupported compression type %u"), compression.type);
+      return nullptr;
+   }
+
+   if (compression.uncompressedSize == 0 ||
+      compression.uncompressedSize > c_maxUncompressedSectionSize ||
+      compression.uncompressedSize > std::numeric_limits<size_t>::max())
+   {
+      errorText.Format(_T("Invalid uncompressed section size 0x%llx"), compression.uncompressedSize);
+      return nullptr;
+   }
+
+   const BYTE* data = m_image.SectionData(section) + compression.headerSize;
+   size_t size = static_cast<size_t>(section.size) - compression.headerSize;
+
+   auto buffer = std::make_shared<std::vector<BYTE>>(
+      static_cast<size_t>(compression.uncompressedSize));
+
+   bool result = compression.type == c_elfCompressionTypeZlib
+      ? DecompressZlib(data, size, *buffer, errorText)
+      : DecompressZstd(data, size, *buffer, errorText);
+
+   return result ? buffer : nullptr;
+}
+
+bool ElfSectionDataCache::DecompressZlib(const BYTE* data, size_t size,
+   std::vector<BYTE>& output, CString& errorText)
+{
+   z_stream stream = {};
+   if (inflateInit(&stream) != Z_OK)
+   {
+      errorText = _T("zlib decompression couldn't be initialized");
+      return false;
+   }
+
+   // zlib takes 32-bit sizes, so input and output are passed in chunks
+   const size_t maxChunkSize = std::numeric_limits<uInt>::max();
+
+   size_t inputOffset = 0;
+   size_t outputOffset = 0;
+
+   int result = Z_OK;
+   do
+   {
+      if (stream.avail_in == 0 && inputOffset < size)
+      {
+         stream.next_in = const_cast<Bytef*>(data + inputOffset);
+         stream.avail_in = static_cast<uInt>(std::min(size - inputOffset, maxChunkSize));
+         inputOffset += stream.avail_in;
+      }
+
+      if (stream.avail_out == 0 && outputOffset < output.size())
+      {
+         stream.next_out = output.data() + outputOffset;
+         stream.avail_out = static_cast<uInt>(std::min(output.size() - outputOffset, maxChunkSize));
+         outputOffset += stream.avail_out;
+      }
+
+      result = inflate(&stream, Z_NO_FLUSH);
+   } while (result == Z_OK);
+
+   size_t decompressedSize = outputOffset - stream.avail_out;
+
+   if (result != Z_STREAM_END)
+   {
+      if (result == Z_BUF_ERROR && decompressedSize == output.size())
+         errorText = _T("Decompressed data is larger than the uncompressed size");
+      else
+         errorText.Format(_T("zlib decompression failed: %hs"),
+            stream.msg != nullptr ? stream.msg : "unexpected end of data");
+   }
+   else if (decompressedSize != output.size())
+      errorText = _T("Decompressed data is smaller than the uncompressed size");
+
+   inflateEnd(&stream);
+
+   return result == Z_STREAM_END && decompressedSize == output.size();
+}
+
+bool ElfSectionDataCache::DecompressZstd(const BYTE* data, size_t size,
+   std::vector<BYTE>& output, CString& errorText)
+{
+   // decompresses all frames; the output buffer already has the final size
+   size_t result = ZSTD_decompress(output.data(), output.size(), data, size);
+
+   if (ZSTD_isError(result))
+   {
+      errorText.Format(_T("zstd decompression failed: %hs"), ZSTD_getErrorName(result));
+      return false;
+   }
+
+   if (result != output.size())
+   {
+      errorText = _T("Decompressed data is smaller than the uncompressed size");
+      return false;
+   }
+
+   return true;
+}
+
+void ElfSectionDataCache::AddToCache(size_t sectionIndex,
+   std::shared_ptr<const std::vector<BYTE>> buffer)
+{
+   // sections larger than the whole cache are never cached; the caller still
+   // holds the buffer as long as it's needed
+   if (buffer->size() > m_maxCacheSize)
+      return;
+
+   std::scoped_lock lock{ m_cacheLock };
+
+   // another thread may have decompressed the same section in the meantime
+   if (m_cacheMap.find(sectionIndex) != m_cacheMap.end())
+      return;
+
+   while (!m_cacheList.empty() &&
+      m_cachedSize + buffer->size() > m_maxCacheSize)
+   {
+      const CacheEntry& oldestEntry = m_cacheList.back();
+
+      m_cachedSize -= oldestEntry.buffer->size();
+      m_cacheMap.erase(oldestEntry.sectionIndex);
+      m_cacheList.pop_back();
+   }
+
+   m_cachedSize += buffer->size();
+   m_cacheList.push_front(CacheEntry{ sectionIndex, buffer });
+   m_cacheMap[sectionIndex] = m_cacheList.begin();
+}
@@ -0,0 +1,124 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfSectionDataCache.hpp
+/// \brief ELF section data access, with decompression of compressed sections
+//
+#pragma once
+
+#include "ElfImage.hpp"
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+/// \brief Compression info of an ELF section
+struct ElfSectionCompression
+{
+   /// compression type; ELFCOMPRESS_* value
+   DWORD type = 0;
+
+   /// indicates a legacy .zdebug_* section, instead of SHF_COMPRESSED
+   bool isZdebug = false;
+
+   /// size of the header preceding the compressed data
+   size_t headerSize = 0;
+
+   /// size of the uncompressed data
+   ULONGLONG uncompressedSize = 0;
+
+   /// alignment of the uncompressed data
+   ULONGLONG uncompressedAlign = 0;
+};
+
+/// \brief Contents of an ELF section, decompressed when necessary
+struct ElfSectionContents
+{
+   /// pointer to the section contents; nullptr when not available
+   const BYTE* data = nullptr;
+
+   /// size of the section contents
+   size_t size = 0;
+
+   /// decompressed data buffer; keeps the data alive, even when it was
+   /// already evicted from the cache; empty for uncompressed sections
+   std::shared_ptr<const std::vector<BYTE>> buffer;
+};
+
+/// \brief ELF section data cache
+/// \details Provides the contents of all sections. Uncompressed sections are
+/// accessed directly in the mapped file. Compressed sections, either with the
+/// SHF_COMPRESSED flag (zlib or zstd) or legacy .zdebug_* sections (zlib), are
+/// decompressed on first access only. The decompressed data is kept in a
+/// cache bounded by the total decompressed size; the least recently used
+/// sections are evicted first.
+class ElfSectionDataCache
+{
+public:
+   /// default maximum size of all cached decompressed sections
+   static constexpr size_t c_defaultMaxCacheSize = 64 * 1024 * 1024;
+
+   /// ctor; the image must outlive the cache
+   explicit ElfSectionDataCache(const ElfImage& image,
+      size_t maxCacheSize = c_defaultMaxCacheSize);
+
+   /// returns if a section is compressed
+   bool IsCompressed(const ElfSection& section) const;
+
+   /// returns the compression info of a compressed section, without
+   /// decompressing it; returns std::nullopt when the section isn't compressed
+   std::optional<ElfSectionCompression> Compression(const ElfSection& section) const;
+
+   /// returns the section contents; decompresses compressed sections on first
+   /// access. On errors, the contents data is nullptr and an error text is set.
+   ElfSectionContents SectionContents(const ElfSection& section, CString& errorText);
+
+   /// returns the total size of all currently cached decompressed sections
+   size_t CachedSize() const;
+
+private:
+   /// decompresses the section data into a new buffer
+   std::shared_ptr<std::vector<BYTE>> Decompress(const ElfSection& section,
+      const ElfSectionCompression& compression, CString& errorText) const;
+
+   /// decompresses a zlib stream; the output buffer has the uncompressed size
+   static bool DecompressZlib(const BYTE* data, size_t size,
+      std::vector<BYTE>& output, CString& errorText);
+
+   /// decompresses one or more zstd frames; the output buffer has the
+   /// uncompressed size
+   static bool DecompressZstd(const BYTE* data, size_t size,
+      std::vector<BYTE>& output, CString& errorText);
+
+   /// adds a decompressed section to the cache, evicting old sections
+   void AddToCache(size_t sectionIndex, std::shared_ptr<const std::vector<BYTE>> buffer);
+
+private:
+   /// cached decompressed section
+   struct CacheEntry
+   {
+      /// section index
+      size_t sectionIndex = 0;
+
+      /// decompressed data
+      std::shared_ptr<const std::vector<BYTE>> buffer;
+   };
+
+   /// ELF image
+   const ElfImage& m_image;
+
+   /// maximum size of all cached decompressed sections
+   size_t m_maxCacheSize;
+
+   /// lock for the cache
+   mutable std::mutex m_cacheLock;
+
+   /// cached sections; most recently used first
+   std::list<CacheEntry> m_cacheList;
+
+   /// mapping of section index to cached section
+   std::unordered_map<size_t, std::list<CacheEntry>::iterator> m_cacheMap;
+
+   /// total size of all cached sections
+   size_t m_cachedSize = 0;
+};
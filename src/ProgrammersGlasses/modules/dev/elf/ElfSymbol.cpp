@@ -0,0 +1,132 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfSymbol.cpp
+/// \brief ELF symbol table entry and hash table definitions
+//
+#include "stdafx.h"
+#include "ElfSymbol.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapElfSymbolBindingToDisplayText =
+{
+   { 0, _T("STB_LOCAL") },
+   { 1, _T("STB_GLOBAL") },
+   { 2, _T("STB_WEAK") },
+   { 10, _T("STB_GNU_UNIQUE") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfSymbolTypeToDisplayText =
+{
+   { 0, _T("STT_NOTYPE") },
+   { 1, _T("STT_OBJECT") },
+   { 2, _T("STT_FUNC") },
+   { 3, _T("STT_SECTION") },
+   { 4, _T("STT_FILE") },
+   { 5, _T("STT_COMMON") },
+   { 6, _T("STT_TLS") },
+   { 10, _T("STT_GNU_IFUNC") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfSymbolVisibilityToDisplayText =
+{
+   { 0, _T("STV_DEFAULT") },
+   { 1, _T("STV_INTERNAL") },
+   { 2, _T("STV_HIDDEN") },
+   { 3, _T("STV_PROTECTED") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapElfSpecialSectionIndexToDisplayText =
+{
+   { 0, _T("SHN_UNDEF") },
+   { 0xfff1, _T("SHN_ABS") },
+   { 0xfff2, _T("SHN_COMMON") },
+   { 0xffff, _T("SHN_XINDEX") },
+};
+
+/// ELF symbol info bitfield
+static const std::vector<BitfieldDescriptor> g_listElfSymbolInfoBits =
+{
+   BitfieldDescriptor{ 0, 4, StructFieldType::valueMapping, g_mapElfSymbolTypeToDisplayText },
+   BitfieldDescriptor{ 4, 4, StructFieldType::valueMapping, g_mapElfSymbolBindingToDisplayText },
+};
+
+/// ELF symbol other bitfield
+static const std::vector<BitfieldDescriptor> g_listElfSymbolOtherBits =
+{
+   BitfieldDescriptor{ 0, 2, StructFieldType::valueMapping, g_mapElfSymbolVisibilityToDisplayText },
+};
+
+/// creates the struct definition for ELF32 or ELF64 symbols
+template <typename TSymbol>
+static StructDefinition CreateElfSymbolDefinition(bool littleEndian)
+{
+   return StructDefinition({
+      StructField(
+         offsetof(TSymbol, name),
+         sizeof(TSymbol::name),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Name offset")),
+
+      StructField(
+         offsetof(TSymbol, value),
+         sizeof(TSymbol::value),
+         sizeof(TSymbol::value),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Value")),
+
+      StructField(
+         offsetof(TSymbol, size),
+         sizeof(TSymbol::size),
+         sizeof(TSymbol::size),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Size")),
+
+      StructField(
+         offsetof(TSymbol, info),
+         sizeof(TSymbol::info),
+         1,
+         true, // single byte
+         StructFieldType::bitfieldMapping,
+         g_listElfSymbolInfoBits,
+         _T("Type and binding")),
+
+      StructField(
+         offsetof(TSymbol, other),
+         sizeof(TSymbol::other),
+         1,
+         true, // single byte
+         StructFieldType::bitfieldMapping,
+         g_listElfSymbolOtherBits,
+         _T("Visibility")),
+
+      StructField(
+         offsetof(TSymbol, sectionIndex),
+         sizeof(TSymbol::sectionIndex),
+         2,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Section index")),
+   });
+}
+
+const StructDefinition& GetElfSymbolDefinition(bool is64Bit, bool littleEndian)
+{
+   static const StructDefinition definitions[2][2] =
+   {
+      {
+         CreateElfSymbolDefinition<Elf32Symbol>(false),
+         CreateElfSymbolDefinition<Elf32Symbol>(true),
+      },
+      {
+         CreateElfSymbolDefinition<Elf64Symbol>(false),
+         CreateElfSymbolDefinition<Elf64Symbol>(true),
+      },
+   };
+
+   return definitions[is64Bit ? 1 : 0][littleEndian ? 1 : 0];
+}
@@ -0,0 +1,89 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfSymbol.hpp
+/// \brief ELF symbol table entry and hash table definitions
+//
+#pragma once
+
+#include "StructDefinition.hpp"
+
+#pragma pack(push, 1)
+
+/// \brief ELF symbol table entry, for 32-bit files
+/// \see https://refspecs.linuxfoundation.org/elf/gabi4+/ch4.symtab.html
+struct Elf32Symbol
+{
+   DWORD name;                   ///< offset of the name in the linked string table
+   DWORD value;                  ///< symbol value, e.g. an address
+   DWORD size;                   ///< size of the object the symbol refers to
+   BYTE info;                    ///< binding (high nibble) and type (low nibble)
+   BYTE other;                   ///< visibility (low 2 bits)
+   WORD sectionIndex;            ///< index of the section the symbol is defined in
+};
+
+/// \brief ELF symbol table entry, for 64-bit files
+struct Elf64Symbol
+{
+   DWORD name;                   ///< offset of the name in the linked string table
+   BYTE info;                    ///< binding (high nibble) and type (low nibble)
+   BYTE other;                   ///< visibility (low 2 bits)
+   WORD sectionIndex;            ///< index of the section the symbol is defined in
+   ULONGLONG value;              ///< symbol value, e.g. an address
+   ULONGLONG size;               ///< size of the object the symbol refers to
+};
+
+/// \brief GNU hash table header; followed by the bloom filter words, the
+/// buckets and the hash value chain
+struct ElfGnuHashHeader
+{
+   DWORD bucketCount;            ///< number of hash buckets
+   DWORD symbolOffset;           ///< index of the first symbol covered by the hash table
+   DWORD bloomSize;              ///< number of bloom filter words
+   DWORD bloomShift;             ///< shift count for the second bloom filter hash
+};
+
+/// \brief SysV hash table header; followed by the buckets and the chains
+struct ElfHashHeader
+{
+   DWORD bucketCount;            ///< number of hash buckets
+   DWORD chainCount;             ///< number of chain entries; equals the symbol count
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(Elf32Symbol) == 16, "ELF32 symbol must be 16 bytes long");
+static_assert(sizeof(Elf64Symbol) == 24, "ELF64 symbol must be 24 bytes long");
+static_assert(sizeof(ElfGnuHashHeader) == 16, "GNU hash header must be 16 bytes long");
+static_assert(sizeof(ElfHashHeader) == 8, "SysV hash header must be 8 bytes long");
+
+/// SHT_SYMTAB: full symbol table
+constexpr DWORD c_elfSectionTypeSymbolTable = 2;
+
+/// SHT_HASH: SysV symbol hash table
+constexpr DWORD c_elfSectionTypeHash = 5;
+
+/// SHT_DYNSYM: dynamic linking symbol table
+constexpr DWORD c_elfSectionTypeDynamicSymbols = 11;
+
+/// SHT_SYMTAB_SHNDX: extended section indices of a symbol table
+constexpr DWORD c_elfSectionTypeSymbolTableIndex = 18;
+
+/// SHT_GNU_HASH: GNU symbol hash table
+constexpr DWORD c_elfSectionTypeGnuHash = 0x6ffffff6;
+
+/// mapping of ELF symbol binding to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfSymbolBindingToDisplayText;
+
+/// mapping of ELF symbol type to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfSymbolTypeToDisplayText;
+
+/// mapping of ELF symbol visibility to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfSymbolVisibilityToDisplayText;
+
+/// mapping of special ELF section indices to display text
+extern const std::map<DWORD, LPCTSTR> g_mapElfSpecialSectionIndexToDisplayText;
+
+/// returns struct definition for an ELF symbol with given class and data encoding
+const StructDefinition& GetElfSymbolDefinition(bool is64Bit, bool littleEndian);
@@ -0,0 +1,353 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfSymbolTable.cpp
+/// \brief ELF symbol table, with hash table based symbol lookup
+//
+#include "stdafx.h"
+#include "ElfSymbolTable.hpp"
+
+ElfSymbolTable::ElfSymbolTable(const ElfImage& image, const ElfSection& symbolSection)
+   :m_image(image),
+   m_section(symbolSection)
+{
+   size_t minEntrySize = m_image.Is64Bit() ? sizeof(Elf64Symbol) : sizeof(Elf32Symbol);
+
+   m_symbols = m_image.SectionData(m_section);
+   m_entrySize = static_cast<size_t>(m_section.entrySize);
+
+   if (m_symbols == nullptr)
+   {
+      m_errorText = _T("Symbol table is outside of the file");
+      return;
+   }
+
+   if (m_entrySize < minEntrySize)
+   {
+      m_errorText = _T("Symbol table has an invalid entry size");
+      return;
+   }
+
+   m_count = static_cast<size_t>(m_section.size / m_entrySize);
+
+   const std::vector<ElfSection>& sections = m_image.Sections();
+   if (m_section.link < sections.size())
+   {
+      m_stringTable = &sections[m_section.link];
+
+      const BYTE* strings = m_image.SectionData(*m_stringTable);
+      if (strings != nullptr)
+      {
+         m_strings = reinterpret_cast<const char*>(strings);
+         m_stringsSize = static_cast<size_t>(m_stringTable->size);
+      }
+   }
+
+   for (const ElfSection& section : sections)
+   {
+      if (section.type == c_elfSectionTypeSymbolTableIndex &&
+         section.link == m_section.index)
+      {
+         m_extendedIndices = reinterpret_cast<const DWORD*>(m_image.SectionData(section));
+         m_extendedIndicesCount = m_extendedIndices != nullptr
+            ? static_cast<size_t>(section.size / sizeof(DWORD))
+            : 0;
+         break;
+      }
+   }
+
+   FindHashTables();
+
+   m_isValid = true;
+}
+
+void ElfSymbolTable::FindHashTables()
+{
+   const ElfSection* sysvHashSection = nullptr;
+
+   for (const ElfSection& section : m_image.Sections())
+   {
+      if (section.link != m_section.index)
+         continue;
+
+      if (section.type == c_elfSectionTypeGnuHash &&
+         InitGnuHashTable(section))
+      {
+         m_hashTableType = ElfHashTableType::gnu;
+         return;
+      }
+
+      if (section.type == c_elfSectionTypeHash &&
+         sysvHashSection == nullptr)
+         sysvHashSection = &section;
+   }
+
+   if (sysvHashSection != nullptr &&
+      InitSysvHashTable(*sysvHashSection))
+      m_hashTableType = ElfHashTableType::sysv;
+}
+
+bool ElfSymbolTable::InitGnuHashTable(const ElfSection& hashSection)
+{
+   const BYTE* data = m_image.SectionData(hashSection);
+   size_t size = static_cast<size_t>(hashSection.size);
+
+   if (data == nullptr ||
+      size < sizeof(ElfGnuHashHeader))
+      return false;
+
+   const ElfGnuHashHeader& header = *reinterpret_cast<const ElfGnuHashHeader*>(data);
+
+   m_image.Dispatch([&](auto layout)
+      {
+         m_bucketCount = layout.Get(header.bucketCount);
+         m_gnuSymbolOffset = layout.Get(header.symbolOffset);
+         m_gnuBloomSize = layout.Get(header.bloomSize);
+         m_gnuBloomShift = layout.Get(header.bloomShift);
+      });
+
+   // the bloom filter words have the size of an address
+   size_t bloomWordSize = m_image.Is64Bit() ? sizeof(ULONGLONG) : sizeof(DWORD);
+   size_t tablesSize = size - sizeof(ElfGnuHashHeader);
+
+   if (m_bucketCount == 0 ||
+      m_gnuBloomSize == 0 ||
+      m_gnuBloomShift >= 32 ||
+      m_gnuBloomSize > tablesSize / bloomWordSize ||
+      m_bucketCount > (tablesSize - m_gnuBloomSize * bloomWordSize) / sizeof(DWORD))
+      return false;
+
+   m_gnuBloom = data + sizeof(ElfGnuHashHeader);
+   m_buckets = reinterpret_cast<const DWORD*>(m_gnuBloom + m_gnuBloomSize * bloomWordSize);
+   m_chains = m_buckets + m_bucketCount;
+   m_chainCount = (size - (reinterpret_cast<const BYTE*>(m_chains) - data)) / sizeof(DWORD);
+
+   return true;
+}
+
+bool ElfSymbolTable::InitSysvHashTable(const ElfSection& hashSection)
+{
+   const BYTE* data = m_image.SectionData(hashSection);
+   size_t size = static_cast<size_t>(hashSection.size);
+
+   if (data == nullptr ||
+      size < sizeof(ElfHashHeader))
+      return false;
+
+   const ElfHashHeader& header = *reinterpret_cast<const ElfHashHeader*>(data);
+
+   size_t chainCount = 0;
+   m_image.Dispatch([&](auto layout)
+      {
+         m_bucketCount = layout.Get(header.bucketCount);
+         chainCount = layout.Get(header.chainCount);
+      });
+
+   size_t tableEntries = (size - sizeof(ElfHashHeader)) / sizeof(DWORD);
+
+   if (m_bucketCount == 0 ||
+      m_bucketCount > tableEntries ||
+      chainCount > tableEntries - m_bucketCount)
+      return false;
+
+   m_buckets = reinterpret_cast<const DWORD*>(data + sizeof(ElfHashHeader));
+   m_chains = m_buckets + m_bucketCount;
+   m_chainCount = chainCount;
+
+   return true;
+}
+
+LPCTSTR ElfSymbolTable::HashTableName() const
+{
+   switch (m_hashTableType)
+   {
+   case ElfHashTableType::gnu: return _T("GNU hash table");
+   case ElfHashTableType::sysv: return _T("SysV hash table");
+   default: return _T("no hash table");
+   }
+}
+
+ElfSymbol ElfSymbolTable::GetSymbol(size_t index) const
+{
+   if (index >= m_count)
+      return ElfSymbol{};
+
+   return m_image.Dispatch([&](auto layout) { return DecodeSymbol(layout, index); });
+}
+
+template <typename TLayout>
+ElfSymbol ElfSymbolTable::DecodeSymbol(TLayout layout, size_t index) const
+{
+   const BYTE* entry = m_symbols + index * m_entrySize;
+   const typename TLayout::Symbol& rawSymbol =
+      *reinterpret_cast<const typename TLayout::Symbol*>(entry);
+
+   ElfSymbol symbol;
+   symbol.index = index;
+   symbol.value = layout.Get(rawSymbol.value);
+   symbol.size = layout.Get(rawSymbol.size);
+   symbol.binding = rawSymbol.info >> 4;
+   symbol.type = rawSymbol.info & 0x0f;
+   symbol.visibility = rawSymbol.other & 0x03;
+   symbol.sectionIndex = layout.Get(rawSymbol.sectionIndex);
+   symbol.entry = entry;
+
+   if (symbol.sectionIndex == c_elfSectionIndexExtended &&
+      index < m_extendedIndicesCount)
+      symbol.sectionIndex = layout.Get(m_extendedIndices[index]);
+
+   if (m_stringTable != nullptr)
+      symbol.name = m_image.GetString(*m_stringTable, layout.Get(rawSymbol.name));
+
+   return symbol;
+}
+
+std::optional<size_t> ElfSymbolTable::Lookup(const CStringA& name) const
+{
+   if (!m_isValid || name.IsEmpty())
+      return std::nullopt;
+
+   std::string_view nameView{ name.GetString(), static_cast<size_t>(name.GetLength()) };
+
+   return m_image.Dispatch([&](auto layout)
+      {
+         switch (m_hashTableType)
+         {
+         case ElfHashTableType::gnu: return LookupGnuHash(layout, nameView);
+         case ElfHashTableType::sysv: return LookupSysvHash(layout, nameView);
+         default: return LookupNameIndex(layout, nameView);
+         }
+      });
+}
+
+DWORD ElfSymbolTable::CalcGnuHash(std::string_view name)
+{
+   DWORD hash = 5381;
+   for (char ch : name)
+      hash = hash * 33 + static_cast<BYTE>(ch);
+
+   return hash;
+}
+
+DWORD ElfSymbolTable::CalcSysvHash(std::string_view name)
+{
+   DWORD hash = 0;
+   for (char ch : name)
+   {
+      hash = (hash << 4) + static_cast<BYTE>(ch);
+
+      DWORD high = hash & 0xf0000000;
+      if (high != 0)
+         hash ^= high >> 24;
+
+      hash &= ~high;
+   }
+
+   return hash;
+}
+
+template <typename TLayout>
+std::string_view ElfSymbolTable::GetRawName(TLayout layout, size_t index) const
+{
+   const typename TLayout::Symbol& rawSymbol =
+      *reinterpret_cast<const typename TLayout::Symbol*>(m_symbols + index * m_entrySize);
+
+   size_t nameOffset = layout.Get(rawSymbol.name);
+   if (nameOffset >= m_stringsSize)
+      return std::string_view{};
+
+   const char* text = m_strings + nameOffset;
+   return std::string_view{ text, strnlen(text, m_stringsSize - nameOffset) };
+}
+
+template <typename TLayout>
+bool ElfSymbolTable::IsSymbolName(TLayout layout, size_t index, std::string_view name) const
+{
+   return index < m_count &&
+      GetRawName(layout, index) == name;
+}
+
+template <typename TLayout>
+std::optional<size_t> ElfSymbolTable::LookupGnuHash(TLayout layout, std::string_view name) const
+{
+   using BloomWord = typename TLayout::Address;
+   constexpr DWORD bloomWordBits = sizeof(BloomWord) * 8;
+
+   DWORD hash = CalcGnuHash(name);
+
+   // the bloom filter rejects most names that aren't in the table, without
+   // touching the buckets or the symbols
+   const BloomWord* bloom = reinterpret_cast<const BloomWord*>(m_gnuBloom);
+   BloomWord bloomWord = layout.Get(bloom[(hash / bloomWordBits) % m_gnuBloomSize]);
+   BloomWord bloomMask =
+      (BloomWord(1) << (hash % bloomWordBits)) |
+      (BloomWord(1) << ((hash >> m_gnuBloomShift) % bloomWordBits));
+
+   if ((bloomWord & bloomMask) != bloomMask)
+      return std::nullopt;
+
+   size_t symbolIndex = layout.Get(m_buckets[hash % m_bucketCount]);
+   if (symbolIndex < m_gnuSymbolOffset)
+      return std::nullopt;
+
+   // the chain contains the hash values of all symbols in the bucket; the
+   // lowest bit marks the last symbol of the bucket
+   for (; symbolIndex - m_gnuSymbolOffset < m_chainCount; symbolIndex++)
+   {
+      DWORD chainHash = layout.Get(m_chains[symbolIndex - m_gnuSymbolOffset]);
+
+      if ((hash | 1) == (chainHash | 1) &&
+         IsSymbolName(layout, symbolIndex, name))
+         return symbolIndex;
+
+      if ((chainHash & 1) != 0)
+         break;
+   }
+
+   return std::nullopt;
+}
+
+template <typename TLayout>
+std::optional<size_t> ElfSymbolTable::LookupSysvHash(TLayout layout, std::string_view name) const
+{
+   DWORD hash = CalcSysvHash(name);
+
+   size_t symbolIndex = layout.Get(m_buckets[hash % m_bucketCount]);
+
+   // the step count guards against cycles in broken chains
+   for (size_t step = 0;
+      symbolIndex != 0 && symbolIndex < m_chainCount && step < m_chainCount;
+      step++)
+   {
+      if (IsSymbolName(layout, symbolIndex, name))
+         return symbolIndex;
+
+      symbolIndex = layout.Get(m_chains[symbolIndex]);
+   }
+
+   return std::nullopt;
+}
+
+template <typename TLayout>
+std::optional<size_t> ElfSymbolTable::LookupNameIndex(TLayout layout, std::string_view name) const
+{
+   if (m_nameIndex.empty())
+   {
+      m_nameIndex.reserve(m_count);
+
+      // the first symbol with a name wins, like for a linear search
+      for (size_t index = 1; index < m_count; index++)
+      {
+         std::string_view symbolName = GetRawName(layout, index);
+         if (!symbolName.empty())
+            m_nameIndex.emplace(symbolName, index);
+      }
+   }
+
+   auto iter = m_nameIndex.find(name);
+   if (iter == m_nameIndex.end())
+      return std::nullopt;
+
+   return iter->second;
+}
@@ -0,0 +1,197 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfSymbolTable.hpp
+/// \brief ELF symbol table, with hash table based symbol lookup
+//
+#pragma once
+
+#include "ElfImage.hpp"
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+/// \brief ELF symbol, with values converted to host byte order
+struct ElfSymbol
+{
+   /// symbol index
+   size_t index = 0;
+
+   /// symbol name
+   CString name;
+
+   /// symbol value, e.g. an address
+   ULONGLONG value = 0;
+
+   /// size of the object the symbol refers to
+   ULONGLONG size = 0;
+
+   /// symbol binding; STB_* value
+   BYTE binding = 0;
+
+   /// symbol type; STT_* value
+   BYTE type = 0;
+
+   /// symbol visibility; STV_* value
+   BYTE visibility = 0;
+
+   /// section index; SHN_XINDEX is already resolved
+   DWORD sectionIndex = 0;
+
+   /// pointer to the symbol table entry in the file
+   const BYTE* entry = nullptr;
+};
+
+/// hash table type used for symbol lookups
+enum class ElfHashTableType
+{
+   none,    ///< no hash table; a name index is built on the first lookup
+   gnu,     ///< GNU hash table, from a SHT_GNU_HASH section
+   sysv,    ///< SysV hash table, from a SHT_HASH section
+};
+
+/// \brief ELF symbol table
+/// \details Accesses the entries of a SHT_SYMTAB or SHT_DYNSYM section
+/// directly in the mapped file; symbols are only decoded when requested.
+/// Symbol lookups by name use the hash table of the symbol table the same way
+/// the dynamic loader does, preferring the GNU hash table with its bloom
+/// filter over the SysV hash table. Symbol tables without a hash table, e.g.
+/// .symtab, are indexed once on the first lookup.
+class ElfSymbolTable
+{
+public:
+   /// ctor; the image must outlive the symbol table
+   ElfSymbolTable(const ElfImage& image, const ElfSection& symbolSection);
+
+   /// returns if the symbol table is valid
+   bool IsValid() const { return m_isValid; }
+
+   /// returns an error text, when the symbol table is invalid
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the symbol table section
+   const ElfSection& Section() const { return m_section; }
+
+   /// returns the number of symbols, including the null symbol at index 0
+   size_t Count() const { return m_count; }
+
+   /// returns the type of the hash table used for lookups
+   ElfHashTableType HashTableType() const { return m_hashTableType; }
+
+   /// returns the display name of the hash table used for lookups
+   LPCTSTR HashTableName() const;
+
+   /// decodes the symbol with given index
+   ElfSymbol GetSymbol(size_t index) const;
+
+   /// looks up a symbol by its UTF-8 encoded name; returns the symbol index
+   std::optional<size_t> Lookup(const CStringA& name) const;
+
+   /// calculates the GNU hash value of a symbol name
+   static DWORD CalcGnuHash(std::string_view name);
+
+   /// calculates the SysV hash value of a symbol name
+   static DWORD CalcSysvHash(std::string_view name);
+
+private:
+   /// finds and checks the hash table sections linked to this symbol table
+   void FindHashTables();
+
+   /// sets up the GNU hash table lookup; returns false when the table is invalid
+   bool InitGnuHashTable(const ElfSection& hashSection);
+
+   /// sets up the SysV hash table lookup; returns false when the table is invalid
+   bool InitSysvHashTable(const ElfSection& hashSection);
+
+   /// decodes a symbol
+   template <typename TLayout>
+   ElfSymbol DecodeSymbol(TLayout layout, size_t index) const;
+
+   /// returns if the symbol with given index has the given name
+   template <typename TLayout>
+   bool IsSymbolName(TLayout layout, size_t index, std::string_view name) const;
+
+   /// looks up a symbol using the GNU hash table
+   template <typename TLayout>
+   std::optional<size_t> LookupGnuHash(TLayout layout, std::string_view name) const;
+
+   /// looks up a symbol using the SysV hash table
+   template <typename TLayout>
+   std::optional<size_t> LookupSysvHash(TLayout layout, std::string_view name) const;
+
+   /// looks up a symbol using the name index; builds the index when necessary
+   template <typename TLayout>
+   std::optional<size_t> LookupNameIndex(TLayout layout, std::string_view name) const;
+
+   /// returns the raw name of the symbol with given index
+   template <typename TLayout>
+   std::string_view GetRawName(TLayout layout, size_t index) const;
+
+private:
+   /// ELF image
+   const ElfImage& m_image;
+
+   /// symbol table section
+   const ElfSection& m_section;
+
+   /// indicates if symbol table is valid
+   bool m_isValid = false;
+
+   /// error text
+   CString m_errorText;
+
+   /// pointer to the first symbol table entry
+   const BYTE* m_symbols = nullptr;
+
+   /// size of a symbol table entry
+   size_t m_entrySize = 0;
+
+   /// number of symbols
+   size_t m_count = 0;
+
+   /// linked string table section; may be nullptr
+   const ElfSection* m_stringTable = nullptr;
+
+   /// string table data
+   const char* m_strings = nullptr;
+
+   /// string table size
+   size_t m_stringsSize = 0;
+
+   /// extended section indices from a SHT_SYMTAB_SHNDX section; may be nullptr
+   const DWORD* m_extendedIndices = nullptr;
+
+   /// number of extended section indices
+   size_t m_extendedIndicesCount = 0;
+
+   /// hash table type used for lookups
+   ElfHashTableType m_hashTableType = ElfHashTableType::none;
+
+   /// number of hash buckets
+   DWORD m_bucketCount = 0;
+
+   /// hash buckets
+   const DWORD* m_buckets = nullptr;
+
+   /// hash chains; for the GNU hash table, these are the hash values
+   const DWORD* m_chains = nullptr;
+
+   /// number of chain entries
+   size_t m_chainCount = 0;
+
+   /// GNU hash table: index of the first symbol covered by the hash table
+   DWORD m_gnuSymbolOffset = 0;
+
+   /// GNU hash table: bloom filter words, with address size
+   const BYTE* m_gnuBloom = nullptr;
+
+   /// GNU hash table: number of bloom filter words
+   DWORD m_gnuBloomSize = 0;
+
+   /// GNU hash table: shift count for the second bloom filter hash
+   DWORD m_gnuBloomShift = 0;
+
+   /// name index for tables without hash table; built on the first lookup
+   mutable std::unordered_map<std::string_view, size_t> m_nameIndex;
+};
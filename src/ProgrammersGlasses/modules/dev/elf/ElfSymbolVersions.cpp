@@ -0,0 +1,218 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfSymbolVersions.cpp
+/// \brief ELF symbol versions, from the .gnu.version* sections
+//
+#include "stdafx.h"
+#include "ElfSymbolVersions.hpp"
+
+ElfSymbolVersions::ElfSymbolVersions(const ElfImage& image)
+   :m_image(image)
+{
+   for (const ElfSection& section : m_image.Sections())
+   {
+      switch (section.type)
+      {
+      case c_elfSectionTypeVersionSymbols:
+         m_versionSymbols = reinterpret_cast<const WORD*>(m_image.SectionData(section));
+         if (m_versionSymbols != nullptr)
+         {
+            m_versionSymbolSection = &section;
+            m_versionSymbolCount = static_cast<size_t>(section.size / sizeof(WORD));
+         }
+         break;
+
+      case c_elfSectionTypeVersionDefinitions:
+         m_image.Dispatch([&](auto layout) { DecodeDefinitions(layout, section); });
+         break;
+
+      case c_elfSectionTypeVersionRequirements:
+         m_image.Dispatch([&](auto layout) { DecodeRequirements(layout, section); });
+         break;
+
+      default:
+         break;
+      }
+   }
+}
+
+bool ElfSymbolVersions::IsAvailable() const
+{
+   return m_versionSymbolSection != nullptr ||
+      !m_definitions.empty() ||
+      !m_requirements.empty();
+}
+
+WORD ElfSymbolVersions::VersionIndex(size_t symbolIndex) const
+{
+   if (symbolIndex >= m_versionSymbolCount)
+      return c_elfVersionIndexGlobal;
+
+   return m_image.Dispatch([&](auto layout) { return layout.Get(m_versionSymbols[symbolIndex]); });
+}
+
+CString ElfSymbolVersions::VersionName(WORD versionIndex) const
+{
+   versionIndex &= ~c_elfVersionHidden;
+
+   if (versionIndex == c_elfVersionIndexLocal)
+      return _T("local");
+
+   if (versionIndex == c_elfVersionIndexGlobal)
+      return _T("global");
+
+   auto iter = m_versionNames.find(versionIndex);
+   if (iter != m_versionNames.end())
+      return iter->second;
+
+   CString text;
+   text.Format(_T("unknown version %u"), versionIndex);
+   return text;
+}
+
+const ElfSection* ElfSymbolVersions::LinkedStringTable(const ElfSection& section) const
+{
+   const std::vector<ElfSection>& sections = m_image.Sections();
+
+   return section.link < sections.size()
+      ? &sections[section.link]
+      : nullptr;
+}
+
+template <typename TLayout>
+void ElfSymbolVersions::DecodeDefinitions(TLayout layout, const ElfSection& section)
+{
+   const BYTE* data = m_image.SectionData(section);
+   const ElfSection* stringTable = LinkedStringTable(section);
+   if (data == nullptr || stringTable == nullptr)
+   {
+      m_errorText = _T("Version definition section is outside of the file");
+      return;
+   }
+
+   size_t size = static_cast<size_t>(section.size);
+   size_t offset = 0;
+
+   // the entry count in the info field also guards against cycles
+   for (size_t count = 0; count < section.info; count++)
+   {
+      if (offset > size ||
+         size - offset < sizeof(ElfVersionDefinitionEntry))
+      {
+         m_errorText = _T("Version definition entry is outside of the section");
+         return;
+      }
+
+      const ElfVersionDefinitionEntry& entry =
+         *reinterpret_cast<const ElfVersionDefinitionEntry*>(data + offset);
+
+      ElfVersionDefinition definition;
+      definition.index = layout.Get(entry.index);
+      definition.flags = layout.Get(entry.flags);
+      definition.hash = layout.Get(entry.hash);
+
+      size_t auxOffset = offset + layout.Get(entry.auxOffset);
+      WORD auxCount = layout.Get(entry.auxCount);
+
+      for (WORD auxIndex = 0; auxIndex < auxCount; auxIndex++)
+      {
+         if (auxOffset > size ||
+            size - auxOffset < sizeof(ElfVersionDefinitionAux))
+            break;
+
+         const ElfVersionDefinitionAux& aux =
+            *reinterpret_cast<const ElfVersionDefinitionAux*>(data + auxOffset);
+
+         CString name = m_image.GetString(*stringTable, layout.Get(aux.name));
+
+         // the first aux entry names the version, the others its parents
+         if (auxIndex == 0)
+            definition.name = name;
+         else
+            definition.parentNames.push_back(name);
+
+         DWORD nextAuxOffset = layout.Get(aux.nextOffset);
+         if (nextAuxOffset == 0)
+            break;
+
+         auxOffset += nextAuxOffset;
+      }
+
+      m_versionNames[static_cast<WORD>(definition.index & ~c_elfVersionHidden)] = definition.name;
+      m_definitions.push_back(definition);
+
+      DWORD nextOffset = layout.Get(entry.nextOffset);
+      if (nextOffset == 0)
+         break;
+
+      offset += nextOffset;
+   }
+}
+
+template <typename TLayout>
+void ElfSymbolVersions::DecodeRequirements(TLayout layout, const ElfSection& section)
+{
+   const BYTE* data = m_image.SectionData(section);
+   const ElfSection* stringTable = LinkedStringTable(section);
+   if (data == nullptr || stringTable == nullptr)
+   {
+      m_errorText = _T("Version requirement section is outside of the file");
+      return;
+   }
+
+   size_t size = static_cast<size_t>(section.size);
+   size_t offset = 0;
+
+   // the entry count in the info field also guards against cycles
+   for (size_t count = 0; count < section.info; count++)
+   {
+      if (offset > size ||
+         size - offset < sizeof(ElfVersionRequirementEntry))
+      {
+         m_errorText = _T("Version requirement entry is outside of the section");
+         return;
+      }
+
+      const ElfVersionRequirementEntry& entry =
+         *reinterpret_cast<const ElfVersionRequirementEntry*>(data + offset);
+
+      CString fileName = m_image.GetString(*stringTable, layout.Get(entry.file));
+
+      size_t auxOffset = offset + layout.Get(entry.auxOffset);
+      WORD auxCount = layout.Get(entry.auxCount);
+
+      for (WORD auxIndex = 0; auxIndex < auxCount; auxIndex++)
+      {
+         if (auxOffset > size ||
+            size - auxOffset < sizeof(ElfVersionRequirementAux))
+            break;
+
+         const ElfVersionRequirementAux& aux =
+            *reinterpret_cast<const ElfVersionRequirementAux*>(data + auxOffset);
+
+         ElfVersionRequirement requirement;
+         requirement.index = layout.Get(aux.other);
+         requirement.flags = layout.Get(aux.flags);
+         requirement.hash = layout.Get(aux.hash);
+         requirement.fileName = fileName;
+         requirement.name = m_image.GetString(*stringTable, layout.Get(aux.name));
+
+         m_versionNames[static_cast<WORD>(requirement.index & ~c_elfVersionHidden)] = requirement.name;
+         m_requirements.push_back(requirement);
+
+         DWORD nextAuxOffset = layout.Get(aux.nextOffset);
+         if (nextAuxOffset == 0)
+            break;
+
+         auxOffset += nextAuxOffset;
+      }
+
+      DWORD nextOffset = layout.Get(entry.nextOffset);
+      if (nextOffset == 0)
+         break;
+
+      offset += nextOffset;
+   }
+}
@@ -0,0 +1,120 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ElfSymbolVersions.hpp
+/// \brief ELF symbol versions, from the .gnu.version* sections
+//
+#pragma once
+
+#include "ElfImage.hpp"
+
+/// \brief Version definition, from .gnu.version_d
+struct ElfVersionDefinition
+{
+   /// version index, as used in .gnu.version
+   WORD index = 0;
+
+   /// version flags; VER_FLG_* values
+   WORD flags = 0;
+
+   /// hash value of the version name
+   DWORD hash = 0;
+
+   /// version name
+   CString name;
+
+   /// names of parent versions
+   std::vector<CString> parentNames;
+};
+
+/// \brief Version requirement, from .gnu.version_r
+struct ElfVersionRequirement
+{
+   /// version index, as used in .gnu.version
+   WORD index = 0;
+
+   /// version flags; VER_FLG_* values
+   WORD flags = 0;
+
+   /// hash value of the version name
+   DWORD hash = 0;
+
+   /// file name of the library that must provide the version
+   CString fileName;
+
+   /// version name
+   CString name;
+};
+
+/// \brief ELF symbol versions
+/// \details Decodes the version definitions and requirements, which are
+/// small, and accesses the version index of each dynamic symbol directly in
+/// the mapped .gnu.version section.
+class ElfSymbolVersions
+{
+public:
+   /// ctor; the image must outlive the symbol versions
+   explicit ElfSymbolVersions(const ElfImage& image);
+
+   /// returns if any symbol versioning section is available
+   bool IsAvailable() const;
+
+   /// returns an error text, when a section couldn't be decoded
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the .gnu.version section, or nullptr when not available
+   const ElfSection* VersionSymbolSection() const { return m_versionSymbolSection; }
+
+   /// returns the number of entries in the .gnu.version section
+   size_t VersionSymbolCount() const { return m_versionSymbolCount; }
+
+   /// returns the version index of a dynamic symbol, including the hidden bit
+   WORD VersionIndex(size_t symbolIndex) const;
+
+   /// returns the version name for a version index, without the hidden bit
+   CString VersionName(WORD versionIndex) const;
+
+   /// returns all version definitions
+   const std::vector<ElfVersionDefinition>& Definitions() const { return m_definitions; }
+
+   /// returns all version requirements
+   const std::vector<ElfVersionRequirement>& Requirements() const { return m_requirements; }
+
+private:
+   /// decodes the version definitions
+   template <typename TLayout>
+   void DecodeDefinitions(TLayout layout, const ElfSection& section);
+
+   /// decodes the version requirements
+   template <typename TLayout>
+   void DecodeRequirements(TLayout layout, const ElfSection& section);
+
+   /// returns the string table linked to a section, or nullptr
+   const ElfSection* LinkedStringTable(const ElfSection& section) const;
+
+private:
+   /// ELF image
+   const ElfImage& m_image;
+
+   /// error text
+   CString m_errorText;
+
+   /// .gnu.version section; may be nullptr
+   const ElfSection* m_versionSymbolSection = nullptr;
+
+   /// version index entries of the .gnu.version section
+   const WORD* m_versionSymbols = nullptr;
+
+   /// number of entries in the .gnu.version section
+   size_t m_versionSymbolCount = 0;
+
+   /// all version definitions
+   std::vector<ElfVersionDefinition> m_definitions;
+
+   /// all version requirements
+   std::vector<ElfVersionRequirement> m_requirements;
+
+   /// mapping of version index to version name
+   std::map<WORD, CString> m_versionNames;
+};
@@ -0,0 +1,372 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachOChainedFixups.cpp
+/// \brief Mach-O chained fixups, from the LC_DYLD_CHAINED_FIXUPS load command
+//
+#include "stdafx.h"
+#include "MachOChainedFixups.hpp"
+#include "dev/dwarf/DwarfDataReader.hpp"
+
+constexpr WORD c_chainedPointerArm64e = 1;           ///< DYLD_CHAINED_PTR_ARM64E
+constexpr WORD c_chainedPointer64 = 2;               ///< DYLD_CHAINED_PTR_64
+constexpr WORD c_chainedPointer32 = 3;               ///< DYLD_CHAINED_PTR_32
+constexpr WORD c_chainedPointer64Offset = 6;         ///< DYLD_CHAINED_PTR_64_OFFSET
+constexpr WORD c_chainedPointerArm64eUserland = 9;   ///< DYLD_CHAINED_PTR_ARM64E_USERLAND
+constexpr WORD c_chainedPointerArm64eUserland24 = 12; ///< DYLD_CHAINED_PTR_ARM64E_USERLAND24
+
+constexpr DWORD c_chainedImport = 1;                 ///< DYLD_CHAINED_IMPORT
+constexpr DWORD c_chainedImportAddend = 2;           ///< DYLD_CHAINED_IMPORT_ADDEND
+constexpr DWORD c_chainedImportAddend64 = 3;         ///< DYLD_CHAINED_IMPORT_ADDEND64
+
+/// maximum number of fixups in a single chain; the largest page size of 64k
+/// holds 16384 fixups with a stride of 4 bytes
+constexpr size_t c_maxChainLength = 0x4000;
+
+/// returns bits of a value
+static ULONGLONG GetBits(ULONGLONG value, unsigned int firstBit, unsigned int bitCount)
+{
+   return (value >> firstBit) & ((ULONGLONG(1) << bitCount) - 1);
+}
+
+/// sign extends a value with given number of bits
+static LONGLONG SignExtend(ULONGLONG value, unsigned int bitCount)
+{
+   ULONGLONG signBit = ULONGLONG(1) << (bitCount - 1);
+   return static_cast<LONGLONG>((value ^ signBit) - signBit);
+}
+
+MachOChainedFixups::MachOChainedFixups(const MachOImage& image)
+   :m_image(image)
+{
+   const MachOLinkeditData& chainedFixups = m_image.ChainedFixups();
+   if (!chainedFixups.IsAvailable())
+   {
+      m_errorText = _T("Image has no chained fixups");
+      return;
+   }
+
+   m_data = m_image.Data(chainedFixups.offset, chainedFixups.size);
+   m_size = chainedFixups.size;
+
+   if (m_data == nullptr ||
+      m_size < sizeof(MachOChainedFixupsHeader))
+   {
+      m_errorText = _T("Chained fixups are outside of the file");
+      return;
+   }
+
+   m_header = reinterpret_cast<const MachOChainedFixupsHeader*>(m_data);
+
+   DWORD importsFormat = m_image.Get(m_header->importsFormat);
+   size_t importsOffset = m_image.Get(m_header->importsOffset);
+   size_t importsCount = m_image.Get(m_header->importsCount);
+
+   size_t importSize =
+      importsFormat == c_chainedImport ? 4 :
+      importsFormat == c_chainedImportAddend ? 8 :
+      importsFormat == c_chainedImportAddend64 ? 16 : 0;
+
+   if (importSize == 0)
+   {
+      m_errorText.Format(_T("Unknown imports format %u"), importsFormat);
+      return;
+   }
+
+   if (importsOffset > m_size ||
+      importsCount > (m_size - importsOffset) / importSize)
+   {
+      m_errorText = _T("Chained fixups imports are outside of the chained fixups data");
+      return;
+   }
+
+   m_importsFormat = importsFormat;
+   m_importsOffset = importsOffset;
+   m_importsCount = importsCount;
+
+   // compressed symbol names aren't supported; the imports are still shown
+   // without names
+   size_t symbolsOffset = m_image.Get(m_header->symbolsOffset);
+   if (m_image.Get(m_header->symbolsFormat) == 0 &&
+      symbolsOffset < m_size)
+   {
+      m_symbols = reinterpret_cast<const char*>(m_data + symbolsOffset);
+      m_symbolsSize = m_size - symbolsOffset;
+   }
+
+   m_isValid = DecodeStarts(m_image.Get(m_header->startsOffset));
+}
+
+bool MachOChainedFixups::DecodeStarts(DWORD startsOffset)
+{
+   DwarfDataReader reader{ m_data, m_size, m_image.IsLittleEndian(), startsOffset };
+
+   DWORD segmentCount = reader.ReadDword();
+   if (reader.HasError() ||
+      segmentCount > reader.Remaining() / sizeof(DWORD))
+   {
+      m_errorText = _T("Chained fixups starts are outside of the chained fixups data");
+      return false;
+   }
+
+   for (DWORD segmentIndex = 0; segmentIndex < segmentCount; segmentIndex++)
+   {
+      // an offset of 0 indicates a segment without fixups
+      DWORD segmentInfoOffset = reader.ReadDword();
+      if (segmentInfoOffset == 0)
+         continue;
+
+      DwarfDataReader segmentReader{ m_data, m_size, m_image.IsLittleEndian(), startsOffset + size_t(segmentInfoOffset) };
+
+      MachOChainedStarts starts;
+      starts.segmentIndex = segmentIndex;
+      starts.data = segmentReader.Current();
+
+      segmentReader.ReadDword(); // size
+      starts.pageSize = segmentReader.ReadWord();
+      starts.pointerFormat = segmentReader.ReadWord();
+      starts.segmentOffset = segmentReader.ReadQword();
+      starts.maxValidPointer = segmentReader.ReadDword();
+
+      WORD pageCount = segmentReader.ReadWord();
+      starts.pageStarts.reserve(pageCount);
+
+      for (WORD pageIndex = 0; pageIndex < pageCount && !segmentReader.HasError(); pageIndex++)
+         starts.pageStarts.push_back(segmentReader.ReadWord());
+
+      if (segmentReader.HasError())
+      {
+         m_errorText.Format(_T("Chained fixups starts of segment %u are outside of the chained fixups data"),
+            segmentIndex);
+         return false;
+      }
+
+      m_starts.push_back(starts);
+   }
+
+   return true;
+}
+
+MachOChainedImport MachOChainedFixups::GetImport(size_t index) const
+{
+   MachOChainedImport import;
+   import.index = index;
+
+   if (index >= m_importsCount)
+      return import;
+
+   DwarfDataReader reader{ m_data, m_size, m_image.IsLittleEndian(), m_importsOffset };
+
+   size_t nameOffset = 0;
+   switch (m_importsFormat)
+   {
+   case c_chainedImport:
+   case c_chainedImportAddend:
+   {
+      reader.Skip(index * (m_importsFormat == c_chainedImport ? 4 : 8));
+
+      DWORD value = reader.ReadDword();
+      import.libraryOrdinal = static_cast<int>(SignExtend(GetBits(value, 0, 8), 8));
+      import.isWeakImport = GetBits(value, 8, 1) != 0;
+      nameOffset = static_cast<size_t>(GetBits(value, 9, 23));
+
+      if (m_importsFormat == c_chainedImportAddend)
+         import.addend = static_cast<int>(reader.ReadDword());
+      break;
+   }
+
+   case c_chainedImportAddend64:
+   {
+      reader.Skip(index * 16);
+
+      ULONGLONG value = reader.ReadQword();
+      import.libraryOrdinal = static_cast<int>(SignExtend(GetBits(value, 0, 16), 16));
+      import.isWeakImport = GetBits(value, 16, 1) != 0;
+      nameOffset = static_cast<size_t>(GetBits(value, 32, 32));
+      import.addend = static_cast<LONGLONG>(reader.ReadQword());
+      break;
+   }
+
+   default:
+      break;
+   }
+
+   // only the special ordinals are negative; regular ordinals use the full
+   // unsigned range of the field
+   if (import.libraryOrdinal < -3)
+      import.libraryOrdinal &= m_importsFormat == c_chainedImportAddend64 ? 0xffff : 0xff;
+
+   if (nameOffset < m_symbolsSize)
+   {
+      const char* text = m_symbols + nameOffset;
+      import.name = CStringA(text, static_cast<int>(strnlen(text, m_symbolsSize - nameOffset)));
+   }
+
+   return import;
+}
+
+bool MachOChainedFixups::IsSupportedPointerFormat(WORD pointerFormat)
+{
+   switch (pointerFormat)
+   {
+   case c_chainedPointerArm64e:
+   case c_chainedPointer64:
+   case c_chainedPointer32:
+   case c_chainedPointer64Offset:
+   case c_chainedPointerArm64eUserland:
+   case c_chainedPointerArm64eUserland24:
+      return true;
+
+   default:
+      return false;
+   }
+}
+
+bool MachOChainedFixups::ForEachFixup(const MachOChainedStarts& starts, const FixupHandler& handler) const
+{
+   if (!IsSupportedPointerFormat(starts.pointerFormat) ||
+      starts.pageSize == 0 ||
+      starts.segmentIndex >= m_image.Segments().size())
+      return false;
+
+   const MachOSegment& segment = m_image.Segments()[starts.segmentIndex];
+   size_t pointerSize = starts.pointerFormat == c_chainedPointer32 ? 4 : 8;
+
+   for (size_t pageIndex = 0; pageIndex < starts.pageStarts.size(); pageIndex++)
+   {
+      WORD pageStart = starts.pageStarts[pageIndex];
+      if (pageStart == c_machOChainedPointerStartNone)
+         continue;
+
+      // multiple chains per page are only used by 32-bit formats in
+      // firmware files
+      if ((pageStart & c_machOChainedPointerStartMulti) != 0)
+         return false;
+
+      ULONGLONG pageOffset = ULONGLONG(pageIndex) * starts.pageSize;
+      ULONGLONG offsetInSegment = pageOffset + pageStart;
+
+      // a chain never leaves its page
+      for (size_t chainIndex = 0; chainIndex < c_maxChainLength; chainIndex++)
+      {
+         if (offsetInSegment + pointerSize > pageOffset + starts.pageSize ||
+            offsetInSegment + pointerSize > segment.fileSize)
+            return false;
+
+         MachOChainedFixup fixup;
+         fixup.segmentIndex = starts.segmentIndex;
+         fixup.vmOffset = starts.segmentOffset + offsetInSegment;
+         fixup.fileOffset = segment.fileOffset + offsetInSegment;
+
+         const BYTE* pointer = m_image.Data(fixup.fileOffset, pointerSize);
+         if (pointer == nullptr)
+            return false;
+
+         fixup.rawValue = pointerSize == 4
+            ? m_image.Get(*reinterpret_cast<const DWORD*>(pointer))
+            : m_image.Get(*reinterpret_cast<const ULONGLONG*>(pointer));
+
+         size_t nextOffset = DecodePointer(starts.pointerFormat, fixup.rawValue, fixup);
+
+         if (!handler(fixup))
+            return true;
+
+         if (nextOffset == 0)
+            break;
+
+         offsetInSegment += nextOffset;
+      }
+   }
+
+   return true;
+}
+
+LPCTSTR MachOChainedFixups::GetKindDisplayText(MachOChainedFixupKind kind)
+{
+   switch (kind)
+   {
+   case MachOChainedFixupKind::rebase: return _T("rebase");
+   case MachOChainedFixupKind::bind: return _T("bind");
+   case MachOChainedFixupKind::authRebase: return _T("auth rebase");
+   case MachOChainedFixupKind::authBind: return _T("auth bind");
+   default: return _T("unknown");
+   }
+}
+
+size_t MachOChainedFixups::DecodePointer(WORD pointerFormat, ULONGLONG rawValue, MachOChainedFixup& fixup)
+{
+   switch (pointerFormat)
+   {
+   case c_chainedPointer64:
+   case c_chainedPointer64Offset:
+   {
+      bool isBind = GetBits(rawValue, 63, 1) != 0;
+      if (isBind)
+      {
+         fixup.kind = MachOChainedFixupKind::bind;
+         fixup.importIndex = static_cast<DWORD>(GetBits(rawValue, 0, 24));
+         fixup.addend = static_cast<LONGLONG>(GetBits(rawValue, 24, 8));
+      }
+      else
+      {
+         fixup.kind = MachOChainedFixupKind::rebase;
+         fixup.target = GetBits(rawValue, 0, 36) | (GetBits(rawValue, 36, 8) << 56);
+      }
+
+      return static_cast<size_t>(GetBits(rawValue, 51, 12)) * 4;
+   }
+
+   case c_chainedPointer32:
+   {
+      bool isBind = GetBits(rawValue, 31, 1) != 0;
+      if (isBind)
+      {
+         fixup.kind = MachOChainedFixupKind::bind;
+         fixup.importIndex = static_cast<DWORD>(GetBits(rawValue, 0, 20));
+         fixup.addend = static_cast<LONGLONG>(GetBits(rawValue, 20, 6));
+      }
+      else
+      {
+         fixup.kind = MachOChainedFixupKind::rebase;
+         fixup.target = GetBits(rawValue, 0, 26);
+      }
+
+      return static_cast<size_t>(GetBits(rawValue, 26, 5)) * 4;
+   }
+
+   case c_chainedPointerArm64e:
+   case c_chainedPointerArm64eUserland:
+   case c_chainedPointerArm64eUserland24:
+   {
+      bool isAuth = GetBits(rawValue, 63, 1) != 0;
+      bool isBind = GetBits(rawValue, 62, 1) != 0;
+      unsigned int ordinalBits = pointerFormat == c_chainedPointerArm64eUserland24 ? 24 : 16;
+
+      if (isBind)
+      {
+         fixup.kind = isAuth ? MachOChainedFixupKind::authBind : MachOChainedFixupKind::bind;
+         fixup.importIndex = static_cast<DWORD>(GetBits(rawValue, 0, ordinalBits));
+
+         // only plain binds have an addend; auth binds store the diversity
+         if (!isAuth)
+            fixup.addend = SignExtend(GetBits(rawValue, 32, 19), 19);
+      }
+      else if (isAuth)
+      {
+         fixup.kind = MachOChainedFixupKind::authRebase;
+         fixup.target = GetBits(rawValue, 0, 32);
+      }
+      else
+      {
+         fixup.kind = MachOChainedFixupKind::rebase;
+         fixup.target = GetBits(rawValue, 0, 43) | (GetBits(rawValue, 43, 8) << 56);
+      }
+
+      return static_cast<size_t>(GetBits(rawValue, 51, 11)) * 8;
+   }
+
+   default:
+      return 0;
+   }
+}
@@ -0,0 +1,191 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachOChainedFixups.hpp
+/// \brief Mach-O chained fixups, from the LC_DYLD_CHAINED_FIXUPS load command
+//
+#pragma once
+
+#include "MachOImage.hpp"
+#include <functional>
+
+/// DYLD_CHAINED_PTR_START_NONE: page start value for pages without fixups
+constexpr WORD c_machOChainedPointerStartNone = 0xffff;
+
+/// DYLD_CHAINED_PTR_START_MULTI: page start flag for pages with multiple chains
+constexpr WORD c_machOChainedPointerStartMulti = 0x8000;
+
+/// \brief Imported symbol of the chained fixups imports table
+struct MachOChainedImport
+{
+   /// import index, as used by bind fixups
+   size_t index = 0;
+
+   /// library ordinal; 1-based index of the dylib load commands, or one of
+   /// the special values 0 (self), -1 (main executable), -2 (flat lookup) and
+   /// -3 (weak lookup)
+   int libraryOrdinal = 0;
+
+   /// indicates a weak import
+   bool isWeakImport = false;
+
+   /// symbol name, UTF-8 encoded
+   CStringA name;
+
+   /// addend
+   LONGLONG addend = 0;
+};
+
+/// \brief Chain starts of a single segment, with values converted to host byte order
+struct MachOChainedStarts
+{
+   /// segment index
+   size_t segmentIndex = 0;
+
+   /// page size
+   WORD pageSize = 0;
+
+   /// pointer format; DYLD_CHAINED_PTR_* value
+   WORD pointerFormat = 0;
+
+   /// offset of the segment, from the image's mach header
+   ULONGLONG segmentOffset = 0;
+
+   /// for 32-bit formats, the maximum rebase target
+   DWORD maxValidPointer = 0;
+
+   /// offsets of the first fixup in each page; c_machOChainedPointerStartNone
+   /// for pages without fixups
+   std::vector<WORD> pageStarts;
+
+   /// pointer to the starts struct in the file
+   const BYTE* data = nullptr;
+};
+
+/// kind of a chained fixup
+enum class MachOChainedFixupKind
+{
+   rebase,           ///< pointer to a target in the image
+   bind,             ///< pointer to an imported symbol
+   authRebase,       ///< pointer authenticated rebase, on arm64e
+   authBind,         ///< pointer authenticated bind, on arm64e
+};
+
+/// \brief Decoded chained fixup
+struct MachOChainedFixup
+{
+   /// segment index
+   size_t segmentIndex = 0;
+
+   /// offset of the fixup location, from the image's mach header
+   ULONGLONG vmOffset = 0;
+
+   /// file offset of the fixup location, relative to the image start
+   ULONGLONG fileOffset = 0;
+
+   /// raw pointer value
+   ULONGLONG rawValue = 0;
+
+   /// fixup kind
+   MachOChainedFixupKind kind = MachOChainedFixupKind::rebase;
+
+   /// rebases: target, as stored in the pointer, including the high 8 bits
+   ULONGLONG target = 0;
+
+   /// binds: import index
+   DWORD importIndex = 0;
+
+   /// binds: addend
+   LONGLONG addend = 0;
+};
+
+/// \brief Mach-O chained fixups
+/// \details Decodes the chained fixups header, the imports table and the
+/// chain starts of all segments. The fixups themselves are stored in place of
+/// the pointers to fix up, each with the offset to the next fixup in the same
+/// page; they are only decoded when walking the chains, which touches all
+/// pages of the data segments.
+class MachOChainedFixups
+{
+public:
+   /// function type to receive fixups; returns false to stop
+   using FixupHandler = std::function<bool(const MachOChainedFixup& fixup)>;
+
+   /// ctor; the image must outlive the chained fixups
+   explicit MachOChainedFixups(const MachOImage& image);
+
+   /// returns if the chained fixups are valid
+   bool IsValid() const { return m_isValid; }
+
+   /// returns an error text, when the chained fixups are invalid
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the chained fixups header
+   const MachOChainedFixupsHeader* Header() const { return m_header; }
+
+   /// returns the number of imports
+   size_t ImportsCount() const { return m_importsCount; }
+
+   /// decodes the import with given index
+   MachOChainedImport GetImport(size_t index) const;
+
+   /// returns the chain starts of all segments with fixups
+   const std::vector<MachOChainedStarts>& Starts() const { return m_starts; }
+
+   /// returns if the chains of the given pointer format can be walked
+   static bool IsSupportedPointerFormat(WORD pointerFormat);
+
+   /// walks all chains of the given segment starts and calls the handler
+   /// for every fixup; returns false when a chain is corrupt or the pointer
+   /// format isn't supported
+   bool ForEachFixup(const MachOChainedStarts& starts, const FixupHandler& handler) const;
+
+   /// returns a display text for a fixup kind
+   static LPCTSTR GetKindDisplayText(MachOChainedFixupKind kind);
+
+private:
+   /// decodes the chain starts of all segments
+   bool DecodeStarts(DWORD startsOffset);
+
+   /// decodes a single chained pointer; returns the stride multiplied offset
+   /// to the next fixup, or 0 at the end of the chain
+   static size_t DecodePointer(WORD pointerFormat, ULONGLONG rawValue, MachOChainedFixup& fixup);
+
+private:
+   /// Mach-O image
+   const MachOImage& m_image;
+
+   /// indicates if chained fixups are valid
+   bool m_isValid = false;
+
+   /// error text
+   CString m_errorText;
+
+   /// chained fixups data
+   const BYTE* m_data = nullptr;
+
+   /// chained fixups data size
+   size_t m_size = 0;
+
+   /// chained fixups header
+   const MachOChainedFixupsHeader* m_header = nullptr;
+
+   /// imports format
+   DWORD m_importsFormat = 0;
+
+   /// offset of the imports table
+   size_t m_importsOffset = 0;
+
+   /// number of imports
+   size_t m_importsCount = 0;
+
+   /// symbol names
+   const char* m_symbols = nullptr;
+
+   /// size of the symbol names
+   size_t m_symbolsSize = 0;
+
+   /// chain starts of all segments with fixups
+   std::vector<MachOChainedStarts> m_starts;
+};
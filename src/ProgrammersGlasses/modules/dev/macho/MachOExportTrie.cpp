@@ -0,0 +1,228 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachOExportTrie.cpp
+/// \brief Mach-O export trie, with lookup of exported symbols by name
+//
+#include "stdafx.h"
+#include "MachOExportTrie.hpp"
+#include "dev/dwarf/DwarfDataReader.hpp"
+#include <set>
+
+/// maximum length of a symbol name assembled from trie edges; dyld uses the
+/// same limit when walking the trie
+constexpr size_t c_maxExportNameLength = 32768;
+
+MachOExportTrie::MachOExportTrie(const MachOImage& image)
+{
+   const MachOLinkeditData& exportTrie = image.ExportTrie();
+   if (!exportTrie.IsAvailable())
+   {
+      m_errorText = _T("Image has no export trie");
+      return;
+   }
+
+   m_data = image.Data(exportTrie.offset, exportTrie.size);
+   if (m_data == nullptr)
+   {
+      m_errorText = _T("Export trie is outside of the file");
+      return;
+   }
+
+   m_size = exportTrie.size;
+   m_isValid = true;
+}
+
+std::optional<MachOExport> MachOExportTrie::Lookup(const CStringA& name) const
+{
+   if (!m_isValid || name.IsEmpty())
+      return std::nullopt;
+
+   const char* remainingName = name.GetString();
+   size_t remainingLength = name.GetLength();
+
+   size_t nodeOffset = 0;
+
+   // every step consumes at least one character of the name, so the walk
+   // terminates even for cyclic tries
+   while (remainingLength > 0)
+   {
+      std::optional<size_t> childrenOffset = GetChildrenOffset(nodeOffset);
+      if (!childrenOffset.has_value())
+         return std::nullopt;
+
+      DwarfDataReader reader{ m_data, m_size, true, childrenOffset.value() };
+
+      BYTE childCount = reader.ReadByte();
+
+      std::optional<size_t> nextNodeOffset;
+      for (BYTE childIndex = 0; childIndex < childCount && !reader.HasError(); childIndex++)
+      {
+         const char* edge = reader.ReadString();
+         ULONGLONG childOffset = reader.ReadUleb128();
+
+         size_t edgeLength = strlen(edge);
+         if (edgeLength == 0 ||
+            edgeLength > remainingLength ||
+            strncmp(edge, remainingName, edgeLength) != 0)
+            continue;
+
+         // edges of the children of a node never share a prefix, so the
+         // first matching edge is the only candidate
+         remainingName += edgeLength;
+         remainingLength -= edgeLength;
+         nextNodeOffset = static_cast<size_t>(childOffset);
+         break;
+      }
+
+      if (!nextNodeOffset.has_value() ||
+         nextNodeOffset.value() >= m_size)
+         return std::nullopt;
+
+      nodeOffset = nextNodeOffset.value();
+   }
+
+   MachOExport symbol;
+   if (!DecodeTerminal(nodeOffset, symbol))
+      return std::nullopt;
+
+   symbol.name = name;
+
+   return symbol;
+}
+
+bool MachOExportTrie::ForEachExport(const ExportHandler& handler) const
+{
+   if (!m_isValid)
+      return false;
+
+   struct PendingNode
+   {
+      size_t nodeOffset;
+      CStringA prefix;
+   };
+
+   std::vector<PendingNode> pendingNodes;
+   pendingNodes.push_back(PendingNode{ 0, CStringA{} });
+
+   // each node may only be visited once; this guards against cycles
+   std::set<size_t> visitedNodes;
+
+   while (!pendingNodes.empty())
+   {
+      PendingNode node = std::move(pendingNodes.back());
+      pendingNodes.pop_back();
+
+      if (!visitedNodes.insert(node.nodeOffset).second)
+         return false;
+
+      MachOExport symbol;
+      if (DecodeTerminal(node.nodeOffset, symbol))
+      {
+         symbol.name = node.prefix;
+
+         if (!handler(symbol))
+            return true;
+      }
+
+      std::optional<size_t> childrenOffset = GetChildrenOffset(node.nodeOffset);
+      if (!childrenOffset.has_value())
+         return false;
+
+      DwarfDataReader reader{ m_data, m_size, true, childrenOffset.value() };
+
+      BYTE childCount = reader.ReadByte();
+
+      std::vector<PendingNode> children;
+      for (BYTE childIndex = 0; childIndex < childCount; childIndex++)
+      {
+         const char* edge = reader.ReadString();
+         ULONGLONG childOffset = reader.ReadUleb128();
+
+         if (reader.HasError() ||
+            childOffset >= m_size)
+            return false;
+
+         CStringA childPrefix = node.prefix;
+         childPrefix += edge;
+
+         if (static_cast<size_t>(childPrefix.GetLength()) > c_maxExportNameLength)
+            return false;
+
+         children.push_back(PendingNode{ static_cast<size_t>(childOffset), childPrefix });
+      }
+
+      // pushed in reverse, so that the exports are reported in trie order
+      pendingNodes.insert(pendingNodes.end(), children.rbegin(), children.rend());
+   }
+
+   return true;
+}
+
+CString MachOExportTrie::GetFlagsDisplayText(ULONGLONG flags)
+{
+   CString text;
+
+   switch (flags & c_machOExportKindMask)
+   {
+   case c_machOExportKindRegular: text = _T("regular"); break;
+   case c_machOExportKindThreadLocal: text = _T("thread-local"); break;
+   case c_machOExportKindAbsolute: text = _T("absolute"); break;
+   default: text = _T("unknown kind"); break;
+   }
+
+   if ((flags & c_machOExportFlagWeakDefinition) != 0)
+      text += _T(", weak");
+
+   if ((flags & c_machOExportFlagReexport) != 0)
+      text += _T(", re-export");
+
+   if ((flags & c_machOExportFlagStubAndResolver) != 0)
+      text += _T(", resolver");
+
+   return text;
+}
+
+bool MachOExportTrie::DecodeTerminal(size_t nodeOffset, MachOExport& symbol) const
+{
+   DwarfDataReader reader{ m_data, m_size, true, nodeOffset };
+
+   ULONGLONG terminalSize = reader.ReadUleb128();
+   if (terminalSize == 0 ||
+      reader.HasError() ||
+      terminalSize > reader.Remaining())
+      return false;
+
+   DwarfDataReader terminalReader{ reader.Current(), static_cast<size_t>(terminalSize), true };
+
+   symbol.nodeOffset = nodeOffset;
+   symbol.flags = terminalReader.ReadUleb128();
+
+   if ((symbol.flags & c_machOExportFlagReexport) != 0)
+   {
+      symbol.libraryOrdinal = terminalReader.ReadUleb128();
+      symbol.importName = terminalReader.ReadString();
+   }
+   else
+   {
+      symbol.address = terminalReader.ReadUleb128();
+
+      if ((symbol.flags & c_machOExportFlagStubAndResolver) != 0)
+         symbol.resolverAddress = terminalReader.ReadUleb128();
+   }
+
+   return !terminalReader.HasError();
+}
+
+std::optional<size_t> MachOExportTrie::GetChildrenOffset(size_t nodeOffset) const
+{
+   DwarfDataReader reader{ m_data, m_size, true, nodeOffset };
+
+   ULONGLONG terminalSize = reader.ReadUleb128();
+   if (reader.HasError() ||
+      terminalSize >= reader.Remaining())
+      return std::nullopt;
+
+   return reader.Offset() + static_cast<size_t>(terminalSize);
+}
@@ -0,0 +1,118 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachOExportTrie.hpp
+/// \brief Mach-O export trie, with lookup of exported symbols by name
+//
+#pragma once
+
+#include "MachOImage.hpp"
+#include <functional>
+#include <optional>
+
+/// EXPORT_SYMBOL_FLAGS_KIND_MASK: mask for the export kind
+constexpr ULONGLONG c_machOExportKindMask = 0x03;
+
+/// EXPORT_SYMBOL_FLAGS_KIND_REGULAR: regular export
+constexpr ULONGLONG c_machOExportKindRegular = 0x00;
+
+/// EXPORT_SYMBOL_FLAGS_KIND_THREAD_LOCAL: thread local variable export
+constexpr ULONGLONG c_machOExportKindThreadLocal = 0x01;
+
+/// EXPORT_SYMBOL_FLAGS_KIND_ABSOLUTE: absolute value export
+constexpr ULONGLONG c_machOExportKindAbsolute = 0x02;
+
+/// EXPORT_SYMBOL_FLAGS_WEAK_DEFINITION: weak definition
+constexpr ULONGLONG c_machOExportFlagWeakDefinition = 0x04;
+
+/// EXPORT_SYMBOL_FLAGS_REEXPORT: symbol is re-exported from another library
+constexpr ULONGLONG c_machOExportFlagReexport = 0x08;
+
+/// EXPORT_SYMBOL_FLAGS_STUB_AND_RESOLVER: symbol has a stub and a resolver function
+constexpr ULONGLONG c_machOExportFlagStubAndResolver = 0x10;
+
+/// \brief Exported symbol, decoded from a terminal node of the export trie
+struct MachOExport
+{
+   /// symbol name, UTF-8 encoded
+   CStringA name;
+
+   /// export flags; EXPORT_SYMBOL_FLAGS_* values
+   ULONGLONG flags = 0;
+
+   /// address, relative to the image base; stub address for stub and
+   /// resolver exports; unused for re-exports
+   ULONGLONG address = 0;
+
+   /// re-exports: 1-based ordinal of the library that exports the symbol
+   ULONGLONG libraryOrdinal = 0;
+
+   /// re-exports: name of the symbol in the other library; empty when the
+   /// name is the same
+   CStringA importName;
+
+   /// stub and resolver exports: address of the resolver function
+   ULONGLONG resolverAddress = 0;
+
+   /// offset of the terminal node in the export trie
+   size_t nodeOffset = 0;
+};
+
+/// \brief Mach-O export trie
+/// \details The export trie of LC_DYLD_INFO(_ONLY) or LC_DYLD_EXPORTS_TRIE
+/// stores all exported symbols of an image in a prefix tree, with the edges
+/// labelled by name fragments. The trie is accessed directly in the mapped
+/// file and is only walked on request: a lookup follows the edges matching
+/// the symbol name, touching only the nodes on the path to the symbol, like
+/// dyld does. Enumerating all exports walks the whole trie, with guards
+/// against cycles and excessive depths in corrupt files.
+class MachOExportTrie
+{
+public:
+   /// function type to receive exported symbols; returns false to stop
+   using ExportHandler = std::function<bool(const MachOExport& symbol)>;
+
+   /// ctor; the image must outlive the export trie
+   explicit MachOExportTrie(const MachOImage& image);
+
+   /// returns if the export trie is valid
+   bool IsValid() const { return m_isValid; }
+
+   /// returns an error text, when the export trie is invalid
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the size of the export trie, in bytes
+   size_t Size() const { return m_size; }
+
+   /// looks up an exported symbol by its UTF-8 encoded name
+   std::optional<MachOExport> Lookup(const CStringA& name) const;
+
+   /// walks the whole trie and calls the handler for every exported symbol;
+   /// returns false when the trie is corrupt
+   bool ForEachExport(const ExportHandler& handler) const;
+
+   /// returns a display text for export flags
+   static CString GetFlagsDisplayText(ULONGLONG flags);
+
+private:
+   /// decodes the terminal info of the node at given offset; returns false
+   /// when the node has no terminal info or is corrupt
+   bool DecodeTerminal(size_t nodeOffset, MachOExport& symbol) const;
+
+   /// returns the offset of the child list of the node at given offset
+   std::optional<size_t> GetChildrenOffset(size_t nodeOffset) const;
+
+private:
+   /// indicates if export trie is valid
+   bool m_isValid = false;
+
+   /// error text
+   CString m_errorText;
+
+   /// export trie data
+   const BYTE* m_data = nullptr;
+
+   /// export trie size
+   size_t m_size = 0;
+};
@@ -0,0 +1,943 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachOHeader.cpp
+/// \brief Mach-O header, load command and universal (fat) header definitions
+//
+#include "stdafx.h"
+#include "MachOHeader.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapMachOCpuTypeToDisplayText =
+{
+   { 1, _T("CPU_TYPE_VAX") },
+   { 6, _T("CPU_TYPE_MC680x0") },
+   { 7, _T("CPU_TYPE_X86") },
+   { 0x01000007, _T("CPU_TYPE_X86_64") },
+   { 10, _T("CPU_TYPE_MC98000") },
+   { 11, _T("CPU_TYPE_HPPA") },
+   { 12, _T("CPU_TYPE_ARM") },
+   { 0x0100000c, _T("CPU_TYPE_ARM64") },
+   { 0x0200000c, _T("CPU_TYPE_ARM64_32") },
+   { 13, _T("CPU_TYPE_MC88000") },
+   { 14, _T("CPU_TYPE_SPARC") },
+   { 15, _T("CPU_TYPE_I860") },
+   { 18, _T("CPU_TYPE_POWERPC") },
+   { 0x01000012, _T("CPU_TYPE_POWERPC64") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapMachOFileTypeToDisplayText =
+{
+   { 0x1, _T("MH_OBJECT (Relocatable object file)") },
+   { 0x2, _T("MH_EXECUTE (Executable file)") },
+   { 0x3, _T("MH_FVMLIB (Fixed VM shared library)") },
+   { 0x4, _T("MH_CORE (Core file)") },
+   { 0x5, _T("MH_PRELOAD (Preloaded executable)") },
+   { 0x6, _T("MH_DYLIB (Dynamic library)") },
+   { 0x7, _T("MH_DYLINKER (Dynamic linker)") },
+   { 0x8, _T("MH_BUNDLE (Bundle)") },
+   { 0x9, _T("MH_DYLIB_STUB (Shared library stub)") },
+   { 0xa, _T("MH_DSYM (Debug symbols)") },
+   { 0xb, _T("MH_KEXT_BUNDLE (Kernel extension)") },
+   { 0xc, _T("MH_FILESET (File set)") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapMachOHeaderFlagsToDisplayText =
+{
+   { 0x00000001, _T("MH_NOUNDEFS") },
+   { 0x00000002, _T("MH_INCRLINK") },
+   { 0x00000004, _T("MH_DYLDLINK") },
+   { 0x00000008, _T("MH_BINDATLOAD") },
+   { 0x00000010, _T("MH_PREBOUND") },
+   { 0x00000020, _T("MH_SPLIT_SEGS") },
+   { 0x00000040, _T("MH_LAZY_INIT") },
+   { 0x00000080, _T("MH_TWOLEVEL") },
+   { 0x00000100, _T("MH_FORCE_FLAT") },
+   { 0x00000200, _T("MH_NOMULTIDEFS") },
+   { 0x00000400, _T("MH_NOFIXPREBINDING") },
+   { 0x00000800, _T("MH_PREBINDABLE") },
+   { 0x00001000, _T("MH_ALLMODSBOUND") },
+   { 0x00002000, _T("MH_SUBSECTIONS_VIA_SYMBOLS") },
+   { 0x00004000, _T("MH_CANONICAL") },
+   { 0x00008000, _T("MH_WEAK_DEFINES") },
+   { 0x00010000, _T("MH_BINDS_TO_WEAK") },
+   { 0x00020000, _T("MH_ALLOW_STACK_EXECUTION") },
+   { 0x00040000, _T("MH_ROOT_SAFE") },
+   { 0x00080000, _T("MH_SETUID_SAFE") },
+   { 0x00100000, _T("MH_NO_REEXPORTED_DYLIBS") },
+   { 0x00200000, _T("MH_PIE") },
+   { 0x00400000, _T("MH_DEAD_STRIPPABLE_DYLIB") },
+   { 0x00800000, _T("MH_HAS_TLV_DESCRIPTORS") },
+   { 0x01000000, _T("MH_NO_HEAP_EXECUTION") },
+   { 0x02000000, _T("MH_APP_EXTENSION_SAFE") },
+   { 0x04000000, _T("MH_NLIST_OUTOFSYNC_WITH_DYLDINFO") },
+   { 0x08000000, _T("MH_SIM_SUPPORT") },
+   { 0x80000000, _T("MH_DYLIB_IN_CACHE") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapMachOLoadCommandToDisplayText =
+{
+   { 0x01, _T("LC_SEGMENT") },
+   { 0x02, _T("LC_SYMTAB") },
+   { 0x03, _T("LC_SYMSEG") },
+   { 0x04, _T("LC_THREAD") },
+   { 0x05, _T("LC_UNIXTHREAD") },
+   { 0x06, _T("LC_LOADFVMLIB") },
+   { 0x07, _T("LC_IDFVMLIB") },
+   { 0x08, _T("LC_IDENT") },
+   { 0x09, _T("LC_FVMFILE") },
+   { 0x0a, _T("LC_PREPAGE") },
+   { 0x0b, _T("LC_DYSYMTAB") },
+   { 0x0c, _T("LC_LOAD_DYLIB") },
+   { 0x0d, _T("LC_ID_DYLIB") },
+   { 0x0e, _T("LC_LOAD_DYLINKER") },
+   { 0x0f, _T("LC_ID_DYLINKER") },
+   { 0x10, _T("LC_PREBOUND_DYLIB") },
+   { 0x11, _T("LC_ROUTINES") },
+   { 0x12, _T("LC_SUB_FRAMEWORK") },
+   { 0x13, _T("LC_SUB_UMBRELLA") },
+   { 0x14, _T("LC_SUB_CLIENT") },
+   { 0x15, _T("LC_SUB_LIBRARY") },
+   { 0x16, _T("LC_TWOLEVEL_HINTS") },
+   { 0x17, _T("LC_PREBIND_CKSUM") },
+   { 0x80000018, _T("LC_LOAD_WEAK_DYLIB") },
+   { 0x19, _T("LC_SEGMENT_64") },
+   { 0x1a, _T("LC_ROUTINES_64") },
+   { 0x1b, _T("LC_UUID") },
+   { 0x8000001c, _T("LC_RPATH") },
+   { 0x1d, _T("LC_CODE_SIGNATURE") },
+   { 0x1e, _T("LC_SEGMENT_SPLIT_INFO") },
+   { 0x8000001f, _T("LC_REEXPORT_DYLIB") },
+   { 0x20, _T("LC_LAZY_LOAD_DYLIB") },
+   { 0x21, _T("LC_ENCRYPTION_INFO") },
+   { 0x22, _T("LC_DYLD_INFO") },
+   { 0x80000022, _T("LC_DYLD_INFO_ONLY") },
+   { 0x80000023, _T("LC_LOAD_UPWARD_DYLIB") },
+   { 0x24, _T("LC_VERSION_MIN_MACOSX") },
+   { 0x25, _T("LC_VERSION_MIN_IPHONEOS") },
+   { 0x26, _T("LC_FUNCTION_STARTS") },
+   { 0x27, _T("LC_DYLD_ENVIRONMENT") },
+   { 0x80000028, _T("LC_MAIN") },
+   { 0x29, _T("LC_DATA_IN_CODE") },
+   { 0x2a, _T("LC_SOURCE_VERSION") },
+   { 0x2b, _T("LC_DYLIB_CODE_SIGN_DRS") },
+   { 0x2c, _T("LC_ENCRYPTION_INFO_64") },
+   { 0x2d, _T("LC_LINKER_OPTION") },
+   { 0x2e, _T("LC_LINKER_OPTIMIZATION_HINT") },
+   { 0x2f, _T("LC_VERSION_MIN_TVOS") },
+   { 0x30, _T("LC_VERSION_MIN_WATCHOS") },
+   { 0x31, _T("LC_NOTE") },
+   { 0x32, _T("LC_BUILD_VERSION") },
+   { 0x80000033, _T("LC_DYLD_EXPORTS_TRIE") },
+   { 0x80000034, _T("LC_DYLD_CHAINED_FIXUPS") },
+   { 0x80000035, _T("LC_FILESET_ENTRY") },
+   { 0x36, _T("LC_ATOM_INFO") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapMachOSectionTypeToDisplayText =
+{
+   { 0x00, _T("S_REGULAR") },
+   { 0x01, _T("S_ZEROFILL") },
+   { 0x02, _T("S_CSTRING_LITERALS") },
+   { 0x03, _T("S_4BYTE_LITERALS") },
+   { 0x04, _T("S_8BYTE_LITERALS") },
+   { 0x05, _T("S_LITERAL_POINTERS") },
+   { 0x06, _T("S_NON_LAZY_SYMBOL_POINTERS") },
+   { 0x07, _T("S_LAZY_SYMBOL_POINTERS") },
+   { 0x08, _T("S_SYMBOL_STUBS") },
+   { 0x09, _T("S_MOD_INIT_FUNC_POINTERS") },
+   { 0x0a, _T("S_MOD_TERM_FUNC_POINTERS") },
+   { 0x0b, _T("S_COALESCED") },
+   { 0x0c, _T("S_GB_ZEROFILL") },
+   { 0x0d, _T("S_INTERPOSING") },
+   { 0x0e, _T("S_16BYTE_LITERALS") },
+   { 0x0f, _T("S_DTRACE_DOF") },
+   { 0x10, _T("S_LAZY_DYLIB_SYMBOL_POINTERS") },
+   { 0x11, _T("S_THREAD_LOCAL_REGULAR") },
+   { 0x12, _T("S_THREAD_LOCAL_ZEROFILL") },
+   { 0x13, _T("S_THREAD_LOCAL_VARIABLES") },
+   { 0x14, _T("S_THREAD_LOCAL_VARIABLE_POINTERS") },
+   { 0x15, _T("S_THREAD_LOCAL_INIT_FUNCTION_POINTERS") },
+   { 0x16, _T("S_INIT_FUNC_OFFSETS") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapMachOSymbolTypeToDisplayText =
+{
+   { 0x0, _T("N_UNDF (Undefined)") },
+   { 0x2, _T("N_ABS (Absolute)") },
+   { 0xa, _T("N_INDR (Indirect)") },
+   { 0xc, _T("N_PBUD (Prebound undefined)") },
+   { 0xe, _T("N_SECT (Section)") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapMachOChainedPointerFormatToDisplayText =
+{
+   { 1, _T("DYLD_CHAINED_PTR_ARM64E") },
+   { 2, _T("DYLD_CHAINED_PTR_64") },
+   { 3, _T("DYLD_CHAINED_PTR_32") },
+   { 4, _T("DYLD_CHAINED_PTR_32_CACHE") },
+   { 5, _T("DYLD_CHAINED_PTR_32_FIRMWARE") },
+   { 6, _T("DYLD_CHAINED_PTR_64_OFFSET") },
+   { 7, _T("DYLD_CHAINED_PTR_ARM64E_KERNEL") },
+   { 8, _T("DYLD_CHAINED_PTR_64_KERNEL_CACHE") },
+   { 9, _T("DYLD_CHAINED_PTR_ARM64E_USERLAND") },
+   { 10, _T("DYLD_CHAINED_PTR_ARM64E_FIRMWARE") },
+   { 11, _T("DYLD_CHAINED_PTR_X86_64_KERNEL_CACHE") },
+   { 12, _T("DYLD_CHAINED_PTR_ARM64E_USERLAND24") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapMachOChainedImportsFormatToDisplayText =
+{
+   { 1, _T("DYLD_CHAINED_IMPORT") },
+   { 2, _T("DYLD_CHAINED_IMPORT_ADDEND") },
+   { 3, _T("DYLD_CHAINED_IMPORT_ADDEND64") },
+};
+
+/// mapping of virtual memory protection flags to display text
+static const std::map<DWORD, LPCTSTR> s_mapMachOVmProtectionToDisplayText =
+{
+   { 0x1, _T("VM_PROT_READ") },
+   { 0x2, _T("VM_PROT_WRITE") },
+   { 0x4, _T("VM_PROT_EXECUTE") },
+};
+
+/// mapping of segment flags to display text
+static const std::map<DWORD, LPCTSTR> s_mapMachOSegmentFlagsToDisplayText =
+{
+   { 0x1, _T("SG_HIGHVM") },
+   { 0x2, _T("SG_FVMLIB") },
+   { 0x4, _T("SG_NORELOC") },
+   { 0x8, _T("SG_PROTECTED_VERSION_1") },
+   { 0x10, _T("SG_READ_ONLY") },
+};
+
+/// section flags bitfield; section type in the low 8 bits, attributes in the high bits
+static const std::vector<BitfieldDescriptor> s_machOSectionFlagsBitfields =
+{
+   BitfieldDescriptor(0, 8, StructFieldType::valueMapping, g_mapMachOSectionTypeToDisplayText),
+   BitfieldDescriptor(8, 24),
+};
+
+/// creates the struct definition for 32-bit or 64-bit Mach-O headers
+template <typename THeader>
+static StructDefinition CreateMachOHeaderDefinition(bool littleEndian)
+{
+   return StructDefinition({
+      StructField(
+         offsetof(THeader, magic),
+         sizeof(THeader::magic),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Magic")),
+
+      StructField(
+         offsetof(THeader, cpuType),
+         sizeof(THeader::cpuType),
+         4,
+         littleEndian,
+         StructFieldType::valueMapping,
+         g_mapMachOCpuTypeToDisplayText,
+         _T("CPU type")),
+
+      StructField(
+         offsetof(THeader, cpuSubType),
+         sizeof(THeader::cpuSubType),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("CPU subtype")),
+
+      StructField(
+         offsetof(THeader, fileType),
+         sizeof(THeader::fileType),
+         4,
+         littleEndian,
+         StructFieldType::valueMapping,
+         g_mapMachOFileTypeToDisplayText,
+         _T("File type")),
+
+      StructField(
+         offsetof(THeader, numberOfCommands),
+         sizeof(THeader::numberOfCommands),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Number of load commands")),
+
+      StructField(
+         offsetof(THeader, sizeOfCommands),
+         sizeof(THeader::sizeOfCommands),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Size of load commands")),
+
+      StructField(
+         offsetof(THeader, flags),
+         sizeof(THeader::flags),
+         4,
+         littleEndian,
+         StructFieldType::flagsMapping,
+         g_mapMachOHeaderFlagsToDisplayText,
+         _T("Flags")),
+   });
+}
+
+/// creates the struct definition for 32-bit or 64-bit segment load commands
+template <typename TSegmentCommand>
+static StructDefinition CreateMachOSegmentCommandDefinition(bool littleEndian)
+{
+   return StructDefinition({
+      StructField(
+         offsetof(TSegmentCommand, command),
+         sizeof(TSegmentCommand::command),
+         4,
+         littleEndian,
+         StructFieldType::valueMapping,
+         g_mapMachOLoadCommandToDisplayText,
+         _T("Command")),
+
+      StructField(
+         offsetof(TSegmentCommand, commandSize),
+         sizeof(TSegmentCommand::commandSize),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Command size")),
+
+      StructField(
+         offsetof(TSegmentCommand, segmentName),
+         sizeof(TSegmentCommand::segmentName),
+         1,
+         true, // little-endian
+         StructFieldType::text,
+         _T("Segment name")),
+
+      StructField(
+         offsetof(TSegmentCommand, vmAddress),
+         sizeof(TSegmentCommand::vmAddress),
+         sizeof(TSegmentCommand::vmAddress),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Virtual memory address")),
+
+      StructField(
+         offsetof(TSegmentCommand, vmSize),
+         sizeof(TSegmentCommand::vmSize),
+         sizeof(TSegmentCommand::vmSize),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Virtual memory size")),
+
+      StructField(
+         offsetof(TSegmentCommand, fileOffset),
+         sizeof(TSegmentCommand::fileOffset),
+         sizeof(TSegmentCommand::fileOffset),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("File offset")),
+
+      StructField(
+         offsetof(TSegmentCommand, fileSize),
+         sizeof(TSegmentCommand::fileSize),
+         sizeof(TSegmentCommand::fileSize),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("File size")),
+
+      StructField(
+         offsetof(TSegmentCommand, maxProtection),
+         sizeof(TSegmentCommand::maxProtection),
+         4,
+         littleEndian,
+         StructFieldType::flagsMapping,
+         s_mapMachOVmProtectionToDisplayText,
+         _T("Maximum protection")),
+
+      StructField(
+         offsetof(TSegmentCommand, initialProtection),
+         sizeof(TSegmentCommand::initialProtection),
+         4,
+         littleEndian,
+         StructFieldType::flagsMapping,
+         s_mapMachOVmProtectionToDisplayText,
+         _T("Initial protection")),
+
+      StructField(
+         offsetof(TSegmentCommand, numberOfSections),
+         sizeof(TSegmentCommand::numberOfSections),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Number of sections")),
+
+      StructField(
+         offsetof(TSegmentCommand, flags),
+         sizeof(TSegmentCommand::flags),
+         4,
+         littleEndian,
+         StructFieldType::flagsMapping,
+         s_mapMachOSegmentFlagsToDisplayText,
+         _T("Flags")),
+   });
+}
+
+/// creates the struct definition for 32-bit or 64-bit section headers
+template <typename TSection>
+static StructDefinition CreateMachOSectionDefinition(bool littleEndian)
+{
+   return StructDefinition({
+      StructField(
+         offsetof(TSection, sectionName),
+         sizeof(TSection::sectionName),
+         1,
+         true, // little-endian
+         StructFieldType::text,
+         _T("Section name")),
+
+      StructField(
+         offsetof(TSection, segmentName),
+         sizeof(TSection::segmentName),
+         1,
+         true, // little-endian
+         StructFieldType::text,
+         _T("Segment name")),
+
+      StructField(
+         offsetof(TSection, address),
+         sizeof(TSection::address),
+         sizeof(TSection::address),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Virtual memory address")),
+
+      StructField(
+         offsetof(TSection, size),
+         sizeof(TSection::size),
+         sizeof(TSection::size),
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Size")),
+
+      StructField(
+         offsetof(TSection, offset),
+         sizeof(TSection::offset),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("File offset")),
+
+      StructField(
+         offsetof(TSection, align),
+         sizeof(TSection::align),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Alignment (power of 2)")),
+
+      StructField(
+         offsetof(TSection, relocationOffset),
+         sizeof(TSection::relocationOffset),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Relocation entries offset")),
+
+      StructField(
+         offsetof(TSection, numberOfRelocations),
+         sizeof(TSection::numberOfRelocations),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Number of relocation entries")),
+
+      StructField(
+         offsetof(TSection, flags),
+         sizeof(TSection::flags),
+         4,
+         littleEndian,
+         StructFieldType::bitfieldMapping,
+         s_machOSectionFlagsBitfields,
+         _T("Type and attributes")),
+
+      StructField(
+         offsetof(TSection, reserved1),
+         sizeof(TSection::reserved1),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Reserved 1")),
+
+      StructField(
+         offsetof(TSection, reserved2),
+         sizeof(TSection::reserved2),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Reserved 2")),
+   });
+}
+
+/// creates the struct definition for generic load commands
+static StructDefinition CreateMachOLoadCommandDefinition(bool littleEndian)
+{
+   return StructDefinition({
+      StructField(
+         offsetof(MachOLoadCommand, command),
+         sizeof(MachOLoadCommand::command),
+         4,
+         littleEndian,
+         StructFieldType::valueMapping,
+         g_mapMachOLoadCommandToDisplayText,
+         _T("Command")),
+
+      StructField(
+         offsetof(MachOLoadCommand, commandSize),
+         sizeof(MachOLoadCommand::commandSize),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Command size")),
+   });
+}
+
+/// creates the struct definition for symtab load commands
+static StructDefinition CreateMachOSymtabCommandDefinition(bool littleEndian)
+{
+   return StructDefinition({
+      StructField(
+         offsetof(MachOSymtabCommand, command),
+         sizeof(MachOSymtabCommand::command),
+         4,
+         littleEndian,
+         StructFieldType::valueMapping,
+         g_mapMachOLoadCommandToDisplayText,
+         _T("Command")),
+
+      StructField(
+         offsetof(MachOSymtabCommand, commandSize),
+         sizeof(MachOSymtabCommand::commandSize),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Command size")),
+
+      StructField(
+         offsetof(MachOSymtabCommand, symbolOffset),
+         sizeof(MachOSymtabCommand::symbolOffset),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Symbol table offset")),
+
+      StructField(
+         offsetof(MachOSymtabCommand, numberOfSymbols),
+         sizeof(MachOSymtabCommand::numberOfSymbols),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Number of symbols")),
+
+      StructField(
+         offsetof(MachOSymtabCommand, stringOffset),
+         sizeof(MachOSymtabCommand::stringOffset),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("String table offset")),
+
+      StructField(
+         offsetof(MachOSymtabCommand, stringSize),
+         sizeof(MachOSymtabCommand::stringSize),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("String table size")),
+   });
+}
+
+/// creates the struct definition for dysymtab load commands
+static StructDefinition CreateMachODysymtabCommandDefinition(bool littleEndian)
+{
+   return StructDefinition({
+      StructField(
+         offsetof(MachODysymtabCommand, command),
+         sizeof(MachODysymtabCommand::command),
+         4,
+         littleEndian,
+         StructFieldType::valueMapping,
+         g_mapMachOLoadCommandToDisplayText,
+         _T("Command")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, commandSize),
+         sizeof(MachODysymtabCommand::commandSize),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Command size")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, localSymbolIndex),
+         sizeof(MachODysymtabCommand::localSymbolIndex),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Local symbols index")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, numberOfLocalSymbols),
+         sizeof(MachODysymtabCommand::numberOfLocalSymbols),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Number of local symbols")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, externalSymbolIndex),
+         sizeof(MachODysymtabCommand::externalSymbolIndex),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("External symbols index")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, numberOfExternalSymbols),
+         sizeof(MachODysymtabCommand::numberOfExternalSymbols),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Number of external symbols")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, undefinedSymbolIndex),
+         sizeof(MachODysymtabCommand::undefinedSymbolIndex),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Undefined symbols index")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, numberOfUndefinedSymbols),
+         sizeof(MachODysymtabCommand::numberOfUndefinedSymbols),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Number of undefined symbols")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, tocOffset),
+         sizeof(MachODysymtabCommand::tocOffset),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Table of contents offset")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, numberOfTocEntries),
+         sizeof(MachODysymtabCommand::numberOfTocEntries),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Number of table of contents entries")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, moduleTableOffset),
+         sizeof(MachODysymtabCommand::moduleTableOffset),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Module table offset")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, numberOfModules),
+         sizeof(MachODysymtabCommand::numberOfModules),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Number of modules")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, externalReferenceOffset),
+         sizeof(MachODysymtabCommand::externalReferenceOffset),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Referenced symbol table offset")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, numberOfExternalReferences),
+         sizeof(MachODysymtabCommand::numberOfExternalReferences),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Number of referenced symbols")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, indirectSymbolOffset),
+         sizeof(MachODysymtabCommand::indirectSymbolOffset),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Indirect symbol table offset")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, numberOfIndirectSymbols),
+         sizeof(MachODysymtabCommand::numberOfIndirectSymbols),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Number of indirect symbols")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, externalRelocationOffset),
+         sizeof(MachODysymtabCommand::externalRelocationOffset),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("External relocations offset")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, numberOfExternalRelocations),
+         sizeof(MachODysymtabCommand::numberOfExternalRelocations),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Number of external relocations")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, localRelocationOffset),
+         sizeof(MachODysymtabCommand::localRelocationOffset),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Local relocations offset")),
+
+      StructField(
+         offsetof(MachODysymtabCommand, numberOfLocalRelocations),
+         sizeof(MachODysymtabCommand::numberOfLocalRelocations),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Number of local relocations")),
+   });
+}
+
+/// creates the struct definition for the chained fixups header
+static StructDefinition CreateMachOChainedFixupsHeaderDefinition(bool littleEndian)
+{
+   return StructDefinition({
+      StructField(
+         offsetof(MachOChainedFixupsHeader, fixupsVersion),
+         sizeof(MachOChainedFixupsHeader::fixupsVersion),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Fixups version")),
+
+      StructField(
+         offsetof(MachOChainedFixupsHeader, startsOffset),
+         sizeof(MachOChainedFixupsHeader::startsOffset),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Starts offset")),
+
+      StructField(
+         offsetof(MachOChainedFixupsHeader, importsOffset),
+         sizeof(MachOChainedFixupsHeader::importsOffset),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Imports offset")),
+
+      StructField(
+         offsetof(MachOChainedFixupsHeader, symbolsOffset),
+         sizeof(MachOChainedFixupsHeader::symbolsOffset),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Symbols offset")),
+
+      StructField(
+         offsetof(MachOChainedFixupsHeader, importsCount),
+         sizeof(MachOChainedFixupsHeader::importsCount),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Imports count")),
+
+      StructField(
+         offsetof(MachOChainedFixupsHeader, importsFormat),
+         sizeof(MachOChainedFixupsHeader::importsFormat),
+         4,
+         littleEndian,
+         StructFieldType::valueMapping,
+         g_mapMachOChainedImportsFormatToDisplayText,
+         _T("Imports format")),
+
+      StructField(
+         offsetof(MachOChainedFixupsHeader, symbolsFormat),
+         sizeof(MachOChainedFixupsHeader::symbolsFormat),
+         4,
+         littleEndian,
+         StructFieldType::unsignedInteger,
+         _T("Symbols format")),
+   });
+}
+
+/// creates the struct definition for universal binary architecture entries;
+/// these are always stored in big-endian byte order
+template <typename TFatArch>
+static StructDefinition CreateMachOFatArchDefinition()
+{
+   return StructDefinition({
+      StructField(
+         offsetof(TFatArch, cpuType),
+         sizeof(TFatArch::cpuType),
+         4,
+         false,
+         StructFieldType::valueMapping,
+         g_mapMachOCpuTypeToDisplayText,
+         _T("CPU type")),
+
+      StructField(
+         offsetof(TFatArch, cpuSubType),
+         sizeof(TFatArch::cpuSubType),
+         4,
+         false,
+         StructFieldType::unsignedInteger,
+         _T("CPU subtype")),
+
+      StructField(
+         offsetof(TFatArch, offset),
+         sizeof(TFatArch::offset),
+         sizeof(TFatArch::offset),
+         false,
+         StructFieldType::unsignedInteger,
+         _T("File offset")),
+
+      StructField(
+         offsetof(TFatArch, size),
+         sizeof(TFatArch::size),
+         sizeof(TFatArch::size),
+         false,
+         StructFieldType::unsignedInteger,
+         _T("Size")),
+
+      StructField(
+         offsetof(TFatArch, align),
+         sizeof(TFatArch::align),
+         4,
+         false,
+         StructFieldType::unsignedInteger,
+         _T("Alignment (power of 2)")),
+   });
+}
+
+const StructDefinition& GetMachOHeaderDefinition(bool is64Bit, bool littleEndian)
+{
+   static const StructDefinition definitions[2][2] =
+   {
+      {
+         CreateMachOHeaderDefinition<MachOHeader32>(false),
+         CreateMachOHeaderDefinition<MachOHeader32>(true),
+      },
+      {
+         CreateMachOHeaderDefinition<MachOHeader64>(false),
+         CreateMachOHeaderDefinition<MachOHeader64>(true),
+      },
+   };
+
+   return definitions[is64Bit ? 1 : 0][littleEndian ? 1 : 0];
+}
+
+const StructDefinition& GetMachOSegmentCommandDefinition(bool is64Bit, bool littleEndian)
+{
+   static const StructDefinition definitions[2][2] =
+   {
+      {
+         CreateMachOSegmentCommandDefinition<MachOSegmentCommand32>(false),
+         CreateMachOSegmentCommandDefinition<MachOSegmentCommand32>(true),
+      },
+      {
+         CreateMachOSegmentCommandDefinition<MachOSegmentCommand64>(false),
+         CreateMachOSegmentCommandDefinition<MachOSegmentCommand64>(true),
+      },
+   };
+
+   return definitions[is64Bit ? 1 : 0][littleEndian ? 1 : 0];
+}
+
+const StructDefinition& GetMachOSectionDefinition(bool is64Bit, bool littleEndian)
+{
+   static const StructDefinition definitions[2][2] =
+   {
+      {
+         CreateMachOSectionDefinition<MachOSection32>(false),
+         CreateMachOSectionDefinition<MachOSection32>(true),
+      },
+      {
+         CreateMachOSectionDefinition<MachOSection64>(false),
+         CreateMachOSectionDefinition<MachOSection64>(true),
+      },
+   };
+
+   return definitions[is64Bit ? 1 : 0][littleEndian ? 1 : 0];
+}
+
+const StructDefinition& GetMachOSymtabCommandDefinition(bool littleEndian)
+{
+   static const StructDefinition definitions[2] =
+   {
+      CreateMachOSymtabCommandDefinition(false),
+      CreateMachOSymtabCommandDefinition(true),
+   };
+
+   return definitions[littleEndian ? 1 : 0];
+}
+
+const StructDefinition& GetMachODysymtabCommandDefinition(bool littleEndian)
+{
+   static const StructDefinition definitions[2] =
+   {
+      CreateMachODysymtabCommandDefinition(false),
+      CreateMachODysymtabCommandDefinition(true),
+   };
+
+   return definitions[littleEndian ? 1 : 0];
+}
+
+const StructDefinition& GetMachOLoadCommandDefinition(bool littleEndian)
+{
+   static const StructDefinition definitions[2] =
+   {
+      CreateMachOLoadCommandDefinition(false),
+      CreateMachOLoadCommandDefinition(true),
+   };
+
+   return definitions[littleEndian ? 1 : 0];
+}
+
+const StructDefinition& GetMachOChainedFixupsHeaderDefinition(bool littleEndian)
+{
+   static const StructDefinition definitions[2] =
+   {
+      CreateMachOChainedFixupsHeaderDefinition(false),
+      CreateMachOChainedFixupsHeaderDefinition(true),
+   };
+
+   return definitions[littleEndian ? 1 : 0];
+}
+
+const StructDefinition& GetMachOFatArchDefinition(bool is64Bit)
+{
+   static const StructDefinition definitions[2] =
+   {
+      CreateMachOFatArchDefinition<MachOFatArch32>(),
+      CreateMachOFatArchDefinition<MachOFatArch64>(),
+   };
+
+   return definitions[is64Bit ? 1 : 0];
+}
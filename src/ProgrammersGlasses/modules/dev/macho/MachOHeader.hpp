@@ -0,0 +1,387 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachOHeader.hpp
+/// \brief Mach-O header, load command and universal (fat) header definitions
+//
+#pragma once
+
+#include "StructDefinition.hpp"
+
+#pragma pack(push, 1)
+
+/// \brief Mach-O header, for 32-bit files
+/// \see https://github.com/apple-oss-distributions/xnu/blob/main/EXTERNAL_HEADERS/mach-o/loader.h
+struct MachOHeader32
+{
+   DWORD magic;                  ///< magic number; MH_MAGIC
+   DWORD cpuType;                ///< CPU type; CPU_TYPE_* value
+   DWORD cpuSubType;             ///< CPU subtype; CPU_SUBTYPE_* value
+   DWORD fileType;               ///< file type; MH_* value
+   DWORD numberOfCommands;       ///< number of load commands
+   DWORD sizeOfCommands;         ///< size of all load commands, in bytes
+   DWORD flags;                  ///< header flags; MH_* flag values
+};
+
+/// \brief Mach-O header, for 64-bit files
+struct MachOHeader64
+{
+   DWORD magic;                  ///< magic number; MH_MAGIC_64
+   DWORD cpuType;                ///< CPU type; CPU_TYPE_* value
+   DWORD cpuSubType;             ///< CPU subtype; CPU_SUBTYPE_* value
+   DWORD fileType;               ///< file type; MH_* value
+   DWORD numberOfCommands;       ///< number of load commands
+   DWORD sizeOfCommands;         ///< size of all load commands, in bytes
+   DWORD flags;                  ///< header flags; MH_* flag values
+   DWORD reserved;               ///< reserved
+};
+
+/// \brief Universal (fat) binary header; always stored in big-endian byte order
+/// \see https://github.com/apple-oss-distributions/xnu/blob/main/EXTERNAL_HEADERS/mach-o/fat.h
+struct MachOFatHeader
+{
+   DWORD magic;                  ///< magic number; FAT_MAGIC or FAT_MAGIC_64
+   DWORD numberOfArchitectures;  ///< number of fat_arch entries following the header
+};
+
+/// \brief Universal (fat) binary architecture entry, with 32-bit offsets
+struct MachOFatArch32
+{
+   DWORD cpuType;                ///< CPU type; CPU_TYPE_* value
+   DWORD cpuSubType;             ///< CPU subtype; CPU_SUBTYPE_* value
+   DWORD offset;                 ///< file offset of the architecture's image
+   DWORD size;                   ///< size of the architecture's image
+   DWORD align;                  ///< alignment, as power of 2
+};
+
+/// \brief Universal (fat) binary architecture entry, with 64-bit offsets
+struct MachOFatArch64
+{
+   DWORD cpuType;                ///< CPU type; CPU_TYPE_* value
+   DWORD cpuSubType;             ///< CPU subtype; CPU_SUBTYPE_* value
+   ULONGLONG offset;             ///< file offset of the architecture's image
+   ULONGLONG size;               ///< size of the architecture's image
+   DWORD align;                  ///< alignment, as power of 2
+   DWORD reserved;               ///< reserved
+};
+
+/// \brief Header common to all load commands
+struct MachOLoadCommand
+{
+   DWORD command;                ///< load command type; LC_* value
+   DWORD commandSize;            ///< size of the load command, including the header
+};
+
+/// \brief Segment load command, for 32-bit files
+struct MachOSegmentCommand32
+{
+   DWORD command;                ///< LC_SEGMENT
+   DWORD commandSize;            ///< size of the load command, including the section headers
+   CHAR segmentName[16];         ///< segment name, possibly not zero-terminated
+   DWORD vmAddress;              ///< virtual memory address of the segment
+   DWORD vmSize;                 ///< virtual memory size of the segment
+   DWORD fileOffset;             ///< file offset of the segment data
+   DWORD fileSize;               ///< size of the segment data in the file
+   DWORD maxProtection;          ///< maximum virtual memory protection
+   DWORD initialProtection;      ///< initial virtual memory protection
+   DWORD numberOfSections;       ///< number of section headers following the command
+   DWORD flags;                  ///< segment flags; SG_* values
+};
+
+/// \brief Segment load command, for 64-bit files
+struct MachOSegmentCommand64
+{
+   DWORD command;                ///< LC_SEGMENT_64
+   DWORD commandSize;            ///< size of the load command, including the section headers
+   CHAR segmentName[16];         ///< segment name, possibly not zero-terminated
+   ULONGLONG vmAddress;          ///< virtual memory address of the segment
+   ULONGLONG vmSize;             ///< virtual memory size of the segment
+   ULONGLONG fileOffset;         ///< file offset of the segment data
+   ULONGLONG fileSize;           ///< size of the segment data in the file
+   DWORD maxProtection;          ///< maximum virtual memory protection
+   DWORD initialProtection;      ///< initial virtual memory protection
+   DWORD numberOfSections;       ///< number of section headers following the command
+   DWORD flags;                  ///< segment flags; SG_* values
+};
+
+/// \brief Section header, for 32-bit files
+struct MachOSection32
+{
+   CHAR sectionName[16];         ///< section name, possibly not zero-terminated
+   CHAR segmentName[16];         ///< name of the segment containing the section
+   DWORD address;                ///< virtual memory address of the section
+   DWORD size;                   ///< size of the section, in bytes
+   DWORD offset;                 ///< file offset of the section data
+   DWORD align;                  ///< alignment, as power of 2
+   DWORD relocationOffset;       ///< file offset of the relocation entries
+   DWORD numberOfRelocations;    ///< number of relocation entries
+   DWORD flags;                  ///< section type and attributes
+   DWORD reserved1;              ///< reserved; index or count, depending on section type
+   DWORD reserved2;              ///< reserved; stub size, depending on section type
+};
+
+/// \brief Section header, for 64-bit files
+struct MachOSection64
+{
+   CHAR sectionName[16];         ///< section name, possibly not zero-terminated
+   CHAR segmentName[16];         ///< name of the segment containing the section
+   ULONGLONG address;            ///< virtual memory address of the section
+   ULONGLONG size;               ///< size of the section, in bytes
+   DWORD offset;                 ///< file offset of the section data
+   DWORD align;                  ///< alignment, as power of 2
+   DWORD relocationOffset;       ///< file offset of the relocation entries
+   DWORD numberOfRelocations;    ///< number of relocation entries
+   DWORD flags;                  ///< section type and attributes
+   DWORD reserved1;              ///< reserved; index or count, depending on section type
+   DWORD reserved2;              ///< reserved; stub size, depending on section type
+   DWORD reserved3;              ///< reserved
+};
+
+/// \brief Symbol table load command
+struct MachOSymtabCommand
+{
+   DWORD command;                ///< LC_SYMTAB
+   DWORD commandSize;            ///< size of the load command
+   DWORD symbolOffset;           ///< file offset of the symbol table
+   DWORD numberOfSymbols;        ///< number of symbol table entries
+   DWORD stringOffset;           ///< file offset of the string table
+   DWORD stringSize;             ///< size of the string table, in bytes
+};
+
+/// \brief Dynamic symbol table load command
+struct MachODysymtabCommand
+{
+   DWORD command;                ///< LC_DYSYMTAB
+   DWORD commandSize;            ///< size of the load command
+   DWORD localSymbolIndex;       ///< index of the first local symbol
+   DWORD numberOfLocalSymbols;   ///< number of local symbols
+   DWORD externalSymbolIndex;    ///< index of the first externally defined symbol
+   DWORD numberOfExternalSymbols; ///< number of externally defined symbols
+   DWORD undefinedSymbolIndex;   ///< index of the first undefined symbol
+   DWORD numberOfUndefinedSymbols; ///< number of undefined symbols
+   DWORD tocOffset;              ///< file offset of the table of contents
+   DWORD numberOfTocEntries;     ///< number of table of contents entries
+   DWORD moduleTableOffset;      ///< file offset of the module table
+   DWORD numberOfModules;        ///< number of module table entries
+   DWORD externalReferenceOffset; ///< file offset of the referenced symbol table
+   DWORD numberOfExternalReferences; ///< number of referenced symbol table entries
+   DWORD indirectSymbolOffset;   ///< file offset of the indirect symbol table
+   DWORD numberOfIndirectSymbols; ///< number of indirect symbol table entries
+   DWORD externalRelocationOffset; ///< file offset of the external relocation entries
+   DWORD numberOfExternalRelocations; ///< number of external relocation entries
+   DWORD localRelocationOffset;  ///< file offset of the local relocation entries
+   DWORD numberOfLocalRelocations; ///< number of local relocation entries
+};
+
+/// \brief Load command referencing data in the __LINKEDIT segment, e.g. for
+/// LC_DYLD_EXPORTS_TRIE, LC_DYLD_CHAINED_FIXUPS or LC_FUNCTION_STARTS
+struct MachOLinkeditDataCommand
+{
+   DWORD command;                ///< load command type; LC_* value
+   DWORD commandSize;            ///< size of the load command
+   DWORD dataOffset;             ///< file offset of the data
+   DWORD dataSize;               ///< size of the data, in bytes
+};
+
+/// \brief Compressed dyld info load command
+struct MachODyldInfoCommand
+{
+   DWORD command;                ///< LC_DYLD_INFO or LC_DYLD_INFO_ONLY
+   DWORD commandSize;            ///< size of the load command
+   DWORD rebaseOffset;           ///< file offset of the rebase opcodes
+   DWORD rebaseSize;             ///< size of the rebase opcodes
+   DWORD bindOffset;             ///< file offset of the bind opcodes
+   DWORD bindSize;               ///< size of the bind opcodes
+   DWORD weakBindOffset;         ///< file offset of the weak bind opcodes
+   DWORD weakBindSize;           ///< size of the weak bind opcodes
+   DWORD lazyBindOffset;         ///< file offset of the lazy bind opcodes
+   DWORD lazyBindSize;           ///< size of the lazy bind opcodes
+   DWORD exportOffset;           ///< file offset of the export trie
+   DWORD exportSize;             ///< size of the export trie
+};
+
+/// \brief Dynamic library load command
+struct MachODylibCommand
+{
+   DWORD command;                ///< LC_ID_DYLIB, LC_LOAD_DYLIB, etc.
+   DWORD commandSize;            ///< size of the load command, including the name
+   DWORD nameOffset;             ///< offset of the library path name, from the command start
+   DWORD timestamp;              ///< library build timestamp
+   DWORD currentVersion;         ///< library current version, as xxxx.yy.zz
+   DWORD compatibilityVersion;   ///< library compatibility version, as xxxx.yy.zz
+};
+
+/// \brief UUID load command
+struct MachOUuidCommand
+{
+   DWORD command;                ///< LC_UUID
+   DWORD commandSize;            ///< size of the load command
+   BYTE uuid[16];                ///< UUID of the image
+};
+
+/// \brief Symbol table entry, for 32-bit files
+struct MachONlist32
+{
+   DWORD stringIndex;            ///< offset of the symbol name in the string table
+   BYTE type;                    ///< symbol type and flags; N_* values
+   BYTE section;                 ///< section ordinal, 1-based; 0 for NO_SECT
+   WORD description;             ///< symbol description flags
+   DWORD value;                  ///< symbol value, e.g. an address
+};
+
+/// \brief Symbol table entry, for 64-bit files
+struct MachONlist64
+{
+   DWORD stringIndex;            ///< offset of the symbol name in the string table
+   BYTE type;                    ///< symbol type and flags; N_* values
+   BYTE section;                 ///< section ordinal, 1-based; 0 for NO_SECT
+   WORD description;             ///< symbol description flags
+   ULONGLONG value;              ///< symbol value, e.g. an address
+};
+
+/// \brief Chained fixups header, at the start of the LC_DYLD_CHAINED_FIXUPS data
+/// \see https://github.com/apple-oss-distributions/dyld/blob/main/include/mach-o/fixup-chains.h
+struct MachOChainedFixupsHeader
+{
+   DWORD fixupsVersion;          ///< version; 0
+   DWORD startsOffset;           ///< offset of the starts in image, from the header start
+   DWORD importsOffset;          ///< offset of the imports table, from the header start
+   DWORD symbolsOffset;          ///< offset of the symbol names, from the header start
+   DWORD importsCount;           ///< number of imports
+   DWORD importsFormat;          ///< format of the imports; DYLD_CHAINED_IMPORT* value
+   DWORD symbolsFormat;          ///< format of the symbol names; 0 for uncompressed
+};
+
+/// \brief Chain starts of a single segment
+struct MachOChainedStartsInSegment
+{
+   DWORD size;                   ///< size of this struct, including the page starts
+   WORD pageSize;                ///< page size; 0x1000 or 0x4000
+   WORD pointerFormat;           ///< pointer format; DYLD_CHAINED_PTR_* value
+   ULONGLONG segmentOffset;      ///< offset of the segment, from the image's mach header
+   DWORD maxValidPointer;        ///< for 32-bit formats, the maximum rebase target
+   WORD pageCount;               ///< number of page start entries
+   // WORD pageStart[pageCount] follows
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(MachOHeader32) == 28, "Mach-O header must be 28 bytes long");
+static_assert(sizeof(MachOHeader64) == 32, "Mach-O 64-bit header must be 32 bytes long");
+static_assert(sizeof(MachOFatHeader) == 8, "Fat header must be 8 bytes long");
+static_assert(sizeof(MachOFatArch32) == 20, "Fat arch entry must be 20 bytes long");
+static_assert(sizeof(MachOFatArch64) == 32, "Fat arch 64-bit entry must be 32 bytes long");
+static_assert(sizeof(MachOSegmentCommand32) == 56, "Segment command must be 56 bytes long");
+static_assert(sizeof(MachOSegmentCommand64) == 72, "Segment 64-bit command must be 72 bytes long");
+static_assert(sizeof(MachOSection32) == 68, "Section header must be 68 bytes long");
+static_assert(sizeof(MachOSection64) == 80, "Section 64-bit header must be 80 bytes long");
+static_assert(sizeof(MachOSymtabCommand) == 24, "Symtab command must be 24 bytes long");
+static_assert(sizeof(MachODysymtabCommand) == 80, "Dysymtab command must be 80 bytes long");
+static_assert(sizeof(MachODyldInfoCommand) == 48, "Dyld info command must be 48 bytes long");
+static_assert(sizeof(MachONlist32) == 12, "Symbol table entry must be 12 bytes long");
+static_assert(sizeof(MachONlist64) == 16, "Symbol table 64-bit entry must be 16 bytes long");
+static_assert(sizeof(MachOChainedFixupsHeader) == 28, "Chained fixups header must be 28 bytes long");
+static_assert(sizeof(MachOChainedStartsInSegment) == 22, "Chained starts in segment must be 22 bytes long");
+
+/// MH_MAGIC: 32-bit Mach-O magic number, in file byte order
+constexpr DWORD c_machOMagic32 = 0xfeedface;
+
+/// MH_MAGIC_64: 64-bit Mach-O magic number, in file byte order
+constexpr DWORD c_machOMagic64 = 0xfeedfacf;
+
+/// FAT_MAGIC: universal binary magic number, with 32-bit offsets
+constexpr DWORD c_machOFatMagic32 = 0xcafebabe;
+
+/// FAT_MAGIC_64: universal binary magic number, with 64-bit offsets
+constexpr DWORD c_machOFatMagic64 = 0xcafebabf;
+
+/// maximum number of architectures in a universal binary; Java class files
+/// share the magic number, but have a class file version of 45 and above in
+/// place of the architecture count
+constexpr DWORD c_machOMaxFatArchitectures = 32;
+
+/// CPU_ARCH_ABI64: CPU type flag for 64-bit architectures
+constexpr DWORD c_machOCpuArchAbi64 = 0x01000000;
+
+/// LC_REQ_DYLD: load command flag, indicating that dyld must understand the command
+constexpr DWORD c_machOLoadCommandRequiredByDyld = 0x80000000;
+
+constexpr DWORD c_machOLoadCommandSegment = 0x01;           ///< LC_SEGMENT
+constexpr DWORD c_machOLoadCommandSymtab = 0x02;            ///< LC_SYMTAB
+constexpr DWORD c_machOLoadCommandDysymtab = 0x0b;          ///< LC_DYSYMTAB
+constexpr DWORD c_machOLoadCommandLoadDylib = 0x0c;         ///< LC_LOAD_DYLIB
+constexpr DWORD c_machOLoadCommandIdDylib = 0x0d;           ///< LC_ID_DYLIB
+constexpr DWORD c_machOLoadCommandLoadWeakDylib = 0x80000018; ///< LC_LOAD_WEAK_DYLIB
+constexpr DWORD c_machOLoadCommandSegment64 = 0x19;         ///< LC_SEGMENT_64
+constexpr DWORD c_machOLoadCommandUuid = 0x1b;              ///< LC_UUID
+constexpr DWORD c_machOLoadCommandReexportDylib = 0x8000001f; ///< LC_REEXPORT_DYLIB
+constexpr DWORD c_machOLoadCommandLazyLoadDylib = 0x20;     ///< LC_LAZY_LOAD_DYLIB
+constexpr DWORD c_machOLoadCommandDyldInfo = 0x22;          ///< LC_DYLD_INFO
+constexpr DWORD c_machOLoadCommandDyldInfoOnly = 0x80000022; ///< LC_DYLD_INFO_ONLY
+constexpr DWORD c_machOLoadCommandLoadUpwardDylib = 0x80000023; ///< LC_LOAD_UPWARD_DYLIB
+constexpr DWORD c_machOLoadCommandDyldExportsTrie = 0x80000033; ///< LC_DYLD_EXPORTS_TRIE
+constexpr DWORD c_machOLoadCommandDyldChainedFixups = 0x80000034; ///< LC_DYLD_CHAINED_FIXUPS
+
+/// N_STAB: mask for symbolic debugging entries
+constexpr BYTE c_machOSymbolTypeStabMask = 0xe0;
+
+/// N_TYPE: mask for the symbol type
+constexpr BYTE c_machOSymbolTypeMask = 0x0e;
+
+/// N_EXT: external symbol flag
+constexpr BYTE c_machOSymbolTypeExternal = 0x01;
+
+/// N_UNDF: undefined symbol type
+constexpr BYTE c_machOSymbolTypeUndefined = 0x00;
+
+/// N_SECT: symbol type for symbols defined in a section
+constexpr BYTE c_machOSymbolTypeSection = 0x0e;
+
+/// mapping of CPU type to display text
+extern const std::map<DWORD, LPCTSTR> g_mapMachOCpuTypeToDisplayText;
+
+/// mapping of file type to display text
+extern const std::map<DWORD, LPCTSTR> g_mapMachOFileTypeToDisplayText;
+
+/// mapping of header flags to display text
+extern const std::map<DWORD, LPCTSTR> g_mapMachOHeaderFlagsToDisplayText;
+
+/// mapping of load command type to display text
+extern const std::map<DWORD, LPCTSTR> g_mapMachOLoadCommandToDisplayText;
+
+/// mapping of section type (the low 8 bits of the section flags) to display text
+extern const std::map<DWORD, LPCTSTR> g_mapMachOSectionTypeToDisplayText;
+
+/// mapping of symbol type (N_TYPE bits) to display text
+extern const std::map<DWORD, LPCTSTR> g_mapMachOSymbolTypeToDisplayText;
+
+/// mapping of chained fixups pointer format to display text
+extern const std::map<DWORD, LPCTSTR> g_mapMachOChainedPointerFormatToDisplayText;
+
+/// mapping of chained fixups imports format to display text
+extern const std::map<DWORD, LPCTSTR> g_mapMachOChainedImportsFormatToDisplayText;
+
+/// returns struct definition for the Mach-O header with given class and byte order
+const StructDefinition& GetMachOHeaderDefinition(bool is64Bit, bool littleEndian);
+
+/// returns struct definition for a segment load command with given class and byte order
+const StructDefinition& GetMachOSegmentCommandDefinition(bool is64Bit, bool littleEndian);
+
+/// returns struct definition for a section header with given class and byte order
+const StructDefinition& GetMachOSectionDefinition(bool is64Bit, bool littleEndian);
+
+/// returns struct definition for a symtab load command with given byte order
+const StructDefinition& GetMachOSymtabCommandDefinition(bool littleEndian);
+
+/// returns struct definition for a dysymtab load command with given byte order
+const StructDefinition& GetMachODysymtabCommandDefinition(bool littleEndian);
+
+/// returns struct definition for a generic load command with given byte order
+const StructDefinition& GetMachOLoadCommandDefinition(bool littleEndian);
+
+/// returns struct definition for the chained fixups header with given byte order
+const StructDefinition& GetMachOChainedFixupsHeaderDefinition(bool littleEndian);
+
+/// returns struct definition for a universal binary architecture entry
+const StructDefinition& GetMachOFatArchDefinition(bool is64Bit);
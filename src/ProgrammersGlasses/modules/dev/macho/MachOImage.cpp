@@ -0,0 +1,287 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachOImage.cpp
+/// \brief Mach-O image, with load command, segment and section access
+//
+#include "stdafx.h"
+#include "MachOImage.hpp"
+
+/// \brief Returns a name from a fixed size char array, possibly not zero-terminated
+static CString GetFixedSizeName(const CHAR* name, size_t maxLength)
+{
+   return CString(CStringA(name, static_cast<int>(strnlen(name, maxLength))));
+}
+
+bool MachOImage::IsMachOImage(const BYTE* data, size_t size)
+{
+   if (size < sizeof(MachOHeader32))
+      return false;
+
+   DWORD magic = *reinterpret_cast<const DWORD*>(data);
+
+   return
+      magic == c_machOMagic32 ||
+      magic == c_machOMagic64 ||
+      magic == SwapEndianness(c_machOMagic32) ||
+      magic == SwapEndianness(c_machOMagic64);
+}
+
+MachOImage::MachOImage(const File& file, size_t imageOffset, size_t imageSize)
+   :m_file(file),
+   m_imageOffset(imageOffset),
+   m_imageSize(imageSize)
+{
+   if (imageOffset > m_file.Size() ||
+      imageSize > m_file.Size() - imageOffset)
+   {
+      m_errorText = _T("Mach-O image is outside of the file");
+      return;
+   }
+
+   if (!IsMachOImage(ImageData(), m_imageSize))
+   {
+      m_errorText = _T("Invalid Mach-O magic number");
+      return;
+   }
+
+   DWORD magic = *reinterpret_cast<const DWORD*>(ImageData());
+
+   m_is64Bit = magic == c_machOMagic64 || magic == SwapEndianness(c_machOMagic64);
+   m_isLittleEndian = magic == c_machOMagic32 || magic == c_machOMagic64;
+
+   if (m_is64Bit && m_imageSize < sizeof(MachOHeader64))
+   {
+      m_errorText = _T("File is too small for a Mach-O 64-bit header");
+      return;
+   }
+
+   m_isValid = Dispatch([&](auto layout) { return DecodeHeaders(layout); });
+}
+
+const BYTE* MachOImage::Data(ULONGLONG offset, ULONGLONG size) const
+{
+   if (offset > m_imageSize ||
+      size > m_imageSize - offset)
+      return nullptr;
+
+   return ImageData() + offset;
+}
+
+template <typename TLayout>
+bool MachOImage::DecodeHeaders(TLayout layout)
+{
+   const typename TLayout::Header& header =
+      *reinterpret_cast<const typename TLayout::Header*>(ImageData());
+
+   m_cpuType = layout.Get(header.cpuType);
+   m_fileType = layout.Get(header.fileType);
+   m_flags = layout.Get(header.flags);
+
+   DWORD numberOfCommands = layout.Get(header.numberOfCommands);
+   DWORD sizeOfCommands = layout.Get(header.sizeOfCommands);
+
+   const BYTE* commands = Data(sizeof(typename TLayout::Header), sizeOfCommands);
+   if (commands == nullptr)
+   {
+      m_errorText = _T("Load commands are outside of the file");
+      return false;
+   }
+
+   // each load command is at least 8 bytes long; this limits the number of
+   // load commands decoded for corrupt headers
+   if (numberOfCommands > sizeOfCommands / sizeof(MachOLoadCommand))
+   {
+      m_errorText = _T("Number of load commands exceeds the load commands size");
+      return false;
+   }
+
+   size_t commandOffset = 0;
+   for (size_t commandIndex = 0; commandIndex < numberOfCommands; commandIndex++)
+   {
+      if (sizeOfCommands - commandOffset < sizeof(MachOLoadCommand))
+      {
+         m_errorText.Format(_T("Load command %zu is outside of the load commands"), commandIndex);
+         return false;
+      }
+
+      const BYTE* command = commands + commandOffset;
+      const MachOLoadCommand& loadCommand = *reinterpret_cast<const MachOLoadCommand*>(command);
+
+      DWORD commandType = layout.Get(loadCommand.command);
+      DWORD commandSize = layout.Get(loadCommand.commandSize);
+
+      if (commandSize < sizeof(MachOLoadCommand) ||
+         commandSize > sizeOfCommands - commandOffset)
+      {
+         m_errorText.Format(_T("Load command %zu has an invalid size"), commandIndex);
+         return false;
+      }
+
+      m_loadCommands.push_back(
+         MachOLoadCommandInfo{ commandIndex, commandType, commandSize, command });
+
+      switch (commandType)
+      {
+      case TLayout::segmentCommand:
+         if (!DecodeSegment(layout, command, commandSize))
+            return false;
+         break;
+
+      case c_machOLoadCommandSymtab:
+         if (commandSize >= sizeof(MachOSymtabCommand))
+            m_symtabCommand = reinterpret_cast<const MachOSymtabCommand*>(command);
+         break;
+
+      case c_machOLoadCommandDysymtab:
+         if (commandSize >= sizeof(MachODysymtabCommand))
+            m_dysymtabCommand = reinterpret_cast<const MachODysymtabCommand*>(command);
+         break;
+
+      case c_machOLoadCommandIdDylib:
+      case c_machOLoadCommandLoadDylib:
+      case c_machOLoadCommandLoadWeakDylib:
+      case c_machOLoadCommandReexportDylib:
+      case c_machOLoadCommandLazyLoadDylib:
+      case c_machOLoadCommandLoadUpwardDylib:
+         DecodeDylib(layout, command, commandSize);
+         break;
+
+      case c_machOLoadCommandUuid:
+         if (commandSize >= sizeof(MachOUuidCommand))
+         {
+            const BYTE* uuid = reinterpret_cast<const MachOUuidCommand*>(command)->uuid;
+
+            CString uuidText;
+            for (size_t index = 0; index < 16; index++)
+            {
+               if (index == 4 || index == 6 || index == 8 || index == 10)
+                  uuidText += _T('-');
+
+               uuidText.AppendFormat(_T("%02X"), uuid[index]);
+            }
+
+            m_uuid = uuidText;
+         }
+         break;
+
+      case c_machOLoadCommandDyldInfo:
+      case c_machOLoadCommandDyldInfoOnly:
+         // an LC_DYLD_EXPORTS_TRIE command takes precedence
+         if (commandSize >= sizeof(MachODyldInfoCommand) &&
+            !m_exportTrie.IsAvailable())
+         {
+            const MachODyldInfoCommand& dyldInfo = *reinterpret_cast<const MachODyldInfoCommand*>(command);
+            m_exportTrie.offset = layout.Get(dyldInfo.exportOffset);
+            m_exportTrie.size = layout.Get(dyldInfo.exportSize);
+         }
+         break;
+
+      case c_machOLoadCommandDyldExportsTrie:
+      case c_machOLoadCommandDyldChainedFixups:
+         if (commandSize >= sizeof(MachOLinkeditDataCommand))
+         {
+            const MachOLinkeditDataCommand& linkeditData = *reinterpret_cast<const MachOLinkeditDataCommand*>(command);
+
+            MachOLinkeditData& data = commandType == c_machOLoadCommandDyldExportsTrie
+               ? m_exportTrie
+               : m_chainedFixups;
+
+            data.offset = layout.Get(linkeditData.dataOffset);
+            data.size = layout.Get(linkeditData.dataSize);
+         }
+         break;
+
+      default:
+         break;
+      }
+
+      commandOffset += commandSize;
+   }
+
+   return true;
+}
+
+template <typename TLayout>
+bool MachOImage::DecodeSegment(TLayout layout, const BYTE* command, DWORD commandSize)
+{
+   using SegmentCommand = typename TLayout::SegmentCommand;
+   using Section = typename TLayout::Section;
+
+   if (commandSize < sizeof(SegmentCommand))
+   {
+      m_errorText.Format(_T("Segment load command %zu is too small"), m_loadCommands.size() - 1);
+      return false;
+   }
+
+   const SegmentCommand& segmentCommand = *reinterpret_cast<const SegmentCommand*>(command);
+
+   MachOSegment segment;
+   segment.index = m_segments.size();
+   segment.name = GetFixedSizeName(segmentCommand.segmentName, sizeof(segmentCommand.segmentName));
+   segment.vmAddress = layout.Get(segmentCommand.vmAddress);
+   segment.vmSize = layout.Get(segmentCommand.vmSize);
+   segment.fileOffset = layout.Get(segmentCommand.fileOffset);
+   segment.fileSize = layout.Get(segmentCommand.fileSize);
+   segment.maxProtection = layout.Get(segmentCommand.maxProtection);
+   segment.initialProtection = layout.Get(segmentCommand.initialProtection);
+   segment.flags = layout.Get(segmentCommand.flags);
+   segment.firstSectionIndex = m_sections.size();
+   segment.sectionCount = layout.Get(segmentCommand.numberOfSections);
+   segment.command = command;
+
+   if (segment.sectionCount > (commandSize - sizeof(SegmentCommand)) / sizeof(Section))
+   {
+      m_errorText.Format(_T("Sections of segment %s exceed the segment load command"),
+         segment.name.GetString());
+      return false;
+   }
+
+   const Section* sections = reinterpret_cast<const Section*>(command + sizeof(SegmentCommand));
+   for (size_t sectionIndex = 0; sectionIndex < segment.sectionCount; sectionIndex++)
+   {
+      const Section& sectionHeader = sections[sectionIndex];
+
+      MachOSection section;
+      section.index = m_sections.size();
+      section.sectionName = GetFixedSizeName(sectionHeader.sectionName, sizeof(sectionHeader.sectionName));
+      section.segmentName = GetFixedSizeName(sectionHeader.segmentName, sizeof(sectionHeader.segmentName));
+      section.address = layout.Get(sectionHeader.address);
+      section.size = layout.Get(sectionHeader.size);
+      section.offset = layout.Get(sectionHeader.offset);
+      section.align = layout.Get(sectionHeader.align);
+      section.flags = layout.Get(sectionHeader.flags);
+      section.header = reinterpret_cast<const BYTE*>(&sectionHeader);
+
+      m_sections.push_back(section);
+   }
+
+   m_segments.push_back(segment);
+
+   return true;
+}
+
+template <typename TLayout>
+void MachOImage::DecodeDylib(TLayout layout, const BYTE* command, DWORD commandSize)
+{
+   if (commandSize < sizeof(MachODylibCommand))
+      return;
+
+   const MachODylibCommand& dylibCommand = *reinterpret_cast<const MachODylibCommand*>(command);
+
+   MachODylib dylib;
+   dylib.command = layout.Get(dylibCommand.command);
+   dylib.currentVersion = layout.Get(dylibCommand.currentVersion);
+   dylib.compatibilityVersion = layout.Get(dylibCommand.compatibilityVersion);
+
+   DWORD nameOffset = layout.Get(dylibCommand.nameOffset);
+   if (nameOffset < commandSize)
+   {
+      dylib.name = GetFixedSizeName(
+         reinterpret_cast<const CHAR*>(command + nameOffset),
+         commandSize - nameOffset);
+   }
+
+   m_dylibs.push_back(dylib);
+}
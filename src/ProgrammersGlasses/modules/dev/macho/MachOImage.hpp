@@ -0,0 +1,360 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachOImage.hpp
+/// \brief Mach-O image, with load command, segment and section access
+//
+#pragma once
+
+#include "MachOHeader.hpp"
+#include "DataHelper.hpp"
+#include "File.hpp"
+#include <optional>
+
+/// \brief Types of 32-bit Mach-O files
+struct MachO32Class
+{
+   using Header = MachOHeader32;                ///< Mach-O header type
+   using SegmentCommand = MachOSegmentCommand32; ///< segment load command type
+   using Section = MachOSection32;              ///< section header type
+   using Nlist = MachONlist32;                  ///< symbol table entry type
+   using Address = DWORD;                       ///< address type
+
+   /// indicates a 64-bit class
+   static constexpr bool is64Bit = false;
+
+   /// segment load command type
+   static constexpr DWORD segmentCommand = c_machOLoadCommandSegment;
+};
+
+/// \brief Types of 64-bit Mach-O files
+struct MachO64Class
+{
+   using Header = MachOHeader64;                ///< Mach-O header type
+   using SegmentCommand = MachOSegmentCommand64; ///< segment load command type
+   using Section = MachOSection64;              ///< section header type
+   using Nlist = MachONlist64;                  ///< symbol table entry type
+   using Address = ULONGLONG;                   ///< address type
+
+   /// indicates a 64-bit class
+   static constexpr bool is64Bit = true;
+
+   /// segment load command type
+   static constexpr DWORD segmentCommand = c_machOLoadCommandSegment64;
+};
+
+/// \brief Mach-O file layout, for a class and byte order
+/// \details Mach-O files are usually little-endian; only PowerPC files are
+/// stored in big-endian byte order. Like the ELF layout, the layout selects
+/// the struct types and the byte order conversion at compile time.
+template <typename TClass, bool littleEndian>
+struct MachOLayout : public TClass
+{
+   /// indicates little-endian byte order
+   static constexpr bool isLittleEndian = littleEndian;
+
+   /// converts a value from file to host byte order
+   template <typename T>
+   static T Get(T value)
+   {
+      if constexpr (littleEndian || sizeof(T) == 1)
+         return value;
+      else if constexpr (sizeof(T) == 2)
+         return static_cast<T>(SwapEndianness(static_cast<WORD>(value)));
+      else if constexpr (sizeof(T) == 4)
+         return static_cast<T>(SwapEndianness(static_cast<DWORD>(value)));
+      else
+         return static_cast<T>(SwapEndianness(static_cast<ULONGLONG>(value)));
+   }
+};
+
+/// \brief Load command, with values converted to host byte order
+struct MachOLoadCommandInfo
+{
+   /// load command index
+   size_t index = 0;
+
+   /// load command type; LC_* value
+   DWORD command = 0;
+
+   /// load command size
+   DWORD commandSize = 0;
+
+   /// pointer to the load command in the file
+   const BYTE* data = nullptr;
+};
+
+/// \brief Segment, with values converted to host byte order
+struct MachOSegment
+{
+   /// segment index, in load command order
+   size_t index = 0;
+
+   /// segment name
+   CString name;
+
+   /// virtual memory address
+   ULONGLONG vmAddress = 0;
+
+   /// virtual memory size
+   ULONGLONG vmSize = 0;
+
+   /// file offset of segment data, relative to the image start
+   ULONGLONG fileOffset = 0;
+
+   /// size of segment data in the file
+   ULONGLONG fileSize = 0;
+
+   /// maximum virtual memory protection; VM_PROT_* values
+   DWORD maxProtection = 0;
+
+   /// initial virtual memory protection; VM_PROT_* values
+   DWORD initialProtection = 0;
+
+   /// segment flags; SG_* values
+   DWORD flags = 0;
+
+   /// index of the first section of the segment
+   size_t firstSectionIndex = 0;
+
+   /// number of sections of the segment
+   size_t sectionCount = 0;
+
+   /// pointer to the segment load command in the file
+   const BYTE* command = nullptr;
+};
+
+/// \brief Section, with values converted to host byte order
+struct MachOSection
+{
+   /// section index; 0-based, while symbols use 1-based section ordinals
+   size_t index = 0;
+
+   /// section name
+   CString sectionName;
+
+   /// name of the containing segment
+   CString segmentName;
+
+   /// virtual memory address
+   ULONGLONG address = 0;
+
+   /// section size
+   ULONGLONG size = 0;
+
+   /// file offset of section data, relative to the image start
+   DWORD offset = 0;
+
+   /// alignment, as power of 2
+   DWORD align = 0;
+
+   /// section type and attributes
+   DWORD flags = 0;
+
+   /// pointer to the section header in the file
+   const BYTE* header = nullptr;
+};
+
+/// \brief Dynamic library referenced or identified by a load command
+struct MachODylib
+{
+   /// load command type; LC_ID_DYLIB, LC_LOAD_DYLIB, etc.
+   DWORD command = 0;
+
+   /// library path name
+   CString name;
+
+   /// current version, as xxxx.yy.zz
+   DWORD currentVersion = 0;
+
+   /// compatibility version, as xxxx.yy.zz
+   DWORD compatibilityVersion = 0;
+};
+
+/// \brief Location of data in the __LINKEDIT segment
+struct MachOLinkeditData
+{
+   /// file offset, relative to the image start
+   DWORD offset = 0;
+
+   /// data size
+   DWORD size = 0;
+
+   /// returns if the data is available
+   bool IsAvailable() const { return size != 0; }
+};
+
+/// \brief Mach-O image
+/// \details Decodes the Mach-O header and the load commands of a thin
+/// Mach-O file, or of a single architecture of a universal (fat) binary.
+/// All offsets in the image are relative to the image start. Symbol table,
+/// export trie and chained fixups are only located here; they are decoded by
+/// separate classes when accessed.
+class MachOImage
+{
+public:
+   /// returns if the data starts with a Mach-O magic number
+   static bool IsMachOImage(const BYTE* data, size_t size);
+
+   /// ctor; decodes the image at given file offset and size
+   MachOImage(const File& file, size_t imageOffset, size_t imageSize);
+
+   /// returns if image is valid
+   bool IsValid() const { return m_isValid; }
+
+   /// returns an error text, when the image is invalid
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the file
+   const File& GetFile() const { return m_file; }
+
+   /// returns the file offset of the image
+   size_t ImageOffset() const { return m_imageOffset; }
+
+   /// returns the size of the image
+   size_t ImageSize() const { return m_imageSize; }
+
+   /// returns the pointer to the image start, i.e. the Mach-O header
+   const BYTE* ImageData() const { return m_file.Data<BYTE>(m_imageOffset); }
+
+   /// returns if the image is a 64-bit image
+   bool Is64Bit() const { return m_is64Bit; }
+
+   /// returns if the image uses little-endian byte order
+   bool IsLittleEndian() const { return m_isLittleEndian; }
+
+   /// returns the CPU type; CPU_TYPE_* value
+   DWORD CpuType() const { return m_cpuType; }
+
+   /// returns the file type; MH_* value
+   DWORD FileType() const { return m_fileType; }
+
+   /// returns the header flags
+   DWORD Flags() const { return m_flags; }
+
+   /// returns all load commands
+   const std::vector<MachOLoadCommandInfo>& LoadCommands() const { return m_loadCommands; }
+
+   /// returns all segments
+   const std::vector<MachOSegment>& Segments() const { return m_segments; }
+
+   /// returns all sections, of all segments
+   const std::vector<MachOSection>& Sections() const { return m_sections; }
+
+   /// returns all referenced and identified dynamic libraries
+   const std::vector<MachODylib>& Dylibs() const { return m_dylibs; }
+
+   /// returns the UUID, when available
+   const std::optional<CString>& Uuid() const { return m_uuid; }
+
+   /// returns the LC_SYMTAB load command, or nullptr when not available
+   const MachOSymtabCommand* SymtabCommand() const { return m_symtabCommand; }
+
+   /// returns the LC_DYSYMTAB load command, or nullptr when not available
+   const MachODysymtabCommand* DysymtabCommand() const { return m_dysymtabCommand; }
+
+   /// returns the export trie location
+   const MachOLinkeditData& ExportTrie() const { return m_exportTrie; }
+
+   /// returns the chained fixups location
+   const MachOLinkeditData& ChainedFixups() const { return m_chainedFixups; }
+
+   /// returns a pointer to image data, or nullptr when the range is outside
+   /// of the image
+   const BYTE* Data(ULONGLONG offset, ULONGLONG size) const;
+
+   /// converts a value from image to host byte order
+   template <typename T>
+   T Get(T value) const
+   {
+      return Dispatch([value](auto layout) { return layout.Get(value); });
+   }
+
+   /// \brief Calls the given function with the MachOLayout matching the image
+   /// \details The function is usually a generic lambda taking the layout as
+   /// auto parameter; it is instantiated once for every layout.
+   template <typename TFunc>
+   auto Dispatch(TFunc&& func) const
+   {
+      if (m_is64Bit)
+         return m_isLittleEndian
+            ? func(MachOLayout<MachO64Class, true>{})
+            : func(MachOLayout<MachO64Class, false>{});
+
+      return m_isLittleEndian
+         ? func(MachOLayout<MachO32Class, true>{})
+         : func(MachOLayout<MachO32Class, false>{});
+   }
+
+private:
+   /// decodes header and load commands
+   template <typename TLayout>
+   bool DecodeHeaders(TLayout layout);
+
+   /// decodes a segment load command and its section headers
+   template <typename TLayout>
+   bool DecodeSegment(TLayout layout, const BYTE* command, DWORD commandSize);
+
+   /// decodes a dylib load command
+   template <typename TLayout>
+   void DecodeDylib(TLayout layout, const BYTE* command, DWORD commandSize);
+
+private:
+   /// file
+   const File& m_file;
+
+   /// file offset of the image
+   size_t m_imageOffset;
+
+   /// size of the image
+   size_t m_imageSize;
+
+   /// indicates if image is valid
+   bool m_isValid = false;
+
+   /// error text
+   CString m_errorText;
+
+   /// indicates a 64-bit image
+   bool m_is64Bit = false;
+
+   /// indicates little-endian byte order
+   bool m_isLittleEndian = true;
+
+   /// CPU type
+   DWORD m_cpuType = 0;
+
+   /// file type
+   DWORD m_fileType = 0;
+
+   /// header flags
+   DWORD m_flags = 0;
+
+   /// all load commands
+   std::vector<MachOLoadCommandInfo> m_loadCommands;
+
+   /// all segments
+   std::vector<MachOSegment> m_segments;
+
+   /// all sections
+   std::vector<MachOSection> m_sections;
+
+   /// all dynamic libraries
+   std::vector<MachODylib> m_dylibs;
+
+   /// UUID
+   std::optional<CString> m_uuid;
+
+   /// symtab load command
+   const MachOSymtabCommand* m_symtabCommand = nullptr;
+
+   /// dysymtab load command
+   const MachODysymtabCommand* m_dysymtabCommand = nullptr;
+
+   /// export trie location
+   MachOLinkeditData m_exportTrie;
+
+   /// chained fixups location
+   MachOLinkeditData m_chainedFixups;
+};
@@ -0,0 +1,35 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachOModule.cpp
+/// \brief module to load Mach-O and universal (fat) binary files
+//
+#include "stdafx.h"
+#include "MachOModule.hpp"
+#include "MachOReader.hpp"
+
+CString MachOModule::DisplayName() const
+{
+   return CString{ "Mach-O binary module" };
+}
+
+ModuleIconID MachOModule::IconID() const
+{
+   return ModuleIconID::moduleDynamicLib;
+}
+
+CString MachOModule::FilterStrings() const
+{
+   return CString{ "Mach-O dynamic libraries (*.dylib)|*.dylib|Mach-O bundles (*.bundle)|*.bundle|Mach-O object files (*.o)|*.o|" };
+}
+
+bool MachOModule::IsModuleApplicableForFile(const File& file) const
+{
+   return MachOReader::IsMachOFile(file);
+}
+
+std::shared_ptr<IReader> MachOModule::OpenReader(const File& file) const
+{
+   return std::make_shared<MachOReader>(file);
+}
@@ -0,0 +1,28 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachOModule.hpp
+/// \brief module to load Mach-O and universal (fat) binary files
+//
+#pragma once
+
+#include "modules/IModule.hpp"
+
+/// \brief Mach-O module
+/// \details module to load files in the Mach-O format, e.g. .dylib files, as
+/// well as universal (fat) binaries containing Mach-O files for multiple
+/// architectures
+class MachOModule : public IModule
+{
+public:
+   /// ctor
+   MachOModule() = default;
+
+   // Inherited via IModule
+   CString DisplayName() const override;
+   ModuleIconID IconID() const override;
+   CString FilterStrings() const override;
+   bool IsModuleApplicableForFile(const File& file) const override;
+   std::shared_ptr<IReader> OpenReader(const File& file) const override;
+};
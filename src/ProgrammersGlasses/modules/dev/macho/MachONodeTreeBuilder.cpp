@@ -0,0 +1,797 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachONodeTreeBuilder.cpp
+/// \brief Node tree builder for a single Mach-O image
+//
+#include "stdafx.h"
+#include "MachONodeTreeBuilder.hpp"
+#include "MachOImage.hpp"
+#include "MachOSymbolTable.hpp"
+#include "MachOExportTrie.hpp"
+#include "MachOChainedFixups.hpp"
+#include "modules/CodeTextViewNode.hpp"
+#include "modules/FilterSortListViewNode.hpp"
+#include "modules/StructListViewNode.hpp"
+#include "modules/DisplayFormatHelper.hpp"
+
+/// maximum number of fixups displayed per segment; the fixup chains of large
+/// images can contain millions of fixups
+constexpr size_t c_maxDisplayedFixupCount = 100000;
+
+/// \brief Formats a dylib version, encoded as xxxx.yy.zz
+static CString FormatDylibVersion(DWORD version)
+{
+   CString text;
+   text.Format(_T("%u.%u.%u"), version >> 16, (version >> 8) & 0xff, version & 0xff);
+   return text;
+}
+
+/// \brief Formats virtual memory protection flags as read, write and execute letters
+static CString FormatProtection(DWORD protection)
+{
+   CString text;
+   text.AppendChar((protection & 1) != 0 ? _T('r') : _T('-'));
+   text.AppendChar((protection & 2) != 0 ? _T('w') : _T('-'));
+   text.AppendChar((protection & 4) != 0 ? _T('x') : _T('-'));
+
+   return text;
+}
+
+MachONodeTreeBuilder::MachONodeTreeBuilder(std::shared_ptr<MachOImage> image)
+   :m_image(image)
+{
+}
+
+void MachONodeTreeBuilder::AddImageNodes(StaticNode& imageNode, CString& summaryText)
+{
+   AddHeader(imageNode, summaryText);
+
+   if (!m_image->IsValid())
+   {
+      summaryText.AppendFormat(_T("Error: %s\n"), m_image->GetErrorText().GetString());
+      return;
+   }
+
+   if (m_image->ExportTrie().IsAvailable())
+      m_exportTrie = std::make_shared<MachOExportTrie>(*m_image);
+
+   AddLoadCommands(imageNode, summaryText);
+   AddSegments(imageNode, summaryText);
+   AddSections(imageNode, summaryText);
+   AddDylibs(summaryText);
+   AddSymbolTable(imageNode, summaryText);
+   AddExports(imageNode, summaryText);
+   AddChainedFixups(imageNode, summaryText);
+}
+
+void MachONodeTreeBuilder::AddHeader(StaticNode& imageNode, CString& summaryText) const
+{
+   const MachOImage& image = *m_image;
+
+   if (image.ImageSize() < (image.Is64Bit() ? sizeof(MachOHeader64) : sizeof(MachOHeader32)))
+      return;
+
+   imageNode.ChildNodes().push_back(
+      std::make_shared<StructListViewNode>(
+         image.Is64Bit() ? _T("Mach-O header (64-bit)") : _T("Mach-O header (32-bit)"),
+         NodeTreeIconID::nodeTreeIconBinary,
+         GetMachOHeaderDefinition(image.Is64Bit(), image.IsLittleEndian()),
+         image.ImageData(),
+         image.GetFile().Data()));
+
+   if (!image.IsValid())
+      return;
+
+   summaryText.AppendFormat(_T("Class: %s, %s\n"),
+      image.Is64Bit() ? _T("64-bit") : _T("32-bit"),
+      image.IsLittleEndian() ? _T("little-endian") : _T("big-endian"));
+
+   summaryText.AppendFormat(_T("CPU type: %s\n"),
+      GetValueFromMapOrDefault<DWORD>(g_mapMachOCpuTypeToDisplayText, image.CpuType(), _T("unknown")));
+
+   summaryText.AppendFormat(_T("File type: %s\n"),
+      GetValueFromMapOrDefault<DWORD>(g_mapMachOFileTypeToDisplayText, image.FileType(), _T("unknown")));
+
+   summaryText.AppendFormat(_T("Flags: %s\n"),
+      DisplayFormatHelper::FormatBitFlagsFromMap(g_mapMachOHeaderFlagsToDisplayText, image.Flags()).GetString());
+
+   if (image.Uuid().has_value())
+      summaryText.AppendFormat(_T("UUID: %s\n"), image.Uuid().value().GetString());
+}
+
+void MachONodeTreeBuilder::AddLoadCommands(StaticNode& imageNode, CString& summaryText) const
+{
+   const MachOImage& image = *m_image;
+
+   const std::vector<MachOLoadCommandInfo>& loadCommands = image.LoadCommands();
+
+   summaryText.AppendFormat(_T("Load commands: %zu\n"), loadCommands.size());
+
+   if (loadCommands.empty())
+      return;
+
+   std::vector<std::vector<CString>> loadCommandData;
+   std::vector<std::shared_ptr<INode>> loadCommandChildNodes;
+
+   const StructDefinition& segmentCommandDefinition =
+      GetMachOSegmentCommandDefinition(image.Is64Bit(), image.IsLittleEndian());
+
+   for (const MachOLoadCommandInfo& loadCommand : loadCommands)
+   {
+      CString indexText;
+      indexText.Format(_T("%zu"), loadCommand.index);
+
+      CString commandText = GetValueFromMapOrDefault<DWORD>(
+         g_mapMachOLoadCommandToDisplayText, loadCommand.command, _T("unknown"));
+
+      CString sizeText;
+      sizeText.Format(_T("%u"), loadCommand.commandSize);
+
+      CString offsetText;
+      offsetText.Format(_T("0x%08zx"), static_cast<size_t>(loadCommand.data - image.ImageData()));
+
+      loadCommandData.push_back(
+         std::vector<CString> {
+            indexText,
+            commandText,
+            sizeText,
+            offsetText,
+         });
+
+      const StructDefinition* definition = &GetMachOLoadCommandDefinition(image.IsLittleEndian());
+
+      if (loadCommand.command == c_machOLoadCommandSegment ||
+         loadCommand.command == c_machOLoadCommandSegment64)
+         definition = &segmentCommandDefinition;
+      else if (loadCommand.command == c_machOLoadCommandSymtab &&
+         loadCommand.commandSize >= sizeof(MachOSymtabCommand))
+         definition = &GetMachOSymtabCommandDefinition(image.IsLittleEndian());
+      else if (loadCommand.command == c_machOLoadCommandDysymtab &&
+         loadCommand.commandSize >= sizeof(MachODysymtabCommand))
+         definition = &GetMachODysymtabCommandDefinition(image.IsLittleEndian());
+
+      loadCommandChildNodes.push_back(
+         std::make_shared<StructListViewNode>(
+            _T("Load command ") + indexText + _T(" ") + commandText,
+            NodeTreeIconID::nodeTreeIconBinary,
+            *definition,
+            loadCommand.data,
+            image.GetFile().Data()));
+   }
+
+   static std::vector<CString> loadCommandColumnNames
+   {
+      _T("Index"),
+      _T("Command"),
+      _T("Size"),
+      _T("Offset"),
+   };
+
+   auto loadCommandTableNode = std::make_shared<FilterSortListViewNode>(
+      _T("Load Commands"),
+      NodeTreeIconID::nodeTreeIconTable,
+      loadCommandColumnNames,
+      loadCommandData,
+      false);
+
+   loadCommandTableNode->ChildNodes().swap(loadCommandChildNodes);
+
+   imageNode.ChildNodes().push_back(loadCommandTableNode);
+}
+
+void MachONodeTreeBuilder::AddSegments(StaticNode& imageNode, CString& summaryText) const
+{
+   const MachOImage& image = *m_image;
+
+   const std::vector<MachOSegment>& segments = image.Segments();
+
+   summaryText.AppendFormat(_T("Segments: %zu\n"), segments.size());
+
+   if (segments.empty())
+      return;
+
+   std::vector<std::vector<CString>> segmentData;
+   std::vector<std::shared_ptr<INode>> segmentChildNodes;
+
+   const StructDefinition& segmentCommandDefinition =
+      GetMachOSegmentCommandDefinition(image.Is64Bit(), image.IsLittleEndian());
+
+   for (const MachOSegment& segment : segments)
+   {
+      CString indexText;
+      indexText.Format(_T("%zu"), segment.index);
+
+      CString vmAddressText;
+      vmAddressText.Format(_T("0x%08llx"), segment.vmAddress);
+
+      CString vmSizeText;
+      vmSizeText.Format(_T("0x%08llx"), segment.vmSize);
+
+      CString fileOffsetText;
+      fileOffsetText.Format(_T("0x%08llx"), segment.fileOffset);
+
+      CString fileSizeText;
+      fileSizeText.Format(_T("0x%08llx"), segment.fileSize);
+
+      CString sectionCountText;
+      sectionCountText.Format(_T("%zu"), segment.sectionCount);
+
+      CString flagsText;
+      flagsText.Format(_T("0x%x"), segment.flags);
+
+      segmentData.push_back(
+         std::vector<CString> {
+            indexText,
+            segment.name,
+            vmAddressText,
+            vmSizeText,
+            fileOffsetText,
+            fileSizeText,
+            FormatProtection(segment.maxProtection),
+            FormatProtection(segment.initialProtection),
+            sectionCountText,
+            flagsText,
+         });
+
+      segmentChildNodes.push_back(
+         std::make_shared<StructListViewNode>(
+            _T("Segment ") + indexText + _T(" ") + segment.name,
+            NodeTreeIconID::nodeTreeIconBinary,
+            segmentCommandDefinition,
+            segment.command,
+            image.GetFile().Data()));
+   }
+
+   static std::vector<CString> segmentColumnNames
+   {
+      _T("Index"),
+      _T("Name"),
+      _T("VM address"),
+      _T("VM size"),
+      _T("File offset"),
+      _T("File size"),
+      _T("Max. protection"),
+      _T("Initial protection"),
+      _T("Sections"),
+      _T("Flags"),
+   };
+
+   auto segmentTableNode = std::make_shared<FilterSortListViewNode>(
+      _T("Segments"),
+      NodeTreeIconID::nodeTreeIconTable,
+      segmentColumnNames,
+      segmentData,
+      false);
+
+   segmentTableNode->ChildNodes().swap(segmentChildNodes);
+
+   imageNode.ChildNodes().push_back(segmentTableNode);
+}
+
+void MachONodeTreeBuilder::AddSections(StaticNode& imageNode, CString& summaryText) const
+{
+   std::shared_ptr<MachOImage> image = m_image;
+
+   const std::vector<MachOSection>& sections = image->Sections();
+
+   summaryText.AppendFormat(_T("Sections: %zu\n"), sections.size());
+
+   if (sections.empty())
+      return;
+
+   static std::vector<CString> sectionColumnNames
+   {
+      _T("Index"),
+      _T("Segment"),
+      _T("Section"),
+      _T("Address"),
+      _T("Size"),
+      _T("Offset"),
+      _T("Align"),
+      _T("Type"),
+   };
+
+   auto sectionTableNode = std::make_shared<FilterSortListViewNode>(
+      _T("Sections"),
+      NodeTreeIconID::nodeTreeIconTable,
+      sectionColumnNames,
+      sections.size(),
+      [image](size_t index)
+      {
+         const MachOSection& section = image->Sections()[index];
+
+         // symbols use 1-based section ordinals
+         CString indexText;
+         indexText.Format(_T("%zu"), index + 1);
+
+         CString addressText;
+         addressText.Format(_T("0x%08llx"), section.address);
+
+         CString sizeText;
+         sizeText.Format(_T("0x%08llx"), section.size);
+
+         CString offsetText;
+         offsetText.Format(_T("0x%08x"), section.offset);
+
+         CString alignText;
+         alignText.Format(_T("2^%u"), section.align);
+
+         return std::vector<CString> {
+            indexText,
+            section.segmentName,
+            section.sectionName,
+            addressText,
+            sizeText,
+            offsetText,
+            alignText,
+            GetValueFromMapOrDefault<DWORD>(
+               g_mapMachOSectionTypeToDisplayText, section.flags & 0xff, _T("unknown")),
+         };
+      },
+      true);
+
+   const StructDefinition& sectionDefinition =
+      GetMachOSectionDefinition(image->Is64Bit(), image->IsLittleEndian());
+
+   for (const MachOSection& section : sections)
+   {
+      CString name;
+      name.Format(_T("Section [%zu] %s,%s"),
+         section.index + 1,
+         section.segmentName.GetString(),
+         section.sectionName.GetString());
+
+      sectionTableNode->ChildNodes().push_back(
+         std::make_shared<StructListViewNode>(
+            name,
+            NodeTreeIconID::nodeTreeIconBinary,
+            sectionDefinition,
+            section.header,
+            image->GetFile().Data()));
+   }
+
+   imageNode.ChildNodes().push_back(sectionTableNode);
+}
+
+void MachONodeTreeBuilder::AddDylibs(CString& summaryText) const
+{
+   for (const MachODylib& dylib : m_image->Dylibs())
+   {
+      summaryText.AppendFormat(_T("%s: %s (version %s, compatibility version %s)\n"),
+         dylib.command == c_machOLoadCommandIdDylib ? _T("Library ID") : _T("Needed library"),
+         dylib.name.GetString(),
+         FormatDylibVersion(dylib.currentVersion).GetString(),
+         FormatDylibVersion(dylib.compatibilityVersion).GetString());
+   }
+}
+
+void MachONodeTreeBuilder::AddSymbolTable(StaticNode& imageNode, CString& summaryText) const
+{
+   std::shared_ptr<MachOImage> image = m_image;
+   std::shared_ptr<MachOExportTrie> exportTrie = m_exportTrie;
+
+   if (image->SymtabCommand() == nullptr)
+      return;
+
+   auto symbolTable = std::make_shared<MachOSymbolTable>(*image);
+
+   if (!symbolTable->IsValid())
+   {
+      summaryText.AppendFormat(_T("Error: Symbol table: %s\n"),
+         symbolTable->GetErrorText().GetString());
+      return;
+   }
+
+   summaryText.AppendFormat(_T("Symbol table with %zu symbols.\n"), symbolTable->Count());
+
+   static std::vector<CString> symbolColumnNames
+   {
+      _T("Index"),
+      _T("Value"),
+      _T("Type"),
+      _T("External"),
+      _T("Section"),
+      _T("Description"),
+      _T("Export"),
+      _T("Name"),
+   };
+
+   // the image and the export trie are captured as well, since the symbol
+   // table and the export trie refer to the image
+   auto symbolTableNode = std::make_shared<FilterSortListViewNode>(
+      _T("Symbol Table"),
+      NodeTreeIconID::nodeTreeIconTable,
+      symbolColumnNames,
+      symbolTable->Count(),
+      [image, symbolTable, exportTrie](size_t index)
+      {
+         MachOSymbol symbol = symbolTable->GetSymbol(index);
+
+         CString indexText;
+         indexText.Format(_T("%zu"), index);
+
+         CString valueText;
+         valueText.Format(_T("0x%08llx"), symbol.value);
+
+         CString typeText;
+         if ((symbol.type & c_machOSymbolTypeStabMask) != 0)
+            typeText.Format(_T("debug (stab 0x%02x)"), symbol.type);
+         else
+            typeText = GetValueFromMapOrDefault<DWORD>(
+               g_mapMachOSymbolTypeToDisplayText, symbol.type & c_machOSymbolTypeMask, _T("unknown"));
+
+         bool isExternal = (symbol.type & c_machOSymbolTypeExternal) != 0;
+
+         CString sectionText;
+         if (symbol.sectionIndex != 0 &&
+            symbol.sectionIndex <= image->Sections().size())
+         {
+            const MachOSection& section = image->Sections()[symbol.sectionIndex - 1];
+            sectionText = section.segmentName + _T(",") + section.sectionName;
+         }
+
+         CString descriptionText;
+         descriptionText.Format(_T("0x%04x"), symbol.description);
+
+         // defined external symbols are looked up in the export trie, walking
+         // only the trie nodes along the symbol name
+         CString exportText;
+         if (exportTrie != nullptr &&
+            isExternal &&
+            (symbol.type & c_machOSymbolTypeStabMask) == 0 &&
+            (symbol.type & c_machOSymbolTypeMask) != c_machOSymbolTypeUndefined)
+         {
+            std::optional<MachOExport> exportInfo = exportTrie->Lookup(CStringA(CT2A(symbol.name, CP_UTF8)));
+            if (exportInfo.has_value())
+               exportText = MachOExportTrie::GetFlagsDisplayText(exportInfo.value().flags);
+         }
+
+         return std::vector<CString> {
+            indexText,
+            valueText,
+            typeText,
+            isExternal ? _T("yes") : _T("no"),
+            sectionText,
+            descriptionText,
+            exportText,
+            symbol.name,
+         };
+      },
+      true);
+
+   imageNode.ChildNodes().push_back(symbolTableNode);
+
+   if (image->DysymtabCommand() != nullptr)
+   {
+      const MachODysymtabCommand& dysymtab = *image->DysymtabCommand();
+
+      summaryText.AppendFormat(_T("Dynamic symbol table with %u local, %u external and %u undefined symbols.\n"),
+         image->Get(dysymtab.numberOfLocalSymbols),
+         image->Get(dysymtab.numberOfExternalSymbols),
+         image->Get(dysymtab.numberOfUndefinedSymbols));
+
+      imageNode.ChildNodes().push_back(
+         std::make_shared<StructListViewNode>(
+            _T("Dynamic Symbol Table"),
+            NodeTreeIconID::nodeTreeIconBinary,
+            GetMachODysymtabCommandDefinition(image->IsLittleEndian()),
+            image->DysymtabCommand(),
+            image->GetFile().Data()));
+   }
+}
+
+void MachONodeTreeBuilder::AddExports(StaticNode& imageNode, CString& summaryText) const
+{
+   std::shared_ptr<MachOImage> image = m_image;
+   std::shared_ptr<MachOExportTrie> exportTrie = m_exportTrie;
+
+   if (exportTrie == nullptr)
+      return;
+
+   if (!exportTrie->IsValid())
+   {
+      summaryText.AppendFormat(_T("Error: Export trie: %s\n"),
+         exportTrie->GetErrorText().GetString());
+      return;
+   }
+
+   summaryText.AppendFormat(_T("Export trie with %zu bytes.\n"), exportTrie->Size());
+
+   static std::vector<CString> exportColumnNames
+   {
+      _T("Name"),
+      _T("Flags"),
+      _T("Address"),
+      _T("Details"),
+   };
+
+   // the number of exports is only known after walking the whole trie, so
+   // this is only done when the node is shown
+   imageNode.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Exports"),
+         NodeTreeIconID::nodeTreeIconTable,
+         exportColumnNames,
+         [image, exportTrie]()
+         {
+            std::vector<std::vector<CString>> exportData;
+
+            bool isValid = exportTrie->ForEachExport(
+               [&](const MachOExport& symbol)
+               {
+                  CString addressText;
+                  CString detailsText;
+
+                  if ((symbol.flags & c_machOExportFlagReexport) != 0)
+                  {
+                     detailsText = _T("from ") +
+                        FormatLibraryOrdinal(*image, static_cast<int>(symbol.libraryOrdinal));
+
+                     if (!symbol.importName.IsEmpty())
+                        detailsText += _T(" as ") + CString(symbol.importName);
+                  }
+                  else
+                  {
+                     addressText.Format(_T("0x%08llx"), symbol.address);
+
+                     if ((symbol.flags & c_machOExportFlagStubAndResolver) != 0)
+                        detailsText.Format(_T("resolver at 0x%08llx"), symbol.resolverAddress);
+                  }
+
+                  exportData.push_back(
+                     std::vector<CString> {
+                        CString(symbol.name),
+                        MachOExportTrie::GetFlagsDisplayText(symbol.flags),
+                        addressText,
+                        detailsText,
+                     });
+
+                  return true;
+               });
+
+            if (!isValid)
+               exportData.push_back(
+                  std::vector<CString> { _T("Error: export trie is corrupt"), _T(""), _T(""), _T("") });
+
+            return exportData;
+         },
+         true));
+}
+
+void MachONodeTreeBuilder::AddChainedFixups(StaticNode& imageNode, CString& summaryText) const
+{
+   std::shared_ptr<MachOImage> image = m_image;
+
+   if (!image->ChainedFixups().IsAvailable())
+      return;
+
+   auto chainedFixups = std::make_shared<MachOChainedFixups>(*image);
+
+   if (!chainedFixups->IsValid())
+   {
+      summaryText.AppendFormat(_T("Error: Chained fixups: %s\n"),
+         chainedFixups->GetErrorText().GetString());
+      return;
+   }
+
+   summaryText.AppendFormat(_T("Chained fixups with %zu imports, in %zu segments.\n"),
+      chainedFixups->ImportsCount(),
+      chainedFixups->Starts().size());
+
+   auto chainedFixupsNode = std::make_shared<CodeTextViewNode>(
+      _T("Chained Fixups"),
+      NodeTreeIconID::nodeTreeIconLibrary);
+
+   CString chainedFixupsText;
+   chainedFixupsText.AppendFormat(_T("Chained fixups version %u\n"),
+      image->Get(chainedFixups->Header()->fixupsVersion));
+
+   chainedFixupsText.AppendFormat(_T("Imports: %zu, format %s\n"),
+      chainedFixups->ImportsCount(),
+      GetValueFromMapOrDefault<DWORD>(
+         g_mapMachOChainedImportsFormatToDisplayText,
+         image->Get(chainedFixups->Header()->importsFormat),
+         _T("unknown")));
+
+   chainedFixupsText.AppendFormat(_T("Segments with fixups: %zu\n"),
+      chainedFixups->Starts().size());
+
+   chainedFixupsNode->SetText(chainedFixupsText);
+
+   chainedFixupsNode->ChildNodes().push_back(
+      std::make_shared<StructListViewNode>(
+         _T("Chained fixups header"),
+         NodeTreeIconID::nodeTreeIconBinary,
+         GetMachOChainedFixupsHeaderDefinition(image->IsLittleEndian()),
+         chainedFixups->Header(),
+         image->GetFile().Data()));
+
+   static std::vector<CString> importColumnNames
+   {
+      _T("Index"),
+      _T("Library"),
+      _T("Weak"),
+      _T("Addend"),
+      _T("Name"),
+   };
+
+   chainedFixupsNode->ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Imports"),
+         NodeTreeIconID::nodeTreeIconTable,
+         importColumnNames,
+         chainedFixups->ImportsCount(),
+         [image, chainedFixups](size_t index)
+         {
+            MachOChainedImport import = chainedFixups->GetImport(index);
+
+            CString indexText;
+            indexText.Format(_T("%zu"), index);
+
+            CString addendText;
+            addendText.Format(_T("%lld"), import.addend);
+
+            return std::vector<CString> {
+               indexText,
+               FormatLibraryOrdinal(*image, import.libraryOrdinal),
+               import.isWeakImport ? _T("yes") : _T("no"),
+               addendText,
+               CString(import.name),
+            };
+         },
+         true));
+
+   std::vector<std::vector<CString>> startsData;
+   std::vector<std::shared_ptr<INode>> startsChildNodes;
+
+   for (const MachOChainedStarts& starts : chainedFixups->Starts())
+   {
+      CString segmentName = starts.segmentIndex < image->Segments().size()
+         ? image->Segments()[starts.segmentIndex].name
+         : CString{ _T("???") };
+
+      CString segmentText;
+      segmentText.Format(_T("%zu %s"), starts.segmentIndex, segmentName.GetString());
+
+      CString pageSizeText;
+      pageSizeText.Format(_T("0x%x"), starts.pageSize);
+
+      CString segmentOffsetText;
+      segmentOffsetText.Format(_T("0x%08llx"), starts.segmentOffset);
+
+      size_t pagesWithFixups = std::count_if(
+         starts.pageStarts.begin(), starts.pageStarts.end(),
+         [](WORD pageStart) { return pageStart != c_machOChainedPointerStartNone; });
+
+      CString pagesText;
+      pagesText.Format(_T("%zu of %zu"), pagesWithFixups, starts.pageStarts.size());
+
+      startsData.push_back(
+         std::vector<CString> {
+            segmentText,
+            GetValueFromMapOrDefault<DWORD>(
+               g_mapMachOChainedPointerFormatToDisplayText, starts.pointerFormat, _T("unknown")),
+            pageSizeText,
+            segmentOffsetText,
+            pagesText,
+         });
+
+      static std::vector<CString> fixupColumnNames
+      {
+         _T("VM offset"),
+         _T("File offset"),
+         _T("Raw value"),
+         _T("Kind"),
+         _T("Target"),
+         _T("Addend"),
+      };
+
+      // walking the chains touches all pages of the segment, so this is
+      // only done when the node is shown
+      startsChildNodes.push_back(
+         std::make_shared<FilterSortListViewNode>(
+            _T("Fixups in segment ") + segmentText,
+            NodeTreeIconID::nodeTreeIconTable,
+            fixupColumnNames,
+            [image, chainedFixups, starts]()
+            {
+               std::vector<std::vector<CString>> fixupData;
+
+               bool isValid = chainedFixups->ForEachFixup(starts,
+                  [&](const MachOChainedFixup& fixup)
+                  {
+                     CString vmOffsetText;
+                     vmOffsetText.Format(_T("0x%08llx"), fixup.vmOffset);
+
+                     CString fileOffsetText;
+                     fileOffsetText.Format(_T("0x%08llx"), fixup.fileOffset);
+
+                     CString rawValueText;
+                     rawValueText.Format(_T("0x%016llx"), fixup.rawValue);
+
+                     CString targetText;
+                     CString addendText;
+
+                     if (fixup.kind == MachOChainedFixupKind::bind ||
+                        fixup.kind == MachOChainedFixupKind::authBind)
+                     {
+                        targetText = CString(chainedFixups->GetImport(fixup.importIndex).name);
+                        addendText.Format(_T("%lld"), fixup.addend);
+                     }
+                     else
+                        targetText.Format(_T("0x%08llx"), fixup.target);
+
+                     fixupData.push_back(
+                        std::vector<CString> {
+                           vmOffsetText,
+                           fileOffsetText,
+                           rawValueText,
+                           MachOChainedFixups::GetKindDisplayText(fixup.kind),
+                           targetText,
+                           addendText,
+                        });
+
+                     return fixupData.size() < c_maxDisplayedFixupCount;
+                  });
+
+               if (!isValid)
+                  fixupData.push_back(
+                     std::vector<CString> { _T("Error: fixup chain is corrupt or has an unsupported format"),
+                        _T(""), _T(""), _T(""), _T(""), _T("") });
+
+               return fixupData;
+            },
+            true));
+   }
+
+   static std::vector<CString> startsColumnNames
+   {
+      _T("Segment"),
+      _T("Pointer format"),
+      _T("Page size"),
+      _T("Segment offset"),
+      _T("Pages with fixups"),
+   };
+
+   auto startsTableNode = std::make_shared<FilterSortListViewNode>(
+      _T("Chain Starts"),
+      NodeTreeIconID::nodeTreeIconTable,
+      startsColumnNames,
+      startsData,
+      false);
+
+   startsTableNode->ChildNodes().swap(startsChildNodes);
+
+   chainedFixupsNode->ChildNodes().push_back(startsTableNode);
+
+   imageNode.ChildNodes().push_back(chainedFixupsNode);
+}
+
+CString MachONodeTreeBuilder::FormatLibraryOrdinal(const MachOImage& image, int libraryOrdinal)
+{
+   switch (libraryOrdinal)
+   {
+   case 0: return _T("self");
+   case -1: return _T("main executable");
+   case -2: return _T("flat lookup");
+   case -3: return _T("weak lookup");
+   default: break;
+   }
+
+   // ordinals count the dylib load commands, without the LC_ID_DYLIB command
+   int ordinal = 0;
+   for (const MachODylib& dylib : image.Dylibs())
+   {
+      if (dylib.command == c_machOLoadCommandIdDylib)
+         continue;
+
+      if (++ordinal == libraryOrdinal)
+         return dylib.name;
+   }
+
+   CString text;
+   text.Format(_T("library %d"), libraryOrdinal);
+   return text;
+}
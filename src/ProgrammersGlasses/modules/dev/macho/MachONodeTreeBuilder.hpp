@@ -0,0 +1,64 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachONodeTreeBuilder.hpp
+/// \brief Node tree builder for a single Mach-O image
+//
+#pragma once
+
+#include "INode.hpp"
+#include <memory>
+
+class StaticNode;
+class MachOImage;
+class MachOExportTrie;
+
+/// \brief Node tree builder for a single Mach-O image
+/// \details Builds the nodes for a thin Mach-O file or for a single
+/// architecture of a universal (fat) binary.
+class MachONodeTreeBuilder
+{
+public:
+   /// ctor; the image is shared with nodes that format their rows lazily
+   explicit MachONodeTreeBuilder(std::shared_ptr<MachOImage> image);
+
+   /// adds all nodes for the image to the given node, and appends the
+   /// summary to the summary text
+   void AddImageNodes(StaticNode& imageNode, CString& summaryText);
+
+private:
+   /// adds Mach-O header node
+   void AddHeader(StaticNode& imageNode, CString& summaryText) const;
+
+   /// adds load commands node
+   void AddLoadCommands(StaticNode& imageNode, CString& summaryText) const;
+
+   /// adds segments node
+   void AddSegments(StaticNode& imageNode, CString& summaryText) const;
+
+   /// adds sections node
+   void AddSections(StaticNode& imageNode, CString& summaryText) const;
+
+   /// adds the referenced dynamic libraries to the summary
+   void AddDylibs(CString& summaryText) const;
+
+   /// adds symbol table and dynamic symbol table nodes
+   void AddSymbolTable(StaticNode& imageNode, CString& summaryText) const;
+
+   /// adds exports node, from the export trie
+   void AddExports(StaticNode& imageNode, CString& summaryText) const;
+
+   /// adds chained fixups nodes
+   void AddChainedFixups(StaticNode& imageNode, CString& summaryText) const;
+
+   /// returns a display text for a library ordinal of a bind or re-export
+   static CString FormatLibraryOrdinal(const MachOImage& image, int libraryOrdinal);
+
+private:
+   /// Mach-O image
+   std::shared_ptr<MachOImage> m_image;
+
+   /// export trie; used by the symbol table to look up export infos
+   std::shared_ptr<MachOExportTrie> m_exportTrie;
+};
@@ -0,0 +1,269 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachOReader.cpp
+/// \brief reader for Mach-O and universal (fat) binary files
+//
+#include "stdafx.h"
+#include "MachOReader.hpp"
+#include "MachOImage.hpp"
+#include "MachONodeTreeBuilder.hpp"
+#include "modules/CodeTextViewNode.hpp"
+#include "modules/FilterSortListViewNode.hpp"
+#include "modules/StructListViewNode.hpp"
+
+/// signature of static library archives, which may be stored in universal binaries
+static const char c_archiveSignature[] = "!<arch>\n";
+
+bool MachOReader::IsMachOFile(const File& file)
+{
+   DWORD numberOfArchitectures = 0;
+
+   return MachOImage::IsMachOImage(file.Data<BYTE>(), file.Size()) ||
+      IsFatBinary(file, numberOfArchitectures);
+}
+
+bool MachOReader::IsFatBinary(const File& file, DWORD& numberOfArchitectures)
+{
+   if (file.Size() < sizeof(MachOFatHeader))
+      return false;
+
+   const MachOFatHeader& header = *file.Data<MachOFatHeader>();
+
+   DWORD magic = SwapEndianness(header.magic);
+   if (magic != c_machOFatMagic32 &&
+      magic != c_machOFatMagic64)
+      return false;
+
+   numberOfArchitectures = SwapEndianness(header.numberOfArchitectures);
+
+   // Java class files start with the same magic number, followed by the
+   // class file version, which is larger than any architecture count
+   return numberOfArchitectures > 0 &&
+      numberOfArchitectures <= c_machOMaxFatArchitectures;
+}
+
+std::vector<std::pair<size_t, size_t>> MachOReader::FindImages(const File& file)
+{
+   std::vector<std::pair<size_t, size_t>> imageRangesList;
+
+   DWORD numberOfArchitectures = 0;
+   if (!IsFatBinary(file, numberOfArchitectures))
+   {
+      if (MachOImage::IsMachOImage(file.Data<BYTE>(), file.Size()))
+         imageRangesList.emplace_back(0, file.Size());
+
+      return imageRangesList;
+   }
+
+   bool is64Bit = SwapEndianness(file.Data<MachOFatHeader>()->magic) == c_machOFatMagic64;
+   size_t archSize = is64Bit ? sizeof(MachOFatArch64) : sizeof(MachOFatArch32);
+
+   if (numberOfArchitectures * archSize > file.Size() - sizeof(MachOFatHeader))
+      return imageRangesList;
+
+   for (DWORD archIndex = 0; archIndex < numberOfArchitectures; archIndex++)
+   {
+      size_t archOffset = sizeof(MachOFatHeader) + archIndex * archSize;
+
+      ULONGLONG offset = is64Bit
+         ? SwapEndianness(file.Data<MachOFatArch64>(archOffset)->offset)
+         : SwapEndianness(file.Data<MachOFatArch32>(archOffset)->offset);
+
+      ULONGLONG size = is64Bit
+         ? SwapEndianness(file.Data<MachOFatArch64>(archOffset)->size)
+         : SwapEndianness(file.Data<MachOFatArch32>(archOffset)->size);
+
+      if (offset > file.Size() ||
+         size > file.Size() - offset ||
+         !MachOImage::IsMachOImage(file.Data<BYTE>(static_cast<size_t>(offset)), static_cast<size_t>(size)))
+         continue;
+
+      imageRangesList.emplace_back(static_cast<size_t>(offset), static_cast<size_t>(size));
+   }
+
+   return imageRangesList;
+}
+
+MachOReader::MachOReader(const File& file)
+   :m_file(file)
+{
+}
+
+void MachOReader::Load()
+{
+   auto rootNode = std::make_shared<CodeTextViewNode>(
+      _T("Summary"),
+      NodeTreeIconID::nodeTreeIconDocument);
+
+   m_rootNode = rootNode;
+
+   CString summaryText;
+   summaryText.Append(_T("Mach-O file: ") + m_file.Filename() + _T("\n\n"));
+   summaryText.Append(_T("Summary:\n"));
+
+   DWORD numberOfArchitectures = 0;
+   if (IsFatBinary(m_file, numberOfArchitectures))
+      AddFatBinary(*rootNode, summaryText);
+   else
+      AddImage(*rootNode, 0, m_file.Size(), summaryText);
+
+   rootNode->SetText(summaryText);
+}
+
+void MachOReader::Cleanup()
+{
+   // nothing expensive to cleanup here
+}
+
+void MachOReader::AddFatBinary(StaticNode& rootNode, CString& summaryText)
+{
+   DWORD numberOfArchitectures = 0;
+   IsFatBinary(m_file, numberOfArchitectures);
+
+   const MachOFatHeader& header = *m_file.Data<MachOFatHeader>();
+   bool is64Bit = SwapEndianness(header.magic) == c_machOFatMagic64;
+
+   summaryText.AppendFormat(_T("Universal binary with %u architectures%s\n"),
+      numberOfArchitectures,
+      is64Bit ? _T(", with 64-bit offsets") : _T(""));
+
+   size_t archSize = is64Bit ? sizeof(MachOFatArch64) : sizeof(MachOFatArch32);
+   if (numberOfArchitectures * archSize > m_file.Size() - sizeof(MachOFatHeader))
+   {
+      summaryText.Append(_T("Error: Architecture table is outside of the file\n"));
+      return;
+   }
+
+   const StructDefinition& fatArchDefinition = GetMachOFatArchDefinition(is64Bit);
+
+   std::vector<std::vector<CString>> archData;
+   std::vector<std::shared_ptr<INode>> archChildNodes;
+   std::vector<std::shared_ptr<INode>> imageNodes;
+
+   for (DWORD archIndex = 0; archIndex < numberOfArchitectures; archIndex++)
+   {
+      size_t archOffset = sizeof(MachOFatHeader) + archIndex * archSize;
+
+      DWORD cpuType = 0;
+      ULONGLONG offset = 0;
+      ULONGLONG size = 0;
+      DWORD align = 0;
+
+      if (is64Bit)
+      {
+         const MachOFatArch64& arch = *m_file.Data<MachOFatArch64>(archOffset);
+         cpuType = SwapEndianness(arch.cpuType);
+         offset = SwapEndianness(arch.offset);
+         size = SwapEndianness(arch.size);
+         align = SwapEndianness(arch.align);
+      }
+      else
+      {
+         const MachOFatArch32& arch = *m_file.Data<MachOFatArch32>(archOffset);
+         cpuType = SwapEndianness(arch.cpuType);
+         offset = SwapEndianness(arch.offset);
+         size = SwapEndianness(arch.size);
+         align = SwapEndianness(arch.align);
+      }
+
+      CString indexText;
+      indexText.Format(_T("%u"), archIndex);
+
+      CString cpuTypeText = GetValueFromMapOrDefault<DWORD>(
+         g_mapMachOCpuTypeToDisplayText, cpuType, _T("unknown"));
+
+      CString offsetText;
+      offsetText.Format(_T("0x%08llx"), offset);
+
+      CString sizeText;
+      sizeText.Format(_T("0x%08llx"), size);
+
+      CString alignText;
+      alignText.Format(_T("2^%u"), align);
+
+      archData.push_back(
+         std::vector<CString> {
+            indexText,
+            cpuTypeText,
+            offsetText,
+            sizeText,
+            alignText,
+         });
+
+      archChildNodes.push_back(
+         std::make_shared<StructListViewNode>(
+            _T("Architecture ") + indexText + _T(" ") + cpuTypeText,
+            NodeTreeIconID::nodeTreeIconBinary,
+            fatArchDefinition,
+            m_file.Data<BYTE>(archOffset),
+            m_file.Data()));
+
+      summaryText.AppendFormat(_T("Architecture [%u] %s at offset 0x%llx\n"),
+         archIndex,
+         cpuTypeText.GetString(),
+         offset);
+
+      if (offset > m_file.Size() ||
+         size > m_file.Size() - offset)
+      {
+         summaryText.AppendFormat(_T("Error: Architecture [%u] is outside of the file\n"), archIndex);
+         continue;
+      }
+
+      auto imageNode = std::make_shared<CodeTextViewNode>(
+         _T("Architecture [") + indexText + _T("] ") + cpuTypeText,
+         NodeTreeIconID::nodeTreeIconLibrary);
+
+      CString imageSummaryText;
+      imageSummaryText.Format(_T("Architecture [%u] %s\n"), archIndex, cpuTypeText.GetString());
+      imageSummaryText.AppendFormat(_T("Offset: 0x%llx, size: 0x%llx\n\n"), offset, size);
+
+      // universal binaries may also contain a static library per architecture;
+      // the archive members aren't decoded
+      if (size >= sizeof(c_archiveSignature) - 1 &&
+         memcmp(m_file.Data<BYTE>(static_cast<size_t>(offset)), c_archiveSignature, sizeof(c_archiveSignature) - 1) == 0)
+      {
+         imageSummaryText.Append(_T("Static library archive; archive members are not decoded.\n"));
+      }
+      else
+      {
+         AddImage(*imageNode, static_cast<size_t>(offset), static_cast<size_t>(size), imageSummaryText);
+      }
+
+      imageNode->SetText(imageSummaryText);
+
+      imageNodes.push_back(imageNode);
+   }
+
+   static std::vector<CString> archColumnNames
+   {
+      _T("Index"),
+      _T("CPU type"),
+      _T("Offset"),
+      _T("Size"),
+      _T("Align"),
+   };
+
+   auto archTableNode = std::make_shared<FilterSortListViewNode>(
+      _T("Architectures"),
+      NodeTreeIconID::nodeTreeIconTable,
+      archColumnNames,
+      archData,
+      false);
+
+   archTableNode->ChildNodes().swap(archChildNodes);
+
+   rootNode.ChildNodes().push_back(archTableNode);
+   rootNode.ChildNodes().insert(rootNode.ChildNodes().end(), imageNodes.begin(), imageNodes.end());
+}
+
+void MachOReader::AddImage(StaticNode& imageNode, size_t imageOffset, size_t imageSize, CString& summaryText)
+{
+   auto image = std::make_shared<MachOImage>(m_file, imageOffset, imageSize);
+   m_images.push_back(image);
+
+   MachONodeTreeBuilder nodeTreeBuilder{ image };
+   nodeTreeBuilder.AddImageNodes(imageNode, summaryText);
+}
@@ -0,0 +1,64 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachOReader.hpp
+/// \brief reader for Mach-O and universal (fat) binary files
+//
+#pragma once
+
+#include "modules/IReader.hpp"
+
+class StaticNode;
+class MachOImage;
+
+/// Mach-O file reader
+class MachOReader : public IReader
+{
+public:
+   /// determines if the given file is a thin Mach-O file or a universal binary
+   static bool IsMachOFile(const File& file);
+
+   /// returns the file offsets and sizes of all Mach-O images in the file; a
+   /// thin Mach-O file contains a single image, a universal binary one per
+   /// architecture
+   static std::vector<std::pair<size_t, size_t>> FindImages(const File& file);
+
+   /// ctor
+   explicit MachOReader(const File& file);
+
+   // Inherited via IReader
+   const CString& Filename() const override
+   {
+      return m_file.Filename();
+   }
+
+   std::shared_ptr<INode> RootNode() const override
+   {
+      return m_rootNode;
+   }
+
+   void Load() override;
+   void Cleanup() override;
+
+private:
+   /// returns if the file is a universal binary; returns the number of
+   /// architectures
+   static bool IsFatBinary(const File& file, DWORD& numberOfArchitectures);
+
+   /// adds architecture table and nodes for all architectures of a universal binary
+   void AddFatBinary(StaticNode& rootNode, CString& summaryText);
+
+   /// adds nodes for the image at given file offset and size
+   void AddImage(StaticNode& imageNode, size_t imageOffset, size_t imageSize, CString& summaryText);
+
+private:
+   /// file to read from
+   File m_file;
+
+   /// Mach-O images; shared with nodes that format their rows lazily
+   std::vector<std::shared_ptr<MachOImage>> m_images;
+
+   /// root node
+   std::shared_ptr<INode> m_rootNode;
+};
@@ -0,0 +1,78 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachOSymbolTable.cpp
+/// \brief Mach-O symbol table, from the LC_SYMTAB load command
+//
+#include "stdafx.h"
+#include "MachOSymbolTable.hpp"
+
+MachOSymbolTable::MachOSymbolTable(const MachOImage& image)
+   :m_image(image)
+{
+   const MachOSymtabCommand* symtabCommand = m_image.SymtabCommand();
+   if (symtabCommand == nullptr)
+   {
+      m_errorText = _T("Image has no symbol table");
+      return;
+   }
+
+   DWORD symbolOffset = m_image.Get(symtabCommand->symbolOffset);
+   DWORD numberOfSymbols = m_image.Get(symtabCommand->numberOfSymbols);
+   DWORD stringOffset = m_image.Get(symtabCommand->stringOffset);
+   DWORD stringSize = m_image.Get(symtabCommand->stringSize);
+
+   m_entrySize = m_image.Is64Bit() ? sizeof(MachONlist64) : sizeof(MachONlist32);
+
+   m_symbols = m_image.Data(symbolOffset, ULONGLONG(numberOfSymbols) * m_entrySize);
+   if (m_symbols == nullptr)
+   {
+      m_errorText = _T("Symbol table is outside of the file");
+      return;
+   }
+
+   m_count = numberOfSymbols;
+
+   const BYTE* strings = m_image.Data(stringOffset, stringSize);
+   if (strings != nullptr)
+   {
+      m_strings = reinterpret_cast<const char*>(strings);
+      m_stringsSize = stringSize;
+   }
+
+   m_isValid = true;
+}
+
+MachOSymbol MachOSymbolTable::GetSymbol(size_t index) const
+{
+   if (index >= m_count)
+      return MachOSymbol{};
+
+   return m_image.Dispatch([&](auto layout) { return DecodeSymbol(layout, index); });
+}
+
+template <typename TLayout>
+MachOSymbol MachOSymbolTable::DecodeSymbol(TLayout layout, size_t index) const
+{
+   const BYTE* entry = m_symbols + index * m_entrySize;
+   const typename TLayout::Nlist& rawSymbol =
+      *reinterpret_cast<const typename TLayout::Nlist*>(entry);
+
+   MachOSymbol symbol;
+   symbol.index = index;
+   symbol.type = rawSymbol.type;
+   symbol.sectionIndex = rawSymbol.section;
+   symbol.description = layout.Get(rawSymbol.description);
+   symbol.value = layout.Get(rawSymbol.value);
+   symbol.entry = entry;
+
+   size_t nameOffset = layout.Get(rawSymbol.stringIndex);
+   if (nameOffset < m_stringsSize)
+   {
+      const char* text = m_strings + nameOffset;
+      symbol.name = CString(CStringA(text, static_cast<int>(strnlen(text, m_stringsSize - nameOffset))));
+   }
+
+   return symbol;
+}
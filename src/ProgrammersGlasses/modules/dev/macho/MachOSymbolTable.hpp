@@ -0,0 +1,89 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MachOSymbolTable.hpp
+/// \brief Mach-O symbol table, from the LC_SYMTAB load command
+//
+#pragma once
+
+#include "MachOImage.hpp"
+
+/// \brief Mach-O symbol, with values converted to host byte order
+struct MachOSymbol
+{
+   /// symbol index
+   size_t index = 0;
+
+   /// symbol name
+   CString name;
+
+   /// symbol type and flags; N_* values
+   BYTE type = 0;
+
+   /// section ordinal, 1-based; 0 for NO_SECT
+   BYTE sectionIndex = 0;
+
+   /// symbol description flags
+   WORD description = 0;
+
+   /// symbol value, e.g. an address
+   ULONGLONG value = 0;
+
+   /// pointer to the symbol table entry in the file
+   const BYTE* entry = nullptr;
+};
+
+/// \brief Mach-O symbol table
+/// \details Accesses the nlist entries of the LC_SYMTAB load command directly
+/// in the mapped file; symbols are only decoded when requested. Lookups by
+/// name don't scan the symbol table, but use the export trie; see
+/// MachOExportTrie.
+class MachOSymbolTable
+{
+public:
+   /// ctor; the image must outlive the symbol table
+   explicit MachOSymbolTable(const MachOImage& image);
+
+   /// returns if the symbol table is valid
+   bool IsValid() const { return m_isValid; }
+
+   /// returns an error text, when the symbol table is invalid
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the number of symbols
+   size_t Count() const { return m_count; }
+
+   /// decodes the symbol with given index
+   MachOSymbol GetSymbol(size_t index) const;
+
+private:
+   /// decodes a symbol
+   template <typename TLayout>
+   MachOSymbol DecodeSymbol(TLayout layout, size_t index) const;
+
+private:
+   /// Mach-O image
+   const MachOImage& m_image;
+
+   /// indicates if symbol table is valid
+   bool m_isValid = false;
+
+   /// error text
+   CString m_errorText;
+
+   /// pointer to the first symbol table entry
+   const BYTE* m_symbols = nullptr;
+
+   /// size of a symbol table entry
+   size_t m_entrySize = 0;
+
+   /// number of symbols
+   size_t m_count = 0;
+
+   /// string table data
+   const char* m_strings = nullptr;
+
+   /// string table size
+   size_t m_stringsSize = 0;
+};
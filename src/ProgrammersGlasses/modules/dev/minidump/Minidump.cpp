@@ -0,0 +1,333 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file Minidump.cpp
+/// \brief Minidump file, with stream directory and memory range index
+//
+#include "stdafx.h"
+#include "Minidump.hpp"
+
+bool Minidump::IsMinidumpFile(const File& file)
+{
+   if (file.Size() < sizeof(MinidumpHeader))
+      return false;
+
+   const MinidumpHeader& header = *file.Data<MinidumpHeader>();
+
+   return header.signature == c_minidumpSignature &&
+      LOWORD(header.version) == c_minidumpVersion;
+}
+
+Minidump::Minidump(const File& file)
+   :m_file(file)
+{
+   if (!IsMinidumpFile(m_file))
+   {
+      m_errorText = _T("Invalid minidump signature");
+      return;
+   }
+
+   const MinidumpHeader& header = Header();
+
+   const MinidumpDirectory* directory = reinterpret_cast<const MinidumpDirectory*>(
+      Data(header.streamDirectoryRva, static_cast<ULONGLONG>(header.numberOfStreams) * sizeof(MinidumpDirectory)));
+
+   if (directory == nullptr)
+   {
+      m_errorText = _T("Stream directory is outside of the file");
+      return;
+   }
+
+   m_isValid = true;
+
+   m_streams.reserve(header.numberOfStreams);
+   for (DWORD streamIndex = 0; streamIndex < header.numberOfStreams; streamIndex++)
+   {
+      const MinidumpDirectory& entry = directory[streamIndex];
+
+      MinidumpStream stream;
+      stream.index = streamIndex;
+      stream.streamType = entry.streamType;
+      stream.rva = entry.location.rva;
+      stream.dataSize = entry.location.dataSize;
+
+      m_streams.push_back(stream);
+   }
+
+   for (const MinidumpStream& stream : m_streams)
+   {
+      if (Data(stream.rva, stream.dataSize) == nullptr)
+      {
+         CString streamTypeText = GetValueFromMapOrDefault<DWORD>(
+            g_mapMinidumpStreamTypeToDisplayText, stream.streamType, _T("unknown"));
+
+         AddError(_T("Stream ") + streamTypeText + _T(" is outside of the file"));
+         continue;
+      }
+
+      switch (stream.streamType)
+      {
+      case c_minidumpStreamThreadList:
+         DecodeThreadList(stream);
+         break;
+
+      case c_minidumpStreamModuleList:
+         DecodeModuleList(stream);
+         break;
+
+      case c_minidumpStreamMemoryList:
+         DecodeMemoryList(stream);
+         break;
+
+      case c_minidumpStreamMemory64List:
+         DecodeMemory64List(stream);
+         break;
+
+      case c_minidumpStreamException:
+         if (stream.dataSize >= sizeof(MinidumpExceptionStream))
+            m_exceptionStream = m_file.Data<MinidumpExceptionStream>(stream.rva);
+         else
+            AddError(_T("Exception stream is too small"));
+         break;
+
+      default:
+         break;
+      }
+   }
+
+   std::sort(m_memoryRanges.begin(), m_memoryRanges.end(),
+      [](const MinidumpMemoryRange& lhs, const MinidumpMemoryRange& rhs)
+      {
+         return lhs.startAddress < rhs.startAddress;
+      });
+}
+
+const MinidumpStream* Minidump::FindStream(DWORD streamType) const
+{
+   auto iter = std::find_if(m_streams.begin(), m_streams.end(),
+      [streamType](const MinidumpStream& stream)
+      {
+         return stream.streamType == streamType;
+      });
+
+   return iter != m_streams.end() ? &*iter : nullptr;
+}
+
+const MinidumpMemoryRange* Minidump::FindMemoryRange(ULONGLONG address) const
+{
+   // find the first range starting after the address; the range before it is
+   // the only one that can contain the address
+   auto iter = std::upper_bound(m_memoryRanges.begin(), m_memoryRanges.end(), address,
+      [](ULONGLONG value, const MinidumpMemoryRange& range)
+      {
+         return value < range.startAddress;
+      });
+
+   if (iter == m_memoryRanges.begin())
+      return nullptr;
+
+   --iter;
+
+   return address - iter->startAddress < iter->size ? &*iter : nullptr;
+}
+
+const BYTE* Minidump::ReadMemory(ULONGLONG address, size_t size) const
+{
+   const MinidumpMemoryRange* range = FindMemoryRange(address);
+   if (range == nullptr)
+      return nullptr;
+
+   ULONGLONG offsetInRange = address - range->startAddress;
+   if (size > range->size - offsetInRange)
+      return nullptr;
+
+   return Data(range->fileOffset + offsetInRange, size);
+}
+
+const MinidumpModuleInfo* Minidump::FindModuleByAddress(ULONGLONG address) const
+{
+   auto iter = std::find_if(m_modules.begin(), m_modules.end(),
+      [address](const MinidumpModuleInfo& moduleInfo)
+      {
+         return address >= moduleInfo.module->baseOfImage &&
+            address - moduleInfo.module->baseOfImage < moduleInfo.module->sizeOfImage;
+      });
+
+   return iter != m_modules.end() ? &*iter : nullptr;
+}
+
+CString Minidump::ReadString(DWORD rva) const
+{
+   const DWORD* length = reinterpret_cast<const DWORD*>(Data(rva, sizeof(DWORD)));
+   if (length == nullptr)
+      return CString{};
+
+   const BYTE* text = Data(static_cast<ULONGLONG>(rva) + sizeof(DWORD), *length);
+   if (text == nullptr)
+      return CString{};
+
+   return CString{
+      reinterpret_cast<const WCHAR*>(text),
+      static_cast<int>(*length / sizeof(WCHAR)) };
+}
+
+const BYTE* Minidump::Data(ULONGLONG offset, ULONGLONG size) const
+{
+   if (offset > m_file.Size() ||
+      size > m_file.Size() - offset)
+      return nullptr;
+
+   return m_file.Data<BYTE>(static_cast<size_t>(offset));
+}
+
+void Minidump::DecodeThreadList(const MinidumpStream& stream)
+{
+   if (stream.dataSize < sizeof(DWORD))
+   {
+      AddError(_T("Thread list stream is too small"));
+      return;
+   }
+
+   DWORD numberOfThreads = *m_file.Data<DWORD>(stream.rva);
+   if (numberOfThreads > (stream.dataSize - sizeof(DWORD)) / sizeof(MinidumpThread))
+   {
+      AddError(_T("Thread list exceeds the thread list stream"));
+      numberOfThreads = static_cast<DWORD>((stream.dataSize - sizeof(DWORD)) / sizeof(MinidumpThread));
+   }
+
+   const MinidumpThread* threads = m_file.Data<MinidumpThread>(stream.rva + sizeof(DWORD));
+
+   m_threads.reserve(numberOfThreads);
+   for (DWORD threadIndex = 0; threadIndex < numberOfThreads; threadIndex++)
+      m_threads.push_back(threads + threadIndex);
+}
+
+void Minidump::DecodeModuleList(const MinidumpStream& stream)
+{
+   if (stream.dataSize < sizeof(DWORD))
+   {
+      AddError(_T("Module list stream is too small"));
+      return;
+   }
+
+   DWORD numberOfModules = *m_file.Data<DWORD>(stream.rva);
+   if (numberOfModules > (stream.dataSize - sizeof(DWORD)) / sizeof(MinidumpModuleEntry))
+   {
+      AddError(_T("Module list exceeds the module list stream"));
+      numberOfModules = static_cast<DWORD>((stream.dataSize - sizeof(DWORD)) / sizeof(MinidumpModuleEntry));
+   }
+
+   const MinidumpModuleEntry* modules = m_file.Data<MinidumpModuleEntry>(stream.rva + sizeof(DWORD));
+
+   m_modules.reserve(numberOfModules);
+   for (DWORD moduleIndex = 0; moduleIndex < numberOfModules; moduleIndex++)
+   {
+      MinidumpModuleInfo moduleInfo;
+      moduleInfo.index = moduleIndex;
+      moduleInfo.module = modules + moduleIndex;
+      moduleInfo.name = ReadString(moduleInfo.module->moduleNameRva);
+
+      m_modules.push_back(moduleInfo);
+   }
+}
+
+void Minidump::DecodeMemoryList(const MinidumpStream& stream)
+{
+   if (stream.dataSize < sizeof(DWORD))
+   {
+      AddError(_T("Memory list stream is too small"));
+      return;
+   }
+
+   DWORD numberOfMemoryRanges = *m_file.Data<DWORD>(stream.rva);
+   if (numberOfMemoryRanges > (stream.dataSize - sizeof(DWORD)) / sizeof(MinidumpMemoryDescriptor))
+   {
+      AddError(_T("Memory range list exceeds the memory list stream"));
+      numberOfMemoryRanges = static_cast<DWORD>((stream.dataSize - sizeof(DWORD)) / sizeof(MinidumpMemoryDescriptor));
+   }
+
+   const MinidumpMemoryDescriptor* descriptors =
+      m_file.Data<MinidumpMemoryDescriptor>(stream.rva + sizeof(DWORD));
+
+   m_memoryRanges.reserve(m_memoryRanges.size() + numberOfMemoryRanges);
+   for (DWORD rangeIndex = 0; rangeIndex < numberOfMemoryRanges; rangeIndex++)
+   {
+      const MinidumpMemoryDescriptor& descriptor = descriptors[rangeIndex];
+
+      if (Data(descriptor.memory.rva, descriptor.memory.dataSize) == nullptr)
+      {
+         AddError(_T("Memory range data is outside of the file"));
+         continue;
+      }
+
+      MinidumpMemoryRange range;
+      range.startAddress = descriptor.startOfMemoryRange;
+      range.size = descriptor.memory.dataSize;
+      range.fileOffset = descriptor.memory.rva;
+
+      m_memoryRanges.push_back(range);
+   }
+}
+
+void Minidump::DecodeMemory64List(const MinidumpStream& stream)
+{
+   if (stream.dataSize < sizeof(MinidumpMemory64ListHeader))
+   {
+      AddError(_T("Memory64 list stream is too small"));
+      return;
+   }
+
+   const MinidumpMemory64ListHeader& header = *m_file.Data<MinidumpMemory64ListHeader>(stream.rva);
+
+   ULONGLONG numberOfMemoryRanges = header.numberOfMemoryRanges;
+   ULONGLONG maxNumberOfMemoryRanges =
+      (stream.dataSize - sizeof(MinidumpMemory64ListHeader)) / sizeof(MinidumpMemoryDescriptor64);
+
+   if (numberOfMemoryRanges > maxNumberOfMemoryRanges)
+   {
+      AddError(_T("Memory64 range list exceeds the memory64 list stream"));
+      numberOfMemoryRanges = maxNumberOfMemoryRanges;
+   }
+
+   const MinidumpMemoryDescriptor64* descriptors =
+      m_file.Data<MinidumpMemoryDescriptor64>(stream.rva + sizeof(MinidumpMemory64ListHeader));
+
+   // the data of all memory ranges is stored consecutively, so the file
+   // offset of each range is the sum of all previous range sizes
+   ULONGLONG fileOffset = header.baseRva;
+
+   m_memoryRanges.reserve(m_memoryRanges.size() + static_cast<size_t>(numberOfMemoryRanges));
+   for (ULONGLONG rangeIndex = 0; rangeIndex < numberOfMemoryRanges; rangeIndex++)
+   {
+      const MinidumpMemoryDescriptor64& descriptor = descriptors[rangeIndex];
+
+      if (Data(fileOffset, descriptor.dataSize) == nullptr)
+      {
+         // all following ranges are outside of the file, too
+         AddError(_T("Memory64 range data is outside of the file"));
+         break;
+      }
+
+      MinidumpMemoryRange range;
+      range.startAddress = descriptor.startOfMemoryRange;
+      range.size = descriptor.dataSize;
+      range.fileOffset = fileOffset;
+      range.isMemory64 = true;
+
+      m_memoryRanges.push_back(range);
+
+      fileOffset += descriptor.dataSize;
+   }
+}
+
+void Minidump::AddError(const CString& errorText)
+{
+   if (m_errorText.Find(errorText) != -1)
+      return;
+
+   if (!m_errorText.IsEmpty())
+      m_errorText += _T("\n");
+
+   m_errorText += errorText;
+}
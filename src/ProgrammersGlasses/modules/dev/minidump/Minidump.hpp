@@ -0,0 +1,163 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file Minidump.hpp
+/// \brief Minidump file, with stream directory and memory range index
+//
+#pragma once
+
+#include "MinidumpHeader.hpp"
+#include "File.hpp"
+
+/// \brief Stream directory entry
+struct MinidumpStream
+{
+   /// index in the stream directory
+   size_t index = 0;
+
+   /// stream type; MINIDUMP_STREAM_TYPE value
+   DWORD streamType = 0;
+
+   /// file offset of the stream data
+   DWORD rva = 0;
+
+   /// size of the stream data
+   DWORD dataSize = 0;
+};
+
+/// \brief Module, with decoded name
+struct MinidumpModuleInfo
+{
+   /// index in the module list
+   size_t index = 0;
+
+   /// module name, usually the full path of the module
+   CString name;
+
+   /// pointer to the module entry in the file
+   const MinidumpModuleEntry* module = nullptr;
+};
+
+/// \brief Captured memory range, with the location of its data in the file
+struct MinidumpMemoryRange
+{
+   /// virtual start address of the memory range
+   ULONGLONG startAddress = 0;
+
+   /// size of the memory range
+   ULONGLONG size = 0;
+
+   /// file offset of the memory range data
+   ULONGLONG fileOffset = 0;
+
+   /// indicates that the memory range is stored in the Memory64ListStream
+   bool isMemory64 = false;
+};
+
+/// \brief Minidump file
+/// \details Decodes the stream directory and the thread, module, exception
+/// and memory list streams. All captured memory ranges of the MemoryListStream
+/// and the Memory64ListStream are stored in an index sorted by start address,
+/// so that reading a virtual address is a binary search and a direct access
+/// to the mapped file, even for full memory dumps with many GB of memory.
+class Minidump
+{
+public:
+   /// returns if the file starts with a minidump signature
+   static bool IsMinidumpFile(const File& file);
+
+   /// ctor; decodes the minidump file
+   explicit Minidump(const File& file);
+
+   /// returns if the minidump header and stream directory are valid
+   bool IsValid() const { return m_isValid; }
+
+   /// returns an error text, when the minidump is invalid or a stream has
+   /// errors
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the file
+   const File& GetFile() const { return m_file; }
+
+   /// returns the minidump header
+   const MinidumpHeader& Header() const { return *m_file.Data<MinidumpHeader>(); }
+
+   /// returns all streams of the stream directory
+   const std::vector<MinidumpStream>& Streams() const { return m_streams; }
+
+   /// finds the first stream with given type; returns nullptr when not found
+   const MinidumpStream* FindStream(DWORD streamType) const;
+
+   /// returns all threads of the thread list stream
+   const std::vector<const MinidumpThread*>& Threads() const { return m_threads; }
+
+   /// returns all modules of the module list stream
+   const std::vector<MinidumpModuleInfo>& Modules() const { return m_modules; }
+
+   /// returns the exception stream, or nullptr when not available
+   const MinidumpExceptionStream* ExceptionStream() const { return m_exceptionStream; }
+
+   /// returns all captured memory ranges, sorted by start address
+   const std::vector<MinidumpMemoryRange>& MemoryRanges() const { return m_memoryRanges; }
+
+   /// finds the memory range containing the given address; returns nullptr
+   /// when the address wasn't captured
+   const MinidumpMemoryRange* FindMemoryRange(ULONGLONG address) const;
+
+   /// returns a pointer to the captured memory at given address, or nullptr
+   /// when the memory isn't completely stored in one captured memory range
+   const BYTE* ReadMemory(ULONGLONG address, size_t size) const;
+
+   /// finds the module containing the given address; returns nullptr when
+   /// no module contains the address
+   const MinidumpModuleInfo* FindModuleByAddress(ULONGLONG address) const;
+
+   /// returns a MINIDUMP_STRING stored at given file offset
+   CString ReadString(DWORD rva) const;
+
+   /// returns a pointer to file data, or nullptr when the range is outside
+   /// of the file
+   const BYTE* Data(ULONGLONG offset, ULONGLONG size) const;
+
+private:
+   /// decodes the thread list stream
+   void DecodeThreadList(const MinidumpStream& stream);
+
+   /// decodes the module list stream
+   void DecodeModuleList(const MinidumpStream& stream);
+
+   /// decodes the memory list stream
+   void DecodeMemoryList(const MinidumpStream& stream);
+
+   /// decodes the memory64 list stream
+   void DecodeMemory64List(const MinidumpStream& stream);
+
+   /// adds an error text; identical error texts are only recorded once
+   void AddError(const CString& errorText);
+
+private:
+   /// file
+   const File& m_file;
+
+   /// indicates if the minidump is valid
+   bool m_isValid = false;
+
+   /// error text
+   CString m_errorText;
+
+   /// all streams
+   std::vector<MinidumpStream> m_streams;
+
+   /// all threads
+   std::vector<const MinidumpThread*> m_threads;
+
+   /// all modules
+   std::vector<MinidumpModuleInfo> m_modules;
+
+   /// exception stream
+   const MinidumpExceptionStream* m_exceptionStream = nullptr;
+
+   /// memory range index, sorted by start address
+   std::vector<MinidumpMemoryRange> m_memoryRanges;
+};
@@ -0,0 +1,438 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MinidumpHeader.cpp
+/// \brief Minidump header, stream directory and stream definitions
+//
+#include "stdafx.h"
+#include "MinidumpHeader.hpp"
+#include "DisplayFormatHelper.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapMinidumpStreamTypeToDisplayText =
+{
+   { 0, _T("UnusedStream") },
+   { 1, _T("ReservedStream0") },
+   { 2, _T("ReservedStream1") },
+   { 3, _T("ThreadListStream") },
+   { 4, _T("ModuleListStream") },
+   { 5, _T("MemoryListStream") },
+   { 6, _T("ExceptionStream") },
+   { 7, _T("SystemInfoStream") },
+   { 8, _T("ThreadExListStream") },
+   { 9, _T("Memory64ListStream") },
+   { 10, _T("CommentStreamA") },
+   { 11, _T("CommentStreamW") },
+   { 12, _T("HandleDataStream") },
+   { 13, _T("FunctionTableStream") },
+   { 14, _T("UnloadedModuleListStream") },
+   { 15, _T("MiscInfoStream") },
+   { 16, _T("MemoryInfoListStream") },
+   { 17, _T("ThreadInfoListStream") },
+   { 18, _T("HandleOperationListStream") },
+   { 19, _T("TokenStream") },
+   { 20, _T("JavaScriptDataStream") },
+   { 21, _T("SystemMemoryInfoStream") },
+   { 22, _T("ProcessVmCountersStream") },
+   { 23, _T("IptTraceStream") },
+   { 24, _T("ThreadNamesStream") },
+   { 0xffff, _T("LastReservedStream") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapMinidumpTypeFlagsToDisplayText =
+{
+   { 0x00000001, _T("MiniDumpWithDataSegs") },
+   { 0x00000002, _T("MiniDumpWithFullMemory") },
+   { 0x00000004, _T("MiniDumpWithHandleData") },
+   { 0x00000008, _T("MiniDumpFilterMemory") },
+   { 0x00000010, _T("MiniDumpScanMemory") },
+   { 0x00000020, _T("MiniDumpWithUnloadedModules") },
+   { 0x00000040, _T("MiniDumpWithIndirectlyReferencedMemory") },
+   { 0x00000080, _T("MiniDumpFilterModulePaths") },
+   { 0x00000100, _T("MiniDumpWithProcessThreadData") },
+   { 0x00000200, _T("MiniDumpWithPrivateReadWriteMemory") },
+   { 0x00000400, _T("MiniDumpWithoutOptionalData") },
+   { 0x00000800, _T("MiniDumpWithFullMemoryInfo") },
+   { 0x00001000, _T("MiniDumpWithThreadInfo") },
+   { 0x00002000, _T("MiniDumpWithCodeSegs") },
+   { 0x00004000, _T("MiniDumpWithoutAuxiliaryState") },
+   { 0x00008000, _T("MiniDumpWithFullAuxiliaryState") },
+   { 0x00010000, _T("MiniDumpWithPrivateWriteCopyMemory") },
+   { 0x00020000, _T("MiniDumpIgnoreInaccessibleMemory") },
+   { 0x00040000, _T("MiniDumpWithTokenInformation") },
+   { 0x00080000, _T("MiniDumpWithModuleHeaders") },
+   { 0x00100000, _T("MiniDumpFilterTriage") },
+   { 0x00200000, _T("MiniDumpWithAvxXStateContext") },
+   { 0x00400000, _T("MiniDumpWithIptTrace") },
+   { 0x00800000, _T("MiniDumpScanInaccessiblePartialPages") },
+   { 0x01000000, _T("MiniDumpFilterWriteCombinedMemory") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapMinidumpExceptionCodeToDisplayText =
+{
+   { 0x80000002, _T("EXCEPTION_DATATYPE_MISALIGNMENT") },
+   { 0x80000003, _T("EXCEPTION_BREAKPOINT") },
+   { 0x80000004, _T("EXCEPTION_SINGLE_STEP") },
+   { 0xC0000005, _T("EXCEPTION_ACCESS_VIOLATION") },
+   { 0xC0000006, _T("EXCEPTION_IN_PAGE_ERROR") },
+   { 0xC0000008, _T("EXCEPTION_INVALID_HANDLE") },
+   { 0xC000001D, _T("EXCEPTION_ILLEGAL_INSTRUCTION") },
+   { 0xC0000025, _T("EXCEPTION_NONCONTINUABLE_EXCEPTION") },
+   { 0xC0000026, _T("EXCEPTION_INVALID_DISPOSITION") },
+   { 0xC000008C, _T("EXCEPTION_ARRAY_BOUNDS_EXCEEDED") },
+   { 0xC000008D, _T("EXCEPTION_FLT_DENORMAL_OPERAND") },
+   { 0xC000008E, _T("EXCEPTION_FLT_DIVIDE_BY_ZERO") },
+   { 0xC000008F, _T("EXCEPTION_FLT_INEXACT_RESULT") },
+   { 0xC0000090, _T("EXCEPTION_FLT_INVALID_OPERATION") },
+   { 0xC0000091, _T("EXCEPTION_FLT_OVERFLOW") },
+   { 0xC0000092, _T("EXCEPTION_FLT_STACK_CHECK") },
+   { 0xC0000093, _T("EXCEPTION_FLT_UNDERFLOW") },
+   { 0xC0000094, _T("EXCEPTION_INT_DIVIDE_BY_ZERO") },
+   { 0xC0000095, _T("EXCEPTION_INT_OVERFLOW") },
+   { 0xC0000096, _T("EXCEPTION_PRIV_INSTRUCTION") },
+   { 0xC00000FD, _T("EXCEPTION_STACK_OVERFLOW") },
+   { 0xC0000374, _T("STATUS_HEAP_CORRUPTION") },
+   { 0xC0000409, _T("STATUS_STACK_BUFFER_OVERRUN") },
+   { 0xC0000417, _T("STATUS_INVALID_CRUNTIME_PARAMETER") },
+   { 0xE06D7363, _T("C++ exception (0xE06D7363)") },
+};
+
+const StructDefinition g_definitionMinidumpHeader = StructDefinition({
+   StructField(
+      offsetof(MinidumpHeader, MinidumpHeader::signature),
+      sizeof(MinidumpHeader::signature),
+      4,
+      true, // little-endian
+      StructFieldType::text,
+      _T("Signature")),
+
+   StructField(
+      offsetof(MinidumpHeader, MinidumpHeader::version),
+      sizeof(MinidumpHeader::version),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Version")),
+
+   StructField(
+      offsetof(MinidumpHeader, MinidumpHeader::numberOfStreams),
+      sizeof(MinidumpHeader::numberOfStreams),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Number of streams")),
+
+   StructField(
+      offsetof(MinidumpHeader, MinidumpHeader::streamDirectoryRva),
+      sizeof(MinidumpHeader::streamDirectoryRva),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Stream directory RVA")),
+
+   StructField(
+      offsetof(MinidumpHeader, MinidumpHeader::checksum),
+      sizeof(MinidumpHeader::checksum),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Checksum")),
+
+   StructField(
+      offsetof(MinidumpHeader, MinidumpHeader::timeDateStamp),
+      sizeof(MinidumpHeader::timeDateStamp),
+      4,
+      true, // little-endian
+      [](LPCVOID data, size_t)
+      {
+         time_t time = *reinterpret_cast<const DWORD*>(data);
+         return DisplayFormatHelper::FormatDateTime(time);
+      },
+      _T("Time stamp")),
+
+   StructField(
+      offsetof(MinidumpHeader, MinidumpHeader::flags),
+      sizeof(MinidumpHeader::flags),
+      8,
+      true, // little-endian
+      [](LPCVOID data, size_t)
+      {
+         ULONGLONG flags = *reinterpret_cast<const ULONGLONG*>(data);
+
+         CString text;
+         text.Format(_T("0x%016llx %s"),
+            flags,
+            DisplayFormatHelper::FormatBitFlagsFromMap(
+               g_mapMinidumpTypeFlagsToDisplayText, static_cast<DWORD>(flags)).GetString());
+
+         return text;
+      },
+      _T("Dump type flags")),
+   });
+
+const StructDefinition g_definitionMinidumpThread = StructDefinition({
+   StructField(
+      offsetof(MinidumpThread, MinidumpThread::threadId),
+      sizeof(MinidumpThread::threadId),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Thread ID")),
+
+   StructField(
+      offsetof(MinidumpThread, MinidumpThread::suspendCount),
+      sizeof(MinidumpThread::suspendCount),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Suspend count")),
+
+   StructField(
+      offsetof(MinidumpThread, MinidumpThread::priorityClass),
+      sizeof(MinidumpThread::priorityClass),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Priority class")),
+
+   StructField(
+      offsetof(MinidumpThread, MinidumpThread::priority),
+      sizeof(MinidumpThread::priority),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Priority")),
+
+   StructField(
+      offsetof(MinidumpThread, MinidumpThread::teb),
+      sizeof(MinidumpThread::teb),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Thread environment block (TEB) address")),
+
+   StructField(
+      offsetof(MinidumpThread, stack.startOfMemoryRange),
+      sizeof(ULONGLONG),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Stack start address")),
+
+   StructField(
+      offsetof(MinidumpThread, stack.memory.dataSize),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Stack size")),
+
+   StructField(
+      offsetof(MinidumpThread, stack.memory.rva),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Stack RVA")),
+
+   StructField(
+      offsetof(MinidumpThread, threadContext.dataSize),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Thread context size")),
+
+   StructField(
+      offsetof(MinidumpThread, threadContext.rva),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Thread context RVA")),
+   });
+
+const StructDefinition g_definitionMinidumpModule = StructDefinition({
+   StructField(
+      offsetof(MinidumpModuleEntry, MinidumpModuleEntry::baseOfImage),
+      sizeof(MinidumpModuleEntry::baseOfImage),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Base address")),
+
+   StructField(
+      offsetof(MinidumpModuleEntry, MinidumpModuleEntry::sizeOfImage),
+      sizeof(MinidumpModuleEntry::sizeOfImage),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of image")),
+
+   StructField(
+      offsetof(MinidumpModuleEntry, MinidumpModuleEntry::checksum),
+      sizeof(MinidumpModuleEntry::checksum),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Checksum")),
+
+   StructField(
+      offsetof(MinidumpModuleEntry, MinidumpModuleEntry::timeDateStamp),
+      sizeof(MinidumpModuleEntry::timeDateStamp),
+      4,
+      true, // little-endian
+      [](LPCVOID data, size_t)
+      {
+         time_t time = *reinterpret_cast<const DWORD*>(data);
+         return DisplayFormatHelper::FormatDateTime(time);
+      },
+      _T("Time stamp")),
+
+   StructField(
+      offsetof(MinidumpModuleEntry, MinidumpModuleEntry::moduleNameRva),
+      sizeof(MinidumpModuleEntry::moduleNameRva),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Module name RVA")),
+
+   StructField(
+      offsetof(MinidumpModuleEntry, versionInfo.fileVersionMS),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("File version (MS)")),
+
+   StructField(
+      offsetof(MinidumpModuleEntry, versionInfo.fileVersionLS),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("File version (LS)")),
+
+   StructField(
+      offsetof(MinidumpModuleEntry, versionInfo.productVersionMS),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Product version (MS)")),
+
+   StructField(
+      offsetof(MinidumpModuleEntry, versionInfo.productVersionLS),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Product version (LS)")),
+
+   StructField(
+      offsetof(MinidumpModuleEntry, cvRecord.dataSize),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("CodeView record size")),
+
+   StructField(
+      offsetof(MinidumpModuleEntry, cvRecord.rva),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("CodeView record RVA")),
+
+   StructField(
+      offsetof(MinidumpModuleEntry, miscRecord.dataSize),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Misc record size")),
+
+   StructField(
+      offsetof(MinidumpModuleEntry, miscRecord.rva),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Misc record RVA")),
+   });
+
+const StructDefinition g_definitionMinidumpExceptionStream = StructDefinition({
+   StructField(
+      offsetof(MinidumpExceptionStream, MinidumpExceptionStream::threadId),
+      sizeof(MinidumpExceptionStream::threadId),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Thread ID")),
+
+   StructField(
+      offsetof(MinidumpExceptionStream, exceptionRecord.exceptionCode),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::valueMapping,
+      g_mapMinidumpExceptionCodeToDisplayText,
+      _T("Exception code")),
+
+   StructField(
+      offsetof(MinidumpExceptionStream, exceptionRecord.exceptionFlags),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Exception flags")),
+
+   StructField(
+      offsetof(MinidumpExceptionStream, exceptionRecord.exceptionRecord),
+      sizeof(ULONGLONG),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Chained exception record address")),
+
+   StructField(
+      offsetof(MinidumpExceptionStream, exceptionRecord.exceptionAddress),
+      sizeof(ULONGLONG),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Exception address")),
+
+   StructField(
+      offsetof(MinidumpExceptionStream, exceptionRecord.numberParameters),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Number of parameters")),
+
+   StructField(
+      offsetof(MinidumpExceptionStream, exceptionRecord.exceptionInformation),
+      sizeof(MinidumpException::exceptionInformation),
+      8,
+      true, // little-endian
+      StructFieldType::byteArray,
+      _T("Exception information")),
+
+   StructField(
+      offsetof(MinidumpExceptionStream, threadContext.dataSize),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Thread context size")),
+
+   StructField(
+      offsetof(MinidumpExceptionStream, threadContext.rva),
+      sizeof(DWORD),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Thread context RVA")),
+   });
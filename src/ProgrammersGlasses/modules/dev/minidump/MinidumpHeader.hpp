@@ -0,0 +1,192 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MinidumpHeader.hpp
+/// \brief Minidump header, stream directory and stream definitions
+//
+#pragma once
+
+#include "StructDefinition.hpp"
+
+#pragma pack(push, 1)
+
+/// \brief Minidump file header
+/// \see https://learn.microsoft.com/en-us/windows/win32/api/minidumpapiset/ns-minidumpapiset-minidump_header
+/// The struct corresponds with minidumpapiset.h's MINIDUMP_HEADER struct.
+struct MinidumpHeader
+{
+   DWORD signature;           ///< signature; "MDMP"
+   DWORD version;             ///< low word: MINIDUMP_VERSION; high word: implementation specific
+   DWORD numberOfStreams;     ///< number of streams in the stream directory
+   DWORD streamDirectoryRva;  ///< file offset of the stream directory
+   DWORD checksum;            ///< checksum; may be 0
+   DWORD timeDateStamp;       ///< time of dump creation, in time_t format
+   ULONGLONG flags;           ///< dump type flags; MINIDUMP_TYPE values
+};
+
+/// \brief Location of data in the minidump file
+/// The struct corresponds with minidumpapiset.h's MINIDUMP_LOCATION_DESCRIPTOR struct.
+struct MinidumpLocationDescriptor
+{
+   DWORD dataSize;   ///< size of the data
+   DWORD rva;        ///< file offset of the data
+};
+
+/// \brief Stream directory entry
+/// The struct corresponds with minidumpapiset.h's MINIDUMP_DIRECTORY struct.
+struct MinidumpDirectory
+{
+   DWORD streamType;                   ///< stream type; MINIDUMP_STREAM_TYPE value
+   MinidumpLocationDescriptor location; ///< location of the stream data
+};
+
+/// \brief Memory range, stored in a MemoryListStream or as thread stack
+/// The struct corresponds with minidumpapiset.h's MINIDUMP_MEMORY_DESCRIPTOR struct.
+struct MinidumpMemoryDescriptor
+{
+   ULONGLONG startOfMemoryRange;       ///< virtual start address of the memory range
+   MinidumpLocationDescriptor memory;  ///< location of the memory range data
+};
+
+/// \brief Memory range, stored in a Memory64ListStream
+/// \details The data of all memory ranges is stored consecutively, starting
+/// at the base RVA of the Memory64ListStream.
+/// The struct corresponds with minidumpapiset.h's MINIDUMP_MEMORY_DESCRIPTOR64 struct.
+struct MinidumpMemoryDescriptor64
+{
+   ULONGLONG startOfMemoryRange; ///< virtual start address of the memory range
+   ULONGLONG dataSize;           ///< size of the memory range
+};
+
+/// \brief Header of the Memory64ListStream
+/// The struct corresponds with minidumpapiset.h's MINIDUMP_MEMORY64_LIST struct,
+/// without the memory ranges array.
+struct MinidumpMemory64ListHeader
+{
+   ULONGLONG numberOfMemoryRanges;  ///< number of memory ranges following the header
+   ULONGLONG baseRva;               ///< file offset of the data of the first memory range
+};
+
+/// \brief Thread, stored in a ThreadListStream
+/// The struct corresponds with minidumpapiset.h's MINIDUMP_THREAD struct.
+struct MinidumpThread
+{
+   DWORD threadId;                           ///< thread ID
+   DWORD suspendCount;                       ///< suspend count
+   DWORD priorityClass;                      ///< priority class
+   DWORD priority;                           ///< priority level
+   ULONGLONG teb;                            ///< address of the thread environment block
+   MinidumpMemoryDescriptor stack;           ///< stack memory
+   MinidumpLocationDescriptor threadContext; ///< CPU specific thread context
+};
+
+/// \brief Version information of a module
+/// The struct corresponds with verrsrc.h's VS_FIXEDFILEINFO struct.
+struct MinidumpFixedFileInfo
+{
+   DWORD signature;        ///< signature; 0xFEEF04BD
+   DWORD structVersion;    ///< struct version
+   DWORD fileVersionMS;    ///< file version; most significant 32 bits
+   DWORD fileVersionLS;    ///< file version; least significant 32 bits
+   DWORD productVersionMS; ///< product version; most significant 32 bits
+   DWORD productVersionLS; ///< product version; least significant 32 bits
+   DWORD fileFlagsMask;    ///< valid bits in file flags
+   DWORD fileFlags;        ///< file flags; VS_FF_* values
+   DWORD fileOS;           ///< operating system; VOS_* values
+   DWORD fileType;         ///< file type; VFT_* values
+   DWORD fileSubtype;      ///< file subtype; VFT2_* values
+   DWORD fileDateMS;       ///< file date; most significant 32 bits
+   DWORD fileDateLS;       ///< file date; least significant 32 bits
+};
+
+/// \brief Module, stored in a ModuleListStream
+/// The struct corresponds with minidumpapiset.h's MINIDUMP_MODULE struct.
+struct MinidumpModuleEntry
+{
+   ULONGLONG baseOfImage;                 ///< base address of the loaded module
+   DWORD sizeOfImage;                     ///< size of the loaded module
+   DWORD checksum;                        ///< checksum of the module image
+   DWORD timeDateStamp;                   ///< time stamp of the module image, in time_t format
+   DWORD moduleNameRva;                   ///< file offset of the module name; MINIDUMP_STRING
+   MinidumpFixedFileInfo versionInfo;     ///< version information
+   MinidumpLocationDescriptor cvRecord;   ///< CodeView record, e.g. the PDB path
+   MinidumpLocationDescriptor miscRecord; ///< IMAGE_DEBUG_MISC record
+   ULONGLONG reserved0;                   ///< reserved
+   ULONGLONG reserved1;                   ///< reserved
+};
+
+/// \brief Exception record
+/// The struct corresponds with minidumpapiset.h's MINIDUMP_EXCEPTION struct.
+struct MinidumpException
+{
+   DWORD exceptionCode;                ///< exception code; e.g. EXCEPTION_ACCESS_VIOLATION
+   DWORD exceptionFlags;               ///< exception flags
+   ULONGLONG exceptionRecord;          ///< address of a chained exception record
+   ULONGLONG exceptionAddress;         ///< address where the exception occurred
+   DWORD numberParameters;             ///< number of valid exception information entries
+   DWORD unusedAlignment;              ///< alignment
+   ULONGLONG exceptionInformation[15]; ///< exception specific parameters
+};
+
+/// \brief Exception stream
+/// The struct corresponds with minidumpapiset.h's MINIDUMP_EXCEPTION_STREAM struct.
+struct MinidumpExceptionStream
+{
+   DWORD threadId;                           ///< ID of the thread that caused the exception
+   DWORD alignment;                          ///< alignment
+   MinidumpException exceptionRecord;        ///< exception record
+   MinidumpLocationDescriptor threadContext; ///< CPU specific thread context
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(MinidumpHeader) == 32, "Minidump header must be 32 bytes long");
+static_assert(sizeof(MinidumpDirectory) == 12, "Minidump directory must be 12 bytes long");
+static_assert(sizeof(MinidumpMemoryDescriptor) == 16, "Minidump memory descriptor must be 16 bytes long");
+static_assert(sizeof(MinidumpMemoryDescriptor64) == 16, "Minidump memory descriptor 64 must be 16 bytes long");
+static_assert(sizeof(MinidumpThread) == 48, "Minidump thread must be 48 bytes long");
+static_assert(sizeof(MinidumpModuleEntry) == 108, "Minidump module must be 108 bytes long");
+static_assert(sizeof(MinidumpExceptionStream) == 168, "Minidump exception stream must be 168 bytes long");
+
+/// minidump header signature; "MDMP"
+constexpr DWORD c_minidumpSignature = 0x504d444d;
+
+/// minidump version, stored in the low word of the header version
+constexpr WORD c_minidumpVersion = 0xa793;
+
+/// ThreadListStream stream type
+constexpr DWORD c_minidumpStreamThreadList = 3;
+
+/// ModuleListStream stream type
+constexpr DWORD c_minidumpStreamModuleList = 4;
+
+/// MemoryListStream stream type
+constexpr DWORD c_minidumpStreamMemoryList = 5;
+
+/// ExceptionStream stream type
+constexpr DWORD c_minidumpStreamException = 6;
+
+/// Memory64ListStream stream type
+constexpr DWORD c_minidumpStreamMemory64List = 9;
+
+/// mapping of minidump stream types to display text
+extern const std::map<DWORD, LPCTSTR> g_mapMinidumpStreamTypeToDisplayText;
+
+/// mapping of minidump type flags to display text
+extern const std::map<DWORD, LPCTSTR> g_mapMinidumpTypeFlagsToDisplayText;
+
+/// mapping of common exception codes to display text
+extern const std::map<DWORD, LPCTSTR> g_mapMinidumpExceptionCodeToDisplayText;
+
+/// struct definition for above minidump header
+extern const StructDefinition g_definitionMinidumpHeader;
+
+/// struct definition for above minidump thread
+extern const StructDefinition g_definitionMinidumpThread;
+
+/// struct definition for above minidump module
+extern const StructDefinition g_definitionMinidumpModule;
+
+/// struct definition for above minidump exception stream
+extern const StructDefinition g_definitionMinidumpExceptionStream;
@@ -0,0 +1,35 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MinidumpModule.cpp
+/// \brief module to load minidump files
+//
+#include "stdafx.h"
+#include "MinidumpModule.hpp"
+#include "MinidumpReader.hpp"
+
+CString MinidumpModule::DisplayName() const
+{
+   return CString{ "Minidump module" };
+}
+
+ModuleIconID MinidumpModule::IconID() const
+{
+   return ModuleIconID::moduleApp;
+}
+
+CString MinidumpModule::FilterStrings() const
+{
+   return CString{ "Minidump files (*.dmp;*.mdmp)|*.dmp;*.mdmp|" };
+}
+
+bool MinidumpModule::IsModuleApplicableForFile(const File& file) const
+{
+   return MinidumpReader::IsMinidumpFile(file);
+}
+
+std::shared_ptr<IReader> MinidumpModule::OpenReader(const File& file) const
+{
+   return std::make_shared<MinidumpReader>(file);
+}
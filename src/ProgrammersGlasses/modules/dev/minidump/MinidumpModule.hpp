@@ -0,0 +1,27 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MinidumpModule.hpp
+/// \brief module to load minidump files
+//
+#pragma once
+
+#include "modules/IModule.hpp"
+
+/// \brief Minidump module
+/// \details module to load minidump files, as written by MiniDumpWriteDump(),
+/// from small minidumps up to full memory dumps
+class MinidumpModule : public IModule
+{
+public:
+   /// ctor
+   MinidumpModule() = default;
+
+   // Inherited via IModule
+   CString DisplayName() const override;
+   ModuleIconID IconID() const override;
+   CString FilterStrings() const override;
+   bool IsModuleApplicableForFile(const File& file) const override;
+   std::shared_ptr<IReader> OpenReader(const File& file) const override;
+};
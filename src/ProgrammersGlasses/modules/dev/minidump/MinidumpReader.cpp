@@ -0,0 +1,477 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MinidumpReader.cpp
+/// \brief reader for minidump files
+//
+#include "stdafx.h"
+#include "MinidumpReader.hpp"
+#include "Minidump.hpp"
+#include "modules/CodeTextViewNode.hpp"
+#include "modules/FilterSortListViewNode.hpp"
+#include "modules/StructListViewNode.hpp"
+#include "modules/HexDataViewNode.hpp"
+#include "modules/DisplayFormatHelper.hpp"
+
+/// number of bytes shown around the exception address
+constexpr size_t c_exceptionMemorySize = 256;
+
+/// \brief Formats a version number from the most and least significant parts
+static CString FormatVersion(DWORD versionMS, DWORD versionLS)
+{
+   CString text;
+   text.Format(_T("%u.%u.%u.%u"),
+      HIWORD(versionMS), LOWORD(versionMS),
+      HIWORD(versionLS), LOWORD(versionLS));
+
+   return text;
+}
+
+bool MinidumpReader::IsMinidumpFile(const File& file)
+{
+   return Minidump::IsMinidumpFile(file);
+}
+
+MinidumpReader::MinidumpReader(const File& file)
+   :m_file(file)
+{
+}
+
+void MinidumpReader::Load()
+{
+   auto rootNode = std::make_shared<CodeTextViewNode>(
+      _T("Summary"),
+      NodeTreeIconID::nodeTreeIconDocument);
+
+   m_rootNode = rootNode;
+
+   CString summaryText;
+   summaryText.Append(_T("Minidump file: ") + m_file.Filename() + _T("\n\n"));
+   summaryText.Append(_T("Summary:\n"));
+
+   m_minidump = std::make_shared<Minidump>(m_file);
+
+   if (!m_minidump->IsValid())
+   {
+      summaryText.Append(_T("Error: ") + m_minidump->GetErrorText() + _T("\n"));
+      rootNode->SetText(summaryText);
+      return;
+   }
+
+   const MinidumpHeader& header = m_minidump->Header();
+
+   summaryText.AppendFormat(_T("Created: %s\n"),
+      DisplayFormatHelper::FormatDateTime(header.timeDateStamp).GetString());
+
+   summaryText.AppendFormat(_T("Dump type: %s\n"),
+      DisplayFormatHelper::FormatBitFlagsFromMap(
+         g_mapMinidumpTypeFlagsToDisplayText,
+         static_cast<DWORD>(header.flags)).GetString());
+
+   summaryText.AppendFormat(_T("Number of streams: %u\n"), header.numberOfStreams);
+
+   rootNode->ChildNodes().push_back(
+      std::make_shared<StructListViewNode>(
+         _T("Minidump header"),
+         NodeTreeIconID::nodeTreeIconBinary,
+         g_definitionMinidumpHeader,
+         &header,
+         m_file.Data()));
+
+   AddStreamDirectoryNode(*rootNode);
+   AddThreadListNode(*rootNode, summaryText);
+   AddModuleListNode(*rootNode, summaryText);
+   AddExceptionNode(*rootNode, summaryText);
+   AddMemoryRangesNode(*rootNode, summaryText);
+
+   if (!m_minidump->GetErrorText().IsEmpty())
+   {
+      CString errorText = m_minidump->GetErrorText();
+      errorText.Replace(_T("\n"), _T("\nError: "));
+
+      summaryText.Append(_T("Error: ") + errorText + _T("\n"));
+   }
+
+   rootNode->SetText(summaryText);
+}
+
+void MinidumpReader::Cleanup()
+{
+   // nothing expensive to cleanup here
+}
+
+void MinidumpReader::AddStreamDirectoryNode(StaticNode& rootNode)
+{
+   std::vector<std::vector<CString>> streamData;
+
+   for (const MinidumpStream& stream : m_minidump->Streams())
+   {
+      CString indexText;
+      indexText.Format(_T("%zu"), stream.index);
+
+      CString streamTypeText;
+      streamTypeText.Format(_T("%u"), stream.streamType);
+
+      CString rvaText;
+      rvaText.Format(_T("0x%08x"), stream.rva);
+
+      CString sizeText;
+      sizeText.Format(_T("0x%08x"), stream.dataSize);
+
+      streamData.push_back(
+         std::vector<CString> {
+            indexText,
+            streamTypeText,
+            GetValueFromMapOrDefault<DWORD>(
+               g_mapMinidumpStreamTypeToDisplayText, stream.streamType, _T("unknown")),
+            rvaText,
+            sizeText,
+         });
+   }
+
+   static std::vector<CString> streamColumnNames
+   {
+      _T("Index"),
+      _T("Stream type"),
+      _T("Stream name"),
+      _T("File offset"),
+      _T("Size"),
+   };
+
+   rootNode.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Stream directory"),
+         NodeTreeIconID::nodeTreeIconTable,
+         streamColumnNames,
+         streamData,
+         false));
+}
+
+void MinidumpReader::AddThreadListNode(StaticNode& rootNode, CString& summaryText)
+{
+   const std::vector<const MinidumpThread*>& threads = m_minidump->Threads();
+   if (threads.empty())
+      return;
+
+   summaryText.AppendFormat(_T("Number of threads: %zu\n"), threads.size());
+
+   std::vector<std::vector<CString>> threadData;
+   std::vector<std::shared_ptr<INode>> threadNodes;
+
+   for (size_t threadIndex = 0; threadIndex < threads.size(); threadIndex++)
+   {
+      const MinidumpThread& thread = *threads[threadIndex];
+
+      CString indexText;
+      indexText.Format(_T("%zu"), threadIndex);
+
+      CString threadIdText;
+      threadIdText.Format(_T("0x%04x"), thread.threadId);
+
+      CString tebText;
+      tebText.Format(_T("0x%016llx"), thread.teb);
+
+      CString stackStartText;
+      stackStartText.Format(_T("0x%016llx"), thread.stack.startOfMemoryRange);
+
+      CString stackSizeText;
+      stackSizeText.Format(_T("0x%08x"), thread.stack.memory.dataSize);
+
+      CString suspendCountText;
+      suspendCountText.Format(_T("%u"), thread.suspendCount);
+
+      CString priorityText;
+      priorityText.Format(_T("%u"), thread.priority);
+
+      threadData.push_back(
+         std::vector<CString> {
+            indexText,
+            threadIdText,
+            tebText,
+            stackStartText,
+            stackSizeText,
+            suspendCountText,
+            priorityText,
+         });
+
+      auto threadNode = std::make_shared<CodeTextViewNode>(
+         _T("Thread [") + indexText + _T("] ") + threadIdText,
+         NodeTreeIconID::nodeTreeIconObject);
+
+      CString threadText;
+      threadText.Format(_T("Thread ID: %s\nTEB: %s\nStack: %s, size %s\n"),
+         threadIdText.GetString(),
+         tebText.GetString(),
+         stackStartText.GetString(),
+         stackSizeText.GetString());
+
+      threadNode->ChildNodes().push_back(
+         std::make_shared<StructListViewNode>(
+            _T("Thread entry"),
+            NodeTreeIconID::nodeTreeIconBinary,
+            g_definitionMinidumpThread,
+            &thread,
+            m_file.Data()));
+
+      if (m_minidump->Data(thread.stack.memory.rva, thread.stack.memory.dataSize) != nullptr)
+      {
+         threadNode->ChildNodes().push_back(
+            std::make_shared<HexDataViewNode>(
+               _T("Stack memory"),
+               NodeTreeIconID::nodeTreeIconBinary,
+               m_file,
+               thread.stack.memory.rva,
+               thread.stack.memory.dataSize));
+      }
+      else
+         threadText.Append(_T("Error: Stack memory is outside of the file\n"));
+
+      threadNode->SetText(threadText);
+
+      threadNodes.push_back(threadNode);
+   }
+
+   static std::vector<CString> threadColumnNames
+   {
+      _T("Index"),
+      _T("Thread ID"),
+      _T("TEB"),
+      _T("Stack start"),
+      _T("Stack size"),
+      _T("Suspend count"),
+      _T("Priority"),
+   };
+
+   auto threadTableNode = std::make_shared<FilterSortListViewNode>(
+      _T("Threads"),
+      NodeTreeIconID::nodeTreeIconTable,
+      threadColumnNames,
+      threadData,
+      true);
+
+   threadTableNode->ChildNodes().swap(threadNodes);
+
+   rootNode.ChildNodes().push_back(threadTableNode);
+}
+
+void MinidumpReader::AddModuleListNode(StaticNode& rootNode, CString& summaryText)
+{
+   const std::vector<MinidumpModuleInfo>& modules = m_minidump->Modules();
+   if (modules.empty())
+      return;
+
+   summaryText.AppendFormat(_T("Number of modules: %zu\n"), modules.size());
+
+   std::vector<std::vector<CString>> moduleData;
+   std::vector<std::shared_ptr<INode>> moduleNodes;
+
+   for (const MinidumpModuleInfo& moduleInfo : modules)
+   {
+      const MinidumpModuleEntry& moduleEntry = *moduleInfo.module;
+
+      CString indexText;
+      indexText.Format(_T("%zu"), moduleInfo.index);
+
+      CString baseText;
+      baseText.Format(_T("0x%016llx"), moduleEntry.baseOfImage);
+
+      CString endText;
+      endText.Format(_T("0x%016llx"), moduleEntry.baseOfImage + moduleEntry.sizeOfImage);
+
+      CString sizeText;
+      sizeText.Format(_T("0x%08x"), moduleEntry.sizeOfImage);
+
+      CString versionText;
+      if (moduleEntry.versionInfo.signature != 0)
+         versionText = FormatVersion(
+            moduleEntry.versionInfo.fileVersionMS,
+            moduleEntry.versionInfo.fileVersionLS);
+
+      moduleData.push_back(
+         std::vector<CString> {
+            indexText,
+            moduleInfo.name,
+            baseText,
+            endText,
+            sizeText,
+            DisplayFormatHelper::FormatDateTime(moduleEntry.timeDateStamp),
+            versionText,
+         });
+
+      int pos = moduleInfo.name.ReverseFind(_T('\\'));
+
+      moduleNodes.push_back(
+         std::make_shared<StructListViewNode>(
+            _T("Module [") + indexText + _T("] ") + moduleInfo.name.Mid(pos + 1),
+            NodeTreeIconID::nodeTreeIconLibrary,
+            g_definitionMinidumpModule,
+            &moduleEntry,
+            m_file.Data()));
+   }
+
+   static std::vector<CString> moduleColumnNames
+   {
+      _T("Index"),
+      _T("Name"),
+      _T("Base address"),
+      _T("End address"),
+      _T("Size"),
+      _T("Time stamp"),
+      _T("File version"),
+   };
+
+   auto moduleTableNode = std::make_shared<FilterSortListViewNode>(
+      _T("Modules"),
+      NodeTreeIconID::nodeTreeIconTable,
+      moduleColumnNames,
+      moduleData,
+      true);
+
+   moduleTableNode->ChildNodes().swap(moduleNodes);
+
+   rootNode.ChildNodes().push_back(moduleTableNode);
+}
+
+void MinidumpReader::AddExceptionNode(StaticNode& rootNode, CString& summaryText)
+{
+   const MinidumpExceptionStream* exceptionStream = m_minidump->ExceptionStream();
+   if (exceptionStream == nullptr)
+      return;
+
+   const MinidumpException& exceptionRecord = exceptionStream->exceptionRecord;
+
+   CString exceptionCodeText;
+   exceptionCodeText.Format(_T("0x%08x %s"),
+      exceptionRecord.exceptionCode,
+      GetValueFromMapOrDefault<DWORD>(
+         g_mapMinidumpExceptionCodeToDisplayText, exceptionRecord.exceptionCode, _T("")));
+   exceptionCodeText.TrimRight();
+
+   CString exceptionText;
+   exceptionText.AppendFormat(_T("Exception code: %s\n"), exceptionCodeText.GetString());
+   exceptionText.AppendFormat(_T("Exception address: 0x%016llx\n"), exceptionRecord.exceptionAddress);
+   exceptionText.AppendFormat(_T("Thread ID: 0x%04x\n"), exceptionStream->threadId);
+
+   const MinidumpModuleInfo* moduleInfo = m_minidump->FindModuleByAddress(exceptionRecord.exceptionAddress);
+   if (moduleInfo != nullptr)
+   {
+      exceptionText.AppendFormat(_T("Module: %s+0x%llx\n"),
+         moduleInfo->name.GetString(),
+         exceptionRecord.exceptionAddress - moduleInfo->module->baseOfImage);
+   }
+
+   for (DWORD parameterIndex = 0;
+      parameterIndex < exceptionRecord.numberParameters &&
+      parameterIndex < std::size(exceptionRecord.exceptionInformation);
+      parameterIndex++)
+   {
+      exceptionText.AppendFormat(_T("Parameter [%u]: 0x%016llx\n"),
+         parameterIndex,
+         exceptionRecord.exceptionInformation[parameterIndex]);
+   }
+
+   summaryText.AppendFormat(_T("Exception %s at address 0x%016llx\n"),
+      exceptionCodeText.GetString(),
+      exceptionRecord.exceptionAddress);
+
+   auto exceptionNode = std::make_shared<CodeTextViewNode>(
+      _T("Exception"),
+      NodeTreeIconID::nodeTreeIconDocument);
+
+   exceptionNode->ChildNodes().push_back(
+      std::make_shared<StructListViewNode>(
+         _T("Exception stream"),
+         NodeTreeIconID::nodeTreeIconBinary,
+         g_definitionMinidumpExceptionStream,
+         exceptionStream,
+         m_file.Data()));
+
+   // show the captured memory starting at the exception address, up to the
+   // end of the memory range containing it
+   const MinidumpMemoryRange* range = m_minidump->FindMemoryRange(exceptionRecord.exceptionAddress);
+   if (range != nullptr)
+   {
+      ULONGLONG offsetInRange = exceptionRecord.exceptionAddress - range->startAddress;
+      size_t memorySize = static_cast<size_t>(
+         std::min<ULONGLONG>(c_exceptionMemorySize, range->size - offsetInRange));
+
+      exceptionNode->ChildNodes().push_back(
+         std::make_shared<HexDataViewNode>(
+            _T("Memory at exception address"),
+            NodeTreeIconID::nodeTreeIconBinary,
+            m_file,
+            static_cast<size_t>(range->fileOffset + offsetInRange),
+            memorySize));
+   }
+   else
+      exceptionText.Append(_T("Memory at exception address wasn't captured\n"));
+
+   exceptionNode->SetText(exceptionText);
+
+   rootNode.ChildNodes().push_back(exceptionNode);
+}
+
+void MinidumpReader::AddMemoryRangesNode(StaticNode& rootNode, CString& summaryText)
+{
+   const std::vector<MinidumpMemoryRange>& memoryRanges = m_minidump->MemoryRanges();
+   if (memoryRanges.empty())
+      return;
+
+   ULONGLONG totalSize = 0;
+   for (const MinidumpMemoryRange& range : memoryRanges)
+      totalSize += range.size;
+
+   summaryText.AppendFormat(_T("Number of captured memory ranges: %zu, total size 0x%llx\n"),
+      memoryRanges.size(),
+      totalSize);
+
+   static std::vector<CString> memoryRangeColumnNames
+   {
+      _T("Start address"),
+      _T("End address"),
+      _T("Size"),
+      _T("File offset"),
+      _T("Stream"),
+      _T("Module"),
+   };
+
+   // full memory dumps can contain many thousand memory ranges, so format
+   // the rows only when the node is shown
+   std::shared_ptr<Minidump> minidump = m_minidump;
+
+   rootNode.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Memory ranges"),
+         NodeTreeIconID::nodeTreeIconTable,
+         memoryRangeColumnNames,
+         memoryRanges.size(),
+         [minidump](size_t rowIndex)
+         {
+            const MinidumpMemoryRange& range = minidump->MemoryRanges()[rowIndex];
+
+            CString startText;
+            startText.Format(_T("0x%016llx"), range.startAddress);
+
+            CString endText;
+            endText.Format(_T("0x%016llx"), range.startAddress + range.size);
+
+            CString sizeText;
+            sizeText.Format(_T("0x%08llx"), range.size);
+
+            CString fileOffsetText;
+            fileOffsetText.Format(_T("0x%08llx"), range.fileOffset);
+
+            const MinidumpModuleInfo* moduleInfo = minidump->FindModuleByAddress(range.startAddress);
+
+            return std::vector<CString> {
+               startText,
+               endText,
+               sizeText,
+               fileOffsetText,
+               range.isMemory64 ? _T("Memory64List") : _T("MemoryList"),
+               moduleInfo != nullptr ? moduleInfo->name : CString{},
+            };
+         },
+         true));
+}
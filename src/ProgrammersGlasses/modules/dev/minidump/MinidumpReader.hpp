@@ -0,0 +1,64 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MinidumpReader.hpp
+/// \brief reader for minidump files
+//
+#pragma once
+
+#include "modules/IReader.hpp"
+
+class StaticNode;
+class Minidump;
+
+/// Minidump file reader
+class MinidumpReader : public IReader
+{
+public:
+   /// determines if the given file is a minidump file
+   static bool IsMinidumpFile(const File& file);
+
+   /// ctor
+   explicit MinidumpReader(const File& file);
+
+   // Inherited via IReader
+   const CString& Filename() const override
+   {
+      return m_file.Filename();
+   }
+
+   std::shared_ptr<INode> RootNode() const override
+   {
+      return m_rootNode;
+   }
+
+   void Load() override;
+   void Cleanup() override;
+
+private:
+   /// adds stream directory node
+   void AddStreamDirectoryNode(StaticNode& rootNode);
+
+   /// adds thread list node
+   void AddThreadListNode(StaticNode& rootNode, CString& summaryText);
+
+   /// adds module list node
+   void AddModuleListNode(StaticNode& rootNode, CString& summaryText);
+
+   /// adds exception node
+   void AddExceptionNode(StaticNode& rootNode, CString& summaryText);
+
+   /// adds memory ranges node, listing the memory range index
+   void AddMemoryRangesNode(StaticNode& rootNode, CString& summaryText);
+
+private:
+   /// file to read from
+   File m_file;
+
+   /// minidump; shared with nodes that format their rows lazily
+   std::shared_ptr<Minidump> m_minidump;
+
+   /// root node
+   std::shared_ptr<INode> m_rootNode;
+};
@@ -0,0 +1,235 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MsfFile.cpp
+/// \brief MSF (multi-stream file) container, as used by PDB files
+//
+#include "stdafx.h"
+#include "MsfFile.hpp"
+
+/// stream size value for nil streams
+constexpr DWORD c_msfNilStreamSize = 0xffffffff;
+
+/// smallest MSF block size
+constexpr DWORD c_msfMinBlockSize = 512;
+
+/// largest MSF block size, e.g. set with /PDBPAGESIZE:32768
+constexpr DWORD c_msfMaxBlockSize = 32768;
+
+/// \brief Returns the number of pages needed to store the given number of bytes
+static size_t GetPageCount(size_t size, DWORD blockSize)
+{
+   return (size + blockSize - 1) / blockSize;
+}
+
+MsfStream::MsfStream(const File& file, DWORD blockSize, DWORD streamSize, std::vector<DWORD>&& pageNumbers)
+   :m_file(file),
+   m_blockSize(blockSize),
+   m_streamSize(streamSize),
+   m_pageNumbers(std::move(pageNumbers))
+{
+}
+
+bool MsfStream::Read(size_t offset, size_t size, void* buffer) const
+{
+   if (offset > m_streamSize ||
+      size > m_streamSize - offset)
+      return false;
+
+   BYTE* destination = reinterpret_cast<BYTE*>(buffer);
+
+   while (size > 0)
+   {
+      size_t pageIndex = offset / m_blockSize;
+      size_t offsetInPage = offset % m_blockSize;
+      size_t chunkSize = std::min(size, m_blockSize - offsetInPage);
+
+      if (pageIndex >= m_pageNumbers.size())
+         return false;
+
+      ULONGLONG fileOffset = static_cast<ULONGLONG>(m_pageNumbers[pageIndex]) * m_blockSize + offsetInPage;
+      if (fileOffset > m_file.Size() ||
+         chunkSize > m_file.Size() - fileOffset)
+         return false;
+
+      memcpy(destination, m_file.Data<BYTE>(static_cast<size_t>(fileOffset)), chunkSize);
+
+      destination += chunkSize;
+      offset += chunkSize;
+      size -= chunkSize;
+   }
+
+   return true;
+}
+
+std::shared_ptr<const std::vector<BYTE>> MsfStream::ReadRange(size_t offset, size_t size) const
+{
+   auto data = std::make_shared<std::vector<BYTE>>(size);
+
+   if (!Read(offset, size, data->data()))
+      return nullptr;
+
+   return data;
+}
+
+bool MsfStream::ReadString(size_t offset, size_t maxLength, CStringA& text) const
+{
+   text.Empty();
+
+   // read page-wise chunks, so that long strings are assembled without
+   // reading byte by byte
+   while (offset < m_streamSize && static_cast<size_t>(text.GetLength()) < maxLength)
+   {
+      size_t chunkSize = std::min(m_blockSize - offset % m_blockSize, m_streamSize - offset);
+
+      const BYTE* chunk = DirectData(offset, chunkSize);
+      if (chunk == nullptr)
+         return false;
+
+      const CHAR* chunkText = reinterpret_cast<const CHAR*>(chunk);
+      size_t length = strnlen(chunkText, chunkSize);
+
+      text.Append(chunkText, static_cast<int>(length));
+
+      if (length < chunkSize)
+         return static_cast<size_t>(text.GetLength()) <= maxLength;
+
+      offset += chunkSize;
+   }
+
+   return false;
+}
+
+const BYTE* MsfStream::DirectData(size_t offset, size_t size) const
+{
+   if (offset > m_streamSize ||
+      size > m_streamSize - offset)
+      return nullptr;
+
+   size_t pageIndex = offset / m_blockSize;
+   size_t offsetInPage = offset % m_blockSize;
+
+   if (pageIndex >= m_pageNumbers.size() ||
+      size > m_blockSize - offsetInPage)
+      return nullptr;
+
+   ULONGLONG fileOffset = static_cast<ULONGLONG>(m_pageNumbers[pageIndex]) * m_blockSize + offsetInPage;
+   if (fileOffset > m_file.Size() ||
+      size > m_file.Size() - fileOffset)
+      return nullptr;
+
+   return m_file.Data<BYTE>(static_cast<size_t>(fileOffset));
+}
+
+bool MsfFile::IsMsfFile(const File& file)
+{
+   return file.Size() >= sizeof(MsfSuperBlock) &&
+      memcmp(file.Data<MsfSuperBlock>()->fileMagic, c_msfFileMagic, sizeof(MsfSuperBlock::fileMagic)) == 0;
+}
+
+MsfFile::MsfFile(const File& file)
+   :m_file(file)
+{
+   if (!IsMsfFile(m_file))
+   {
+      m_errorText = _T("Invalid MSF file magic");
+      return;
+   }
+
+   m_isValid = ReadStreamDirectory();
+}
+
+bool MsfFile::IsStreamPresent(size_t streamIndex) const
+{
+   return streamIndex < m_streams.size() &&
+      !m_nilStreams[streamIndex];
+}
+
+bool MsfFile::ReadStreamDirectory()
+{
+   const MsfSuperBlock& superBlock = SuperBlock();
+
+   // PDBs larger than 4 GB use larger pages, set with /PDBPAGESIZE
+   DWORD blockSize = superBlock.blockSize;
+   if (blockSize < c_msfMinBlockSize ||
+      blockSize > c_msfMaxBlockSize ||
+      (blockSize & (blockSize - 1)) != 0)
+   {
+      m_errorText.Format(_T("Invalid block size %u"), blockSize);
+      return false;
+   }
+
+   if (static_cast<ULONGLONG>(superBlock.numBlocks) * blockSize > m_file.Size())
+   {
+      m_errorText.Format(_T("Number of blocks %u exceeds the file size"), superBlock.numBlocks);
+      return false;
+   }
+
+   // the block map lists the pages of the stream directory
+   size_t directoryPageCount = GetPageCount(superBlock.numDirectoryBytes, blockSize);
+   ULONGLONG blockMapOffset = static_cast<ULONGLONG>(superBlock.blockMapAddr) * blockSize;
+
+   if (directoryPageCount * sizeof(DWORD) > blockSize ||
+      blockMapOffset > m_file.Size() ||
+      directoryPageCount * sizeof(DWORD) > m_file.Size() - blockMapOffset)
+   {
+      m_errorText = _T("Block map is outside of the file");
+      return false;
+   }
+
+   const DWORD* blockMap = m_file.Data<DWORD>(static_cast<size_t>(blockMapOffset));
+
+   MsfStream directory{
+      m_file,
+      blockSize,
+      superBlock.numDirectoryBytes,
+      std::vector<DWORD>(blockMap, blockMap + directoryPageCount) };
+
+   DWORD numStreams = 0;
+   if (!directory.ReadValue(0, numStreams) ||
+      numStreams > (directory.Size() - sizeof(DWORD)) / sizeof(DWORD))
+   {
+      m_errorText = _T("Invalid number of streams in stream directory");
+      return false;
+   }
+
+   std::vector<DWORD> streamSizes(numStreams);
+   if (!directory.Read(sizeof(DWORD), numStreams * sizeof(DWORD), streamSizes.data()))
+   {
+      m_errorText = _T("Stream directory is outside of the file");
+      return false;
+   }
+
+   size_t pageNumbersOffset = sizeof(DWORD) + numStreams * sizeof(DWORD);
+
+   m_streams.reserve(numStreams);
+   m_nilStreams.reserve(numStreams);
+
+   for (DWORD streamIndex = 0; streamIndex < numStreams; streamIndex++)
+   {
+      bool isNilStream = streamSizes[streamIndex] == c_msfNilStreamSize;
+      DWORD streamSize = isNilStream ? 0 : streamSizes[streamIndex];
+
+      size_t pageCount = GetPageCount(streamSize, blockSize);
+      if (pageCount > (directory.Size() - pageNumbersOffset) / sizeof(DWORD))
+      {
+         m_errorText.Format(_T("Page numbers of stream %u are outside of the stream directory"), streamIndex);
+         return false;
+      }
+
+      std::vector<DWORD> pageNumbers(pageCount);
+      if (!directory.Read(pageNumbersOffset, pageCount * sizeof(DWORD), pageNumbers.data()))
+      {
+         m_errorText.Format(_T("Page numbers of stream %u are outside of the stream directory"), streamIndex);
+         return false;
+      }
+
+      pageNumbersOffset += pageCount * sizeof(DWORD);
+
+      m_streams.emplace_back(m_file, blockSize, streamSize, std::move(pageNumbers));
+      m_nilStreams.push_back(isNilStream);
+   }
+
+   return true;
+}
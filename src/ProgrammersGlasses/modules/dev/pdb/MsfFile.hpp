@@ -0,0 +1,119 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file MsfFile.hpp
+/// \brief MSF (multi-stream file) container, as used by PDB files
+//
+#pragma once
+
+#include "PdbHeader.hpp"
+#include "File.hpp"
+
+/// \brief Single stream of an MSF file
+/// \details The stream data is scattered over pages (blocks) in the file. The
+/// stream only stores the page numbers; the data is reassembled on each
+/// access, and only for the requested range, so that streams of large PDB
+/// files never have to be copied as a whole.
+class MsfStream
+{
+public:
+   /// ctor
+   MsfStream(const File& file, DWORD blockSize, DWORD streamSize, std::vector<DWORD>&& pageNumbers);
+
+   /// returns the stream size
+   size_t Size() const { return m_streamSize; }
+
+   /// returns the page numbers of all pages of the stream
+   const std::vector<DWORD>& PageNumbers() const { return m_pageNumbers; }
+
+   /// reads data from the stream into the buffer; returns false when the
+   /// range is outside of the stream, or a page is outside of the file
+   bool Read(size_t offset, size_t size, void* buffer) const;
+
+   /// reads a value from the stream; returns false when the value is outside
+   /// of the stream
+   template <typename T>
+   bool ReadValue(size_t offset, T& value) const
+   {
+      return Read(offset, sizeof(T), &value);
+   }
+
+   /// reads a range of the stream into a new buffer; returns nullptr when
+   /// the range is outside of the stream
+   std::shared_ptr<const std::vector<BYTE>> ReadRange(size_t offset, size_t size) const;
+
+   /// reads a zero-terminated string from the stream; returns false when the
+   /// string isn't terminated before the end of the stream or the max. length
+   bool ReadString(size_t offset, size_t maxLength, CStringA& text) const;
+
+   /// returns a pointer to the stream data in the mapped file, when the
+   /// range lies completely inside a single page; returns nullptr otherwise
+   const BYTE* DirectData(size_t offset, size_t size) const;
+
+private:
+   /// file containing the stream pages
+   const File& m_file;
+
+   /// page size
+   DWORD m_blockSize;
+
+   /// stream size
+   size_t m_streamSize;
+
+   /// page numbers of the stream pages, in stream order
+   std::vector<DWORD> m_pageNumbers;
+};
+
+/// \brief MSF (multi-stream file) container
+/// \details Reads the superblock and the stream directory, and builds the
+/// page number index of all streams. The stream directory itself is read
+/// through its own page list, as given by the block map.
+class MsfFile
+{
+public:
+   /// returns if the file starts with the MSF 7.00 magic
+   static bool IsMsfFile(const File& file);
+
+   /// ctor; reads the stream directory
+   explicit MsfFile(const File& file);
+
+   /// returns if the superblock and the stream directory are valid
+   bool IsValid() const { return m_isValid; }
+
+   /// returns an error text, when the file is invalid
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the superblock
+   const MsfSuperBlock& SuperBlock() const { return *m_file.Data<MsfSuperBlock>(); }
+
+   /// returns the number of streams
+   size_t StreamCount() const { return m_streams.size(); }
+
+   /// returns if the stream with given index exists and isn't a nil stream
+   bool IsStreamPresent(size_t streamIndex) const;
+
+   /// returns stream by index; the stream index must be valid; nil streams
+   /// are returned as empty streams
+   const MsfStream& Stream(size_t streamIndex) const { return m_streams[streamIndex]; }
+
+private:
+   /// reads the stream directory
+   bool ReadStreamDirectory();
+
+private:
+   /// file
+   const File& m_file;
+
+   /// indicates if the file is valid
+   bool m_isValid = false;
+
+   /// error text
+   CString m_errorText;
+
+   /// all streams
+   std::vector<MsfStream> m_streams;
+
+   /// indicates for each stream if it's a nil stream, with size 0xffffffff
+   std::vector<bool> m_nilStreams;
+};
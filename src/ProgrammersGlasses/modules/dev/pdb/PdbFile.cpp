@@ -0,0 +1,416 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file PdbFile.cpp
+/// \brief PDB (program database) file, with the well-known streams decoded
+//
+#include "stdafx.h"
+#include "PdbFile.hpp"
+
+/// max. length of names stored in PDB streams
+constexpr size_t c_maxPdbNameLength = 0x10000;
+
+/// \brief Reads a zero-terminated UTF-8 string from a buffer
+static CString ReadBufferString(const std::vector<BYTE>& buffer, size_t offset)
+{
+   if (offset >= buffer.size())
+      return CString{};
+
+   const CHAR* text = reinterpret_cast<const CHAR*>(buffer.data() + offset);
+   size_t length = strnlen(text, buffer.size() - offset);
+
+   return CString(CA2T(CStringA(text, static_cast<int>(length)), CP_UTF8));
+}
+
+/// \brief Reads a little-endian value from a buffer; returns false when the
+/// value is outside of the buffer
+template <typename T>
+static bool ReadBufferValue(const std::vector<BYTE>& buffer, size_t offset, T& value)
+{
+   if (offset > buffer.size() ||
+      sizeof(T) > buffer.size() - offset)
+      return false;
+
+   memcpy(&value, buffer.data() + offset, sizeof(T));
+   return true;
+}
+
+/// \brief Returns the size of a CodeView numeric leaf, as used by S_CONSTANT
+static size_t GetNumericLeafSize(WORD leaf)
+{
+   if (leaf < 0x8000)
+      return sizeof(WORD); // value is stored in the leaf itself
+
+   switch (leaf)
+   {
+   case 0x8000: return sizeof(WORD) + 1; // LF_CHAR
+   case 0x8001: // LF_SHORT
+   case 0x8002: return sizeof(WORD) + 2; // LF_USHORT
+   case 0x8003: // LF_LONG
+   case 0x8004: return sizeof(WORD) + 4; // LF_ULONG
+   case 0x8009: // LF_QUADWORD
+   case 0x800a: return sizeof(WORD) + 8; // LF_UQUADWORD
+   default:
+      return 0; // unsupported leaf
+   }
+}
+
+bool PdbFile::IsPdbFile(const File& file)
+{
+   return MsfFile::IsMsfFile(file);
+}
+
+PdbFile::PdbFile(const File& file)
+   :m_msf(file)
+{
+   if (!m_msf.IsValid())
+      return;
+
+   m_streamNames.resize(m_msf.StreamCount());
+
+   SetStreamName(0, _T("Old stream directory"));
+   SetStreamName(c_pdbStreamIndexPdbInfo, _T("PDB info"));
+   SetStreamName(c_pdbStreamIndexTpi, _T("TPI (types)"));
+   SetStreamName(c_pdbStreamIndexDbi, _T("DBI (debug info)"));
+   SetStreamName(c_pdbStreamIndexIpi, _T("IPI (IDs)"));
+
+   DecodePdbInfoStream();
+   DecodeTpiStream(c_pdbStreamIndexTpi, m_tpiHeader, _T("TPI"));
+   DecodeTpiStream(c_pdbStreamIndexIpi, m_ipiHeader, _T("IPI"));
+   DecodeDbiStream();
+}
+
+CString PdbFile::GetStreamName(size_t streamIndex) const
+{
+   return streamIndex < m_streamNames.size()
+      ? m_streamNames[streamIndex]
+      : CString{};
+}
+
+std::vector<PdbSymbolRecord> PdbFile::ReadSymbolRecords(bool publicSymbols) const
+{
+   std::vector<PdbSymbolRecord> symbolRecordsList;
+
+   if (!m_dbiHeader.has_value() ||
+      !m_msf.IsStreamPresent(m_dbiHeader->symRecordStream))
+      return symbolRecordsList;
+
+   const MsfStream& stream = m_msf.Stream(m_dbiHeader->symRecordStream);
+
+   std::vector<BYTE> recordData;
+
+   size_t offset = 0;
+   CodeViewRecordHeader header = {};
+   while (stream.ReadValue(offset, header))
+   {
+      // the record length includes the record kind, but not the length itself
+      if (header.recordLength < sizeof(header.recordKind))
+         break;
+
+      size_t dataSize = header.recordLength - sizeof(header.recordKind);
+      size_t recordOffset = offset;
+      offset += sizeof(header.recordLength) + header.recordLength;
+
+      if ((header.recordKind == c_codeViewSymbolPublic32) != publicSymbols)
+         continue;
+
+      recordData.resize(dataSize);
+      if (!stream.Read(recordOffset + sizeof(header), dataSize, recordData.data()))
+         break;
+
+      PdbSymbolRecord record;
+      record.offset = recordOffset;
+      record.kind = header.recordKind;
+
+      DecodeSymbolRecord(record, recordData);
+
+      symbolRecordsList.push_back(record);
+   }
+
+   return symbolRecordsList;
+}
+
+void PdbFile::DecodePdbInfoStream()
+{
+   if (!m_msf.IsStreamPresent(c_pdbStreamIndexPdbInfo))
+      return;
+
+   const MsfStream& stream = m_msf.Stream(c_pdbStreamIndexPdbInfo);
+
+   PdbInfoStreamHeader header = {};
+   if (!stream.ReadValue(0, header))
+   {
+      m_errorText += _T("Error: PDB info stream is too small\n");
+      return;
+   }
+
+   m_pdbInfo = header;
+
+   // the named stream map follows the header: the string buffer, then a hash
+   // table with present and deleted bit vectors, then the key/value pairs of
+   // all present entries
+   std::shared_ptr<const std::vector<BYTE>> data =
+      stream.ReadRange(sizeof(header), stream.Size() - sizeof(header));
+   if (data == nullptr)
+      return;
+
+   const std::vector<BYTE>& buffer = *data;
+
+   DWORD stringBufferSize = 0;
+   if (!ReadBufferValue(buffer, 0, stringBufferSize) ||
+      stringBufferSize > buffer.size() - sizeof(DWORD))
+   {
+      m_errorText += _T("Error: Invalid named stream map\n");
+      return;
+   }
+
+   std::vector<BYTE> stringBuffer(
+      buffer.begin() + sizeof(DWORD),
+      buffer.begin() + sizeof(DWORD) + stringBufferSize);
+
+   size_t offset = sizeof(DWORD) + stringBufferSize;
+
+   DWORD size = 0;
+   DWORD capacity = 0;
+   DWORD presentWordCount = 0;
+   if (!ReadBufferValue(buffer, offset, size) ||
+      !ReadBufferValue(buffer, offset + 4, capacity) ||
+      !ReadBufferValue(buffer, offset + 8, presentWordCount) ||
+      presentWordCount > (buffer.size() - offset - 12) / sizeof(DWORD))
+   {
+      m_errorText += _T("Error: Invalid named stream map hash table\n");
+      return;
+   }
+
+   offset += 12;
+   size_t presentBitsOffset = offset;
+   offset += presentWordCount * sizeof(DWORD);
+
+   DWORD deletedWordCount = 0;
+   if (!ReadBufferValue(buffer, offset, deletedWordCount))
+      return;
+
+   offset += sizeof(DWORD) + static_cast<size_t>(deletedWordCount) * sizeof(DWORD);
+
+   for (DWORD bucketIndex = 0; bucketIndex < capacity && bucketIndex / 32 < presentWordCount; bucketIndex++)
+   {
+      DWORD presentBits = 0;
+      ReadBufferValue(buffer, presentBitsOffset + (bucketIndex / 32) * sizeof(DWORD), presentBits);
+
+      if ((presentBits & (1U << (bucketIndex % 32))) == 0)
+         continue;
+
+      DWORD nameOffset = 0;
+      DWORD streamIndex = 0;
+      if (!ReadBufferValue(buffer, offset, nameOffset) ||
+         !ReadBufferValue(buffer, offset + 4, streamIndex))
+      {
+         m_errorText += _T("Error: Named stream map entries are outside of the stream\n");
+         break;
+      }
+
+      offset += 8;
+
+      CString name = ReadBufferString(stringBuffer, nameOffset);
+      m_namedStreams.emplace_back(name, streamIndex);
+
+      SetStreamName(streamIndex, name);
+   }
+}
+
+void PdbFile::DecodeTpiStream(DWORD streamIndex, std::optional<TpiStreamHeader>& header, LPCTSTR streamName)
+{
+   if (!m_msf.IsStreamPresent(streamIndex) ||
+      m_msf.Stream(streamIndex).Size() == 0)
+      return;
+
+   TpiStreamHeader tpiHeader = {};
+   if (!m_msf.Stream(streamIndex).ReadValue(0, tpiHeader))
+   {
+      m_errorText.AppendFormat(_T("Error: %s stream is too small\n"), streamName);
+      return;
+   }
+
+   header = tpiHeader;
+
+   SetStreamName(tpiHeader.hashStreamIndex, CString(streamName) + _T(" hash"));
+   SetStreamName(tpiHeader.hashAuxStreamIndex, CString(streamName) + _T(" auxiliary hash"));
+}
+
+void PdbFile::DecodeDbiStream()
+{
+   if (!m_msf.IsStreamPresent(c_pdbStreamIndexDbi) ||
+      m_msf.Stream(c_pdbStreamIndexDbi).Size() == 0)
+      return;
+
+   const MsfStream& stream = m_msf.Stream(c_pdbStreamIndexDbi);
+
+   DbiStreamHeader header = {};
+   if (!stream.ReadValue(0, header))
+   {
+      m_errorText += _T("Error: DBI stream is too small\n");
+      return;
+   }
+
+   m_dbiHeader = header;
+
+   SetStreamName(header.globalStreamIndex, _T("Global symbols"));
+   SetStreamName(header.publicStreamIndex, _T("Public symbols"));
+   SetStreamName(header.symRecordStream, _T("Symbol records"));
+
+   LONG substreamSizes[] =
+   {
+      header.modInfoSize,
+      header.sectionContributionSize,
+      header.sectionMapSize,
+      header.sourceInfoSize,
+      header.typeServerMapSize,
+      header.ecSubstreamSize,
+   };
+
+   ULONGLONG optionalDbgHeaderOffset = sizeof(header);
+   for (LONG substreamSize : substreamSizes)
+   {
+      if (substreamSize < 0)
+      {
+         m_errorText += _T("Error: Invalid DBI substream size\n");
+         return;
+      }
+
+      optionalDbgHeaderOffset += substreamSize;
+   }
+
+   if (header.modInfoSize > 0)
+      DecodeDbiModuleInfo(stream, sizeof(header), header.modInfoSize);
+
+   // the optional debug header is an array of stream indices
+   for (size_t debugStreamIndex = 0;
+      header.optionalDbgHeaderSize > 0 &&
+      debugStreamIndex < static_cast<size_t>(header.optionalDbgHeaderSize) / sizeof(WORD);
+      debugStreamIndex++)
+   {
+      WORD streamIndex = c_pdbInvalidStreamIndex;
+      if (!stream.ReadValue(static_cast<size_t>(optionalDbgHeaderOffset) + debugStreamIndex * sizeof(WORD), streamIndex))
+      {
+         m_errorText += _T("Error: DBI optional debug header is outside of the stream\n");
+         break;
+      }
+
+      SetStreamName(streamIndex,
+         GetValueFromMapOrDefault<DWORD>(g_mapDbiDebugStreamToDisplayText,
+            static_cast<DWORD>(debugStreamIndex), _T("Debug data")));
+   }
+}
+
+void PdbFile::DecodeDbiModuleInfo(const MsfStream& stream, size_t offset, size_t size)
+{
+   size_t endOffset = offset + size;
+
+   while (offset + sizeof(DbiModuleInfoHeader) <= endOffset)
+   {
+      DbiModuleInfoHeader moduleHeader = {};
+      CStringA moduleName;
+      CStringA objectFileName;
+
+      size_t nameOffset = offset + sizeof(DbiModuleInfoHeader);
+      if (!stream.ReadValue(offset, moduleHeader) ||
+         !stream.ReadString(nameOffset, c_maxPdbNameLength, moduleName) ||
+         !stream.ReadString(nameOffset + moduleName.GetLength() + 1, c_maxPdbNameLength, objectFileName))
+      {
+         m_errorText += _T("Error: Invalid DBI module info entry\n");
+         return;
+      }
+
+      PdbModuleInfo moduleInfo;
+      moduleInfo.index = m_modules.size();
+      moduleInfo.moduleName = CA2T(moduleName, CP_UTF8);
+      moduleInfo.objectFileName = CA2T(objectFileName, CP_UTF8);
+      moduleInfo.symbolStreamIndex = moduleHeader.moduleSymStream;
+
+      m_modules.push_back(moduleInfo);
+
+      SetStreamName(moduleHeader.moduleSymStream, _T("Module ") + moduleInfo.moduleName);
+
+      // entries are aligned to 4 bytes
+      offset = nameOffset + moduleName.GetLength() + 1 + objectFileName.GetLength() + 1;
+      offset = (offset + 3) & ~size_t(3);
+   }
+}
+
+void PdbFile::DecodeSymbolRecord(PdbSymbolRecord& record, const std::vector<BYTE>& recordData)
+{
+   DWORD value1 = 0;
+   DWORD value2 = 0;
+   WORD value3 = 0;
+
+   switch (record.kind)
+   {
+   case c_codeViewSymbolPublic32:
+      if (ReadBufferValue(recordData, 0, value1) &&
+         ReadBufferValue(recordData, 4, value2) &&
+         ReadBufferValue(recordData, 8, value3))
+      {
+         record.publicFlags = value1;
+         record.details.Format(_T("%04x:%08x"), value3, value2);
+         record.name = ReadBufferString(recordData, 10);
+      }
+      break;
+
+   case 0x110c: // S_LDATA32
+   case 0x110d: // S_GDATA32
+   case 0x1112: // S_LTHREAD32
+   case 0x1113: // S_GTHREAD32
+      if (ReadBufferValue(recordData, 0, value1) &&
+         ReadBufferValue(recordData, 4, value2) &&
+         ReadBufferValue(recordData, 8, value3))
+      {
+         record.details.Format(_T("%04x:%08x, type 0x%x"), value3, value2, value1);
+         record.name = ReadBufferString(recordData, 10);
+      }
+      break;
+
+   case 0x1125: // S_PROCREF
+   case 0x1126: // S_DATAREF
+   case 0x1127: // S_LPROCREF
+   case 0x1128: // S_ANNOTATIONREF
+   case 0x1129: // S_TOKENREF
+      if (ReadBufferValue(recordData, 4, value2) &&
+         ReadBufferValue(recordData, 8, value3))
+      {
+         record.details.Format(_T("module %u, symbol offset 0x%x"), value3, value2);
+         record.name = ReadBufferString(recordData, 10);
+      }
+      break;
+
+   case 0x1108: // S_UDT
+      if (ReadBufferValue(recordData, 0, value1))
+      {
+         record.details.Format(_T("type 0x%x"), value1);
+         record.name = ReadBufferString(recordData, 4);
+      }
+      break;
+
+   case 0x1107: // S_CONSTANT
+      if (ReadBufferValue(recordData, 0, value1) &&
+         ReadBufferValue(recordData, 4, value3))
+      {
+         size_t leafSize = GetNumericLeafSize(value3);
+
+         record.details.Format(_T("type 0x%x"), value1);
+         if (leafSize > 0)
+            record.name = ReadBufferString(recordData, 4 + leafSize);
+      }
+      break;
+
+   default:
+      break;
+   }
+}
+
+void PdbFile::SetStreamName(size_t streamIndex, const CString& name)
+{
+   if (streamIndex < m_streamNames.size() &&
+      streamIndex != c_pdbInvalidStreamIndex)
+      m_streamNames[streamIndex] = name;
+}
@@ -0,0 +1,139 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file PdbFile.hpp
+/// \brief PDB (program database) file, with the well-known streams decoded
+//
+#pragma once
+
+#include "MsfFile.hpp"
+#include <optional>
+
+/// \brief Module (object file) contributing to the PDB, from the DBI stream
+struct PdbModuleInfo
+{
+   /// index in the module info substream
+   size_t index = 0;
+
+   /// module name; the object file path, or the import DLL name
+   CString moduleName;
+
+   /// object file name; the object file or the library containing it
+   CString objectFileName;
+
+   /// stream index of the module's symbols and line info
+   WORD symbolStreamIndex = c_pdbInvalidStreamIndex;
+};
+
+/// \brief CodeView symbol record from the symbol record stream
+struct PdbSymbolRecord
+{
+   /// offset of the record in the symbol record stream
+   size_t offset = 0;
+
+   /// symbol record kind; S_* values
+   WORD kind = 0;
+
+   /// symbol name; empty for records without a name
+   CString name;
+
+   /// details text, depending on the record kind
+   CString details;
+
+   /// flags of public symbols; CV_PUBSYMFLAGS values
+   DWORD publicFlags = 0;
+};
+
+/// \brief PDB (program database) file
+/// \details Decodes the PDB info stream and the headers of the TPI, IPI and
+/// DBI streams, and determines the names of all streams referenced from
+/// these. Stream data is only read through the MSF page index, so only the
+/// small headers are read when opening the file.
+class PdbFile
+{
+public:
+   /// returns if the file is a PDB file
+   static bool IsPdbFile(const File& file);
+
+   /// ctor; decodes the stream headers
+   explicit PdbFile(const File& file);
+
+   /// returns the MSF container
+   const MsfFile& Msf() const { return m_msf; }
+
+   /// returns errors found while decoding the streams
+   const CString& GetErrorText() const { return m_errorText; }
+
+   /// returns the PDB info stream header, if available
+   const std::optional<PdbInfoStreamHeader>& PdbInfo() const { return m_pdbInfo; }
+
+   /// returns all named streams, from the PDB info stream
+   const std::vector<std::pair<CString, DWORD>>& NamedStreams() const { return m_namedStreams; }
+
+   /// returns the TPI stream header, if available
+   const std::optional<TpiStreamHeader>& TpiHeader() const { return m_tpiHeader; }
+
+   /// returns the IPI stream header, if available
+   const std::optional<TpiStreamHeader>& IpiHeader() const { return m_ipiHeader; }
+
+   /// returns the DBI stream header, if available
+   const std::optional<DbiStreamHeader>& DbiHeader() const { return m_dbiHeader; }
+
+   /// returns all modules from the DBI stream
+   const std::vector<PdbModuleInfo>& Modules() const { return m_modules; }
+
+   /// returns a display name for the stream with given index
+   CString GetStreamName(size_t streamIndex) const;
+
+   /// reads all records of the symbol record stream; returns either only
+   /// the public symbols (S_PUB32), or only the global symbols
+   std::vector<PdbSymbolRecord> ReadSymbolRecords(bool publicSymbols) const;
+
+private:
+   /// decodes the PDB info stream, including the named stream map
+   void DecodePdbInfoStream();
+
+   /// decodes the TPI or IPI stream header
+   void DecodeTpiStream(DWORD streamIndex, std::optional<TpiStreamHeader>& header, LPCTSTR streamName);
+
+   /// decodes the DBI stream header, module info and optional debug header
+   void DecodeDbiStream();
+
+   /// decodes the DBI module info substream
+   void DecodeDbiModuleInfo(const MsfStream& stream, size_t offset, size_t size);
+
+   /// decodes name and details of a symbol record
+   static void DecodeSymbolRecord(PdbSymbolRecord& record, const std::vector<BYTE>& recordData);
+
+   /// sets the name for the stream with given index, when the index is valid
+   void SetStreamName(size_t streamIndex, const CString& name);
+
+private:
+   /// MSF container
+   MsfFile m_msf;
+
+   /// error text
+   CString m_errorText;
+
+   /// PDB info stream header
+   std::optional<PdbInfoStreamHeader> m_pdbInfo;
+
+   /// named streams
+   std::vector<std::pair<CString, DWORD>> m_namedStreams;
+
+   /// TPI stream header
+   std::optional<TpiStreamHeader> m_tpiHeader;
+
+   /// IPI stream header
+   std::optional<TpiStreamHeader> m_ipiHeader;
+
+   /// DBI stream header
+   std::optional<DbiStreamHeader> m_dbiHeader;
+
+   /// modules
+   std::vector<PdbModuleInfo> m_modules;
+
+   /// stream names, by stream index
+   std::vector<CString> m_streamNames;
+};
@@ -0,0 +1,461 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file PdbHeader.cpp
+/// \brief MSF superblock and PDB stream header definitions
+//
+#include "stdafx.h"
+#include "PdbHeader.hpp"
+#include "DisplayFormatHelper.hpp"
+#include "modules/dev/coff/CoffHeader.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapPdbInfoVersionToDisplayText =
+{
+   { 19941610, _T("PdbImplVC2") },
+   { 19950623, _T("PdbImplVC4") },
+   { 19950814, _T("PdbImplVC41") },
+   { 19960307, _T("PdbImplVC50") },
+   { 19970604, _T("PdbImplVC98") },
+   { 19990604, _T("PdbImplVC70Dep") },
+   { 20000404, _T("PdbImplVC70") },
+   { 20030901, _T("PdbImplVC80") },
+   { 20091201, _T("PdbImplVC110") },
+   { 20140508, _T("PdbImplVC140") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapTpiVersionToDisplayText =
+{
+   { 19950410, _T("TpiImplV40") },
+   { 19951122, _T("TpiImplV41") },
+   { 19961031, _T("TpiImplV50") },
+   { 19990903, _T("TpiImplV70") },
+   { 20040203, _T("TpiImplV80") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapDbiVersionToDisplayText =
+{
+   { 930803, _T("DbiImplVC41") },
+   { 19960307, _T("DbiImplV50") },
+   { 19970606, _T("DbiImplV60") },
+   { 19990903, _T("DbiImplV70") },
+   { 20091201, _T("DbiImplV110") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapDbiDebugStreamToDisplayText =
+{
+   { 0, _T("FPO data") },
+   { 1, _T("Exception data") },
+   { 2, _T("Fixup data") },
+   { 3, _T("OMAP to source") },
+   { 4, _T("OMAP from source") },
+   { 5, _T("Section headers") },
+   { 6, _T("Token RID map") },
+   { 7, _T("Xdata") },
+   { 8, _T("Pdata") },
+   { 9, _T("New FPO data") },
+   { 10, _T("Original section headers") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapCodeViewGlobalSymbolKindToDisplayText =
+{
+   { 0x1107, _T("S_CONSTANT") },
+   { 0x1108, _T("S_UDT") },
+   { 0x110c, _T("S_LDATA32") },
+   { 0x110d, _T("S_GDATA32") },
+   { 0x110e, _T("S_PUB32") },
+   { 0x1112, _T("S_LTHREAD32") },
+   { 0x1113, _T("S_GTHREAD32") },
+   { 0x1125, _T("S_PROCREF") },
+   { 0x1126, _T("S_DATAREF") },
+   { 0x1127, _T("S_LPROCREF") },
+   { 0x1128, _T("S_ANNOTATIONREF") },
+   { 0x1129, _T("S_TOKENREF") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapCodeViewPublicSymbolFlagsToDisplayText =
+{
+   { 1, _T("Code") },
+   { 2, _T("Function") },
+   { 4, _T("Managed") },
+   { 8, _T("MSIL") },
+};
+
+const StructDefinition g_definitionMsfSuperBlock = StructDefinition({
+   StructField(
+      offsetof(MsfSuperBlock, MsfSuperBlock::fileMagic),
+      sizeof(MsfSuperBlock::fileMagic),
+      1,
+      true, // little-endian
+      StructFieldType::text,
+      _T("File magic")),
+
+   StructField(
+      offsetof(MsfSuperBlock, MsfSuperBlock::blockSize),
+      sizeof(MsfSuperBlock::blockSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Block size")),
+
+   StructField(
+      offsetof(MsfSuperBlock, MsfSuperBlock::freeBlockMapBlock),
+      sizeof(MsfSuperBlock::freeBlockMapBlock),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Free block map block")),
+
+   StructField(
+      offsetof(MsfSuperBlock, MsfSuperBlock::numBlocks),
+      sizeof(MsfSuperBlock::numBlocks),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Number of blocks")),
+
+   StructField(
+      offsetof(MsfSuperBlock, MsfSuperBlock::numDirectoryBytes),
+      sizeof(MsfSuperBlock::numDirectoryBytes),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Stream directory size")),
+
+   StructField(
+      offsetof(MsfSuperBlock, MsfSuperBlock::unknown),
+      sizeof(MsfSuperBlock::unknown),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Unknown")),
+
+   StructField(
+      offsetof(MsfSuperBlock, MsfSuperBlock::blockMapAddr),
+      sizeof(MsfSuperBlock::blockMapAddr),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Block map block index")),
+   });
+
+const StructDefinition g_definitionPdbInfoStreamHeader = StructDefinition({
+   StructField(
+      offsetof(PdbInfoStreamHeader, PdbInfoStreamHeader::version),
+      sizeof(PdbInfoStreamHeader::version),
+      4,
+      true, // little-endian
+      StructFieldType::valueMapping,
+      g_mapPdbInfoVersionToDisplayText,
+      _T("Version")),
+
+   StructField(
+      offsetof(PdbInfoStreamHeader, PdbInfoStreamHeader::signature),
+      sizeof(PdbInfoStreamHeader::signature),
+      4,
+      true, // little-endian
+      [](LPCVOID data, size_t)
+      {
+         time_t time = *reinterpret_cast<const DWORD*>(data);
+         return DisplayFormatHelper::FormatDateTime(time);
+      },
+      _T("Signature (time stamp)")),
+
+   StructField(
+      offsetof(PdbInfoStreamHeader, PdbInfoStreamHeader::age),
+      sizeof(PdbInfoStreamHeader::age),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Age")),
+
+   StructField(
+      offsetof(PdbInfoStreamHeader, PdbInfoStreamHeader::guid),
+      sizeof(PdbInfoStreamHeader::guid),
+      1,
+      true, // little-endian
+      [](LPCVOID data, size_t size)
+      {
+         return DisplayFormatHelper::FormatGUID((const BYTE*)data, size);
+      },
+      _T("PDB signature GUID")),
+   });
+
+const StructDefinition g_definitionTpiStreamHeader = StructDefinition({
+   StructField(
+      offsetof(TpiStreamHeader, TpiStreamHeader::version),
+      sizeof(TpiStreamHeader::version),
+      4,
+      true, // little-endian
+      StructFieldType::valueMapping,
+      g_mapTpiVersionToDisplayText,
+      _T("Version")),
+
+   StructField(
+      offsetof(TpiStreamHeader, TpiStreamHeader::headerSize),
+      sizeof(TpiStreamHeader::headerSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Header size")),
+
+   StructField(
+      offsetof(TpiStreamHeader, TpiStreamHeader::typeIndexBegin),
+      sizeof(TpiStreamHeader::typeIndexBegin),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("First type index")),
+
+   StructField(
+      offsetof(TpiStreamHeader, TpiStreamHeader::typeIndexEnd),
+      sizeof(TpiStreamHeader::typeIndexEnd),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Last type index + 1")),
+
+   StructField(
+      offsetof(TpiStreamHeader, TpiStreamHeader::typeRecordBytes),
+      sizeof(TpiStreamHeader::typeRecordBytes),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Type record bytes")),
+
+   StructField(
+      offsetof(TpiStreamHeader, TpiStreamHeader::hashStreamIndex),
+      sizeof(TpiStreamHeader::hashStreamIndex),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Hash stream index")),
+
+   StructField(
+      offsetof(TpiStreamHeader, TpiStreamHeader::hashAuxStreamIndex),
+      sizeof(TpiStreamHeader::hashAuxStreamIndex),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Auxiliary hash stream index")),
+
+   StructField(
+      offsetof(TpiStreamHeader, TpiStreamHeader::hashKeySize),
+      sizeof(TpiStreamHeader::hashKeySize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Hash key size")),
+
+   StructField(
+      offsetof(TpiStreamHeader, TpiStreamHeader::numHashBuckets),
+      sizeof(TpiStreamHeader::numHashBuckets),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Number of hash buckets")),
+
+   StructField(
+      offsetof(TpiStreamHeader, TpiStreamHeader::hashValueBufferOffset),
+      sizeof(TpiStreamHeader::hashValueBufferOffset),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Hash value buffer offset")),
+
+   StructField(
+      offsetof(TpiStreamHeader, TpiStreamHeader::hashValueBufferLength),
+      sizeof(TpiStreamHeader::hashValueBufferLength),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Hash value buffer length")),
+
+   StructField(
+      offsetof(TpiStreamHeader, TpiStreamHeader::indexOffsetBufferOffset),
+      sizeof(TpiStreamHeader::indexOffsetBufferOffset),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Index offset buffer offset")),
+
+   StructField(
+      offsetof(TpiStreamHeader, TpiStreamHeader::indexOffsetBufferLength),
+      sizeof(TpiStreamHeader::indexOffsetBufferLength),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Index offset buffer length")),
+
+   StructField(
+      offsetof(TpiStreamHeader, TpiStreamHeader::hashAdjBufferOffset),
+      sizeof(TpiStreamHeader::hashAdjBufferOffset),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Hash adjustment buffer offset")),
+
+   StructField(
+      offsetof(TpiStreamHeader, TpiStreamHeader::hashAdjBufferLength),
+      sizeof(TpiStreamHeader::hashAdjBufferLength),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Hash adjustment buffer length")),
+   });
+
+const StructDefinition g_definitionDbiStreamHeader = StructDefinition({
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::versionSignature),
+      sizeof(DbiStreamHeader::versionSignature),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Version signature")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::versionHeader),
+      sizeof(DbiStreamHeader::versionHeader),
+      4,
+      true, // little-endian
+      StructFieldType::valueMapping,
+      g_mapDbiVersionToDisplayText,
+      _T("Version")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::age),
+      sizeof(DbiStreamHeader::age),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Age")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::globalStreamIndex),
+      sizeof(DbiStreamHeader::globalStreamIndex),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Global symbols stream index")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::buildNumber),
+      sizeof(DbiStreamHeader::buildNumber),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Build number")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::publicStreamIndex),
+      sizeof(DbiStreamHeader::publicStreamIndex),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Public symbols stream index")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::pdbDllVersion),
+      sizeof(DbiStreamHeader::pdbDllVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("PDB DLL version")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::symRecordStream),
+      sizeof(DbiStreamHeader::symRecordStream),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Symbol record stream index")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::pdbDllRbld),
+      sizeof(DbiStreamHeader::pdbDllRbld),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("PDB DLL rebuild number")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::modInfoSize),
+      sizeof(DbiStreamHeader::modInfoSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Module info substream size")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::sectionContributionSize),
+      sizeof(DbiStreamHeader::sectionContributionSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Section contribution substream size")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::sectionMapSize),
+      sizeof(DbiStreamHeader::sectionMapSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Section map substream size")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::sourceInfoSize),
+      sizeof(DbiStreamHeader::sourceInfoSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Source info substream size")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::typeServerMapSize),
+      sizeof(DbiStreamHeader::typeServerMapSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Type server map substream size")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::mfcTypeServerIndex),
+      sizeof(DbiStreamHeader::mfcTypeServerIndex),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("MFC type server index")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::optionalDbgHeaderSize),
+      sizeof(DbiStreamHeader::optionalDbgHeaderSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Optional debug header substream size")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::ecSubstreamSize),
+      sizeof(DbiStreamHeader::ecSubstreamSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Edit and continue substream size")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::flags),
+      sizeof(DbiStreamHeader::flags),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Flags")),
+
+   StructField(
+      offsetof(DbiStreamHeader, DbiStreamHeader::machine),
+      sizeof(DbiStreamHeader::machine),
+      2,
+      true, // little-endian
+      StructFieldType::valueMapping,
+      g_mapCoffTargetMachineToDisplayText,
+      _T("Machine")),
+   });
@@ -0,0 +1,168 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file PdbHeader.hpp
+/// \brief MSF superblock and PDB stream header definitions
+//
+#pragma once
+
+#include "StructDefinition.hpp"
+
+#pragma pack(push, 1)
+
+/// \brief MSF (multi-stream file) superblock, at the start of a PDB file
+/// \see https://llvm.org/docs/PDB/MsfFile.html
+/// The struct corresponds with LLVM's msf::SuperBlock struct.
+struct MsfSuperBlock
+{
+   CHAR fileMagic[32];        ///< magic; "Microsoft C/C++ MSF 7.00\r\n\x1a" "DS\0\0\0"
+   DWORD blockSize;           ///< block (page) size; a power of two from 512 to 32768 bytes
+   DWORD freeBlockMapBlock;   ///< index of the active free block map; 1 or 2
+   DWORD numBlocks;           ///< number of blocks in the file
+   DWORD numDirectoryBytes;   ///< size of the stream directory
+   DWORD unknown;             ///< unknown; always 0
+   DWORD blockMapAddr;        ///< block index of the block map, listing the stream directory blocks
+};
+
+/// \brief Header of the PDB info stream, stream 1
+/// The struct corresponds with LLVM's pdb::PdbStreamHeader struct.
+struct PdbInfoStreamHeader
+{
+   DWORD version;    ///< PDB version; PdbImplVC70 for all current PDBs
+   DWORD signature;  ///< time stamp of PDB creation
+   DWORD age;        ///< number of times the PDB was written
+   GUID guid;        ///< PDB signature GUID; matches the executable's RSDS record
+};
+
+/// \brief Header of the TPI (type) and IPI (ID) streams, streams 2 and 4
+/// The struct corresponds with LLVM's pdb::TpiStreamHeader struct.
+struct TpiStreamHeader
+{
+   DWORD version;                   ///< TPI version
+   DWORD headerSize;                ///< size of this header
+   DWORD typeIndexBegin;            ///< first type index; usually 0x1000
+   DWORD typeIndexEnd;              ///< one past the last type index
+   DWORD typeRecordBytes;           ///< size of the type records following the header
+   WORD hashStreamIndex;            ///< stream index of the hash stream; 0xffff when not present
+   WORD hashAuxStreamIndex;         ///< stream index of the auxiliary hash stream; 0xffff when not present
+   DWORD hashKeySize;               ///< size of a hash key
+   DWORD numHashBuckets;            ///< number of hash buckets
+   LONG hashValueBufferOffset;      ///< offset of the hash values in the hash stream
+   DWORD hashValueBufferLength;     ///< size of the hash values
+   LONG indexOffsetBufferOffset;    ///< offset of the type index offsets in the hash stream
+   DWORD indexOffsetBufferLength;   ///< size of the type index offsets
+   LONG hashAdjBufferOffset;        ///< offset of the hash adjustments in the hash stream
+   DWORD hashAdjBufferLength;       ///< size of the hash adjustments
+};
+
+/// \brief Header of the DBI (debug info) stream, stream 3
+/// The struct corresponds with LLVM's pdb::DbiStreamHeader struct.
+struct DbiStreamHeader
+{
+   LONG versionSignature;        ///< version signature; always -1
+   DWORD versionHeader;          ///< DBI version
+   DWORD age;                    ///< age; matches the age in the PDB info stream
+   WORD globalStreamIndex;       ///< stream index of the global symbols hash stream
+   WORD buildNumber;             ///< toolchain version; bit 15: new version format
+   WORD publicStreamIndex;       ///< stream index of the public symbols hash stream
+   WORD pdbDllVersion;           ///< version of mspdbXXX.dll that wrote the PDB
+   WORD symRecordStream;         ///< stream index of the symbol record stream
+   WORD pdbDllRbld;              ///< rebuild number of mspdbXXX.dll
+   LONG modInfoSize;             ///< size of the module info substream
+   LONG sectionContributionSize; ///< size of the section contribution substream
+   LONG sectionMapSize;          ///< size of the section map substream
+   LONG sourceInfoSize;          ///< size of the file info substream
+   LONG typeServerMapSize;       ///< size of the type server map substream
+   DWORD mfcTypeServerIndex;     ///< MFC type server index
+   LONG optionalDbgHeaderSize;   ///< size of the optional debug header substream
+   LONG ecSubstreamSize;         ///< size of the edit and continue substream
+   WORD flags;                   ///< flags; bit 0: incrementally linked, bit 1: stripped
+   WORD machine;                 ///< target machine; IMAGE_FILE_MACHINE_* values
+   DWORD padding;                ///< padding
+};
+
+/// \brief Fixed part of a DBI module info substream entry; followed by the
+/// zero-terminated module name and object file name, aligned to 4 bytes
+/// The struct corresponds with LLVM's pdb::ModuleInfoHeader struct.
+struct DbiModuleInfoHeader
+{
+   DWORD unused1;                ///< unused
+   BYTE sectionContribution[28]; ///< first section contribution of this module
+   WORD flags;                   ///< flags; bit 0: dirty, bit 1: has EC info
+   WORD moduleSymStream;         ///< stream index of the module's symbols; 0xffff when not present
+   DWORD symByteSize;            ///< size of the CodeView symbols in the module stream
+   DWORD c11ByteSize;            ///< size of the C11 line info in the module stream
+   DWORD c13ByteSize;            ///< size of the C13 line info in the module stream
+   WORD sourceFileCount;         ///< number of source files contributing to this module
+   WORD padding;                 ///< padding
+   DWORD unused2;                ///< unused
+   DWORD sourceFileNameIndex;    ///< name index of the source file
+   DWORD pdbFilePathNameIndex;   ///< name index of the PDB file path
+};
+
+/// \brief Header of a CodeView symbol record
+struct CodeViewRecordHeader
+{
+   WORD recordLength;   ///< length of the record, excluding this field
+   WORD recordKind;     ///< record kind; S_* values
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(MsfSuperBlock) == 56, "MSF superblock must be 56 bytes long");
+static_assert(sizeof(PdbInfoStreamHeader) == 28, "PDB info stream header must be 28 bytes long");
+static_assert(sizeof(TpiStreamHeader) == 56, "TPI stream header must be 56 bytes long");
+static_assert(sizeof(DbiStreamHeader) == 64, "DBI stream header must be 64 bytes long");
+static_assert(sizeof(DbiModuleInfoHeader) == 64, "DBI module info header must be 64 bytes long");
+
+/// MSF 7.00 file magic, at the start of the superblock
+constexpr char c_msfFileMagic[] = "Microsoft C/C++ MSF 7.00\r\n\x1a" "DS\0\0\0";
+
+/// stream index of the PDB info stream
+constexpr DWORD c_pdbStreamIndexPdbInfo = 1;
+
+/// stream index of the TPI (type) stream
+constexpr DWORD c_pdbStreamIndexTpi = 2;
+
+/// stream index of the DBI (debug info) stream
+constexpr DWORD c_pdbStreamIndexDbi = 3;
+
+/// stream index of the IPI (ID) stream
+constexpr DWORD c_pdbStreamIndexIpi = 4;
+
+/// stream index value meaning that a stream isn't present
+constexpr WORD c_pdbInvalidStreamIndex = 0xffff;
+
+/// S_PUB32 symbol record kind, for public symbols
+constexpr WORD c_codeViewSymbolPublic32 = 0x110e;
+
+/// mapping of PDB info stream versions to display text
+extern const std::map<DWORD, LPCTSTR> g_mapPdbInfoVersionToDisplayText;
+
+/// mapping of TPI stream versions to display text
+extern const std::map<DWORD, LPCTSTR> g_mapTpiVersionToDisplayText;
+
+/// mapping of DBI stream versions to display text
+extern const std::map<DWORD, LPCTSTR> g_mapDbiVersionToDisplayText;
+
+/// mapping of DBI optional debug header stream indices to display text
+extern const std::map<DWORD, LPCTSTR> g_mapDbiDebugStreamToDisplayText;
+
+/// mapping of global CodeView symbol record kinds to display text
+extern const std::map<DWORD, LPCTSTR> g_mapCodeViewGlobalSymbolKindToDisplayText;
+
+/// mapping of public symbol flags to display text
+extern const std::map<DWORD, LPCTSTR> g_mapCodeViewPublicSymbolFlagsToDisplayText;
+
+/// struct definition for above MSF superblock
+extern const StructDefinition g_definitionMsfSuperBlock;
+
+/// struct definition for above PDB info stream header
+extern const StructDefinition g_definitionPdbInfoStreamHeader;
+
+/// struct definition for above TPI stream header
+extern const StructDefinition g_definitionTpiStreamHeader;
+
+/// struct definition for above DBI stream header
+extern const StructDefinition g_definitionDbiStreamHeader;
@@ -0,0 +1,35 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file PdbModule.cpp
+/// \brief module to load PDB (program database) files
+//
+#include "stdafx.h"
+#include "PdbModule.hpp"
+#include "PdbReader.hpp"
+
+CString PdbModule::DisplayName() const
+{
+   return CString{ "PDB module" };
+}
+
+ModuleIconID PdbModule::IconID() const
+{
+   return ModuleIconID::moduleStaticLib;
+}
+
+CString PdbModule::FilterStrings() const
+{
+   return CString{ "Program database files (*.pdb)|*.pdb|" };
+}
+
+bool PdbModule::IsModuleApplicableForFile(const File& file) const
+{
+   return PdbReader::IsPdbFile(file);
+}
+
+std::shared_ptr<IReader> PdbModule::OpenReader(const File& file) const
+{
+   return std::make_shared<PdbReader>(file);
+}
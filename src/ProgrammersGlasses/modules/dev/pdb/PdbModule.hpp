@@ -0,0 +1,27 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file PdbModule.hpp
+/// \brief module to load PDB (program database) files
+//
+#pragma once
+
+#include "modules/IModule.hpp"
+
+/// \brief PDB module
+/// \details module to load PDB (program database) files, as written by
+/// the Microsoft compilers and linkers
+class PdbModule : public IModule
+{
+public:
+   /// ctor
+   PdbModule() = default;
+
+   // Inherited via IModule
+   CString DisplayName() const override;
+   ModuleIconID IconID() const override;
+   CString FilterStrings() const override;
+   bool IsModuleApplicableForFile(const File& file) const override;
+   std::shared_ptr<IReader> OpenReader(const File& file) const override;
+};
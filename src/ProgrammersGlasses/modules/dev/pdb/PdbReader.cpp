@@ -0,0 +1,459 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file PdbReader.cpp
+/// \brief reader for PDB (program database) files
+//
+#include "stdafx.h"
+#include "PdbReader.hpp"
+#include "PdbFile.hpp"
+#include "modules/CodeTextViewNode.hpp"
+#include "modules/FilterSortListViewNode.hpp"
+#include "modules/StructListViewNode.hpp"
+#include "modules/HexDataViewNode.hpp"
+#include "modules/DisplayFormatHelper.hpp"
+#include "modules/dev/coff/CoffHeader.hpp"
+#include "modules/dev/pe/DebugDirectoryTable.hpp"
+#include "SymbolsHelper.hpp"
+
+/// max. number of stream bytes shown in a hex view; stream data is copied
+/// into a buffer for display, so larger streams are cut off
+constexpr size_t c_maxDisplayedStreamBytes = 16 * 1024 * 1024;
+
+/// max. number of page numbers shown in the streams table
+constexpr size_t c_maxDisplayedPageNumbers = 8;
+
+bool PdbReader::IsPdbFile(const File& file)
+{
+   return PdbFile::IsPdbFile(file);
+}
+
+PdbReader::PdbReader(const File& file)
+   :m_file(file)
+{
+}
+
+void PdbReader::Load()
+{
+   auto rootNode = std::make_shared<CodeTextViewNode>(
+      _T("Summary"),
+      NodeTreeIconID::nodeTreeIconDocument);
+
+   m_rootNode = rootNode;
+
+   CString summaryText;
+   summaryText.Append(_T("PDB file: ") + m_file.Filename() + _T("\n\n"));
+   summaryText.Append(_T("Summary:\n"));
+
+   m_pdbFile = std::make_shared<PdbFile>(m_file);
+
+   const MsfFile& msf = m_pdbFile->Msf();
+
+   rootNode->ChildNodes().push_back(
+      std::make_shared<StructListViewNode>(
+         _T("MSF superblock"),
+         NodeTreeIconID::nodeTreeIconBinary,
+         g_definitionMsfSuperBlock,
+         &msf.SuperBlock(),
+         m_file.Data()));
+
+   if (!msf.IsValid())
+   {
+      summaryText.Append(_T("Error: ") + msf.GetErrorText() + _T("\n"));
+      rootNode->SetText(summaryText);
+      return;
+   }
+
+   summaryText.AppendFormat(_T("Block size: %u bytes, number of blocks: %u\n"),
+      msf.SuperBlock().blockSize,
+      msf.SuperBlock().numBlocks);
+
+   summaryText.AppendFormat(_T("Number of streams: %zu\n"), msf.StreamCount());
+
+   AddStreamsNode(*rootNode);
+   AddPdbInfoStreamNode(*rootNode, summaryText);
+   AddTpiStreamNode(*rootNode, c_pdbStreamIndexTpi, _T("TPI"), summaryText);
+   AddTpiStreamNode(*rootNode, c_pdbStreamIndexIpi, _T("IPI"), summaryText);
+   AddDbiStreamNode(*rootNode, summaryText);
+   AddSymbolNodes(*rootNode);
+
+   summaryText.Append(m_pdbFile->GetErrorText());
+
+   rootNode->SetText(summaryText);
+}
+
+void PdbReader::Cleanup()
+{
+   // nothing expensive to cleanup here
+}
+
+void PdbReader::AddStreamsNode(StaticNode& rootNode)
+{
+   static std::vector<CString> streamColumnNames
+   {
+      _T("Index"),
+      _T("Name"),
+      _T("Size"),
+      _T("Page count"),
+      _T("Page numbers"),
+   };
+
+   std::shared_ptr<PdbFile> pdbFile = m_pdbFile;
+
+   auto streamsNode = std::make_shared<FilterSortListViewNode>(
+      _T("Streams"),
+      NodeTreeIconID::nodeTreeIconTable,
+      streamColumnNames,
+      pdbFile->Msf().StreamCount(),
+      [pdbFile](size_t streamIndex)
+      {
+         const MsfFile& msf = pdbFile->Msf();
+         const MsfStream& stream = msf.Stream(streamIndex);
+
+         CString indexText;
+         indexText.Format(_T("%zu"), streamIndex);
+
+         CString sizeText;
+         if (msf.IsStreamPresent(streamIndex))
+            sizeText.Format(_T("0x%08zx"), stream.Size());
+         else
+            sizeText = _T("nil");
+
+         CString pageCountText;
+         pageCountText.Format(_T("%zu"), stream.PageNumbers().size());
+
+         CString pageNumbersText;
+         for (size_t pageIndex = 0;
+            pageIndex < stream.PageNumbers().size() && pageIndex < c_maxDisplayedPageNumbers;
+            pageIndex++)
+         {
+            pageNumbersText.AppendFormat(_T("%s%u"),
+               pageIndex > 0 ? _T(", ") : _T(""),
+               stream.PageNumbers()[pageIndex]);
+         }
+
+         if (stream.PageNumbers().size() > c_maxDisplayedPageNumbers)
+            pageNumbersText += _T(", ...");
+
+         return std::vector<CString> {
+            indexText,
+            pdbFile->GetStreamName(streamIndex),
+            sizeText,
+            pageCountText,
+            pageNumbersText,
+         };
+      },
+      true);
+
+   // only named streams get a data node; PDBs of large projects contain
+   // thousands of module streams
+   for (size_t streamIndex = 0; streamIndex < pdbFile->Msf().StreamCount(); streamIndex++)
+   {
+      CString streamName = pdbFile->GetStreamName(streamIndex);
+
+      if (streamName.IsEmpty() ||
+         pdbFile->Msf().Stream(streamIndex).Size() == 0)
+         continue;
+
+      CString name;
+      name.Format(_T("Stream [%zu] %s"), streamIndex, streamName.GetString());
+
+      streamsNode->ChildNodes().push_back(
+         std::make_shared<HexDataViewNode>(
+            name,
+            NodeTreeIconID::nodeTreeIconBinary,
+            [pdbFile, streamIndex](CString& errorText)
+            {
+               const MsfStream& stream = pdbFile->Msf().Stream(streamIndex);
+
+               std::shared_ptr<const std::vector<BYTE>> data =
+                  stream.ReadRange(0, std::min(stream.Size(), c_maxDisplayedStreamBytes));
+
+               if (data == nullptr)
+                  errorText = _T("Stream pages are outside of the file");
+
+               return data;
+            }));
+   }
+
+   rootNode.ChildNodes().push_back(streamsNode);
+}
+
+void PdbReader::AddPdbInfoStreamNode(StaticNode& rootNode, CString& summaryText)
+{
+   const std::optional<PdbInfoStreamHeader>& pdbInfo = m_pdbFile->PdbInfo();
+   if (!pdbInfo.has_value())
+      return;
+
+   CodeViewPdbInfo info;
+   info.isRsds = true;
+   info.guid = pdbInfo->guid;
+   info.age = pdbInfo->age;
+   info.pdbPath = m_file.Filename();
+
+   CString infoText;
+   infoText.AppendFormat(_T("PDB version: %u %s\n"),
+      pdbInfo->version,
+      GetValueFromMapOrDefault<DWORD>(g_mapPdbInfoVersionToDisplayText, pdbInfo->version, _T("unknown")));
+
+   infoText.AppendFormat(_T("Created: %s\n"),
+      DisplayFormatHelper::FormatDateTime(pdbInfo->signature).GetString());
+
+   infoText.AppendFormat(_T("Age: %u\n"), pdbInfo->age);
+   infoText.AppendFormat(_T("GUID: %s\n"),
+      DisplayFormatHelper::FormatGUID(
+         reinterpret_cast<const BYTE*>(&pdbInfo->guid), sizeof(pdbInfo->guid)).GetString());
+
+   infoText.AppendFormat(_T("Symbol server key: %s\n"), info.FormatSymbolServerKey().GetString());
+
+   summaryText.Append(infoText);
+
+   infoText.Append(_T("\nNamed streams:\n"));
+   for (const auto& [name, streamIndex] : m_pdbFile->NamedStreams())
+      infoText.AppendFormat(_T("%s: stream %u\n"), name.GetString(), streamIndex);
+
+   auto infoNode = std::make_shared<CodeTextViewNode>(
+      _T("PDB info stream"),
+      NodeTreeIconID::nodeTreeIconDocument);
+
+   infoNode->SetText(infoText);
+
+   const BYTE* headerData = m_pdbFile->Msf().Stream(c_pdbStreamIndexPdbInfo).DirectData(0, sizeof(PdbInfoStreamHeader));
+   if (headerData != nullptr)
+   {
+      infoNode->ChildNodes().push_back(
+         std::make_shared<StructListViewNode>(
+            _T("PDB info stream header"),
+            NodeTreeIconID::nodeTreeIconBinary,
+            g_definitionPdbInfoStreamHeader,
+            headerData,
+            m_file.Data()));
+   }
+
+   rootNode.ChildNodes().push_back(infoNode);
+}
+
+void PdbReader::AddTpiStreamNode(StaticNode& rootNode, DWORD streamIndex, LPCTSTR streamName, CString& summaryText)
+{
+   const std::optional<TpiStreamHeader>& header = streamIndex == c_pdbStreamIndexTpi
+      ? m_pdbFile->TpiHeader()
+      : m_pdbFile->IpiHeader();
+
+   if (!header.has_value())
+      return;
+
+   DWORD recordCount = header->typeIndexEnd > header->typeIndexBegin
+      ? header->typeIndexEnd - header->typeIndexBegin
+      : 0;
+
+   CString tpiText;
+   tpiText.Format(_T("%s stream: %u records, index 0x%x to 0x%x, %u bytes\n"),
+      streamName,
+      recordCount,
+      header->typeIndexBegin,
+      header->typeIndexEnd,
+      header->typeRecordBytes);
+
+   summaryText.Append(tpiText);
+
+   tpiText.AppendFormat(_T("Version: %u %s\n"),
+      header->version,
+      GetValueFromMapOrDefault<DWORD>(g_mapTpiVersionToDisplayText, header->version, _T("unknown")));
+
+   tpiText.AppendFormat(_T("Hash stream: %u, auxiliary hash stream: %u\n"),
+      header->hashStreamIndex,
+      header->hashAuxStreamIndex);
+
+   auto tpiNode = std::make_shared<CodeTextViewNode>(
+      CString(streamName) + _T(" stream"),
+      NodeTreeIconID::nodeTreeIconDocument);
+
+   tpiNode->SetText(tpiText);
+
+   const BYTE* headerData = m_pdbFile->Msf().Stream(streamIndex).DirectData(0, sizeof(TpiStreamHeader));
+   if (headerData != nullptr)
+   {
+      tpiNode->ChildNodes().push_back(
+         std::make_shared<StructListViewNode>(
+            CString(streamName) + _T(" stream header"),
+            NodeTreeIconID::nodeTreeIconBinary,
+            g_definitionTpiStreamHeader,
+            headerData,
+            m_file.Data()));
+   }
+
+   rootNode.ChildNodes().push_back(tpiNode);
+}
+
+void PdbReader::AddDbiStreamNode(StaticNode& rootNode, CString& summaryText)
+{
+   const std::optional<DbiStreamHeader>& header = m_pdbFile->DbiHeader();
+   if (!header.has_value())
+   {
+      summaryText.Append(_T("No DBI stream; the PDB was probably written by the compiler, not the linker\n"));
+      return;
+   }
+
+   CString dbiText;
+   dbiText.Format(_T("DBI stream: machine %s, age %u, %zu modules\n"),
+      GetValueFromMapOrDefault<DWORD>(g_mapCoffTargetMachineToDisplayText, header->machine, _T("unknown")),
+      header->age,
+      m_pdbFile->Modules().size());
+
+   summaryText.Append(dbiText);
+
+   dbiText.AppendFormat(_T("Version: %u %s\n"),
+      header->versionHeader,
+      GetValueFromMapOrDefault<DWORD>(g_mapDbiVersionToDisplayText, header->versionHeader, _T("unknown")));
+
+   dbiText.AppendFormat(_T("Global symbols stream: %u\nPublic symbols stream: %u\nSymbol record stream: %u\n"),
+      header->globalStreamIndex,
+      header->publicStreamIndex,
+      header->symRecordStream);
+
+   auto dbiNode = std::make_shared<CodeTextViewNode>(
+      _T("DBI stream"),
+      NodeTreeIconID::nodeTreeIconDocument);
+
+   dbiNode->SetText(dbiText);
+
+   const BYTE* headerData = m_pdbFile->Msf().Stream(c_pdbStreamIndexDbi).DirectData(0, sizeof(DbiStreamHeader));
+   if (headerData != nullptr)
+   {
+      dbiNode->ChildNodes().push_back(
+         std::make_shared<StructListViewNode>(
+            _T("DBI stream header"),
+            NodeTreeIconID::nodeTreeIconBinary,
+            g_definitionDbiStreamHeader,
+            headerData,
+            m_file.Data()));
+   }
+
+   static std::vector<CString> moduleColumnNames
+   {
+      _T("Index"),
+      _T("Module name"),
+      _T("Object file name"),
+      _T("Symbol stream"),
+   };
+
+   std::shared_ptr<PdbFile> pdbFile = m_pdbFile;
+
+   dbiNode->ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Modules"),
+         NodeTreeIconID::nodeTreeIconTable,
+         moduleColumnNames,
+         pdbFile->Modules().size(),
+         [pdbFile](size_t moduleIndex)
+         {
+            const PdbModuleInfo& moduleInfo = pdbFile->Modules()[moduleIndex];
+
+            CString indexText;
+            indexText.Format(_T("%zu"), moduleInfo.index);
+
+            CString streamText;
+            if (moduleInfo.symbolStreamIndex != c_pdbInvalidStreamIndex)
+               streamText.Format(_T("%u"), moduleInfo.symbolStreamIndex);
+
+            return std::vector<CString> {
+               indexText,
+               moduleInfo.moduleName,
+               moduleInfo.objectFileName,
+               streamText,
+            };
+         },
+         true));
+
+   rootNode.ChildNodes().push_back(dbiNode);
+}
+
+void PdbReader::AddSymbolNodes(StaticNode& rootNode)
+{
+   if (!m_pdbFile->DbiHeader().has_value())
+      return;
+
+   static std::vector<CString> publicsColumnNames
+   {
+      _T("Offset"),
+      _T("Name"),
+      _T("Undecorated name"),
+      _T("Address"),
+      _T("Flags"),
+   };
+
+   std::shared_ptr<PdbFile> pdbFile = m_pdbFile;
+
+   // the symbol record stream is only walked when the node is shown
+   rootNode.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Public symbols"),
+         NodeTreeIconID::nodeTreeIconTable,
+         publicsColumnNames,
+         [pdbFile]()
+         {
+            std::vector<std::vector<CString>> publicsData;
+
+            for (const PdbSymbolRecord& record : pdbFile->ReadSymbolRecords(true))
+            {
+               CString offsetText;
+               offsetText.Format(_T("0x%08zx"), record.offset);
+
+               publicsData.push_back(
+                  std::vector<CString> {
+                     offsetText,
+                     record.name,
+                     SymbolsHelper::UndecorateSymbol(record.name),
+                     record.details,
+                     DisplayFormatHelper::FormatBitFlagsFromMap(
+                        g_mapCodeViewPublicSymbolFlagsToDisplayText, record.publicFlags),
+                  });
+            }
+
+            return publicsData;
+         },
+         true));
+
+   static std::vector<CString> globalsColumnNames
+   {
+      _T("Offset"),
+      _T("Kind"),
+      _T("Name"),
+      _T("Details"),
+   };
+
+   rootNode.ChildNodes().push_back(
+      std::make_shared<FilterSortListViewNode>(
+         _T("Global symbols"),
+         NodeTreeIconID::nodeTreeIconTable,
+         globalsColumnNames,
+         [pdbFile]()
+         {
+            std::vector<std::vector<CString>> globalsData;
+
+            for (const PdbSymbolRecord& record : pdbFile->ReadSymbolRecords(false))
+            {
+               CString offsetText;
+               offsetText.Format(_T("0x%08zx"), record.offset);
+
+               CString kindText;
+               kindText.Format(_T("0x%04x %s"),
+                  record.kind,
+                  GetValueFromMapOrDefault<DWORD>(
+                     g_mapCodeViewGlobalSymbolKindToDisplayText, record.kind, _T("")));
+               kindText.TrimRight();
+
+               globalsData.push_back(
+                  std::vector<CString> {
+                     offsetText,
+                     kindText,
+                     record.name,
+                     record.details,
+                  });
+            }
+
+            return globalsData;
+         },
+         true));
+}
@@ -0,0 +1,64 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file PdbReader.hpp
+/// \brief reader for PDB (program database) files
+//
+#pragma once
+
+#include "modules/IReader.hpp"
+
+class StaticNode;
+class PdbFile;
+
+/// PDB file reader
+class PdbReader : public IReader
+{
+public:
+   /// determines if the given file is a PDB file
+   static bool IsPdbFile(const File& file);
+
+   /// ctor
+   explicit PdbReader(const File& file);
+
+   // Inherited via IReader
+   const CString& Filename() const override
+   {
+      return m_file.Filename();
+   }
+
+   std::shared_ptr<INode> RootNode() const override
+   {
+      return m_rootNode;
+   }
+
+   void Load() override;
+   void Cleanup() override;
+
+private:
+   /// adds streams table node, with data nodes for all named streams
+   void AddStreamsNode(StaticNode& rootNode);
+
+   /// adds PDB info stream node
+   void AddPdbInfoStreamNode(StaticNode& rootNode, CString& summaryText);
+
+   /// adds TPI or IPI stream node
+   void AddTpiStreamNode(StaticNode& rootNode, DWORD streamIndex, LPCTSTR streamName, CString& summaryText);
+
+   /// adds DBI stream node, with the module list
+   void AddDbiStreamNode(StaticNode& rootNode, CString& summaryText);
+
+   /// adds public and global symbols nodes
+   void AddSymbolNodes(StaticNode& rootNode);
+
+private:
+   /// file to read from
+   File m_file;
+
+   /// PDB file; shared with nodes that read stream data lazily
+   std::shared_ptr<PdbFile> m_pdbFile;
+
+   /// root node
+   std::shared_ptr<INode> m_rootNode;
+};
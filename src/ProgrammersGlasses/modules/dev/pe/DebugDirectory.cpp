@@ -0,0 +1,134 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file DebugDirectory.cpp
+/// \brief debug directory and CodeView record definitions
+//
+#include "stdafx.h"
+#include "DebugDirectory.hpp"
+#include "DisplayFormatHelper.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapDebugTypeToDisplayText =
+{
+   { 0, _T("IMAGE_DEBUG_TYPE_UNKNOWN") },
+   { 1, _T("IMAGE_DEBUG_TYPE_COFF") },
+   { 2, _T("IMAGE_DEBUG_TYPE_CODEVIEW") },
+   { 3, _T("IMAGE_DEBUG_TYPE_FPO") },
+   { 4, _T("IMAGE_DEBUG_TYPE_MISC") },
+   { 5, _T("IMAGE_DEBUG_TYPE_EXCEPTION") },
+   { 6, _T("IMAGE_DEBUG_TYPE_FIXUP") },
+   { 7, _T("IMAGE_DEBUG_TYPE_OMAP_TO_SRC") },
+   { 8, _T("IMAGE_DEBUG_TYPE_OMAP_FROM_SRC") },
+   { 9, _T("IMAGE_DEBUG_TYPE_BORLAND") },
+   { 10, _T("IMAGE_DEBUG_TYPE_RESERVED10") },
+   { 11, _T("IMAGE_DEBUG_TYPE_CLSID") },
+   { 12, _T("IMAGE_DEBUG_TYPE_VC_FEATURE") },
+   { 13, _T("IMAGE_DEBUG_TYPE_POGO") },
+   { 14, _T("IMAGE_DEBUG_TYPE_ILTCG") },
+   { 15, _T("IMAGE_DEBUG_TYPE_MPX") },
+   { 16, _T("IMAGE_DEBUG_TYPE_REPRO") },
+   { 17, _T("IMAGE_DEBUG_TYPE_EMBEDDED_PORTABLE_PDB") },
+   { 19, _T("IMAGE_DEBUG_TYPE_PDBCHECKSUM") },
+   { 20, _T("IMAGE_DEBUG_TYPE_EX_DLLCHARACTERISTICS") },
+};
+
+const StructDefinition g_definitionDebugDirectoryEntry = StructDefinition({
+   StructField(
+      offsetof(DebugDirectoryEntry, DebugDirectoryEntry::characteristics),
+      sizeof(DebugDirectoryEntry::characteristics),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Characteristics (reserved)")),
+
+   StructField(
+      offsetof(DebugDirectoryEntry, DebugDirectoryEntry::timeStamp),
+      sizeof(DebugDirectoryEntry::timeStamp),
+      4,
+      true, // little-endian
+      [](LPCVOID data, size_t)
+      {
+         time_t time = *reinterpret_cast<const DWORD*>(data);
+         return DisplayFormatHelper::FormatDateTime(time);
+      },
+      _T("Time stamp")),
+
+   StructField(
+      offsetof(DebugDirectoryEntry, DebugDirectoryEntry::majorVersion),
+      sizeof(DebugDirectoryEntry::majorVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Major version")),
+
+   StructField(
+      offsetof(DebugDirectoryEntry, DebugDirectoryEntry::minorVersion),
+      sizeof(DebugDirectoryEntry::minorVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Minor version")),
+
+   StructField(
+      offsetof(DebugDirectoryEntry, DebugDirectoryEntry::type),
+      sizeof(DebugDirectoryEntry::type),
+      4,
+      true, // little-endian
+      StructFieldType::valueMapping,
+      g_mapDebugTypeToDisplayText,
+      _T("Debug type")),
+
+   StructField(
+      offsetof(DebugDirectoryEntry, DebugDirectoryEntry::sizeOfData),
+      sizeof(DebugDirectoryEntry::sizeOfData),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of data")),
+
+   StructField(
+      offsetof(DebugDirectoryEntry, DebugDirectoryEntry::addressOfRawData),
+      sizeof(DebugDirectoryEntry::addressOfRawData),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Address of raw data (RVA)")),
+
+   StructField(
+      offsetof(DebugDirectoryEntry, DebugDirectoryEntry::pointerToRawData),
+      sizeof(DebugDirectoryEntry::pointerToRawData),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("File offset to raw data")),
+   });
+
+const StructDefinition g_definitionCodeViewRsdsRecord = StructDefinition({
+   StructField(
+      offsetof(CodeViewRsdsRecord, CodeViewRsdsRecord::signature),
+      sizeof(CodeViewRsdsRecord::signature),
+      1,
+      true, // little-endian
+      StructFieldType::text,
+      _T("Signature")),
+
+   StructField(
+      offsetof(CodeViewRsdsRecord, CodeViewRsdsRecord::guid),
+      sizeof(CodeViewRsdsRecord::guid),
+      1,
+      true, // little-endian
+      [](LPCVOID data, size_t size)
+      {
+         return DisplayFormatHelper::FormatGUID((const BYTE*)data, size);
+      },
+      _T("PDB signature GUID")),
+
+   StructField(
+      offsetof(CodeViewRsdsRecord, CodeViewRsdsRecord::age),
+      sizeof(CodeViewRsdsRecord::age),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("PDB age")),
+   });
@@ -0,0 +1,99 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file DebugDirectory.hpp
+/// \brief debug directory and CodeView record definitions
+//
+#pragma once
+
+#include "StructDefinition.hpp"
+
+#pragma pack(push, 1)
+
+/// \brief Debug directory entry
+/// \see https://learn.microsoft.com/en-us/windows/win32/debug/pe-format#debug-directory-image-only
+/// The entry corresponds with winnt.h's IMAGE_DEBUG_DIRECTORY struct.
+struct DebugDirectoryEntry
+{
+   DWORD characteristics;     ///< reserved, must be zero
+   DWORD timeStamp;           ///< time stamp the debug data was created
+   WORD majorVersion;         ///< major version of the debug data format
+   WORD minorVersion;         ///< minor version of the debug data format
+   DWORD type;                ///< debug data format type; see IMAGE_DEBUG_TYPE_* values
+   DWORD sizeOfData;          ///< size of debug data, not including this entry
+   DWORD addressOfRawData;    ///< RVA of the debug data when loaded, or 0
+   DWORD pointerToRawData;    ///< file offset of the debug data
+};
+
+/// \brief CodeView RSDS record, referencing a PDB 7.0 file
+/// \details The record is followed by the zero-terminated UTF-8 PDB path.
+struct CodeViewRsdsRecord
+{
+   DWORD signature;           ///< must be 'RSDS'
+   GUID guid;                 ///< PDB signature GUID
+   DWORD age;                 ///< PDB age
+};
+
+/// \brief CodeView NB10 record, referencing a PDB 2.0 file
+/// \details The record is followed by the zero-terminated PDB path.
+struct CodeViewNb10Record
+{
+   DWORD signature;           ///< must be 'NB10'
+   DWORD offset;              ///< offset of debug info; always 0 for PDB files
+   DWORD timeStamp;           ///< PDB signature time stamp
+   DWORD age;                 ///< PDB age
+};
+
+/// \brief VC feature record
+/// \details Contains counters of object files compiled with specific features.
+struct VcFeatureRecord
+{
+   DWORD preVC11Count;        ///< number of objects compiled with pre-VC++ 11.00 compilers
+   DWORD cppCount;            ///< number of C/C++ objects
+   DWORD gsCount;             ///< number of objects compiled with /GS
+   DWORD sdlCount;            ///< number of objects compiled with /sdl
+   DWORD guardNCount;         ///< number of objects compiled with /guardN
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(DebugDirectoryEntry) == 28,
+   "Debug directory entry must be 28 bytes long");
+
+static_assert(sizeof(DebugDirectoryEntry) == sizeof(IMAGE_DEBUG_DIRECTORY),
+   "Debug directory entry must have same size as IMAGE_DEBUG_DIRECTORY");
+
+static_assert(sizeof(CodeViewRsdsRecord) == 24, "CodeView RSDS record must be 24 bytes long");
+static_assert(sizeof(CodeViewNb10Record) == 16, "CodeView NB10 record must be 16 bytes long");
+static_assert(sizeof(VcFeatureRecord) == 20, "VC feature record must be 20 bytes long");
+
+/// debug directory type for CodeView records
+constexpr DWORD c_debugTypeCodeView = 2;
+
+/// debug directory type for VC feature records
+constexpr DWORD c_debugTypeVcFeature = 12;
+
+/// debug directory type for POGO (profile guided optimization) records
+constexpr DWORD c_debugTypePogo = 13;
+
+/// debug directory type for repro (deterministic build) records
+constexpr DWORD c_debugTypeRepro = 16;
+
+/// debug directory type for extended DLL characteristics
+constexpr DWORD c_debugTypeExDllCharacteristics = 20;
+
+/// CodeView record signature 'RSDS'
+constexpr DWORD c_codeViewSignatureRsds = 0x53445352;
+
+/// CodeView record signature 'NB10'
+constexpr DWORD c_codeViewSignatureNb10 = 0x3031424e;
+
+/// mapping of debug directory type to display text
+extern const std::map<DWORD, LPCTSTR> g_mapDebugTypeToDisplayText;
+
+/// struct definition for above debug directory entry
+extern const StructDefinition g_definitionDebugDirectoryEntry;
+
+/// struct definition for above CodeView RSDS record
+extern const StructDefinition g_definitionCodeViewRsdsRecord;
@@ -0,0 +1,293 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file DebugDirectoryTable.cpp
+/// \brief debug directory entries and their debug records
+//
+#include "stdafx.h"
+#include "DebugDirectoryTable.hpp"
+#include "DebugDirectory.hpp"
+#include "PortableExecutableImage.hpp"
+#include "OptionalHeader.hpp"
+#include "modules/DisplayFormatHelper.hpp"
+
+/// POGO record signature 'LTCG'
+constexpr DWORD c_pogoSignatureLtcg = 0x4C544347;
+
+/// POGO record signature 'PGU\0'
+constexpr DWORD c_pogoSignaturePgu = 0x50475500;
+
+/// mapping of extended DLL characteristics flags to display text
+static const std::map<DWORD, LPCTSTR> g_mapExDllCharacteristicsToDisplayText =
+{
+   { 0x0001, _T("IMAGE_DLLCHARACTERISTICS_EX_CET_COMPAT") },
+   { 0x0002, _T("IMAGE_DLLCHARACTERISTICS_EX_CET_COMPAT_STRICT_MODE") },
+   { 0x0004, _T("IMAGE_DLLCHARACTERISTICS_EX_CET_SET_CONTEXT_IP_VALIDATION_RELAXED_MODE") },
+   { 0x0008, _T("IMAGE_DLLCHARACTERISTICS_EX_CET_DYNAMIC_APIS_ALLOW_IN_PROC") },
+   { 0x0040, _T("IMAGE_DLLCHARACTERISTICS_EX_FORWARD_CFI_COMPAT") },
+   { 0x0080, _T("IMAGE_DLLCHARACTERISTICS_EX_HOTPATCH_COMPATIBLE") },
+};
+
+/// reads a zero-terminated string with given maximum length
+static CStringA ReadZeroTerminatedString(const BYTE* data, size_t maxLength)
+{
+   const char* text = reinterpret_cast<const char*>(data);
+   return CStringA{ text, static_cast<int>(strnlen(text, maxLength)) };
+}
+
+CString CodeViewPdbInfo::FormatSymbolServerKey() const
+{
+   CString pdbFilename = Path::FilenameOnly(pdbPath);
+
+   CString signature;
+   if (isRsds)
+   {
+      signature.Format(_T("%08X%04X%04X"),
+         guid.Data1, guid.Data2, guid.Data3);
+
+      for (BYTE value : guid.Data4)
+         signature.AppendFormat(_T("%02X"), value);
+   }
+   else
+      signature.Format(_T("%08X"), timeStamp);
+
+   signature.AppendFormat(_T("%X"), age);
+
+   return pdbFilename + _T("/") + signature + _T("/") + pdbFilename;
+}
+
+DebugDirectoryTable::DebugDirectoryTable(const PortableExecutableImage& image)
+   :m_image(image)
+{
+   const DataDirectoryEntry* debugDirectory =
+      image.GetDataDirectory(DataDirectoryIndex::debug);
+
+   if (debugDirectory == nullptr)
+      return;
+
+   size_t count = debugDirectory->size / sizeof(DebugDirectoryEntry);
+
+   const DebugDirectoryEntry* entries =
+      image.DataAtRva<DebugDirectoryEntry>(debugDirectory->virtualAddress, count);
+
+   if (entries == nullptr)
+      return;
+
+   m_entries = entries;
+   m_count = count;
+}
+
+const DebugDirectoryEntry& DebugDirectoryTable::Entry(size_t index) const
+{
+   ATLASSERT(index < m_count);
+   return m_entries[index];
+}
+
+size_t DebugDirectoryTable::EntryOffset(size_t index) const
+{
+   return m_image.GetFile().OffsetOf(&Entry(index));
+}
+
+const BYTE* DebugDirectoryTable::RecordData(size_t index) const
+{
+   const DebugDirectoryEntry& entry = Entry(index);
+   if (entry.sizeOfData == 0)
+      return nullptr;
+
+   // the file offset is also set for records that aren't loaded into memory
+   const File& file = m_image.GetFile();
+   if (entry.pointerToRawData != 0 &&
+      size_t(entry.pointerToRawData) + entry.sizeOfData <= file.Size())
+      return file.Data<BYTE>(entry.pointerToRawData);
+
+   if (entry.addressOfRawData != 0)
+      return m_image.DataAtRva<BYTE>(entry.addressOfRawData, entry.sizeOfData);
+
+   return nullptr;
+}
+
+CString DebugDirectoryTable::TypeName(size_t index) const
+{
+   return GetValueFromMapOrDefault<DWORD>(
+      g_mapDebugTypeToDisplayText,
+      Entry(index).type,
+      _T("unknown"));
+}
+
+std::optional<CodeViewPdbInfo> DebugDirectoryTable::GetCodeViewPdbInfo(size_t index) const
+{
+   const DebugDirectoryEntry& entry = Entry(index);
+   const BYTE* data = RecordData(index);
+
+   if (entry.type != c_debugTypeCodeView ||
+      data == nullptr ||
+      entry.sizeOfData < sizeof(DWORD))
+      return std::nullopt;
+
+   CodeViewPdbInfo info;
+
+   DWORD signature = *reinterpret_cast<const DWORD*>(data);
+   if (signature == c_codeViewSignatureRsds &&
+      entry.sizeOfData >= sizeof(CodeViewRsdsRecord))
+   {
+      const CodeViewRsdsRecord& record = *reinterpret_cast<const CodeViewRsdsRecord*>(data);
+
+      info.isRsds = true;
+      info.guid = record.guid;
+      info.age = record.age;
+
+      // RSDS records store the path as UTF-8
+      CStringA pdbPath = ReadZeroTerminatedString(
+         data + sizeof(CodeViewRsdsRecord),
+         entry.sizeOfData - sizeof(CodeViewRsdsRecord));
+
+      info.pdbPath = CA2T(pdbPath, CP_UTF8);
+   }
+   else if (signature == c_codeViewSignatureNb10 &&
+      entry.sizeOfData >= sizeof(CodeViewNb10Record))
+   {
+      const CodeViewNb10Record& record = *reinterpret_cast<const CodeViewNb10Record*>(data);
+
+      info.timeStamp = record.timeStamp;
+      info.age = record.age;
+
+      info.pdbPath = ReadZeroTerminatedString(
+         data + sizeof(CodeViewNb10Record),
+         entry.sizeOfData - sizeof(CodeViewNb10Record));
+   }
+   else
+      return std::nullopt;
+
+   return info;
+}
+
+std::vector<PogoEntry> DebugDirectoryTable::GetPogoEntries(size_t index) const
+{
+   std::vector<PogoEntry> pogoEntries;
+
+   const DebugDirectoryEntry& entry = Entry(index);
+   const BYTE* data = RecordData(index);
+
+   if (entry.type != c_debugTypePogo ||
+      data == nullptr ||
+      entry.sizeOfData < sizeof(DWORD))
+      return pogoEntries;
+
+   DWORD signature = *reinterpret_cast<const DWORD*>(data);
+   if (signature != c_pogoSignatureLtcg &&
+      signature != c_pogoSignaturePgu)
+      return pogoEntries;
+
+   // each entry consists of start RVA, size and a zero-terminated name; the
+   // name is padded so that the next entry starts on a 4-byte boundary
+   size_t offset = sizeof(DWORD);
+   while (offset + 2 * sizeof(DWORD) < entry.sizeOfData)
+   {
+      const DWORD* values = reinterpret_cast<const DWORD*>(data + offset);
+
+      PogoEntry pogoEntry;
+      pogoEntry.startAddress = values[0];
+      pogoEntry.size = values[1];
+
+      offset += 2 * sizeof(DWORD);
+
+      CStringA name = ReadZeroTerminatedString(data + offset, entry.sizeOfData - offset);
+      pogoEntry.name = name;
+
+      pogoEntries.push_back(pogoEntry);
+
+      offset += (name.GetLength() + 1 + 3) & ~size_t(3);
+   }
+
+   return pogoEntries;
+}
+
+CString DebugDirectoryTable::FormatRecord(size_t index) const
+{
+   const DebugDirectoryEntry& entry = Entry(index);
+   const BYTE* data = RecordData(index);
+
+   CString text;
+   switch (entry.type)
+   {
+   case c_debugTypeCodeView:
+   {
+      std::optional<CodeViewPdbInfo> pdbInfo = GetCodeViewPdbInfo(index);
+      if (!pdbInfo.has_value())
+      {
+         text = _T("Unknown or invalid CodeView record");
+         break;
+      }
+
+      if (pdbInfo->isRsds)
+         text.Format(_T("RSDS, GUID %s, age %u, PDB: %s"),
+            DisplayFormatHelper::FormatGUID(
+               reinterpret_cast<const BYTE*>(&pdbInfo->guid), sizeof(GUID)).GetString(),
+            pdbInfo->age,
+            pdbInfo->pdbPath.GetString());
+      else
+         text.Format(_T("NB10, time stamp 0x%08x, age %u, PDB: %s"),
+            pdbInfo->timeStamp,
+            pdbInfo->age,
+            pdbInfo->pdbPath.GetString());
+      break;
+   }
+
+   case c_debugTypePogo:
+      text.Format(_T("%zu POGO entries"), GetPogoEntries(index).size());
+      break;
+
+   case c_debugTypeRepro:
+      if (entry.sizeOfData == 0)
+         text = _T("Deterministic build, no hash");
+      else if (data != nullptr &&
+         entry.sizeOfData >= sizeof(DWORD))
+      {
+         DWORD hashLength = std::min<DWORD>(
+            *reinterpret_cast<const DWORD*>(data),
+            entry.sizeOfData - sizeof(DWORD));
+
+         text = _T("Deterministic build, hash ");
+         for (DWORD hashIndex = 0; hashIndex < hashLength; hashIndex++)
+            text.AppendFormat(_T("%02x"), data[sizeof(DWORD) + hashIndex]);
+      }
+      break;
+
+   case c_debugTypeVcFeature:
+      if (data != nullptr &&
+         entry.sizeOfData >= sizeof(VcFeatureRecord))
+      {
+         const VcFeatureRecord& record = *reinterpret_cast<const VcFeatureRecord*>(data);
+         text.Format(_T("Pre-VC++ 11.00: %u, C/C++: %u, /GS: %u, /sdl: %u, guardN: %u"),
+            record.preVC11Count,
+            record.cppCount,
+            record.gsCount,
+            record.sdlCount,
+            record.guardNCount);
+      }
+      break;
+
+   case c_debugTypeExDllCharacteristics:
+      if (data != nullptr &&
+         entry.sizeOfData >= sizeof(DWORD))
+      {
+         text = DisplayFormatHelper::FormatBitFlagsFromMap(
+            g_mapExDllCharacteristicsToDisplayText,
+            *reinterpret_cast<const DWORD*>(data));
+
+         text.Replace(_T("\n"), _T(" "));
+      }
+      break;
+
+   default:
+      break;
+   }
+
+   if (text.IsEmpty() &&
+      entry.sizeOfData != 0 &&
+      data == nullptr)
+      text = _T("Error: Debug record isn't stored in the file");
+
+   return text;
+}
@@ -0,0 +1,99 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file DebugDirectoryTable.hpp
+/// \brief debug directory entries and their debug records
+//
+#pragma once
+
+#include <optional>
+
+class PortableExecutableImage;
+struct DebugDirectoryEntry;
+
+/// \brief PDB reference stored in a CodeView debug record
+struct CodeViewPdbInfo
+{
+   /// indicates if the record is a RSDS (PDB 7.0) record; otherwise it's NB10
+   bool isRsds = false;
+
+   /// PDB signature GUID; only set for RSDS records
+   GUID guid = {};
+
+   /// PDB signature time stamp; only set for NB10 records
+   DWORD timeStamp = 0;
+
+   /// PDB age
+   DWORD age = 0;
+
+   /// PDB path, as stored by the linker
+   CString pdbPath;
+
+   /// formats the key used to look up the PDB on a symbol server, in the
+   /// form "pdbname/SIGNATUREAGE/pdbname"
+   CString FormatSymbolServerKey() const;
+};
+
+/// \brief POGO (profile guided optimization) debug record entry
+struct PogoEntry
+{
+   /// start RVA of the code or data range
+   DWORD startAddress = 0;
+
+   /// size of the range, in bytes
+   DWORD size = 0;
+
+   /// name of the section part, e.g. ".text$mn"
+   CString name;
+};
+
+/// \brief Debug directory table
+/// \details Provides access to the entries of the debug directory of a PE
+/// image and decodes the most common debug records. Only the directory and
+/// the records themselves are accessed, so that the debug infos can be read
+/// without processing any other part of the image.
+class DebugDirectoryTable
+{
+public:
+   /// ctor; locates the debug directory of the image
+   explicit DebugDirectoryTable(const PortableExecutableImage& image);
+
+   /// returns if the image has a valid debug directory
+   bool IsAvailable() const { return m_entries != nullptr; }
+
+   /// returns the number of debug directory entries
+   size_t Count() const { return m_count; }
+
+   /// returns the debug directory entry with given index
+   const DebugDirectoryEntry& Entry(size_t index) const;
+
+   /// returns the file offset of the debug directory entry with given index
+   size_t EntryOffset(size_t index) const;
+
+   /// returns pointer to the debug record of the entry with given index, or
+   /// nullptr when the record isn't stored in the file
+   const BYTE* RecordData(size_t index) const;
+
+   /// returns the display text for the debug type of the entry
+   CString TypeName(size_t index) const;
+
+   /// decodes the CodeView record of the entry with given index
+   std::optional<CodeViewPdbInfo> GetCodeViewPdbInfo(size_t index) const;
+
+   /// decodes the POGO record of the entry with given index
+   std::vector<PogoEntry> GetPogoEntries(size_t index) const;
+
+   /// formats the debug record of the entry with given index as text
+   CString FormatRecord(size_t index) const;
+
+private:
+   /// PE image
+   const PortableExecutableImage& m_image;
+
+   /// pointer to first debug directory entry; nullptr when not available
+   const DebugDirectoryEntry* m_entries = nullptr;
+
+   /// number of entries
+   size_t m_count = 0;
+};
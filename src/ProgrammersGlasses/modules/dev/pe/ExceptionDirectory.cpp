@@ -0,0 +1,162 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ExceptionDirectory.cpp
+/// \brief exception directory (.pdata) and unwind info definitions
+//
+#include "stdafx.h"
+#include "ExceptionDirectory.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapUnwindInfoFlagsToDisplayText =
+{
+   { 0x01, _T("UNW_FLAG_EHANDLER") },
+   { 0x02, _T("UNW_FLAG_UHANDLER") },
+   { 0x04, _T("UNW_FLAG_CHAININFO") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapUnwindOperationToDisplayText =
+{
+   { 0, _T("UWOP_PUSH_NONVOL") },
+   { 1, _T("UWOP_ALLOC_LARGE") },
+   { 2, _T("UWOP_ALLOC_SMALL") },
+   { 3, _T("UWOP_SET_FPREG") },
+   { 4, _T("UWOP_SAVE_NONVOL") },
+   { 5, _T("UWOP_SAVE_NONVOL_FAR") },
+   { 6, _T("UWOP_EPILOG") },
+   { 7, _T("UWOP_SPARE_CODE") },
+   { 8, _T("UWOP_SAVE_XMM128") },
+   { 9, _T("UWOP_SAVE_XMM128_FAR") },
+   { 10, _T("UWOP_PUSH_MACHFRAME") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapUnwindRegisterX64ToDisplayText =
+{
+   { 0, _T("RAX") },
+   { 1, _T("RCX") },
+   { 2, _T("RDX") },
+   { 3, _T("RBX") },
+   { 4, _T("RSP") },
+   { 5, _T("RBP") },
+   { 6, _T("RSI") },
+   { 7, _T("RDI") },
+   { 8, _T("R8") },
+   { 9, _T("R9") },
+   { 10, _T("R10") },
+   { 11, _T("R11") },
+   { 12, _T("R12") },
+   { 13, _T("R13") },
+   { 14, _T("R14") },
+   { 15, _T("R15") },
+};
+
+/// ARM64 unwind data flag to display text mapping
+static const std::map<DWORD, LPCTSTR> g_mapUnwindDataFlagArm64ToDisplayText =
+{
+   { 0, _T(".xdata record RVA") },
+   { 1, _T("packed unwind data") },
+   { 2, _T("packed unwind data, function fragment") },
+   { 3, _T("reserved") },
+};
+
+/// ARM64 unwind data bitfield
+static const std::vector<BitfieldDescriptor> g_listUnwindDataArm64Bits =
+{
+   BitfieldDescriptor{ 0, 2, StructFieldType::valueMapping, g_mapUnwindDataFlagArm64ToDisplayText },
+   BitfieldDescriptor{ 2, 11 }, // function length / 4, when packed
+};
+
+/// x64 unwind info version and flags bitfield
+static const std::vector<BitfieldDescriptor> g_listUnwindInfoVersionAndFlagsBits =
+{
+   BitfieldDescriptor{ 0, 3 },
+   BitfieldDescriptor{ 3, 5, StructFieldType::flagsMapping, g_mapUnwindInfoFlagsToDisplayText },
+};
+
+/// x64 unwind info frame register and offset bitfield
+static const std::vector<BitfieldDescriptor> g_listUnwindInfoFrameRegisterBits =
+{
+   BitfieldDescriptor{ 0, 4, StructFieldType::valueMapping, g_mapUnwindRegisterX64ToDisplayText },
+   BitfieldDescriptor{ 4, 4 }, // offset / 16
+};
+
+const StructDefinition g_definitionRuntimeFunctionX64 = StructDefinition({
+   StructField(
+      offsetof(RuntimeFunctionX64, RuntimeFunctionX64::beginAddress),
+      sizeof(RuntimeFunctionX64::beginAddress),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Begin address (RVA)")),
+
+   StructField(
+      offsetof(RuntimeFunctionX64, RuntimeFunctionX64::endAddress),
+      sizeof(RuntimeFunctionX64::endAddress),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("End address (RVA)")),
+
+   StructField(
+      offsetof(RuntimeFunctionX64, RuntimeFunctionX64::unwindInfoAddress),
+      sizeof(RuntimeFunctionX64::unwindInfoAddress),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Unwind info address (RVA)")),
+   });
+
+const StructDefinition g_definitionRuntimeFunctionArm64 = StructDefinition({
+   StructField(
+      offsetof(RuntimeFunctionArm64, RuntimeFunctionArm64::beginAddress),
+      sizeof(RuntimeFunctionArm64::beginAddress),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Begin address (RVA)")),
+
+   StructField(
+      offsetof(RuntimeFunctionArm64, RuntimeFunctionArm64::unwindData),
+      sizeof(RuntimeFunctionArm64::unwindData),
+      4,
+      true, // little-endian
+      StructFieldType::bitfieldMapping,
+      g_listUnwindDataArm64Bits,
+      _T("Unwind data (flag, packed function length / 4)")),
+   });
+
+const StructDefinition g_definitionUnwindInfoX64 = StructDefinition({
+   StructField(
+      offsetof(UnwindInfoX64, UnwindInfoX64::versionAndFlags),
+      sizeof(UnwindInfoX64::versionAndFlags),
+      1,
+      true, // little-endian
+      StructFieldType::bitfieldMapping,
+      g_listUnwindInfoVersionAndFlagsBits,
+      _T("Version and flags")),
+
+   StructField(
+      offsetof(UnwindInfoX64, UnwindInfoX64::sizeOfProlog),
+      sizeof(UnwindInfoX64::sizeOfProlog),
+      1,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of prolog")),
+
+   StructField(
+      offsetof(UnwindInfoX64, UnwindInfoX64::countOfCodes),
+      sizeof(UnwindInfoX64::countOfCodes),
+      1,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Count of unwind codes")),
+
+   StructField(
+      offsetof(UnwindInfoX64, UnwindInfoX64::frameRegisterAndOffset),
+      sizeof(UnwindInfoX64::frameRegisterAndOffset),
+      1,
+      true, // little-endian
+      StructFieldType::bitfieldMapping,
+      g_listUnwindInfoFrameRegisterBits,
+      _T("Frame register and offset / 16")),
+   });
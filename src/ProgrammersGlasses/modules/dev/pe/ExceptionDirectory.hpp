@@ -0,0 +1,86 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ExceptionDirectory.hpp
+/// \brief exception directory (.pdata) and unwind info definitions
+//
+#pragma once
+
+#include "StructDefinition.hpp"
+
+#pragma pack(push, 1)
+
+/// \brief x64 function table entry
+/// \see https://learn.microsoft.com/en-us/cpp/build/exception-handling-x64
+/// The entry corresponds with winnt.h's IMAGE_RUNTIME_FUNCTION_ENTRY struct
+/// for AMD64 images. Entries are sorted by begin address.
+struct RuntimeFunctionX64
+{
+   DWORD beginAddress;        ///< RVA of function start
+   DWORD endAddress;          ///< RVA of function end, exclusive
+   DWORD unwindInfoAddress;   ///< RVA of UNWIND_INFO struct
+};
+
+/// \brief ARM64 function table entry
+/// \see https://learn.microsoft.com/en-us/cpp/build/arm64-exception-handling
+/// When the lower two bits of the unwind data are 0, the value is the RVA of
+/// the .xdata record; otherwise it contains packed unwind data.
+struct RuntimeFunctionArm64
+{
+   DWORD beginAddress;        ///< RVA of function start
+   DWORD unwindData;          ///< packed unwind data, or RVA of .xdata record
+};
+
+/// \brief x64 unwind info header
+/// \details The header is followed by an array of countOfCodes UNWIND_CODE
+/// slots (UnwindCodeX64), padded to an even count, and then optionally by an
+/// exception handler RVA or a chained RuntimeFunctionX64 entry.
+struct UnwindInfoX64
+{
+   BYTE versionAndFlags;         ///< bits 0-2: version, bits 3-7: UNW_FLAG_* flags
+   BYTE sizeOfProlog;            ///< length of function prolog, in bytes
+   BYTE countOfCodes;            ///< number of unwind code slots
+   BYTE frameRegisterAndOffset;  ///< bits 0-3: frame register, bits 4-7: scaled frame offset
+};
+
+/// x64 unwind code slot
+struct UnwindCodeX64
+{
+   BYTE codeOffset;        ///< offset of the end of the prolog instruction
+   BYTE unwindOpAndInfo;   ///< bits 0-3: UWOP_* operation, bits 4-7: operation info
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(RuntimeFunctionX64) == 12, "x64 runtime function entry must be 12 bytes long");
+static_assert(sizeof(RuntimeFunctionArm64) == 8, "ARM64 runtime function entry must be 8 bytes long");
+static_assert(sizeof(UnwindInfoX64) == 4, "x64 unwind info header must be 4 bytes long");
+static_assert(sizeof(UnwindCodeX64) == 2, "x64 unwind code must be 2 bytes long");
+
+/// unwind info flag: function has an exception handler
+constexpr BYTE c_unwindFlagExceptionHandler = 0x01;
+
+/// unwind info flag: function has a termination handler
+constexpr BYTE c_unwindFlagTerminationHandler = 0x02;
+
+/// unwind info flag: unwind info is chained to a previous function entry
+constexpr BYTE c_unwindFlagChainInfo = 0x04;
+
+/// mapping of x64 unwind info flags to display text
+extern const std::map<DWORD, LPCTSTR> g_mapUnwindInfoFlagsToDisplayText;
+
+/// mapping of x64 unwind operation codes to display text
+extern const std::map<DWORD, LPCTSTR> g_mapUnwindOperationToDisplayText;
+
+/// mapping of x64 register numbers, as used in unwind codes, to display text
+extern const std::map<DWORD, LPCTSTR> g_mapUnwindRegisterX64ToDisplayText;
+
+/// struct definition for above x64 runtime function entry
+extern const StructDefinition g_definitionRuntimeFunctionX64;
+
+/// struct definition for above ARM64 runtime function entry
+extern const StructDefinition g_definitionRuntimeFunctionArm64;
+
+/// struct definition for above x64 unwind info header
+extern const StructDefinition g_definitionUnwindInfoX64;
@@ -0,0 +1,282 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ImageHashCalculator.cpp
+/// \brief PE image checksum and Authenticode digest calculation
+//
+#include "stdafx.h"
+#include "ImageHashCalculator.hpp"
+#include "PortableExecutableImage.hpp"
+#include "OptionalHeader.hpp"
+#include <bcrypt.h>
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <emmintrin.h>
+#endif
+
+#pragma comment(lib, "Bcrypt.lib")
+
+static_assert(offsetof(OptionalHeader32, checkSum) == offsetof(OptionalHeader64, checkSum),
+   "checksum field must be at the same offset in PE32 and PE32+ optional headers");
+
+/// size of blocks in which the mapped file is processed
+constexpr size_t c_blockSize = 1024 * 1024;
+
+/// \brief Sums up all little-endian 32-bit values in the given data
+/// \details Since 0x10000 equals 1 modulo 0xffff, the sum of all 32-bit values
+/// is congruent to the sum of all 16-bit values that the checksum is defined
+/// with. This allows adding four values at once using SIMD instructions,
+/// with the carries folded only once at the end. The size must be a multiple
+/// of 4.
+static ULONGLONG SumDwords(const BYTE* data, size_t size)
+{
+   ATLASSERT((size % sizeof(DWORD)) == 0);
+
+   ULONGLONG sum = 0;
+   size_t offset = 0;
+
+#if defined(_M_X64) || defined(_M_IX86)
+   const __m128i zero = _mm_setzero_si128();
+   __m128i sumLow = _mm_setzero_si128();
+   __m128i sumHigh = _mm_setzero_si128();
+
+   for (; offset + sizeof(__m128i) <= size; offset += sizeof(__m128i))
+   {
+      __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+
+      // widen to 64-bit lanes, so that the sums can't overflow
+      sumLow = _mm_add_epi64(sumLow, _mm_unpacklo_epi32(values, zero));
+      sumHigh = _mm_add_epi64(sumHigh, _mm_unpackhi_epi32(values, zero));
+   }
+
+   alignas(16) ULONGLONG lanes[2];
+   _mm_store_si128(reinterpret_cast<__m128i*>(lanes), _mm_add_epi64(sumLow, sumHigh));
+   sum = lanes[0] + lanes[1];
+#endif
+
+   for (; offset < size; offset += sizeof(DWORD))
+      sum += *reinterpret_cast<const DWORD*>(data + offset);
+
+   return sum;
+}
+
+ImageHashCalculator::ImageHashCalculator(const PortableExecutableImage& image)
+   :m_image(image),
+   m_checksumOffset(image.OptionalHeaderOffset() + offsetof(OptionalHeader32, checkSum))
+{
+}
+
+DWORD ImageHashCalculator::StoredChecksum() const
+{
+   return *m_image.GetFile().Data<DWORD>(m_checksumOffset);
+}
+
+DWORD ImageHashCalculator::CalculateChecksum() const
+{
+   const File& file = m_image.GetFile();
+   const BYTE* data = file.Data<BYTE>();
+   size_t fileSize = file.Size();
+
+   // process the file in blocks, with the last incomplete DWORD separately
+   size_t alignedSize = fileSize & ~size_t(sizeof(DWORD) - 1);
+
+   ULONGLONG sum = 0;
+   for (size_t blockOffset = 0; blockOffset < alignedSize; blockOffset += c_blockSize)
+      sum += SumDwords(data + blockOffset, std::min(c_blockSize, alignedSize - blockOffset));
+
+   // odd bytes are padded with zero bytes
+   DWORD lastValue = 0;
+   for (size_t offset = alignedSize; offset < fileSize; offset++)
+      lastValue |= DWORD(data[offset]) << (8 * (offset - alignedSize));
+
+   sum += lastValue;
+
+   // the checksum field itself is treated as zero
+   DWORD storedChecksum = StoredChecksum();
+   sum -= (storedChecksum & 0xffff) + (storedChecksum >> 16);
+
+   while ((sum >> 16) != 0)
+      sum = (sum & 0xffff) + (sum >> 16);
+
+   return static_cast<DWORD>(sum + fileSize);
+}
+
+std::vector<std::pair<size_t, size_t>> ImageHashCalculator::GetAuthenticodeRanges() const
+{
+   const File& file = m_image.GetFile();
+
+   // the checksum, the security data directory entry and the certificate
+   // table itself are excluded from the digest
+   std::vector<std::pair<size_t, size_t>> excludedRanges;
+   excludedRanges.push_back(std::make_pair(m_checksumOffset, sizeof(DWORD)));
+
+   size_t securityIndex = static_cast<size_t>(DataDirectoryIndex::certificateTable);
+   if (securityIndex < m_image.NumberOfDataDirectories())
+   {
+      const DataDirectoryEntry& securityEntry = m_image.DataDirectories()[securityIndex];
+
+      excludedRanges.push_back(std::make_pair(
+         file.OffsetOf(&securityEntry),
+         sizeof(DataDirectoryEntry)));
+
+      // the certificate table address is a file offset, not an RVA
+      if (securityEntry.virtualAddress != 0 &&
+         size_t(securityEntry.virtualAddress) + securityEntry.size <= file.Size())
+      {
+         excludedRanges.push_back(std::make_pair(
+            size_t(securityEntry.virtualAddress),
+            size_t(securityEntry.size)));
+      }
+   }
+
+   std::sort(excludedRanges.begin(), excludedRanges.end());
+
+   // the spec hashes headers and sections ordered by file offset, followed by
+   // any remaining data; for well-formed images this covers the same bytes
+   // as hashing the file in order, omitting the excluded ranges
+   std::vector<std::pair<size_t, size_t>> ranges;
+
+   size_t offset = 0;
+   for (const auto& [excludedOffset, excludedSize] : excludedRanges)
+   {
+      if (excludedOffset > offset)
+         ranges.push_back(std::make_pair(offset, excludedOffset - offset));
+
+      offset = std::max(offset, excludedOffset + excludedSize);
+   }
+
+   if (offset < file.Size())
+      ranges.push_back(std::make_pair(offset, file.Size() - offset));
+
+   return ranges;
+}
+
+std::vector<BYTE> ImageHashCalculator::CalculateAuthenticodeDigest(LPCWSTR algorithmId) const
+{
+   BCRYPT_ALG_HANDLE algorithmHandle = nullptr;
+   NTSTATUS status = ::BCryptOpenAlgorithmProvider(&algorithmHandle, algorithmId, nullptr, 0);
+   if (!BCRYPT_SUCCESS(status))
+      return std::vector<BYTE>();
+
+   std::shared_ptr<void> algorithm{ algorithmHandle,
+      [](BCRYPT_ALG_HANDLE handle) { ::BCryptCloseAlgorithmProvider(handle, 0); } };
+
+   DWORD hashLength = 0;
+   ULONG resultSize = 0;
+   status = ::BCryptGetProperty(algorithm.get(), BCRYPT_HASH_LENGTH,
+      reinterpret_cast<PUCHAR>(&hashLength), sizeof(hashLength), &resultSize, 0);
+   if (!BCRYPT_SUCCESS(status))
+      return std::vector<BYTE>();
+
+   BCRYPT_HASH_HANDLE hashHandle = nullptr;
+   status = ::BCryptCreateHash(algorithm.get(), &hashHandle, nullptr, 0, nullptr, 0, 0);
+   if (!BCRYPT_SUCCESS(status))
+      return std::vector<BYTE>();
+
+   std::shared_ptr<void> hash{ hashHandle,
+      [](BCRYPT_HASH_HANDLE handle) { ::BCryptDestroyHash(handle); } };
+
+   const BYTE* data = m_image.GetFile().Data<BYTE>();
+
+   for (const auto& [rangeOffset, rangeSize] : GetAuthenticodeRanges())
+   {
+      for (size_t offset = 0; offset < rangeSize; offset += c_blockSize)
+      {
+         ULONG blockSize = static_cast<ULONG>(std::min(c_blockSize, rangeSize - offset));
+
+         status = ::BCryptHashData(hash.get(),
+            const_cast<PUCHAR>(data + rangeOffset + offset), blockSize, 0);
+         if (!BCRYPT_SUCCESS(status))
+            return std::vector<BYTE>();
+      }
+   }
+
+   std::vector<BYTE> digest(hashLength);
+   status = ::BCryptFinishHash(hash.get(), digest.data(), hashLength, 0);
+   if (!BCRYPT_SUCCESS(status))
+      return std::vector<BYTE>();
+
+   return digest;
+}
+
+/// DER encoded hash algorithm OID, with BCrypt algorithm ID and digest length
+struct DigestAlgorithmInfo
+{
+   /// DER encoding of the algorithm OID, including tag and length
+   std::vector<BYTE> encodedOid;
+
+   /// BCrypt algorithm ID
+   LPCWSTR algorithmId;
+
+   /// display name
+   LPCTSTR displayName;
+
+   /// length of the digest, in bytes
+   size_t digestLength;
+};
+
+/// list of digest algorithms used in Authenticode signatures
+static const std::vector<DigestAlgorithmInfo> g_listDigestAlgorithms =
+{
+   { { 0x06, 0x05, 0x2b, 0x0e, 0x03, 0x02, 0x1a }, BCRYPT_SHA1_ALGORITHM, _T("SHA-1"), 20 },
+   { { 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x01 }, BCRYPT_SHA256_ALGORITHM, _T("SHA-256"), 32 },
+   { { 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x02 }, BCRYPT_SHA384_ALGORITHM, _T("SHA-384"), 48 },
+   { { 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x03 }, BCRYPT_SHA512_ALGORITHM, _T("SHA-512"), 64 },
+};
+
+std::optional<AuthenticodeDigest> ImageHashCalculator::ExtractSignedDigest(
+   const BYTE* signedData, size_t size)
+{
+   // The image digest is stored in the DigestInfo of the SpcIndirectDataContent
+   // as AlgorithmIdentifier, with optional NULL parameters, directly followed
+   // by the digest as OCTET STRING. The other occurences of the algorithm
+   // OIDs in the SignedData aren't followed by an OCTET STRING, so the
+   // DigestInfo can be found without fully decoding the ASN.1 structure.
+   for (size_t offset = 0; offset < size; offset++)
+   {
+      for (const DigestAlgorithmInfo& info : g_listDigestAlgorithms)
+      {
+         size_t oidLength = info.encodedOid.size();
+         if (offset + oidLength > size ||
+            memcmp(signedData + offset, info.encodedOid.data(), oidLength) != 0)
+            continue;
+
+         size_t digestOffset = offset + oidLength;
+
+         // skip NULL parameters
+         if (digestOffset + 2 <= size &&
+            signedData[digestOffset] == 0x05 &&
+            signedData[digestOffset + 1] == 0x00)
+            digestOffset += 2;
+
+         // the AlgorithmIdentifier SEQUENCE ends here; check for OCTET STRING
+         if (digestOffset + 2 + info.digestLength > size ||
+            signedData[digestOffset] != 0x04 ||
+            signedData[digestOffset + 1] != info.digestLength)
+            continue;
+
+         digestOffset += 2;
+
+         AuthenticodeDigest digest;
+         digest.algorithmId = info.algorithmId;
+         digest.digest.assign(
+            signedData + digestOffset,
+            signedData + digestOffset + info.digestLength);
+
+         return digest;
+      }
+   }
+
+   return std::nullopt;
+}
+
+LPCTSTR ImageHashCalculator::AlgorithmDisplayName(LPCWSTR algorithmId)
+{
+   for (const DigestAlgorithmInfo& info : g_listDigestAlgorithms)
+      if (wcscmp(info.algorithmId, algorithmId) == 0)
+         return info.displayName;
+
+   return _T("unknown");
+}
@@ -0,0 +1,65 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file ImageHashCalculator.hpp
+/// \brief PE image checksum and Authenticode digest calculation
+//
+#pragma once
+
+#include <optional>
+
+class PortableExecutableImage;
+
+/// \brief Authenticode digest, as stored in a signature
+struct AuthenticodeDigest
+{
+   /// BCrypt algorithm ID of the hash algorithm, e.g. BCRYPT_SHA256_ALGORITHM
+   LPCWSTR algorithmId = nullptr;
+
+   /// digest bytes
+   std::vector<BYTE> digest;
+};
+
+/// \brief PE image hash calculator
+/// \details Recalculates the image checksum stored in the optional header and
+/// the Authenticode digest of a PE image. Both calculations stream over the
+/// mapped file in large blocks; the checksum uses SIMD instructions and the
+/// digest uses the hash implementations of the Windows CNG API.
+class ImageHashCalculator
+{
+public:
+   /// ctor
+   explicit ImageHashCalculator(const PortableExecutableImage& image);
+
+   /// returns the checksum stored in the optional header
+   DWORD StoredChecksum() const;
+
+   /// calculates the image checksum, as done by CheckSumMappedFile()
+   DWORD CalculateChecksum() const;
+
+   /// calculates the Authenticode digest of the image, using the hash
+   /// algorithm with given BCrypt algorithm ID; returns an empty digest on
+   /// errors
+   std::vector<BYTE> CalculateAuthenticodeDigest(LPCWSTR algorithmId) const;
+
+   /// extracts the digest of the image from a PKCS#7 SignedData structure of
+   /// an Authenticode signature
+   static std::optional<AuthenticodeDigest> ExtractSignedDigest(
+      const BYTE* signedData, size_t size);
+
+   /// returns the display name of a BCrypt hash algorithm ID
+   static LPCTSTR AlgorithmDisplayName(LPCWSTR algorithmId);
+
+private:
+   /// returns the file ranges, as offset and size, that are covered by the
+   /// Authenticode digest
+   std::vector<std::pair<size_t, size_t>> GetAuthenticodeRanges() const;
+
+private:
+   /// PE image
+   const PortableExecutableImage& m_image;
+
+   /// file offset of the checksum field in the optional header
+   size_t m_checksumOffset = 0;
+};
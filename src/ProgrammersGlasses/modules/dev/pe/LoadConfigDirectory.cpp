@@ -0,0 +1,889 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file LoadConfigDirectory.cpp
+/// \brief load configuration directory definitions
+//
+#include "stdafx.h"
+#include "LoadConfigDirectory.hpp"
+#include "DisplayFormatHelper.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapGuardFlagsToDisplayText =
+{
+   { 0x00000100, _T("IMAGE_GUARD_CF_INSTRUMENTED") },
+   { 0x00000200, _T("IMAGE_GUARD_CFW_INSTRUMENTED") },
+   { 0x00000400, _T("IMAGE_GUARD_CF_FUNCTION_TABLE_PRESENT") },
+   { 0x00000800, _T("IMAGE_GUARD_SECURITY_COOKIE_UNUSED") },
+   { 0x00001000, _T("IMAGE_GUARD_PROTECT_DELAYLOAD_IAT") },
+   { 0x00002000, _T("IMAGE_GUARD_DELAYLOAD_IAT_IN_ITS_OWN_SECTION") },
+   { 0x00004000, _T("IMAGE_GUARD_CF_EXPORT_SUPPRESSION_INFO_PRESENT") },
+   { 0x00008000, _T("IMAGE_GUARD_CF_ENABLE_EXPORT_SUPPRESSION") },
+   { 0x00010000, _T("IMAGE_GUARD_CF_LONGJUMP_TABLE_PRESENT") },
+   { 0x00020000, _T("IMAGE_GUARD_RF_INSTRUMENTED") },
+   { 0x00040000, _T("IMAGE_GUARD_RF_ENABLE") },
+   { 0x00080000, _T("IMAGE_GUARD_RF_STRICT") },
+   { 0x00100000, _T("IMAGE_GUARD_RETPOLINE_PRESENT") },
+   { 0x00400000, _T("IMAGE_GUARD_EH_CONTINUATION_TABLE_PRESENT") },
+   { 0x00800000, _T("IMAGE_GUARD_XFG_ENABLED") },
+   { 0x01000000, _T("IMAGE_GUARD_CASTGUARD_PRESENT") },
+   { 0x02000000, _T("IMAGE_GUARD_MEMCPY_PRESENT") },
+   { 0x10000000, _T("IMAGE_GUARD_CF_FUNCTION_TABLE_SIZE (1 extra byte)") },
+   { 0x20000000, _T("IMAGE_GUARD_CF_FUNCTION_TABLE_SIZE (2 extra bytes)") },
+   { 0x40000000, _T("IMAGE_GUARD_CF_FUNCTION_TABLE_SIZE (4 extra bytes)") },
+   { 0x80000000, _T("IMAGE_GUARD_CF_FUNCTION_TABLE_SIZE (8 extra bytes)") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapGuardTableEntryFlagsToDisplayText =
+{
+   { 0x01, _T("IMAGE_GUARD_FLAG_FID_SUPPRESSED") },
+   { 0x02, _T("IMAGE_GUARD_FLAG_EXPORT_SUPPRESSED") },
+   { 0x04, _T("IMAGE_GUARD_FLAG_FID_LANGEXCPTHANDLER") },
+   { 0x08, _T("IMAGE_GUARD_FLAG_FID_XFG") },
+};
+
+const StructDefinition g_definitionLoadConfigDirectory32 = StructDefinition({
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::size),
+      sizeof(LoadConfigDirectory32::size),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::timeStamp),
+      sizeof(LoadConfigDirectory32::timeStamp),
+      4,
+      true, // little-endian
+      [](LPCVOID data, size_t)
+      {
+         time_t time = *reinterpret_cast<const DWORD*>(data);
+         return DisplayFormatHelper::FormatDateTime(time);
+      },
+      _T("Time stamp")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::majorVersion),
+      sizeof(LoadConfigDirectory32::majorVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Major version")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::minorVersion),
+      sizeof(LoadConfigDirectory32::minorVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Minor version")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::globalFlagsClear),
+      sizeof(LoadConfigDirectory32::globalFlagsClear),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Global flags clear")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::globalFlagsSet),
+      sizeof(LoadConfigDirectory32::globalFlagsSet),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Global flags set")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::criticalSectionDefaultTimeout),
+      sizeof(LoadConfigDirectory32::criticalSectionDefaultTimeout),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Critical section default timeout")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::deCommitFreeBlockThreshold),
+      sizeof(LoadConfigDirectory32::deCommitFreeBlockThreshold),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Decommit free block threshold")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::deCommitTotalFreeThreshold),
+      sizeof(LoadConfigDirectory32::deCommitTotalFreeThreshold),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Decommit total free threshold")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::lockPrefixTable),
+      sizeof(LoadConfigDirectory32::lockPrefixTable),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Lock prefix table (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::maximumAllocationSize),
+      sizeof(LoadConfigDirectory32::maximumAllocationSize),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Maximum allocation size")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::virtualMemoryThreshold),
+      sizeof(LoadConfigDirectory32::virtualMemoryThreshold),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Virtual memory threshold")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::processHeapFlags),
+      sizeof(LoadConfigDirectory32::processHeapFlags),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Process heap flags")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::processAffinityMask),
+      sizeof(LoadConfigDirectory32::processAffinityMask),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Process affinity mask")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::csdVersion),
+      sizeof(LoadConfigDirectory32::csdVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("CSD version")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::dependentLoadFlags),
+      sizeof(LoadConfigDirectory32::dependentLoadFlags),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Dependent load flags")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::editList),
+      sizeof(LoadConfigDirectory32::editList),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Edit list")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::securityCookie),
+      sizeof(LoadConfigDirectory32::securityCookie),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Security cookie (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::seHandlerTable),
+      sizeof(LoadConfigDirectory32::seHandlerTable),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("SE handler table (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::seHandlerCount),
+      sizeof(LoadConfigDirectory32::seHandlerCount),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("SE handler count")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardCFCheckFunctionPointer),
+      sizeof(LoadConfigDirectory32::guardCFCheckFunctionPointer),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard CF check function pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardCFDispatchFunctionPointer),
+      sizeof(LoadConfigDirectory32::guardCFDispatchFunctionPointer),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard CF dispatch function pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardCFFunctionTable),
+      sizeof(LoadConfigDirectory32::guardCFFunctionTable),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard CF function table (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardCFFunctionCount),
+      sizeof(LoadConfigDirectory32::guardCFFunctionCount),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard CF function count")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardFlags),
+      sizeof(LoadConfigDirectory32::guardFlags),
+      4,
+      true, // little-endian
+      StructFieldType::flagsMapping,
+      g_mapGuardFlagsToDisplayText,
+      _T("Guard flags")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::codeIntegrityFlags),
+      sizeof(LoadConfigDirectory32::codeIntegrityFlags),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Code integrity flags")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::codeIntegrityCatalog),
+      sizeof(LoadConfigDirectory32::codeIntegrityCatalog),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Code integrity catalog")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::codeIntegrityCatalogOffset),
+      sizeof(LoadConfigDirectory32::codeIntegrityCatalogOffset),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Code integrity catalog offset")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::codeIntegrityReserved),
+      sizeof(LoadConfigDirectory32::codeIntegrityReserved),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Code integrity reserved")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardAddressTakenIatEntryTable),
+      sizeof(LoadConfigDirectory32::guardAddressTakenIatEntryTable),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard address taken IAT entry table (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardAddressTakenIatEntryCount),
+      sizeof(LoadConfigDirectory32::guardAddressTakenIatEntryCount),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard address taken IAT entry count")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardLongJumpTargetTable),
+      sizeof(LoadConfigDirectory32::guardLongJumpTargetTable),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard long jump target table (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardLongJumpTargetCount),
+      sizeof(LoadConfigDirectory32::guardLongJumpTargetCount),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard long jump target count")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::dynamicValueRelocTable),
+      sizeof(LoadConfigDirectory32::dynamicValueRelocTable),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Dynamic value relocation table (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::chpeMetadataPointer),
+      sizeof(LoadConfigDirectory32::chpeMetadataPointer),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("CHPE metadata pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardRFFailureRoutine),
+      sizeof(LoadConfigDirectory32::guardRFFailureRoutine),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard RF failure routine (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardRFFailureRoutineFunctionPointer),
+      sizeof(LoadConfigDirectory32::guardRFFailureRoutineFunctionPointer),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard RF failure routine function pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::dynamicValueRelocTableOffset),
+      sizeof(LoadConfigDirectory32::dynamicValueRelocTableOffset),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Dynamic value relocation table offset")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::dynamicValueRelocTableSection),
+      sizeof(LoadConfigDirectory32::dynamicValueRelocTableSection),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Dynamic value relocation table section")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::reserved2),
+      sizeof(LoadConfigDirectory32::reserved2),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Reserved")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardRFVerifyStackPointerFunctionPointer),
+      sizeof(LoadConfigDirectory32::guardRFVerifyStackPointerFunctionPointer),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard RF verify stack pointer function pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::hotPatchTableOffset),
+      sizeof(LoadConfigDirectory32::hotPatchTableOffset),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Hot patch table offset")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::reserved3),
+      sizeof(LoadConfigDirectory32::reserved3),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Reserved")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::enclaveConfigurationPointer),
+      sizeof(LoadConfigDirectory32::enclaveConfigurationPointer),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Enclave configuration pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::volatileMetadataPointer),
+      sizeof(LoadConfigDirectory32::volatileMetadataPointer),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Volatile metadata pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardEHContinuationTable),
+      sizeof(LoadConfigDirectory32::guardEHContinuationTable),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard EH continuation table (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardEHContinuationCount),
+      sizeof(LoadConfigDirectory32::guardEHContinuationCount),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard EH continuation count")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardXFGCheckFunctionPointer),
+      sizeof(LoadConfigDirectory32::guardXFGCheckFunctionPointer),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard XFG check function pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardXFGDispatchFunctionPointer),
+      sizeof(LoadConfigDirectory32::guardXFGDispatchFunctionPointer),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard XFG dispatch function pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardXFGTableDispatchFunctionPointer),
+      sizeof(LoadConfigDirectory32::guardXFGTableDispatchFunctionPointer),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard XFG table dispatch function pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::castGuardOsDeterminedFailureMode),
+      sizeof(LoadConfigDirectory32::castGuardOsDeterminedFailureMode),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Cast guard OS determined failure mode (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory32, LoadConfigDirectory32::guardMemcpyFunctionPointer),
+      sizeof(LoadConfigDirectory32::guardMemcpyFunctionPointer),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard memcpy function pointer (VA)")),
+   });
+
+const StructDefinition g_definitionLoadConfigDirectory64 = StructDefinition({
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::size),
+      sizeof(LoadConfigDirectory64::size),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::timeStamp),
+      sizeof(LoadConfigDirectory64::timeStamp),
+      4,
+      true, // little-endian
+      [](LPCVOID data, size_t)
+      {
+         time_t time = *reinterpret_cast<const DWORD*>(data);
+         return DisplayFormatHelper::FormatDateTime(time);
+      },
+      _T("Time stamp")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::majorVersion),
+      sizeof(LoadConfigDirectory64::majorVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Major version")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::minorVersion),
+      sizeof(LoadConfigDirectory64::minorVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Minor version")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::globalFlagsClear),
+      sizeof(LoadConfigDirectory64::globalFlagsClear),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Global flags clear")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::globalFlagsSet),
+      sizeof(LoadConfigDirectory64::globalFlagsSet),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Global flags set")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::criticalSectionDefaultTimeout),
+      sizeof(LoadConfigDirectory64::criticalSectionDefaultTimeout),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Critical section default timeout")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::deCommitFreeBlockThreshold),
+      sizeof(LoadConfigDirectory64::deCommitFreeBlockThreshold),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Decommit free block threshold")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::deCommitTotalFreeThreshold),
+      sizeof(LoadConfigDirectory64::deCommitTotalFreeThreshold),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Decommit total free threshold")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::lockPrefixTable),
+      sizeof(LoadConfigDirectory64::lockPrefixTable),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Lock prefix table (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::maximumAllocationSize),
+      sizeof(LoadConfigDirectory64::maximumAllocationSize),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Maximum allocation size")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::virtualMemoryThreshold),
+      sizeof(LoadConfigDirectory64::virtualMemoryThreshold),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Virtual memory threshold")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::processAffinityMask),
+      sizeof(LoadConfigDirectory64::processAffinityMask),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Process affinity mask")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::processHeapFlags),
+      sizeof(LoadConfigDirectory64::processHeapFlags),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Process heap flags")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::csdVersion),
+      sizeof(LoadConfigDirectory64::csdVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("CSD version")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::dependentLoadFlags),
+      sizeof(LoadConfigDirectory64::dependentLoadFlags),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Dependent load flags")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::editList),
+      sizeof(LoadConfigDirectory64::editList),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Edit list")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::securityCookie),
+      sizeof(LoadConfigDirectory64::securityCookie),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Security cookie (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::seHandlerTable),
+      sizeof(LoadConfigDirectory64::seHandlerTable),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("SE handler table (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::seHandlerCount),
+      sizeof(LoadConfigDirectory64::seHandlerCount),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("SE handler count")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardCFCheckFunctionPointer),
+      sizeof(LoadConfigDirectory64::guardCFCheckFunctionPointer),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard CF check function pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardCFDispatchFunctionPointer),
+      sizeof(LoadConfigDirectory64::guardCFDispatchFunctionPointer),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard CF dispatch function pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardCFFunctionTable),
+      sizeof(LoadConfigDirectory64::guardCFFunctionTable),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard CF function table (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardCFFunctionCount),
+      sizeof(LoadConfigDirectory64::guardCFFunctionCount),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard CF function count")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardFlags),
+      sizeof(LoadConfigDirectory64::guardFlags),
+      4,
+      true, // little-endian
+      StructFieldType::flagsMapping,
+      g_mapGuardFlagsToDisplayText,
+      _T("Guard flags")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::codeIntegrityFlags),
+      sizeof(LoadConfigDirectory64::codeIntegrityFlags),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Code integrity flags")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::codeIntegrityCatalog),
+      sizeof(LoadConfigDirectory64::codeIntegrityCatalog),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Code integrity catalog")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::codeIntegrityCatalogOffset),
+      sizeof(LoadConfigDirectory64::codeIntegrityCatalogOffset),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Code integrity catalog offset")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::codeIntegrityReserved),
+      sizeof(LoadConfigDirectory64::codeIntegrityReserved),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Code integrity reserved")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardAddressTakenIatEntryTable),
+      sizeof(LoadConfigDirectory64::guardAddressTakenIatEntryTable),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard address taken IAT entry table (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardAddressTakenIatEntryCount),
+      sizeof(LoadConfigDirectory64::guardAddressTakenIatEntryCount),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard address taken IAT entry count")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardLongJumpTargetTable),
+      sizeof(LoadConfigDirectory64::guardLongJumpTargetTable),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard long jump target table (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardLongJumpTargetCount),
+      sizeof(LoadConfigDirectory64::guardLongJumpTargetCount),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard long jump target count")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::dynamicValueRelocTable),
+      sizeof(LoadConfigDirectory64::dynamicValueRelocTable),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Dynamic value relocation table (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::chpeMetadataPointer),
+      sizeof(LoadConfigDirectory64::chpeMetadataPointer),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("CHPE metadata pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardRFFailureRoutine),
+      sizeof(LoadConfigDirectory64::guardRFFailureRoutine),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard RF failure routine (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardRFFailureRoutineFunctionPointer),
+      sizeof(LoadConfigDirectory64::guardRFFailureRoutineFunctionPointer),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard RF failure routine function pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::dynamicValueRelocTableOffset),
+      sizeof(LoadConfigDirectory64::dynamicValueRelocTableOffset),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Dynamic value relocation table offset")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::dynamicValueRelocTableSection),
+      sizeof(LoadConfigDirectory64::dynamicValueRelocTableSection),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Dynamic value relocation table section")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::reserved2),
+      sizeof(LoadConfigDirectory64::reserved2),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Reserved")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardRFVerifyStackPointerFunctionPointer),
+      sizeof(LoadConfigDirectory64::guardRFVerifyStackPointerFunctionPointer),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard RF verify stack pointer function pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::hotPatchTableOffset),
+      sizeof(LoadConfigDirectory64::hotPatchTableOffset),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Hot patch table offset")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::reserved3),
+      sizeof(LoadConfigDirectory64::reserved3),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Reserved")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::enclaveConfigurationPointer),
+      sizeof(LoadConfigDirectory64::enclaveConfigurationPointer),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Enclave configuration pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::volatileMetadataPointer),
+      sizeof(LoadConfigDirectory64::volatileMetadataPointer),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Volatile metadata pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardEHContinuationTable),
+      sizeof(LoadConfigDirectory64::guardEHContinuationTable),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard EH continuation table (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardEHContinuationCount),
+      sizeof(LoadConfigDirectory64::guardEHContinuationCount),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard EH continuation count")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardXFGCheckFunctionPointer),
+      sizeof(LoadConfigDirectory64::guardXFGCheckFunctionPointer),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard XFG check function pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardXFGDispatchFunctionPointer),
+      sizeof(LoadConfigDirectory64::guardXFGDispatchFunctionPointer),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard XFG dispatch function pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardXFGTableDispatchFunctionPointer),
+      sizeof(LoadConfigDirectory64::guardXFGTableDispatchFunctionPointer),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard XFG table dispatch function pointer (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::castGuardOsDeterminedFailureMode),
+      sizeof(LoadConfigDirectory64::castGuardOsDeterminedFailureMode),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Cast guard OS determined failure mode (VA)")),
+
+   StructField(
+      offsetof(LoadConfigDirectory64, LoadConfigDirectory64::guardMemcpyFunctionPointer),
+      sizeof(LoadConfigDirectory64::guardMemcpyFunctionPointer),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Guard memcpy function pointer (VA)")),
+   });
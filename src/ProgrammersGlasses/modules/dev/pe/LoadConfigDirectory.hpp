@@ -0,0 +1,163 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file LoadConfigDirectory.hpp
+/// \brief load configuration directory definitions
+//
+#pragma once
+
+#include "StructDefinition.hpp"
+
+#pragma pack(push, 1)
+
+/// \brief Load configuration directory for PE32 images
+/// \see https://learn.microsoft.com/en-us/windows/win32/debug/pe-format#load-configuration-structure-image-only
+/// The struct corresponds with winnt.h's IMAGE_LOAD_CONFIG_DIRECTORY32 struct.
+/// The struct was extended over time; images may only contain the first
+/// size bytes.
+struct LoadConfigDirectory32
+{
+   DWORD size;                                       ///< size of the structure; older images have a smaller size
+   DWORD timeStamp;                                  ///< time stamp
+   WORD majorVersion;                                ///< major version
+   WORD minorVersion;                                ///< minor version
+   DWORD globalFlagsClear;                           ///< global flags to clear on process start
+   DWORD globalFlagsSet;                             ///< global flags to set on process start
+   DWORD criticalSectionDefaultTimeout;              ///< default critical section timeout
+   DWORD deCommitFreeBlockThreshold;                 ///< heap decommit free block threshold
+   DWORD deCommitTotalFreeThreshold;                 ///< heap decommit total free threshold
+   DWORD lockPrefixTable;                            ///< VA of lock prefix table; x86 only
+   DWORD maximumAllocationSize;                      ///< maximum heap allocation size
+   DWORD virtualMemoryThreshold;                     ///< virtual memory threshold
+   DWORD processHeapFlags;                           ///< process heap flags
+   DWORD processAffinityMask;                        ///< process affinity mask
+   WORD csdVersion;                                  ///< service pack version
+   WORD dependentLoadFlags;                          ///< default load flags for dependent DLLs
+   DWORD editList;                                   ///< reserved
+   DWORD securityCookie;                             ///< VA of the /GS security cookie
+   DWORD seHandlerTable;                             ///< VA of the sorted SafeSEH handler RVA table; x86 only
+   DWORD seHandlerCount;                             ///< number of SafeSEH handlers
+   DWORD guardCFCheckFunctionPointer;                ///< VA of the CFG check function pointer
+   DWORD guardCFDispatchFunctionPointer;             ///< VA of the CFG dispatch function pointer
+   DWORD guardCFFunctionTable;                       ///< VA of the CFG function table
+   DWORD guardCFFunctionCount;                       ///< number of CFG function table entries
+   DWORD guardFlags;                                 ///< CFG flags; the upper 4 bits contain the extra size of table entries
+   WORD codeIntegrityFlags;                          ///< code integrity flags
+   WORD codeIntegrityCatalog;                        ///< code integrity catalog index
+   DWORD codeIntegrityCatalogOffset;                 ///< code integrity catalog offset
+   DWORD codeIntegrityReserved;                      ///< reserved
+   DWORD guardAddressTakenIatEntryTable;             ///< VA of the table of address taken IAT entries
+   DWORD guardAddressTakenIatEntryCount;             ///< number of address taken IAT entries
+   DWORD guardLongJumpTargetTable;                   ///< VA of the long jump target table
+   DWORD guardLongJumpTargetCount;                   ///< number of long jump targets
+   DWORD dynamicValueRelocTable;                     ///< VA of the dynamic value relocation table
+   DWORD chpeMetadataPointer;                        ///< VA of the hybrid PE metadata
+   DWORD guardRFFailureRoutine;                      ///< VA of the RFG failure routine
+   DWORD guardRFFailureRoutineFunctionPointer;       ///< VA of the RFG failure routine function pointer
+   DWORD dynamicValueRelocTableOffset;               ///< offset of the dynamic value relocation table
+   WORD dynamicValueRelocTableSection;               ///< section of the dynamic value relocation table
+   WORD reserved2;                                   ///< reserved
+   DWORD guardRFVerifyStackPointerFunctionPointer;   ///< VA of the RFG stack pointer verify function pointer
+   DWORD hotPatchTableOffset;                        ///< offset of the hot patch table
+   DWORD reserved3;                                  ///< reserved
+   DWORD enclaveConfigurationPointer;                ///< VA of the enclave configuration
+   DWORD volatileMetadataPointer;                    ///< VA of the volatile metadata
+   DWORD guardEHContinuationTable;                   ///< VA of the EH continuation target table
+   DWORD guardEHContinuationCount;                   ///< number of EH continuation targets
+   DWORD guardXFGCheckFunctionPointer;               ///< VA of the XFG check function pointer
+   DWORD guardXFGDispatchFunctionPointer;            ///< VA of the XFG dispatch function pointer
+   DWORD guardXFGTableDispatchFunctionPointer;       ///< VA of the XFG table dispatch function pointer
+   DWORD castGuardOsDeterminedFailureMode;           ///< VA of the cast guard failure mode
+   DWORD guardMemcpyFunctionPointer;                 ///< VA of the guarded memcpy function pointer
+};
+
+/// \brief Load configuration directory for PE32+ images
+/// The struct corresponds with winnt.h's IMAGE_LOAD_CONFIG_DIRECTORY64 struct.
+struct LoadConfigDirectory64
+{
+   DWORD size;                                           ///< size of the structure; older images have a smaller size
+   DWORD timeStamp;                                      ///< time stamp
+   WORD majorVersion;                                    ///< major version
+   WORD minorVersion;                                    ///< minor version
+   DWORD globalFlagsClear;                               ///< global flags to clear on process start
+   DWORD globalFlagsSet;                                 ///< global flags to set on process start
+   DWORD criticalSectionDefaultTimeout;                  ///< default critical section timeout
+   ULONGLONG deCommitFreeBlockThreshold;                 ///< heap decommit free block threshold
+   ULONGLONG deCommitTotalFreeThreshold;                 ///< heap decommit total free threshold
+   ULONGLONG lockPrefixTable;                            ///< VA of lock prefix table; x86 only
+   ULONGLONG maximumAllocationSize;                      ///< maximum heap allocation size
+   ULONGLONG virtualMemoryThreshold;                     ///< virtual memory threshold
+   ULONGLONG processAffinityMask;                        ///< process affinity mask
+   DWORD processHeapFlags;                               ///< process heap flags
+   WORD csdVersion;                                      ///< service pack version
+   WORD dependentLoadFlags;                              ///< default load flags for dependent DLLs
+   ULONGLONG editList;                                   ///< reserved
+   ULONGLONG securityCookie;                             ///< VA of the /GS security cookie
+   ULONGLONG seHandlerTable;                             ///< VA of the sorted SafeSEH handler RVA table; x86 only
+   ULONGLONG seHandlerCount;                             ///< number of SafeSEH handlers
+   ULONGLONG guardCFCheckFunctionPointer;                ///< VA of the CFG check function pointer
+   ULONGLONG guardCFDispatchFunctionPointer;             ///< VA of the CFG dispatch function pointer
+   ULONGLONG guardCFFunctionTable;                       ///< VA of the CFG function table
+   ULONGLONG guardCFFunctionCount;                       ///< number of CFG function table entries
+   DWORD guardFlags;                                     ///< CFG flags; the upper 4 bits contain the extra size of table entries
+   WORD codeIntegrityFlags;                              ///< code integrity flags
+   WORD codeIntegrityCatalog;                            ///< code integrity catalog index
+   DWORD codeIntegrityCatalogOffset;                     ///< code integrity catalog offset
+   DWORD codeIntegrityReserved;                          ///< reserved
+   ULONGLONG guardAddressTakenIatEntryTable;             ///< VA of the table of address taken IAT entries
+   ULONGLONG guardAddressTakenIatEntryCount;             ///< number of address taken IAT entries
+   ULONGLONG guardLongJumpTargetTable;                   ///< VA of the long jump target table
+   ULONGLONG guardLongJumpTargetCount;                   ///< number of long jump targets
+   ULONGLONG dynamicValueRelocTable;                     ///< VA of the dynamic value relocation table
+   ULONGLONG chpeMetadataPointer;                        ///< VA of the hybrid PE metadata
+   ULONGLONG guardRFFailureRoutine;                      ///< VA of the RFG failure routine
+   ULONGLONG guardRFFailureRoutineFunctionPointer;       ///< VA of the RFG failure routine function pointer
+   DWORD dynamicValueRelocTableOffset;                   ///< offset of the dynamic value relocation table
+   WORD dynamicValueRelocTableSection;                   ///< section of the dynamic value relocation table
+   WORD reserved2;                                       ///< reserved
+   ULONGLONG guardRFVerifyStackPointerFunctionPointer;   ///< VA of the RFG stack pointer verify function pointer
+   DWORD hotPatchTableOffset;                            ///< offset of the hot patch table
+   DWORD reserved3;                                      ///< reserved
+   ULONGLONG enclaveConfigurationPointer;                ///< VA of the enclave configuration
+   ULONGLONG volatileMetadataPointer;                    ///< VA of the volatile metadata
+   ULONGLONG guardEHContinuationTable;                   ///< VA of the EH continuation target table
+   ULONGLONG guardEHContinuationCount;                   ///< number of EH continuation targets
+   ULONGLONG guardXFGCheckFunctionPointer;               ///< VA of the XFG check function pointer
+   ULONGLONG guardXFGDispatchFunctionPointer;            ///< VA of the XFG dispatch function pointer
+   ULONGLONG guardXFGTableDispatchFunctionPointer;       ///< VA of the XFG table dispatch function pointer
+   ULONGLONG castGuardOsDeterminedFailureMode;           ///< VA of the cast guard failure mode
+   ULONGLONG guardMemcpyFunctionPointer;                 ///< VA of the guarded memcpy function pointer
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(LoadConfigDirectory32) == 192,
+   "Load config directory 32 must be 192 bytes long");
+
+static_assert(sizeof(LoadConfigDirectory32) == sizeof(IMAGE_LOAD_CONFIG_DIRECTORY32),
+   "Load config directory 32 must have same size as IMAGE_LOAD_CONFIG_DIRECTORY32");
+
+static_assert(sizeof(LoadConfigDirectory64) == 320,
+   "Load config directory 64 must be 320 bytes long");
+
+static_assert(sizeof(LoadConfigDirectory64) == sizeof(IMAGE_LOAD_CONFIG_DIRECTORY64),
+   "Load config directory 64 must have same size as IMAGE_LOAD_CONFIG_DIRECTORY64");
+
+/// guard flags mask for the extra size of guard table entries
+constexpr DWORD c_guardCFFunctionTableSizeMask = 0xF0000000;
+
+/// guard flags shift for the extra size of guard table entries
+constexpr DWORD c_guardCFFunctionTableSizeShift = 28;
+
+/// mapping of guard flags to display text
+extern const std::map<DWORD, LPCTSTR> g_mapGuardFlagsToDisplayText;
+
+/// mapping of guard table entry flags (GFIDS flags) to display text
+extern const std::map<DWORD, LPCTSTR> g_mapGuardTableEntryFlagsToDisplayText;
+
+/// struct definition for above load config directory for PE32 images
+extern const StructDefinition g_definitionLoadConfigDirectory32;
+
+/// struct definition for above load config directory for PE32+ images
+extern const StructDefinition g_definitionLoadConfigDirectory64;
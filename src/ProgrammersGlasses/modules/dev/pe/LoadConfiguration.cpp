@@ -0,0 +1,111 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file LoadConfiguration.cpp
+/// \brief load configuration directory and its guard tables
+//
+#include "stdafx.h"
+#include "LoadConfiguration.hpp"
+#include "LoadConfigDirectory.hpp"
+#include "PortableExecutableImage.hpp"
+#include "OptionalHeader.hpp"
+
+LoadConfiguration::LoadConfiguration(const PortableExecutableImage& image)
+   :m_image(image)
+{
+   const DataDirectoryEntry* loadConfigDirectory =
+      image.GetDataDirectory(DataDirectoryIndex::loadConfigTable);
+
+   if (loadConfigDirectory == nullptr)
+      return;
+
+   // the size field is always present; the real size is stored in the struct
+   // itself, since the directory entry's size was wrong in older images
+   const DWORD* size = image.DataAtRva<DWORD>(loadConfigDirectory->virtualAddress);
+   if (size == nullptr ||
+      *size < sizeof(DWORD))
+      return;
+
+   const BYTE* data = image.DataAtRva<BYTE>(loadConfigDirectory->virtualAddress, *size);
+   if (data == nullptr)
+      return;
+
+   m_data = data;
+   m_size = *size;
+
+   if (image.Is64BitImage())
+      ReadGuardTables<LoadConfigDirectory64>();
+   else
+      ReadGuardTables<LoadConfigDirectory32>();
+}
+
+template <typename TLoadConfig>
+void LoadConfiguration::ReadGuardTables()
+{
+   m_guardFlags = static_cast<DWORD>(FieldValue(&TLoadConfig::guardFlags));
+
+   // guard tables have extra bytes per entry, as specified in the guard flags
+   size_t guardEntrySize = sizeof(DWORD) +
+      ((m_guardFlags & c_guardCFFunctionTableSizeMask) >> c_guardCFFunctionTableSizeShift);
+
+   m_safeSehHandlerTable = LocateGuardTable(
+      FieldValue(&TLoadConfig::seHandlerTable),
+      FieldValue(&TLoadConfig::seHandlerCount),
+      sizeof(DWORD));
+
+   m_guardFunctionTable = LocateGuardTable(
+      FieldValue(&TLoadConfig::guardCFFunctionTable),
+      FieldValue(&TLoadConfig::guardCFFunctionCount),
+      guardEntrySize);
+
+   m_guardAddressTakenIatTable = LocateGuardTable(
+      FieldValue(&TLoadConfig::guardAddressTakenIatEntryTable),
+      FieldValue(&TLoadConfig::guardAddressTakenIatEntryCount),
+      guardEntrySize);
+
+   m_guardLongJumpTargetTable = LocateGuardTable(
+      FieldValue(&TLoadConfig::guardLongJumpTargetTable),
+      FieldValue(&TLoadConfig::guardLongJumpTargetCount),
+      guardEntrySize);
+
+   m_guardEHContinuationTable = LocateGuardTable(
+      FieldValue(&TLoadConfig::guardEHContinuationTable),
+      FieldValue(&TLoadConfig::guardEHContinuationCount),
+      guardEntrySize);
+}
+
+template <typename TLoadConfig, typename TField>
+ULONGLONG LoadConfiguration::FieldValue(TField TLoadConfig::* field) const
+{
+   const TLoadConfig* loadConfig = reinterpret_cast<const TLoadConfig*>(m_data);
+
+   size_t fieldOffset =
+      reinterpret_cast<const BYTE*>(&(loadConfig->*field)) - m_data;
+
+   if (fieldOffset + sizeof(TField) > m_size)
+      return 0;
+
+   return loadConfig->*field;
+}
+
+GuardAddressTable LoadConfiguration::LocateGuardTable(ULONGLONG tableAddress,
+   ULONGLONG count, size_t entrySize) const
+{
+   ULONGLONG imageBase = m_image.ImageBase();
+   if (tableAddress < imageBase ||
+      tableAddress - imageBase > MAXDWORD ||
+      count == 0 ||
+      count > m_image.GetFile().Size() / entrySize)
+      return GuardAddressTable{};
+
+   DWORD tableRva = static_cast<DWORD>(tableAddress - imageBase);
+
+   const BYTE* entries = m_image.DataAtRva<BYTE>(tableRva,
+      static_cast<size_t>(count) * entrySize);
+
+   if (entries == nullptr)
+      return GuardAddressTable{};
+
+   return GuardAddressTable{ entries, entrySize, static_cast<size_t>(count) };
+}
@@ -0,0 +1,150 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file LoadConfiguration.hpp
+/// \brief load configuration directory and its guard tables
+//
+#pragma once
+
+class PortableExecutableImage;
+
+/// \brief Guard address table
+/// \details Provides columnar access to the entries of one of the guard
+/// tables referenced by the load configuration, e.g. the CFG function table.
+/// Each entry consists of an RVA, followed by a number of extra bytes; the
+/// first extra byte contains the GFIDS flags. The entries are accessed
+/// directly in the mapped file and the object can be copied cheaply.
+class GuardAddressTable
+{
+public:
+   /// ctor; creates an empty table
+   GuardAddressTable() = default;
+
+   /// ctor; creates a table from entries in the mapped file
+   GuardAddressTable(const BYTE* entries, size_t entrySize, size_t count)
+      :m_entries(entries),
+      m_entrySize(entrySize),
+      m_count(count)
+   {
+   }
+
+   /// returns if the table is present
+   bool IsAvailable() const { return m_entries != nullptr; }
+
+   /// returns the number of entries
+   size_t Count() const { return m_count; }
+
+   /// returns the size of a single entry, in bytes
+   size_t EntrySize() const { return m_entrySize; }
+
+   /// returns if the entries contain flags
+   bool HasFlags() const { return m_entrySize > sizeof(DWORD); }
+
+   /// returns the RVA of the entry with given index
+   DWORD Rva(size_t index) const
+   {
+      ATLASSERT(index < m_count);
+      return *reinterpret_cast<const DWORD*>(m_entries + index * m_entrySize);
+   }
+
+   /// returns the flags of the entry with given index, or 0 when the entries
+   /// have no flags
+   BYTE Flags(size_t index) const
+   {
+      ATLASSERT(index < m_count);
+      return HasFlags() ? m_entries[index * m_entrySize + sizeof(DWORD)] : 0;
+   }
+
+private:
+   /// pointer to the first entry; nullptr when not available
+   const BYTE* m_entries = nullptr;
+
+   /// size of a single entry
+   size_t m_entrySize = 0;
+
+   /// number of entries
+   size_t m_count = 0;
+};
+
+/// \brief Load configuration
+/// \details Locates the load configuration directory of a PE image and the
+/// guard tables it references. Fields beyond the size stored in the
+/// directory are treated as zero, since older linkers write shorter
+/// versions of the struct.
+class LoadConfiguration
+{
+public:
+   /// ctor; locates the load configuration directory of the image
+   explicit LoadConfiguration(const PortableExecutableImage& image);
+
+   /// returns if the image has a load configuration directory
+   bool IsAvailable() const { return m_data != nullptr; }
+
+   /// returns pointer to the load configuration directory
+   const BYTE* Data() const { return m_data; }
+
+   /// returns the size of the load configuration directory, as stored in
+   /// the struct
+   DWORD Size() const { return m_size; }
+
+   /// returns the guard flags
+   DWORD GuardFlags() const { return m_guardFlags; }
+
+   /// returns the SafeSEH handler table; x86 images only
+   const GuardAddressTable& SafeSehHandlerTable() const { return m_safeSehHandlerTable; }
+
+   /// returns the CFG function table
+   const GuardAddressTable& GuardFunctionTable() const { return m_guardFunctionTable; }
+
+   /// returns the table of address taken IAT entries
+   const GuardAddressTable& GuardAddressTakenIatTable() const { return m_guardAddressTakenIatTable; }
+
+   /// returns the long jump target table
+   const GuardAddressTable& GuardLongJumpTargetTable() const { return m_guardLongJumpTargetTable; }
+
+   /// returns the EH continuation target table
+   const GuardAddressTable& GuardEHContinuationTable() const { return m_guardEHContinuationTable; }
+
+private:
+   /// reads the guard tables from the load config directory struct
+   template <typename TLoadConfig>
+   void ReadGuardTables();
+
+   /// returns the value of a field, or 0 when the field lies beyond the
+   /// stored size of the struct
+   template <typename TLoadConfig, typename TField>
+   ULONGLONG FieldValue(TField TLoadConfig::* field) const;
+
+   /// locates a guard table by VA and count
+   GuardAddressTable LocateGuardTable(ULONGLONG tableAddress, ULONGLONG count,
+      size_t entrySize) const;
+
+private:
+   /// PE image
+   const PortableExecutableImage& m_image;
+
+   /// pointer to the load configuration directory; nullptr when not available
+   const BYTE* m_data = nullptr;
+
+   /// size of the load configuration directory
+   DWORD m_size = 0;
+
+   /// guard flags
+   DWORD m_guardFlags = 0;
+
+   /// SafeSEH handler table
+   GuardAddressTable m_safeSehHandlerTable;
+
+   /// CFG function table
+   GuardAddressTable m_guardFunctionTable;
+
+   /// address taken IAT entries table
+   GuardAddressTable m_guardAddressTakenIatTable;
+
+   /// long jump target table
+   GuardAddressTable m_guardLongJumpTargetTable;
+
+   /// EH continuation target table
+   GuardAddressTable m_guardEHContinuationTable;
+};
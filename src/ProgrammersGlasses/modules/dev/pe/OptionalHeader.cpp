@@ -0,0 +1,569 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file OptionalHeader.cpp
+/// \brief PE optional header and data directory definitions
+//
+#include "stdafx.h"
+#include "OptionalHeader.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapDataDirectoryIndexToDisplayText =
+{
+   { 0, _T("Export table") },
+   { 1, _T("Import table") },
+   { 2, _T("Resource table") },
+   { 3, _T("Exception table") },
+   { 4, _T("Certificate table") },
+   { 5, _T("Base relocation table") },
+   { 6, _T("Debug") },
+   { 7, _T("Architecture (reserved)") },
+   { 8, _T("Global pointer") },
+   { 9, _T("TLS table") },
+   { 10, _T("Load config table") },
+   { 11, _T("Bound import") },
+   { 12, _T("Import address table") },
+   { 13, _T("Delay import descriptor") },
+   { 14, _T("CLR runtime header") },
+   { 15, _T("Reserved") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapOptionalHeaderMagicToDisplayText =
+{
+   { 0x107, _T("IMAGE_ROM_OPTIONAL_HDR_MAGIC (ROM image)") },
+   { 0x10b, _T("IMAGE_NT_OPTIONAL_HDR32_MAGIC (PE32)") },
+   { 0x20b, _T("IMAGE_NT_OPTIONAL_HDR64_MAGIC (PE32+)") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapOptionalHeaderSubsystemToDisplayText =
+{
+   { 0, _T("IMAGE_SUBSYSTEM_UNKNOWN") },
+   { 1, _T("IMAGE_SUBSYSTEM_NATIVE (device drivers and native processes)") },
+   { 2, _T("IMAGE_SUBSYSTEM_WINDOWS_GUI") },
+   { 3, _T("IMAGE_SUBSYSTEM_WINDOWS_CUI") },
+   { 5, _T("IMAGE_SUBSYSTEM_OS2_CUI") },
+   { 7, _T("IMAGE_SUBSYSTEM_POSIX_CUI") },
+   { 8, _T("IMAGE_SUBSYSTEM_NATIVE_WINDOWS (Win9x driver)") },
+   { 9, _T("IMAGE_SUBSYSTEM_WINDOWS_CE_GUI") },
+   { 10, _T("IMAGE_SUBSYSTEM_EFI_APPLICATION") },
+   { 11, _T("IMAGE_SUBSYSTEM_EFI_BOOT_SERVICE_DRIVER") },
+   { 12, _T("IMAGE_SUBSYSTEM_EFI_RUNTIME_DRIVER") },
+   { 13, _T("IMAGE_SUBSYSTEM_EFI_ROM") },
+   { 14, _T("IMAGE_SUBSYSTEM_XBOX") },
+   { 16, _T("IMAGE_SUBSYSTEM_WINDOWS_BOOT_APPLICATION") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapDllCharacteristicsBitsToDisplayText =
+{
+   { 0x0020, _T("IMAGE_DLLCHARACTERISTICS_HIGH_ENTROPY_VA") },
+   { 0x0040, _T("IMAGE_DLLCHARACTERISTICS_DYNAMIC_BASE") },
+   { 0x0080, _T("IMAGE_DLLCHARACTERISTICS_FORCE_INTEGRITY") },
+   { 0x0100, _T("IMAGE_DLLCHARACTERISTICS_NX_COMPAT") },
+   { 0x0200, _T("IMAGE_DLLCHARACTERISTICS_NO_ISOLATION") },
+   { 0x0400, _T("IMAGE_DLLCHARACTERISTICS_NO_SEH") },
+   { 0x0800, _T("IMAGE_DLLCHARACTERISTICS_NO_BIND") },
+   { 0x1000, _T("IMAGE_DLLCHARACTERISTICS_APPCONTAINER") },
+   { 0x2000, _T("IMAGE_DLLCHARACTERISTICS_WDM_DRIVER") },
+   { 0x4000, _T("IMAGE_DLLCHARACTERISTICS_GUARD_CF") },
+   { 0x8000, _T("IMAGE_DLLCHARACTERISTICS_TERMINAL_SERVER_AWARE") },
+};
+
+const StructDefinition g_definitionOptionalHeader32 = StructDefinition({
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::magic),
+      sizeof(OptionalHeader32::magic),
+      2,
+      true, // little-endian
+      StructFieldType::valueMapping,
+      g_mapOptionalHeaderMagicToDisplayText,
+      _T("Magic")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::majorLinkerVersion),
+      sizeof(OptionalHeader32::majorLinkerVersion),
+      1,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Major linker version")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::minorLinkerVersion),
+      sizeof(OptionalHeader32::minorLinkerVersion),
+      1,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Minor linker version")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::sizeOfCode),
+      sizeof(OptionalHeader32::sizeOfCode),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of code")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::sizeOfInitializedData),
+      sizeof(OptionalHeader32::sizeOfInitializedData),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of initialized data")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::sizeOfUninitializedData),
+      sizeof(OptionalHeader32::sizeOfUninitializedData),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of uninitialized data")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::addressOfEntryPoint),
+      sizeof(OptionalHeader32::addressOfEntryPoint),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Address of entry point (RVA)")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::baseOfCode),
+      sizeof(OptionalHeader32::baseOfCode),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Base of code (RVA)")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::baseOfData),
+      sizeof(OptionalHeader32::baseOfData),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Base of data (RVA)")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::imageBase),
+      sizeof(OptionalHeader32::imageBase),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Image base")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::sectionAlignment),
+      sizeof(OptionalHeader32::sectionAlignment),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Section alignment")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::fileAlignment),
+      sizeof(OptionalHeader32::fileAlignment),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("File alignment")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::majorOperatingSystemVersion),
+      sizeof(OptionalHeader32::majorOperatingSystemVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Major OS version")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::minorOperatingSystemVersion),
+      sizeof(OptionalHeader32::minorOperatingSystemVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Minor OS version")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::majorImageVersion),
+      sizeof(OptionalHeader32::majorImageVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Major image version")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::minorImageVersion),
+      sizeof(OptionalHeader32::minorImageVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Minor image version")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::majorSubsystemVersion),
+      sizeof(OptionalHeader32::majorSubsystemVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Major subsystem version")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::minorSubsystemVersion),
+      sizeof(OptionalHeader32::minorSubsystemVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Minor subsystem version")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::win32VersionValue),
+      sizeof(OptionalHeader32::win32VersionValue),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Win32 version value (reserved)")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::sizeOfImage),
+      sizeof(OptionalHeader32::sizeOfImage),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of image")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::sizeOfHeaders),
+      sizeof(OptionalHeader32::sizeOfHeaders),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of headers")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::checkSum),
+      sizeof(OptionalHeader32::checkSum),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Checksum")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::subsystem),
+      sizeof(OptionalHeader32::subsystem),
+      2,
+      true, // little-endian
+      StructFieldType::valueMapping,
+      g_mapOptionalHeaderSubsystemToDisplayText,
+      _T("Subsystem")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::dllCharacteristics),
+      sizeof(OptionalHeader32::dllCharacteristics),
+      2,
+      true, // little-endian
+      StructFieldType::flagsMapping,
+      g_mapDllCharacteristicsBitsToDisplayText,
+      _T("DLL characteristics")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::sizeOfStackReserve),
+      sizeof(OptionalHeader32::sizeOfStackReserve),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of stack reserve")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::sizeOfStackCommit),
+      sizeof(OptionalHeader32::sizeOfStackCommit),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of stack commit")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::sizeOfHeapReserve),
+      sizeof(OptionalHeader32::sizeOfHeapReserve),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of heap reserve")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::sizeOfHeapCommit),
+      sizeof(OptionalHeader32::sizeOfHeapCommit),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of heap commit")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::loaderFlags),
+      sizeof(OptionalHeader32::loaderFlags),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Loader flags (reserved)")),
+
+   StructField(
+      offsetof(OptionalHeader32, OptionalHeader32::numberOfRvaAndSizes),
+      sizeof(OptionalHeader32::numberOfRvaAndSizes),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Number of data directory entries")),
+   });
+
+const StructDefinition g_definitionOptionalHeader64 = StructDefinition({
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::magic),
+      sizeof(OptionalHeader64::magic),
+      2,
+      true, // little-endian
+      StructFieldType::valueMapping,
+      g_mapOptionalHeaderMagicToDisplayText,
+      _T("Magic")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::majorLinkerVersion),
+      sizeof(OptionalHeader64::majorLinkerVersion),
+      1,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Major linker version")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::minorLinkerVersion),
+      sizeof(OptionalHeader64::minorLinkerVersion),
+      1,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Minor linker version")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::sizeOfCode),
+      sizeof(OptionalHeader64::sizeOfCode),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of code")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::sizeOfInitializedData),
+      sizeof(OptionalHeader64::sizeOfInitializedData),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of initialized data")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::sizeOfUninitializedData),
+      sizeof(OptionalHeader64::sizeOfUninitializedData),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of uninitialized data")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::addressOfEntryPoint),
+      sizeof(OptionalHeader64::addressOfEntryPoint),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Address of entry point (RVA)")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::baseOfCode),
+      sizeof(OptionalHeader64::baseOfCode),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Base of code (RVA)")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::imageBase),
+      sizeof(OptionalHeader64::imageBase),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Image base")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::sectionAlignment),
+      sizeof(OptionalHeader64::sectionAlignment),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Section alignment")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::fileAlignment),
+      sizeof(OptionalHeader64::fileAlignment),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("File alignment")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::majorOperatingSystemVersion),
+      sizeof(OptionalHeader64::majorOperatingSystemVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Major OS version")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::minorOperatingSystemVersion),
+      sizeof(OptionalHeader64::minorOperatingSystemVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Minor OS version")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::majorImageVersion),
+      sizeof(OptionalHeader64::majorImageVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Major image version")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::minorImageVersion),
+      sizeof(OptionalHeader64::minorImageVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Minor image version")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::majorSubsystemVersion),
+      sizeof(OptionalHeader64::majorSubsystemVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Major subsystem version")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::minorSubsystemVersion),
+      sizeof(OptionalHeader64::minorSubsystemVersion),
+      2,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Minor subsystem version")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::win32VersionValue),
+      sizeof(OptionalHeader64::win32VersionValue),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Win32 version value (reserved)")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::sizeOfImage),
+      sizeof(OptionalHeader64::sizeOfImage),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of image")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::sizeOfHeaders),
+      sizeof(OptionalHeader64::sizeOfHeaders),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of headers")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::checkSum),
+      sizeof(OptionalHeader64::checkSum),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Checksum")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::subsystem),
+      sizeof(OptionalHeader64::subsystem),
+      2,
+      true, // little-endian
+      StructFieldType::valueMapping,
+      g_mapOptionalHeaderSubsystemToDisplayText,
+      _T("Subsystem")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::dllCharacteristics),
+      sizeof(OptionalHeader64::dllCharacteristics),
+      2,
+      true, // little-endian
+      StructFieldType::flagsMapping,
+      g_mapDllCharacteristicsBitsToDisplayText,
+      _T("DLL characteristics")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::sizeOfStackReserve),
+      sizeof(OptionalHeader64::sizeOfStackReserve),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of stack reserve")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::sizeOfStackCommit),
+      sizeof(OptionalHeader64::sizeOfStackCommit),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of stack commit")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::sizeOfHeapReserve),
+      sizeof(OptionalHeader64::sizeOfHeapReserve),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of heap reserve")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::sizeOfHeapCommit),
+      sizeof(OptionalHeader64::sizeOfHeapCommit),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of heap commit")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::loaderFlags),
+      sizeof(OptionalHeader64::loaderFlags),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Loader flags (reserved)")),
+
+   StructField(
+      offsetof(OptionalHeader64, OptionalHeader64::numberOfRvaAndSizes),
+      sizeof(OptionalHeader64::numberOfRvaAndSizes),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Number of data directory entries")),
+   });
+
+const StructDefinition g_definitionDataDirectoryEntry = StructDefinition({
+   StructField(
+      offsetof(DataDirectoryEntry, DataDirectoryEntry::virtualAddress),
+      sizeof(DataDirectoryEntry::virtualAddress),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Virtual address (RVA)")),
+
+   StructField(
+      offsetof(DataDirectoryEntry, DataDirectoryEntry::size),
+      sizeof(DataDirectoryEntry::size),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size")),
+   });
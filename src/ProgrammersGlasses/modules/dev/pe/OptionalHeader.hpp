@@ -0,0 +1,160 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file OptionalHeader.hpp
+/// \brief PE optional header and data directory definitions
+//
+#pragma once
+
+#include "StructDefinition.hpp"
+
+#pragma pack(push, 1)
+
+/// \brief PE32 optional header, without the data directory array
+/// \see https://learn.microsoft.com/en-us/windows/win32/debug/pe-format#optional-header-image-only
+/// The header corresponds with winnt.h's IMAGE_OPTIONAL_HEADER32 struct; the
+/// data directory entries immediately follow the header.
+struct OptionalHeader32
+{
+   WORD magic;                      ///< magic number; 0x10b for PE32
+   BYTE majorLinkerVersion;         ///< linker major version
+   BYTE minorLinkerVersion;         ///< linker minor version
+   DWORD sizeOfCode;                ///< size of all code sections
+   DWORD sizeOfInitializedData;     ///< size of all initialized data sections
+   DWORD sizeOfUninitializedData;   ///< size of all uninitialized data (BSS) sections
+   DWORD addressOfEntryPoint;       ///< RVA of the entry point, or 0 when not present
+   DWORD baseOfCode;                ///< RVA of the start of the code section
+   DWORD baseOfData;                ///< RVA of the start of the data section
+   DWORD imageBase;                 ///< preferred address of the image when loaded
+   DWORD sectionAlignment;          ///< section alignment when loaded into memory
+   DWORD fileAlignment;             ///< section alignment in the image file
+   WORD majorOperatingSystemVersion;///< required OS major version
+   WORD minorOperatingSystemVersion;///< required OS minor version
+   WORD majorImageVersion;          ///< image major version
+   WORD minorImageVersion;          ///< image minor version
+   WORD majorSubsystemVersion;      ///< subsystem major version
+   WORD minorSubsystemVersion;      ///< subsystem minor version
+   DWORD win32VersionValue;         ///< reserved, must be zero
+   DWORD sizeOfImage;               ///< size of image when loaded into memory
+   DWORD sizeOfHeaders;             ///< combined size of all headers, rounded to file alignment
+   DWORD checkSum;                  ///< image file checksum
+   WORD subsystem;                  ///< subsystem required to run the image
+   WORD dllCharacteristics;         ///< DLL characteristics flags
+   DWORD sizeOfStackReserve;        ///< size of stack to reserve
+   DWORD sizeOfStackCommit;         ///< size of stack to commit
+   DWORD sizeOfHeapReserve;         ///< size of local heap to reserve
+   DWORD sizeOfHeapCommit;          ///< size of local heap to commit
+   DWORD loaderFlags;               ///< reserved, must be zero
+   DWORD numberOfRvaAndSizes;       ///< number of data directory entries following the header
+};
+
+/// \brief PE32+ optional header, without the data directory array
+/// \details The header corresponds with winnt.h's IMAGE_OPTIONAL_HEADER64 struct.
+/// Compared to the PE32 header, the baseOfData field is missing and the image
+/// base and the stack and heap sizes are 64-bit values.
+struct OptionalHeader64
+{
+   WORD magic;                      ///< magic number; 0x20b for PE32+
+   BYTE majorLinkerVersion;         ///< linker major version
+   BYTE minorLinkerVersion;         ///< linker minor version
+   DWORD sizeOfCode;                ///< size of all code sections
+   DWORD sizeOfInitializedData;     ///< size of all initialized data sections
+   DWORD sizeOfUninitializedData;   ///< size of all uninitialized data (BSS) sections
+   DWORD addressOfEntryPoint;       ///< RVA of the entry point, or 0 when not present
+   DWORD baseOfCode;                ///< RVA of the start of the code section
+   ULONGLONG imageBase;             ///< preferred address of the image when loaded
+   DWORD sectionAlignment;          ///< section alignment when loaded into memory
+   DWORD fileAlignment;             ///< section alignment in the image file
+   WORD majorOperatingSystemVersion;///< required OS major version
+   WORD minorOperatingSystemVersion;///< required OS minor version
+   WORD majorImageVersion;          ///< image major version
+   WORD minorImageVersion;          ///< image minor version
+   WORD majorSubsystemVersion;      ///< subsystem major version
+   WORD minorSubsystemVersion;      ///< subsystem minor version
+   DWORD win32VersionValue;         ///< reserved, must be zero
+   DWORD sizeOfImage;               ///< size of image when loaded into memory
+   DWORD sizeOfHeaders;             ///< combined size of all headers, rounded to file alignment
+   DWORD checkSum;                  ///< image file checksum
+   WORD subsystem;                  ///< subsystem required to run the image
+   WORD dllCharacteristics;         ///< DLL characteristics flags
+   ULONGLONG sizeOfStackReserve;    ///< size of stack to reserve
+   ULONGLONG sizeOfStackCommit;     ///< size of stack to commit
+   ULONGLONG sizeOfHeapReserve;     ///< size of local heap to reserve
+   ULONGLONG sizeOfHeapCommit;      ///< size of local heap to commit
+   DWORD loaderFlags;               ///< reserved, must be zero
+   DWORD numberOfRvaAndSizes;       ///< number of data directory entries following the header
+};
+
+/// \brief single data directory entry
+/// \details The entry corresponds with winnt.h's IMAGE_DATA_DIRECTORY struct.
+struct DataDirectoryEntry
+{
+   DWORD virtualAddress;   ///< RVA of the table; for the security directory, a file offset
+   DWORD size;             ///< size of the table, in bytes
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(OptionalHeader32) == 96,
+   "PE32 optional header must be 96 bytes long");
+
+static_assert(sizeof(OptionalHeader64) == 112,
+   "PE32+ optional header must be 112 bytes long");
+
+static_assert(sizeof(DataDirectoryEntry) == sizeof(IMAGE_DATA_DIRECTORY),
+   "Data directory entry must have same size as IMAGE_DATA_DIRECTORY");
+
+static_assert(sizeof(OptionalHeader32) + 16 * sizeof(DataDirectoryEntry) == sizeof(IMAGE_OPTIONAL_HEADER32),
+   "PE32 optional header with data directories must have same size as IMAGE_OPTIONAL_HEADER32");
+
+static_assert(sizeof(OptionalHeader64) + 16 * sizeof(DataDirectoryEntry) == sizeof(IMAGE_OPTIONAL_HEADER64),
+   "PE32+ optional header with data directories must have same size as IMAGE_OPTIONAL_HEADER64");
+
+/// optional header magic value for PE32 images
+constexpr WORD c_optionalHeaderMagicPE32 = 0x10b;
+
+/// optional header magic value for PE32+ images
+constexpr WORD c_optionalHeaderMagicPE32Plus = 0x20b;
+
+/// data directory indices
+enum class DataDirectoryIndex : size_t
+{
+   exportTable = 0,        ///< IMAGE_DIRECTORY_ENTRY_EXPORT
+   importTable = 1,        ///< IMAGE_DIRECTORY_ENTRY_IMPORT
+   resourceTable = 2,      ///< IMAGE_DIRECTORY_ENTRY_RESOURCE
+   exceptionTable = 3,     ///< IMAGE_DIRECTORY_ENTRY_EXCEPTION
+   certificateTable = 4,   ///< IMAGE_DIRECTORY_ENTRY_SECURITY
+   baseRelocationTable = 5,///< IMAGE_DIRECTORY_ENTRY_BASERELOC
+   debug = 6,              ///< IMAGE_DIRECTORY_ENTRY_DEBUG
+   architecture = 7,       ///< IMAGE_DIRECTORY_ENTRY_ARCHITECTURE
+   globalPointer = 8,      ///< IMAGE_DIRECTORY_ENTRY_GLOBALPTR
+   tlsTable = 9,           ///< IMAGE_DIRECTORY_ENTRY_TLS
+   loadConfigTable = 10,   ///< IMAGE_DIRECTORY_ENTRY_LOAD_CONFIG
+   boundImport = 11,       ///< IMAGE_DIRECTORY_ENTRY_BOUND_IMPORT
+   importAddressTable = 12,///< IMAGE_DIRECTORY_ENTRY_IAT
+   delayImportDescriptor = 13, ///< IMAGE_DIRECTORY_ENTRY_DELAY_IMPORT
+   clrRuntimeHeader = 14,  ///< IMAGE_DIRECTORY_ENTRY_COM_DESCRIPTOR
+   reserved = 15,          ///< reserved, must be zero
+};
+
+/// mapping of data directory index to display text
+extern const std::map<DWORD, LPCTSTR> g_mapDataDirectoryIndexToDisplayText;
+
+/// mapping of optional header magic value to display text
+extern const std::map<DWORD, LPCTSTR> g_mapOptionalHeaderMagicToDisplayText;
+
+/// mapping of subsystem value to display text
+extern const std::map<DWORD, LPCTSTR> g_mapOptionalHeaderSubsystemToDisplayText;
+
+/// mapping of DLL characteristics bits to display text
+extern const std::map<DWORD, LPCTSTR> g_mapDllCharacteristicsBitsToDisplayText;
+
+/// struct definition for above PE32 optional header
+extern const StructDefinition g_definitionOptionalHeader32;
+
+/// struct definition for above PE32+ optional header
+extern const StructDefinition g_definitionOptionalHeader64;
+
+/// struct definition for above data directory entry
+extern const StructDefinition g_definitionDataDirectoryEntry;
@@ -0,0 +1,179 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file PortableExecutableImage.cpp
+/// \brief access to the headers and data directories of a PE image
+//
+#include "stdafx.h"
+#include "PortableExecutableImage.hpp"
+#include "DosMzHeader.hpp"
+#include "OptionalHeader.hpp"
+#include "../coff/CoffHeader.hpp"
+#include "../coff/SectionHeader.hpp"
+
+PortableExecutableImage::PortableExecutableImage(const File& file)
+   :m_file(file)
+{
+   if (!LocateHeaders())
+      m_optionalHeader = nullptr;
+}
+
+bool PortableExecutableImage::LocateHeaders()
+{
+   if (m_file.Size() < sizeof(DosMzHeader))
+      return false;
+
+   const DosMzHeader& dosMzHeader = *m_file.Data<DosMzHeader>();
+   if (dosMzHeader.magicNumber[0] != 'M' ||
+      dosMzHeader.magicNumber[1] != 'Z')
+      return false;
+
+   size_t peSignatureOffset = dosMzHeader.newExecutableHeader;
+   if (peSignatureOffset == 0 ||
+      peSignatureOffset + 4 + sizeof(CoffHeader) > m_file.Size() ||
+      *m_file.Data<DWORD>(peSignatureOffset) != 0x00004550) // "PE\0\0"
+      return false;
+
+   m_coffHeaderOffset = peSignatureOffset + 4;
+   m_coffHeader = m_file.Data<CoffHeader>(m_coffHeaderOffset);
+
+   m_optionalHeaderOffset = m_coffHeaderOffset + sizeof(CoffHeader);
+   size_t optionalHeaderSize = m_coffHeader->optionalHeaderSize;
+
+   if (optionalHeaderSize < sizeof(WORD) ||
+      m_optionalHeaderOffset + optionalHeaderSize > m_file.Size())
+      return false;
+
+   const BYTE* optionalHeader = m_file.Data<BYTE>(m_optionalHeaderOffset);
+   WORD magic = *reinterpret_cast<const WORD*>(optionalHeader);
+
+   size_t fixedHeaderSize = 0;
+   DWORD numberOfRvaAndSizes = 0;
+   if (magic == c_optionalHeaderMagicPE32 &&
+      optionalHeaderSize >= sizeof(OptionalHeader32))
+   {
+      fixedHeaderSize = sizeof(OptionalHeader32);
+      numberOfRvaAndSizes =
+         reinterpret_cast<const OptionalHeader32*>(optionalHeader)->numberOfRvaAndSizes;
+   }
+   else if (magic == c_optionalHeaderMagicPE32Plus &&
+      optionalHeaderSize >= sizeof(OptionalHeader64))
+   {
+      m_is64BitImage = true;
+      fixedHeaderSize = sizeof(OptionalHeader64);
+      numberOfRvaAndSizes =
+         reinterpret_cast<const OptionalHeader64*>(optionalHeader)->numberOfRvaAndSizes;
+   }
+   else
+      return false;
+
+   // the number of entries is limited by the size of the optional header
+   m_numberOfDataDirectories = std::min<size_t>(
+      numberOfRvaAndSizes,
+      (optionalHeaderSize - fixedHeaderSize) / sizeof(DataDirectoryEntry));
+
+   m_dataDirectories = reinterpret_cast<const DataDirectoryEntry*>(
+      optionalHeader + fixedHeaderSize);
+
+   size_t sectionTableOffset = m_optionalHeaderOffset + optionalHeaderSize;
+   m_numberOfSections = m_coffHeader->numberOfSections;
+
+   if (sectionTableOffset + m_numberOfSections * sizeof(SectionHeader) > m_file.Size())
+      m_numberOfSections = (m_file.Size() - sectionTableOffset) / sizeof(SectionHeader);
+
+   m_sectionHeaders = m_file.Data<SectionHeader>(sectionTableOffset);
+
+   m_optionalHeader = optionalHeader;
+
+   return true;
+}
+
+ULONGLONG PortableExecutableImage::ImageBase() const
+{
+   ATLASSERT(IsValid());
+
+   return m_is64BitImage
+      ? reinterpret_cast<const OptionalHeader64*>(m_optionalHeader)->imageBase
+      : reinterpret_cast<const OptionalHeader32*>(m_optionalHeader)->imageBase;
+}
+
+WORD PortableExecutableImage::TargetMachine() const
+{
+   ATLASSERT(IsValid());
+
+   return m_coffHeader->targetMachine;
+}
+
+const DataDirectoryEntry* PortableExecutableImage::GetDataDirectory(DataDirectoryIndex index) const
+{
+   size_t entryIndex = static_cast<size_t>(index);
+   if (!IsValid() ||
+      entryIndex >= m_numberOfDataDirectories)
+      return nullptr;
+
+   const DataDirectoryEntry& entry = m_dataDirectories[entryIndex];
+   if (entry.virtualAddress == 0 ||
+      entry.size == 0)
+      return nullptr;
+
+   return &entry;
+}
+
+const SectionHeader* PortableExecutableImage::FindSectionByRva(DWORD rva) const
+{
+   for (size_t sectionIndex = 0; sectionIndex < m_numberOfSections; sectionIndex++)
+   {
+      const SectionHeader& sectionHeader = m_sectionHeaders[sectionIndex];
+
+      // the virtual size may be zero in some linkers' output; use the raw size then
+      DWORD sectionSize = sectionHeader.virtualSize != 0
+         ? sectionHeader.virtualSize
+         : sectionHeader.sizeOfRawData;
+
+      if (rva >= sectionHeader.virtualAddress &&
+         rva - sectionHeader.virtualAddress < sectionSize)
+         return &sectionHeader;
+   }
+
+   return nullptr;
+}
+
+std::optional<size_t> PortableExecutableImage::RvaToFileOffset(DWORD rva, size_t size) const
+{
+   if (!IsValid())
+      return std::nullopt;
+
+   const SectionHeader* sectionHeader = FindSectionByRva(rva);
+
+   size_t fileOffset = 0;
+   if (sectionHeader != nullptr)
+   {
+      size_t offsetInSection = rva - sectionHeader->virtualAddress;
+
+      // the part of a section beyond its raw data is zero-filled on load and
+      // has no file representation
+      if (offsetInSection + size > sectionHeader->sizeOfRawData)
+         return std::nullopt;
+
+      fileOffset = sectionHeader->pointerToRawData + offsetInSection;
+   }
+   else
+   {
+      // RVAs before the first section address the headers, which are mapped 1:1
+      const BYTE* optionalHeader = m_optionalHeader;
+      DWORD sizeOfHeaders = m_is64BitImage
+         ? reinterpret_cast<const OptionalHeader64*>(optionalHeader)->sizeOfHeaders
+         : reinterpret_cast<const OptionalHeader32*>(optionalHeader)->sizeOfHeaders;
+
+      if (rva + size > sizeOfHeaders)
+         return std::nullopt;
+
+      fileOffset = rva;
+   }
+
+   if (fileOffset + size > m_file.Size())
+      return std::nullopt;
+
+   return fileOffset;
+}
@@ -0,0 +1,127 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file PortableExecutableImage.hpp
+/// \brief access to the headers and data directories of a PE image
+//
+#pragma once
+
+#include "File.hpp"
+#include <optional>
+
+struct CoffHeader;
+struct SectionHeader;
+struct DataDirectoryEntry;
+enum class DataDirectoryIndex : size_t;
+
+/// \brief Portable Executable image
+/// \details Locates the PE headers, the data directories and the section table
+/// in a memory mapped PE file, and translates relative virtual addresses (RVAs)
+/// to file offsets. Only the headers are parsed; everything else is accessed
+/// directly in the mapped file, so creating an image object is cheap and can be
+/// used to seek directly to a specific data directory.
+class PortableExecutableImage
+{
+public:
+   /// ctor; locates all headers
+   explicit PortableExecutableImage(const File& file);
+
+   /// returns if the PE headers were found and are valid
+   bool IsValid() const { return m_optionalHeader != nullptr; }
+
+   /// returns the mapped file
+   const File& GetFile() const { return m_file; }
+
+   /// returns the file offset of the COFF header, directly after the PE signature
+   size_t CoffHeaderOffset() const { return m_coffHeaderOffset; }
+
+   /// returns the COFF header
+   const CoffHeader& GetCoffHeader() const { return *m_coffHeader; }
+
+   /// returns the file offset of the optional header
+   size_t OptionalHeaderOffset() const { return m_optionalHeaderOffset; }
+
+   /// returns pointer to the optional header; either OptionalHeader32 or
+   /// OptionalHeader64, depending on Is64BitImage()
+   const BYTE* OptionalHeader() const { return m_optionalHeader; }
+
+   /// returns if the image is a PE32+ image
+   bool Is64BitImage() const { return m_is64BitImage; }
+
+   /// returns the preferred image base address
+   ULONGLONG ImageBase() const;
+
+   /// returns the target machine of the image
+   WORD TargetMachine() const;
+
+   /// returns the number of data directory entries
+   size_t NumberOfDataDirectories() const { return m_numberOfDataDirectories; }
+
+   /// returns pointer to the first data directory entry
+   const DataDirectoryEntry* DataDirectories() const { return m_dataDirectories; }
+
+   /// returns a data directory entry, or nullptr when the image has no such
+   /// entry or the entry is empty
+   const DataDirectoryEntry* GetDataDirectory(DataDirectoryIndex index) const;
+
+   /// returns the number of section headers
+   size_t NumberOfSections() const { return m_numberOfSections; }
+
+   /// returns pointer to the first section header
+   const SectionHeader* SectionHeaders() const { return m_sectionHeaders; }
+
+   /// returns the section header containing the given RVA, or nullptr when the
+   /// RVA isn't inside any section
+   const SectionHeader* FindSectionByRva(DWORD rva) const;
+
+   /// translates an RVA to a file offset; returns std::nullopt when the RVA
+   /// range doesn't map to raw data in the file
+   std::optional<size_t> RvaToFileOffset(DWORD rva, size_t size = 1) const;
+
+   /// returns pointer to data at given RVA, or nullptr when the RVA range of
+   /// count elements doesn't map to the file
+   template <typename T>
+   const T* DataAtRva(DWORD rva, size_t count = 1) const
+   {
+      std::optional<size_t> fileOffset = RvaToFileOffset(rva, sizeof(T) * count);
+      return fileOffset.has_value()
+         ? m_file.Data<T>(fileOffset.value())
+         : nullptr;
+   }
+
+private:
+   /// locates all headers; returns false when any header is invalid
+   bool LocateHeaders();
+
+private:
+   /// mapped file
+   const File& m_file;
+
+   /// file offset of COFF header
+   size_t m_coffHeaderOffset = 0;
+
+   /// COFF header
+   const CoffHeader* m_coffHeader = nullptr;
+
+   /// file offset of optional header
+   size_t m_optionalHeaderOffset = 0;
+
+   /// optional header; nullptr when headers are invalid
+   const BYTE* m_optionalHeader = nullptr;
+
+   /// indicates if image is a PE32+ image
+   bool m_is64BitImage = false;
+
+   /// data directory entries
+   const DataDirectoryEntry* m_dataDirectories = nullptr;
+
+   /// number of data directory entries
+   size_t m_numberOfDataDirectories = 0;
+
+   /// section headers
+   const SectionHeader* m_sectionHeaders = nullptr;
+
+   /// number of section headers
+   size_t m_numberOfSections = 0;
+};
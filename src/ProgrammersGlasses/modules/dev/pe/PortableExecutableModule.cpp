@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file PortableExecutableModule.cpp
 /// \brief module to load Portable Executable binary files
@@ -8,6 +8,7 @@
 #include "stdafx.h"
 #include "PortableExecutableModule.hpp"
 #include "PortableExecutableReader.hpp"
+#include "../coff/CoffDiffReader.hpp"
 
 bool PortableExecutableModule::IsModuleApplicableForFile(const File& file) const
 {
@@ -18,3 +19,8 @@ std::shared_ptr<IReader> PortableExecutableModule::OpenReader(const File& file)
 {
    return std::make_shared<PortableExecutableReader>(file);
 }
+
+std::shared_ptr<IReader> PortableExecutableModule::OpenDiffReader(const File& oldFile, const File& newFile) const
+{
+   return std::make_shared<CoffDiffReader>(oldFile, newFile);
+}
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file PortableExecutableModule.hpp
 /// \brief module to load Portable Executable binary files
@@ -35,4 +35,5 @@ public:
 
    bool IsModuleApplicableForFile(const File& file) const override;
    std::shared_ptr<IReader> OpenReader(const File& file) const override;
+   std::shared_ptr<IReader> OpenDiffReader(const File& oldFile, const File& newFile) const override;
 };
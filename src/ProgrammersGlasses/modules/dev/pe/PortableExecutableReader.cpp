@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020-2023 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file PortableExecutableReader.cpp
 /// \brief reader for Portable Executable files
@@ -8,8 +8,25 @@
 #include "stdafx.h"
 #include "PortableExecutableReader.hpp"
 #include "DosMzHeader.hpp"
+#include "OptionalHeader.hpp"
+#include "PortableExecutableImage.hpp"
+#include "ExceptionDirectory.hpp"
+#include "DebugDirectory.hpp"
+#include "DebugDirectoryTable.hpp"
+#include "ImageHashCalculator.hpp"
+#include "LoadConfigDirectory.hpp"
+#include "LoadConfiguration.hpp"
+#include "TlsDirectory.hpp"
+#include "RuntimeFunctionTable.hpp"
+#include "SecurityDirectory.hpp"
+#include "../clr/ClrHeader.hpp"
+#include "../clr/ClrMetadataNodeTreeBuilder.hpp"
 #include "../coff/CoffObjectNodeTreeBuilder.hpp"
+#include "../coff/CoffSectionSizeTree.hpp"
 #include "modules/CodeTextViewNode.hpp"
+#include "modules/DisplayFormatHelper.hpp"
+#include "modules/FilterSortListViewNode.hpp"
+#include "modules/HexDataViewNode.hpp"
 #include "modules/StructListViewNode.hpp"
 
 /// PE signature struct definition
@@ -23,6 +40,59 @@ static const StructDefinition g_definitionPeSignature = StructDefinition({
       _T("PE Signature"))
    });
 
+/// creates a table node for a guard table; the rows are formatted lazily
+static std::shared_ptr<INode> CreateGuardTableNode(const CString& displayName,
+   const GuardAddressTable& table)
+{
+   static std::vector<CString> guardTableColumnNames
+   {
+      _T("Index"),
+      _T("Address"),
+      _T("Flags"),
+   };
+
+   return std::make_shared<FilterSortListViewNode>(
+      displayName,
+      NodeTreeIconID::nodeTreeIconTable,
+      guardTableColumnNames,
+      table.Count(),
+      [table](size_t index)
+      {
+         CString indexText;
+         indexText.Format(_T("%zu"), index);
+
+         CString addressText;
+         addressText.Format(_T("0x%08x"), table.Rva(index));
+
+         CString flagsText;
+         if (table.HasFlags())
+         {
+            flagsText = DisplayFormatHelper::FormatBitFlagsFromMap(
+               g_mapGuardTableEntryFlagsToDisplayText,
+               table.Flags(index));
+
+            flagsText.Replace(_T("\n"), _T(""));
+         }
+
+         return std::vector<CString> {
+            indexText,
+            addressText,
+            flagsText,
+         };
+      },
+      true);
+}
+
+/// formats digest bytes as hex text
+static CString FormatDigest(const std::vector<BYTE>& digest)
+{
+   CString text;
+   for (BYTE value : digest)
+      text.AppendFormat(_T("%02x"), value);
+
+   return text;
+}
+
 bool PortableExecutableReader::IsPortableExecutableFile(const File& file)
 {
    const DosMzHeader& header = *file.Data<DosMzHeader>();
@@ -105,9 +175,44 @@ void PortableExecutableReader::Load()
       summaryText += objectFileSummary;
 
       rootNode->ChildNodes().push_back(coffSummaryNode);
+
+      summaryText.AppendFormat(_T("Total size of all sections: %llu bytes\n"),
+         nodeTreeBuilder.GetTotalSectionSize());
+
+      File file = m_file;
+
+      CoffObjectNodeTreeBuilder::AddSectionSizeNodes(*rootNode,
+         [file, coffObjectSize]()
+         {
+            CoffObjectNodeTreeBuilder sectionSizesBuilder{ file, coffObjectSize, true };
+
+            std::vector<CoffSectionSize> sectionSizes;
+            sectionSizesBuilder.CollectSectionSizes(sectionSizes);
+
+            auto sectionSizeTree = std::make_shared<CoffSectionSizeTree>();
+            sectionSizeTree->AddSections(CString{}, sectionSizes);
+
+            return sectionSizeTree;
+         });
+   }
+
+   PortableExecutableImage image{ m_file };
+   if (!image.IsValid())
+   {
+      summaryText += _T("Error: Optional header is missing or invalid.\n");
+      rootNode->SetText(summaryText);
+
+      return;
    }
 
-   // TODO add optional header
+   AddOptionalHeader(*rootNode, image, summaryText);
+   AddDataDirectories(*rootNode, image, summaryText);
+   AddExceptionDirectory(*rootNode, image, summaryText);
+   AddDebugDirectory(*rootNode, image, summaryText);
+   AddLoadConfigDirectory(*rootNode, image, summaryText);
+   AddTlsDirectory(*rootNode, image, summaryText);
+   AddSecurityDirectory(*rootNode, image, summaryText);
+   AddClrRuntimeHeader(*rootNode, image, summaryText);
 
    rootNode->SetText(summaryText);
 
@@ -118,3 +223,803 @@ void PortableExecutableReader::Cleanup()
 {
    // nothing expensive to cleanup here
 }
+
+void PortableExecutableReader::AddOptionalHeader(StaticNode& rootNode,
+   const PortableExecutableImage& image, CString& summaryText) const
+{
+   auto optionalHeaderNode = std::make_shared<StructListViewNode>(
+      image.Is64BitImage() ? _T("Optional header (PE32+)") : _T("Optional header (PE32)"),
+      NodeTreeIconID::nodeTreeIconBinary,
+      image.Is64BitImage() ? g_definitionOptionalHeader64 : g_definitionOptionalHeader32,
+      image.OptionalHeader(),
+      m_file.Data());
+
+   rootNode.ChildNodes().push_back(optionalHeaderNode);
+
+   summaryText.AppendFormat(_T("\nOptional header: %s, image base 0x%llx\n"),
+      image.Is64BitImage() ? _T("PE32+") : _T("PE32"),
+      image.ImageBase());
+}
+
+void PortableExecutableReader::AddDataDirectories(StaticNode& rootNode,
+   const PortableExecutableImage& image, CString& summaryText) const
+{
+   std::vector<std::vector<CString>> dataDirectoryData;
+   std::vector<std::shared_ptr<INode>> dataDirectoryChildNodes;
+
+   for (size_t index = 0; index < image.NumberOfDataDirectories(); index++)
+   {
+      const DataDirectoryEntry& entry = image.DataDirectories()[index];
+
+      CString indexText;
+      indexText.Format(_T("%zu"), index);
+
+      CString name = GetValueFromMapOrDefault<DWORD>(
+         g_mapDataDirectoryIndexToDisplayText,
+         static_cast<DWORD>(index),
+         _T("unknown"));
+
+      CString addressText;
+      addressText.Format(_T("0x%08x"), entry.virtualAddress);
+
+      CString sizeText;
+      sizeText.Format(_T("0x%08x"), entry.size);
+
+      dataDirectoryData.push_back(
+         std::vector<CString> {
+         indexText,
+            name,
+            addressText,
+            sizeText,
+      });
+
+      auto dataDirectoryEntryNode = std::make_shared<StructListViewNode>(
+         _T("Data directory ") + name,
+         NodeTreeIconID::nodeTreeIconBinary,
+         g_definitionDataDirectoryEntry,
+         &entry,
+         m_file.Data());
+
+      dataDirectoryChildNodes.push_back(dataDirectoryEntryNode);
+   }
+
+   summaryText.AppendFormat(_T("Data directory with %zu entries.\n"),
+      image.NumberOfDataDirectories());
+
+   static std::vector<CString> dataDirectoryColumnNames
+   {
+      _T("Index"),
+      _T("Directory"),
+      _T("Address"),
+      _T("Size"),
+   };
+
+   auto dataDirectoryNode = std::make_shared<FilterSortListViewNode>(
+      _T("Data Directories"),
+      NodeTreeIconID::nodeTreeIconTable,
+      dataDirectoryColumnNames,
+      dataDirectoryData,
+      false);
+
+   dataDirectoryNode->ChildNodes().swap(dataDirectoryChildNodes);
+
+   rootNode.ChildNodes().push_back(dataDirectoryNode);
+}
+
+void PortableExecutableReader::AddExceptionDirectory(StaticNode& rootNode,
+   const PortableExecutableImage& image, CString& summaryText) const
+{
+   if (image.GetDataDirectory(DataDirectoryIndex::exceptionTable) == nullptr)
+      return;
+
+   RuntimeFunctionTable functionTable{ image };
+   if (!functionTable.IsAvailable())
+   {
+      summaryText += _T("Exception directory present, but the format is unsupported or invalid.\n");
+      return;
+   }
+
+   summaryText.AppendFormat(_T("Exception directory with %zu %s function entries.\n"),
+      functionTable.Count(),
+      functionTable.IsArm64() ? _T("ARM64") : _T("x64"));
+
+   DWORD entryPointRva = image.Is64BitImage()
+      ? reinterpret_cast<const OptionalHeader64*>(image.OptionalHeader())->addressOfEntryPoint
+      : reinterpret_cast<const OptionalHeader32*>(image.OptionalHeader())->addressOfEntryPoint;
+
+   if (entryPointRva != 0)
+   {
+      std::optional<size_t> entryPointFunction = functionTable.FindFunctionEntry(entryPointRva);
+      if (entryPointFunction.has_value())
+         summaryText.AppendFormat(_T("Entry point 0x%08x is in function entry %zu, 0x%08x-0x%08x.\n"),
+            entryPointRva,
+            entryPointFunction.value(),
+            functionTable.BeginAddress(entryPointFunction.value()),
+            functionTable.EndAddress(entryPointFunction.value()));
+      else
+         summaryText.AppendFormat(_T("Entry point 0x%08x has no function entry.\n"),
+            entryPointRva);
+   }
+
+   /// function table for formatting the rows when the node is shown; keeps
+   /// a copy of the file, since the image and the table refer to it
+   struct LazyFunctionTable
+   {
+      /// ctor
+      explicit LazyFunctionTable(const File& mappedFile)
+         :file(mappedFile),
+         image(file),
+         functionTable(image)
+      {
+      }
+
+      File file;
+      PortableExecutableImage image;
+      RuntimeFunctionTable functionTable;
+   };
+
+   auto lazyFunctionTable = std::make_shared<LazyFunctionTable>(m_file);
+
+   static std::vector<CString> functionTableColumnNames
+   {
+      _T("Index"),
+      _T("Begin address"),
+      _T("End address"),
+      _T("Unwind info address"),
+      _T("Unwind info"),
+   };
+
+   // decoding the unwind info of all functions takes a while for large
+   // images, so the rows are only formatted when the node is shown
+   auto functionTableNode = std::make_shared<FilterSortListViewNode>(
+      _T("Exception Directory"),
+      NodeTreeIconID::nodeTreeIconTable,
+      functionTableColumnNames,
+      functionTable.Count(),
+      [lazyFunctionTable](size_t index)
+      {
+         const RuntimeFunctionTable& table = lazyFunctionTable->functionTable;
+
+         CString indexText;
+         indexText.Format(_T("%zu"), index);
+
+         CString beginText;
+         beginText.Format(_T("0x%08x"), table.BeginAddress(index));
+
+         CString endText;
+         endText.Format(_T("0x%08x"), table.EndAddress(index));
+
+         CString unwindInfoAddressText;
+         DWORD unwindInfoAddress = table.UnwindInfoAddress(index);
+         if (unwindInfoAddress != 0)
+            unwindInfoAddressText.Format(_T("0x%08x"), unwindInfoAddress);
+
+         return std::vector<CString> {
+            indexText,
+            beginText,
+            endText,
+            unwindInfoAddressText,
+            table.FormatUnwindInfo(index),
+         };
+      },
+      true);
+
+   rootNode.ChildNodes().push_back(functionTableNode);
+}
+
+void PortableExecutableReader::AddDebugDirectory(StaticNode& rootNode,
+   const PortableExecutableImage& image, CString& summaryText) const
+{
+   if (image.GetDataDirectory(DataDirectoryIndex::debug) == nullptr)
+      return;
+
+   DebugDirectoryTable debugDirectory{ image };
+   if (!debugDirectory.IsAvailable())
+   {
+      summaryText += _T("Error: Debug directory is outside of the file.\n");
+      return;
+   }
+
+   std::vector<std::vector<CString>> debugDirectoryData;
+   std::vector<std::shared_ptr<INode>> debugDirectoryChildNodes;
+
+   summaryText.AppendFormat(_T("Debug directory with %zu entries.\n"),
+      debugDirectory.Count());
+
+   for (size_t index = 0; index < debugDirectory.Count(); index++)
+   {
+      const DebugDirectoryEntry& entry = debugDirectory.Entry(index);
+      CString typeName = debugDirectory.TypeName(index);
+
+      CString indexText;
+      indexText.Format(_T("%zu"), index);
+
+      CString versionText;
+      versionText.Format(_T("%u.%u"), entry.majorVersion, entry.minorVersion);
+
+      CString sizeText;
+      sizeText.Format(_T("0x%08x"), entry.sizeOfData);
+
+      CString addressText;
+      addressText.Format(_T("0x%08x"), entry.addressOfRawData);
+
+      CString fileOffsetText;
+      fileOffsetText.Format(_T("0x%08x"), entry.pointerToRawData);
+
+      debugDirectoryData.push_back(
+         std::vector<CString> {
+         indexText,
+            typeName,
+            DisplayFormatHelper::FormatDateTime(entry.timeStamp),
+            versionText,
+            sizeText,
+            addressText,
+            fileOffsetText,
+            debugDirectory.FormatRecord(index),
+      });
+
+      auto debugDirectoryEntryNode = std::make_shared<StructListViewNode>(
+         _T("Debug directory entry ") + indexText + _T(" ") + typeName,
+         NodeTreeIconID::nodeTreeIconBinary,
+         g_definitionDebugDirectoryEntry,
+         &entry,
+         m_file.Data());
+
+      debugDirectoryChildNodes.push_back(debugDirectoryEntryNode);
+
+      std::optional<CodeViewPdbInfo> pdbInfo = debugDirectory.GetCodeViewPdbInfo(index);
+      if (pdbInfo.has_value())
+      {
+         summaryText.AppendFormat(_T("PDB file: %s\nSymbol server key: %s\n"),
+            pdbInfo->pdbPath.GetString(),
+            pdbInfo->FormatSymbolServerKey().GetString());
+
+         if (pdbInfo->isRsds)
+         {
+            auto codeViewNode = std::make_shared<StructListViewNode>(
+               _T("CodeView RSDS record"),
+               NodeTreeIconID::nodeTreeIconBinary,
+               g_definitionCodeViewRsdsRecord,
+               debugDirectory.RecordData(index),
+               m_file.Data());
+
+            debugDirectoryChildNodes.push_back(codeViewNode);
+         }
+      }
+
+      std::vector<PogoEntry> pogoEntries = debugDirectory.GetPogoEntries(index);
+      if (!pogoEntries.empty())
+      {
+         std::vector<std::vector<CString>> pogoData;
+         pogoData.reserve(pogoEntries.size());
+
+         for (const PogoEntry& pogoEntry : pogoEntries)
+         {
+            CString startAddressText;
+            startAddressText.Format(_T("0x%08x"), pogoEntry.startAddress);
+
+            CString pogoSizeText;
+            pogoSizeText.Format(_T("0x%08x"), pogoEntry.size);
+
+            pogoData.push_back(
+               std::vector<CString> {
+               startAddressText,
+                  pogoSizeText,
+                  pogoEntry.name,
+            });
+         }
+
+         static std::vector<CString> pogoColumnNames
+         {
+            _T("Start address"),
+            _T("Size"),
+            _T("Name"),
+         };
+
+         auto pogoNode = std::make_shared<FilterSortListViewNode>(
+            _T("POGO entries"),
+            NodeTreeIconID::nodeTreeIconTable,
+            pogoColumnNames,
+            pogoData,
+            true);
+
+         debugDirectoryChildNodes.push_back(pogoNode);
+      }
+   }
+
+   static std::vector<CString> debugDirectoryColumnNames
+   {
+      _T("Index"),
+      _T("Type"),
+      _T("Time stamp"),
+      _T("Version"),
+      _T("Size"),
+      _T("Address"),
+      _T("File offset"),
+      _T("Debug record"),
+   };
+
+   auto debugDirectoryNode = std::make_shared<FilterSortListViewNode>(
+      _T("Debug Directory"),
+      NodeTreeIconID::nodeTreeIconTable,
+      debugDirectoryColumnNames,
+      debugDirectoryData,
+      false);
+
+   debugDirectoryNode->ChildNodes().swap(debugDirectoryChildNodes);
+
+   rootNode.ChildNodes().push_back(debugDirectoryNode);
+}
+
+void PortableExecutableReader::AddLoadConfigDirectory(StaticNode& rootNode,
+   const PortableExecutableImage& image, CString& summaryText) const
+{
+   if (image.GetDataDirectory(DataDirectoryIndex::loadConfigTable) == nullptr)
+      return;
+
+   LoadConfiguration loadConfig{ image };
+   if (!loadConfig.IsAvailable())
+   {
+      summaryText += _T("Error: Load config directory is outside of the file.\n");
+      return;
+   }
+
+   CString loadConfigText;
+   loadConfigText.Format(_T("Load config directory, size %u bytes\n"), loadConfig.Size());
+
+   CString guardFlagsText = DisplayFormatHelper::FormatBitFlagsFromMap(
+      g_mapGuardFlagsToDisplayText,
+      loadConfig.GuardFlags());
+
+   loadConfigText.AppendFormat(_T("Guard flags: 0x%08x\n%s\n\n"),
+      loadConfig.GuardFlags(),
+      guardFlagsText.GetString());
+
+   auto loadConfigNode = std::make_shared<CodeTextViewNode>(
+      _T("Load Config Directory"),
+      NodeTreeIconID::nodeTreeIconLibrary);
+
+   // older images store a shorter struct; the remaining fields aren't shown then
+   size_t structSize = image.Is64BitImage()
+      ? sizeof(LoadConfigDirectory64)
+      : sizeof(LoadConfigDirectory32);
+
+   if (loadConfig.Size() >= structSize)
+   {
+      auto loadConfigStructNode = std::make_shared<StructListViewNode>(
+         _T("Load config directory"),
+         NodeTreeIconID::nodeTreeIconBinary,
+         image.Is64BitImage() ? g_definitionLoadConfigDirectory64 : g_definitionLoadConfigDirectory32,
+         loadConfig.Data(),
+         m_file.Data());
+
+      loadConfigNode->ChildNodes().push_back(loadConfigStructNode);
+   }
+   else
+      loadConfigText.AppendFormat(_T("The struct is shorter than the known size of %zu bytes.\n"),
+         structSize);
+
+   std::pair<LPCTSTR, const GuardAddressTable&> guardTablesList[] =
+   {
+      { _T("SafeSEH handler table"), loadConfig.SafeSehHandlerTable() },
+      { _T("Guard CF function table"), loadConfig.GuardFunctionTable() },
+      { _T("Guard address taken IAT entry table"), loadConfig.GuardAddressTakenIatTable() },
+      { _T("Guard long jump target table"), loadConfig.GuardLongJumpTargetTable() },
+      { _T("Guard EH continuation table"), loadConfig.GuardEHContinuationTable() },
+   };
+
+   for (const auto& [displayName, guardTable] : guardTablesList)
+   {
+      if (!guardTable.IsAvailable())
+         continue;
+
+      loadConfigText.AppendFormat(_T("%s: %zu entries, %zu bytes per entry\n"),
+         displayName,
+         guardTable.Count(),
+         guardTable.EntrySize());
+
+      loadConfigNode->ChildNodes().push_back(
+         CreateGuardTableNode(displayName, guardTable));
+   }
+
+   loadConfigNode->SetText(loadConfigText);
+
+   rootNode.ChildNodes().push_back(loadConfigNode);
+
+   summaryText.AppendFormat(_T("Load config directory with %zu CFG functions.\n"),
+      loadConfig.GuardFunctionTable().Count());
+}
+
+void PortableExecutableReader::AddTlsDirectory(StaticNode& rootNode,
+   const PortableExecutableImage& image, CString& summaryText) const
+{
+   const DataDirectoryEntry* tlsDirectory =
+      image.GetDataDirectory(DataDirectoryIndex::tlsTable);
+
+   if (tlsDirectory == nullptr)
+      return;
+
+   size_t structSize = image.Is64BitImage()
+      ? sizeof(TlsDirectory64)
+      : sizeof(TlsDirectory32);
+
+   const BYTE* tlsData = image.DataAtRva<BYTE>(tlsDirectory->virtualAddress, structSize);
+   if (tlsData == nullptr)
+   {
+      summaryText += _T("Error: TLS directory is outside of the file.\n");
+      return;
+   }
+
+   ULONGLONG addressOfCallbacks = image.Is64BitImage()
+      ? reinterpret_cast<const TlsDirectory64*>(tlsData)->addressOfCallbacks
+      : reinterpret_cast<const TlsDirectory32*>(tlsData)->addressOfCallbacks;
+
+   auto tlsNode = std::make_shared<CodeTextViewNode>(
+      _T("TLS Directory"),
+      NodeTreeIconID::nodeTreeIconLibrary);
+
+   tlsNode->ChildNodes().push_back(
+      std::make_shared<StructListViewNode>(
+         _T("TLS directory"),
+         NodeTreeIconID::nodeTreeIconBinary,
+         image.Is64BitImage() ? g_definitionTlsDirectory64 : g_definitionTlsDirectory32,
+         tlsData,
+         m_file.Data()));
+
+   // the callbacks are stored as a zero-terminated array of VAs
+   std::vector<std::vector<CString>> callbackData;
+
+   // callback RVAs and their row index, for looking up the function entries
+   std::vector<std::pair<DWORD, size_t>> callbackRvaList;
+
+   ULONGLONG imageBase = image.ImageBase();
+   size_t pointerSize = image.Is64BitImage() ? sizeof(ULONGLONG) : sizeof(DWORD);
+
+   for (size_t index = 0; addressOfCallbacks >= imageBase; index++)
+   {
+      ULONGLONG entryAddress = addressOfCallbacks + index * pointerSize - imageBase;
+      if (entryAddress > MAXDWORD)
+         break;
+
+      const BYTE* entry = image.DataAtRva<BYTE>(static_cast<DWORD>(entryAddress), pointerSize);
+      if (entry == nullptr)
+      {
+         summaryText += _T("Error: TLS callbacks array is outside of the file.\n");
+         break;
+      }
+
+      ULONGLONG callbackAddress = image.Is64BitImage()
+         ? *reinterpret_cast<const ULONGLONG*>(entry)
+         : *reinterpret_cast<const DWORD*>(entry);
+
+      if (callbackAddress == 0)
+         break;
+
+      CString indexText;
+      indexText.Format(_T("%zu"), index);
+
+      CString addressText;
+      addressText.Format(_T("0x%llx"), callbackAddress);
+
+      CString rvaText;
+      if (callbackAddress >= imageBase)
+         rvaText.Format(_T("0x%08llx"), callbackAddress - imageBase);
+
+      if (callbackAddress >= imageBase &&
+         callbackAddress - imageBase <= MAXDWORD)
+      {
+         callbackRvaList.push_back(
+            std::make_pair(static_cast<DWORD>(callbackAddress - imageBase), callbackData.size()));
+      }
+
+      callbackData.push_back(
+         std::vector<CString> {
+         indexText,
+            addressText,
+            rvaText,
+            CString{},
+      });
+   }
+
+   // map all callbacks to their function entries in a single pass over the
+   // exception directory
+   RuntimeFunctionTable functionTable{ image };
+   if (functionTable.IsAvailable())
+   {
+      std::sort(callbackRvaList.begin(), callbackRvaList.end());
+
+      std::vector<DWORD> sortedRvaList;
+      for (const auto& [rva, rowIndex] : callbackRvaList)
+         sortedRvaList.push_back(rva);
+
+      std::vector<std::optional<size_t>> functionEntries =
+         functionTable.FindFunctionEntries(sortedRvaList);
+
+      for (size_t index = 0; index < callbackRvaList.size(); index++)
+      {
+         if (!functionEntries[index].has_value())
+            continue;
+
+         size_t functionIndex = functionEntries[index].value();
+         callbackData[callbackRvaList[index].second][3].Format(_T("%zu: 0x%08x-0x%08x"),
+            functionIndex,
+            functionTable.BeginAddress(functionIndex),
+            functionTable.EndAddress(functionIndex));
+      }
+   }
+
+   static std::vector<CString> callbackColumnNames
+   {
+      _T("Index"),
+      _T("Address (VA)"),
+      _T("Address (RVA)"),
+      _T("Function entry"),
+   };
+
+   auto callbackNode = std::make_shared<FilterSortListViewNode>(
+      _T("TLS callbacks"),
+      NodeTreeIconID::nodeTreeIconTable,
+      callbackColumnNames,
+      callbackData,
+      false);
+
+   tlsNode->ChildNodes().push_back(callbackNode);
+
+   CString tlsText;
+   tlsText.Format(_T("TLS directory with %zu callbacks.\n"), callbackData.size());
+
+   tlsNode->SetText(tlsText);
+
+   rootNode.ChildNodes().push_back(tlsNode);
+
+   summaryText += tlsText;
+}
+
+void PortableExecutableReader::AddSecurityDirectory(StaticNode& rootNode,
+   const PortableExecutableImage& image, CString& summaryText) const
+{
+   // the checksum and the Authenticode digests are calculated over the whole
+   // image, so they are only calculated when their nodes are shown
+   summaryText.AppendFormat(
+      _T("Checksum: stored 0x%08x, not calculated yet; see \"Image Checksum\" node\n"),
+      ImageHashCalculator{ image }.StoredChecksum());
+
+   File file = m_file;
+
+   rootNode.ChildNodes().push_back(
+      std::make_shared<CodeTextViewNode>(
+         _T("Image Checksum"),
+         NodeTreeIconID::nodeTreeIconDocument,
+         [file]()
+         {
+            PortableExecutableImage lazyImage{ file };
+            ImageHashCalculator hashCalculator{ lazyImage };
+
+            DWORD storedChecksum = hashCalculator.StoredChecksum();
+            DWORD calculatedChecksum = hashCalculator.CalculateChecksum();
+
+            CString checksumText;
+            checksumText.Format(_T("Checksum: stored 0x%08x, calculated 0x%08x (%s)\n"),
+               storedChecksum,
+               calculatedChecksum,
+               storedChecksum == 0 ? _T("not set")
+               : storedChecksum == calculatedChecksum ? _T("valid") : _T("invalid"));
+
+            return checksumText;
+         }));
+
+   // the security directory contains a file offset instead of an RVA
+   const DataDirectoryEntry* securityDirectory =
+      image.GetDataDirectory(DataDirectoryIndex::certificateTable);
+
+   if (securityDirectory == nullptr)
+      return;
+
+   size_t tableOffset = securityDirectory->virtualAddress;
+   size_t tableSize = securityDirectory->size;
+
+   if (tableOffset + tableSize > m_file.Size())
+   {
+      summaryText += _T("Error: Security directory is outside of the file.\n");
+      return;
+   }
+
+   /// location of a certificate's PKCS#7 SignedData
+   struct SignedDataLocation
+   {
+      size_t index;
+      size_t dataOffset;
+      size_t dataSize;
+   };
+
+   std::vector<SignedDataLocation> signedDataLocations;
+   CString certificateErrorText;
+
+   std::vector<std::vector<CString>> certificateData;
+   std::vector<std::shared_ptr<INode>> certificateNodes;
+
+   size_t certificateOffset = tableOffset;
+   for (size_t index = 0;
+      certificateOffset + sizeof(WinCertificateHeader) <= tableOffset + tableSize;
+      index++)
+   {
+      const WinCertificateHeader& header =
+         *m_file.Data<WinCertificateHeader>(certificateOffset);
+
+      if (header.length < sizeof(WinCertificateHeader) ||
+         certificateOffset + header.length > tableOffset + tableSize)
+      {
+         certificateErrorText = _T("Error: Invalid certificate entry length.\n");
+         break;
+      }
+
+      size_t dataOffset = certificateOffset + sizeof(WinCertificateHeader);
+      size_t dataSize = header.length - sizeof(WinCertificateHeader);
+
+      CString indexText;
+      indexText.Format(_T("%zu"), index);
+
+      CString offsetText;
+      offsetText.Format(_T("0x%08zx"), certificateOffset);
+
+      CString lengthText;
+      lengthText.Format(_T("0x%08x"), header.length);
+
+      certificateData.push_back(
+         std::vector<CString> {
+         indexText,
+            offsetText,
+            lengthText,
+            GetValueFromMapOrDefault<DWORD>(g_mapWinCertificateRevisionToDisplayText, header.revision, _T("unknown")),
+            GetValueFromMapOrDefault<DWORD>(g_mapWinCertificateTypeToDisplayText, header.certificateType, _T("unknown")),
+      });
+
+      certificateNodes.push_back(
+         std::make_shared<StructListViewNode>(
+            _T("Certificate ") + indexText,
+            NodeTreeIconID::nodeTreeIconBinary,
+            g_definitionWinCertificateHeader,
+            &header,
+            m_file.Data()));
+
+      certificateNodes.push_back(
+         std::make_shared<HexDataViewNode>(
+            _T("Certificate ") + indexText + _T(" data"),
+            NodeTreeIconID::nodeTreeIconBinary,
+            m_file,
+            dataOffset,
+            dataSize));
+
+      if (header.certificateType == c_winCertificateTypePkcsSignedData)
+         signedDataLocations.push_back(SignedDataLocation{ index, dataOffset, dataSize });
+
+      // entries are aligned to 8 bytes
+      certificateOffset += (header.length + 7) & ~size_t(7);
+   }
+
+   static std::vector<CString> certificateColumnNames
+   {
+      _T("Index"),
+      _T("Offset"),
+      _T("Length"),
+      _T("Revision"),
+      _T("Type"),
+   };
+
+   auto certificateTableNode = std::make_shared<FilterSortListViewNode>(
+      _T("Certificate table"),
+      NodeTreeIconID::nodeTreeIconTable,
+      certificateColumnNames,
+      certificateData,
+      false);
+
+   // the digests are verified when the node is shown the first time
+   auto securityNode = std::make_shared<CodeTextViewNode>(
+      _T("Security Directory"),
+      NodeTreeIconID::nodeTreeIconLibrary,
+      [file, signedDataLocations, certificateErrorText]()
+      {
+         PortableExecutableImage lazyImage{ file };
+         ImageHashCalculator hashCalculator{ lazyImage };
+
+         CString securityText;
+
+         for (const SignedDataLocation& location : signedDataLocations)
+         {
+            std::optional<AuthenticodeDigest> signedDigest =
+               ImageHashCalculator::ExtractSignedDigest(
+                  file.Data<BYTE>(location.dataOffset), location.dataSize);
+
+            if (!signedDigest.has_value())
+            {
+               securityText.AppendFormat(_T("Certificate %zu: no Authenticode digest found\n"),
+                  location.index);
+               continue;
+            }
+
+            std::vector<BYTE> calculatedDigest =
+               hashCalculator.CalculateAuthenticodeDigest(signedDigest->algorithmId);
+
+            securityText.AppendFormat(
+               _T("Certificate %zu: Authenticode %s digest\n")
+               _T("   signed:     %s\n")
+               _T("   calculated: %s\n")
+               _T("   %s\n"),
+               location.index,
+               ImageHashCalculator::AlgorithmDisplayName(signedDigest->algorithmId),
+               FormatDigest(signedDigest->digest).GetString(),
+               FormatDigest(calculatedDigest).GetString(),
+               calculatedDigest == signedDigest->digest
+               ? _T("The digest matches; the image wasn't modified after signing.")
+               : _T("Error: The digest doesn't match; the image was modified after signing!"));
+         }
+
+         return securityText + certificateErrorText;
+      });
+
+   securityNode->ChildNodes().push_back(certificateTableNode);
+   securityNode->ChildNodes().insert(securityNode->ChildNodes().end(),
+      certificateNodes.begin(), certificateNodes.end());
+
+   rootNode.ChildNodes().push_back(securityNode);
+
+   summaryText.AppendFormat(_T("Security directory with %zu certificates.\n"),
+      certificateData.size());
+}
+
+void PortableExecutableReader::AddClrRuntimeHeader(StaticNode& rootNode,
+   const PortableExecutableImage& image, CString& summaryText) const
+{
+   const DataDirectoryEntry* clrDirectory =
+      image.GetDataDirectory(DataDirectoryIndex::clrRuntimeHeader);
+
+   if (clrDirectory == nullptr)
+      return;
+
+   const CliHeader* cliHeader = image.DataAtRva<CliHeader>(clrDirectory->virtualAddress);
+   if (cliHeader == nullptr)
+   {
+      summaryText += _T("Error: CLI header is outside of the file.\n");
+      return;
+   }
+
+   auto clrNode = std::make_shared<CodeTextViewNode>(
+      _T("CLR Runtime Header"),
+      NodeTreeIconID::nodeTreeIconLibrary);
+
+   clrNode->ChildNodes().push_back(
+      std::make_shared<StructListViewNode>(
+         _T("CLI header"),
+         NodeTreeIconID::nodeTreeIconBinary,
+         g_definitionCliHeader,
+         cliHeader,
+         m_file.Data()));
+
+   CString clrText;
+   clrText.Format(_T("Managed image, requires runtime %u.%u\n"),
+      cliHeader->majorRuntimeVersion,
+      cliHeader->minorRuntimeVersion);
+
+   const BYTE* metadata = image.DataAtRva<BYTE>(cliHeader->metadataRva, cliHeader->metadataSize);
+   if (metadata == nullptr ||
+      cliHeader->metadataSize == 0)
+   {
+      clrText += _T("Error: CLR metadata is outside of the file.\n");
+   }
+   else
+   {
+      ClrMetadataNodeTreeBuilder builder{ m_file, m_file.OffsetOf(metadata), cliHeader->metadataSize };
+
+      clrNode->ChildNodes().push_back(builder.BuildMetadataNode());
+
+      clrText += builder.GetMetadataSummary();
+   }
+
+   clrNode->SetText(clrText);
+
+   rootNode.ChildNodes().push_back(clrNode);
+
+   summaryText.AppendFormat(_T("Managed image with CLR runtime %u.%u.\n"),
+      cliHeader->majorRuntimeVersion,
+      cliHeader->minorRuntimeVersion);
+}
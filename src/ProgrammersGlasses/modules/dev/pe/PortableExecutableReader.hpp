@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file PortableExecutableReader.hpp
 /// \brief reader for Portable Executable files
@@ -9,6 +9,9 @@
 
 #include "modules/IReader.hpp"
 
+class StaticNode;
+class PortableExecutableImage;
+
 /// PE reader
 class PortableExecutableReader : public IReader
 {
@@ -33,6 +36,41 @@ public:
    void Load() override;
    void Cleanup() override;
 
+private:
+   /// adds optional header node
+   void AddOptionalHeader(StaticNode& rootNode,
+      const PortableExecutableImage& image, CString& summaryText) const;
+
+   /// adds data directories table node
+   void AddDataDirectories(StaticNode& rootNode,
+      const PortableExecutableImage& image, CString& summaryText) const;
+
+   /// adds exception directory (.pdata) function table node
+   void AddExceptionDirectory(StaticNode& rootNode,
+      const PortableExecutableImage& image, CString& summaryText) const;
+
+   /// adds debug directory table node
+   void AddDebugDirectory(StaticNode& rootNode,
+      const PortableExecutableImage& image, CString& summaryText) const;
+
+   /// adds load configuration directory node, including the guard tables
+   void AddLoadConfigDirectory(StaticNode& rootNode,
+      const PortableExecutableImage& image, CString& summaryText) const;
+
+   /// adds thread local storage (TLS) directory node
+   void AddTlsDirectory(StaticNode& rootNode,
+      const PortableExecutableImage& image, CString& summaryText) const;
+
+   /// adds image checksum node and security directory node, including the
+   /// Authenticode digest verification; both are calculated lazily
+   void AddSecurityDirectory(StaticNode& rootNode,
+      const PortableExecutableImage& image, CString& summaryText) const;
+
+   /// adds CLR runtime header node, including the CLR metadata of managed
+   /// images
+   void AddClrRuntimeHeader(StaticNode& rootNode,
+      const PortableExecutableImage& image, CString& summaryText) const;
+
 private:
    /// file to read from
    File m_file;
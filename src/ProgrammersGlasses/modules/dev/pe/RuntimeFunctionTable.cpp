@@ -0,0 +1,370 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file RuntimeFunctionTable.cpp
+/// \brief function table from the exception directory (.pdata)
+//
+#include "stdafx.h"
+#include "RuntimeFunctionTable.hpp"
+#include "PortableExecutableImage.hpp"
+#include "ExceptionDirectory.hpp"
+#include "OptionalHeader.hpp"
+
+/// machine type for x64 images
+constexpr WORD c_machineAmd64 = 0x8664;
+
+/// machine type for ARM64 images
+constexpr WORD c_machineArm64 = 0xaa64;
+
+RuntimeFunctionTable::RuntimeFunctionTable(const PortableExecutableImage& image)
+   :m_image(image)
+{
+   if (!image.IsValid())
+      return;
+
+   WORD machine = image.TargetMachine();
+   if (machine == c_machineAmd64)
+      m_entrySize = sizeof(RuntimeFunctionX64);
+   else if (machine == c_machineArm64)
+   {
+      m_entrySize = sizeof(RuntimeFunctionArm64);
+      m_isArm64 = true;
+   }
+   else
+      return;
+
+   const DataDirectoryEntry* exceptionDirectory =
+      image.GetDataDirectory(DataDirectoryIndex::exceptionTable);
+
+   if (exceptionDirectory == nullptr)
+      return;
+
+   size_t count = exceptionDirectory->size / m_entrySize;
+
+   const BYTE* entries =
+      image.DataAtRva<BYTE>(exceptionDirectory->virtualAddress, count * m_entrySize);
+
+   if (entries == nullptr)
+      return;
+
+   m_entries = entries;
+   m_count = count;
+}
+
+const BYTE* RuntimeFunctionTable::EntryPointer(size_t index) const
+{
+   ATLASSERT(index < m_count);
+   return m_entries + index * m_entrySize;
+}
+
+DWORD RuntimeFunctionTable::BeginAddress(size_t index) const
+{
+   // beginAddress is the first field in both formats
+   return *reinterpret_cast<const DWORD*>(EntryPointer(index));
+}
+
+DWORD RuntimeFunctionTable::EndAddress(size_t index) const
+{
+   if (!m_isArm64)
+      return reinterpret_cast<const RuntimeFunctionX64*>(EntryPointer(index))->endAddress;
+
+   const RuntimeFunctionArm64& entry =
+      *reinterpret_cast<const RuntimeFunctionArm64*>(EntryPointer(index));
+
+   DWORD functionLength = 0;
+   if ((entry.unwindData & 3) != 0)
+      functionLength = GetBits<DWORD>(entry.unwindData, 2, 11);
+   else
+   {
+      const DWORD* xdataHeader = m_image.DataAtRva<DWORD>(entry.unwindData);
+      if (xdataHeader != nullptr)
+         functionLength = GetBits<DWORD>(*xdataHeader, 0, 18);
+   }
+
+   return entry.beginAddress + functionLength * 4;
+}
+
+DWORD RuntimeFunctionTable::UnwindInfoAddress(size_t index) const
+{
+   if (!m_isArm64)
+      return reinterpret_cast<const RuntimeFunctionX64*>(EntryPointer(index))->unwindInfoAddress;
+
+   DWORD unwindData =
+      reinterpret_cast<const RuntimeFunctionArm64*>(EntryPointer(index))->unwindData;
+
+   return (unwindData & 3) == 0 ? unwindData : 0;
+}
+
+std::optional<size_t> RuntimeFunctionTable::FindFunctionEntry(DWORD rva) const
+{
+   // find the first entry that starts after the RVA
+   size_t low = 0;
+   size_t high = m_count;
+   while (low < high)
+   {
+      size_t middle = low + (high - low) / 2;
+      if (BeginAddress(middle) <= rva)
+         low = middle + 1;
+      else
+         high = middle;
+   }
+
+   if (low == 0)
+      return std::nullopt;
+
+   size_t index = low - 1;
+   if (rva >= EndAddress(index))
+      return std::nullopt;
+
+   return index;
+}
+
+std::vector<std::optional<size_t>> RuntimeFunctionTable::FindFunctionEntries(
+   const std::vector<DWORD>& sortedRvaList) const
+{
+   ATLASSERT(std::is_sorted(sortedRvaList.begin(), sortedRvaList.end()));
+
+   std::vector<std::optional<size_t>> result;
+   result.reserve(sortedRvaList.size());
+
+   size_t index = 0;
+   for (DWORD rva : sortedRvaList)
+   {
+      // skip all functions ending before the RVA; since the RVAs are sorted,
+      // the table index never has to move backwards
+      while (index < m_count &&
+         EndAddress(index) <= rva)
+         index++;
+
+      if (index < m_count &&
+         BeginAddress(index) <= rva)
+         result.push_back(index);
+      else
+         result.push_back(std::nullopt);
+   }
+
+   return result;
+}
+
+CString RuntimeFunctionTable::FormatUnwindInfo(size_t index) const
+{
+   if (!m_isArm64)
+      return FormatUnwindInfoX64(UnwindInfoAddress(index));
+
+   return FormatUnwindDataArm64(
+      reinterpret_cast<const RuntimeFunctionArm64*>(EntryPointer(index))->unwindData);
+}
+
+CString RuntimeFunctionTable::FormatUnwindInfoX64(DWORD unwindInfoRva) const
+{
+   const UnwindInfoX64* unwindInfo = m_image.DataAtRva<UnwindInfoX64>(unwindInfoRva);
+   if (unwindInfo == nullptr)
+      return _T("Error: unwind info is outside of the file");
+
+   BYTE version = GetBits<BYTE>(unwindInfo->versionAndFlags, 0, 3);
+   BYTE flags = GetBits<BYTE>(unwindInfo->versionAndFlags, 3, 5);
+
+   CString text;
+   text.Format(_T("v%u, prolog size 0x%02x"), version, unwindInfo->sizeOfProlog);
+
+   BYTE frameRegister = GetBits<BYTE>(unwindInfo->frameRegisterAndOffset, 0, 4);
+   if (frameRegister != 0)
+   {
+      text.AppendFormat(_T(", frame %s+0x%x"),
+         GetValueFromMapOrDefault<DWORD>(g_mapUnwindRegisterX64ToDisplayText, frameRegister, _T("?")),
+         GetBits<BYTE>(unwindInfo->frameRegisterAndOffset, 4, 4) * 16);
+   }
+
+   // the unwind codes array is padded to an even number of slots
+   size_t numSlots = unwindInfo->countOfCodes;
+   size_t numSlotsPadded = (numSlots + 1) & ~size_t(1);
+
+   const UnwindCodeX64* codes = m_image.DataAtRva<UnwindCodeX64>(
+      unwindInfoRva + sizeof(UnwindInfoX64), numSlotsPadded);
+
+   if (codes == nullptr)
+      return text + _T("; Error: unwind codes are outside of the file");
+
+   for (size_t slot = 0; slot < numSlots; )
+   {
+      const UnwindCodeX64& code = codes[slot];
+      BYTE operation = GetBits<BYTE>(code.unwindOpAndInfo, 0, 4);
+      BYTE operationInfo = GetBits<BYTE>(code.unwindOpAndInfo, 4, 4);
+
+      LPCTSTR registerName = GetValueFromMapOrDefault<DWORD>(
+         g_mapUnwindRegisterX64ToDisplayText, operationInfo, _T("?"));
+
+      // number of slots used by the operation, and the operand value
+      size_t usedSlots = 1;
+      DWORD operand = 0;
+      auto slotValue = [&](size_t slotOffset) -> DWORD
+      {
+         return slot + slotOffset < numSlots
+            ? *reinterpret_cast<const WORD*>(&codes[slot + slotOffset])
+            : 0;
+      };
+
+      text.AppendFormat(_T("; @0x%02x "), code.codeOffset);
+
+      switch (operation)
+      {
+      case 0: // UWOP_PUSH_NONVOL
+         text.AppendFormat(_T("push %s"), registerName);
+         break;
+
+      case 1: // UWOP_ALLOC_LARGE
+         if (operationInfo == 0)
+         {
+            usedSlots = 2;
+            operand = slotValue(1) * 8;
+         }
+         else
+         {
+            usedSlots = 3;
+            operand = slotValue(1) | (slotValue(2) << 16);
+         }
+         text.AppendFormat(_T("alloc 0x%x"), operand);
+         break;
+
+      case 2: // UWOP_ALLOC_SMALL
+         text.AppendFormat(_T("alloc 0x%x"), operationInfo * 8 + 8);
+         break;
+
+      case 3: // UWOP_SET_FPREG
+         text += _T("set frame pointer");
+         break;
+
+      case 4: // UWOP_SAVE_NONVOL
+         usedSlots = 2;
+         text.AppendFormat(_T("save %s at 0x%x"), registerName, slotValue(1) * 8);
+         break;
+
+      case 5: // UWOP_SAVE_NONVOL_FAR
+         usedSlots = 3;
+         text.AppendFormat(_T("save %s at 0x%x"), registerName,
+            slotValue(1) | (slotValue(2) << 16));
+         break;
+
+      case 6: // UWOP_EPILOG, version 2 only
+         usedSlots = 2;
+         text += _T("epilog");
+         break;
+
+      case 7: // UWOP_SPARE_CODE
+         usedSlots = 3;
+         text += _T("spare");
+         break;
+
+      case 8: // UWOP_SAVE_XMM128
+         usedSlots = 2;
+         text.AppendFormat(_T("save XMM%u at 0x%x"), operationInfo, slotValue(1) * 16);
+         break;
+
+      case 9: // UWOP_SAVE_XMM128_FAR
+         usedSlots = 3;
+         text.AppendFormat(_T("save XMM%u at 0x%x"), operationInfo,
+            slotValue(1) | (slotValue(2) << 16));
+         break;
+
+      case 10: // UWOP_PUSH_MACHFRAME
+         text += operationInfo != 0
+            ? _T("push machine frame with error code")
+            : _T("push machine frame");
+         break;
+
+      default:
+         text.AppendFormat(_T("unknown operation %u"), operation);
+         break;
+      }
+
+      slot += usedSlots;
+   }
+
+   DWORD trailerRva = unwindInfoRva +
+      static_cast<DWORD>(sizeof(UnwindInfoX64) + numSlotsPadded * sizeof(UnwindCodeX64));
+
+   if ((flags & c_unwindFlagChainInfo) != 0)
+   {
+      const RuntimeFunctionX64* chainedEntry = m_image.DataAtRva<RuntimeFunctionX64>(trailerRva);
+      if (chainedEntry != nullptr)
+         text.AppendFormat(_T("; chained to function 0x%08x-0x%08x"),
+            chainedEntry->beginAddress,
+            chainedEntry->endAddress);
+   }
+   else if ((flags & (c_unwindFlagExceptionHandler | c_unwindFlagTerminationHandler)) != 0)
+   {
+      const DWORD* handlerRva = m_image.DataAtRva<DWORD>(trailerRva);
+      if (handlerRva != nullptr)
+         text.AppendFormat(_T("; %s handler 0x%08x"),
+            (flags & c_unwindFlagExceptionHandler) != 0 ? _T("exception") : _T("termination"),
+            *handlerRva);
+   }
+
+   return text;
+}
+
+CString RuntimeFunctionTable::FormatUnwindDataArm64(DWORD unwindData) const
+{
+   CString text;
+
+   DWORD flag = GetBits<DWORD>(unwindData, 0, 2);
+   if (flag == 0)
+   {
+      const DWORD* xdata = m_image.DataAtRva<DWORD>(unwindData);
+      if (xdata == nullptr)
+         return _T("Error: .xdata record is outside of the file");
+
+      DWORD header = *xdata;
+      DWORD epilogCount = GetBits<DWORD>(header, 22, 5);
+      DWORD codeWords = GetBits<DWORD>(header, 27, 5);
+
+      // when both values are zero, an extension word holds larger values
+      if (epilogCount == 0 && codeWords == 0)
+      {
+         const DWORD* extension = m_image.DataAtRva<DWORD>(unwindData + 4);
+         if (extension != nullptr)
+         {
+            epilogCount = GetBits<DWORD>(*extension, 0, 16);
+            codeWords = GetBits<DWORD>(*extension, 16, 8);
+         }
+      }
+
+      text.Format(_T(".xdata: function length 0x%x, version %u, %u epilog scopes, %u code words"),
+         GetBits<DWORD>(header, 0, 18) * 4,
+         GetBits<DWORD>(header, 18, 2),
+         epilogCount,
+         codeWords);
+
+      if (GetBits<DWORD>(header, 21, 1) != 0)
+         text += _T(", single epilog packed in header");
+
+      if (GetBits<DWORD>(header, 20, 1) != 0)
+         text += _T(", has exception handler");
+
+      return text;
+   }
+
+   if (flag == 3)
+      return _T("reserved unwind data format");
+
+   static const LPCTSTR c_chainedReturnText[] =
+   {
+      _T("unchained"),
+      _T("unchained, lr saved on the stack"),
+      _T("chained, return address signed with pacibsp"),
+      _T("chained, <x29,lr> saved as a pair"),
+   };
+
+   text.Format(_T("packed%s: function length 0x%x, frame size 0x%x, ")
+      _T("%u int regs, %u FP regs, %s%s"),
+      flag == 2 ? _T(" fragment") : _T(""),
+      GetBits<DWORD>(unwindData, 2, 11) * 4,
+      GetBits<DWORD>(unwindData, 23, 9) * 16,
+      GetBits<DWORD>(unwindData, 16, 4),
+      GetBits<DWORD>(unwindData, 13, 3) != 0 ? GetBits<DWORD>(unwindData, 13, 3) + 1 : 0,
+      c_chainedReturnText[GetBits<DWORD>(unwindData, 21, 2)],
+      GetBits<DWORD>(unwindData, 20, 1) != 0 ? _T(", homes parameters") : _T(""));
+
+   return text;
+}
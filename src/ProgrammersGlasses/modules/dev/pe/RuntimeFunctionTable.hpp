@@ -0,0 +1,86 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file RuntimeFunctionTable.hpp
+/// \brief function table from the exception directory (.pdata)
+//
+#pragma once
+
+#include <optional>
+
+class PortableExecutableImage;
+
+/// \brief Runtime function table
+/// \details Provides access to the RUNTIME_FUNCTION entries of the exception
+/// directory of x64 and ARM64 images. The entries are accessed directly in
+/// the mapped file. Since the table is sorted by function start address, an
+/// RVA can be mapped to its function entry using binary search, and a sorted
+/// list of RVAs can be mapped in a single merge pass over the table.
+class RuntimeFunctionTable
+{
+public:
+   /// ctor; locates the function table of the image
+   explicit RuntimeFunctionTable(const PortableExecutableImage& image);
+
+   /// returns if the image has a function table in a supported format
+   bool IsAvailable() const { return m_entries != nullptr; }
+
+   /// returns if the table has the ARM64 entry format
+   bool IsArm64() const { return m_isArm64; }
+
+   /// returns the number of function entries
+   size_t Count() const { return m_count; }
+
+   /// returns the size of a single function entry, in bytes
+   size_t EntrySize() const { return m_entrySize; }
+
+   /// returns pointer to the function entry with given index
+   const BYTE* EntryPointer(size_t index) const;
+
+   /// returns the function start RVA of the entry with given index
+   DWORD BeginAddress(size_t index) const;
+
+   /// returns the function end RVA (exclusive) of the entry with given index;
+   /// for ARM64 entries, the function length is taken from the packed unwind
+   /// data or the .xdata record
+   DWORD EndAddress(size_t index) const;
+
+   /// returns the RVA of the unwind info (x64) or .xdata record (ARM64), or 0
+   /// when the ARM64 entry uses packed unwind data
+   DWORD UnwindInfoAddress(size_t index) const;
+
+   /// finds the function entry containing the given RVA, using binary search
+   std::optional<size_t> FindFunctionEntry(DWORD rva) const;
+
+   /// finds the function entries for a list of RVAs sorted in ascending order,
+   /// using a single merge pass over the table; returns a list with the same
+   /// number of elements as the given RVA list
+   std::vector<std::optional<size_t>> FindFunctionEntries(const std::vector<DWORD>& sortedRvaList) const;
+
+   /// formats the unwind info of the function entry with given index as text
+   CString FormatUnwindInfo(size_t index) const;
+
+private:
+   /// formats x64 unwind info at given RVA
+   CString FormatUnwindInfoX64(DWORD unwindInfoRva) const;
+
+   /// formats ARM64 packed unwind data or .xdata record header
+   CString FormatUnwindDataArm64(DWORD unwindData) const;
+
+private:
+   /// PE image
+   const PortableExecutableImage& m_image;
+
+   /// pointer to first function entry; nullptr when not available
+   const BYTE* m_entries = nullptr;
+
+   /// size of a single entry
+   size_t m_entrySize = 0;
+
+   /// number of entries
+   size_t m_count = 0;
+
+   /// indicates if the entries have the ARM64 format
+   bool m_isArm64 = false;
+};
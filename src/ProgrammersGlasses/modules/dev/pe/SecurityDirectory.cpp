@@ -0,0 +1,51 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file SecurityDirectory.cpp
+/// \brief security directory (certificate table) definitions
+//
+#include "stdafx.h"
+#include "SecurityDirectory.hpp"
+
+const std::map<DWORD, LPCTSTR> g_mapWinCertificateRevisionToDisplayText =
+{
+   { 0x0100, _T("WIN_CERT_REVISION_1_0") },
+   { 0x0200, _T("WIN_CERT_REVISION_2_0") },
+};
+
+const std::map<DWORD, LPCTSTR> g_mapWinCertificateTypeToDisplayText =
+{
+   { 0x0001, _T("WIN_CERT_TYPE_X509") },
+   { 0x0002, _T("WIN_CERT_TYPE_PKCS_SIGNED_DATA") },
+   { 0x0003, _T("WIN_CERT_TYPE_RESERVED_1") },
+   { 0x0004, _T("WIN_CERT_TYPE_TS_STACK_SIGNED") },
+};
+
+const StructDefinition g_definitionWinCertificateHeader = StructDefinition({
+   StructField(
+      offsetof(WinCertificateHeader, WinCertificateHeader::length),
+      sizeof(WinCertificateHeader::length),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Length")),
+
+   StructField(
+      offsetof(WinCertificateHeader, WinCertificateHeader::revision),
+      sizeof(WinCertificateHeader::revision),
+      2,
+      true, // little-endian
+      StructFieldType::valueMapping,
+      g_mapWinCertificateRevisionToDisplayText,
+      _T("Revision")),
+
+   StructField(
+      offsetof(WinCertificateHeader, WinCertificateHeader::certificateType),
+      sizeof(WinCertificateHeader::certificateType),
+      2,
+      true, // little-endian
+      StructFieldType::valueMapping,
+      g_mapWinCertificateTypeToDisplayText,
+      _T("Certificate type")),
+   });
@@ -0,0 +1,41 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file SecurityDirectory.hpp
+/// \brief security directory (certificate table) definitions
+//
+#pragma once
+
+#include "StructDefinition.hpp"
+
+#pragma pack(push, 1)
+
+/// \brief Attribute certificate header
+/// \see https://learn.microsoft.com/en-us/windows/win32/debug/pe-format#the-attribute-certificate-table-image-only
+/// The header corresponds with wintrust.h's WIN_CERTIFICATE struct, without
+/// the certificate data. The certificate table isn't mapped into memory;
+/// the security data directory entry contains a file offset instead of an
+/// RVA. Each entry is aligned to 8 bytes.
+struct WinCertificateHeader
+{
+   DWORD length;           ///< length of the entry, including this header
+   WORD revision;          ///< certificate revision; see WIN_CERT_REVISION_* values
+   WORD certificateType;   ///< certificate type; see WIN_CERT_TYPE_* values
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(WinCertificateHeader) == 8, "certificate header must be 8 bytes long");
+
+/// certificate type for PKCS#7 SignedData structures, used by Authenticode
+constexpr WORD c_winCertificateTypePkcsSignedData = 0x0002;
+
+/// mapping of certificate revision to display text
+extern const std::map<DWORD, LPCTSTR> g_mapWinCertificateRevisionToDisplayText;
+
+/// mapping of certificate type to display text
+extern const std::map<DWORD, LPCTSTR> g_mapWinCertificateTypeToDisplayText;
+
+/// struct definition for above certificate header
+extern const StructDefinition g_definitionWinCertificateHeader;
@@ -0,0 +1,137 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file TlsDirectory.cpp
+/// \brief thread local storage (TLS) directory definitions
+//
+#include "stdafx.h"
+#include "TlsDirectory.hpp"
+
+/// mapping of TLS data alignment values to display text
+static const std::map<DWORD, LPCTSTR> g_mapTlsAlignmentToDisplayText =
+{
+   { 1, _T("IMAGE_SCN_ALIGN_1BYTES") },
+   { 2, _T("IMAGE_SCN_ALIGN_2BYTES") },
+   { 3, _T("IMAGE_SCN_ALIGN_4BYTES") },
+   { 4, _T("IMAGE_SCN_ALIGN_8BYTES") },
+   { 5, _T("IMAGE_SCN_ALIGN_16BYTES") },
+   { 6, _T("IMAGE_SCN_ALIGN_32BYTES") },
+   { 7, _T("IMAGE_SCN_ALIGN_64BYTES") },
+   { 8, _T("IMAGE_SCN_ALIGN_128BYTES") },
+   { 9, _T("IMAGE_SCN_ALIGN_256BYTES") },
+   { 10, _T("IMAGE_SCN_ALIGN_512BYTES") },
+   { 11, _T("IMAGE_SCN_ALIGN_1024BYTES") },
+   { 12, _T("IMAGE_SCN_ALIGN_2048BYTES") },
+   { 13, _T("IMAGE_SCN_ALIGN_4096BYTES") },
+   { 14, _T("IMAGE_SCN_ALIGN_8192BYTES") },
+};
+
+/// TLS characteristics bitfield
+static const std::vector<BitfieldDescriptor> g_listTlsCharacteristicsBits =
+{
+   BitfieldDescriptor{ 0, 20 }, // reserved
+   BitfieldDescriptor{ 20, 4, StructFieldType::valueMapping, g_mapTlsAlignmentToDisplayText },
+};
+
+const StructDefinition g_definitionTlsDirectory32 = StructDefinition({
+   StructField(
+      offsetof(TlsDirectory32, TlsDirectory32::startAddressOfRawData),
+      sizeof(TlsDirectory32::startAddressOfRawData),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Start address of raw data (VA)")),
+
+   StructField(
+      offsetof(TlsDirectory32, TlsDirectory32::endAddressOfRawData),
+      sizeof(TlsDirectory32::endAddressOfRawData),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("End address of raw data (VA)")),
+
+   StructField(
+      offsetof(TlsDirectory32, TlsDirectory32::addressOfIndex),
+      sizeof(TlsDirectory32::addressOfIndex),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Address of index (VA)")),
+
+   StructField(
+      offsetof(TlsDirectory32, TlsDirectory32::addressOfCallbacks),
+      sizeof(TlsDirectory32::addressOfCallbacks),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Address of callbacks (VA)")),
+
+   StructField(
+      offsetof(TlsDirectory32, TlsDirectory32::sizeOfZeroFill),
+      sizeof(TlsDirectory32::sizeOfZeroFill),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of zero fill")),
+
+   StructField(
+      offsetof(TlsDirectory32, TlsDirectory32::characteristics),
+      sizeof(TlsDirectory32::characteristics),
+      4,
+      true, // little-endian
+      StructFieldType::bitfieldMapping,
+      g_listTlsCharacteristicsBits,
+      _T("Characteristics")),
+   });
+
+const StructDefinition g_definitionTlsDirectory64 = StructDefinition({
+   StructField(
+      offsetof(TlsDirectory64, TlsDirectory64::startAddressOfRawData),
+      sizeof(TlsDirectory64::startAddressOfRawData),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Start address of raw data (VA)")),
+
+   StructField(
+      offsetof(TlsDirectory64, TlsDirectory64::endAddressOfRawData),
+      sizeof(TlsDirectory64::endAddressOfRawData),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("End address of raw data (VA)")),
+
+   StructField(
+      offsetof(TlsDirectory64, TlsDirectory64::addressOfIndex),
+      sizeof(TlsDirectory64::addressOfIndex),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Address of index (VA)")),
+
+   StructField(
+      offsetof(TlsDirectory64, TlsDirectory64::addressOfCallbacks),
+      sizeof(TlsDirectory64::addressOfCallbacks),
+      8,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Address of callbacks (VA)")),
+
+   StructField(
+      offsetof(TlsDirectory64, TlsDirectory64::sizeOfZeroFill),
+      sizeof(TlsDirectory64::sizeOfZeroFill),
+      4,
+      true, // little-endian
+      StructFieldType::unsignedInteger,
+      _T("Size of zero fill")),
+
+   StructField(
+      offsetof(TlsDirectory64, TlsDirectory64::characteristics),
+      sizeof(TlsDirectory64::characteristics),
+      4,
+      true, // little-endian
+      StructFieldType::bitfieldMapping,
+      g_listTlsCharacteristicsBits,
+      _T("Characteristics")),
+   });
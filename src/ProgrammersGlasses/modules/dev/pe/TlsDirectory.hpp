@@ -0,0 +1,51 @@
+//
+// Programmer's Glasses - a developer's file content viewer
+// Copyright (c) 2026 Michael Fink
+//
+/// \file TlsDirectory.hpp
+/// \brief thread local storage (TLS) directory definitions
+//
+#pragma once
+
+#include "StructDefinition.hpp"
+
+#pragma pack(push, 1)
+
+/// \brief TLS directory for PE32 images
+/// \see https://learn.microsoft.com/en-us/windows/win32/debug/pe-format#the-tls-section
+/// The struct corresponds with winnt.h's IMAGE_TLS_DIRECTORY32 struct.
+struct TlsDirectory32
+{
+   DWORD startAddressOfRawData;  ///< VA of the start of the TLS template
+   DWORD endAddressOfRawData;    ///< VA of the end of the TLS template
+   DWORD addressOfIndex;         ///< VA of the TLS index, assigned by the loader
+   DWORD addressOfCallbacks;     ///< VA of the zero-terminated array of TLS callback VAs
+   DWORD sizeOfZeroFill;         ///< size of zero-filled data following the TLS template
+   DWORD characteristics;        ///< bits 20-23: alignment of the TLS data
+};
+
+/// \brief TLS directory for PE32+ images
+/// The struct corresponds with winnt.h's IMAGE_TLS_DIRECTORY64 struct.
+struct TlsDirectory64
+{
+   ULONGLONG startAddressOfRawData; ///< VA of the start of the TLS template
+   ULONGLONG endAddressOfRawData;   ///< VA of the end of the TLS template
+   ULONGLONG addressOfIndex;        ///< VA of the TLS index, assigned by the loader
+   ULONGLONG addressOfCallbacks;    ///< VA of the zero-terminated array of TLS callback VAs
+   DWORD sizeOfZeroFill;            ///< size of zero-filled data following the TLS template
+   DWORD characteristics;           ///< bits 20-23: alignment of the TLS data
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(TlsDirectory32) == sizeof(IMAGE_TLS_DIRECTORY32),
+   "TLS directory 32 must have same size as IMAGE_TLS_DIRECTORY32");
+
+static_assert(sizeof(TlsDirectory64) == sizeof(IMAGE_TLS_DIRECTORY64),
+   "TLS directory 64 must have same size as IMAGE_TLS_DIRECTORY64");
+
+/// struct definition for above TLS directory for PE32 images
+extern const StructDefinition g_definitionTlsDirectory32;
+
+/// struct definition for above TLS directory for PE32+ images
+extern const StructDefinition g_definitionTlsDirectory64;
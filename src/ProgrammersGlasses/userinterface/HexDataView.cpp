@@ -36,13 +36,22 @@ HexDataView::HexDataView(
    const File& file,
    size_t blockStartOffset,
    size_t blockSize)
-   :m_file(file),
+   :m_data(file.Data<BYTE>()),
    m_blockStartOffset(blockStartOffset),
    m_blockSize(blockSize),
    m_firstLineOffset(m_blockStartOffset)
 {
 }
 
+HexDataView::HexDataView(std::shared_ptr<const std::vector<BYTE>> dataBuffer)
+   :m_data(dataBuffer->data()),
+   m_dataBuffer(dataBuffer),
+   m_blockStartOffset(0),
+   m_blockSize(dataBuffer->size()),
+   m_firstLineOffset(0)
+{
+}
+
 /// this is the font we prefer
 static LPCTSTR c_fontName = _T("Consolas");
 
@@ -504,7 +513,7 @@ void HexDataView::DoPaint(CDCHandle dc)
 
             LPTSTR p = buffer + (lineByteOffset == 0 ? 0 : 1);
             buffer[0] = ' ';
-            LPCBYTE byteOffset = m_file.Data<BYTE>(currentOffset + lineByteOffset);
+            LPCBYTE byteOffset = m_data + currentOffset + lineByteOffset;
             switch (m_dataSize) {
             case 1:
                ::wsprintf(p, _T("%02X"), (long)*(byteOffset));
@@ -583,7 +592,7 @@ void HexDataView::DoPaint(CDCHandle dc)
                }
             }
 
-            TCHAR ch = *m_file.Data<BYTE>(currentOffset + lineByteOffset);
+            TCHAR ch = m_data[currentOffset + lineByteOffset];
             ch = isprint(ch) ? ch : m_invalidAsciiChar;
 
             CRect rcAscii = { xpos, ypos, xpos + 100, ypos + lineHeight };
@@ -18,9 +18,10 @@ typedef CWinTraitsOR<WS_VSCROLL> HexDataViewWinTraits;
 /// \brief hex data view
 /// inspired by CHexEditorCtrl from Bjarke Viksoe,
 /// see https://www.viksoe.dk/code/hexeditor.htm
-/// The control displays a block or all data from a File instance. First, the
-/// address offset in the file is displayed, then the data bytes, and then the
-/// same bytes as ASCII, when it's a printable data byte.
+/// The control displays a block or all data from a File instance, or data from
+/// a memory buffer, e.g. decompressed data. First, the address offset in the
+/// file or buffer is displayed, then the data bytes, and then the same bytes
+/// as ASCII, when it's a printable data byte.
 /// Data bytes can be selected, and the selection is also marked in the ASCII
 /// area and vice versa.
 class HexDataView :
@@ -35,6 +36,9 @@ public:
       size_t blockStartOffset,
       size_t blockSize);
 
+   /// ctor; takes a memory buffer to display; the view keeps the buffer alive
+   explicit HexDataView(std::shared_ptr<const std::vector<BYTE>> dataBuffer);
+
    DECLARE_WND_CLASS_EX(
       _T("HexDataView"),
       CS_HREDRAW | CS_VREDRAW | CS_DBLCLKS,
@@ -72,8 +76,11 @@ public:
    }
 
 private:
-   /// file to display
-   const File& m_file;
+   /// pointer to the start of the file or buffer data to display
+   const BYTE* m_data;
+
+   /// memory buffer to display; empty when displaying file data
+   std::shared_ptr<const std::vector<BYTE>> m_dataBuffer;
 
    /// start offset in file of block to display
    DWORD_PTR m_blockStartOffset;
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file MainFrame.cpp
 /// \brief main frame window
@@ -85,9 +85,19 @@ LRESULT MainFrame::OnDestroy(UINT /*uMsg*/, WPARAM /*wParam*/, LPARAM /*lParam*/
 
 LRESULT MainFrame::OnOpenFiles(UINT /*uMsg*/, WPARAM /*wParam*/, LPARAM /*lParam*/, BOOL& /*bHandled*/)
 {
-   for (const auto& filename : m_filenamesList)
-      OpenFile(filename);
+   if (m_diffFiles && m_filenamesList.size() == 2)
+      OpenDiff(m_filenamesList[0], m_filenamesList[1]);
+   else if (m_symbolConflicts && !m_filenamesList.empty())
+      OpenSymbolConflicts(m_filenamesList);
+   else
+   {
+      for (const auto& filename : m_filenamesList)
+         OpenFile(filename);
+   }
 
+   // only the files specified at startup are compared or analyzed
+   m_diffFiles = false;
+   m_symbolConflicts = false;
    m_filenamesList.clear();
 
    return 0;
@@ -216,6 +226,77 @@ void MainFrame::OpenFile(const CString& filename)
    m_mru.WriteToRegistry(c_appSettingsRegKey);
 }
 
+void MainFrame::OpenDiff(const CString& oldFilename, const CString& newFilename)
+{
+   for (const CString& filename : { oldFilename, newFilename })
+   {
+      if (!Path::FileExists(filename))
+      {
+         CString message{ _T("Couldn't open file: ") + filename };
+         AtlMessageBox(m_hWnd,
+            message.GetString(),
+            IDR_MAINFRAME,
+            MB_OK | MB_ICONEXCLAMATION);
+         return;
+      }
+   }
+
+   CString errorText;
+   auto reader = m_moduleManager.LoadDiff(oldFilename, newFilename, errorText);
+
+   if (reader == nullptr)
+   {
+      AtlMessageBox(m_hWnd,
+         errorText.GetString(),
+         IDR_MAINFRAME,
+         MB_OK | MB_ICONEXCLAMATION);
+      return;
+   }
+
+   // NodeAndContentView deletes itself in OnFinalMessage()
+   NodeAndContentView* view = new NodeAndContentView(reader);
+   view->CreateEx(m_hWndClient, rcDefault,
+      Path::FilenameAndExt(oldFilename) + _T(" <> ") + Path::FilenameAndExt(newFilename));
+
+   MDIMaximize(view->m_hWnd);
+}
+
+void MainFrame::OpenSymbolConflicts(const std::vector<CString>& filenamesList)
+{
+   for (const CString& filename : filenamesList)
+   {
+      if (!Path::FileExists(filename))
+      {
+         CString message{ _T("Couldn't open file: ") + filename };
+         AtlMessageBox(m_hWnd,
+            message.GetString(),
+            IDR_MAINFRAME,
+            MB_OK | MB_ICONEXCLAMATION);
+         return;
+      }
+   }
+
+   CString errorText;
+   auto reader = m_moduleManager.LoadSymbolConflicts(filenamesList, errorText);
+
+   if (reader == nullptr)
+   {
+      AtlMessageBox(m_hWnd,
+         errorText.GetString(),
+         IDR_MAINFRAME,
+         MB_OK | MB_ICONEXCLAMATION);
+      return;
+   }
+
+   // NodeAndContentView deletes itself in OnFinalMessage()
+   NodeAndContentView* view = new NodeAndContentView(reader);
+   view->CreateEx(m_hWndClient, rcDefault,
+      _T("Symbol conflicts: ") + Path::FilenameAndExt(filenamesList.front()) +
+      (filenamesList.size() > 1 ? _T(", ...") : _T("")));
+
+   MDIMaximize(view->m_hWnd);
+}
+
 CString MainFrame::AddSupportedFilesFilter(const CString& filter)
 {
    std::vector<CString> filterStringsList = StringSplit(filter, _T("|"), true);
@@ -1,6 +1,6 @@
 //
 // Programmer's Glasses - a developer's file content viewer
-// Copyright (c) 2020 Michael Fink
+// Copyright (c) 2020-2026 Michael Fink
 //
 /// \file MainFrame.hpp
 /// \brief main frame window
@@ -32,9 +32,13 @@ class MainFrame :
    typedef CTabbedRibbonMDIFrameWindowImpl<MainFrame> baseClass;
 
 public:
-   /// ctor
-   explicit MainFrame(const std::vector<CString>& filenamesList)
-      :m_filenamesList(filenamesList)
+   /// ctor; when diffFiles is set, the two files are compared instead of
+   /// being opened separately; when symbolConflicts is set, all files are
+   /// analyzed together for symbol conflicts
+   MainFrame(const std::vector<CString>& filenamesList, bool diffFiles, bool symbolConflicts)
+      :m_filenamesList(filenamesList),
+      m_diffFiles(diffFiles),
+      m_symbolConflicts(symbolConflicts)
    {
    }
 
@@ -130,6 +134,12 @@ private:
    /// opens new file
    void OpenFile(const CString& filename);
 
+   /// opens a view comparing two files
+   void OpenDiff(const CString& oldFilename, const CString& newFilename);
+
+   /// opens a view with the symbol conflicts of all files
+   void OpenSymbolConflicts(const std::vector<CString>& filenamesList);
+
    /// adds a "all supported files" filter in front of the filter string
    static CString AddSupportedFilesFilter(const CString& filter);
 
@@ -143,6 +153,13 @@ public:
    /// list of filenames to open at startup
    std::vector<CString> m_filenamesList;
 
+   /// indicates if the files to open at startup should be compared
+   bool m_diffFiles;
+
+   /// indicates if the files to open at startup should be analyzed for
+   /// symbol conflicts
+   bool m_symbolConflicts;
+
    /// manager for all modules
    ModuleManager m_moduleManager;
 };
@@ -37,6 +37,9 @@ set FILES=test\lib-with-coff-obj.lib ^
     ..\intermediate\vcpkg_installed\x64-windows-static\lib\ulib.lib ^
     ProgrammersGlasses\userinterface\res\Ribbon\app_exit_16.png ^
     test\JCH-Blizzard.sid ^
+    test\testelf.elf ^
+    test\testmacho.dylib ^
+    test\testminidump.dmp ^
     ..\bin\x64\Release\ProgrammersGlasses.exe
 
 echo Collecting code coverage...
@@ -48,12 +51,70 @@ Microsoft.CodeCoverage.Console.exe collect ^
    --console ^
    %FILES%
 
+echo Collecting code coverage of structural diff...
+
+Microsoft.CodeCoverage.Console.exe collect ^
+   --settings CodeCoverage.runsettings ^
+   --output ..\intermediate\CoverageReport-diff-cobertura.xml ^
+   ..\bin\x64\Release\ProgrammersGlasses.exe ^
+   --console ^
+   --diff ^
+   test\teststaticlib.lib ^
+   test\lib-with-coff-obj.lib
+
+echo Collecting code coverage of symbol conflicts analysis...
+
+Microsoft.CodeCoverage.Console.exe collect ^
+   --settings CodeCoverage.runsettings ^
+   --output ..\intermediate\CoverageReport-conflicts-cobertura.xml ^
+   ..\bin\x64\Release\ProgrammersGlasses.exe ^
+   --console ^
+   --symbol-conflicts ^
+   test\teststaticlib.lib ^
+   test\teststaticlib.obj ^
+   test\lib-with-coff-obj.lib
+
+echo Collecting code coverage of debug info mode...
+
+Microsoft.CodeCoverage.Console.exe collect ^
+   --settings CodeCoverage.runsettings ^
+   --output ..\intermediate\CoverageReport-debuginfo-cobertura.xml ^
+   ..\bin\x64\Release\ProgrammersGlasses.exe ^
+   --console ^
+   --debug-info ^
+   ..\bin\x64\Release\ProgrammersGlasses.exe ^
+   test\teststaticlib.obj
+
+echo Collecting code coverage of build-id mode...
+
+Microsoft.CodeCoverage.Console.exe collect ^
+   --settings CodeCoverage.runsettings ^
+   --output ..\intermediate\CoverageReport-buildid-cobertura.xml ^
+   ..\bin\x64\Release\ProgrammersGlasses.exe ^
+   --console ^
+   --build-id ^
+   test\testelf.elf ^
+   test\testmacho.dylib
+
+echo Collecting code coverage of symbol lookup...
+
+Microsoft.CodeCoverage.Console.exe collect ^
+   --settings CodeCoverage.runsettings ^
+   --output ..\intermediate\CoverageReport-lookup-cobertura.xml ^
+   ..\bin\x64\Release\ProgrammersGlasses.exe ^
+   --console ^
+   --lookup-symbol testelf ^
+   --lookup-symbol testelf_value ^
+   --lookup-symbol _testmacho ^
+   test\testelf.elf ^
+   test\testmacho.dylib
+
 echo Converting Cobertura to SonarQube xml...
 
 echo Generating report...
 
 ReportGenerator ^
-    -reports:..\intermediate\CoverageReport-cobertura.xml ^
+    -reports:..\intermediate\CoverageReport-cobertura.xml;..\intermediate\CoverageReport-diff-cobertura.xml;..\intermediate\CoverageReport-conflicts-cobertura.xml;..\intermediate\CoverageReport-debuginfo-cobertura.xml;..\intermediate\CoverageReport-buildid-cobertura.xml;..\intermediate\CoverageReport-lookup-cobertura.xml ^
     -reporttypes:Html;SonarQube ^
     -filefilters:-*\vctools\* ^
     -targetdir:..\intermediate\CoverageReport
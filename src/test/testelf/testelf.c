@@ -0,0 +1,12 @@
+// testelf.c : shared library used to test the ELF module, as testelf.elf
+//
+// built on Linux x86-64 with:
+// gcc -shared -fPIC -O1 -g -gz=zlib -fdebug-prefix-map=$PWD=. -Wl,--build-id -o ../testelf.elf testelf.c
+
+int testelf_value = 42;
+
+// This is an example of a library function
+int testelf(void)
+{
+   return testelf_value;
+}
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+#
+# testmacho.py : generates testmacho.dylib, used to test the Mach-O module
+#
+# The file is a universal (fat) binary with an x86_64 and an arm64 slice. Each
+# slice is a small dynamic library with an exported function and variable, an
+# export trie, chained fixups with a bind and a rebase, and a symbol table.
+# It is generated, since building Mach-O files needs the Apple toolchain.
+#
+# usage: python3 testmacho.py ../testmacho.dylib
+#
+import struct
+import sys
+
+LC_SEGMENT_64 = 0x19
+LC_SYMTAB = 0x02
+LC_DYSYMTAB = 0x0b
+LC_LOAD_DYLIB = 0x0c
+LC_ID_DYLIB = 0x0d
+LC_UUID = 0x1b
+LC_DYLD_EXPORTS_TRIE = 0x80000033
+LC_DYLD_CHAINED_FIXUPS = 0x80000034
+
+TEXT_OFFSET = 0x300
+DATA_OFFSET = 0x400
+LINKEDIT_OFFSET = 0x418
+VALUE_ADDRESS = 0x4010
+
+
+def pad(data, alignment):
+    return data + b'\0' * (-len(data) % alignment)
+
+
+def name16(name):
+    return name.encode().ljust(16, b'\0')
+
+
+def uleb128(value):
+    result = b''
+    while True:
+        byte = value & 0x7f
+        value >>= 7
+        if value != 0:
+            result += bytes([byte | 0x80])
+        else:
+            return result + bytes([byte])
+
+
+def segment(name, vm_address, vm_size, file_offset, file_size, protection, sections):
+    command = struct.pack('<II16sQQQQIIII', LC_SEGMENT_64, 72 + 80 * len(sections),
+        name16(name), vm_address, vm_size, file_offset, file_size,
+        protection, protection, len(sections), 0)
+    for section_name, address, size, offset, align, flags in sections:
+        command += struct.pack('<16s16sQQIIIIIIII', name16(section_name), name16(name),
+            address, size, offset, align, 0, 0, flags, 0, 0, 0)
+    return command
+
+
+def dylib(command_type, name, current_version):
+    command = struct.pack('<IIIIII', command_type, 0, 24, 2, current_version, 0x10000)
+    command = pad(command + name.encode() + b'\0', 8)
+    return command[:4] + struct.pack('<I', len(command)) + command[8:]
+
+
+def export_trie():
+    # root -> "_testmacho" (function) -> "_value" (variable)
+    leaf_terminal = uleb128(0) + uleb128(VALUE_ADDRESS)
+    leaf = uleb128(len(leaf_terminal)) + leaf_terminal + b'\0'
+    node_terminal = uleb128(0) + uleb128(TEXT_OFFSET)
+    node = uleb128(len(node_terminal)) + node_terminal
+    node_size = len(node) + 1 + len(b'_value\0') + 1
+    root = b'\0' + b'\1' + b'_testmacho\0'
+    root += uleb128(len(root) + 1)
+    node += b'\1' + b'_value\0' + uleb128(len(root) + node_size)
+    return pad(root + node + leaf, 8)
+
+
+def chained_fixups():
+    symbols = b'\0_printf\0'
+
+    starts_offset = 32
+    starts = struct.pack('<IIII', 3, 0, 16, 0)
+    starts += struct.pack('<IHHQIHH', 24, 0x4000, 6, 0x4000, 0, 1, 0)
+    imports_offset = starts_offset + len(starts)
+    imports = struct.pack('<I', 1 | (1 << 9))
+    symbols_offset = imports_offset + len(imports)
+
+    header = struct.pack('<IIIIIII', 0, starts_offset, imports_offset, symbols_offset, 1, 1, 0)
+    return pad(pad(header, 32) + starts + imports + symbols, 8)
+
+
+def fixup_pointers():
+    # DYLD_CHAINED_PTR_64_OFFSET: a bind to _printf, followed by a rebase;
+    # then the exported variable
+    bind = (1 << 63) | (2 << 51) | 0
+    rebase = TEXT_OFFSET
+    return struct.pack('<QQQ', bind, rebase, 42)
+
+
+def slice_data(cpu_type, cpu_subtype, code, uuid):
+    fixups = chained_fixups()
+    trie = export_trie()
+
+    strings = b' \0_testmacho\0_testmacho_value\0_printf\0'
+    symbols = struct.pack('<IBBHQ', 2, 0x0f, 1, 0, TEXT_OFFSET)
+    symbols += struct.pack('<IBBHQ', 13, 0x0f, 3, 0, VALUE_ADDRESS)
+    symbols += struct.pack('<IBBHQ', 30, 0x01, 0, 0x0100, 0)
+
+    fixups_offset = LINKEDIT_OFFSET
+    trie_offset = fixups_offset + len(fixups)
+    symbols_offset = trie_offset + len(trie)
+    strings_offset = symbols_offset + len(symbols)
+    linkedit_size = strings_offset + len(strings) - LINKEDIT_OFFSET
+
+    commands = [
+        segment('__TEXT', 0, 0x4000, 0, DATA_OFFSET, 5,
+            [('__text', TEXT_OFFSET, len(code), TEXT_OFFSET, 2, 0x80000400)]),
+        segment('__DATA_CONST', 0x4000, 0x4000, DATA_OFFSET, 0x18, 3,
+            [('__got', 0x4000, 0x10, DATA_OFFSET, 3, 0x6),
+             ('__const', VALUE_ADDRESS, 0x8, DATA_OFFSET + 0x10, 3, 0)]),
+        segment('__LINKEDIT', 0x8000, 0x4000, LINKEDIT_OFFSET, linkedit_size, 1, []),
+        dylib(LC_ID_DYLIB, '@rpath/libtestmacho.dylib', 0x10000),
+        dylib(LC_LOAD_DYLIB, '/usr/lib/libSystem.B.dylib', 0x05470000),
+        struct.pack('<II16s', LC_UUID, 24, uuid),
+        struct.pack('<IIII', LC_DYLD_CHAINED_FIXUPS, 16, fixups_offset, len(fixups)),
+        struct.pack('<IIII', LC_DYLD_EXPORTS_TRIE, 16, trie_offset, len(trie)),
+        struct.pack('<IIIIII', LC_SYMTAB, 24, symbols_offset, 3, strings_offset, len(strings)),
+        struct.pack('<20I', LC_DYSYMTAB, 80, 0, 0, 0, 2, 2, 1, *([0] * 12)),
+    ]
+
+    load_commands = b''.join(commands)
+    header = struct.pack('<IIIIIIII', 0xfeedfacf, cpu_type, cpu_subtype, 6,
+        len(commands), len(load_commands), 0x00100084, 0)
+
+    data = header + load_commands
+    assert len(data) <= TEXT_OFFSET
+    data = data.ljust(TEXT_OFFSET, b'\0') + code
+    data = data.ljust(DATA_OFFSET, b'\0') + fixup_pointers()
+    return data + fixups + trie + symbols + strings
+
+
+def main():
+    slices = [
+        # x86_64: mov eax, 42; ret
+        (0x01000007, 3, bytes.fromhex('b82a000000c3'), bytes(range(0x10, 0x20))),
+        # arm64: mov w0, #42; ret
+        (0x0100000c, 0, struct.pack('<II', 0x52800540, 0xd65f03c0), bytes(range(0x20, 0x30))),
+    ]
+
+    alignment = 12
+    fat = struct.pack('>II', 0xcafebabe, len(slices))
+    offset = 1 << alignment
+    slice_list = []
+    for cpu_type, cpu_subtype, code, uuid in slices:
+        data = slice_data(cpu_type, cpu_subtype, code, uuid)
+        fat += struct.pack('>IIIII', cpu_type, cpu_subtype, offset, len(data), alignment)
+        slice_list.append((offset, data))
+        offset += len(data) + (-len(data) % (1 << alignment))
+
+    for offset, data in slice_list:
+        fat = fat.ljust(offset, b'\0') + data
+
+    with open(sys.argv[1], 'wb') as output:
+        output.write(fat)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+#
+# testminidump.py : generates testminidump.dmp, used to test the minidump module
+#
+# The file is a small x64 minidump of a process that crashed with an access
+# violation in testdll.dll. It contains a system info, thread list, module
+# list, exception, memory list and memory64 list stream. The thread stack is
+# stored in the memory list, the code around the exception address in the
+# memory64 list. It is generated, since real minidumps contain a lot more
+# memory and user specific paths.
+#
+# usage: python3 testminidump.py ../testminidump.dmp
+#
+import struct
+import sys
+
+STREAM_THREAD_LIST = 3
+STREAM_MODULE_LIST = 4
+STREAM_MEMORY_LIST = 5
+STREAM_EXCEPTION = 6
+STREAM_SYSTEM_INFO = 7
+STREAM_MEMORY64_LIST = 9
+
+THREAD_ID = 0x1a2c
+STACK_ADDRESS = 0x000000000014f000
+STACK_SIZE = 0x100
+MODULE_BASE = 0x0000000180000000
+MODULE_SIZE = 0x3000
+CODE_ADDRESS = MODULE_BASE + 0x1000
+EXCEPTION_ADDRESS = CODE_ADDRESS + 0x10
+TIME_STAMP = 0x68e8f400
+
+# AMD64 CONTEXT; only the context flags, rsp and rip are set
+CONTEXT_SIZE = 0x4d0
+CONTEXT_AMD64_FULL = 0x0010000b
+
+
+class Builder:
+    def __init__(self, offset):
+        self.data = b''
+        self.offset = offset
+
+    def add(self, data, alignment=4):
+        self.data += b'\0' * (-(self.offset + len(self.data)) % alignment)
+        rva = self.offset + len(self.data)
+        self.data += data
+        return rva
+
+
+def minidump_string(text):
+    encoded = text.encode('utf-16-le')
+    return struct.pack('<I', len(encoded)) + encoded + b'\0\0'
+
+
+def context():
+    data = bytearray(CONTEXT_SIZE)
+    struct.pack_into('<I', data, 0x30, CONTEXT_AMD64_FULL)
+    struct.pack_into('<Q', data, 0x98, STACK_ADDRESS + 0x80)
+    struct.pack_into('<Q', data, 0xf8, EXCEPTION_ADDRESS)
+    return bytes(data)
+
+
+def code():
+    # sub rsp, 28h; xor eax, eax; padded with int 3; then at the exception
+    # address: mov dword ptr [rax], 2Ah; add rsp, 28h; ret
+    data = bytes.fromhex('4883ec2833c0').ljust(0x10, b'\xcc')
+    data += bytes.fromhex('c7002a0000004883c428c3')
+    return data.ljust(0x100, b'\xcc')
+
+
+def main():
+    stream_types = [
+        STREAM_SYSTEM_INFO,
+        STREAM_THREAD_LIST,
+        STREAM_MODULE_LIST,
+        STREAM_EXCEPTION,
+        STREAM_MEMORY_LIST,
+        STREAM_MEMORY64_LIST,
+    ]
+
+    directory_rva = 32
+    builder = Builder(directory_rva + 12 * len(stream_types))
+    streams = {}
+
+    # system info: AMD64, 4 processors, Windows 10 build 19045
+    csd_version_rva = builder.add(minidump_string(''))
+    system_info = struct.pack('<HHHBBIIIIIHH', 9, 6, 0x9e0d, 4, 1,
+        10, 0, 19045, 2, csd_version_rva, 0x100, 0)
+    system_info += struct.pack('<III', 0x756e6547, 0x49656e69, 0x6c65746e)
+    system_info += struct.pack('<III', 0x000906ea, 0xbfebfbff, 0)
+    streams[STREAM_SYSTEM_INFO] = (builder.add(system_info), len(system_info))
+
+    context_rva = builder.add(context(), 16)
+
+    stack = bytearray(STACK_SIZE)
+    struct.pack_into('<Q', stack, 0xa8, MODULE_BASE + 0x2040)
+    stack_rva = builder.add(bytes(stack), 16)
+
+    # thread list
+    thread_list = struct.pack('<I', 1)
+    thread_list += struct.pack('<IIIIQQIIII', THREAD_ID, 0, 0x20, 0,
+        0x000000000030d000, STACK_ADDRESS, STACK_SIZE, stack_rva,
+        CONTEXT_SIZE, context_rva)
+    streams[STREAM_THREAD_LIST] = (builder.add(thread_list), len(thread_list))
+
+    # module list, with version info and a CodeView record
+    module_name_rva = builder.add(minidump_string('C:\\Test\\testdll.dll'))
+    cv_record = b'RSDS' + bytes(range(0x40, 0x50)) + struct.pack('<I', 1) + b'testdll.pdb\0'
+    cv_record_rva = builder.add(cv_record)
+
+    version_info = struct.pack('<13I', 0xfeef04bd, 0x00010000,
+        0x00010002, 0x00030004, 0x00010002, 0x00030004,
+        0x3f, 0, 0x00040004, 2, 0, 0, 0)
+    module_list = struct.pack('<I', 1)
+    module_list += struct.pack('<QIIII', MODULE_BASE, MODULE_SIZE, 0x0000e1f3,
+        TIME_STAMP, module_name_rva)
+    module_list += version_info
+    module_list += struct.pack('<IIIIQQ', len(cv_record), cv_record_rva, 0, 0, 0, 0)
+    streams[STREAM_MODULE_LIST] = (builder.add(module_list), len(module_list))
+
+    # exception: write access violation at address 0
+    exception = struct.pack('<IIIIQQII', THREAD_ID, 0, 0xc0000005, 0,
+        0, EXCEPTION_ADDRESS, 2, 0)
+    exception += struct.pack('<15Q', 1, 0, *([0] * 13))
+    exception += struct.pack('<II', CONTEXT_SIZE, context_rva)
+    streams[STREAM_EXCEPTION] = (builder.add(exception), len(exception))
+
+    # memory list, with the thread stack
+    memory_list = struct.pack('<IQII', 1, STACK_ADDRESS, STACK_SIZE, stack_rva)
+    streams[STREAM_MEMORY_LIST] = (builder.add(memory_list), len(memory_list))
+
+    # memory64 list, with the code at the exception address; the data follows
+    # all other streams
+    code_data = code()
+    memory64_list_size = 16 + 16
+    memory64_list_rva = builder.add(b'\0' * memory64_list_size, 8)
+    code_rva = builder.add(code_data, 16)
+    memory64_list = struct.pack('<QQQQ', 1, code_rva, CODE_ADDRESS, len(code_data))
+    streams[STREAM_MEMORY64_LIST] = (memory64_list_rva, memory64_list_size)
+
+    data = bytearray(builder.data)
+    start = memory64_list_rva - builder.offset
+    data[start:start + memory64_list_size] = memory64_list
+
+    header = struct.pack('<IIIIIIQ', 0x504d444d, 0x0000a793, len(stream_types),
+        directory_rva, 0, TIME_STAMP, 0)
+
+    directory = b''
+    for stream_type in stream_types:
+        rva, size = streams[stream_type]
+        directory += struct.pack('<III', stream_type, size, rva)
+
+    with open(sys.argv[1], 'wb') as output:
+        output.write(header + directory + bytes(data))
+
+
+if __name__ == '__main__':
+    main()